@@ -85,7 +85,9 @@ StoryControllerV2::StoryControllerV2(AudioService& audio, const Hooks& hooks, co
     : audio_(audio),
       hooks_(hooks),
       options_(options),
-      testDelayMs_(options.etape2TestDelayMs) {}
+      testDelayMs_(options.etape2TestDelayMs) {
+  etape2Timer_ = engine_.deadlines().acquire("etape2");
+}
 
 bool StoryControllerV2::begin(uint32_t nowMs) {
   return setScenario(options_.defaultScenarioId, nowMs, "boot");
@@ -191,10 +193,9 @@ void StoryControllerV2::update(uint32_t nowMs) {
     maxQueueDepth_ = beforeTick.queuedEvents;
   }
 
-  const char* currentStep = stepId();
-  if (currentStep != nullptr && sameText(currentStep, options_.waitEtape2StepId) &&
-      etape2DueMs_ != 0U && !etape2DuePosted_ &&
-      static_cast<int32_t>(nowMs - etape2DueMs_) >= 0) {
+  // Armed only while the wait-etape2 step is active (see applyCurrentStep).
+  if (engine_.deadlines().isDue(etape2Timer_, nowMs)) {
+    engine_.deadlines().cancel(etape2Timer_);
     etape2DuePosted_ = true;
     postEvent(StoryEventType::kTimer, options_.timerEventName, 1, nowMs, "timer_due");
   }
@@ -313,8 +314,7 @@ void StoryControllerV2::setTestMode(bool enabled, uint32_t nowMs, const char* so
   }
   testMode_ = enabled;
   if (sameText(stepId(), options_.waitEtape2StepId)) {
-    etape2DueMs_ = nowMs + activeDelayMs();
-    etape2DuePosted_ = false;
+    armEtape2Timer(nowMs);
   }
   Serial.printf("[STORY_V2] test mode=%u delay=%lu ms (%s)\n",
                 testMode_ ? 1U : 0U,
@@ -330,8 +330,7 @@ void StoryControllerV2::setTestDelayMs(uint32_t delayMs, uint32_t nowMs, const c
   }
   testDelayMs_ = delayMs;
   if (testMode_ && sameText(stepId(), options_.waitEtape2StepId)) {
-    etape2DueMs_ = nowMs + activeDelayMs();
-    etape2DuePosted_ = false;
+    armEtape2Timer(nowMs);
   }
   Serial.printf("[STORY_V2] test delay=%lu ms (%s)\n",
                 static_cast<unsigned long>(testDelayMs_),
@@ -609,8 +608,7 @@ void StoryControllerV2::applyCurrentStep(uint32_t nowMs, const char* source) {
     return;
   }
 
-  etape2DueMs_ = 0U;
-  etape2DuePosted_ = false;
+  cancelEtape2Timer();
 
   const ScenarioDef* scenario = engine_.scenario();
   if (!appHost_.startStep(scenario, step, nowMs, source)) {
@@ -624,8 +622,7 @@ void StoryControllerV2::applyCurrentStep(uint32_t nowMs, const char* source) {
   safeCopy(activeScreenSceneId_, sizeof(activeScreenSceneId_), sceneId);
 
   if (sameText(step->id, options_.waitEtape2StepId)) {
-    etape2DueMs_ = nowMs + activeDelayMs();
-    etape2DuePosted_ = false;
+    armEtape2Timer(nowMs);
     Serial.printf("[STORY_V2] etape2 timer armed in %lu ms\n",
                   static_cast<unsigned long>(activeDelayMs()));
   }
@@ -635,9 +632,20 @@ uint32_t StoryControllerV2::activeDelayMs() const {
   return testMode_ ? testDelayMs_ : options_.etape2DelayMs;
 }
 
-void StoryControllerV2::resetRuntimeState() {
+void StoryControllerV2::armEtape2Timer(uint32_t nowMs) {
+  etape2DueMs_ = nowMs + activeDelayMs();
+  etape2DuePosted_ = false;
+  engine_.deadlines().arm(etape2Timer_, etape2DueMs_);
+}
+
+void StoryControllerV2::cancelEtape2Timer() {
   etape2DueMs_ = 0U;
   etape2DuePosted_ = false;
+  engine_.deadlines().cancel(etape2Timer_);
+}
+
+void StoryControllerV2::resetRuntimeState() {
+  cancelEtape2Timer();
   safeCopy(activeScreenSceneId_, sizeof(activeScreenSceneId_), nullptr);
   hasLastPostedEvent_ = false;
   lastPostedEventAtMs_ = 0U;
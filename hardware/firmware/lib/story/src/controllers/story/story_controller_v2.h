@@ -121,6 +121,8 @@ class StoryControllerV2 {
                          bool notifyApps);
   void applyCurrentStep(uint32_t nowMs, const char* source);
   uint32_t activeDelayMs() const;
+  void armEtape2Timer(uint32_t nowMs);
+  void cancelEtape2Timer();
   void resetRuntimeState();
   StoryEventSink makeAppEventSink(const char* source);
   static bool postEventFromSink(const StoryEvent& event, void* user);
@@ -136,6 +138,7 @@ class StoryControllerV2 {
   uint32_t testDelayMs_ = 5000U;
   uint32_t etape2DueMs_ = 0U;
   bool etape2DuePosted_ = false;
+  int8_t etape2Timer_ = StoryDeadlineQueue::kInvalidTimer;
   bool paused_ = false;
   uint32_t pausedAtMs_ = 0U;
   TraceLevel traceLevel_ = TraceLevel::kOff;
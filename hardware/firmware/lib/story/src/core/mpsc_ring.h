@@ -0,0 +1,119 @@
+// mpsc_ring.h - bounded lock-free multi-producer/single-consumer ring.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Fixed array of cells, each with a sequence number (bounded MPMC queue by
+// D. Vyukov, reduced to one consumer). Producers may run on the WiFi task or
+// in an ISR: they never block and never allocate; a full ring drops the new
+// element and counts it. The consumer reads cells in place, so an element is
+// copied once, by its producer. Shared by the ESP-NOW receive path and the
+// story event queue lanes.
+template <typename T, size_t Capacity>
+class MpscRing {
+  static_assert(Capacity >= 2U && (Capacity & (Capacity - 1U)) == 0U, "Capacity must be a power of two");
+
+ public:
+  MpscRing() {
+    reset();
+  }
+
+  // Only while no producer can run (e.g. after the callback is unregistered).
+  void reset() {
+    for (size_t index = 0U; index < Capacity; ++index) {
+      cells_[index].seq.store(static_cast<uint32_t>(index), std::memory_order_relaxed);
+    }
+    head_ = 0U;
+    tail_.store(0U, std::memory_order_relaxed);
+    resetCounters();
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  // Safe while producers run; a concurrent push may land just before or after.
+  void resetCounters() {
+    pushed_.store(0U, std::memory_order_relaxed);
+    overflow_.store(0U, std::memory_order_relaxed);
+  }
+
+  // Producer side. `fill(T&)` writes the element in place; false when full.
+  template <typename Fill>
+  bool push(Fill fill) {
+    uint32_t pos = tail_.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    for (;;) {
+      cell = &cells_[pos & kMask];
+      const uint32_t seq = cell->seq.load(std::memory_order_acquire);
+      const int32_t diff = static_cast<int32_t>(seq - pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        overflow_.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+    fill(cell->value);
+    cell->seq.store(pos + 1U, std::memory_order_release);
+    pushed_.fetch_add(1U, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Consumer side. Number of published cells ready at the head, up to `limit`.
+  size_t ready(size_t limit = Capacity) const {
+    size_t count = 0U;
+    while (count < limit && count < Capacity) {
+      const Cell& cell = cells_[(head_ + count) & kMask];
+      if (cell.seq.load(std::memory_order_acquire) != head_ + count + 1U) {
+        break;
+      }
+      ++count;
+    }
+    return count;
+  }
+
+  // Element `offset` cells past the head; only valid for offset < ready().
+  const T& peek(size_t offset = 0U) const {
+    return cells_[(head_ + offset) & kMask].value;
+  }
+
+  // Releases the head cell to producers.
+  void pop() {
+    Cell& cell = cells_[head_ & kMask];
+    cell.seq.store(head_ + Capacity, std::memory_order_release);
+    ++head_;
+  }
+
+  // Claimed cells not yet released, including ones still being filled.
+  size_t depth() const {
+    return static_cast<size_t>(tail_.load(std::memory_order_relaxed) - head_);
+  }
+
+  uint32_t pushed() const {
+    return pushed_.load(std::memory_order_relaxed);
+  }
+  uint32_t overflow() const {
+    return overflow_.load(std::memory_order_relaxed);
+  }
+  static constexpr size_t capacity() {
+    return Capacity;
+  }
+
+ private:
+  static constexpr uint32_t kMask = static_cast<uint32_t>(Capacity - 1U);
+
+  struct Cell {
+    std::atomic<uint32_t> seq;
+    T value;
+  };
+
+  Cell cells_[Capacity];
+  uint32_t head_ = 0U;
+  std::atomic<uint32_t> tail_{0U};
+  std::atomic<uint32_t> pushed_{0U};
+  std::atomic<uint32_t> overflow_{0U};
+};
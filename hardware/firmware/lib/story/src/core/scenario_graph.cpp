@@ -0,0 +1,372 @@
+#include "scenario_graph.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+bool isButtonAnyName(StoryEventType type, const char* name) {
+  return type == StoryEventType::kButton && name != nullptr && strcmp(name, "ANY") == 0;
+}
+
+// Ranks two candidates of one step: higher priority first, then declaration order.
+bool ranksBefore(uint8_t lhsPriority, uint8_t lhsIndex, uint8_t rhsPriority, uint8_t rhsIndex) {
+  if (lhsPriority != rhsPriority) {
+    return lhsPriority > rhsPriority;
+  }
+  return lhsIndex < rhsIndex;
+}
+
+template <typename T>
+T* allocArray(size_t count) {
+  return static_cast<T*>(calloc(count > 0U ? count : 1U, sizeof(T)));
+}
+
+}  // namespace
+
+StoryScenarioGraph::~StoryScenarioGraph() {
+  clear();
+}
+
+void StoryScenarioGraph::clear() {
+  free(steps_);
+  free(edges_);
+  free(implicit_);
+  free(targets_);
+  free(names_);
+  free(stepNames_);
+  steps_ = nullptr;
+  edges_ = nullptr;
+  implicit_ = nullptr;
+  targets_ = nullptr;
+  names_ = nullptr;
+  stepNames_ = nullptr;
+  nameCount_ = 0U;
+  initialStepIndex_ = -1;
+  scenario_ = nullptr;
+}
+
+bool StoryScenarioGraph::compile(const ScenarioDef& scenario) {
+  clear();
+  if (scenario.steps == nullptr || scenario.stepCount == 0U) {
+    return false;
+  }
+
+  uint16_t transitionTotal = 0U;
+  uint16_t edgeTotal = 0U;
+  for (uint8_t i = 0U; i < scenario.stepCount; ++i) {
+    const StepDef& step = scenario.steps[i];
+    if (step.transitions == nullptr) {
+      continue;
+    }
+    transitionTotal = static_cast<uint16_t>(transitionTotal + step.transitionCount);
+    for (uint8_t t = 0U; t < step.transitionCount; ++t) {
+      if (step.transitions[t].trigger == StoryTransitionTrigger::kOnEvent) {
+        ++edgeTotal;
+      }
+    }
+  }
+
+  steps_ = allocArray<StepSlot>(scenario.stepCount);
+  edges_ = allocArray<Edge>(edgeTotal);
+  implicit_ = allocArray<uint8_t>(static_cast<size_t>(transitionTotal - edgeTotal));
+  targets_ = allocArray<int16_t>(transitionTotal);
+  names_ = allocArray<NameSlot>(edgeTotal);
+  stepNames_ = allocArray<NameSlot>(scenario.stepCount);
+  if (steps_ == nullptr || edges_ == nullptr || implicit_ == nullptr || targets_ == nullptr ||
+      names_ == nullptr || stepNames_ == nullptr) {
+    clear();
+    return false;
+  }
+  scenario_ = &scenario;
+
+  for (uint8_t i = 0U; i < scenario.stepCount; ++i) {
+    const char* id = scenario.steps[i].id != nullptr ? scenario.steps[i].id : "";
+    stepNames_[i] = {hashText(id), id, i};
+  }
+  sortNames(stepNames_, scenario.stepCount);
+
+  // Intern every distinct transition event name; ids follow hash order.
+  uint16_t rawNames = 0U;
+  for (uint8_t i = 0U; i < scenario.stepCount; ++i) {
+    const StepDef& step = scenario.steps[i];
+    for (uint8_t t = 0U; step.transitions != nullptr && t < step.transitionCount; ++t) {
+      const TransitionDef& tr = step.transitions[t];
+      if (tr.trigger != StoryTransitionTrigger::kOnEvent || tr.eventName == nullptr ||
+          tr.eventName[0] == '\0' || isButtonAnyName(tr.eventType, tr.eventName)) {
+        continue;
+      }
+      names_[rawNames++] = {hashText(tr.eventName), tr.eventName, 0U};
+    }
+  }
+  sortNames(names_, rawNames);
+  for (uint16_t i = 0U; i < rawNames; ++i) {
+    if (nameCount_ > 0U && names_[nameCount_ - 1U].hash == names_[i].hash &&
+        strcmp(names_[nameCount_ - 1U].text, names_[i].text) == 0) {
+      continue;
+    }
+    names_[nameCount_] = names_[i];
+    names_[nameCount_].value = static_cast<uint16_t>(kFirstNamedEvent + nameCount_);
+    ++nameCount_;
+  }
+
+  uint16_t edgeCursor = 0U;
+  uint16_t implicitCursor = 0U;
+  uint16_t transitionCursor = 0U;
+  for (uint8_t i = 0U; i < scenario.stepCount; ++i) {
+    const StepDef& step = scenario.steps[i];
+    StepSlot& slot = steps_[i];
+    slot.edgeBegin = edgeCursor;
+    slot.implicitBegin = implicitCursor;
+    slot.transitionBase = transitionCursor;
+    const uint8_t count = (step.transitions != nullptr) ? step.transitionCount : 0U;
+    for (uint8_t t = 0U; t < count; ++t) {
+      const TransitionDef& tr = step.transitions[t];
+      targets_[transitionCursor + t] = stepIndex(tr.targetStepId);
+
+      if (tr.trigger == StoryTransitionTrigger::kOnEvent) {
+        Edge edge = {};
+        edge.eventType = static_cast<uint8_t>(tr.eventType);
+        edge.priority = tr.priority;
+        edge.transitionIndex = t;
+        if (tr.eventName == nullptr || tr.eventName[0] == '\0') {
+          edge.eventId = kEventAny;
+        } else if (isButtonAnyName(tr.eventType, tr.eventName)) {
+          edge.eventId = kEventAnyNamed;
+        } else {
+          edge.eventId = names_[findName(names_, nameCount_, tr.eventName)].value;
+        }
+        // Insertion keeps equal keys in declaration order.
+        uint16_t pos = edgeCursor;
+        while (pos > slot.edgeBegin) {
+          const Edge& prev = edges_[pos - 1U];
+          const bool after = prev.eventType < edge.eventType ||
+                             (prev.eventType == edge.eventType &&
+                              (prev.eventId < edge.eventId ||
+                               (prev.eventId == edge.eventId && prev.priority >= edge.priority)));
+          if (after) {
+            break;
+          }
+          edges_[pos] = prev;
+          --pos;
+        }
+        edges_[pos] = edge;
+        ++edgeCursor;
+        continue;
+      }
+
+      if (tr.trigger == StoryTransitionTrigger::kAfterMs &&
+          (!slot.hasAfterMs || tr.afterMs < slot.minAfterMs)) {
+        slot.hasAfterMs = true;
+        slot.minAfterMs = tr.afterMs;
+      }
+      uint16_t pos = implicitCursor;
+      while (pos > slot.implicitBegin) {
+        const uint8_t prev = implicit_[pos - 1U];
+        if (step.transitions[prev].priority >= tr.priority) {
+          break;
+        }
+        implicit_[pos] = prev;
+        --pos;
+      }
+      implicit_[pos] = t;
+      ++implicitCursor;
+    }
+    slot.edgeCount = static_cast<uint8_t>(edgeCursor - slot.edgeBegin);
+    slot.implicitCount = static_cast<uint8_t>(implicitCursor - slot.implicitBegin);
+    transitionCursor = static_cast<uint16_t>(transitionCursor + count);
+  }
+
+  initialStepIndex_ = stepIndex(scenario.initialStepId);
+  return true;
+}
+
+bool StoryScenarioGraph::compiled() const {
+  return scenario_ != nullptr;
+}
+
+const ScenarioDef* StoryScenarioGraph::scenario() const {
+  return scenario_;
+}
+
+uint16_t StoryScenarioGraph::eventNameCount() const {
+  return nameCount_;
+}
+
+uint16_t StoryScenarioGraph::eventId(const char* eventName) const {
+  if (eventName == nullptr || eventName[0] == '\0') {
+    return kEventAny;
+  }
+  const int16_t slot = findName(names_, nameCount_, eventName);
+  return (slot >= 0) ? names_[slot].value : kEventUnknown;
+}
+
+int16_t StoryScenarioGraph::stepIndex(const char* stepId) const {
+  if (scenario_ == nullptr || stepId == nullptr || stepId[0] == '\0') {
+    return -1;
+  }
+  const int16_t slot = findName(stepNames_, scenario_->stepCount, stepId);
+  return (slot >= 0) ? static_cast<int16_t>(stepNames_[slot].value) : -1;
+}
+
+int16_t StoryScenarioGraph::initialStepIndex() const {
+  return initialStepIndex_;
+}
+
+int16_t StoryScenarioGraph::targetStepIndex(uint8_t stepIndex, uint8_t transitionIndex) const {
+  if (scenario_ == nullptr || stepIndex >= scenario_->stepCount ||
+      transitionIndex >= scenario_->steps[stepIndex].transitionCount) {
+    return -1;
+  }
+  return targets_[steps_[stepIndex].transitionBase + transitionIndex];
+}
+
+uint8_t StoryScenarioGraph::selectEvent(uint8_t stepIndex,
+                                        StoryEventType type,
+                                        uint16_t eventId,
+                                        uint8_t* outTransitions,
+                                        uint8_t maxOut) const {
+  if (scenario_ == nullptr || stepIndex >= scenario_->stepCount || outTransitions == nullptr ||
+      maxOut == 0U) {
+    return 0U;
+  }
+  const StepSlot& slot = steps_[stepIndex];
+  if (slot.edgeCount == 0U) {
+    return 0U;
+  }
+
+  // Up to three pre-sorted runs can match: the exact name, the empty-name
+  // wildcard and, for named events, the button "ANY" wildcard.
+  const uint8_t typeKey = static_cast<uint8_t>(type);
+  uint16_t heads[3] = {};
+  uint8_t remaining[3] = {};
+  uint8_t runs = 0U;
+  if (eventId >= kFirstNamedEvent && eventId != kEventUnknown) {
+    heads[runs] = edgeRun(slot, typeKey, eventId, &remaining[runs]);
+    ++runs;
+  }
+  heads[runs] = edgeRun(slot, typeKey, kEventAny, &remaining[runs]);
+  ++runs;
+  if (eventId != kEventAny) {
+    heads[runs] = edgeRun(slot, typeKey, kEventAnyNamed, &remaining[runs]);
+    ++runs;
+  }
+
+  uint8_t written = 0U;
+  while (written < maxOut) {
+    int8_t best = -1;
+    for (uint8_t r = 0U; r < runs; ++r) {
+      if (remaining[r] == 0U) {
+        continue;
+      }
+      const Edge& candidate = edges_[heads[r]];
+      if (best < 0 || ranksBefore(candidate.priority,
+                                  candidate.transitionIndex,
+                                  edges_[heads[best]].priority,
+                                  edges_[heads[best]].transitionIndex)) {
+        best = static_cast<int8_t>(r);
+      }
+    }
+    if (best < 0) {
+      break;
+    }
+    outTransitions[written++] = edges_[heads[best]].transitionIndex;
+    ++heads[best];
+    --remaining[best];
+  }
+  return written;
+}
+
+uint8_t StoryScenarioGraph::implicitCount(uint8_t stepIndex) const {
+  if (scenario_ == nullptr || stepIndex >= scenario_->stepCount) {
+    return 0U;
+  }
+  return steps_[stepIndex].implicitCount;
+}
+
+uint8_t StoryScenarioGraph::implicitTransition(uint8_t stepIndex, uint8_t rank) const {
+  return implicit_[steps_[stepIndex].implicitBegin + rank];
+}
+
+bool StoryScenarioGraph::minAfterMs(uint8_t stepIndex, uint32_t* outAfterMs) const {
+  if (scenario_ == nullptr || stepIndex >= scenario_->stepCount || !steps_[stepIndex].hasAfterMs) {
+    return false;
+  }
+  if (outAfterMs != nullptr) {
+    *outAfterMs = steps_[stepIndex].minAfterMs;
+  }
+  return true;
+}
+
+uint32_t StoryScenarioGraph::hashText(const char* text) {
+  uint32_t hash = 2166136261UL;
+  for (const char* it = text; it != nullptr && *it != '\0'; ++it) {
+    hash ^= static_cast<uint8_t>(*it);
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+int16_t StoryScenarioGraph::findName(const NameSlot* slots, uint16_t count, const char* text) {
+  if (slots == nullptr || count == 0U || text == nullptr) {
+    return -1;
+  }
+  const uint32_t hash = hashText(text);
+  uint16_t lo = 0U;
+  uint16_t hi = count;
+  while (lo < hi) {
+    const uint16_t mid = static_cast<uint16_t>((lo + hi) / 2U);
+    if (slots[mid].hash < hash) {
+      lo = static_cast<uint16_t>(mid + 1U);
+    } else {
+      hi = mid;
+    }
+  }
+  for (uint16_t i = lo; i < count && slots[i].hash == hash; ++i) {
+    if (strcmp(slots[i].text, text) == 0) {
+      return static_cast<int16_t>(i);
+    }
+  }
+  return -1;
+}
+
+void StoryScenarioGraph::sortNames(NameSlot* slots, uint16_t count) {
+  for (uint16_t i = 1U; i < count; ++i) {
+    const NameSlot current = slots[i];
+    uint16_t pos = i;
+    while (pos > 0U) {
+      const NameSlot& prev = slots[pos - 1U];
+      if (prev.hash < current.hash ||
+          (prev.hash == current.hash && strcmp(prev.text, current.text) <= 0)) {
+        break;
+      }
+      slots[pos] = prev;
+      --pos;
+    }
+    slots[pos] = current;
+  }
+}
+
+uint16_t StoryScenarioGraph::edgeRun(const StepSlot& slot,
+                                     uint8_t type,
+                                     uint16_t eventId,
+                                     uint8_t* outCount) const {
+  uint16_t lo = slot.edgeBegin;
+  uint16_t hi = static_cast<uint16_t>(slot.edgeBegin + slot.edgeCount);
+  const uint16_t end = hi;
+  while (lo < hi) {
+    const uint16_t mid = static_cast<uint16_t>((lo + hi) / 2U);
+    const Edge& edge = edges_[mid];
+    if (edge.eventType < type || (edge.eventType == type && edge.eventId < eventId)) {
+      lo = static_cast<uint16_t>(mid + 1U);
+    } else {
+      hi = mid;
+    }
+  }
+  uint16_t last = lo;
+  while (last < end && edges_[last].eventType == type && edges_[last].eventId == eventId) {
+    ++last;
+  }
+  *outCount = static_cast<uint8_t>(last - lo);
+  return lo;
+}
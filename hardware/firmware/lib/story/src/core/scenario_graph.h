@@ -0,0 +1,98 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "scenario_def.h"
+
+// Compiled form of a ScenarioDef, built once when a scenario is loaded.
+// Event names are interned to small integer ids, transition targets are
+// resolved to step indices and every step gets its on-event transitions
+// sorted by (eventType, eventId, priority) so dispatch is an integer lookup
+// instead of strcmp scans. The graph references the ScenarioDef strings; the
+// ScenarioDef must outlive it.
+class StoryScenarioGraph {
+ public:
+  // Event ids. kEventAny is the empty transition name (matches every event of
+  // its type), kEventAnyNamed is the button "ANY" wildcard (matches any
+  // non-empty name). Interned names start at kFirstNamedEvent.
+  static constexpr uint16_t kEventAny = 0U;
+  static constexpr uint16_t kEventAnyNamed = 1U;
+  static constexpr uint16_t kFirstNamedEvent = 2U;
+  // Non-empty name that no transition of the scenario listens to.
+  static constexpr uint16_t kEventUnknown = 0xFFFFU;
+
+  StoryScenarioGraph() = default;
+  ~StoryScenarioGraph();
+  StoryScenarioGraph(const StoryScenarioGraph&) = delete;
+  StoryScenarioGraph& operator=(const StoryScenarioGraph&) = delete;
+
+  // Returns false only on allocation failure. Unknown targets compile to -1
+  // so callers that tolerate invalid scenarios keep working.
+  bool compile(const ScenarioDef& scenario);
+  void clear();
+
+  bool compiled() const;
+  const ScenarioDef* scenario() const;
+  uint16_t eventNameCount() const;
+
+  // Hashes the name once; pass the result to selectEvent().
+  uint16_t eventId(const char* eventName) const;
+  int16_t stepIndex(const char* stepId) const;
+  int16_t initialStepIndex() const;
+  int16_t targetStepIndex(uint8_t stepIndex, uint8_t transitionIndex) const;
+
+  // Writes the indices of the on-event transitions of stepIndex that match
+  // (type, eventId), best first: priority descending, then declaration order.
+  // Returns the number written (at most maxOut).
+  uint8_t selectEvent(uint8_t stepIndex,
+                      StoryEventType type,
+                      uint16_t eventId,
+                      uint8_t* outTransitions,
+                      uint8_t maxOut) const;
+
+  // kImmediate and kAfterMs transitions of stepIndex, in the same order.
+  uint8_t implicitCount(uint8_t stepIndex) const;
+  uint8_t implicitTransition(uint8_t stepIndex, uint8_t rank) const;
+  // Smallest afterMs of the step; false when it has no kAfterMs transition.
+  bool minAfterMs(uint8_t stepIndex, uint32_t* outAfterMs) const;
+
+ private:
+  struct Edge {
+    uint16_t eventId;
+    uint8_t eventType;
+    uint8_t priority;
+    uint8_t transitionIndex;
+  };
+
+  struct StepSlot {
+    uint16_t edgeBegin;
+    uint16_t implicitBegin;
+    uint16_t transitionBase;
+    uint8_t edgeCount;
+    uint8_t implicitCount;
+    bool hasAfterMs;
+    uint32_t minAfterMs;
+  };
+
+  struct NameSlot {
+    uint32_t hash;
+    const char* text;
+    uint16_t value;
+  };
+
+  static uint32_t hashText(const char* text);
+  static int16_t findName(const NameSlot* slots, uint16_t count, const char* text);
+  static void sortNames(NameSlot* slots, uint16_t count);
+
+  uint16_t edgeRun(const StepSlot& slot, uint8_t type, uint16_t eventId, uint8_t* outCount) const;
+
+  const ScenarioDef* scenario_ = nullptr;
+  StepSlot* steps_ = nullptr;
+  Edge* edges_ = nullptr;
+  uint8_t* implicit_ = nullptr;
+  int16_t* targets_ = nullptr;
+  NameSlot* names_ = nullptr;
+  NameSlot* stepNames_ = nullptr;
+  uint16_t nameCount_ = 0U;
+  int16_t initialStepIndex_ = -1;
+};
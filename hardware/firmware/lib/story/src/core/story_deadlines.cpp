@@ -0,0 +1,157 @@
+#include "story_deadlines.h"
+
+void StoryDeadlineQueue::clear() {
+  for (uint8_t i = 0U; i < kCapacity; ++i) {
+    slot_[i] = 0U;
+  }
+  size_ = 0U;
+}
+
+int8_t StoryDeadlineQueue::acquire(const char* tag) {
+  if (acquired_ >= kCapacity) {
+    return kInvalidTimer;
+  }
+  const uint8_t timer = acquired_++;
+  tags_[timer] = tag;
+  slot_[timer] = 0U;
+  return static_cast<int8_t>(timer);
+}
+
+bool StoryDeadlineQueue::arm(int8_t timer, uint32_t dueAtMs) {
+  if (!validTimer(timer)) {
+    return false;
+  }
+  const uint8_t id = static_cast<uint8_t>(timer);
+  if (slot_[id] != 0U) {
+    due_[id] = dueAtMs;
+    siftUp(static_cast<uint8_t>(slot_[id] - 1U));
+    siftDown(static_cast<uint8_t>(slot_[id] - 1U));
+    return true;
+  }
+  due_[id] = dueAtMs;
+  place(size_, id);
+  ++size_;
+  siftUp(static_cast<uint8_t>(size_ - 1U));
+  return true;
+}
+
+bool StoryDeadlineQueue::cancel(int8_t timer) {
+  if (!armed(timer)) {
+    return false;
+  }
+  removeAt(static_cast<uint8_t>(slot_[static_cast<uint8_t>(timer)] - 1U));
+  return true;
+}
+
+bool StoryDeadlineQueue::armed(int8_t timer) const {
+  return validTimer(timer) && slot_[static_cast<uint8_t>(timer)] != 0U;
+}
+
+bool StoryDeadlineQueue::isDue(int8_t timer, uint32_t nowMs) const {
+  return armed(timer) && static_cast<int32_t>(nowMs - due_[static_cast<uint8_t>(timer)]) >= 0;
+}
+
+bool StoryDeadlineQueue::dueAtMs(int8_t timer, uint32_t* outDueAtMs) const {
+  if (!armed(timer)) {
+    return false;
+  }
+  if (outDueAtMs != nullptr) {
+    *outDueAtMs = due_[static_cast<uint8_t>(timer)];
+  }
+  return true;
+}
+
+bool StoryDeadlineQueue::nextDueAtMs(uint32_t* outDueAtMs) const {
+  if (size_ == 0U) {
+    return false;
+  }
+  if (outDueAtMs != nullptr) {
+    *outDueAtMs = due_[heap_[0]];
+  }
+  return true;
+}
+
+int8_t StoryDeadlineQueue::popDue(uint32_t nowMs) {
+  if (size_ == 0U || static_cast<int32_t>(nowMs - due_[heap_[0]]) < 0) {
+    return kInvalidTimer;
+  }
+  const uint8_t timer = heap_[0];
+  removeAt(0U);
+  return static_cast<int8_t>(timer);
+}
+
+uint32_t StoryDeadlineQueue::msUntilNext(uint32_t nowMs, uint32_t maxWaitMs) const {
+  if (size_ == 0U) {
+    return maxWaitMs;
+  }
+  const int32_t left = static_cast<int32_t>(due_[heap_[0]] - nowMs);
+  if (left <= 0) {
+    return 0U;
+  }
+  return (static_cast<uint32_t>(left) < maxWaitMs) ? static_cast<uint32_t>(left) : maxWaitMs;
+}
+
+uint8_t StoryDeadlineQueue::armedCount() const {
+  return size_;
+}
+
+const char* StoryDeadlineQueue::tag(int8_t timer) const {
+  return validTimer(timer) ? tags_[static_cast<uint8_t>(timer)] : nullptr;
+}
+
+bool StoryDeadlineQueue::validTimer(int8_t timer) const {
+  return timer >= 0 && static_cast<uint8_t>(timer) < acquired_;
+}
+
+bool StoryDeadlineQueue::before(uint8_t lhsTimer, uint8_t rhsTimer) const {
+  return static_cast<int32_t>(due_[lhsTimer] - due_[rhsTimer]) < 0;
+}
+
+void StoryDeadlineQueue::place(uint8_t pos, uint8_t timer) {
+  heap_[pos] = timer;
+  slot_[timer] = static_cast<uint8_t>(pos + 1U);
+}
+
+void StoryDeadlineQueue::siftUp(uint8_t pos) {
+  const uint8_t timer = heap_[pos];
+  while (pos > 0U) {
+    const uint8_t parent = static_cast<uint8_t>((pos - 1U) / 2U);
+    if (!before(timer, heap_[parent])) {
+      break;
+    }
+    place(pos, heap_[parent]);
+    pos = parent;
+  }
+  place(pos, timer);
+}
+
+void StoryDeadlineQueue::siftDown(uint8_t pos) {
+  const uint8_t timer = heap_[pos];
+  while (true) {
+    const uint8_t left = static_cast<uint8_t>(pos * 2U + 1U);
+    if (left >= size_) {
+      break;
+    }
+    const uint8_t right = static_cast<uint8_t>(left + 1U);
+    const uint8_t child = (right < size_ && before(heap_[right], heap_[left])) ? right : left;
+    if (!before(heap_[child], timer)) {
+      break;
+    }
+    place(pos, heap_[child]);
+    pos = child;
+  }
+  place(pos, timer);
+}
+
+void StoryDeadlineQueue::removeAt(uint8_t pos) {
+  const uint8_t timer = heap_[pos];
+  slot_[timer] = 0U;
+  --size_;
+  if (pos == size_) {
+    return;
+  }
+  const uint8_t moved = heap_[size_];
+  place(pos, moved);
+  siftUp(pos);
+  siftDown(static_cast<uint8_t>(slot_[moved] - 1U));
+}
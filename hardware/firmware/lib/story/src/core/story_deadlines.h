@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Shared deadline scheduler (binary min-heap over a fixed pool of timers).
+// Owners acquire a timer handle once, then arm/cancel it. "Is it due" and
+// "when is the next deadline" are O(1); arm/cancel/popDue are O(log n).
+// Deadlines are ordered with wrap-safe signed deltas, so armed deadlines must
+// stay within ~24 days of each other.
+class StoryDeadlineQueue {
+ public:
+  static constexpr uint8_t kCapacity = 16U;
+  static constexpr int8_t kInvalidTimer = -1;
+
+  // Disarms every timer; handles stay valid.
+  void clear();
+  // Returns kInvalidTimer when the pool is exhausted. tag is kept by pointer.
+  int8_t acquire(const char* tag);
+
+  // Re-arming moves an armed timer to its new deadline.
+  bool arm(int8_t timer, uint32_t dueAtMs);
+  bool cancel(int8_t timer);
+  bool armed(int8_t timer) const;
+  bool isDue(int8_t timer, uint32_t nowMs) const;
+  bool dueAtMs(int8_t timer, uint32_t* outDueAtMs) const;
+
+  bool nextDueAtMs(uint32_t* outDueAtMs) const;
+  // Earliest due timer (disarmed on return), or kInvalidTimer.
+  int8_t popDue(uint32_t nowMs);
+  // Time until the next deadline, capped at maxWaitMs (0 when one is due).
+  uint32_t msUntilNext(uint32_t nowMs, uint32_t maxWaitMs) const;
+
+  uint8_t armedCount() const;
+  const char* tag(int8_t timer) const;
+
+ private:
+  bool validTimer(int8_t timer) const;
+  bool before(uint8_t lhsTimer, uint8_t rhsTimer) const;
+  void place(uint8_t pos, uint8_t timer);
+  void siftUp(uint8_t pos);
+  void siftDown(uint8_t pos);
+  void removeAt(uint8_t pos);
+
+  uint32_t due_[kCapacity] = {};
+  const char* tags_[kCapacity] = {};
+  // Heap position + 1 per timer; 0 while disarmed.
+  uint8_t slot_[kCapacity] = {};
+  uint8_t heap_[kCapacity] = {};
+  uint8_t size_ = 0U;
+  uint8_t acquired_ = 0U;
+};
@@ -5,8 +5,6 @@
 
 namespace {
 
-constexpr uint8_t kEventProcessBudgetPerUpdate = 6U;
-
 bool sameText(const char* lhs, const char* rhs) {
   if (lhs == nullptr || rhs == nullptr) {
     return false;
@@ -14,24 +12,12 @@ bool sameText(const char* lhs, const char* rhs) {
   return strcmp(lhs, rhs) == 0;
 }
 
-bool eventNameMatch(StoryEventType transitionEventType,
-                    const char* transitionEventName,
-                    const char* eventName) {
-  if (transitionEventName == nullptr || transitionEventName[0] == '\0') {
-    return true;
-  }
-  if (eventName == nullptr || eventName[0] == '\0') {
-    return false;
-  }
-  if (transitionEventType == StoryEventType::kButton &&
-      strcmp(transitionEventName, "ANY") == 0) {
-    return true;
-  }
-  return strcmp(transitionEventName, eventName) == 0;
-}
-
 }  // namespace
 
+StoryEngineV2::StoryEngineV2() {
+  stepTimer_ = deadlines_.acquire("story_step");
+}
+
 bool StoryEngineV2::loadScenario(const ScenarioDef& scenario) {
   StoryValidationError error;
   if (!storyValidateScenarioDef(scenario, &error)) {
@@ -41,18 +27,27 @@ bool StoryEngineV2::loadScenario(const ScenarioDef& scenario) {
                   error.detail != nullptr ? error.detail : "-");
     return false;
   }
+  if (!graph_.compile(scenario)) {
+    scenario_ = nullptr;
+    snprintf(lastError_, sizeof(lastError_), "%s", "SCENARIO_COMPILE_FAILED");
+    Serial.printf("[STORY_V2] loadScenario failed code=SCENARIO_COMPILE_FAILED id=%s\n", scenario.id);
+    return false;
+  }
 
   scenario_ = &scenario;
   queue_.clear();
+  deadlines_.cancel(stepTimer_);
   running_ = false;
   stepChanged_ = false;
   enteredAtMs_ = 0U;
   currentStepIndex_ = 0U;
   previousStepIndex_ = 0U;
   snprintf(lastError_, sizeof(lastError_), "%s", "OK");
-  Serial.printf("[STORY_V2] scenario loaded id=%s v=%u\n",
+  Serial.printf("[STORY_V2] scenario loaded id=%s v=%u steps=%u events=%u\n",
                 scenario.id,
-                static_cast<unsigned int>(scenario.version));
+                static_cast<unsigned int>(scenario.version),
+                static_cast<unsigned int>(scenario.stepCount),
+                static_cast<unsigned int>(graph_.eventNameCount()));
   return true;
 }
 
@@ -66,7 +61,7 @@ bool StoryEngineV2::start(const char* scenarioId, uint32_t nowMs) {
     return false;
   }
 
-  const int8_t idx = storyFindStepIndex(*scenario_, scenario_->initialStepId);
+  const int16_t idx = graph_.initialStepIndex();
   if (idx < 0) {
     snprintf(lastError_, sizeof(lastError_), "%s", "INITIAL_STEP_NOT_FOUND");
     return false;
@@ -78,6 +73,7 @@ bool StoryEngineV2::start(const char* scenarioId, uint32_t nowMs) {
   currentStepIndex_ = static_cast<uint8_t>(idx);
   enteredAtMs_ = nowMs;
   stepChanged_ = true;
+  armStepTimer();
   snprintf(lastError_, sizeof(lastError_), "%s", "OK");
   Serial.printf("[STORY_V2] start scenario=%s step=%s\n",
                 scenario_->id,
@@ -91,6 +87,7 @@ void StoryEngineV2::stop(const char* reason) {
   }
   running_ = false;
   queue_.clear();
+  deadlines_.cancel(stepTimer_);
   stepChanged_ = false;
   Serial.printf("[STORY_V2] stop reason=%s\n", reason != nullptr ? reason : "-");
 }
@@ -99,14 +96,14 @@ bool StoryEngineV2::postEvent(const StoryEvent& event) {
   if (!running_) {
     return false;
   }
-  if (!queue_.push(event)) {
-    snprintf(lastError_, sizeof(lastError_), "%s", "EVENT_QUEUE_FULL");
-    Serial.printf("[STORY_V2] event drop type=%u name=%s\n",
-                  static_cast<unsigned int>(event.type),
-                  event.name);
-    return false;
-  }
-  return true;
+  // Names are interned against the compiled scenario; names no transition
+  // uses share kEventUnknown, which only wildcard edges can match.
+  StoryQueuedEvent queued;
+  queued.type = event.type;
+  queued.nameId = graph_.eventId(event.name);
+  queued.value = event.value;
+  queued.atMs = event.atMs;
+  return queue_.push(queued) != StoryEventQueue::PushResult::kDropped;
 }
 
 void StoryEngineV2::update(uint32_t nowMs) {
@@ -114,18 +111,27 @@ void StoryEngineV2::update(uint32_t nowMs) {
     return;
   }
 
-  StoryEvent event;
+  reportQueueDrops();
+  const uint8_t depth = queue_.size();
+  if (depth > stats_.peakQueueDepth) {
+    stats_.peakQueueDepth = depth;
+  }
+
+  StoryQueuedEvent event;
   uint8_t processed = 0U;
   while (processed < kEventProcessBudgetPerUpdate && queue_.pop(&event)) {
     ++processed;
-    const int8_t transitionIndex = selectEventTransition(event);
+    ++stats_.processedEvents;
+    const int16_t transitionIndex = selectEventTransition(event);
     if (transitionIndex < 0) {
+      ++stats_.unmatchedEvents;
       continue;
     }
 
     const StepDef& step = scenario_->steps[currentStepIndex_];
     const TransitionDef& transition = step.transitions[transitionIndex];
-    const int8_t targetStepIndex = storyFindStepIndex(*scenario_, transition.targetStepId);
+    const int16_t targetStepIndex =
+        graph_.targetStepIndex(currentStepIndex_, static_cast<uint8_t>(transitionIndex));
     if (targetStepIndex < 0) {
       snprintf(lastError_, sizeof(lastError_), "%s", "TARGET_STEP_NOT_FOUND");
       continue;
@@ -135,18 +141,24 @@ void StoryEngineV2::update(uint32_t nowMs) {
   }
 
   if (processed >= kEventProcessBudgetPerUpdate && queue_.size() > 0U) {
+    ++stats_.budgetStalls;
     snprintf(lastError_, sizeof(lastError_), "%s", "EVENT_BUDGET");
     return;
   }
 
-  const int8_t implicitIndex = selectImplicitTransition(nowMs);
+  // Implicit transitions are only scanned once the step timer is due.
+  if (!deadlines_.isDue(stepTimer_, nowMs)) {
+    return;
+  }
+  const int16_t implicitIndex = selectImplicitTransition(nowMs);
   if (implicitIndex < 0) {
     return;
   }
 
   const StepDef& step = scenario_->steps[currentStepIndex_];
   const TransitionDef& transition = step.transitions[implicitIndex];
-  const int8_t targetStepIndex = storyFindStepIndex(*scenario_, transition.targetStepId);
+  const int16_t targetStepIndex =
+      graph_.targetStepIndex(currentStepIndex_, static_cast<uint8_t>(implicitIndex));
   if (targetStepIndex < 0) {
     snprintf(lastError_, sizeof(lastError_), "%s", "TARGET_STEP_NOT_FOUND");
     return;
@@ -158,7 +170,7 @@ bool StoryEngineV2::jumpToStep(const char* stepId, const char* reason, uint32_t
   if (!running_ || scenario_ == nullptr) {
     return false;
   }
-  const int8_t targetStepIndex = storyFindStepIndex(*scenario_, stepId);
+  const int16_t targetStepIndex = graph_.stepIndex(stepId);
   if (targetStepIndex < 0) {
     snprintf(lastError_, sizeof(lastError_), "%s", "STEP_NOT_FOUND");
     return false;
@@ -215,6 +227,57 @@ uint32_t StoryEngineV2::droppedEvents() const {
   return queue_.droppedCount();
 }
 
+uint32_t StoryEngineV2::droppedEvents(StoryEventType type) const {
+  return queue_.droppedCount(type);
+}
+
+StoryEngineStats StoryEngineV2::stats() const {
+  // Producer-side counters live in the queue (atomics), the rest in stats_.
+  StoryEngineStats out = stats_;
+  out.postedEvents = queue_.pushedCount();
+  out.queueFullDrops = queue_.droppedCount();
+  out.coalescedEvents = queue_.coalescedCount();
+  return out;
+}
+
+void StoryEngineV2::resetStats() {
+  stats_ = StoryEngineStats();
+  queue_.resetCounters();
+  reportedDrops_ = 0U;
+}
+
+void StoryEngineV2::reportQueueDrops() {
+  // Drops are counted by producers; log them here, off the producer path.
+  const uint32_t dropped = queue_.droppedCount();
+  if (dropped == reportedDrops_) {
+    return;
+  }
+  snprintf(lastError_, sizeof(lastError_), "%s", "EVENT_QUEUE_FULL");
+  Serial.printf("[STORY_V2] event drop count=%lu unlock=%lu audio=%lu timer=%lu serial=%lu button=%lu espnow=%lu action=%lu voice=%lu\n",
+                static_cast<unsigned long>(dropped - reportedDrops_),
+                static_cast<unsigned long>(queue_.droppedCount(StoryEventType::kUnlock)),
+                static_cast<unsigned long>(queue_.droppedCount(StoryEventType::kAudioDone)),
+                static_cast<unsigned long>(queue_.droppedCount(StoryEventType::kTimer)),
+                static_cast<unsigned long>(queue_.droppedCount(StoryEventType::kSerial)),
+                static_cast<unsigned long>(queue_.droppedCount(StoryEventType::kButton)),
+                static_cast<unsigned long>(queue_.droppedCount(StoryEventType::kEspNow)),
+                static_cast<unsigned long>(queue_.droppedCount(StoryEventType::kAction)),
+                static_cast<unsigned long>(queue_.droppedCount(StoryEventType::kVoice)));
+  reportedDrops_ = dropped;
+}
+
+StoryDeadlineQueue& StoryEngineV2::deadlines() {
+  return deadlines_;
+}
+
+const StoryDeadlineQueue& StoryEngineV2::deadlines() const {
+  return deadlines_;
+}
+
+bool StoryEngineV2::nextDueAtMs(uint32_t* outDueAtMs) const {
+  return deadlines_.nextDueAtMs(outDueAtMs);
+}
+
 bool StoryEngineV2::transitionTo(uint8_t nextStepIndex, uint32_t nowMs, const char* reason) {
   if (scenario_ == nullptr || nextStepIndex >= scenario_->stepCount) {
     return false;
@@ -223,6 +286,8 @@ bool StoryEngineV2::transitionTo(uint8_t nextStepIndex, uint32_t nowMs, const ch
   currentStepIndex_ = nextStepIndex;
   enteredAtMs_ = nowMs;
   stepChanged_ = true;
+  armStepTimer();
+  ++stats_.transitions;
   if (reason != nullptr && reason[0] != '\0') {
     snprintf(lastTransitionId_, sizeof(lastTransitionId_), "%s", reason);
   } else {
@@ -235,75 +300,66 @@ bool StoryEngineV2::transitionTo(uint8_t nextStepIndex, uint32_t nowMs, const ch
   return true;
 }
 
-int8_t StoryEngineV2::selectEventTransition(const StoryEvent& event) const {
+int16_t StoryEngineV2::selectEventTransition(const StoryQueuedEvent& event) const {
   if (scenario_ == nullptr || !running_) {
     return -1;
   }
 
-  const StepDef& step = scenario_->steps[currentStepIndex_];
-  int8_t selected = -1;
-  uint8_t selectedPriority = 0U;
-  for (uint8_t i = 0U; i < step.transitionCount; ++i) {
-    const TransitionDef& transition = step.transitions[i];
-    if (transition.trigger != StoryTransitionTrigger::kOnEvent) {
-      continue;
-    }
-    if (transition.eventType != event.type) {
-      continue;
-    }
-    if (!eventNameMatch(transition.eventType, transition.eventName, event.name)) {
-      continue;
-    }
-    if (selected < 0 || transition.priority > selectedPriority) {
-      selected = static_cast<int8_t>(i);
-      selectedPriority = transition.priority;
-    }
+  // Name was interned at post time: integer lookups in the compiled graph only.
+  uint8_t selected = 0U;
+  if (graph_.selectEvent(currentStepIndex_, event.type, event.nameId, &selected, 1U) == 0U) {
+    return -1;
   }
-  return selected;
+  return static_cast<int16_t>(selected);
 }
 
-int8_t StoryEngineV2::selectImplicitTransition(uint32_t nowMs) const {
+int16_t StoryEngineV2::selectImplicitTransition(uint32_t nowMs) const {
   if (scenario_ == nullptr || !running_) {
     return -1;
   }
 
+  // Ranked by priority at compile time: the first one that fires wins.
   const StepDef& step = scenario_->steps[currentStepIndex_];
-  int8_t selected = -1;
-  uint8_t selectedPriority = 0U;
-  for (uint8_t i = 0U; i < step.transitionCount; ++i) {
+  const uint8_t count = graph_.implicitCount(currentStepIndex_);
+  for (uint8_t rank = 0U; rank < count; ++rank) {
+    const uint8_t i = graph_.implicitTransition(currentStepIndex_, rank);
     const TransitionDef& transition = step.transitions[i];
-    bool matched = false;
-    if (transition.trigger == StoryTransitionTrigger::kImmediate) {
-      matched = true;
-    } else if (transition.trigger == StoryTransitionTrigger::kAfterMs) {
-      matched = static_cast<uint32_t>(nowMs - enteredAtMs_) >= transition.afterMs;
-    }
-    if (!matched) {
-      continue;
-    }
-    if (selected < 0 || transition.priority > selectedPriority) {
-      selected = static_cast<int8_t>(i);
-      selectedPriority = transition.priority;
+    if (transition.trigger == StoryTransitionTrigger::kImmediate ||
+        static_cast<uint32_t>(nowMs - enteredAtMs_) >= transition.afterMs) {
+      return static_cast<int16_t>(i);
     }
   }
-  return selected;
+  return -1;
 }
 
 uint32_t StoryEngineV2::computeNextDueAtMs(uint32_t nowMs) const {
   if (scenario_ == nullptr || !running_) {
     return 0U;
   }
+  uint32_t afterMs = 0U;
+  if (!graph_.minAfterMs(currentStepIndex_, &afterMs)) {
+    return 0U;
+  }
+  return nowMs + afterMs;
+}
+
+void StoryEngineV2::armStepTimer() {
+  // Earliest implicit deadline of the step: enteredAt for immediate, else
+  // enteredAt + smallest afterMs. No implicit transition -> timer stays off.
+  const uint8_t count = graph_.implicitCount(currentStepIndex_);
+  if (count == 0U) {
+    deadlines_.cancel(stepTimer_);
+    return;
+  }
   const StepDef& step = scenario_->steps[currentStepIndex_];
-  uint32_t dueAtMs = 0U;
-  for (uint8_t i = 0U; i < step.transitionCount; ++i) {
-    const TransitionDef& transition = step.transitions[i];
-    if (transition.trigger != StoryTransitionTrigger::kAfterMs) {
-      continue;
-    }
-    const uint32_t candidate = nowMs + transition.afterMs;
-    if (dueAtMs == 0U || candidate < dueAtMs) {
-      dueAtMs = candidate;
+  uint32_t firstAfterMs = UINT32_MAX;
+  for (uint8_t rank = 0U; rank < count; ++rank) {
+    const TransitionDef& transition = step.transitions[graph_.implicitTransition(currentStepIndex_, rank)];
+    const uint32_t afterMs =
+        (transition.trigger == StoryTransitionTrigger::kImmediate) ? 0U : transition.afterMs;
+    if (afterMs < firstAfterMs) {
+      firstAfterMs = afterMs;
     }
   }
-  return dueAtMs;
+  deadlines_.arm(stepTimer_, enteredAtMs_ + firstAfterMs);
 }
@@ -3,15 +3,38 @@
 #include <Arduino.h>
 
 #include "scenario_def.h"
+#include "scenario_graph.h"
+#include "story_deadlines.h"
 #include "story_events.h"
 
+#ifndef STORY_V2_EVENT_BUDGET_PER_UPDATE
+#define STORY_V2_EVENT_BUDGET_PER_UPDATE 6
+#endif
+
+struct StoryEngineStats {
+  uint32_t postedEvents = 0U;
+  uint32_t queueFullDrops = 0U;
+  uint32_t coalescedEvents = 0U;
+  uint32_t processedEvents = 0U;
+  uint32_t unmatchedEvents = 0U;
+  uint32_t budgetStalls = 0U;
+  uint32_t transitions = 0U;
+  uint8_t peakQueueDepth = 0U;
+};
+
 class StoryEngineV2 {
  public:
+  static constexpr uint8_t kEventProcessBudgetPerUpdate = STORY_V2_EVENT_BUDGET_PER_UPDATE;
+
+  StoryEngineV2();
+
   bool loadScenario(const ScenarioDef& scenario);
   bool start(const char* scenarioId, uint32_t nowMs);
   void stop(const char* reason);
 
   void update(uint32_t nowMs);
+  // Lock-free: safe from other tasks (ESP-NOW receive callback) while the
+  // loop task runs update().
   bool postEvent(const StoryEvent& event);
   bool jumpToStep(const char* stepId, const char* reason, uint32_t nowMs);
 
@@ -23,15 +46,29 @@ class StoryEngineV2 {
   const char* lastTransitionId() const;
   const char* lastError() const;
   uint32_t droppedEvents() const;
+  uint32_t droppedEvents(StoryEventType type) const;
+  StoryEngineStats stats() const;
+  void resetStats();
+
+  // Step timer lives here; callers may acquire extra timers (etape2, ...) so a
+  // loop can ask one queue for the next deadline.
+  StoryDeadlineQueue& deadlines();
+  const StoryDeadlineQueue& deadlines() const;
+  bool nextDueAtMs(uint32_t* outDueAtMs) const;
 
  private:
   bool transitionTo(uint8_t nextStepIndex, uint32_t nowMs, const char* reason);
-  int8_t selectEventTransition(const StoryEvent& event) const;
-  int8_t selectImplicitTransition(uint32_t nowMs) const;
+  int16_t selectEventTransition(const StoryQueuedEvent& event) const;
+  void reportQueueDrops();
+  int16_t selectImplicitTransition(uint32_t nowMs) const;
   uint32_t computeNextDueAtMs(uint32_t nowMs) const;
+  void armStepTimer();
 
   const ScenarioDef* scenario_ = nullptr;
+  StoryScenarioGraph graph_;
   StoryEventQueue queue_;
+  StoryDeadlineQueue deadlines_;
+  int8_t stepTimer_ = StoryDeadlineQueue::kInvalidTimer;
   uint8_t currentStepIndex_ = 0U;
   uint8_t previousStepIndex_ = 0U;
   bool running_ = false;
@@ -39,4 +76,6 @@ class StoryEngineV2 {
   uint32_t enteredAtMs_ = 0U;
   char lastError_[32] = "OK";
   char lastTransitionId_[32] = "";
+  StoryEngineStats stats_;
+  uint32_t reportedDrops_ = 0U;
 };
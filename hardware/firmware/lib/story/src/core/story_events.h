@@ -2,52 +2,214 @@
 
 #include <Arduino.h>
 
+#include <atomic>
+
+#include "mpsc_ring.h"
 #include "scenario_def.h"
 
+// Slots per StoryEventType lane; must be a power of two.
+#ifndef STORY_V2_EVENT_LANE_CAPACITY
+#define STORY_V2_EVENT_LANE_CAPACITY 4
+#endif
+
+// An event with the same type + name as the last one queued on its lane
+// within the window is counted as coalesced and not queued again. 0 disables
+// coalescing for that type.
+#ifndef STORY_V2_EVENT_COALESCE_BUTTON_MS
+#define STORY_V2_EVENT_COALESCE_BUTTON_MS 40
+#endif
+#ifndef STORY_V2_EVENT_COALESCE_ESPNOW_MS
+#define STORY_V2_EVENT_COALESCE_ESPNOW_MS 100
+#endif
+#ifndef STORY_V2_EVENT_COALESCE_VOICE_MS
+#define STORY_V2_EVENT_COALESCE_VOICE_MS 250
+#endif
+
+// Queued form of a StoryEvent: the name is interned by the caller (see
+// StoryScenarioGraph::eventId), so entries stay 12 bytes.
+struct StoryQueuedEvent {
+  StoryEventType type = StoryEventType::kNone;
+  uint16_t nameId = 0U;
+  int32_t value = 0;
+  uint32_t atMs = 0U;
+};
+
+// One bounded lock-free MpscRing per StoryEventType, drained by priority
+// (unlock, audio done and timers first; button/voice/ESP-NOW chatter last).
+// push() may run from any task or ISR; pop()/clear() belong to the single
+// consumer (the engine update loop). clear() drains through pop(), so it is
+// safe while producers are still pushing.
 class StoryEventQueue {
  public:
-  static constexpr uint8_t kCapacity = 12U;
+  static constexpr uint8_t kLaneCount = static_cast<uint8_t>(StoryEventType::kVoice) + 1U;
+  static constexpr uint8_t kLaneCapacity = STORY_V2_EVENT_LANE_CAPACITY;
+  static constexpr uint8_t kCapacity = kLaneCount * kLaneCapacity;
+
+  static_assert(kLaneCapacity >= 2U && (kLaneCapacity & (kLaneCapacity - 1U)) == 0U,
+                "STORY_V2_EVENT_LANE_CAPACITY must be a power of two");
 
-  void clear() {
-    head_ = 0U;
-    tail_ = 0U;
-    size_ = 0U;
-    dropped_ = 0U;
+  enum class PushResult : uint8_t {
+    kQueued = 0,
+    kCoalesced,
+    kDropped,
+  };
+
+  StoryEventQueue() {
+    for (uint8_t type = 0U; type < kLaneCount; ++type) {
+      lanes_[type].coalesceWindowMs = defaultCoalesceWindowMs(static_cast<StoryEventType>(type));
+    }
+    resetCounters();
   }
 
-  bool push(const StoryEvent& event) {
-    if (size_ >= kCapacity) {
-      ++dropped_;
-      return false;
+  // Consumer side only. Cells are released through pop() rather than
+  // reset, so a producer racing with clear() either lands before the drain
+  // (discarded) or after it (kept); it never writes into a reset cell.
+  // Returns the number of discarded events.
+  uint32_t clear() {
+    uint32_t discarded = 0U;
+    StoryQueuedEvent event;
+    while (pop(&event)) {
+      ++discarded;
     }
-    data_[tail_] = event;
-    tail_ = static_cast<uint8_t>((tail_ + 1U) % kCapacity);
-    ++size_;
-    return true;
+    for (Lane& lane : lanes_) {
+      lane.lastName.store(0U, std::memory_order_relaxed);
+    }
+    return discarded;
   }
 
-  bool pop(StoryEvent* outEvent) {
-    if (size_ == 0U || outEvent == nullptr) {
+  void resetCounters() {
+    for (Lane& lane : lanes_) {
+      lane.ring.resetCounters();
+      lane.coalesced.store(0U, std::memory_order_relaxed);
+    }
+    pushed_.store(0U, std::memory_order_relaxed);
+  }
+
+  PushResult push(const StoryQueuedEvent& event) {
+    const uint8_t type = static_cast<uint8_t>(event.type);
+    if (type >= kLaneCount) {
+      return PushResult::kDropped;
+    }
+    Lane& lane = lanes_[type];
+    pushed_.fetch_add(1U, std::memory_order_relaxed);
+
+    // lastName holds name id | valid bit, lastAtMs the full timestamp of the
+    // last queued event. Concurrent producers may pair one's name with the
+    // other's time; that only decides whether a near-duplicate is kept.
+    const uint32_t nameKey = kLastNameValid | event.nameId;
+    if (lane.coalesceWindowMs > 0U && lane.lastName.load(std::memory_order_relaxed) == nameKey) {
+      const int32_t deltaMs =
+          static_cast<int32_t>(event.atMs - lane.lastAtMs.load(std::memory_order_relaxed));
+      if (deltaMs > -static_cast<int32_t>(lane.coalesceWindowMs) &&
+          deltaMs < static_cast<int32_t>(lane.coalesceWindowMs)) {
+        lane.coalesced.fetch_add(1U, std::memory_order_relaxed);
+        return PushResult::kCoalesced;
+      }
+    }
+
+    if (!lane.ring.push([&event](StoryQueuedEvent& slot) { slot = event; })) {
+      return PushResult::kDropped;
+    }
+    lane.lastAtMs.store(event.atMs, std::memory_order_relaxed);
+    lane.lastName.store(nameKey, std::memory_order_relaxed);
+    return PushResult::kQueued;
+  }
+
+  bool pop(StoryQueuedEvent* outEvent) {
+    if (outEvent == nullptr) {
       return false;
     }
-    *outEvent = data_[head_];
-    head_ = static_cast<uint8_t>((head_ + 1U) % kCapacity);
-    --size_;
-    return true;
+    for (uint8_t rank = 0U; rank < kLaneCount; ++rank) {
+      Lane& lane = lanes_[laneForRank(rank)];
+      if (lane.ring.ready(1U) == 0U) {
+        continue;
+      }
+      *outEvent = lane.ring.peek();
+      lane.ring.pop();
+      return true;
+    }
+    return false;
   }
 
   uint8_t size() const {
-    return size_;
+    uint32_t total = 0U;
+    for (const Lane& lane : lanes_) {
+      total += lane.ring.depth();
+    }
+    return static_cast<uint8_t>(total > kCapacity ? kCapacity : total);
+  }
+
+  // Not synchronized with push(): set it before producers start.
+  void setCoalesceWindowMs(StoryEventType type, uint16_t windowMs) {
+    const uint8_t lane = static_cast<uint8_t>(type);
+    if (lane < kLaneCount) {
+      lanes_[lane].coalesceWindowMs = windowMs;
+    }
+  }
+
+  uint32_t pushedCount() const {
+    return pushed_.load(std::memory_order_relaxed);
   }
 
   uint32_t droppedCount() const {
-    return dropped_;
+    uint32_t total = 0U;
+    for (const Lane& lane : lanes_) {
+      total += lane.ring.overflow();
+    }
+    return total;
+  }
+
+  uint32_t droppedCount(StoryEventType type) const {
+    const uint8_t lane = static_cast<uint8_t>(type);
+    return (lane < kLaneCount) ? lanes_[lane].ring.overflow() : 0U;
+  }
+
+  uint32_t coalescedCount() const {
+    uint32_t total = 0U;
+    for (const Lane& lane : lanes_) {
+      total += lane.coalesced.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  uint32_t coalescedCount(StoryEventType type) const {
+    const uint8_t lane = static_cast<uint8_t>(type);
+    return (lane < kLaneCount) ? lanes_[lane].coalesced.load(std::memory_order_relaxed) : 0U;
+  }
+
+  static uint16_t defaultCoalesceWindowMs(StoryEventType type) {
+    switch (type) {
+      case StoryEventType::kButton:
+        return STORY_V2_EVENT_COALESCE_BUTTON_MS;
+      case StoryEventType::kEspNow:
+        return STORY_V2_EVENT_COALESCE_ESPNOW_MS;
+      case StoryEventType::kVoice:
+        return STORY_V2_EVENT_COALESCE_VOICE_MS;
+      default:
+        return 0U;
+    }
   }
 
  private:
-  StoryEvent data_[kCapacity] = {};
-  uint8_t head_ = 0U;
-  uint8_t tail_ = 0U;
-  uint8_t size_ = 0U;
-  uint32_t dropped_ = 0U;
+  static constexpr uint32_t kLastNameValid = 0x10000U;
+
+  struct Lane {
+    MpscRing<StoryQueuedEvent, kLaneCapacity> ring;
+    std::atomic<uint32_t> lastName{0U};
+    std::atomic<uint32_t> lastAtMs{0U};
+    std::atomic<uint32_t> coalesced{0U};
+    uint16_t coalesceWindowMs = 0U;
+  };
+
+  static uint8_t laneForRank(uint8_t rank) {
+    static const StoryEventType kDrainOrder[kLaneCount] = {
+        StoryEventType::kUnlock, StoryEventType::kAudioDone, StoryEventType::kTimer,
+        StoryEventType::kAction, StoryEventType::kSerial,    StoryEventType::kButton,
+        StoryEventType::kVoice,  StoryEventType::kEspNow,    StoryEventType::kNone,
+    };
+    return static_cast<uint8_t>(kDrainOrder[rank]);
+  }
+
+  Lane lanes_[kLaneCount];
+  std::atomic<uint32_t> pushed_{0U};
 };
@@ -0,0 +1,462 @@
+#include "story_content_cache.h"
+
+#include <cstdlib>
+#include <cstring>
+
+struct StoryContentView::Detached {
+  uint32_t refs;
+  size_t len;
+  char data[1];
+};
+
+StoryContentView::StoryContentView(const StoryContentView& other)
+    : cache_(other.cache_), slot_(other.slot_), detached_(other.detached_) {
+  retain();
+}
+
+StoryContentView& StoryContentView::operator=(const StoryContentView& other) {
+  if (this != &other) {
+    StoryContentView copy(other);
+    release();
+    cache_ = copy.cache_;
+    slot_ = copy.slot_;
+    detached_ = copy.detached_;
+    retain();
+  }
+  return *this;
+}
+
+StoryContentView::~StoryContentView() {
+  release();
+}
+
+StoryContentView StoryContentView::detached(size_t len, StoryContentReadFn read, void* ctx) {
+  StoryContentView view;
+  Detached* block = static_cast<Detached*>(malloc(sizeof(Detached) + len));
+  if (block == nullptr) {
+    return view;
+  }
+  size_t filled = 0U;
+  while (filled < len) {
+    const size_t got = read(ctx, reinterpret_cast<uint8_t*>(block->data) + filled, len - filled);
+    if (got == 0U) {
+      free(block);
+      return view;
+    }
+    filled += got;
+  }
+  block->data[len] = '\0';
+  block->len = len;
+  block->refs = 1U;
+  view.detached_ = block;
+  return view;
+}
+
+StoryContentView StoryContentView::detached(const char* text, size_t len) {
+  StoryContentView view;
+  Detached* block = static_cast<Detached*>(malloc(sizeof(Detached) + len));
+  if (block == nullptr) {
+    return view;
+  }
+  memcpy(block->data, text, len);
+  block->data[len] = '\0';
+  block->len = len;
+  block->refs = 1U;
+  view.detached_ = block;
+  return view;
+}
+
+bool StoryContentView::empty() const {
+  return length() == 0U;
+}
+
+const char* StoryContentView::c_str() const {
+  if (detached_ != nullptr) {
+    return detached_->data;
+  }
+  if (cache_ != nullptr) {
+    return cache_->payloadOf(cache_->entries_[slot_]);
+  }
+  return "";
+}
+
+size_t StoryContentView::length() const {
+  if (detached_ != nullptr) {
+    return detached_->len;
+  }
+  if (cache_ != nullptr) {
+    return cache_->entries_[slot_].length;
+  }
+  return 0U;
+}
+
+const char* StoryContentView::aux() const {
+  return (cache_ != nullptr) ? cache_->auxOf(cache_->entries_[slot_]) : "";
+}
+
+bool StoryContentView::cached() const {
+  return cache_ != nullptr;
+}
+
+void StoryContentView::retain() {
+  if (detached_ != nullptr) {
+    ++detached_->refs;
+  } else if (cache_ != nullptr) {
+    cache_->retain(slot_);
+  }
+}
+
+void StoryContentView::release() {
+  if (detached_ != nullptr) {
+    if (--detached_->refs == 0U) {
+      free(detached_);
+    }
+  } else if (cache_ != nullptr) {
+    cache_->release(slot_);
+  }
+  cache_ = nullptr;
+  detached_ = nullptr;
+}
+
+uint32_t storyContentHash(StoryContentKind kind, const char* key) {
+  uint32_t hash = 2166136261UL;
+  hash = (hash ^ static_cast<uint8_t>(kind)) * 16777619UL;
+  for (; key != nullptr && *key != '\0'; ++key) {
+    hash = (hash ^ static_cast<uint8_t>(*key)) * 16777619UL;
+  }
+  return hash;
+}
+
+void StoryContentCache::begin(uint8_t* arena, size_t bytes) {
+  arena_ = arena;
+  const size_t chunks = (arena != nullptr) ? bytes / kChunkBytes : 0U;
+  chunkCount_ = static_cast<uint16_t>((chunks > kMaxChunks) ? kMaxChunks : chunks);
+  chunksUsed_ = 0U;
+  memset(chunkBits_, 0, sizeof(chunkBits_));
+  memset(entries_, 0, sizeof(entries_));
+  memset(buckets_, kNone, sizeof(buckets_));
+  for (KindStats& stats : stats_) {
+    stats = KindStats();
+  }
+  lruHead_ = kNone;
+  lruTail_ = kNone;
+}
+
+const char* StoryContentCache::keyOf(const Entry& entry) const {
+  return reinterpret_cast<const char*>(arena_ + static_cast<size_t>(entry.firstChunk) * kChunkBytes);
+}
+
+const char* StoryContentCache::auxOf(const Entry& entry) const {
+  return keyOf(entry) + entry.keyLen + 1U;
+}
+
+const char* StoryContentCache::payloadOf(const Entry& entry) const {
+  return auxOf(entry) + entry.auxLen + 1U;
+}
+
+uint8_t StoryContentCache::findSlot(StoryContentKind kind, const char* key, uint32_t hash) const {
+  for (uint8_t slot = buckets_[hash % kBuckets]; slot != kNone; slot = entries_[slot].bucketNext) {
+    const Entry& entry = entries_[slot];
+    if (entry.hash == hash && entry.kind == static_cast<uint8_t>(kind) && strcmp(keyOf(entry), key) == 0) {
+      return slot;
+    }
+  }
+  return kNone;
+}
+
+StoryContentView StoryContentCache::find(StoryContentKind kind, const char* key) {
+  KindStats& stats = stats_[static_cast<size_t>(kind)];
+  const uint8_t slot = (arena_ != nullptr && key != nullptr) ? findSlot(kind, key, storyContentHash(kind, key)) : kNone;
+  if (slot == kNone) {
+    ++stats.misses;
+    return StoryContentView();
+  }
+  ++stats.hits;
+  touch(slot);
+  return viewOf(slot);
+}
+
+StoryContentView StoryContentCache::insert(StoryContentKind kind,
+                                           const char* key,
+                                           const char* aux,
+                                           const char* data,
+                                           size_t len) {
+  char* payload = nullptr;
+  const uint8_t slot = allocate(kind, key, aux, len, &payload);
+  if (slot == kNone) {
+    return StoryContentView();
+  }
+  if (len > 0U) {
+    memcpy(payload, data, len);
+  }
+  payload[len] = '\0';
+  return viewOf(slot);
+}
+
+StoryContentView StoryContentCache::insertFrom(StoryContentKind kind,
+                                               const char* key,
+                                               const char* aux,
+                                               size_t len,
+                                               StoryContentReadFn read,
+                                               void* ctx) {
+  char* payload = nullptr;
+  const uint8_t slot = allocate(kind, key, aux, len, &payload);
+  if (slot == kNone) {
+    return StoryContentView();
+  }
+  size_t filled = 0U;
+  while (filled < len) {
+    const size_t got = read(ctx, reinterpret_cast<uint8_t*>(payload) + filled, len - filled);
+    if (got == 0U) {
+      unindex(slot);
+      freeSlot(slot);
+      return StoryContentView();
+    }
+    filled += got;
+  }
+  payload[len] = '\0';
+  return viewOf(slot);
+}
+
+uint8_t StoryContentCache::allocate(StoryContentKind kind,
+                                    const char* key,
+                                    const char* aux,
+                                    size_t len,
+                                    char** payload) {
+  if (arena_ == nullptr || key == nullptr) {
+    return kNone;
+  }
+  if (aux == nullptr) {
+    aux = "";
+  }
+  const size_t key_len = strlen(key);
+  const size_t aux_len = strlen(aux);
+  if (key_len == 0U || key_len >= kMaxKey || aux_len >= 0xFFFFU) {
+    return kNone;
+  }
+  const size_t total = key_len + 1U + aux_len + 1U + len + 1U;
+  const size_t chunks = (total + kChunkBytes - 1U) / kChunkBytes;
+  // One entry never takes more than half the arena, so a big file cannot
+  // flush every other kind out.
+  if (chunks > chunkCount_ / 2U) {
+    return kNone;
+  }
+
+  invalidate(kind, key);
+  uint8_t slot = kNone;
+  for (;;) {
+    for (uint8_t index = 0U; index < kMaxEntries; ++index) {
+      if (!entries_[index].used) {
+        slot = index;
+        break;
+      }
+    }
+    if (slot != kNone || !evictOne()) {
+      break;
+    }
+  }
+  if (slot == kNone) {
+    return kNone;
+  }
+  uint16_t first = 0U;
+  while (!reserveChunks(static_cast<uint16_t>(chunks), &first)) {
+    if (!evictOne()) {
+      return kNone;
+    }
+  }
+
+  Entry& entry = entries_[slot];
+  memset(&entry, 0, sizeof(entry));
+  entry.hash = storyContentHash(kind, key);
+  entry.firstChunk = first;
+  entry.chunkCount = static_cast<uint16_t>(chunks);
+  entry.length = static_cast<uint32_t>(len);
+  entry.keyLen = static_cast<uint16_t>(key_len);
+  entry.auxLen = static_cast<uint16_t>(aux_len);
+  entry.kind = static_cast<uint8_t>(kind);
+  entry.used = true;
+  entry.indexed = true;
+  char* base = reinterpret_cast<char*>(arena_ + static_cast<size_t>(first) * kChunkBytes);
+  memcpy(base, key, key_len + 1U);
+  memcpy(base + key_len + 1U, aux, aux_len + 1U);
+  *payload = base + key_len + 1U + aux_len + 1U;
+
+  const size_t bucket = entry.hash % kBuckets;
+  entry.bucketNext = buckets_[bucket];
+  buckets_[bucket] = slot;
+  entry.lruPrev = kNone;
+  entry.lruNext = lruHead_;
+  if (lruHead_ != kNone) {
+    entries_[lruHead_].lruPrev = slot;
+  }
+  lruHead_ = slot;
+  if (lruTail_ == kNone) {
+    lruTail_ = slot;
+  }
+  KindStats& stats = stats_[entry.kind];
+  ++stats.entries;
+  stats.bytes += entry.length;
+  return slot;
+}
+
+bool StoryContentCache::reserveChunks(uint16_t count, uint16_t* first) {
+  uint16_t run = 0U;
+  for (uint16_t chunk = 0U; chunk < chunkCount_; ++chunk) {
+    const bool used = (chunkBits_[chunk / 8U] & (1U << (chunk % 8U))) != 0U;
+    run = used ? 0U : static_cast<uint16_t>(run + 1U);
+    if (run == count) {
+      *first = static_cast<uint16_t>(chunk + 1U - count);
+      setChunks(*first, count, true);
+      chunksUsed_ = static_cast<uint16_t>(chunksUsed_ + count);
+      return true;
+    }
+  }
+  return false;
+}
+
+void StoryContentCache::setChunks(uint16_t first, uint16_t count, bool used) {
+  for (uint16_t chunk = first; chunk < first + count; ++chunk) {
+    if (used) {
+      chunkBits_[chunk / 8U] = static_cast<uint8_t>(chunkBits_[chunk / 8U] | (1U << (chunk % 8U)));
+    } else {
+      chunkBits_[chunk / 8U] = static_cast<uint8_t>(chunkBits_[chunk / 8U] & ~(1U << (chunk % 8U)));
+    }
+  }
+}
+
+bool StoryContentCache::evictOne() {
+  for (uint8_t slot = lruTail_; slot != kNone; slot = entries_[slot].lruPrev) {
+    if (entries_[slot].refs == 0U) {
+      ++stats_[entries_[slot].kind].evictions;
+      unindex(slot);
+      freeSlot(slot);
+      return true;
+    }
+  }
+  return false;
+}
+
+void StoryContentCache::lruUnlink(uint8_t slot) {
+  Entry& entry = entries_[slot];
+  if (entry.lruPrev != kNone) {
+    entries_[entry.lruPrev].lruNext = entry.lruNext;
+  } else {
+    lruHead_ = entry.lruNext;
+  }
+  if (entry.lruNext != kNone) {
+    entries_[entry.lruNext].lruPrev = entry.lruPrev;
+  } else {
+    lruTail_ = entry.lruPrev;
+  }
+  entry.lruPrev = kNone;
+  entry.lruNext = kNone;
+}
+
+void StoryContentCache::touch(uint8_t slot) {
+  if (lruHead_ == slot) {
+    return;
+  }
+  lruUnlink(slot);
+  Entry& entry = entries_[slot];
+  entry.lruNext = lruHead_;
+  if (lruHead_ != kNone) {
+    entries_[lruHead_].lruPrev = slot;
+  }
+  lruHead_ = slot;
+  if (lruTail_ == kNone) {
+    lruTail_ = slot;
+  }
+}
+
+void StoryContentCache::unindex(uint8_t slot) {
+  Entry& entry = entries_[slot];
+  if (!entry.indexed) {
+    return;
+  }
+  uint8_t* link = &buckets_[entry.hash % kBuckets];
+  while (*link != kNone && *link != slot) {
+    link = &entries_[*link].bucketNext;
+  }
+  if (*link == slot) {
+    *link = entry.bucketNext;
+  }
+  lruUnlink(slot);
+  entry.indexed = false;
+  --stats_[entry.kind].entries;
+}
+
+void StoryContentCache::freeSlot(uint8_t slot) {
+  Entry& entry = entries_[slot];
+  setChunks(entry.firstChunk, entry.chunkCount, false);
+  chunksUsed_ = static_cast<uint16_t>(chunksUsed_ - entry.chunkCount);
+  stats_[entry.kind].bytes -= entry.length;
+  entry.used = false;
+}
+
+void StoryContentCache::invalidate(StoryContentKind kind, const char* key) {
+  if (arena_ == nullptr || key == nullptr) {
+    return;
+  }
+  const uint8_t slot = findSlot(kind, key, storyContentHash(kind, key));
+  if (slot == kNone) {
+    return;
+  }
+  unindex(slot);
+  if (entries_[slot].refs == 0U) {
+    freeSlot(slot);
+  }
+}
+
+void StoryContentCache::clear() {
+  for (uint8_t slot = 0U; slot < kMaxEntries; ++slot) {
+    Entry& entry = entries_[slot];
+    if (!entry.used || !entry.indexed) {
+      continue;
+    }
+    unindex(slot);
+    if (entry.refs == 0U) {
+      freeSlot(slot);
+    }
+  }
+}
+
+StoryContentView StoryContentCache::viewOf(uint8_t slot) {
+  StoryContentView view;
+  view.cache_ = this;
+  view.slot_ = slot;
+  retain(slot);
+  return view;
+}
+
+void StoryContentCache::retain(uint8_t slot) {
+  ++entries_[slot].refs;
+}
+
+void StoryContentCache::release(uint8_t slot) {
+  Entry& entry = entries_[slot];
+  if (entry.refs > 0U && --entry.refs == 0U && !entry.indexed) {
+    freeSlot(slot);
+  }
+}
+
+StoryContentCache::KindStats StoryContentCache::stats(StoryContentKind kind) const {
+  return stats_[static_cast<size_t>(kind)];
+}
+
+uint32_t StoryContentCache::hitRatePermille(StoryContentKind kind) const {
+  const KindStats& stats = stats_[static_cast<size_t>(kind)];
+  const uint32_t lookups = stats.hits + stats.misses;
+  return (lookups == 0U) ? 0U : static_cast<uint32_t>((static_cast<uint64_t>(stats.hits) * 1000ULL) / lookups);
+}
+
+size_t StoryContentCache::bytesHeld() const {
+  return static_cast<size_t>(chunksUsed_) * kChunkBytes;
+}
+
+size_t StoryContentCache::capacity() const {
+  return static_cast<size_t>(chunkCount_) * kChunkBytes;
+}
+
+size_t StoryContentCache::maxContentBytes() const {
+  return static_cast<size_t>(chunkCount_ / 2U) * kChunkBytes;
+}
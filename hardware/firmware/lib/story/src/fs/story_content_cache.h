@@ -0,0 +1,144 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum class StoryContentKind : uint8_t {
+  kScene = 0,   // screen payload JSON by scene id
+  kAudioMap,    // audio pack id -> resolved asset path
+  kStoryJson,   // story file text by path
+  kCount,
+};
+
+typedef size_t (*StoryContentReadFn)(void* ctx, uint8_t* out, size_t capacity);
+
+class StoryContentCache;
+
+// Read-only, reference-counted view of cached content. Copying a view shares
+// the bytes; the entry cannot be evicted or reused while a view holds it. A
+// view is either backed by the cache or, for content that does not fit, by
+// its own heap block ("detached"). Text is always NUL-terminated.
+class StoryContentView {
+ public:
+  StoryContentView() = default;
+  StoryContentView(const StoryContentView& other);
+  StoryContentView& operator=(const StoryContentView& other);
+  ~StoryContentView();
+
+  // Heap-backed copy of `len` bytes filled by `read`; empty on short read.
+  static StoryContentView detached(size_t len, StoryContentReadFn read, void* ctx);
+  static StoryContentView detached(const char* text, size_t len);
+
+  bool empty() const;
+  const char* c_str() const;  // "" when empty
+  size_t length() const;
+  // Side string stored with the entry (the scene origin path), "" if none.
+  const char* aux() const;
+  bool cached() const;
+
+ private:
+  friend class StoryContentCache;
+  struct Detached;
+
+  void retain();
+  void release();
+
+  StoryContentCache* cache_ = nullptr;
+  uint8_t slot_ = 0U;
+  Detached* detached_ = nullptr;
+};
+
+// Fixed-memory content cache over one caller-owned block (PSRAM on the
+// Freenove). Content is stored in 256-byte chunks, each entry contiguous;
+// lookups go through a hash index and eviction is strict LRU among entries no
+// view holds. Single-threaded: the storage owner calls it from one task.
+class StoryContentCache {
+ public:
+  static constexpr size_t kMaxEntries = 48U;
+  static constexpr size_t kChunkBytes = 256U;
+  static constexpr size_t kMaxChunks = 512U;  // 128 KB of arena at most
+  static constexpr size_t kMaxKey = 64U;
+
+  struct KindStats {
+    uint32_t hits = 0U;
+    uint32_t misses = 0U;
+    uint32_t evictions = 0U;
+    uint32_t entries = 0U;
+    uint32_t bytes = 0U;  // payload bytes held, keys excluded
+  };
+
+  // Uses `arena` (not owned) for content; bytes past kMaxChunks are ignored.
+  void begin(uint8_t* arena, size_t bytes);
+
+  StoryContentView find(StoryContentKind kind, const char* key);
+  // Copies `len` bytes once into the arena, replacing an entry with the same
+  // key. Empty view when the content cannot fit even after eviction.
+  StoryContentView insert(StoryContentKind kind, const char* key, const char* aux, const char* data, size_t len);
+  // Same, streaming `len` bytes from `read` straight into the arena.
+  StoryContentView insertFrom(StoryContentKind kind,
+                              const char* key,
+                              const char* aux,
+                              size_t len,
+                              StoryContentReadFn read,
+                              void* ctx);
+  void invalidate(StoryContentKind kind, const char* key);
+  // Drops every entry; content still held by views is freed on last release.
+  void clear();
+
+  KindStats stats(StoryContentKind kind) const;
+  // Hits per thousand lookups for `kind`.
+  uint32_t hitRatePermille(StoryContentKind kind) const;
+  size_t bytesHeld() const;  // chunks in use, in bytes
+  size_t capacity() const;
+  // Largest content insert() accepts.
+  size_t maxContentBytes() const;
+
+ private:
+  friend class StoryContentView;
+  static constexpr uint8_t kNone = 0xFFU;
+  static constexpr size_t kBuckets = 64U;
+
+  struct Entry {
+    uint32_t hash;
+    uint16_t firstChunk;
+    uint16_t chunkCount;
+    uint32_t length;     // payload bytes
+    uint16_t keyLen;
+    uint16_t auxLen;
+    uint16_t refs;
+    uint8_t kind;
+    bool used;
+    bool indexed;        // false once replaced/invalidated: freed on last release
+    uint8_t bucketNext;
+    uint8_t lruPrev;
+    uint8_t lruNext;
+  };
+
+  uint8_t findSlot(StoryContentKind kind, const char* key, uint32_t hash) const;
+  uint8_t allocate(StoryContentKind kind, const char* key, const char* aux, size_t len, char** payload);
+  bool reserveChunks(uint16_t count, uint16_t* first);
+  bool evictOne();
+  void unindex(uint8_t slot);
+  void freeSlot(uint8_t slot);
+  void touch(uint8_t slot);
+  void lruUnlink(uint8_t slot);
+  void setChunks(uint16_t first, uint16_t count, bool used);
+  StoryContentView viewOf(uint8_t slot);
+  const char* keyOf(const Entry& entry) const;
+  const char* auxOf(const Entry& entry) const;
+  const char* payloadOf(const Entry& entry) const;
+  void retain(uint8_t slot);
+  void release(uint8_t slot);
+
+  uint8_t* arena_ = nullptr;
+  uint16_t chunkCount_ = 0U;
+  uint16_t chunksUsed_ = 0U;
+  uint8_t chunkBits_[kMaxChunks / 8U] = {};
+  Entry entries_[kMaxEntries] = {};
+  uint8_t buckets_[kBuckets] = {};
+  uint8_t lruHead_ = kNone;  // most recent
+  uint8_t lruTail_ = kNone;
+  KindStats stats_[static_cast<size_t>(StoryContentKind::kCount)] = {};
+};
+
+uint32_t storyContentHash(StoryContentKind kind, const char* key);
@@ -11,6 +11,8 @@
 namespace {
 
 constexpr size_t kSha256HexLen = 64U;
+constexpr const char* kVerifyCacheName = ".verify_cache";
+constexpr const char* kIntegrityManifestName = "integrity.sha256";
 
 bool textEquals(const char* lhs, const char* rhs) {
 	if (lhs == nullptr || rhs == nullptr) {
@@ -19,48 +21,20 @@ bool textEquals(const char* lhs, const char* rhs) {
 	return strcmp(lhs, rhs) == 0;
 }
 
-StoryTransitionTrigger parseTrigger(const char* value) {
-	if (value == nullptr) {
-		return StoryTransitionTrigger::kOnEvent;
+uint32_t entityHash(const char* entityType, const char* entityId) {
+	uint32_t hash = 2166136261UL;
+	for (const char* p = entityType; *p != '\0'; ++p) {
+		hash = (hash ^ static_cast<uint8_t>(*p)) * 16777619UL;
 	}
-	if (strcmp(value, "after_ms") == 0) {
-		return StoryTransitionTrigger::kAfterMs;
+	hash = (hash ^ static_cast<uint8_t>('/')) * 16777619UL;
+	for (const char* p = entityId; *p != '\0'; ++p) {
+		hash = (hash ^ static_cast<uint8_t>(*p)) * 16777619UL;
 	}
-	if (strcmp(value, "immediate") == 0) {
-		return StoryTransitionTrigger::kImmediate;
-	}
-	return StoryTransitionTrigger::kOnEvent;
+	return hash;
 }
 
-StoryEventType parseEventType(const char* value) {
-	if (value == nullptr) {
-		return StoryEventType::kNone;
-	}
-	if (strcmp(value, "unlock") == 0) {
-		return StoryEventType::kUnlock;
-	}
-	if (strcmp(value, "audio_done") == 0) {
-		return StoryEventType::kAudioDone;
-	}
-	if (strcmp(value, "timer") == 0) {
-		return StoryEventType::kTimer;
-	}
-	if (strcmp(value, "serial") == 0) {
-		return StoryEventType::kSerial;
-	}
-	if (strcmp(value, "button") == 0) {
-		return StoryEventType::kButton;
-	}
-	if (strcmp(value, "espnow") == 0 || strcmp(value, "esp_now") == 0) {
-		return StoryEventType::kEspNow;
-	}
-	if (strcmp(value, "action") == 0) {
-		return StoryEventType::kAction;
-	}
-	if (strcmp(value, "voice") == 0 || strcmp(value, "voice_bridge") == 0) {
-		return StoryEventType::kVoice;
-	}
-	return StoryEventType::kNone;
+size_t readFileChunk(void* ctx, uint8_t* out, size_t capacity) {
+	return static_cast<fs::File*>(ctx)->read(out, capacity);
 }
 
 bool hexCharToNibble(char value, uint8_t* out) {
@@ -82,23 +56,7 @@ bool hexCharToNibble(char value, uint8_t* out) {
 	return false;
 }
 
-bool trimHexString(char* text) {
-	if (text == nullptr) {
-		return false;
-	}
-	size_t len = strlen(text);
-	while (len > 0U && (text[len - 1U] == '\n' || text[len - 1U] == '\r' || text[len - 1U] == ' ')) {
-		text[len - 1U] = '\0';
-		--len;
-	}
-	return len >= kSha256HexLen;
-}
-
-bool computeFileSha256(fs::File& file, char* outHex, size_t outLen) {
-	if (outHex == nullptr || outLen <= kSha256HexLen) {
-		return false;
-	}
-
+bool computeFileSha256(fs::File& file, uint8_t* digest, uint32_t* outBytes) {
 	mbedtls_sha256_context ctx;
 	mbedtls_sha256_init(&ctx);
 	if (mbedtls_sha256_starts_ret(&ctx, 0) != 0) {
@@ -107,6 +65,7 @@ bool computeFileSha256(fs::File& file, char* outHex, size_t outLen) {
 	}
 
 	uint8_t buffer[256];
+	uint32_t total = 0U;
 	while (file.available()) {
 		const size_t read = file.read(buffer, sizeof(buffer));
 		if (read == 0U) {
@@ -116,24 +75,27 @@ bool computeFileSha256(fs::File& file, char* outHex, size_t outLen) {
 			mbedtls_sha256_free(&ctx);
 			return false;
 		}
+		total += static_cast<uint32_t>(read);
 	}
 
-	uint8_t hash[32] = {};
-	if (mbedtls_sha256_finish_ret(&ctx, hash) != 0) {
+	if (mbedtls_sha256_finish_ret(&ctx, digest) != 0) {
 		mbedtls_sha256_free(&ctx);
 		return false;
 	}
 	mbedtls_sha256_free(&ctx);
-
-	static const char* kHex = "0123456789abcdef";
-	for (size_t i = 0; i < sizeof(hash); ++i) {
-		outHex[i * 2U] = kHex[(hash[i] >> 4U) & 0x0FU];
-		outHex[i * 2U + 1U] = kHex[hash[i] & 0x0FU];
+	if (outBytes != nullptr) {
+		*outBytes = total;
 	}
-	outHex[kSha256HexLen] = '\0';
 	return true;
 }
 
+StoryFileStamp fileStamp(fs::File& file) {
+	StoryFileStamp stamp;
+	stamp.size = static_cast<uint32_t>(file.size());
+	stamp.mtime = static_cast<uint32_t>(file.getLastWrite());
+	return stamp;
+}
+
 }  // namespace
 
 StoryFsManager::StoryFsManager(const char* story_root) {
@@ -158,6 +120,8 @@ bool StoryFsManager::init() {
 		Serial.println("[STORY_FS] story dirs missing.");
 		return false;
 	}
+	verifyStats_ = {};
+	loadVerifyState();
 
 	initialized_ = true;
 	return true;
@@ -165,24 +129,17 @@ bool StoryFsManager::init() {
 
 void StoryFsManager::cleanup() {
 	resetScenarioData();
-	if (steps_ != nullptr) {
-		free(steps_);
-		steps_ = nullptr;
-	}
-	if (stepRuntime_ != nullptr) {
-		free(stepRuntime_);
-		stepRuntime_ = nullptr;
+	if (initialized_) {
+		flushVerifyCache();
 	}
 	if (appConfigs_ != nullptr) {
 		free(appConfigs_);
 		appConfigs_ = nullptr;
 	}
-	if (stringPool_ != nullptr) {
-		free(stringPool_);
-		stringPool_ = nullptr;
-	}
-	stringCapacity_ = 0U;
-	stringOffset_ = 0U;
+	free(verifyCache_);
+	verifyCache_ = nullptr;
+	free(manifest_);
+	manifest_ = nullptr;
 	initialized_ = false;
 }
 
@@ -199,6 +156,7 @@ bool StoryFsManager::loadScenario(const char* scenario_id) {
 		return false;
 	}
 
+	const uint32_t startMs = millis();
 	char path[128] = {};
 	buildResourcePath("scenarios", scenario_id, ".json", path, sizeof(path));
 	if (!LittleFS.exists(path)) {
@@ -216,178 +174,163 @@ bool StoryFsManager::loadScenario(const char* scenario_id) {
 		return false;
 	}
 
-	DynamicJsonDocument doc(8192);
-	DeserializationError err = deserializeJson(doc, file);
+	// Parsed into a fresh arena: the current scenario stays valid until the
+	// new one has loaded and passed its resource checks.
+	StoryArena arena;
+	StoryScenarioImage image = {};
+	StoryScenarioLoadStats stats = {};
+	stats.fileBytes = static_cast<uint32_t>(file.size());
+	const bool parsed = parseScenarioFile(file, arena, &image, &stats);
 	file.close();
-	if (err) {
-		Serial.printf("[STORY_FS] parse error: %s\n", err.c_str());
+	if (!parsed) {
 		return false;
 	}
+	stats.parseMs = millis() - startMs;
 
-	resetScenarioData();
-	JsonObject root = doc.as<JsonObject>();
-	const char* id = root["id"] | "";
-	scenario_.id = storeString(id);
-	scenario_.version = static_cast<uint16_t>(root["version"] | 0);
-	scenario_.initialStepId = storeString(root["initial_step"] | "");
-
-	JsonArray steps = root["steps"].as<JsonArray>();
-	if (steps.isNull()) {
-		Serial.println("[STORY_FS] scenario missing steps array.");
-		return false;
-	}
-
-	JsonArray bindings = root["app_bindings"].as<JsonArray>();
-	if (!bindings.isNull()) {
-		for (JsonVariant bindingVal : bindings) {
-			const char* appId = bindingVal["id"] | "";
-			if (appId[0] != '\0') {
-				// Vérifie le checksum et charge le fichier app
-				if (!validateChecksum("apps", appId)) {
-					Serial.printf("[STORY_FS] app checksum mismatch: %s\n", appId);
-					return false;
-				}
-				if (!loadEntityJson("apps", appId)) {
-					Serial.printf("[STORY_FS] app file missing or invalid: %s\n", appId);
-					return false;
-				}
-			}
-		}
+	if (!validateScenarioResources(image)) {
+		return false;
 	}
 
-	for (JsonVariant stepVal : steps) {
-		if (stepCount_ >= static_cast<uint8_t>(kMaxSteps)) {
-			Serial.println("[STORY_FS] too many steps.");
+	resetScenarioData();
+	scenarioArena_.swap(arena);
+	scenarioImage_ = image;
+	stats.loadMs = millis() - startMs;
+	stats.arenaBytes = static_cast<uint32_t>(scenarioArena_.capacity());
+	stats.steps = image.scenario.stepCount;
+	stats.transitions = image.transitionCount;
+	lastLoadStats_ = stats;
+	flushVerifyCache();
+	Serial.printf("[STORY_FS] scenario loaded id=%s steps=%u transitions=%u arena=%u peak=%u file=%u ms=%lu\n",
+								image.scenario.id,
+								static_cast<unsigned int>(stats.steps),
+								static_cast<unsigned int>(stats.transitions),
+								static_cast<unsigned int>(stats.arenaBytes),
+								static_cast<unsigned int>(stats.peakHeapBytes),
+								static_cast<unsigned int>(stats.fileBytes),
+								static_cast<unsigned long>(stats.loadMs));
+	return true;
+}
+
+const StoryScenarioLoadStats& StoryFsManager::lastLoadStats() const {
+	return lastLoadStats_;
+}
+
+bool StoryFsManager::parseScenarioFile(fs::File& file,
+										StoryArena& out,
+										StoryScenarioImage* image,
+										StoryScenarioLoadStats* stats) {
+	StoryArena parseArena;
+	size_t arenaSize = storyScenarioArenaHint(static_cast<size_t>(file.size()));
+	StoryScenarioImage parsed = {};
+	for (uint8_t attempt = 0U; attempt < 2U; ++attempt) {
+		if (!parseArena.reserve(arenaSize)) {
+			Serial.printf("[STORY_FS] scenario arena alloc failed bytes=%u\n", static_cast<unsigned int>(arenaSize));
+			return false;
+		}
+		if (attempt > 0U && !file.seek(0)) {
+			Serial.println("[STORY_FS] scenario rewind failed.");
+			return false;
+		}
+		++stats->parseAttempts;
+		StoryJsonReader reader(readFileChunk, &file);
+		StoryScenarioParseError error = {};
+		if (storyParseScenario(reader, parseArena, &parsed, &error)) {
 			break;
 		}
-		JsonObject stepObj = stepVal.as<JsonObject>();
-		if (stepObj.isNull()) {
+		if (attempt == 0U && strcmp(error.code, "arena_full") == 0) {
+			arenaSize *= 2U;
 			continue;
 		}
+		Serial.printf("[STORY_FS] parse error: %s at byte %u\n", error.code, static_cast<unsigned int>(error.offset));
+		return false;
+	}
 
-			const char* screenId = stepObj["screen_scene_id"] | "";
-			const char* audioId = stepObj["audio_pack_id"] | "";
-			if (screenId[0] != '\0') {
-				const char* normalizedScreenId = storyNormalizeScreenSceneId(screenId);
-				if (normalizedScreenId == nullptr) {
-					Serial.printf("[STORY_FS] unknown screen_scene_id: %s\n", screenId);
-					return false;
-				}
-				if (std::strcmp(screenId, normalizedScreenId) != 0) {
-					Serial.printf("[STORY_FS] screen_scene_id normalized: %s -> %s\n", screenId, normalizedScreenId);
-				}
-				const char* candidateIds[2] = {normalizedScreenId, screenId};
-				const bool hasAliasCandidate = (std::strcmp(screenId, normalizedScreenId) != 0);
-				const uint8_t candidateCount = hasAliasCandidate ? 2U : 1U;
-				bool screenResolved = false;
-				for (uint8_t candidateIndex = 0U; candidateIndex < candidateCount; ++candidateIndex) {
-					const char* candidateId = candidateIds[candidateIndex];
-					if (!validateChecksum("screens", candidateId)) {
-						continue;
-					}
-					if (!loadEntityJson("screens", candidateId)) {
-						continue;
-					}
-					if (candidateIndex == 1U) {
-						Serial.printf("[STORY_FS] screen alias payload accepted for migration: %s\n", candidateId);
-					}
-					screenResolved = true;
-					break;
-				}
-				if (!screenResolved) {
-					Serial.printf("[STORY_FS] screen file/checksum invalid for id=%s normalized=%s\n", screenId, normalizedScreenId);
-					return false;
-				}
-			}
-		if (audioId[0] != '\0') {
-			if (!validateChecksum("audio", audioId)) {
-				Serial.printf("[STORY_FS] audio checksum mismatch: %s\n", audioId);
+	if (!storyCompactScenario(parsed, parseArena, out, image)) {
+		Serial.println("[STORY_FS] scenario arena alloc failed (compact).");
+		return false;
+	}
+	stats->peakHeapBytes = static_cast<uint32_t>(parseArena.capacity() + out.capacity());
+	return true;
+}
+
+bool StoryFsManager::validateEntity(const char* entityType, const char* entityId, ValidatedSet* seen) {
+	const uint32_t hash = entityHash(entityType, entityId);
+	for (uint8_t i = 0U; i < seen->count; ++i) {
+		if (seen->hashes[i] == hash) {
+			return true;
+		}
+	}
+	if (!validateChecksum(entityType, entityId) || !loadEntityJson(entityType, entityId)) {
+		return false;
+	}
+	if (seen->count < kValidatedCacheSize) {
+		seen->hashes[seen->count++] = hash;
+	}
+	return true;
+}
+
+bool StoryFsManager::validateScenarioResources(StoryScenarioImage& image) {
+	// Steps, actions and screens repeat across a scenario: each file is checked once.
+	ValidatedSet seen;
+	for (uint16_t i = 0U; i < image.appBindingCount; ++i) {
+		const char* appId = image.appBindingIds[i];
+		if (!validateEntity("apps", appId, &seen)) {
+			Serial.printf("[STORY_FS] app file/checksum invalid: %s\n", appId);
+			return false;
+		}
+	}
+
+	// The steps array belongs to the arena we just filled; screen ids are
+	// rewritten in place with their normalized (registry) spelling.
+	StepDef* steps = const_cast<StepDef*>(image.scenario.steps);
+	for (uint8_t stepIndex = 0U; stepIndex < image.scenario.stepCount; ++stepIndex) {
+		StepDef& step = steps[stepIndex];
+		const char* screenId = step.resources.screenSceneId;
+		if (screenId[0] != '\0') {
+			const char* normalizedScreenId = storyNormalizeScreenSceneId(screenId);
+			if (normalizedScreenId == nullptr) {
+				Serial.printf("[STORY_FS] unknown screen_scene_id: %s\n", screenId);
 				return false;
 			}
-			if (!loadEntityJson("audio", audioId)) {
-				Serial.printf("[STORY_FS] audio file missing or invalid: %s\n", audioId);
-				return false;
+			if (std::strcmp(screenId, normalizedScreenId) != 0) {
+				Serial.printf("[STORY_FS] screen_scene_id normalized: %s -> %s\n", screenId, normalizedScreenId);
 			}
-		}
-
-		StepRuntime& runtime = stepRuntime_[stepCount_];
-		StepDef& step = steps_[stepCount_];
-		const char* rawScreenId = stepObj["screen_scene_id"] | "";
-		const char* normalizedScreenId = storyNormalizeScreenSceneId(rawScreenId);
-		step.id = storeString(stepObj["step_id"] | "");
-		step.resources.screenSceneId = storeString((normalizedScreenId != nullptr) ? normalizedScreenId : rawScreenId);
-		step.resources.audioPackId = storeString(stepObj["audio_pack_id"] | "");
-
-		JsonArray actions = stepObj["actions"].as<JsonArray>();
-		uint8_t actionCount = 0U;
-		if (!actions.isNull()) {
-			for (JsonVariant actionVal : actions) {
-				if (actionCount >= static_cast<uint8_t>(sizeof(runtime.actionIds) / sizeof(runtime.actionIds[0]))) {
-					break;
+			const char* candidateIds[2] = {normalizedScreenId, screenId};
+			const bool hasAliasCandidate = (std::strcmp(screenId, normalizedScreenId) != 0);
+			const uint8_t candidateCount = hasAliasCandidate ? 2U : 1U;
+			bool screenResolved = false;
+			for (uint8_t candidateIndex = 0U; candidateIndex < candidateCount; ++candidateIndex) {
+				const char* candidateId = candidateIds[candidateIndex];
+				if (!validateEntity("screens", candidateId, &seen)) {
+					continue;
 				}
-				const char* actionId = actionVal.as<const char*>();
-				if (actionId != nullptr && actionId[0] != '\0') {
-					if (!validateChecksum("actions", actionId)) {
-						Serial.printf("[STORY_FS] action checksum mismatch: %s\n", actionId);
-						return false;
-					}
-					if (!loadEntityJson("actions", actionId)) {
-						Serial.printf("[STORY_FS] action file missing or invalid: %s\n", actionId);
-						return false;
-					}
+				if (candidateIndex == 1U) {
+					Serial.printf("[STORY_FS] screen alias payload accepted for migration: %s\n", candidateId);
 				}
-				runtime.actionIds[actionCount++] = storeString(actionId);
+				screenResolved = true;
+				break;
 			}
-		}
-		step.resources.actionIds = runtime.actionIds;
-		step.resources.actionCount = actionCount;
-
-		JsonArray apps = stepObj["apps"].as<JsonArray>();
-		uint8_t appCount = 0U;
-		if (!apps.isNull()) {
-			for (JsonVariant appVal : apps) {
-				if (appCount >= static_cast<uint8_t>(sizeof(runtime.appIds) / sizeof(runtime.appIds[0]))) {
-					break;
-				}
-				const char* appId = appVal.as<const char*>();
-				runtime.appIds[appCount++] = storeString(appId);
+			if (!screenResolved) {
+				Serial.printf("[STORY_FS] screen file/checksum invalid for id=%s normalized=%s\n", screenId, normalizedScreenId);
+				return false;
 			}
+			step.resources.screenSceneId = normalizedScreenId;
 		}
-		step.resources.appIds = runtime.appIds;
-		step.resources.appCount = appCount;
 
-		step.mp3GateOpen = static_cast<bool>(stepObj["mp3_gate_open"] | false);
+		const char* audioId = step.resources.audioPackId;
+		if (audioId[0] != '\0' && !validateEntity("audio", audioId, &seen)) {
+			Serial.printf("[STORY_FS] audio file/checksum invalid: %s\n", audioId);
+			return false;
+		}
 
-		JsonArray transitions = stepObj["transitions"].as<JsonArray>();
-		uint8_t transitionCount = 0U;
-		if (!transitions.isNull()) {
-			for (JsonVariant trVal : transitions) {
-				if (transitionCount >= static_cast<uint8_t>(sizeof(runtime.transitions) / sizeof(runtime.transitions[0]))) {
-					break;
-				}
-				JsonObject trObj = trVal.as<JsonObject>();
-				if (trObj.isNull()) {
-					continue;
-				}
-				TransitionDef& tr = runtime.transitions[transitionCount++];
-				tr.id = storeString(trObj["id"] | "");
-				tr.trigger = parseTrigger(trObj["trigger"] | "");
-				tr.eventType = parseEventType(trObj["event_type"] | "none");
-				tr.eventName = storeString(trObj["event_name"] | "");
-				tr.afterMs = static_cast<uint32_t>(trObj["after_ms"] | 0);
-				tr.targetStepId = storeString(trObj["target_step_id"] | "");
-				tr.priority = static_cast<uint8_t>(trObj["priority"] | 0);
+		for (uint8_t actionIndex = 0U; actionIndex < step.resources.actionCount; ++actionIndex) {
+			const char* actionId = step.resources.actionIds[actionIndex];
+			if (actionId[0] != '\0' && !validateEntity("actions", actionId, &seen)) {
+				Serial.printf("[STORY_FS] action file/checksum invalid: %s\n", actionId);
+				return false;
 			}
 		}
-		step.transitions = runtime.transitions;
-		step.transitionCount = transitionCount;
-
-		++stepCount_;
 	}
-
-	scenario_.steps = steps_;
-	scenario_.stepCount = stepCount_;
-	Serial.printf("[STORY_FS] scenario loaded id=%s steps=%u\n", scenario_.id, stepCount_);
 	return true;
 }
 
@@ -406,11 +349,12 @@ bool StoryFsManager::loadEntityJson(const char* entityType, const char* entityId
 		Serial.printf("[STORY_FS] %s open failed: %s\n", entityType, path);
 		return false;
 	}
-	DynamicJsonDocument doc(1024);
-	DeserializationError err = deserializeJson(doc, file);
+	// Only well-formedness matters here: stream through without a document.
+	StoryJsonReader reader(readFileChunk, &file);
+	const bool valid = reader.skipValue() && reader.atEnd();
 	file.close();
-	if (err) {
-		Serial.printf("[STORY_FS] %s parse error: %s\n", entityType, err.c_str());
+	if (!valid) {
+		Serial.printf("[STORY_FS] %s parse error: %s\n", entityType, reader.error());
 		return false;
 	}
 	return true;
@@ -484,11 +428,12 @@ const StepDef* StoryFsManager::getStep(const char* step_id) const {
 	if (step_id == nullptr || step_id[0] == '\0') {
 		return nullptr;
 	}
-	if (steps_ == nullptr) {
+	const ScenarioDef& scenario = scenarioImage_.scenario;
+	if (scenario.steps == nullptr) {
 		return nullptr;
 	}
-	for (uint8_t i = 0U; i < stepCount_; ++i) {
-		const StepDef& step = steps_[i];
+	for (uint8_t i = 0U; i < scenario.stepCount; ++i) {
+		const StepDef& step = scenario.steps[i];
 		if (step.id != nullptr && strcmp(step.id, step_id) == 0) {
 			return &step;
 		}
@@ -614,7 +559,8 @@ void StoryFsManager::listResources(const char* resource_type) {
 }
 
 const ScenarioDef* StoryFsManager::scenario() const {
-	return (scenario_.id != nullptr && scenario_.id[0] != '\0') ? &scenario_ : nullptr;
+	const ScenarioDef& scenario = scenarioImage_.scenario;
+	return (scenario.id != nullptr && scenario.id[0] != '\0') ? &scenario : nullptr;
 }
 
 bool StoryFsManager::loadJson(const char* path, DynamicJsonDocument& doc) {
@@ -638,44 +584,235 @@ bool StoryFsManager::verifyChecksum(const char* resource_path) {
 	if (resource_path == nullptr || resource_path[0] == '\0') {
 		return false;
 	}
-	char checksumPath[160] = {};
-	snprintf(checksumPath, sizeof(checksumPath), "%s.sha256", resource_path);
-	if (!LittleFS.exists(resource_path) || !LittleFS.exists(checksumPath)) {
+	uint8_t expected[StoryVerifyCache::kDigestBytes] = {};
+	const uint8_t* listed = (manifest_ != nullptr) ? manifest_->expected(resource_path) : nullptr;
+	if (listed != nullptr) {
+		memcpy(expected, listed, sizeof(expected));
+	} else if (!readSidecarDigest(resource_path, expected)) {
 		Serial.printf("[STORY_FS] checksum missing for %s\n", resource_path);
 		return false;
 	}
+	return verifyFile(resource_path, expected);
+}
 
-	fs::File dataFile = LittleFS.open(resource_path, "r");
-	if (!dataFile) {
-		return false;
-	}
-	char computed[kSha256HexLen + 1U] = {};
-	if (!computeFileSha256(dataFile, computed, sizeof(computed))) {
-		dataFile.close();
-		return false;
+bool StoryFsManager::readSidecarDigest(const char* resource_path, uint8_t* digest) {
+	// "<file>.sha256" as checked so far, then "<stem>.sha256" as the generator
+	// and the portable contract write it.
+	char checksumPath[160] = {};
+	snprintf(checksumPath, sizeof(checksumPath), "%s.sha256", resource_path);
+	if (!LittleFS.exists(checksumPath)) {
+		const char* dot = strrchr(resource_path, '.');
+		const char* slash = strrchr(resource_path, '/');
+		if (dot == nullptr || (slash != nullptr && dot < slash)) {
+			return false;
+		}
+		snprintf(checksumPath, sizeof(checksumPath), "%.*s.sha256", static_cast<int>(dot - resource_path), resource_path);
+		if (!LittleFS.exists(checksumPath)) {
+			return false;
+		}
 	}
-	dataFile.close();
 
 	fs::File checksumFile = LittleFS.open(checksumPath, "r");
 	if (!checksumFile) {
 		return false;
 	}
-	char expected[kSha256HexLen + 8U] = {};
-	size_t read = checksumFile.readBytes(expected, sizeof(expected) - 1U);
+	char text[kSha256HexLen + 8U] = {};
+	const size_t read = checksumFile.readBytes(text, sizeof(text) - 1U);
 	checksumFile.close();
-	expected[read] = '\0';
-	if (!trimHexString(expected)) {
+	text[read] = '\0';
+	return read >= kSha256HexLen && storyParseSha256Hex(text, digest);
+}
+
+bool StoryFsManager::verifyFile(const char* path, const uint8_t* expected) {
+	fs::File dataFile = LittleFS.open(path, "r");
+	if (!dataFile) {
+		Serial.printf("[STORY_FS] checksum missing for %s\n", path);
 		return false;
 	}
-	expected[kSha256HexLen] = '\0';
+	uint8_t computed[StoryVerifyCache::kDigestBytes] = {};
+	const StoryFileStamp stamp = fileStamp(dataFile);
+	++verifyStats_.files;
+	if (verifyCache_ != nullptr && verifyCache_->lookup(path, StoryDigestKind::kSha256, stamp, computed)) {
+		++verifyStats_.cached;
+	} else {
+		uint32_t bytes = 0U;
+		if (!computeFileSha256(dataFile, computed, &bytes)) {
+			dataFile.close();
+			++verifyStats_.failed;
+			return false;
+		}
+		++verifyStats_.hashed;
+		verifyStats_.hashedBytes += bytes;
+		if (verifyCache_ != nullptr) {
+			verifyCache_->store(path, StoryDigestKind::kSha256, stamp, computed);
+		}
+	}
+	dataFile.close();
 
-	if (strcmp(computed, expected) != 0) {
-		Serial.printf("[STORY_FS] checksum mismatch %s\n", resource_path);
+	if (memcmp(computed, expected, sizeof(computed)) != 0) {
+		++verifyStats_.failed;
+		Serial.printf("[STORY_FS] checksum mismatch %s\n", path);
 		return false;
 	}
 	return true;
 }
 
+bool StoryFsManager::verifyBundle(StoryVerifyStats* out) {
+	if (!initialized_ && !init()) {
+		return false;
+	}
+	char manifestPath[96] = {};
+	snprintf(manifestPath, sizeof(manifestPath), "%s/%s", storyRoot_, kIntegrityManifestName);
+	fs::File manifest = LittleFS.open(manifestPath, "r");
+	if (!manifest) {
+		Serial.printf("[STORY_FS] bundle manifest missing: %s\n", manifestPath);
+		return false;
+	}
+
+	const uint32_t startMs = millis();
+	const StoryVerifyStats before = verifyStats_;
+	char line[StoryManifest::kMaxLine] = {};
+	size_t lineLen = 0U;
+	bool lineOverflow = false;
+	bool ok = true;
+	auto checkLine = [&]() {
+		line[lineLen] = '\0';
+		uint8_t digest[StoryVerifyCache::kDigestBytes] = {};
+		const char* path = nullptr;
+		if (!lineOverflow && StoryManifest::parseLine(line, digest, &path)) {
+			char fullPath[StoryManifest::kMaxLine + 1U] = {};
+			snprintf(fullPath, sizeof(fullPath), "%s%s", (path[0] == '/') ? "" : "/", path);
+			ok = verifyFile(fullPath, digest) && ok;
+		} else if (path != nullptr || lineOverflow) {
+			Serial.printf("[STORY_FS] bundle manifest bad line: %s\n", line);
+			ok = false;
+		}
+		lineLen = 0U;
+		lineOverflow = false;
+	};
+
+	uint8_t buffer[128];
+	for (;;) {
+		const size_t read = manifest.read(buffer, sizeof(buffer));
+		if (read == 0U) {
+			break;
+		}
+		for (size_t i = 0U; i < read; ++i) {
+			if (buffer[i] == '\n') {
+				checkLine();
+			} else if (lineLen + 1U < sizeof(line)) {
+				line[lineLen++] = static_cast<char>(buffer[i]);
+			} else {
+				lineOverflow = true;
+			}
+		}
+	}
+	if (lineLen > 0U || lineOverflow) {
+		checkLine();
+	}
+	manifest.close();
+	flushVerifyCache();
+
+	StoryVerifyStats pass;
+	pass.files = verifyStats_.files - before.files;
+	pass.hashed = verifyStats_.hashed - before.hashed;
+	pass.cached = verifyStats_.cached - before.cached;
+	pass.failed = verifyStats_.failed - before.failed;
+	pass.hashedBytes = verifyStats_.hashedBytes - before.hashedBytes;
+	pass.elapsedMs = millis() - startMs;
+	if (out != nullptr) {
+		*out = pass;
+	}
+	Serial.printf("[STORY_FS] bundle verified ok=%u files=%lu hashed=%lu cached=%lu failed=%lu bytes=%lu ms=%lu\n",
+								ok ? 1U : 0U,
+								static_cast<unsigned long>(pass.files),
+								static_cast<unsigned long>(pass.hashed),
+								static_cast<unsigned long>(pass.cached),
+								static_cast<unsigned long>(pass.failed),
+								static_cast<unsigned long>(pass.hashedBytes),
+								static_cast<unsigned long>(pass.elapsedMs));
+	return ok && pass.failed == 0U;
+}
+
+const StoryVerifyStats& StoryFsManager::verifyStats() const {
+	return verifyStats_;
+}
+
+void StoryFsManager::loadVerifyState() {
+	if (verifyCache_ == nullptr || manifest_ == nullptr) {
+		return;
+	}
+	verifyCache_->clear();
+	manifest_->clear();
+	char path[96] = {};
+	snprintf(path, sizeof(path), "%s/%s", storyRoot_, kVerifyCacheName);
+	fs::File cacheFile = LittleFS.open(path, "r");
+	if (cacheFile) {
+		const size_t size = static_cast<size_t>(cacheFile.size());
+		uint8_t* image = static_cast<uint8_t*>(malloc(size > 0U ? size : 1U));
+		if (image != nullptr) {
+			const size_t read = cacheFile.read(image, size);
+			if (!verifyCache_->deserialize(image, read)) {
+				Serial.printf("[STORY_FS] verify cache discarded: %s\n", path);
+			}
+			free(image);
+		}
+		cacheFile.close();
+	}
+
+	snprintf(path, sizeof(path), "%s/%s", storyRoot_, kIntegrityManifestName);
+	fs::File manifest = LittleFS.open(path, "r");
+	if (manifest) {
+		char buffer[128];
+		for (;;) {
+			const size_t read = manifest.readBytes(buffer, sizeof(buffer));
+			if (read == 0U) {
+				break;
+			}
+			manifest_->feed(buffer, read);
+		}
+		manifest_->finish();
+		manifest.close();
+	}
+	Serial.printf("[STORY_FS] verify cache entries=%u manifest entries=%u rejected=%lu\n",
+								static_cast<unsigned int>(verifyCache_->count()),
+								static_cast<unsigned int>(manifest_->count()),
+								static_cast<unsigned long>(manifest_->rejectedLines()));
+}
+
+bool StoryFsManager::flushVerifyCache() {
+	if (verifyCache_ == nullptr || !verifyCache_->dirty()) {
+		return true;
+	}
+	const size_t size = verifyCache_->serializedSize();
+	uint8_t* image = static_cast<uint8_t*>(malloc(size));
+	if (image == nullptr) {
+		return false;
+	}
+	verifyCache_->serialize(image, size);
+	char path[96] = {};
+	char tmpPath[104] = {};
+	snprintf(path, sizeof(path), "%s/%s", storyRoot_, kVerifyCacheName);
+	snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+	// Written aside then renamed over it: a reset mid-write leaves the old cache.
+	fs::File out = LittleFS.open(tmpPath, "w");
+	bool ok = static_cast<bool>(out);
+	if (ok) {
+		ok = out.write(image, size) == size;
+		out.close();
+	}
+	free(image);
+	if (ok) {
+		ok = LittleFS.rename(tmpPath, path);
+	}
+	if (ok) {
+		verifyCache_->markClean();
+	} else {
+		Serial.printf("[STORY_FS] verify cache write failed: %s\n", path);
+	}
+	return ok;
+}
+
 bool StoryFsManager::ensureStoryDirs() {
 	const char* subdirs[] = {"", "scenarios", "apps", "screens", "audio", "actions"};
 	char fullPath[96] = {};
@@ -746,34 +883,9 @@ const char* StoryFsManager::buildResourcePath(const char* resource_type,
 	return out;
 }
 
-const char* StoryFsManager::storeString(const char* value) {
-	if (value == nullptr) {
-		return "";
-	}
-	size_t len = strlen(value);
-	if (len == 0U) {
-		return "";
-	}
-	if (stringPool_ == nullptr || stringCapacity_ == 0U) {
-		return "";
-	}
-	if (stringOffset_ + len + 1U >= stringCapacity_) {
-		return "";
-	}
-	char* target = &stringPool_[stringOffset_];
-	memcpy(target, value, len);
-	target[len] = '\0';
-	stringOffset_ += len + 1U;
-	return target;
-}
-
 void StoryFsManager::resetScenarioData() {
-	scenario_ = {};
-	stepCount_ = 0U;
-	stringOffset_ = 0U;
-	if (stringPool_ != nullptr && stringCapacity_ > 0U) {
-		memset(stringPool_, 0, stringCapacity_);
-	}
+	scenarioImage_ = {};
+	scenarioArena_.release();
 	if (appConfigs_ != nullptr) {
 		for (size_t i = 0U; i < kAppConfigCacheCount; ++i) {
 			AppConfigCache& cache = appConfigs_[i];
@@ -785,39 +897,27 @@ void StoryFsManager::resetScenarioData() {
 			memset(cache.appType, 0, sizeof(cache.appType));
 		}
 	}
-	if (steps_ != nullptr) {
-		memset(steps_, 0, sizeof(StepDef) * kMaxSteps);
-	}
-	if (stepRuntime_ != nullptr) {
-		memset(stepRuntime_, 0, sizeof(StepRuntime) * kMaxSteps);
-	}
 }
 
 bool StoryFsManager::ensureBuffers() {
-	if (steps_ == nullptr) {
-		steps_ = static_cast<StepDef*>(calloc(kMaxSteps, sizeof(StepDef)));
-		if (steps_ == nullptr) {
-			return false;
-		}
-	}
-	if (stepRuntime_ == nullptr) {
-		stepRuntime_ = static_cast<StepRuntime*>(calloc(kMaxSteps, sizeof(StepRuntime)));
-		if (stepRuntime_ == nullptr) {
-			return false;
-		}
-	}
 	if (appConfigs_ == nullptr) {
 		appConfigs_ = static_cast<AppConfigCache*>(calloc(kAppConfigCacheCount, sizeof(AppConfigCache)));
 		if (appConfigs_ == nullptr) {
 			return false;
 		}
 	}
-	if (stringPool_ == nullptr) {
-		stringPool_ = static_cast<char*>(calloc(kStringPoolSize, sizeof(char)));
-		if (stringPool_ == nullptr) {
+	// Zero-filled is the empty state for both (no constructors to run).
+	if (verifyCache_ == nullptr) {
+		verifyCache_ = static_cast<StoryVerifyCache*>(calloc(1U, sizeof(StoryVerifyCache)));
+		if (verifyCache_ == nullptr) {
+			return false;
+		}
+	}
+	if (manifest_ == nullptr) {
+		manifest_ = static_cast<StoryManifest*>(calloc(1U, sizeof(StoryManifest)));
+		if (manifest_ == nullptr) {
 			return false;
 		}
-		stringCapacity_ = kStringPoolSize;
 	}
 	return true;
 }
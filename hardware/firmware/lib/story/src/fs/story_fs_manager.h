@@ -5,6 +5,8 @@
 #include <FS.h>
 
 #include "../core/scenario_def.h"
+#include "story_scenario_loader.h"
+#include "story_verify_cache.h"
 
 struct AppConfig {
   char appId[64];
@@ -18,6 +20,26 @@ struct StoryScenarioInfo {
   uint32_t estimatedDurationS = 0U;
 };
 
+struct StoryScenarioLoadStats {
+  uint32_t loadMs = 0U;   // whole loadScenario(), resource checks included
+  uint32_t parseMs = 0U;  // JSON pass + compaction
+  uint32_t fileBytes = 0U;
+  uint32_t arenaBytes = 0U;     // resident after load
+  uint32_t peakHeapBytes = 0U;  // parse + final arena, both alive while compacting
+  uint16_t transitions = 0U;
+  uint8_t steps = 0U;
+  uint8_t parseAttempts = 0U;
+};
+
+struct StoryVerifyStats {
+  uint32_t files = 0U;
+  uint32_t hashed = 0U;  // read in full
+  uint32_t cached = 0U;  // digest from the verify cache
+  uint32_t failed = 0U;
+  uint32_t hashedBytes = 0U;
+  uint32_t elapsedMs = 0U;  // verifyBundle() only
+};
+
 class StoryFsManager {
  public:
   explicit StoryFsManager(const char* story_root = "/story");
@@ -26,8 +48,10 @@ class StoryFsManager {
   bool init();
   void cleanup();
 
-  // Loads a scenario JSON into a cached ScenarioDef snapshot.
+  // Loads a scenario JSON into a cached ScenarioDef snapshot, in one pass
+  // over the file and one heap block sized for it.
   bool loadScenario(const char* scenario_id);
+  const StoryScenarioLoadStats& lastLoadStats() const;
 
   bool listScenarios(StoryScenarioInfo* out, size_t maxCount, size_t* outCount) const;
   bool fsInfo(uint32_t* totalBytes, uint32_t* usedBytes, uint16_t* scenarioCount) const;
@@ -37,22 +61,28 @@ class StoryFsManager {
   const ResourceBindings* getResources(const char* step_id) const;
   const AppConfig* getAppConfig(const char* app_id);
 
-  // Verifies checksum for a single resource JSON.
+  // Verifies checksum for a single resource JSON. The expected digest comes
+  // from <root>/integrity.sha256 when it lists the file, else the sidecar;
+  // unchanged files are not rehashed (see StoryVerifyCache).
   bool validateChecksum(const char* resource_type, const char* resource_id);
+  // Checks every file listed in <root>/integrity.sha256 in one pass.
+  bool verifyBundle(StoryVerifyStats* out = nullptr);
+  // Totals since init().
+  const StoryVerifyStats& verifyStats() const;
+  bool flushVerifyCache();
   // Logs resources under /story/<type> to Serial.
   void listResources(const char* resource_type);
 
   const ScenarioDef* scenario() const;
 
  private:
-  static constexpr size_t kMaxSteps = 12U;
   static constexpr size_t kAppConfigCacheCount = 4U;
-  static constexpr size_t kStringPoolSize = 2048U;
+  static constexpr size_t kValidatedCacheSize = 48U;
 
-  struct StepRuntime {
-    TransitionDef transitions[12] = {};
-    const char* actionIds[8] = {};
-    const char* appIds[6] = {};
+  // (type, id) resources already checked during the current load.
+  struct ValidatedSet {
+    uint32_t hashes[kValidatedCacheSize] = {};
+    uint8_t count = 0U;
   };
 
   struct AppConfigCache {
@@ -66,29 +96,36 @@ class StoryFsManager {
 
   bool loadJson(const char* path, DynamicJsonDocument& doc);
   bool verifyChecksum(const char* resource_path);
+  bool verifyFile(const char* path, const uint8_t* expected);
+  bool readSidecarDigest(const char* resource_path, uint8_t* digest);
+  void loadVerifyState();
   bool ensureBuffers();
   bool ensureStoryDirs();
   bool loadScenarioInfoFromFile(const char* path, StoryScenarioInfo* out) const;
   bool parseScenarioJson(fs::File& file, StoryScenarioInfo* out) const;
   bool loadEntityJson(const char* entityType, const char* entityId);
+  bool parseScenarioFile(fs::File& file,
+                         StoryArena& out,
+                         StoryScenarioImage* image,
+                         StoryScenarioLoadStats* stats);
+  bool validateEntity(const char* entityType, const char* entityId, ValidatedSet* seen);
+  bool validateScenarioResources(StoryScenarioImage& image);
   const char* buildResourcePath(const char* resource_type,
                                 const char* resource_id,
                                 const char* extension,
                                 char* out,
                                 size_t out_len) const;
-  const char* storeString(const char* value);
   void resetScenarioData();
 
   char storyRoot_[32] = {};
   bool initialized_ = false;
-  ScenarioDef scenario_ = {};
-  StepDef* steps_ = nullptr;
-  StepRuntime* stepRuntime_ = nullptr;
-  uint8_t stepCount_ = 0U;
-
-  char* stringPool_ = nullptr;
-  size_t stringOffset_ = 0U;
-  size_t stringCapacity_ = 0U;
+  // Owns every step, transition and string of the loaded scenario.
+  StoryArena scenarioArena_;
+  StoryScenarioImage scenarioImage_ = {};
+  StoryScenarioLoadStats lastLoadStats_ = {};
 
   AppConfigCache* appConfigs_ = nullptr;
+  StoryVerifyCache* verifyCache_ = nullptr;
+  StoryManifest* manifest_ = nullptr;
+  StoryVerifyStats verifyStats_ = {};
 };
@@ -0,0 +1,1059 @@
+#include "story_scenario_loader.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+constexpr uint8_t kMaxCount = 255U;
+
+uint32_t hashText(const char* text, size_t len) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0U; i < len; ++i) {
+    hash = (hash ^ static_cast<uint8_t>(text[i])) * 16777619UL;
+  }
+  return hash;
+}
+
+size_t alignUp(size_t value, size_t align) {
+  return (value + align - 1U) & ~(align - 1U);
+}
+
+bool isSpace(int c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+int hexValue(int c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return 10 + c - 'a';
+  }
+  if (c >= 'A' && c <= 'F') {
+    return 10 + c - 'A';
+  }
+  return -1;
+}
+
+// Same mapping the ArduinoJson loader used.
+StoryTransitionTrigger parseTrigger(const char* value) {
+  if (strcmp(value, "after_ms") == 0) {
+    return StoryTransitionTrigger::kAfterMs;
+  }
+  if (strcmp(value, "immediate") == 0) {
+    return StoryTransitionTrigger::kImmediate;
+  }
+  return StoryTransitionTrigger::kOnEvent;
+}
+
+StoryEventType parseEventType(const char* value) {
+  static const struct {
+    const char* name;
+    StoryEventType type;
+  } kTypes[] = {
+      {"unlock", StoryEventType::kUnlock},   {"audio_done", StoryEventType::kAudioDone},
+      {"timer", StoryEventType::kTimer},     {"serial", StoryEventType::kSerial},
+      {"button", StoryEventType::kButton},   {"espnow", StoryEventType::kEspNow},
+      {"esp_now", StoryEventType::kEspNow},  {"action", StoryEventType::kAction},
+      {"voice", StoryEventType::kVoice},     {"voice_bridge", StoryEventType::kVoice},
+  };
+  for (const auto& entry : kTypes) {
+    if (strcmp(entry.name, value) == 0) {
+      return entry.type;
+    }
+  }
+  return StoryEventType::kNone;
+}
+
+// Steps are parsed into a list: their arrays are allocated while the step is
+// open, so StepDefs cannot be contiguous until compaction.
+struct StepNode {
+  StepDef step;
+  StepNode* next;
+};
+
+struct ParseState {
+  StoryJsonReader& reader;
+  StoryArena& arena;
+  StoryScenarioParseError* error;
+
+  bool fail(const char* code) {
+    if (error != nullptr && error->code == nullptr) {
+      error->code = reader.failed() ? reader.error() : code;
+      error->offset = reader.offset();
+    }
+    return false;
+  }
+};
+
+bool readEnumText(ParseState& state, char* out, size_t capacity) {
+  if (state.reader.peek() == StoryJsonReader::Type::kNull) {
+    out[0] = '\0';
+    return state.reader.skipValue();
+  }
+  if (!state.reader.readString(out, capacity)) {
+    // Unknown long values map to the default, like an unknown short one.
+    out[0] = '\0';
+    return !state.reader.failed();
+  }
+  return true;
+}
+
+// Array of strings, contiguous in the arena (the strings go to the top).
+bool readStringArray(ParseState& state, const char* const** out, uint8_t* outCount, uint16_t* total) {
+  *out = nullptr;
+  *outCount = 0U;
+  if (state.reader.peek() != StoryJsonReader::Type::kArray) {
+    return state.reader.skipValue();
+  }
+  if (!state.reader.enterArray()) {
+    return state.fail("bad_array");
+  }
+  const char** items = nullptr;
+  uint8_t count = 0U;
+  while (state.reader.nextItem()) {
+    if (count == kMaxCount) {
+      return state.fail("too_many_items");
+    }
+    const char** slot = state.arena.allocateArray<const char*>(1U);
+    if (slot == nullptr) {
+      return state.fail("arena_full");
+    }
+    if (items == nullptr) {
+      items = slot;
+    }
+    const StoryJsonReader::Type type = state.reader.peek();
+    if (type == StoryJsonReader::Type::kString || type == StoryJsonReader::Type::kNull) {
+      *slot = state.reader.readString(state.arena);
+    } else {
+      // Kept as an empty id, as the document-based loader did.
+      *slot = state.reader.skipValue() ? "" : nullptr;
+    }
+    if (*slot == nullptr) {
+      return state.fail("bad_string");
+    }
+    ++count;
+  }
+  if (state.reader.failed()) {
+    return state.fail("bad_array");
+  }
+  *out = items;
+  *outCount = count;
+  if (total != nullptr) {
+    *total = static_cast<uint16_t>(*total + count);
+  }
+  return true;
+}
+
+bool readTransition(ParseState& state, TransitionDef* tr) {
+  *tr = {};
+  tr->id = "";
+  tr->eventName = "";
+  tr->targetStepId = "";
+  tr->eventType = StoryEventType::kNone;
+  char key[24] = {};
+  char text[24] = {};
+  int64_t number = 0;
+  while (state.reader.nextKey(key, sizeof(key))) {
+    bool ok = true;
+    if (strcmp(key, "id") == 0) {
+      tr->id = state.reader.readString(state.arena);
+      ok = tr->id != nullptr;
+    } else if (strcmp(key, "trigger") == 0) {
+      ok = readEnumText(state, text, sizeof(text));
+      tr->trigger = parseTrigger(text);
+    } else if (strcmp(key, "event_type") == 0) {
+      ok = readEnumText(state, text, sizeof(text));
+      tr->eventType = parseEventType(text);
+    } else if (strcmp(key, "event_name") == 0) {
+      tr->eventName = state.reader.readString(state.arena);
+      ok = tr->eventName != nullptr;
+    } else if (strcmp(key, "after_ms") == 0) {
+      ok = state.reader.readInt(&number);
+      tr->afterMs = static_cast<uint32_t>(number);
+    } else if (strcmp(key, "target_step_id") == 0) {
+      tr->targetStepId = state.reader.readString(state.arena);
+      ok = tr->targetStepId != nullptr;
+    } else if (strcmp(key, "priority") == 0) {
+      ok = state.reader.readInt(&number);
+      tr->priority = static_cast<uint8_t>(number);
+    } else {
+      ok = state.reader.skipValue();
+    }
+    if (!ok) {
+      return state.fail("bad_transition");
+    }
+  }
+  return !state.reader.failed() || state.fail("bad_transition");
+}
+
+bool readTransitions(ParseState& state, StepDef* step, uint16_t* total) {
+  step->transitions = nullptr;
+  step->transitionCount = 0U;
+  if (state.reader.peek() != StoryJsonReader::Type::kArray) {
+    return state.reader.skipValue();
+  }
+  if (!state.reader.enterArray()) {
+    return state.fail("bad_transitions");
+  }
+  TransitionDef* first = nullptr;
+  uint8_t count = 0U;
+  while (state.reader.nextItem()) {
+    if (state.reader.peek() != StoryJsonReader::Type::kObject) {
+      // Non-object entries were skipped by the previous loader too.
+      if (!state.reader.skipValue()) {
+        return state.fail("bad_transitions");
+      }
+      continue;
+    }
+    if (count == kMaxCount) {
+      return state.fail("too_many_transitions");
+    }
+    TransitionDef* tr = state.arena.allocateArray<TransitionDef>(1U);
+    if (tr == nullptr) {
+      return state.fail("arena_full");
+    }
+    if (first == nullptr) {
+      first = tr;
+    }
+    if (!state.reader.enterObject() || !readTransition(state, tr)) {
+      return state.fail("bad_transition");
+    }
+    ++count;
+  }
+  if (state.reader.failed()) {
+    return state.fail("bad_transitions");
+  }
+  step->transitions = first;
+  step->transitionCount = count;
+  *total = static_cast<uint16_t>(*total + count);
+  return true;
+}
+
+bool readStep(ParseState& state, StepDef* step, StoryScenarioImage* image) {
+  *step = {};
+  step->id = "";
+  step->resources.screenSceneId = "";
+  step->resources.audioPackId = "";
+  char key[24] = {};
+  while (state.reader.nextKey(key, sizeof(key))) {
+    bool ok = true;
+    if (strcmp(key, "step_id") == 0) {
+      step->id = state.reader.readString(state.arena);
+      ok = step->id != nullptr;
+    } else if (strcmp(key, "screen_scene_id") == 0) {
+      step->resources.screenSceneId = state.reader.readString(state.arena);
+      ok = step->resources.screenSceneId != nullptr;
+    } else if (strcmp(key, "audio_pack_id") == 0) {
+      step->resources.audioPackId = state.reader.readString(state.arena);
+      ok = step->resources.audioPackId != nullptr;
+    } else if (strcmp(key, "actions") == 0) {
+      ok = readStringArray(state, &step->resources.actionIds, &step->resources.actionCount, &image->actionCount);
+    } else if (strcmp(key, "apps") == 0) {
+      ok = readStringArray(state, &step->resources.appIds, &step->resources.appCount, nullptr);
+    } else if (strcmp(key, "mp3_gate_open") == 0) {
+      ok = state.reader.readBool(&step->mp3GateOpen);
+    } else if (strcmp(key, "transitions") == 0) {
+      ok = readTransitions(state, step, &image->transitionCount);
+    } else {
+      ok = state.reader.skipValue();
+    }
+    if (!ok) {
+      return state.fail("bad_step");
+    }
+  }
+  return !state.reader.failed() || state.fail("bad_step");
+}
+
+bool readSteps(ParseState& state, StoryScenarioImage* image) {
+  if (!state.reader.enterArray()) {
+    return state.fail("missing_steps");
+  }
+  StepNode* head = nullptr;
+  StepNode* tail = nullptr;
+  uint8_t count = 0U;
+  while (state.reader.nextItem()) {
+    if (state.reader.peek() != StoryJsonReader::Type::kObject) {
+      if (!state.reader.skipValue()) {
+        return state.fail("bad_steps");
+      }
+      continue;
+    }
+    if (count == kMaxCount) {
+      return state.fail("too_many_steps");
+    }
+    // The node goes after the step's arrays: readStep allocates them first.
+    StepDef step = {};
+    if (!state.reader.enterObject() || !readStep(state, &step, image)) {
+      return state.fail("bad_step");
+    }
+    StepNode* node = state.arena.allocateArray<StepNode>(1U);
+    if (node == nullptr) {
+      return state.fail("arena_full");
+    }
+    node->step = step;
+    node->next = nullptr;
+    if (tail != nullptr) {
+      tail->next = node;
+    } else {
+      head = node;
+    }
+    tail = node;
+    ++count;
+  }
+  if (state.reader.failed()) {
+    return state.fail("bad_steps");
+  }
+  // Until compaction, `steps` is the head of the StepNode list.
+  image->scenario.steps = (head != nullptr) ? &head->step : nullptr;
+  image->scenario.stepCount = count;
+  return true;
+}
+
+bool readBindings(ParseState& state, StoryScenarioImage* image) {
+  if (state.reader.peek() != StoryJsonReader::Type::kArray) {
+    return state.reader.skipValue();
+  }
+  if (!state.reader.enterArray()) {
+    return state.fail("bad_bindings");
+  }
+  const char** first = nullptr;
+  uint16_t count = 0U;
+  char key[16] = {};
+  while (state.reader.nextItem()) {
+    if (state.reader.peek() != StoryJsonReader::Type::kObject) {
+      if (!state.reader.skipValue()) {
+        return state.fail("bad_bindings");
+      }
+      continue;
+    }
+    const char* id = "";
+    if (!state.reader.enterObject()) {
+      return state.fail("bad_bindings");
+    }
+    while (state.reader.nextKey(key, sizeof(key))) {
+      bool ok = true;
+      if (strcmp(key, "id") == 0) {
+        id = state.reader.readString(state.arena);
+        ok = id != nullptr;
+      } else {
+        ok = state.reader.skipValue();
+      }
+      if (!ok) {
+        return state.fail("bad_bindings");
+      }
+    }
+    if (state.reader.failed()) {
+      return state.fail("bad_bindings");
+    }
+    if (id[0] == '\0') {
+      continue;
+    }
+    const char** slot = state.arena.allocateArray<const char*>(1U);
+    if (slot == nullptr) {
+      return state.fail("arena_full");
+    }
+    if (first == nullptr) {
+      first = slot;
+    }
+    *slot = id;
+    ++count;
+  }
+  if (state.reader.failed()) {
+    return state.fail("bad_bindings");
+  }
+  image->appBindingIds = first;
+  image->appBindingCount = count;
+  return true;
+}
+
+const char* relocateString(const char* text, const StoryArena& src, const char* destStrings) {
+  if (text == nullptr || !src.stringsContain(text)) {
+    return text;
+  }
+  return destStrings + (text - src.stringsBegin());
+}
+
+const char* const* copyStringArray(const char* const* items,
+                                   uint8_t count,
+                                   const StoryArena& src,
+                                   StoryArena& dest,
+                                   const char* destStrings) {
+  if (items == nullptr || count == 0U) {
+    return nullptr;
+  }
+  const char** out = dest.allocateArray<const char*>(count);
+  for (uint8_t i = 0U; i < count; ++i) {
+    out[i] = relocateString(items[i], src, destStrings);
+  }
+  return out;
+}
+
+}  // namespace
+
+StoryArena::~StoryArena() {
+  release();
+}
+
+bool StoryArena::reserve(size_t capacity) {
+  release();
+  if (capacity == 0U) {
+    return false;
+  }
+  base_ = static_cast<uint8_t*>(malloc(capacity));
+  if (base_ == nullptr) {
+    return false;
+  }
+  capacity_ = capacity;
+  high_ = capacity;
+  return true;
+}
+
+void StoryArena::release() {
+  free(base_);
+  base_ = nullptr;
+  capacity_ = 0U;
+  low_ = 0U;
+  high_ = 0U;
+  memset(intern_, 0, sizeof(intern_));
+}
+
+void StoryArena::swap(StoryArena& other) {
+  std::swap(base_, other.base_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(low_, other.low_);
+  std::swap(high_, other.high_);
+  std::swap(intern_, other.intern_);
+}
+
+void* StoryArena::allocate(size_t size, size_t align) {
+  if (base_ == nullptr) {
+    return nullptr;
+  }
+  // Alignment is relative to malloc's, which covers every type stored here.
+  const size_t start = alignUp(low_, align);
+  if (start > high_ || size > high_ - start) {
+    return nullptr;
+  }
+  low_ = start + size;
+  return base_ + start;
+}
+
+char* StoryArena::stringScratch(size_t* available) {
+  *available = (base_ != nullptr) ? (high_ - low_) : 0U;
+  return (base_ != nullptr) ? reinterpret_cast<char*>(base_ + low_) : nullptr;
+}
+
+const char* StoryArena::commitString(size_t len) {
+  if (len == 0U) {
+    return "";
+  }
+  if (base_ == nullptr || len + 1U > high_ - low_) {
+    return nullptr;
+  }
+  const char* scratch = reinterpret_cast<const char*>(base_ + low_);
+  const uint32_t hash = hashText(scratch, len);
+  const char* existing = findInterned(scratch, len, hash);
+  if (existing != nullptr) {
+    return existing;
+  }
+  const size_t start = high_ - len - 1U;
+  memmove(base_ + start, scratch, len);
+  base_[start + len] = '\0';
+  high_ = start;
+  uint32_t& slot = intern_[hash % kInternSlots];
+  if (slot == 0U) {
+    slot = static_cast<uint32_t>(capacity_ - start);
+  }
+  return reinterpret_cast<const char*>(base_ + start);
+}
+
+char* StoryArena::allocateStrings(size_t bytes) {
+  if (base_ == nullptr || bytes > high_ - low_) {
+    return nullptr;
+  }
+  high_ -= bytes;
+  return reinterpret_cast<char*>(base_ + high_);
+}
+
+const char* StoryArena::storeString(const char* text) {
+  const size_t len = (text != nullptr) ? strlen(text) : 0U;
+  size_t available = 0U;
+  char* scratch = stringScratch(&available);
+  if (len == 0U) {
+    return "";
+  }
+  if (scratch == nullptr || len + 1U > available) {
+    return nullptr;
+  }
+  memcpy(scratch, text, len);
+  return commitString(len);
+}
+
+const char* StoryArena::findInterned(const char* text, size_t len, uint32_t hash) const {
+  const uint32_t offset = intern_[hash % kInternSlots];
+  if (offset == 0U) {
+    return nullptr;
+  }
+  const char* candidate = reinterpret_cast<const char*>(base_ + capacity_ - offset);
+  if (strncmp(candidate, text, len) == 0 && candidate[len] == '\0') {
+    return candidate;
+  }
+  return nullptr;
+}
+
+bool StoryArena::contains(const void* ptr) const {
+  const uint8_t* p = static_cast<const uint8_t*>(ptr);
+  return base_ != nullptr && p >= base_ && p < base_ + capacity_;
+}
+
+bool StoryArena::stringsContain(const void* ptr) const {
+  const uint8_t* p = static_cast<const uint8_t*>(ptr);
+  return base_ != nullptr && p >= base_ + high_ && p < base_ + capacity_;
+}
+
+const char* StoryArena::stringsBegin() const {
+  return reinterpret_cast<const char*>(base_ + high_);
+}
+
+size_t StoryArena::stringBytes() const {
+  return capacity_ - high_;
+}
+
+size_t StoryArena::used() const {
+  return low_ + (capacity_ - high_);
+}
+
+size_t StoryArena::capacity() const {
+  return capacity_;
+}
+
+StoryJsonReader::StoryJsonReader(StoryReadFn read, void* ctx) : read_(read), ctx_(ctx) {}
+
+int StoryJsonReader::peekByte() {
+  if (bufferPos_ == bufferLen_) {
+    if (eof_ || read_ == nullptr) {
+      return -1;
+    }
+    bufferLen_ = read_(ctx_, buffer_, sizeof(buffer_));
+    bufferPos_ = 0U;
+    if (bufferLen_ == 0U) {
+      eof_ = true;
+      return -1;
+    }
+  }
+  return buffer_[bufferPos_];
+}
+
+int StoryJsonReader::takeByte() {
+  const int c = peekByte();
+  if (c >= 0) {
+    ++bufferPos_;
+    ++consumed_;
+  }
+  return c;
+}
+
+int StoryJsonReader::skipSpace() {
+  int c = peekByte();
+  while (isSpace(c)) {
+    takeByte();
+    c = peekByte();
+  }
+  return c;
+}
+
+bool StoryJsonReader::expect(char value) {
+  if (skipSpace() != value) {
+    return fail("unexpected_char");
+  }
+  takeByte();
+  return true;
+}
+
+bool StoryJsonReader::fail(const char* error) {
+  if (error_ == nullptr) {
+    error_ = error;
+  }
+  return false;
+}
+
+StoryJsonReader::Type StoryJsonReader::peek() {
+  if (error_ != nullptr) {
+    return Type::kInvalid;
+  }
+  switch (skipSpace()) {
+    case '{':
+      return Type::kObject;
+    case '[':
+      return Type::kArray;
+    case '"':
+      return Type::kString;
+    case 't':
+    case 'f':
+      return Type::kBool;
+    case 'n':
+      return Type::kNull;
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+      return Type::kNumber;
+    default:
+      return Type::kInvalid;
+  }
+}
+
+bool StoryJsonReader::enterObject() {
+  if (error_ != nullptr || depth_ >= kMaxDepth || !expect('{')) {
+    return fail("bad_object");
+  }
+  firstBits_ |= (1UL << depth_);
+  ++depth_;
+  return true;
+}
+
+bool StoryJsonReader::enterArray() {
+  if (error_ != nullptr || depth_ >= kMaxDepth || !expect('[')) {
+    return fail("bad_array");
+  }
+  firstBits_ |= (1UL << depth_);
+  ++depth_;
+  return true;
+}
+
+bool StoryJsonReader::beginMember(char close) {
+  if (error_ != nullptr || depth_ == 0U) {
+    return fail("no_container");
+  }
+  const uint32_t bit = 1UL << (depth_ - 1U);
+  int c = skipSpace();
+  if (c == close) {
+    takeByte();
+    --depth_;
+    return false;
+  }
+  if ((firstBits_ & bit) == 0U) {
+    if (c != ',') {
+      return fail("missing_comma");
+    }
+    takeByte();
+    c = skipSpace();
+  }
+  firstBits_ &= ~bit;
+  if (c < 0) {
+    return fail("truncated");
+  }
+  return true;
+}
+
+bool StoryJsonReader::nextKey(char* key, size_t capacity) {
+  if (!beginMember('}')) {
+    return false;
+  }
+  // Long keys are ours to ignore: keep what fits, the caller will not match it.
+  size_t len = 0U;
+  const bool ok = readStringBody([&](char c) {
+    if (len + 1U < capacity) {
+      key[len++] = c;
+    }
+    return true;
+  });
+  if (capacity > 0U) {
+    key[len] = '\0';
+  }
+  return ok && expect(':');
+}
+
+bool StoryJsonReader::nextItem() {
+  return beginMember(']');
+}
+
+template <typename Sink>
+bool StoryJsonReader::readStringBody(Sink sink) {
+  if (!expect('"')) {
+    return fail("expected_string");
+  }
+  for (;;) {
+    int c = takeByte();
+    if (c < 0) {
+      return fail("truncated");
+    }
+    if (c == '"') {
+      return true;
+    }
+    if (c < 0x20) {
+      return fail("control_char");
+    }
+    if (c == '\\') {
+      c = takeByte();
+      switch (c) {
+        case '"':
+        case '\\':
+        case '/':
+          break;
+        case 'b':
+          c = '\b';
+          break;
+        case 'f':
+          c = '\f';
+          break;
+        case 'n':
+          c = '\n';
+          break;
+        case 'r':
+          c = '\r';
+          break;
+        case 't':
+          c = '\t';
+          break;
+        case 'u': {
+          uint32_t code = 0U;
+          for (uint8_t i = 0U; i < 4U; ++i) {
+            const int digit = hexValue(takeByte());
+            if (digit < 0) {
+              return fail("bad_escape");
+            }
+            code = (code << 4U) | static_cast<uint32_t>(digit);
+          }
+          // UTF-8, BMP only; surrogate halves are kept as-is like ArduinoJson 6.
+          if (code < 0x80U) {
+            c = static_cast<int>(code);
+          } else if (code < 0x800U) {
+            if (!sink(static_cast<char>(0xC0U | (code >> 6U)))) {
+              return false;
+            }
+            c = static_cast<int>(0x80U | (code & 0x3FU));
+          } else {
+            if (!sink(static_cast<char>(0xE0U | (code >> 12U))) ||
+                !sink(static_cast<char>(0x80U | ((code >> 6U) & 0x3FU)))) {
+              return false;
+            }
+            c = static_cast<int>(0x80U | (code & 0x3FU));
+          }
+          break;
+        }
+        default:
+          return fail("bad_escape");
+      }
+    }
+    if (!sink(static_cast<char>(c))) {
+      return false;
+    }
+  }
+}
+
+bool StoryJsonReader::readString(char* out, size_t capacity) {
+  if (out == nullptr || capacity == 0U) {
+    return fail("no_buffer");
+  }
+  size_t len = 0U;
+  bool fits = true;
+  const bool ok = readStringBody([&](char c) {
+    if (len + 1U < capacity) {
+      out[len++] = c;
+    } else {
+      fits = false;
+    }
+    return true;
+  });
+  out[len] = '\0';
+  return ok && fits;
+}
+
+const char* StoryJsonReader::readString(StoryArena& arena) {
+  if (peek() == Type::kNull) {
+    return readLiteral("null") ? "" : nullptr;
+  }
+  size_t available = 0U;
+  char* scratch = arena.stringScratch(&available);
+  size_t len = 0U;
+  bool full = false;
+  const bool ok = readStringBody([&](char c) {
+    if (scratch == nullptr || len + 1U >= available) {
+      full = true;
+      return false;
+    }
+    scratch[len++] = c;
+    return true;
+  });
+  if (full) {
+    fail("arena_full");
+    return nullptr;
+  }
+  if (!ok) {
+    return nullptr;
+  }
+  const char* stored = arena.commitString(len);
+  if (stored == nullptr) {
+    fail("arena_full");
+  }
+  return stored;
+}
+
+bool StoryJsonReader::readLiteral(const char* text) {
+  skipSpace();
+  for (const char* p = text; *p != '\0'; ++p) {
+    if (takeByte() != *p) {
+      return fail("bad_literal");
+    }
+  }
+  return true;
+}
+
+bool StoryJsonReader::readInt(int64_t* out) {
+  *out = 0;
+  const Type type = peek();
+  if (type == Type::kNull) {
+    return readLiteral("null");
+  }
+  if (type != Type::kNumber) {
+    return fail("expected_number");
+  }
+  bool negative = false;
+  if (peekByte() == '-') {
+    negative = true;
+    takeByte();
+  }
+  int64_t value = 0;
+  uint8_t digits = 0U;
+  int c = peekByte();
+  while (c >= '0' && c <= '9') {
+    if (value < 1000000000000000000LL) {
+      value = value * 10 + (c - '0');
+    }
+    ++digits;
+    takeByte();
+    c = peekByte();
+  }
+  if (digits == 0U) {
+    return fail("bad_number");
+  }
+  // Fraction and exponent are accepted and dropped (integer fields only).
+  if (c == '.') {
+    takeByte();
+    for (c = peekByte(); c >= '0' && c <= '9'; c = peekByte()) {
+      takeByte();
+    }
+  }
+  if (c == 'e' || c == 'E') {
+    takeByte();
+    c = peekByte();
+    if (c == '+' || c == '-') {
+      takeByte();
+    }
+    for (c = peekByte(); c >= '0' && c <= '9'; c = peekByte()) {
+      takeByte();
+    }
+  }
+  *out = negative ? -value : value;
+  return true;
+}
+
+bool StoryJsonReader::readBool(bool* out) {
+  *out = false;
+  switch (peek()) {
+    case Type::kNull:
+      return readLiteral("null");
+    case Type::kBool:
+      if (peekByte() == 't') {
+        *out = true;
+        return readLiteral("true");
+      }
+      return readLiteral("false");
+    default:
+      return fail("expected_bool");
+  }
+}
+
+bool StoryJsonReader::skipValue() {
+  // Recursion is bounded by kMaxDepth (enterObject/enterArray refuse deeper).
+  char key[8] = {};
+  switch (peek()) {
+    case Type::kObject:
+      if (!enterObject()) {
+        return false;
+      }
+      while (nextKey(key, sizeof(key))) {
+        if (!skipValue()) {
+          return false;
+        }
+      }
+      return error_ == nullptr;
+    case Type::kArray:
+      if (!enterArray()) {
+        return false;
+      }
+      while (nextItem()) {
+        if (!skipValue()) {
+          return false;
+        }
+      }
+      return error_ == nullptr;
+    case Type::kString:
+      return readStringBody([](char) { return true; });
+    case Type::kNumber: {
+      int64_t ignored = 0;
+      return readInt(&ignored);
+    }
+    case Type::kBool:
+      return readLiteral(peekByte() == 't' ? "true" : "false");
+    case Type::kNull:
+      return readLiteral("null");
+    case Type::kInvalid:
+    default:
+      return fail(skipSpace() < 0 ? "truncated" : "bad_value");
+  }
+}
+
+bool StoryJsonReader::atEnd() {
+  return error_ == nullptr && depth_ == 0U && skipSpace() < 0;
+}
+
+bool StoryJsonReader::failed() const {
+  return error_ != nullptr;
+}
+
+const char* StoryJsonReader::error() const {
+  return (error_ != nullptr) ? error_ : "ok";
+}
+
+size_t StoryJsonReader::offset() const {
+  return consumed_;
+}
+
+bool storyParseScenario(StoryJsonReader& reader,
+                        StoryArena& arena,
+                        StoryScenarioImage* out,
+                        StoryScenarioParseError* error) {
+  if (out == nullptr) {
+    return false;
+  }
+  *out = {};
+  out->scenario.id = "";
+  out->scenario.initialStepId = "";
+  if (error != nullptr) {
+    *error = {};
+  }
+  ParseState state = {reader, arena, error};
+  if (!reader.enterObject()) {
+    return state.fail("not_an_object");
+  }
+  bool sawSteps = false;
+  char key[24] = {};
+  int64_t number = 0;
+  while (reader.nextKey(key, sizeof(key))) {
+    bool ok = true;
+    if (strcmp(key, "id") == 0) {
+      out->scenario.id = reader.readString(arena);
+      ok = out->scenario.id != nullptr;
+    } else if (strcmp(key, "version") == 0) {
+      ok = reader.readInt(&number);
+      out->scenario.version = static_cast<uint16_t>(number);
+    } else if (strcmp(key, "initial_step") == 0) {
+      out->scenario.initialStepId = reader.readString(arena);
+      ok = out->scenario.initialStepId != nullptr;
+    } else if (strcmp(key, "app_bindings") == 0) {
+      ok = readBindings(state, out);
+    } else if (strcmp(key, "steps") == 0 && reader.peek() == StoryJsonReader::Type::kArray) {
+      ok = readSteps(state, out);
+      sawSteps = ok;
+    } else {
+      ok = reader.skipValue();
+    }
+    if (!ok) {
+      return state.fail("bad_scenario");
+    }
+  }
+  if (reader.failed() || !reader.atEnd()) {
+    return state.fail("trailing_data");
+  }
+  if (!sawSteps) {
+    return state.fail("missing_steps");
+  }
+  return true;
+}
+
+bool storyCompactScenario(const StoryScenarioImage& image,
+                          const StoryArena& src,
+                          StoryArena& dest,
+                          StoryScenarioImage* out) {
+  if (out == nullptr) {
+    return false;
+  }
+  const StepNode* head = reinterpret_cast<const StepNode*>(image.scenario.steps);
+  size_t bytes = sizeof(StepDef) * image.scenario.stepCount + alignof(StepDef);
+  bytes += sizeof(const char*) * image.appBindingCount + alignof(const char*);
+  for (const StepNode* node = head; node != nullptr; node = node->next) {
+    bytes += alignUp(sizeof(TransitionDef) * node->step.transitionCount, alignof(TransitionDef)) + alignof(TransitionDef);
+    bytes += sizeof(const char*) * (node->step.resources.actionCount + node->step.resources.appCount) +
+             2U * alignof(const char*);
+  }
+  const size_t stringBytes = src.stringBytes();
+  bytes += stringBytes;
+  if (!dest.reserve(bytes)) {
+    return false;
+  }
+
+  // Strings keep their layout: one copy, then every pointer moves by the same delta.
+  char* destStrings = nullptr;
+  if (stringBytes > 0U) {
+    destStrings = dest.allocateStrings(stringBytes);
+    memcpy(destStrings, src.stringsBegin(), stringBytes);
+  }
+
+  *out = image;
+  out->scenario.id = relocateString(image.scenario.id, src, destStrings);
+  out->scenario.initialStepId = relocateString(image.scenario.initialStepId, src, destStrings);
+
+  StepDef* steps = dest.allocateArray<StepDef>(image.scenario.stepCount);
+  uint8_t index = 0U;
+  for (const StepNode* node = head; node != nullptr; node = node->next, ++index) {
+    const StepDef& from = node->step;
+    StepDef& to = steps[index];
+    to = from;
+    to.id = relocateString(from.id, src, destStrings);
+    to.resources.screenSceneId = relocateString(from.resources.screenSceneId, src, destStrings);
+    to.resources.audioPackId = relocateString(from.resources.audioPackId, src, destStrings);
+    to.resources.actionIds =
+        copyStringArray(from.resources.actionIds, from.resources.actionCount, src, dest, destStrings);
+    to.resources.appIds = copyStringArray(from.resources.appIds, from.resources.appCount, src, dest, destStrings);
+    TransitionDef* transitions = nullptr;
+    if (from.transitionCount > 0U) {
+      transitions = dest.allocateArray<TransitionDef>(from.transitionCount);
+      for (uint8_t t = 0U; t < from.transitionCount; ++t) {
+        transitions[t] = from.transitions[t];
+        transitions[t].id = relocateString(from.transitions[t].id, src, destStrings);
+        transitions[t].eventName = relocateString(from.transitions[t].eventName, src, destStrings);
+        transitions[t].targetStepId = relocateString(from.transitions[t].targetStepId, src, destStrings);
+      }
+    }
+    to.transitions = transitions;
+  }
+  out->scenario.steps = (image.scenario.stepCount > 0U) ? steps : nullptr;
+
+  const char** bindings = nullptr;
+  if (image.appBindingCount > 0U) {
+    bindings = dest.allocateArray<const char*>(image.appBindingCount);
+    for (uint16_t i = 0U; i < image.appBindingCount; ++i) {
+      bindings[i] = relocateString(image.appBindingIds[i], src, destStrings);
+    }
+  }
+  out->appBindingIds = bindings;
+  return true;
+}
+
+size_t storyScenarioArenaHint(size_t fileBytes) {
+  // Measured on data/story: parse use is ~0.6x the file with 8-byte pointers,
+  // ~0.4x with 4-byte ones (ESP32). Structures scale with the pointer size.
+  return (fileBytes * sizeof(void*)) / 8U + 256U;
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../core/scenario_def.h"
+
+// One heap block, bump-allocated from both ends: structures grow up from the
+// bottom, strings grow down from the top. Nothing is freed individually; the
+// whole block goes at once.
+class StoryArena {
+ public:
+  StoryArena() = default;
+  ~StoryArena();
+  StoryArena(const StoryArena&) = delete;
+  StoryArena& operator=(const StoryArena&) = delete;
+
+  // Drops the previous block and allocates `capacity` bytes.
+  bool reserve(size_t capacity);
+  void release();
+  void swap(StoryArena& other);
+
+  void* allocate(size_t size, size_t align);
+  template <typename T>
+  T* allocateArray(size_t count) {
+    return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+  }
+
+  // Strings are written into the free gap, then committed to the top.
+  // Committing an empty string returns "" (not stored).
+  char* stringScratch(size_t* available);
+  const char* commitString(size_t len);
+  // Stores a copy of `text`, reusing an identical string already stored.
+  const char* storeString(const char* text);
+  // Raw block at the top of the string area, for bulk copies (no interning).
+  char* allocateStrings(size_t bytes);
+
+  bool contains(const void* ptr) const;
+  bool stringsContain(const void* ptr) const;
+  const char* stringsBegin() const;
+  size_t stringBytes() const;
+  size_t used() const;
+  size_t capacity() const;
+
+ private:
+  static constexpr size_t kInternSlots = 64U;
+
+  const char* findInterned(const char* text, size_t len, uint32_t hash) const;
+
+  uint8_t* base_ = nullptr;
+  size_t capacity_ = 0U;
+  size_t low_ = 0U;
+  size_t high_ = 0U;  // strings occupy [high_, capacity_)
+  // Offsets (from the top) of stored strings by hash; 0 = empty slot.
+  uint32_t intern_[kInternSlots] = {};
+};
+
+// Pull reader over a byte stream, SAX style: values are visited in file
+// order and never materialised as a document. Only strings the caller keeps
+// are copied, straight into the arena.
+typedef size_t (*StoryReadFn)(void* ctx, uint8_t* out, size_t capacity);
+
+class StoryJsonReader {
+ public:
+  enum class Type : uint8_t {
+    kInvalid = 0,
+    kObject,
+    kArray,
+    kString,
+    kNumber,
+    kBool,
+    kNull,
+  };
+
+  StoryJsonReader(StoryReadFn read, void* ctx);
+
+  Type peek();
+  bool enterObject();
+  bool enterArray();
+  // Next member of the innermost object; false at '}' (consumed) or error.
+  bool nextKey(char* key, size_t capacity);
+  // Next element of the innermost array; false at ']' (consumed) or error.
+  bool nextItem();
+
+  // Copies at most capacity-1 bytes; longer strings fail.
+  bool readString(char* out, size_t capacity);
+  // Null reads as "". Returns nullptr on error (arena full included).
+  const char* readString(StoryArena& arena);
+  // Integer part only; null reads as 0.
+  bool readInt(int64_t* out);
+  // null reads as false.
+  bool readBool(bool* out);
+  bool skipValue();
+  // Top-level value fully read and only whitespace left.
+  bool atEnd();
+
+  bool failed() const;
+  const char* error() const;
+  size_t offset() const;
+
+ private:
+  static constexpr size_t kBufferSize = 128U;
+  static constexpr uint8_t kMaxDepth = 32U;
+
+  int peekByte();
+  int takeByte();
+  int skipSpace();
+  bool expect(char value);
+  bool fail(const char* error);
+  bool readLiteral(const char* text);
+  // Streams a string body to `sink`; `sink` returns false to stop.
+  template <typename Sink>
+  bool readStringBody(Sink sink);
+  bool beginMember(char close);
+
+  StoryReadFn read_ = nullptr;
+  void* ctx_ = nullptr;
+  uint8_t buffer_[kBufferSize] = {};
+  size_t bufferLen_ = 0U;
+  size_t bufferPos_ = 0U;
+  size_t consumed_ = 0U;
+  bool eof_ = false;
+  const char* error_ = nullptr;
+  uint8_t depth_ = 0U;
+  uint32_t firstBits_ = 0U;  // bit d: no member read yet at depth d
+};
+
+// Scenario parsed into a StoryArena. `scenario` and everything it points to
+// live in the arena (screen ids may point into the scene registry).
+struct StoryScenarioImage {
+  ScenarioDef scenario = {};
+  const char* const* appBindingIds = nullptr;
+  uint16_t appBindingCount = 0U;
+  uint16_t transitionCount = 0U;
+  uint16_t actionCount = 0U;
+};
+
+struct StoryScenarioParseError {
+  const char* code = nullptr;
+  size_t offset = 0U;
+};
+
+// Single pass over the scenario JSON into `arena`. Steps, transitions and
+// bindings are only limited by the uint8_t counts of ScenarioDef/StepDef.
+// Step order in `out` is file order, but the steps array is not contiguous
+// until storyCompactScenario() runs.
+bool storyParseScenario(StoryJsonReader& reader,
+                        StoryArena& arena,
+                        StoryScenarioImage* out,
+                        StoryScenarioParseError* error);
+
+// Copies a parsed image into an exact-size arena with a contiguous steps array
+// and rewrites every pointer. `src` may be released afterwards.
+bool storyCompactScenario(const StoryScenarioImage& image,
+                          const StoryArena& src,
+                          StoryArena& dest,
+                          StoryScenarioImage* out);
+
+// Parse arena size for a scenario file of `fileBytes`: every stored string is
+// shorter than its JSON text, and structures stay below the file size for the
+// key-heavy layout the tools write. A pathological file gets one retry at
+// twice the size (see StoryFsManager::loadScenario).
+size_t storyScenarioArenaHint(size_t fileBytes);
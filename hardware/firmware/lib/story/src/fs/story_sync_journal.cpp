@@ -0,0 +1,150 @@
+#include "story_sync_journal.h"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint32_t kJournalMagic = 0x314A5353UL;  // "SSJ1"
+constexpr size_t kHeaderBytes = 12U;              // magic, count, entry size
+constexpr size_t kEntryBytes = StorySyncJournal::kMaxPath + 4U + 1U + StoryVerifyCache::kDigestBytes;
+constexpr uint8_t kCompletedMarker = 0xD0U;
+
+void putU32(uint8_t* out, uint32_t value) {
+  out[0] = static_cast<uint8_t>(value);
+  out[1] = static_cast<uint8_t>(value >> 8U);
+  out[2] = static_cast<uint8_t>(value >> 16U);
+  out[3] = static_cast<uint8_t>(value >> 24U);
+}
+
+uint32_t getU32(const uint8_t* in) {
+  return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8U) |
+         (static_cast<uint32_t>(in[2]) << 16U) | (static_cast<uint32_t>(in[3]) << 24U);
+}
+
+}  // namespace
+
+bool storySyncNeedsCopy(const StorySyncProbe& source, const StorySyncProbe& target) {
+  if (!source.present) {
+    return false;
+  }
+  if (!target.present || source.size != target.size || source.kind != target.kind ||
+      source.kind == StoryDigestKind::kNone) {
+    return true;
+  }
+  const size_t bytes = (source.kind == StoryDigestKind::kFnv1a32) ? 4U : StoryVerifyCache::kDigestBytes;
+  return memcmp(source.digest, target.digest, bytes) != 0;
+}
+
+void StorySyncJournal::clear() {
+  count_ = 0U;
+  completed_ = 0U;
+}
+
+bool StorySyncJournal::add(const char* path, uint32_t size, StoryDigestKind kind, const uint8_t* digest) {
+  if (path == nullptr || count_ >= kCapacity) {
+    return false;
+  }
+  const size_t len = strlen(path);
+  if (len == 0U || len >= kMaxPath) {
+    return false;
+  }
+  Entry& entry = entries_[count_];
+  memset(&entry, 0, sizeof(entry));
+  memcpy(entry.path, path, len);
+  entry.size = size;
+  entry.kind = static_cast<uint8_t>(kind);
+  if (digest != nullptr && kind != StoryDigestKind::kNone) {
+    memcpy(entry.digest, digest, sizeof(entry.digest));
+  }
+  ++count_;
+  return true;
+}
+
+size_t StorySyncJournal::count() const {
+  return count_;
+}
+
+const StorySyncJournal::Entry& StorySyncJournal::entry(size_t index) const {
+  return entries_[index];
+}
+
+uint32_t StorySyncJournal::totalBytes() const {
+  uint32_t total = 0U;
+  for (size_t i = 0U; i < count_; ++i) {
+    total += entries_[i].size;
+  }
+  return total;
+}
+
+size_t StorySyncJournal::completed() const {
+  return completed_;
+}
+
+void StorySyncJournal::markCompleted() {
+  if (completed_ < count_) {
+    ++completed_;
+  }
+}
+
+bool StorySyncJournal::finished() const {
+  return completed_ >= count_;
+}
+
+size_t StorySyncJournal::serializedSize() const {
+  return kHeaderBytes + count_ * kEntryBytes;
+}
+
+size_t StorySyncJournal::serialize(uint8_t* out, size_t capacity) const {
+  const size_t bytes = serializedSize();
+  if (out == nullptr || capacity < bytes) {
+    return 0U;
+  }
+  putU32(out, kJournalMagic);
+  putU32(out + 4U, static_cast<uint32_t>(count_));
+  putU32(out + 8U, static_cast<uint32_t>(kEntryBytes));
+  uint8_t* cursor = out + kHeaderBytes;
+  for (size_t i = 0U; i < count_; ++i) {
+    const Entry& entry = entries_[i];
+    memcpy(cursor, entry.path, kMaxPath);
+    putU32(cursor + kMaxPath, entry.size);
+    cursor[kMaxPath + 4U] = entry.kind;
+    memcpy(cursor + kMaxPath + 5U, entry.digest, StoryVerifyCache::kDigestBytes);
+    cursor += kEntryBytes;
+  }
+  return bytes;
+}
+
+bool StorySyncJournal::deserialize(const uint8_t* data, size_t len) {
+  clear();
+  if (data == nullptr || len < kHeaderBytes || getU32(data) != kJournalMagic || getU32(data + 8U) != kEntryBytes) {
+    return false;
+  }
+  const uint32_t count = getU32(data + 4U);
+  const size_t plan_bytes = kHeaderBytes + static_cast<size_t>(count) * kEntryBytes;
+  if (count > kCapacity || len < plan_bytes || len - plan_bytes > count) {
+    return false;
+  }
+  const uint8_t* cursor = data + kHeaderBytes;
+  for (uint32_t i = 0U; i < count; ++i) {
+    Entry& entry = entries_[i];
+    memcpy(entry.path, cursor, kMaxPath);
+    entry.path[kMaxPath - 1U] = '\0';
+    entry.size = getU32(cursor + kMaxPath);
+    entry.kind = cursor[kMaxPath + 4U];
+    memcpy(entry.digest, cursor + kMaxPath + 5U, StoryVerifyCache::kDigestBytes);
+    cursor += kEntryBytes;
+  }
+  for (size_t i = plan_bytes; i < len; ++i) {
+    if (data[i] != kCompletedMarker) {
+      count_ = 0U;
+      return false;
+    }
+  }
+  count_ = count;
+  completed_ = len - plan_bytes;
+  return true;
+}
+
+uint8_t StorySyncJournal::completedMarker() {
+  return kCompletedMarker;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "story_verify_cache.h"
+
+// What the sync planner knows about one file on one side (SD or LittleFS).
+struct StorySyncProbe {
+  bool present = false;
+  uint32_t size = 0U;
+  StoryDigestKind kind = StoryDigestKind::kNone;
+  uint8_t digest[StoryVerifyCache::kDigestBytes] = {};
+};
+
+// Copy unless both sides hold the same size and digest of the same kind.
+// A side without a digest (kNone) always copies.
+bool storySyncNeedsCopy(const StorySyncProbe& source, const StorySyncProbe& target);
+
+// Plan of one SD -> LittleFS sync: the files to copy with the digest each copy
+// must produce. Persisted once when planning ends, then one marker byte is
+// appended per finished file, so a reset resumes at the first unfinished file.
+class StorySyncJournal {
+ public:
+  static constexpr size_t kCapacity = 160U;
+  static constexpr size_t kMaxPath = 64U;
+
+  struct Entry {
+    char path[kMaxPath];
+    uint32_t size;
+    uint8_t kind;
+    uint8_t digest[StoryVerifyCache::kDigestBytes];
+  };
+
+  void clear();
+  // False when full or the path does not fit.
+  bool add(const char* path, uint32_t size, StoryDigestKind kind, const uint8_t* digest);
+  size_t count() const;
+  const Entry& entry(size_t index) const;
+  uint32_t totalBytes() const;
+
+  size_t completed() const;
+  void markCompleted();
+  bool finished() const;
+
+  // Plan image only; the trailing markers are appended by the caller.
+  size_t serializedSize() const;
+  size_t serialize(uint8_t* out, size_t capacity) const;
+  // Plan image plus any appended markers. Rejects other versions, sizes and
+  // more markers than entries, leaving the journal empty.
+  bool deserialize(const uint8_t* data, size_t len);
+  static uint8_t completedMarker();
+
+ private:
+  Entry entries_[kCapacity] = {};
+  size_t count_ = 0U;
+  size_t completed_ = 0U;
+};
@@ -0,0 +1,314 @@
+#include "story_verify_cache.h"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint32_t kCacheMagic = 0x31435653UL;  // "SVC1"
+constexpr size_t kHeaderBytes = 12U;             // magic, count, reserved
+constexpr size_t kEntryBytes = 4U + 4U + 4U + 1U + StoryVerifyCache::kDigestBytes;
+
+void putU32(uint8_t* out, uint32_t value) {
+  out[0] = static_cast<uint8_t>(value);
+  out[1] = static_cast<uint8_t>(value >> 8U);
+  out[2] = static_cast<uint8_t>(value >> 16U);
+  out[3] = static_cast<uint8_t>(value >> 24U);
+}
+
+uint32_t getU32(const uint8_t* in) {
+  return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8U) |
+         (static_cast<uint32_t>(in[2]) << 16U) | (static_cast<uint32_t>(in[3]) << 24U);
+}
+
+int hexNibble(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return 10 + c - 'a';
+  }
+  if (c >= 'A' && c <= 'F') {
+    return 10 + c - 'A';
+  }
+  return -1;
+}
+
+}  // namespace
+
+uint32_t storyPathHash(const char* path) {
+  uint32_t hash = 2166136261UL;
+  if (path == nullptr) {
+    return hash;
+  }
+  while (*path == '/') {
+    ++path;
+  }
+  for (; *path != '\0'; ++path) {
+    hash = (hash ^ static_cast<uint8_t>(*path)) * 16777619UL;
+  }
+  return hash;
+}
+
+bool storyParseSha256Hex(const char* hex, uint8_t* digest) {
+  if (hex == nullptr || digest == nullptr) {
+    return false;
+  }
+  for (size_t i = 0U; i < StoryVerifyCache::kDigestBytes; ++i) {
+    const int hi = hexNibble(hex[i * 2U]);
+    const int lo = (hi < 0) ? -1 : hexNibble(hex[i * 2U + 1U]);
+    if (lo < 0) {
+      return false;
+    }
+    digest[i] = static_cast<uint8_t>((hi << 4) | lo);
+  }
+  return true;
+}
+
+void storyFormatSha256Hex(const uint8_t* digest, char* out, size_t outLen) {
+  static const char* kHex = "0123456789abcdef";
+  if (out == nullptr || outLen <= StoryVerifyCache::kDigestBytes * 2U) {
+    return;
+  }
+  for (size_t i = 0U; i < StoryVerifyCache::kDigestBytes; ++i) {
+    out[i * 2U] = kHex[(digest[i] >> 4U) & 0x0FU];
+    out[i * 2U + 1U] = kHex[digest[i] & 0x0FU];
+  }
+  out[StoryVerifyCache::kDigestBytes * 2U] = '\0';
+}
+
+void StoryVerifyCache::clear() {
+  memset(entries_, 0, sizeof(entries_));
+  count_ = 0U;
+  nextVictim_ = 0U;
+  dirty_ = false;
+  hits_ = 0U;
+  misses_ = 0U;
+}
+
+StoryVerifyCache::Entry* StoryVerifyCache::find(uint32_t pathHash, StoryDigestKind kind) {
+  for (size_t i = 0U; i < count_; ++i) {
+    if (entries_[i].pathHash == pathHash && entries_[i].kind == static_cast<uint8_t>(kind)) {
+      return &entries_[i];
+    }
+  }
+  return nullptr;
+}
+
+bool StoryVerifyCache::lookup(const char* path,
+                              StoryDigestKind kind,
+                              const StoryFileStamp& stamp,
+                              uint8_t* digest) {
+  const Entry* entry = find(storyPathHash(path), kind);
+  if (entry == nullptr || entry->size != stamp.size || entry->mtime != stamp.mtime) {
+    ++misses_;
+    return false;
+  }
+  if (digest != nullptr) {
+    memcpy(digest, entry->digest, kDigestBytes);
+  }
+  ++hits_;
+  return true;
+}
+
+void StoryVerifyCache::store(const char* path,
+                             StoryDigestKind kind,
+                             const StoryFileStamp& stamp,
+                             const uint8_t* digest) {
+  if (digest == nullptr || kind == StoryDigestKind::kNone) {
+    return;
+  }
+  const uint32_t pathHash = storyPathHash(path);
+  Entry* entry = find(pathHash, kind);
+  if (entry == nullptr) {
+    if (count_ < kCapacity) {
+      entry = &entries_[count_++];
+    } else {
+      // Full: round-robin replacement is enough for a story tree that fits.
+      entry = &entries_[nextVictim_];
+      nextVictim_ = (nextVictim_ + 1U) % kCapacity;
+    }
+  }
+  entry->pathHash = pathHash;
+  entry->size = stamp.size;
+  entry->mtime = stamp.mtime;
+  entry->kind = static_cast<uint8_t>(kind);
+  memcpy(entry->digest, digest, kDigestBytes);
+  dirty_ = true;
+}
+
+void StoryVerifyCache::invalidate(const char* path) {
+  const uint32_t pathHash = storyPathHash(path);
+  size_t index = 0U;
+  while (index < count_) {
+    if (entries_[index].pathHash == pathHash) {
+      entries_[index] = entries_[count_ - 1U];
+      --count_;
+      dirty_ = true;
+      continue;
+    }
+    ++index;
+  }
+  if (nextVictim_ >= count_) {
+    nextVictim_ = 0U;
+  }
+}
+
+size_t StoryVerifyCache::serializedSize() const {
+  return kHeaderBytes + count_ * kEntryBytes;
+}
+
+size_t StoryVerifyCache::serialize(uint8_t* out, size_t capacity) const {
+  const size_t bytes = serializedSize();
+  if (out == nullptr || capacity < bytes) {
+    return 0U;
+  }
+  putU32(out, kCacheMagic);
+  putU32(out + 4U, static_cast<uint32_t>(count_));
+  putU32(out + 8U, static_cast<uint32_t>(kEntryBytes));
+  uint8_t* cursor = out + kHeaderBytes;
+  for (size_t i = 0U; i < count_; ++i) {
+    const Entry& entry = entries_[i];
+    putU32(cursor, entry.pathHash);
+    putU32(cursor + 4U, entry.size);
+    putU32(cursor + 8U, entry.mtime);
+    cursor[12] = entry.kind;
+    memcpy(cursor + 13U, entry.digest, kDigestBytes);
+    cursor += kEntryBytes;
+  }
+  return bytes;
+}
+
+bool StoryVerifyCache::deserialize(const uint8_t* data, size_t len) {
+  clear();
+  if (data == nullptr || len < kHeaderBytes || getU32(data) != kCacheMagic ||
+      getU32(data + 8U) != kEntryBytes) {
+    return false;
+  }
+  const uint32_t count = getU32(data + 4U);
+  if (count > kCapacity || len != kHeaderBytes + count * kEntryBytes) {
+    return false;
+  }
+  const uint8_t* cursor = data + kHeaderBytes;
+  for (uint32_t i = 0U; i < count; ++i) {
+    Entry& entry = entries_[i];
+    entry.pathHash = getU32(cursor);
+    entry.size = getU32(cursor + 4U);
+    entry.mtime = getU32(cursor + 8U);
+    entry.kind = cursor[12];
+    memcpy(entry.digest, cursor + 13U, kDigestBytes);
+    cursor += kEntryBytes;
+  }
+  count_ = count;
+  return true;
+}
+
+bool StoryVerifyCache::dirty() const {
+  return dirty_;
+}
+
+void StoryVerifyCache::markClean() {
+  dirty_ = false;
+}
+
+size_t StoryVerifyCache::count() const {
+  return count_;
+}
+
+uint32_t StoryVerifyCache::hits() const {
+  return hits_;
+}
+
+uint32_t StoryVerifyCache::misses() const {
+  return misses_;
+}
+
+void StoryManifest::clear() {
+  count_ = 0U;
+  rejected_ = 0U;
+  lineLen_ = 0U;
+  lineOverflow_ = false;
+}
+
+bool StoryManifest::parseLine(char* line, uint8_t* digest, const char** path) {
+  *path = nullptr;
+  while (*line == ' ' || *line == '\t') {
+    ++line;
+  }
+  if (*line == '\0' || *line == '#') {
+    return false;
+  }
+  if (strlen(line) < StoryVerifyCache::kDigestBytes * 2U + 2U || !storyParseSha256Hex(line, digest)) {
+    *path = line;
+    return false;
+  }
+  char* name = line + StoryVerifyCache::kDigestBytes * 2U;
+  if (*name != ' ' && *name != '\t') {
+    *path = line;
+    return false;
+  }
+  // sha256sum writes "  name" (text) or " *name" (binary).
+  while (*name == ' ' || *name == '\t' || *name == '*') {
+    ++name;
+  }
+  size_t len = strlen(name);
+  while (len > 0U && (name[len - 1U] == '\r' || name[len - 1U] == ' ')) {
+    name[--len] = '\0';
+  }
+  *path = name;
+  return len > 0U;
+}
+
+void StoryManifest::acceptLine() {
+  line_[lineLen_] = '\0';
+  uint8_t digest[StoryVerifyCache::kDigestBytes] = {};
+  const char* path = nullptr;
+  const bool ok = !lineOverflow_ && parseLine(line_, digest, &path);
+  if (ok && count_ < kCapacity) {
+    Entry& entry = entries_[count_++];
+    entry.pathHash = storyPathHash(path);
+    memcpy(entry.digest, digest, sizeof(digest));
+  } else if (ok || path != nullptr || lineOverflow_) {
+    ++rejected_;
+  }
+  lineLen_ = 0U;
+  lineOverflow_ = false;
+}
+
+void StoryManifest::feed(const char* text, size_t len) {
+  for (size_t i = 0U; i < len; ++i) {
+    const char c = text[i];
+    if (c == '\n') {
+      acceptLine();
+      continue;
+    }
+    if (lineLen_ + 1U < kMaxLine) {
+      line_[lineLen_++] = c;
+    } else {
+      lineOverflow_ = true;
+    }
+  }
+}
+
+void StoryManifest::finish() {
+  if (lineLen_ > 0U || lineOverflow_) {
+    acceptLine();
+  }
+}
+
+const uint8_t* StoryManifest::expected(const char* path) const {
+  const uint32_t pathHash = storyPathHash(path);
+  for (size_t i = 0U; i < count_; ++i) {
+    if (entries_[i].pathHash == pathHash) {
+      return entries_[i].digest;
+    }
+  }
+  return nullptr;
+}
+
+size_t StoryManifest::count() const {
+  return count_;
+}
+
+uint32_t StoryManifest::rejectedLines() const {
+  return rejected_;
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum class StoryDigestKind : uint8_t {
+  kNone = 0,
+  kSha256,
+  kFnv1a32,  // StorageManager::checksum (first 4 bytes, little endian)
+};
+
+// What identifies one version of a file without reading it. `mtime` is
+// File::getLastWrite(); without a wall clock LittleFS stamps seconds since
+// boot, so a same-size rewrite can keep its stamp. StorageManager (Freenove)
+// invalidates every story path it writes; StoryFsManager never writes story
+// files, they only change through uploadfs, which also wipes the cache.
+struct StoryFileStamp {
+  uint32_t size = 0U;
+  uint32_t mtime = 0U;
+};
+
+// Content digests by (path, size, mtime), persisted between boots so an
+// unchanged file is hashed once. The cache says what a file hashes to, not
+// whether that is right: callers still compare with the sidecar/manifest.
+class StoryVerifyCache {
+ public:
+  static constexpr size_t kCapacity = 80U;
+  static constexpr size_t kDigestBytes = 32U;
+
+  void clear();
+  bool lookup(const char* path, StoryDigestKind kind, const StoryFileStamp& stamp, uint8_t* digest);
+  void store(const char* path, StoryDigestKind kind, const StoryFileStamp& stamp, const uint8_t* digest);
+  // Drops every digest of `path` (all kinds).
+  void invalidate(const char* path);
+
+  // Fixed binary image: header then entries. deserialize() rejects other
+  // versions or sizes and leaves the cache empty.
+  size_t serializedSize() const;
+  size_t serialize(uint8_t* out, size_t capacity) const;
+  bool deserialize(const uint8_t* data, size_t len);
+
+  bool dirty() const;
+  void markClean();
+  size_t count() const;
+  uint32_t hits() const;
+  uint32_t misses() const;
+
+ private:
+  struct Entry {
+    uint32_t pathHash;
+    uint32_t size;
+    uint32_t mtime;
+    uint8_t kind;
+    uint8_t digest[kDigestBytes];
+  };
+
+  Entry* find(uint32_t pathHash, StoryDigestKind kind);
+
+  Entry entries_[kCapacity] = {};
+  size_t count_ = 0U;
+  size_t nextVictim_ = 0U;
+  bool dirty_ = false;
+  uint32_t hits_ = 0U;
+  uint32_t misses_ = 0U;
+};
+
+// Bundle manifest in sha256sum format, one "<64 hex>  <path>" per line,
+// paths relative to the FS root ("story/apps/APP_WIFI.json"). Only digests
+// are kept (by path hash); a one-pass bundle check streams the file again.
+class StoryManifest {
+ public:
+  static constexpr size_t kCapacity = 96U;
+  static constexpr size_t kMaxLine = 160U;
+
+  void clear();
+  // Accepts text in arbitrary chunks; finish() flushes a last unterminated line.
+  void feed(const char* text, size_t len);
+  void finish();
+
+  // `path` with or without the leading '/'. nullptr when not listed.
+  const uint8_t* expected(const char* path) const;
+  size_t count() const;
+  uint32_t rejectedLines() const;
+
+  // One manifest line -> digest + path (points into `line`). Blank and '#'
+  // lines return false with *path == nullptr.
+  static bool parseLine(char* line, uint8_t* digest, const char** path);
+
+ private:
+  struct Entry {
+    uint32_t pathHash;
+    uint8_t digest[StoryVerifyCache::kDigestBytes];
+  };
+
+  void acceptLine();
+
+  Entry entries_[kCapacity] = {};
+  size_t count_ = 0U;
+  uint32_t rejected_ = 0U;
+  char line_[kMaxLine] = {};
+  size_t lineLen_ = 0U;
+  bool lineOverflow_ = false;
+};
+
+uint32_t storyPathHash(const char* path);
+// 64 hex chars (case-insensitive) -> 32 bytes.
+bool storyParseSha256Hex(const char* hex, uint8_t* digest);
+void storyFormatSha256Hex(const uint8_t* digest, char* out, size_t outLen);
@@ -1,37 +1,10 @@
 #include "ui_link.h"
 
 #include <cstdio>
-#include <cstdlib>
 #include <cstring>
 
 namespace {
 
-bool parseUint32(const char* text, uint32_t* outValue) {
-  if (text == nullptr || outValue == nullptr || text[0] == '\0') {
-    return false;
-  }
-  char* end = nullptr;
-  const unsigned long parsed = strtoul(text, &end, 10);
-  if (end == nullptr || *end != '\0') {
-    return false;
-  }
-  *outValue = static_cast<uint32_t>(parsed);
-  return true;
-}
-
-bool parseInt32(const char* text, int32_t* outValue) {
-  if (text == nullptr || outValue == nullptr || text[0] == '\0') {
-    return false;
-  }
-  char* end = nullptr;
-  const long parsed = strtol(text, &end, 10);
-  if (end == nullptr || *end != '\0') {
-    return false;
-  }
-  *outValue = static_cast<int32_t>(parsed);
-  return true;
-}
-
 const char* modeToken(const ScreenFrame& frame) {
   if (frame.mp3Mode) {
     return "MP3";
@@ -45,8 +18,59 @@ const char* modeToken(const ScreenFrame& frame) {
   return "SIGNAL";
 }
 
+int32_t modeValue(const ScreenFrame& frame) {
+  if (frame.mp3Mode) {
+    return UILINK_V3_MODE_MP3;
+  }
+  if (frame.uLockMode) {
+    return UILINK_V3_MODE_U_LOCK;
+  }
+  if (frame.uSonFunctional) {
+    return UILINK_V3_MODE_STORY;
+  }
+  return UILINK_V3_MODE_SIGNAL;
+}
+
+void fillStateValues(const ScreenFrame& frame, int32_t* out) {
+  out[UILINK_V3_F_MODE] = modeValue(frame);
+  out[UILINK_V3_F_LA] = frame.laDetected ? 1 : 0;
+  out[UILINK_V3_F_MP3] = frame.mp3Playing ? 1 : 0;
+  out[UILINK_V3_F_SD] = frame.sdReady ? 1 : 0;
+  out[UILINK_V3_F_KEY] = frame.key;
+  out[UILINK_V3_F_TRACK] = frame.track;
+  out[UILINK_V3_F_TRACK_TOTAL] = frame.trackCount;
+  out[UILINK_V3_F_VOL] = frame.volumePercent;
+  out[UILINK_V3_F_U_LOCK] = frame.uLockMode ? 1 : 0;
+  out[UILINK_V3_F_U_SON] = frame.uSonFunctional ? 1 : 0;
+  out[UILINK_V3_F_TUNE_OFF] = frame.tuningOffset;
+  out[UILINK_V3_F_TUNE_CONF] = frame.tuningConfidence;
+  out[UILINK_V3_F_U_LOCK_LISTEN] = frame.uLockListening ? 1 : 0;
+  out[UILINK_V3_F_MIC] = frame.micLevelPercent;
+  out[UILINK_V3_F_HOLD] = frame.unlockHoldPercent;
+  out[UILINK_V3_F_STARTUP] = frame.startupStage;
+  out[UILINK_V3_F_APP] = frame.appStage;
+  out[UILINK_V3_F_UI_PAGE] = frame.uiPage;
+  out[UILINK_V3_F_REPEAT] = frame.repeatMode;
+  out[UILINK_V3_F_FX] = frame.fxActive ? 1 : 0;
+  out[UILINK_V3_F_BACKEND] = frame.backendMode;
+  out[UILINK_V3_F_SCAN] = frame.scanBusy ? 1 : 0;
+  out[UILINK_V3_F_ERR] = frame.errorCode;
+  out[UILINK_V3_F_UI_CURSOR] = frame.uiCursor;
+  out[UILINK_V3_F_UI_OFFSET] = frame.uiOffset;
+  out[UILINK_V3_F_UI_COUNT] = frame.uiCount;
+  out[UILINK_V3_F_QUEUE] = frame.queueCount;
+  out[UILINK_V3_F_MIC_SCOPE] = frame.micScopeEnabled ? 1 : 0;
+}
+
+bool offersV3(const UiLinkView& view) {
+  uint32_t value = 0u;
+  return uiLinkViewU32(&view, UILINK_KEY_PROTO_MAX, &value) && value >= UILINK_V3_PROTO;
+}
+
 constexpr uint32_t kUiDiagBootWindowMs = 20000u;
 constexpr uint16_t kUiDiagLogLimit = 48u;
+// v3 frames are small enough for ~30 Hz telemetry at 57600 baud.
+constexpr uint16_t kV3ChangeMinPeriodMs = 33u;
 
 }  // namespace
 
@@ -87,16 +111,17 @@ void UiLink::diagLogTx(const char* type, size_t lineLen, uint32_t nowMs) {
                 static_cast<unsigned long>(txDropCount_));
 }
 
-void UiLink::diagLogRx(const UiLinkFrame& frame, uint32_t nowMs) {
+void UiLink::diagLogRx(const UiLinkView& view, uint32_t nowMs) {
   if (!diagEnabled(nowMs) || diagRxLogCount_ >= kUiDiagLogLimit) {
     return;
   }
   ++diagRxLogCount_;
-  Serial.printf("[UI_DIAG][ESP32][RX] ms=%lu type=%s fields=%u crc=%u rx=%lu\n",
+  Serial.printf("[UI_DIAG][ESP32][RX] ms=%lu type=%.*s fields=%u crc=%u rx=%lu\n",
                 static_cast<unsigned long>(nowMs),
-                frame.type_token,
-                static_cast<unsigned int>(frame.field_count),
-                frame.crc_ok ? 1u : 0u,
+                static_cast<int>(view.type_token.len),
+                view.line + view.type_token.off,
+                static_cast<unsigned int>(view.field_count),
+                view.crc_ok ? 1u : 0u,
                 static_cast<unsigned long>(rxFrameCount_));
 }
 
@@ -138,6 +163,11 @@ void UiLink::begin() {
   lastRxMs_ = 0u;
   rxLineLen_ = 0u;
   dropCurrentLine_ = false;
+  peerOffersV3_ = false;
+  v3Active_ = false;
+  hasAckedKeyframe_ = false;
+  keyframeInFlight_ = false;
+  uiLinkV3RxReset(&rxFrame_);
   diagStartMs_ = millis();
   diagTxLogCount_ = 0u;
   diagRxLogCount_ = 0u;
@@ -168,14 +198,13 @@ bool UiLink::consumeInputEvent(UiLinkInputEvent* event) {
   return true;
 }
 
-bool UiLink::handleIncomingFrame(const UiLinkFrame& frame, uint32_t nowMs) {
+bool UiLink::handleIncomingFrame(const UiLinkView& view, uint32_t nowMs) {
   ++rxFrameCount_;
 
-  switch (frame.type) {
+  switch (view.type) {
     case UILINK_MSG_HELLO: {
-      const UiLinkField* proto = uiLinkFindField(&frame, "proto");
-      if (proto == nullptr || strcmp(proto->value, "2") != 0) {
-        diagLogError("hello_proto", frame.type_token, nowMs);
+      if (!uiLinkViewEquals(&view, UILINK_KEY_PROTO, "2")) {
+        diagLogError("hello_proto", "HELLO", nowMs);
         return false;
       }
       connected_ = true;
@@ -183,11 +212,25 @@ bool UiLink::handleIncomingFrame(const UiLinkFrame& frame, uint32_t nowMs) {
       ++sessionCounter_;
       ackPending_ = true;
       forceKeyframePending_ = true;
-      Serial.printf("[UI_DIAG][ESP32][HELLO] ms=%lu session=%lu ack_pending=1\n",
+      // Text until the ACK is out; the ACK announces the protocol both sides use.
+      v3Active_ = false;
+      peerOffersV3_ = offersV3(view);
+      Serial.printf("[UI_DIAG][ESP32][HELLO] ms=%lu session=%lu ack_pending=1 proto=%u\n",
                     static_cast<unsigned long>(nowMs),
-                    static_cast<unsigned long>(sessionCounter_));
+                    static_cast<unsigned long>(sessionCounter_),
+                    peerOffersV3_ ? static_cast<unsigned int>(UILINK_V3_PROTO)
+                                  : static_cast<unsigned int>(UILINK_V2_PROTO));
       return true;
     }
+    case UILINK_MSG_CAPS:
+      connected_ = true;
+      lastRxMs_ = nowMs;
+      if (!peerOffersV3_ && offersV3(view)) {
+        peerOffersV3_ = true;
+        ackPending_ = true;
+        forceKeyframePending_ = true;
+      }
+      return true;
     case UILINK_MSG_PONG:
       connected_ = true;
       lastRxMs_ = nowMs;
@@ -202,25 +245,27 @@ bool UiLink::handleIncomingFrame(const UiLinkFrame& frame, uint32_t nowMs) {
       connected_ = true;
       lastRxMs_ = nowMs;
 
-      const UiLinkField* idField = uiLinkFindField(&frame, "id");
-      const UiLinkField* actionField = uiLinkFindField(&frame, "action");
-      if (idField == nullptr || actionField == nullptr) {
+      UiLinkSlice idSlice = {};
+      UiLinkSlice actionSlice = {};
+      char idToken[UILINK_V2_KEY_MAX] = {};
+      char actionToken[UILINK_V2_KEY_MAX] = {};
+      if (!uiLinkViewFind(&view, UILINK_KEY_ID, &idSlice) ||
+          !uiLinkViewFind(&view, UILINK_KEY_ACTION, &actionSlice) ||
+          !uiLinkViewCopy(&view, idSlice, idToken, sizeof(idToken)) ||
+          !uiLinkViewCopy(&view, actionSlice, actionToken, sizeof(actionToken))) {
         return false;
       }
 
       UiLinkInputEvent event = {};
       event.type = UiLinkInputType::kButton;
-      event.btnId = uiBtnIdFromToken(idField->value);
-      event.btnAction = uiBtnActionFromToken(actionField->value);
+      event.btnId = uiBtnIdFromToken(idToken);
+      event.btnAction = uiBtnActionFromToken(actionToken);
       if (event.btnId == UI_BTN_UNKNOWN || event.btnAction == UI_BTN_ACTION_UNKNOWN) {
         return false;
       }
 
-      const UiLinkField* tsField = uiLinkFindField(&frame, "ts");
       uint32_t ts = nowMs;
-      if (tsField != nullptr) {
-        parseUint32(tsField->value, &ts);
-      }
+      uiLinkViewU32(&view, UILINK_KEY_TS, &ts);
       event.tsMs = ts;
       return enqueueInput(event);
     }
@@ -228,43 +273,38 @@ bool UiLink::handleIncomingFrame(const UiLinkFrame& frame, uint32_t nowMs) {
       connected_ = true;
       lastRxMs_ = nowMs;
 
-      const UiLinkField* xField = uiLinkFindField(&frame, "x");
-      const UiLinkField* yField = uiLinkFindField(&frame, "y");
-      const UiLinkField* actionField = uiLinkFindField(&frame, "action");
-      if (xField == nullptr || yField == nullptr || actionField == nullptr) {
+      UiLinkSlice actionSlice = {};
+      char actionToken[UILINK_V2_KEY_MAX] = {};
+      if (!uiLinkViewFind(&view, UILINK_KEY_ACTION, &actionSlice) ||
+          !uiLinkViewCopy(&view, actionSlice, actionToken, sizeof(actionToken))) {
         return false;
       }
 
       int32_t x = 0;
       int32_t y = 0;
-      if (!parseInt32(xField->value, &x) || !parseInt32(yField->value, &y)) {
+      if (!uiLinkViewI32(&view, UILINK_KEY_X, &x) || !uiLinkViewI32(&view, UILINK_KEY_Y, &y)) {
         return false;
       }
 
       UiLinkInputEvent event = {};
       event.type = UiLinkInputType::kTouch;
-      event.touchAction = uiTouchActionFromToken(actionField->value);
+      event.touchAction = uiTouchActionFromToken(actionToken);
       event.x = static_cast<int16_t>(x);
       event.y = static_cast<int16_t>(y);
 
-      const UiLinkField* tsField = uiLinkFindField(&frame, "ts");
       uint32_t ts = nowMs;
-      if (tsField != nullptr) {
-        parseUint32(tsField->value, &ts);
-      }
+      uiLinkViewU32(&view, UILINK_KEY_TS, &ts);
       event.tsMs = ts;
       return enqueueInput(event);
     }
     case UILINK_MSG_CMD: {
       connected_ = true;
       lastRxMs_ = nowMs;
-      const UiLinkField* op = uiLinkFindField(&frame, "op");
-      if (op != nullptr && strcmp(op->value, "request_keyframe") == 0) {
+      if (uiLinkViewEquals(&view, UILINK_KEY_OP, "request_keyframe")) {
         forceKeyframePending_ = true;
       }
       return true;
     }
-    case UILINK_MSG_CAPS:
     case UILINK_MSG_PING:
     case UILINK_MSG_ACK:
     case UILINK_MSG_STAT:
@@ -278,7 +318,11 @@ bool UiLink::handleIncomingFrame(const UiLinkFrame& frame, uint32_t nowMs) {
 bool UiLink::sendAck() {
   UiLinkField fields[3] = {};
   snprintf(fields[0].key, sizeof(fields[0].key), "proto");
-  snprintf(fields[0].value, sizeof(fields[0].value), "%u", static_cast<unsigned int>(UILINK_V2_PROTO));
+  snprintf(fields[0].value,
+           sizeof(fields[0].value),
+           "%u",
+           peerOffersV3_ ? static_cast<unsigned int>(UILINK_V3_PROTO)
+                         : static_cast<unsigned int>(UILINK_V2_PROTO));
   snprintf(fields[1].key, sizeof(fields[1].key), "session");
   snprintf(fields[1].value, sizeof(fields[1].value), "%lu", static_cast<unsigned long>(sessionCounter_));
 
@@ -287,38 +331,30 @@ bool UiLink::sendAck() {
   if (lineLen == 0u) {
     return false;
   }
-
-  const int available = serial_.availableForWrite();
-  if (available >= 0 && static_cast<size_t>(available) < lineLen) {
-    ++txDropCount_;
-  }
-  serial_.write(reinterpret_cast<const uint8_t*>(line), lineLen);
-  lastTxMs_ = millis();
-  ++txFrameCount_;
-  diagLogTx("ACK", lineLen, lastTxMs_);
-  return true;
+  return writeFrame(reinterpret_cast<const uint8_t*>(line), lineLen, "ACK", millis());
 }
 
 bool UiLink::sendPing(uint32_t nowMs) {
+  if (v3Active_) {
+    UiLinkV3Msg msg;
+    uiLinkV3InitMsg(&msg, UILINK_V3_MSG_PING, 0u, 0u, nowMs);
+    if (!sendBinary(msg, "PING3", nowMs)) {
+      return false;
+    }
+    ++pingTxCount_;
+    return true;
+  }
+
   UiLinkField fields[1] = {};
   snprintf(fields[0].key, sizeof(fields[0].key), "ms");
   snprintf(fields[0].value, sizeof(fields[0].value), "%lu", static_cast<unsigned long>(nowMs));
 
   char line[UILINK_V2_MAX_LINE + 1u] = {};
   const size_t lineLen = uiLinkBuildLine(line, sizeof(line), "PING", fields, 1u);
-  if (lineLen == 0u) {
+  if (lineLen == 0u || !writeFrame(reinterpret_cast<const uint8_t*>(line), lineLen, "PING", nowMs)) {
     return false;
   }
-
-  const int available = serial_.availableForWrite();
-  if (available >= 0 && static_cast<size_t>(available) < lineLen) {
-    ++txDropCount_;
-  }
-  serial_.write(reinterpret_cast<const uint8_t*>(line), lineLen);
-  lastTxMs_ = nowMs;
-  ++txFrameCount_;
   ++pingTxCount_;
-  diagLogTx("PING", lineLen, nowMs);
   return true;
 }
 
@@ -376,18 +412,183 @@ bool UiLink::sendStateFrame(const ScreenFrame& frame, bool keyframe) {
   if (lineLen == 0u) {
     return false;
   }
+  return writeFrame(reinterpret_cast<const uint8_t*>(line), lineLen, type, frame.nowMs);
+}
+
+bool UiLink::sendStateV3(const ScreenFrame& frame,
+                         const int32_t* values,
+                         bool changed,
+                         bool due,
+                         uint32_t elapsedMs,
+                         bool forceKeyframe) {
+  const uint32_t sinceKeyframeMs = frame.nowMs - lastKeyframeMs_;
+  bool keyframe = forceKeyframe || forceKeyframePending_;
+  if (!keyframe) {
+    keyframe = keyframeInFlight_ ? (sinceKeyframeMs >= UILINK_V3_KEYFRAME_RETRY_MS)
+                                 : (!hasAckedKeyframe_ || sinceKeyframeMs >= UILINK_V3_KEYFRAME_PERIOD_MS);
+  }
+
+  UiLinkV3Msg msg;
+  if (!keyframe) {
+    if (!hasAckedKeyframe_) {
+      return false;
+    }
+    const uint16_t minPeriodMs =
+        (changeMinPeriodMs_ < kV3ChangeMinPeriodMs) ? changeMinPeriodMs_ : kV3ChangeMinPeriodMs;
+    if (!changed && !due) {
+      return false;
+    }
+    if (hasState_ && !due && elapsedMs < minPeriodMs) {
+      return false;
+    }
+    uiLinkV3InitMsg(&msg, UILINK_V3_MSG_STAT, ackedKeyframeId_, frame.sequence, frame.nowMs);
+    // A delta touching most fields costs as much as a keyframe and moves the base forward.
+    keyframe = uiLinkV3AddStateItems(&msg, values, ackedValues_) > (UILINK_V3_F_COUNT / 2u);
+  }
+
+  if (keyframe) {
+    ++keyframeId_;
+    uiLinkV3InitMsg(&msg, UILINK_V3_MSG_KEYFRAME, keyframeId_, frame.sequence, frame.nowMs);
+    uiLinkV3AddStateItems(&msg, values, nullptr);
+  }
+  if (!sendBinary(msg, keyframe ? "KEYFRAME3" : "STAT3", frame.nowMs)) {
+    return false;
+  }
+  if (keyframe) {
+    memcpy(keyframeValues_, values, sizeof(keyframeValues_));
+    keyframeInFlight_ = true;
+    lastKeyframeMs_ = frame.nowMs;
+    forceKeyframePending_ = false;
+  }
+  return true;
+}
 
+bool UiLink::writeFrame(const uint8_t* data, size_t len, const char* type, uint32_t nowMs) {
   const int available = serial_.availableForWrite();
-  if (available >= 0 && static_cast<size_t>(available) < lineLen) {
+  if (available >= 0 && static_cast<size_t>(available) < len) {
     ++txDropCount_;
   }
-  serial_.write(reinterpret_cast<const uint8_t*>(line), lineLen);
-  lastTxMs_ = frame.nowMs;
+  serial_.write(data, len);
+  lastTxMs_ = nowMs;
   ++txFrameCount_;
-  diagLogTx(type, lineLen, frame.nowMs);
+  diagLogTx(type, len, nowMs);
   return true;
 }
 
+bool UiLink::sendBinary(const UiLinkV3Msg& msg, const char* type, uint32_t nowMs) {
+  uint8_t encoded[UILINK_V3_MAX_FRAME];
+  const size_t len = uiLinkV3Encode(&msg, encoded, sizeof(encoded));
+  if (len == 0u) {
+    return false;
+  }
+  return writeFrame(encoded, len, type, nowMs);
+}
+
+void UiLink::enterV3() {
+  v3Active_ = true;
+  hasAckedKeyframe_ = false;
+  keyframeInFlight_ = false;
+  forceKeyframePending_ = true;
+  uiLinkV3RxReset(&rxFrame_);
+}
+
+bool UiLink::handleBinaryFrame(const uint8_t* data, size_t len, uint32_t nowMs) {
+  UiLinkV3Msg msg;
+  const UiLinkV3DecodeResult result = uiLinkV3Decode(data, len, &msg);
+  if (result == UILINK_V3_DECODE_ERR_CRC) {
+    ++crcErrorCount_;
+    diagLogError("crc_v3", "", nowMs);
+    return false;
+  }
+  if (result != UILINK_V3_DECODE_OK) {
+    ++parseErrorCount_;
+    diagLogError("parse_v3", "", nowMs);
+    return false;
+  }
+
+  ++rxFrameCount_;
+  connected_ = true;
+  lastRxMs_ = nowMs;
+  switch (msg.type) {
+    case UILINK_V3_MSG_KEYFRAME_ACK:
+      // Acks for older keyframes are stale: the base only moves to the latest one.
+      if (keyframeInFlight_ && msg.ref == keyframeId_) {
+        memcpy(ackedValues_, keyframeValues_, sizeof(ackedValues_));
+        ackedKeyframeId_ = msg.ref;
+        hasAckedKeyframe_ = true;
+        keyframeInFlight_ = false;
+      }
+      return true;
+    case UILINK_V3_MSG_PONG:
+      ++pongRxCount_;
+      return true;
+    case UILINK_V3_MSG_BTN: {
+      const int32_t* id = uiLinkV3FindItem(&msg, UILINK_V3_IN_BTN_ID);
+      const int32_t* action = uiLinkV3FindItem(&msg, UILINK_V3_IN_BTN_ACTION);
+      if (id == nullptr || action == nullptr || *id <= UI_BTN_UNKNOWN || *id > UI_BTN_MODE ||
+          *action <= UI_BTN_ACTION_UNKNOWN || *action > UI_BTN_ACTION_LONG) {
+        return false;
+      }
+      UiLinkInputEvent event = {};
+      event.type = UiLinkInputType::kButton;
+      event.btnId = static_cast<UiBtnId>(*id);
+      event.btnAction = static_cast<UiBtnAction>(*action);
+      event.tsMs = msg.ms;
+      return enqueueInput(event);
+    }
+    case UILINK_V3_MSG_TOUCH: {
+      const int32_t* x = uiLinkV3FindItem(&msg, UILINK_V3_IN_TOUCH_X);
+      const int32_t* y = uiLinkV3FindItem(&msg, UILINK_V3_IN_TOUCH_Y);
+      const int32_t* action = uiLinkV3FindItem(&msg, UILINK_V3_IN_TOUCH_ACTION);
+      if (x == nullptr || y == nullptr || action == nullptr) {
+        return false;
+      }
+      UiLinkInputEvent event = {};
+      event.type = UiLinkInputType::kTouch;
+      event.touchAction = (*action > UI_TOUCH_ACTION_UNKNOWN && *action <= UI_TOUCH_ACTION_UP)
+                              ? static_cast<UiTouchAction>(*action)
+                              : UI_TOUCH_ACTION_UNKNOWN;
+      event.x = static_cast<int16_t>(*x);
+      event.y = static_cast<int16_t>(*y);
+      event.tsMs = msg.ms;
+      return enqueueInput(event);
+    }
+    case UILINK_V3_MSG_CMD: {
+      const int32_t* op = uiLinkV3FindItem(&msg, UILINK_V3_IN_CMD_OP);
+      if (op != nullptr && *op == UILINK_V3_CMD_REQUEST_KEYFRAME) {
+        forceKeyframePending_ = true;
+      }
+      return true;
+    }
+    default:
+      ++parseErrorCount_;
+      return false;
+  }
+}
+
+void UiLink::pollBinaryByte(uint8_t byte, uint32_t nowMs) {
+  const size_t frameLen = uiLinkV3RxPush(&rxFrame_, byte);
+  if (frameLen > 0u) {
+    handleBinaryFrame(rxFrame_.buf, frameLen, nowMs);
+    return;
+  }
+  // A rebooted UI talks text again: accept its HELLO line to renegotiate.
+  static const char kHelloPrefix[] = "HELLO,";
+  const size_t prefixLen = sizeof(kHelloPrefix) - 1u;
+  if (byte != '\n' || rxFrame_.len <= prefixLen || rxFrame_.len > UILINK_V2_MAX_LINE ||
+      memcmp(rxFrame_.buf, kHelloPrefix, prefixLen) != 0) {
+    return;
+  }
+  UiLinkView view;
+  const bool parsed =
+      uiLinkViewScan(reinterpret_cast<const char*>(rxFrame_.buf), rxFrame_.len, &view);
+  if (parsed) {
+    diagLogRx(view, nowMs);
+    handleIncomingFrame(view, nowMs);
+  }
+  uiLinkV3RxReset(&rxFrame_);
+}
+
 void UiLink::poll(uint32_t nowMs) {
   while (serial_.available() > 0) {
     const int raw = serial_.read();
@@ -395,6 +596,11 @@ void UiLink::poll(uint32_t nowMs) {
       break;
     }
 
+    if (v3Active_) {
+      pollBinaryByte(static_cast<uint8_t>(raw), nowMs);
+      continue;
+    }
+
     const char c = static_cast<char>(raw);
     if (c == '\r') {
       continue;
@@ -402,15 +608,15 @@ void UiLink::poll(uint32_t nowMs) {
     if (c == '\n') {
       if (!dropCurrentLine_ && rxLineLen_ > 0u) {
         rxLine_[rxLineLen_] = '\0';
-        UiLinkFrame frame = {};
-        if (uiLinkParseLine(rxLine_, &frame)) {
-          diagLogRx(frame, nowMs);
-          if (!handleIncomingFrame(frame, nowMs)) {
+        UiLinkView view;
+        if (uiLinkViewScan(rxLine_, rxLineLen_, &view)) {
+          diagLogRx(view, nowMs);
+          if (!handleIncomingFrame(view, nowMs)) {
             ++parseErrorCount_;
             diagLogError("frame_handler", rxLine_, nowMs);
           }
         } else {
-          if (strchr(rxLine_, '*') != nullptr) {
+          if (view.has_crc && !view.crc_ok) {
             ++crcErrorCount_;
             diagLogError("crc", rxLine_, nowMs);
           } else {
@@ -438,6 +644,9 @@ void UiLink::poll(uint32_t nowMs) {
   if (ackPending_) {
     if (sendAck()) {
       ackPending_ = false;
+      if (peerOffersV3_) {
+        enterV3();
+      }
     }
   }
 
@@ -457,76 +666,44 @@ void UiLink::poll(uint32_t nowMs) {
                     static_cast<unsigned long>(nowMs - lastRxMs_));
     }
     connected_ = false;
+    // Both ends fall back to text; the UI renegotiates with a new HELLO.
+    v3Active_ = false;
+    peerOffersV3_ = false;
+    rxLineLen_ = 0u;
+    dropCurrentLine_ = false;
   }
 }
 
 bool UiLink::update(const ScreenFrame& frame, bool forceKeyframe) {
-  const bool changed = !hasState_ || frame.laDetected != lastLa_ || frame.mp3Playing != lastMp3_ ||
-                       frame.sdReady != lastSd_ || frame.mp3Mode != lastMp3Mode_ || frame.key != lastKey_ ||
-                       frame.track != lastTrack_ || frame.trackCount != lastTrackCount_ ||
-                       frame.volumePercent != lastVolumePercent_ ||
-                       frame.micLevelPercent != lastMicLevelPercent_ ||
-                       frame.uLockMode != lastULockMode_ || frame.uLockListening != lastULockListening_ ||
-                       frame.uSonFunctional != lastUSonFunctional_ ||
-                       frame.tuningOffset != lastTuningOffset_ ||
-                       frame.tuningConfidence != lastTuningConfidence_ ||
-                       frame.micScopeEnabled != lastMicScopeEnabled_ ||
-                       frame.unlockHoldPercent != lastUnlockHoldPercent_ ||
-                       frame.startupStage != lastStartupStage_ || frame.appStage != lastAppStage_ ||
-                       frame.uiPage != lastUiPage_ || frame.uiCursor != lastUiCursor_ ||
-                       frame.uiOffset != lastUiOffset_ || frame.uiCount != lastUiCount_ ||
-                       frame.queueCount != lastQueueCount_ || frame.repeatMode != lastRepeatMode_ ||
-                       frame.fxActive != lastFxActive_ || frame.backendMode != lastBackendMode_ ||
-                       frame.scanBusy != lastScanBusy_ || frame.errorCode != lastErrorCode_;
+  int32_t values[UILINK_V3_F_COUNT];
+  fillStateValues(frame, values);
+  const bool changed = !hasState_ || memcmp(values, lastValues_, sizeof(values)) != 0;
 
   const uint32_t elapsedMs = frame.nowMs - lastTxMs_;
   const bool due = elapsedMs >= updatePeriodMs_;
-  bool keyframe = forceKeyframe || forceKeyframePending_;
-
-  if (!keyframe && !changed && !due) {
-    return false;
-  }
-  if (!keyframe && hasState_ && !due && elapsedMs < changeMinPeriodMs_) {
-    return false;
-  }
 
-  if (!sendStateFrame(frame, keyframe)) {
-    return false;
+  if (v3Active_) {
+    if (!sendStateV3(frame, values, changed, due, elapsedMs, forceKeyframe)) {
+      return false;
+    }
+  } else {
+    bool keyframe = forceKeyframe || forceKeyframePending_;
+    if (!keyframe && !changed && !due) {
+      return false;
+    }
+    if (!keyframe && hasState_ && !due && elapsedMs < changeMinPeriodMs_) {
+      return false;
+    }
+    if (!sendStateFrame(frame, keyframe)) {
+      return false;
+    }
+    if (keyframe) {
+      forceKeyframePending_ = false;
+    }
   }
 
   hasState_ = true;
-  lastLa_ = frame.laDetected;
-  lastMp3_ = frame.mp3Playing;
-  lastSd_ = frame.sdReady;
-  lastMp3Mode_ = frame.mp3Mode;
-  lastULockMode_ = frame.uLockMode;
-  lastULockListening_ = frame.uLockListening;
-  lastUSonFunctional_ = frame.uSonFunctional;
-  lastKey_ = frame.key;
-  lastTrack_ = frame.track;
-  lastTrackCount_ = frame.trackCount;
-  lastVolumePercent_ = frame.volumePercent;
-  lastMicLevelPercent_ = frame.micLevelPercent;
-  lastTuningOffset_ = frame.tuningOffset;
-  lastTuningConfidence_ = frame.tuningConfidence;
-  lastMicScopeEnabled_ = frame.micScopeEnabled;
-  lastUnlockHoldPercent_ = frame.unlockHoldPercent;
-  lastStartupStage_ = frame.startupStage;
-  lastAppStage_ = frame.appStage;
-  lastUiPage_ = frame.uiPage;
-  lastUiCursor_ = frame.uiCursor;
-  lastUiOffset_ = frame.uiOffset;
-  lastUiCount_ = frame.uiCount;
-  lastQueueCount_ = frame.queueCount;
-  lastRepeatMode_ = frame.repeatMode;
-  lastFxActive_ = frame.fxActive;
-  lastBackendMode_ = frame.backendMode;
-  lastScanBusy_ = frame.scanBusy;
-  lastErrorCode_ = frame.errorCode;
-
-  if (keyframe) {
-    forceKeyframePending_ = false;
-  }
+  memcpy(lastValues_, values, sizeof(lastValues_));
   return true;
 }
 
@@ -594,3 +771,7 @@ uint32_t UiLink::lastPingMs() const {
 uint32_t UiLink::sessionCounter() const {
   return sessionCounter_;
 }
+
+uint8_t UiLink::protocolVersion() const {
+  return v3Active_ ? static_cast<uint8_t>(UILINK_V3_PROTO) : static_cast<uint8_t>(UILINK_V2_PROTO);
+}
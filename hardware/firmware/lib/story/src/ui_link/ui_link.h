@@ -4,6 +4,7 @@
 
 #include "../screen/screen_frame.h"
 #include "ui_link_v2.h"
+#include "ui_link_v3.h"
 
 enum class UiLinkInputType : uint8_t {
   kButton = 0,
@@ -51,17 +52,30 @@ class UiLink {
   bool ackPending() const;
   uint32_t lastPingMs() const;
   uint32_t sessionCounter() const;
+  // 3 once a v3 peer has been acked, 2 otherwise.
+  uint8_t protocolVersion() const;
 
  private:
   bool diagEnabled(uint32_t nowMs) const;
   void diagLogTx(const char* type, size_t lineLen, uint32_t nowMs);
-  void diagLogRx(const UiLinkFrame& frame, uint32_t nowMs);
+  void diagLogRx(const UiLinkView& view, uint32_t nowMs);
   void diagLogError(const char* reason, const char* line, uint32_t nowMs);
   bool enqueueInput(const UiLinkInputEvent& event);
-  bool handleIncomingFrame(const UiLinkFrame& frame, uint32_t nowMs);
+  bool handleIncomingFrame(const UiLinkView& view, uint32_t nowMs);
+  void pollBinaryByte(uint8_t byte, uint32_t nowMs);
+  bool handleBinaryFrame(const uint8_t* data, size_t len, uint32_t nowMs);
+  void enterV3();
+  bool writeFrame(const uint8_t* data, size_t len, const char* type, uint32_t nowMs);
+  bool sendBinary(const UiLinkV3Msg& msg, const char* type, uint32_t nowMs);
   bool sendAck();
   bool sendPing(uint32_t nowMs);
   bool sendStateFrame(const ScreenFrame& frame, bool keyframe);
+  bool sendStateV3(const ScreenFrame& frame,
+                   const int32_t* values,
+                   bool changed,
+                   bool due,
+                   uint32_t elapsedMs,
+                   bool forceKeyframe);
 
   HardwareSerial& serial_;
   uint8_t rxPin_;
@@ -81,35 +95,21 @@ class UiLink {
   uint16_t rxLineLen_ = 0u;
   bool dropCurrentLine_ = false;
 
+  // State values by UiLinkV3Field; shared by v2 change detection and v3 deltas.
+  int32_t lastValues_[UILINK_V3_F_COUNT] = {};
   bool hasState_ = false;
-  bool lastLa_ = false;
-  bool lastMp3_ = false;
-  bool lastSd_ = false;
-  bool lastMp3Mode_ = false;
-  bool lastULockMode_ = false;
-  bool lastULockListening_ = false;
-  bool lastUSonFunctional_ = false;
-  uint8_t lastKey_ = 0;
-  uint16_t lastTrack_ = 0;
-  uint16_t lastTrackCount_ = 0;
-  uint8_t lastVolumePercent_ = 0;
-  uint8_t lastMicLevelPercent_ = 0;
-  int8_t lastTuningOffset_ = 0;
-  uint8_t lastTuningConfidence_ = 0;
-  bool lastMicScopeEnabled_ = false;
-  uint8_t lastUnlockHoldPercent_ = 0;
-  uint8_t lastStartupStage_ = 0;
-  uint8_t lastAppStage_ = 0;
-  uint8_t lastUiPage_ = 0;
-  uint16_t lastUiCursor_ = 0;
-  uint16_t lastUiOffset_ = 0;
-  uint16_t lastUiCount_ = 0;
-  uint16_t lastQueueCount_ = 0;
-  uint8_t lastRepeatMode_ = 0;
-  bool lastFxActive_ = false;
-  uint8_t lastBackendMode_ = 0;
-  bool lastScanBusy_ = false;
-  uint8_t lastErrorCode_ = 0;
+
+  // v3 session: binary after ACK,proto=3; STAT deltas against the last acked keyframe.
+  bool peerOffersV3_ = false;
+  bool v3Active_ = false;
+  UiLinkV3Rx rxFrame_ = {};
+  uint8_t keyframeId_ = 0u;
+  int32_t keyframeValues_[UILINK_V3_F_COUNT] = {};
+  bool keyframeInFlight_ = false;
+  uint32_t lastKeyframeMs_ = 0u;
+  uint8_t ackedKeyframeId_ = 0u;
+  int32_t ackedValues_[UILINK_V3_F_COUNT] = {};
+  bool hasAckedKeyframe_ = false;
 
   uint32_t lastTxMs_ = 0u;
   uint32_t lastRxMs_ = 0u;
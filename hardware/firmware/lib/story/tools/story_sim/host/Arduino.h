@@ -0,0 +1,89 @@
+// Thin Arduino shim for host builds of the story core (story_sim).
+// Only what StoryEngineV2 / scenario_def / generated scenarios and UiLink
+// (host tests) touch.
+#pragma once
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+class HostSerial {
+ public:
+  // Off by default: the engine logs every transition and drop.
+  bool echo = false;
+
+  int printf(const char* format, ...) {
+    if (!echo) {
+      return 0;
+    }
+    va_list args;
+    va_start(args, format);
+    const int written = vfprintf(stdout, format, args);
+    va_end(args);
+    return written;
+  }
+
+  size_t print(const char* text) {
+    return echo ? static_cast<size_t>(fputs(text, stdout)) : 0U;
+  }
+
+  size_t println(const char* text = "") {
+    if (!echo) {
+      return 0U;
+    }
+    fputs(text, stdout);
+    fputc('\n', stdout);
+    return strlen(text) + 1U;
+  }
+};
+
+inline HostSerial Serial;
+
+#define SERIAL_8N1 0x800001cU
+
+// UART stand-in: tests append to `rx` what the peer sends and read what the
+// code wrote from `tx`.
+class HardwareSerial {
+ public:
+  std::string rx;
+  std::string tx;
+
+  void setRxBufferSize(size_t) {}
+  void begin(uint32_t, uint32_t, int8_t, int8_t) {}
+  void flush() {}
+
+  int available() const {
+    return static_cast<int>(rx.size() - rxPos_);
+  }
+
+  int read() {
+    if (rxPos_ >= rx.size()) {
+      return -1;
+    }
+    const int byte = static_cast<uint8_t>(rx[rxPos_++]);
+    if (rxPos_ == rx.size()) {
+      rx.clear();
+      rxPos_ = 0U;
+    }
+    return byte;
+  }
+
+  int availableForWrite() const {
+    return -1;
+  }
+
+  size_t write(const uint8_t* data, size_t len) {
+    tx.append(reinterpret_cast<const char*>(data), len);
+    return len;
+  }
+
+ private:
+  size_t rxPos_ = 0U;
+};
+
+inline void delay(uint32_t) {}
+
+uint32_t millis();
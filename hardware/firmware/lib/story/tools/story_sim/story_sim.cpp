@@ -0,0 +1,607 @@
+// Host simulator for StoryEngineV2: loads a scenario (built-in/generated or
+// a /story JSON file), replays a timestamped event trace against the real
+// engine and reports transitions, drops and throughput.
+// Build/run: make story-sim-host (from hardware/firmware)
+#include <Arduino.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/story_engine_v2.h"
+#include "scenarios/default_scenario_v2.h"
+
+namespace {
+
+uint32_t g_nowMs = 0U;
+
+// --- Minimal JSON reader (enough for /story scenario files) -----------------
+
+struct JsonValue {
+  enum class Kind { kNull, kBool, kNumber, kString, kArray, kObject };
+  Kind kind = Kind::kNull;
+  bool boolean = false;
+  double number = 0.0;
+  std::string text;
+  std::vector<JsonValue> items;
+  std::vector<std::pair<std::string, JsonValue>> members;
+
+  const JsonValue* get(const char* key) const {
+    for (const auto& member : members) {
+      if (member.first == key) {
+        return &member.second;
+      }
+    }
+    return nullptr;
+  }
+
+  const char* str(const char* key, const char* fallback = "") const {
+    const JsonValue* value = get(key);
+    return (value != nullptr && value->kind == Kind::kString) ? value->text.c_str() : fallback;
+  }
+
+  double num(const char* key, double fallback = 0.0) const {
+    const JsonValue* value = get(key);
+    return (value != nullptr && value->kind == Kind::kNumber) ? value->number : fallback;
+  }
+
+  bool flag(const char* key) const {
+    const JsonValue* value = get(key);
+    return value != nullptr && value->kind == Kind::kBool && value->boolean;
+  }
+};
+
+class JsonParser {
+ public:
+  explicit JsonParser(const std::string& input) : in_(input) {}
+
+  bool parse(JsonValue* out) {
+    skipSpace();
+    if (!parseValue(out)) {
+      return false;
+    }
+    skipSpace();
+    return pos_ == in_.size();
+  }
+
+  size_t offset() const { return pos_; }
+
+ private:
+  void skipSpace() {
+    while (pos_ < in_.size() && (in_[pos_] == ' ' || in_[pos_] == '\n' || in_[pos_] == '\r' || in_[pos_] == '\t')) {
+      ++pos_;
+    }
+  }
+
+  bool consume(const char* literal) {
+    const size_t len = strlen(literal);
+    if (in_.compare(pos_, len, literal) != 0) {
+      return false;
+    }
+    pos_ += len;
+    return true;
+  }
+
+  bool parseString(std::string* out) {
+    if (pos_ >= in_.size() || in_[pos_] != '"') {
+      return false;
+    }
+    ++pos_;
+    while (pos_ < in_.size() && in_[pos_] != '"') {
+      char c = in_[pos_++];
+      if (c == '\\' && pos_ < in_.size()) {
+        const char esc = in_[pos_++];
+        switch (esc) {
+          case 'n': c = '\n'; break;
+          case 't': c = '\t'; break;
+          case 'r': c = '\r'; break;
+          case 'b': c = '\b'; break;
+          case 'f': c = '\f'; break;
+          case 'u':
+            // Scenario ids are ASCII; anything else is kept as a placeholder.
+            if (pos_ + 4U > in_.size()) {
+              return false;
+            }
+            c = static_cast<char>(strtol(in_.substr(pos_, 4U).c_str(), nullptr, 16));
+            if (static_cast<unsigned char>(c) > 0x7FU || c == '\0') {
+              c = '?';
+            }
+            pos_ += 4U;
+            break;
+          default: c = esc; break;
+        }
+      }
+      out->push_back(c);
+    }
+    if (pos_ >= in_.size()) {
+      return false;
+    }
+    ++pos_;
+    return true;
+  }
+
+  bool parseValue(JsonValue* out) {
+    skipSpace();
+    if (pos_ >= in_.size()) {
+      return false;
+    }
+    const char c = in_[pos_];
+    if (c == '{') {
+      ++pos_;
+      out->kind = JsonValue::Kind::kObject;
+      skipSpace();
+      if (pos_ < in_.size() && in_[pos_] == '}') {
+        ++pos_;
+        return true;
+      }
+      while (true) {
+        skipSpace();
+        std::pair<std::string, JsonValue> member;
+        if (!parseString(&member.first)) {
+          return false;
+        }
+        skipSpace();
+        if (!consume(":") || !parseValue(&member.second)) {
+          return false;
+        }
+        out->members.push_back(std::move(member));
+        skipSpace();
+        if (consume(",")) {
+          continue;
+        }
+        return consume("}");
+      }
+    }
+    if (c == '[') {
+      ++pos_;
+      out->kind = JsonValue::Kind::kArray;
+      skipSpace();
+      if (pos_ < in_.size() && in_[pos_] == ']') {
+        ++pos_;
+        return true;
+      }
+      while (true) {
+        JsonValue item;
+        if (!parseValue(&item)) {
+          return false;
+        }
+        out->items.push_back(std::move(item));
+        skipSpace();
+        if (consume(",")) {
+          continue;
+        }
+        return consume("]");
+      }
+    }
+    if (c == '"') {
+      out->kind = JsonValue::Kind::kString;
+      return parseString(&out->text);
+    }
+    if (consume("true")) {
+      out->kind = JsonValue::Kind::kBool;
+      out->boolean = true;
+      return true;
+    }
+    if (consume("false")) {
+      out->kind = JsonValue::Kind::kBool;
+      return true;
+    }
+    if (consume("null")) {
+      return true;
+    }
+    char* end = nullptr;
+    out->number = strtod(in_.c_str() + pos_, &end);
+    if (end == in_.c_str() + pos_) {
+      return false;
+    }
+    out->kind = JsonValue::Kind::kNumber;
+    pos_ = static_cast<size_t>(end - in_.c_str());
+    return true;
+  }
+
+  const std::string& in_;
+  size_t pos_ = 0U;
+};
+
+// --- Scenario loading --------------------------------------------------------
+
+// Same mapping as StoryFsManager.
+StoryTransitionTrigger parseTrigger(const char* value) {
+  if (strcmp(value, "after_ms") == 0) {
+    return StoryTransitionTrigger::kAfterMs;
+  }
+  if (strcmp(value, "immediate") == 0) {
+    return StoryTransitionTrigger::kImmediate;
+  }
+  return StoryTransitionTrigger::kOnEvent;
+}
+
+StoryEventType parseEventType(const char* value) {
+  static const struct {
+    const char* name;
+    StoryEventType type;
+  } kTypes[] = {
+      {"unlock", StoryEventType::kUnlock},   {"audio_done", StoryEventType::kAudioDone},
+      {"timer", StoryEventType::kTimer},     {"serial", StoryEventType::kSerial},
+      {"button", StoryEventType::kButton},   {"espnow", StoryEventType::kEspNow},
+      {"esp_now", StoryEventType::kEspNow},  {"action", StoryEventType::kAction},
+      {"voice", StoryEventType::kVoice},     {"voice_bridge", StoryEventType::kVoice},
+  };
+  for (const auto& entry : kTypes) {
+    if (strcmp(entry.name, value) == 0) {
+      return entry.type;
+    }
+  }
+  return StoryEventType::kNone;
+}
+
+// Owns every string and array a JSON-loaded ScenarioDef points into.
+struct ScenarioStore {
+  std::deque<std::string> strings;
+  std::deque<std::vector<TransitionDef>> transitions;
+  std::deque<std::vector<const char*>> idLists;
+  std::vector<StepDef> steps;
+  ScenarioDef def = {};
+
+  const char* keep(const char* text) {
+    strings.emplace_back(text != nullptr ? text : "");
+    return strings.back().c_str();
+  }
+
+  const char* const* keepIds(const JsonValue* array, uint8_t* outCount) {
+    idLists.emplace_back();
+    if (array != nullptr) {
+      for (const JsonValue& item : array->items) {
+        if (item.kind == JsonValue::Kind::kString) {
+          idLists.back().push_back(keep(item.text.c_str()));
+        }
+      }
+    }
+    *outCount = static_cast<uint8_t>(idLists.back().size());
+    return idLists.back().empty() ? nullptr : idLists.back().data();
+  }
+};
+
+bool loadScenarioJson(const std::string& path, ScenarioStore* store) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    fprintf(stderr, "[story_sim] cannot open %s\n", path.c_str());
+    return false;
+  }
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  const std::string text = buffer.str();
+  JsonValue root;
+  JsonParser parser(text);
+  if (!parser.parse(&root) || root.kind != JsonValue::Kind::kObject) {
+    fprintf(stderr, "[story_sim] invalid json %s near byte %zu\n", path.c_str(), parser.offset());
+    return false;
+  }
+  const JsonValue* steps = root.get("steps");
+  if (steps == nullptr || steps->kind != JsonValue::Kind::kArray || steps->items.empty() ||
+      steps->items.size() > 255U) {
+    fprintf(stderr, "[story_sim] %s: steps array missing or out of range\n", path.c_str());
+    return false;
+  }
+
+  store->steps.reserve(steps->items.size());
+  for (const JsonValue& stepObj : steps->items) {
+    StepDef step = {};
+    step.id = store->keep(stepObj.str("step_id"));
+    step.resources.screenSceneId = store->keep(stepObj.str("screen_scene_id"));
+    step.resources.audioPackId = store->keep(stepObj.str("audio_pack_id"));
+    step.resources.actionIds = store->keepIds(stepObj.get("actions"), &step.resources.actionCount);
+    step.resources.appIds = store->keepIds(stepObj.get("apps"), &step.resources.appCount);
+    step.mp3GateOpen = stepObj.flag("mp3_gate_open");
+
+    store->transitions.emplace_back();
+    std::vector<TransitionDef>& list = store->transitions.back();
+    const JsonValue* transitions = stepObj.get("transitions");
+    if (transitions != nullptr) {
+      for (const JsonValue& trObj : transitions->items) {
+        if (list.size() >= 255U) {
+          break;
+        }
+        TransitionDef tr = {};
+        tr.id = store->keep(trObj.str("id"));
+        tr.trigger = parseTrigger(trObj.str("trigger"));
+        tr.eventType = parseEventType(trObj.str("event_type", "none"));
+        tr.eventName = store->keep(trObj.str("event_name"));
+        tr.afterMs = static_cast<uint32_t>(trObj.num("after_ms"));
+        tr.targetStepId = store->keep(trObj.str("target_step_id"));
+        tr.priority = static_cast<uint8_t>(trObj.num("priority"));
+        list.push_back(tr);
+      }
+    }
+    step.transitions = list.empty() ? nullptr : list.data();
+    step.transitionCount = static_cast<uint8_t>(list.size());
+    store->steps.push_back(step);
+  }
+
+  store->def.id = store->keep(root.str("id"));
+  store->def.version = static_cast<uint16_t>(root.num("version"));
+  store->def.initialStepId = store->keep(root.str("initial_step"));
+  store->def.steps = store->steps.data();
+  store->def.stepCount = static_cast<uint8_t>(store->steps.size());
+  return true;
+}
+
+// --- Trace -------------------------------------------------------------------
+
+struct TraceEvent {
+  uint32_t atMs = 0U;
+  StoryEventType type = StoryEventType::kNone;
+  std::string name;
+  int32_t value = 0;
+};
+
+// Line format: <at_ms> <type> <name> [value] [xN]
+// "#" starts a comment; xN posts N copies at the same instant (bursts).
+bool loadTrace(const std::string& path, std::vector<TraceEvent>* out) {
+  std::ifstream file(path);
+  if (!file) {
+    fprintf(stderr, "[story_sim] cannot open trace %s\n", path.c_str());
+    return false;
+  }
+  std::string line;
+  uint32_t lineNo = 0U;
+  while (std::getline(file, line)) {
+    ++lineNo;
+    const size_t hash = line.find('#');
+    if (hash != std::string::npos) {
+      line.erase(hash);
+    }
+    std::istringstream fields(line);
+    std::string at;
+    std::string type;
+    std::string name;
+    if (!(fields >> at)) {
+      continue;
+    }
+    if (!(fields >> type >> name)) {
+      fprintf(stderr, "[story_sim] %s:%u: expected <at_ms> <type> <name>\n", path.c_str(), lineNo);
+      return false;
+    }
+    TraceEvent event;
+    event.atMs = static_cast<uint32_t>(strtoul(at.c_str(), nullptr, 10));
+    event.type = parseEventType(type.c_str());
+    event.name = name;
+    if (event.type == StoryEventType::kNone) {
+      fprintf(stderr, "[story_sim] %s:%u: unknown event type %s\n", path.c_str(), lineNo, type.c_str());
+      return false;
+    }
+    uint32_t copies = 1U;
+    std::string extra;
+    while (fields >> extra) {
+      if (extra.size() > 1U && extra[0] == 'x') {
+        copies = static_cast<uint32_t>(strtoul(extra.c_str() + 1, nullptr, 10));
+      } else {
+        event.value = static_cast<int32_t>(strtol(extra.c_str(), nullptr, 10));
+      }
+    }
+    if (!out->empty() && event.atMs < out->back().atMs) {
+      fprintf(stderr, "[story_sim] %s:%u: timestamps must not go backwards\n", path.c_str(), lineNo);
+      return false;
+    }
+    for (uint32_t i = 0U; i < copies; ++i) {
+      out->push_back(event);
+    }
+  }
+  return true;
+}
+
+// --- Simulation --------------------------------------------------------------
+
+struct Options {
+  const char* scenarioId = nullptr;
+  const char* jsonPath = nullptr;
+  const char* storyRoot = nullptr;
+  const char* tracePath = nullptr;
+  uint32_t loopMs = 10U;
+  uint32_t tailMs = 1000U;
+  uint32_t repeat = 1U;
+  bool verbose = false;
+  bool failOnDrop = false;
+  bool list = false;
+};
+
+void usage() {
+  printf("usage: story_sim [--scenario ID] [--json PATH | --story-root DIR] --trace PATH\n"
+         "                 [--loop-ms N] [--tail-ms N] [--repeat N] [--fail-on-drop] [--verbose]\n"
+         "       story_sim --list\n"
+         "  --scenario ID     built-in scenario (default: built-in default), or\n"
+         "                    <DIR>/scenarios/<ID>.json with --story-root\n"
+         "  --loop-ms N       engine update() period in simulated ms (default 10)\n"
+         "  --tail-ms N       keep updating N ms after the last event (default 1000)\n"
+         "  --repeat N        replay the trace N times back to back (throughput runs)\n"
+         "  --fail-on-drop    exit 2 when EVENT_QUEUE_FULL drops happened\n");
+}
+
+bool parseArgs(int argc, char** argv, Options* opts) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const bool hasValue = (i + 1) < argc;
+    if (arg == "--scenario" && hasValue) {
+      opts->scenarioId = argv[++i];
+    } else if (arg == "--json" && hasValue) {
+      opts->jsonPath = argv[++i];
+    } else if (arg == "--story-root" && hasValue) {
+      opts->storyRoot = argv[++i];
+    } else if (arg == "--trace" && hasValue) {
+      opts->tracePath = argv[++i];
+    } else if (arg == "--loop-ms" && hasValue) {
+      opts->loopMs = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--tail-ms" && hasValue) {
+      opts->tailMs = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--repeat" && hasValue) {
+      opts->repeat = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--verbose") {
+      opts->verbose = true;
+    } else if (arg == "--fail-on-drop") {
+      opts->failOnDrop = true;
+    } else if (arg == "--list") {
+      opts->list = true;
+    } else {
+      return false;
+    }
+  }
+  if (opts->loopMs == 0U) {
+    opts->loopMs = 1U;
+  }
+  if (opts->repeat == 0U) {
+    opts->repeat = 1U;
+  }
+  return opts->list || opts->tracePath != nullptr;
+}
+
+}  // namespace
+
+uint32_t millis() {
+  return g_nowMs;
+}
+
+int main(int argc, char** argv) {
+  Options opts;
+  if (!parseArgs(argc, argv, &opts)) {
+    usage();
+    return 1;
+  }
+
+  if (opts.list) {
+    for (uint8_t i = 0U; i < storyScenarioV2Count(); ++i) {
+      const ScenarioDef* scenario = storyScenarioV2ById(storyScenarioV2IdAt(i));
+      printf("%s v%u steps=%u\n",
+             storyScenarioV2IdAt(i),
+             scenario != nullptr ? static_cast<unsigned int>(scenario->version) : 0U,
+             scenario != nullptr ? static_cast<unsigned int>(scenario->stepCount) : 0U);
+    }
+    return 0;
+  }
+
+  ScenarioStore store;
+  const ScenarioDef* scenario = nullptr;
+  const char* source = "builtin";
+  std::string jsonPath;
+  if (opts.jsonPath != nullptr) {
+    jsonPath = opts.jsonPath;
+  } else if (opts.storyRoot != nullptr && opts.scenarioId != nullptr) {
+    jsonPath = std::string(opts.storyRoot) + "/scenarios/" + opts.scenarioId + ".json";
+  }
+  if (!jsonPath.empty()) {
+    if (!loadScenarioJson(jsonPath, &store)) {
+      return 1;
+    }
+    scenario = &store.def;
+    source = "json";
+  } else {
+    scenario = (opts.scenarioId != nullptr) ? storyScenarioV2ById(opts.scenarioId) : storyScenarioV2Default();
+    if (scenario == nullptr) {
+      fprintf(stderr, "[story_sim] unknown scenario %s (see --list)\n", opts.scenarioId);
+      return 1;
+    }
+  }
+
+  std::vector<TraceEvent> trace;
+  if (!loadTrace(opts.tracePath, &trace)) {
+    return 1;
+  }
+
+  Serial.echo = opts.verbose;
+  StoryEngineV2 engine;
+  if (!engine.loadScenario(*scenario) || !engine.start(scenario->id, 0U)) {
+    fprintf(stderr, "[story_sim] scenario %s rejected: %s\n", scenario->id, engine.lastError());
+    return 1;
+  }
+  engine.consumeStepChanged();
+  engine.resetStats();
+
+  printf("[story_sim] scenario=%s source=%s steps=%u queue_capacity=%u (%ux%u) budget=%u loop_ms=%u trace_events=%zu repeat=%u\n",
+         scenario->id,
+         source,
+         static_cast<unsigned int>(scenario->stepCount),
+         static_cast<unsigned int>(StoryEventQueue::kCapacity),
+         static_cast<unsigned int>(StoryEventQueue::kLaneCount),
+         static_cast<unsigned int>(StoryEventQueue::kLaneCapacity),
+         static_cast<unsigned int>(StoryEngineV2::kEventProcessBudgetPerUpdate),
+         static_cast<unsigned int>(opts.loopMs),
+         trace.size(),
+         static_cast<unsigned int>(opts.repeat));
+
+  const uint32_t traceSpanMs = trace.empty() ? 0U : trace.back().atMs;
+  const uint32_t passMs = ((traceSpanMs + opts.tailMs) / opts.loopMs + 1U) * opts.loopMs;
+  uint32_t updates = 0U;
+  std::chrono::steady_clock::duration engineTime{};
+
+  for (uint32_t pass = 0U; pass < opts.repeat; ++pass) {
+    const uint32_t baseMs = pass * passMs;
+    size_t next = 0U;
+    for (uint32_t t = 0U; t < passMs; t += opts.loopMs) {
+      g_nowMs = baseMs + t;
+      const auto start = std::chrono::steady_clock::now();
+      // Everything that arrived since the previous loop lands in the queue first.
+      while (next < trace.size() && trace[next].atMs <= t) {
+        StoryEvent event = {};
+        event.type = trace[next].type;
+        event.value = trace[next].value;
+        event.atMs = baseMs + trace[next].atMs;
+        snprintf(event.name, sizeof(event.name), "%s", trace[next].name.c_str());
+        engine.postEvent(event);
+        ++next;
+      }
+      engine.update(g_nowMs);
+      engineTime += std::chrono::steady_clock::now() - start;
+      ++updates;
+      if (engine.consumeStepChanged() && pass == 0U) {
+        const StorySnapshot snap = engine.snapshot();
+        printf("[story_sim] t=%lu step %s -> %s via=%s\n",
+               static_cast<unsigned long>(g_nowMs),
+               snap.previousStepId != nullptr ? snap.previousStepId : "-",
+               snap.stepId != nullptr ? snap.stepId : "-",
+               engine.lastTransitionId() != nullptr ? engine.lastTransitionId() : "-");
+      }
+    }
+  }
+
+  const StoryEngineStats stats = engine.stats();
+  const double engineSec = std::chrono::duration<double>(engineTime).count();
+  const StorySnapshot snap = engine.snapshot();
+  printf("[story_sim] events posted=%lu processed=%lu unmatched=%lu transitions=%lu updates=%lu\n",
+         static_cast<unsigned long>(stats.postedEvents),
+         static_cast<unsigned long>(stats.processedEvents),
+         static_cast<unsigned long>(stats.unmatchedEvents),
+         static_cast<unsigned long>(stats.transitions),
+         static_cast<unsigned long>(updates));
+  printf("[story_sim] drops EVENT_QUEUE_FULL=%lu coalesced=%lu EVENT_BUDGET=%lu peak_queue=%u/%u left_in_queue=%u\n",
+         static_cast<unsigned long>(stats.queueFullDrops),
+         static_cast<unsigned long>(stats.coalescedEvents),
+         static_cast<unsigned long>(stats.budgetStalls),
+         static_cast<unsigned int>(stats.peakQueueDepth),
+         static_cast<unsigned int>(StoryEventQueue::kCapacity),
+         static_cast<unsigned int>(snap.queuedEvents));
+  if (stats.queueFullDrops > 0U) {
+    static const char* const kTypeNames[] = {"none", "unlock", "audio_done", "timer", "serial",
+                                             "button", "espnow", "action", "voice"};
+    printf("[story_sim] drops by type:");
+    for (uint8_t type = 0U; type < StoryEventQueue::kLaneCount; ++type) {
+      const uint32_t dropped = engine.droppedEvents(static_cast<StoryEventType>(type));
+      if (dropped > 0U) {
+        printf(" %s=%lu", kTypeNames[type], static_cast<unsigned long>(dropped));
+      }
+    }
+    printf("\n");
+  }
+  printf("[story_sim] final step=%s engine_time=%.3fms throughput=%.0f events/s\n",
+         snap.stepId != nullptr ? snap.stepId : "-",
+         engineSec * 1000.0,
+         engineSec > 0.0 ? static_cast<double>(stats.processedEvents) / engineSec : 0.0);
+
+  if (opts.failOnDrop && stats.queueFullDrops > 0U) {
+    return 2;
+  }
+  return 0;
+}
@@ -1254,12 +1254,29 @@ def _json_compact(payload: dict[str, Any]) -> bytes:
     return json.dumps(payload, sort_keys=True, separators=(",", ":")).encode("utf-8")
 
 
-def _write_json_with_checksum(root: Path, rel_path: str, payload: dict[str, Any]) -> None:
+def _write_json_with_checksum(
+    root: Path,
+    rel_path: str,
+    payload: dict[str, Any],
+    integrity: dict[str, str] | None = None,
+) -> None:
     blob = _json_compact(payload)
+    digest = _sha_hex(blob)
     out_path = root / rel_path
     out_path.parent.mkdir(parents=True, exist_ok=True)
     out_path.write_bytes(blob)
-    (out_path.with_suffix(".sha256")).write_text(_sha_hex(blob) + "\n", encoding="utf-8")
+    (out_path.with_suffix(".sha256")).write_text(digest + "\n", encoding="utf-8")
+    if integrity is not None:
+        integrity[rel_path] = digest
+
+
+def _write_integrity_manifest(root: Path, integrity: dict[str, str]) -> None:
+    # sha256sum format, paths relative to the FS root: the firmware verifies the
+    # whole bundle from this one file instead of one sidecar per resource.
+    lines = [f"{integrity[rel_path]}  {rel_path}" for rel_path in sorted(integrity)]
+    out_path = root / "story" / "integrity.sha256"
+    out_path.parent.mkdir(parents=True, exist_ok=True)
+    out_path.write_text("\n".join(lines) + "\n", encoding="utf-8")
 
 
 def _resource_slug(resource_id: str, prefix: str) -> str:
@@ -1700,6 +1717,7 @@ def generate_bundle_files(
     }
     autogenerated_screens: list[str] = []
     bindings: dict[str, dict[str, Any]] = {}
+    integrity: dict[str, str] = {}
 
     for scenario in scenarios:
         scenario_payload = {
@@ -1711,7 +1729,7 @@ def generate_bundle_files(
             "app_bindings": scenario["app_bindings"],
             "steps": scenario["steps"],
         }
-        _write_json_with_checksum(out_dir, f"story/scenarios/{scenario['id']}.json", scenario_payload)
+        _write_json_with_checksum(out_dir, f"story/scenarios/{scenario['id']}.json", scenario_payload, integrity)
 
         for binding in scenario["app_bindings"]:
             resources["apps"].add(binding["id"])
@@ -1733,24 +1751,24 @@ def generate_bundle_files(
         binding = bindings[app_id]
         source_payload = _load_resource_payload(resource_root, "apps", app_id)
         app_payload = _merge_app_payload(source_payload, binding)
-        _write_json_with_checksum(out_dir, f"story/apps/{app_id}.json", app_payload)
+        _write_json_with_checksum(out_dir, f"story/apps/{app_id}.json", app_payload, integrity)
 
     for screen_id in sorted(resources["screens"]):
         source_payload, autogenerated = _load_screen_payload_with_legacy_fallback(resource_root, screen_id)
         payload = _normalize_screen_payload(source_payload, screen_id)
-        _write_json_with_checksum(out_dir, f"story/screens/{screen_id}.json", payload)
+        _write_json_with_checksum(out_dir, f"story/screens/{screen_id}.json", payload, integrity)
         if autogenerated:
             autogenerated_screens.append(screen_id)
 
     for audio_id in sorted(resources["audio"]):
         source_payload = _load_resource_payload(resource_root, "audio", audio_id)
         payload = _with_resource_id(source_payload, audio_id)
-        _write_json_with_checksum(out_dir, f"story/audio/{audio_id}.json", payload)
+        _write_json_with_checksum(out_dir, f"story/audio/{audio_id}.json", payload, integrity)
 
     for action_id in sorted(resources["actions"]):
         source_payload = _load_resource_payload(resource_root, "actions", action_id)
         payload = _with_resource_id(source_payload, action_id)
-        _write_json_with_checksum(out_dir, f"story/actions/{action_id}.json", payload)
+        _write_json_with_checksum(out_dir, f"story/actions/{action_id}.json", payload, integrity)
 
     manifest = {
         "spec_hash": spec_hash,
@@ -1760,7 +1778,8 @@ def generate_bundle_files(
             "screens": autogenerated_screens,
         },
     }
-    _write_json_with_checksum(out_dir, "story/manifest.json", manifest)
+    _write_json_with_checksum(out_dir, "story/manifest.json", manifest, integrity)
+    _write_integrity_manifest(out_dir, integrity)
 
 
 def create_archive(root: Path, archive_path: Path) -> None:
@@ -1,5 +1,6 @@
 from __future__ import annotations
 
+import hashlib
 import json
 from pathlib import Path
 
@@ -131,6 +132,12 @@ def test_generate_cpp_and_bundle(tmp_path: Path) -> None:
     assert (paths.generated_cpp_dir / "apps_gen.cpp").exists()
     assert (paths.bundle_root / "story" / "scenarios" / "DEFAULT.json").exists()
     assert (paths.bundle_root / "story" / "manifest.sha256").exists()
+    integrity = (paths.bundle_root / "story" / "integrity.sha256").read_text(encoding="utf-8").splitlines()
+    listed = {line.split("  ", 1)[1]: line.split("  ", 1)[0] for line in integrity}
+    assert "story/scenarios/DEFAULT.json" in listed
+    assert "story/manifest.json" in listed
+    for rel_path, digest in listed.items():
+        assert hashlib.sha256((paths.bundle_root / rel_path).read_bytes()).hexdigest() == digest
     assert bundle["scenario_count"] == 1
 
 
@@ -25,6 +25,10 @@ struct StoryPortableSnapshot {
   const char* stepId = nullptr;
   const char* lastError = "OK";
   const char* runtimeState = "idle";
+  // Last LittleFS load (zero when the scenario came from generated code).
+  uint32_t scenarioLoadMs = 0U;
+  uint32_t scenarioLoadPeakHeap = 0U;
+  uint32_t scenarioArenaBytes = 0U;
 };
 
 struct StoryPortableCatalogEntry {
@@ -0,0 +1,595 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ESP-NOW frames v1: small records batched into one 250-byte frame, with a
+// per-peer sliding window and selective acknowledgement instead of one JSON
+// ack per message. See espnow_frame_v1.md for the wire format and timers.
+
+enum {
+  ESPNOW_FRAME_MAGIC = 0xE5,
+  ESPNOW_FRAME_VERSION = 1,
+  ESPNOW_FRAME_MAX = 250,  // ESP_NOW_MAX_DATA_LEN
+  // magic + ver/flags + epoch + count + seq u16 + ack_epoch + ack_base u16 + ack_bits u32
+  ESPNOW_FRAME_HEADER = 13,
+  ESPNOW_FRAME_RECORD_HEADER = 2,
+  ESPNOW_FRAME_MAX_RECORD = ESPNOW_FRAME_MAX - ESPNOW_FRAME_HEADER - ESPNOW_FRAME_RECORD_HEADER,
+  ESPNOW_FRAME_ACK_BITS = 32,
+  ESPNOW_FRAME_MAX_WINDOW = 8,
+  ESPNOW_FRAME_DEFAULT_RTO_MS = 40,
+  ESPNOW_FRAME_MAX_RTO_MS = 320,
+  ESPNOW_FRAME_DEFAULT_TRIES = 8,
+  ESPNOW_FRAME_DEFAULT_BATCH_MS = 4,
+  ESPNOW_FRAME_DEFAULT_ACK_DELAY_MS = 8,
+};
+
+// Low nibble of header byte 1 (the high nibble is the version).
+enum {
+  ESPNOW_FRAME_FLAG_RELIABLE = 0x01,  // seq is valid, receiver acks it
+  ESPNOW_FRAME_FLAG_ACK = 0x02,       // ack_epoch/ack_base/ack_bits are valid
+};
+
+typedef enum EspNowRecordType {
+  ESPNOW_REC_EVENT = 0x01,    // story event token, e.g. "SERIAL:BTN_NEXT"
+  ESPNOW_REC_COMMAND = 0x02,  // request_id u16 LE + command line "CMD arg"
+  ESPNOW_REC_RESULT = 0x03,   // request_id u16 LE + ok u8 + code_len u8 + code + data (JSON)
+  ESPNOW_REC_JSON = 0x04,     // legacy JSON envelope or payload text
+  ESPNOW_REC_TEXT = 0x05,     // free text
+} EspNowRecordType;
+
+typedef enum EspNowSlotState {
+  ESPNOW_SLOT_FREE = 0,
+  ESPNOW_SLOT_PENDING,   // sealed, never sent
+  ESPNOW_SLOT_INFLIGHT,  // sent, waiting for an ack
+} EspNowSlotState;
+
+typedef enum EspNowAcceptResult {
+  ESPNOW_ACCEPT_INVALID = 0,
+  ESPNOW_ACCEPT_DUPLICATE,  // already delivered (or an ack-only frame)
+  ESPNOW_ACCEPT_DELIVER,    // first sighting: hand its records to the app
+} EspNowAcceptResult;
+
+typedef struct EspNowFrameHeader {
+  uint8_t flags;
+  uint8_t epoch;
+  uint8_t count;
+  uint16_t seq;
+  uint8_t ack_epoch;
+  uint16_t ack_base;
+  uint32_t ack_bits;
+} EspNowFrameHeader;
+
+typedef struct EspNowFrameSlot {
+  uint8_t buf[ESPNOW_FRAME_MAX];
+  uint8_t len;
+  uint8_t state;
+  uint8_t tries;
+  uint8_t records;
+  bool fast_retx;  // a later frame was acked first: resend without waiting for the RTO
+  uint16_t seq;
+  uint32_t sent_ms;
+} EspNowFrameSlot;
+
+typedef struct EspNowLinkStats {
+  uint32_t tx_frames;
+  uint32_t tx_records;
+  uint32_t tx_retransmits;
+  uint32_t tx_acks;  // bare ack frames
+  uint32_t tx_acked_frames;
+  uint32_t tx_expired_frames;
+  uint32_t tx_expired_records;
+  uint32_t tx_blocked;  // queue refused: window full
+  uint32_t rx_frames;
+  uint32_t rx_records;
+  uint32_t rx_duplicates;
+  uint32_t rx_resyncs;
+  uint32_t rx_invalid;
+  uint32_t rtt_samples;
+  uint32_t rtt_total_ms;
+  uint32_t rtt_max_ms;
+} EspNowLinkStats;
+
+// One direction pair with one peer. Records are appended to an open frame that
+// is sealed when full or `batch_ms` old; sealed reliable frames take a window
+// slot until acked or expired. Unreliable frames (broadcast) use `datagram`.
+typedef struct EspNowLink {
+  // Tunables, set by espNowLinkInit; change them before the first frame only.
+  uint8_t window;       // 1..ESPNOW_FRAME_MAX_WINDOW reliable frames in flight
+  uint8_t max_records;  // records per frame
+  uint8_t max_tries;
+  uint16_t rto_ms;
+  uint16_t batch_ms;
+  uint16_t ack_delay_ms;
+
+  uint8_t tx_epoch;
+  uint16_t next_seq;
+  uint8_t open[ESPNOW_FRAME_MAX];
+  uint8_t open_len;
+  uint8_t open_count;
+  bool open_reliable;
+  uint32_t open_ms;
+  EspNowFrameSlot slots[ESPNOW_FRAME_MAX_WINDOW];
+  EspNowFrameSlot datagram;
+
+  bool rx_synced;
+  uint8_t rx_epoch;
+  uint16_t rx_base;  // next expected seq; everything below was received
+  uint32_t rx_bits;  // bit i: rx_base + i received
+  bool ack_pending;
+  uint32_t ack_due_ms;
+
+  EspNowLinkStats stats;
+} EspNowLink;
+
+typedef void (*EspNowRecordFn)(void* ctx, uint8_t type, const uint8_t* data, uint8_t len);
+
+typedef struct EspNowResultView {
+  uint16_t request_id;
+  bool ok;
+  const char* code;
+  uint8_t code_len;
+  const char* data;
+  uint8_t data_len;
+} EspNowResultView;
+
+static inline uint16_t espNowFrameGetU16(const uint8_t* in) {
+  return (uint16_t)(in[0] | ((uint16_t)in[1] << 8u));
+}
+
+static inline void espNowFramePutU16(uint8_t* out, uint16_t value) {
+  out[0] = (uint8_t)(value & 0xFFu);
+  out[1] = (uint8_t)(value >> 8u);
+}
+
+static inline uint32_t espNowFrameGetU32(const uint8_t* in) {
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8u) | ((uint32_t)in[2] << 16u) | ((uint32_t)in[3] << 24u);
+}
+
+static inline void espNowFramePutU32(uint8_t* out, uint32_t value) {
+  for (uint8_t i = 0u; i < 4u; ++i) {
+    out[i] = (uint8_t)(value >> (8u * i));
+  }
+}
+
+// True when the frame starts with the v1 magic; lets receivers tell binary
+// frames from legacy JSON/text payloads before parsing.
+static inline bool espNowFrameIsBinary(const uint8_t* frame, size_t len) {
+  return frame != NULL && len >= ESPNOW_FRAME_HEADER && frame[0] == ESPNOW_FRAME_MAGIC &&
+         (frame[1] >> 4u) == ESPNOW_FRAME_VERSION;
+}
+
+// Validates the header and that `count` records exactly fill the frame.
+static inline bool espNowFrameParseHeader(const uint8_t* frame, size_t len, EspNowFrameHeader* out) {
+  if (!espNowFrameIsBinary(frame, len) || len > ESPNOW_FRAME_MAX || out == NULL) {
+    return false;
+  }
+  out->flags = (uint8_t)(frame[1] & 0x0Fu);
+  out->epoch = frame[2];
+  out->count = frame[3];
+  out->seq = espNowFrameGetU16(frame + 4);
+  out->ack_epoch = frame[6];
+  out->ack_base = espNowFrameGetU16(frame + 7);
+  out->ack_bits = espNowFrameGetU32(frame + 9);
+  size_t pos = ESPNOW_FRAME_HEADER;
+  for (uint8_t i = 0u; i < out->count; ++i) {
+    if (pos + ESPNOW_FRAME_RECORD_HEADER > len) {
+      return false;
+    }
+    pos += ESPNOW_FRAME_RECORD_HEADER + frame[pos + 1u];
+  }
+  return pos == len;
+}
+
+// Record iterator over a frame already checked by espNowFrameParseHeader.
+static inline bool espNowFrameNextRecord(const uint8_t* frame,
+                                         size_t len,
+                                         size_t* pos,
+                                         uint8_t* type,
+                                         const uint8_t** data,
+                                         uint8_t* data_len) {
+  if (*pos + ESPNOW_FRAME_RECORD_HEADER > len) {
+    return false;
+  }
+  *type = frame[*pos];
+  *data_len = frame[*pos + 1u];
+  *data = frame + *pos + ESPNOW_FRAME_RECORD_HEADER;
+  *pos += ESPNOW_FRAME_RECORD_HEADER + *data_len;
+  return *pos <= len;
+}
+
+static inline void espNowLinkInit(EspNowLink* link, uint8_t epoch) {
+  if (link == NULL) {
+    return;
+  }
+  memset(link, 0, sizeof(*link));
+  link->window = ESPNOW_FRAME_MAX_WINDOW;
+  link->max_records = 255u;
+  link->max_tries = ESPNOW_FRAME_DEFAULT_TRIES;
+  link->rto_ms = ESPNOW_FRAME_DEFAULT_RTO_MS;
+  link->batch_ms = ESPNOW_FRAME_DEFAULT_BATCH_MS;
+  link->ack_delay_ms = ESPNOW_FRAME_DEFAULT_ACK_DELAY_MS;
+  link->tx_epoch = (epoch != 0u) ? epoch : 1u;
+}
+
+static inline uint8_t espNowLinkInFlight(const EspNowLink* link) {
+  uint8_t count = 0u;
+  for (uint8_t i = 0u; i < link->window; ++i) {
+    count = (uint8_t)(count + (link->slots[i].state != ESPNOW_SLOT_FREE ? 1u : 0u));
+  }
+  return count;
+}
+
+// Nothing open, queued, in flight or waiting to be acked.
+static inline bool espNowLinkIdle(const EspNowLink* link) {
+  return link->open_count == 0u && espNowLinkInFlight(link) == 0u && link->datagram.state == ESPNOW_SLOT_FREE &&
+         !link->ack_pending;
+}
+
+// Moves the open frame into a slot. False when no slot is free.
+static inline bool espNowLinkSeal(EspNowLink* link) {
+  if (link->open_count == 0u) {
+    return true;
+  }
+  EspNowFrameSlot* slot = NULL;
+  if (link->open_reliable) {
+    for (uint8_t i = 0u; i < link->window; ++i) {
+      const EspNowFrameSlot* used = &link->slots[i];
+      if (used->state == ESPNOW_SLOT_FREE) {
+        slot = (slot == NULL) ? &link->slots[i] : slot;
+      } else if ((uint16_t)(link->next_seq - used->seq) >= ESPNOW_FRAME_ACK_BITS) {
+        // The receiver only tracks ACK_BITS seqs past its base; going further
+        // while an old frame is still unacked would make it look stale.
+        return false;
+      }
+    }
+  } else if (link->datagram.state == ESPNOW_SLOT_FREE) {
+    slot = &link->datagram;
+  }
+  if (slot == NULL) {
+    return false;
+  }
+  uint8_t* frame = link->open;
+  frame[0] = ESPNOW_FRAME_MAGIC;
+  frame[1] = (uint8_t)((ESPNOW_FRAME_VERSION << 4u) | (link->open_reliable ? (unsigned)ESPNOW_FRAME_FLAG_RELIABLE : 0u));
+  frame[2] = link->tx_epoch;
+  frame[3] = link->open_count;
+  slot->seq = link->open_reliable ? link->next_seq++ : 0u;
+  espNowFramePutU16(frame + 4, slot->seq);
+  memset(frame + 6, 0, ESPNOW_FRAME_HEADER - 6u);
+  memcpy(slot->buf, frame, link->open_len);
+  slot->len = link->open_len;
+  slot->state = ESPNOW_SLOT_PENDING;
+  slot->tries = 0u;
+  slot->records = link->open_count;
+  slot->fast_retx = false;
+  link->open_count = 0u;
+  link->open_len = 0u;
+  return true;
+}
+
+// Appends one record. Unreliable records ride along in a reliable frame when
+// one is open. False when the record is too large or the window is full.
+static inline bool espNowLinkQueue(EspNowLink* link,
+                                   uint8_t type,
+                                   const uint8_t* data,
+                                   size_t len,
+                                   bool reliable,
+                                   uint32_t now_ms) {
+  if (link == NULL || len > ESPNOW_FRAME_MAX_RECORD || (data == NULL && len != 0u)) {
+    return false;
+  }
+  if (link->open_count != 0u &&
+      ((size_t)link->open_len + ESPNOW_FRAME_RECORD_HEADER + len > ESPNOW_FRAME_MAX ||
+       link->open_count >= link->max_records)) {
+    if (!espNowLinkSeal(link)) {
+      ++link->stats.tx_blocked;
+      return false;
+    }
+  }
+  if (link->open_count == 0u) {
+    link->open_len = ESPNOW_FRAME_HEADER;
+    link->open_reliable = false;
+    link->open_ms = now_ms;
+  }
+  link->open[link->open_len] = type;
+  link->open[link->open_len + 1u] = (uint8_t)len;
+  if (len != 0u) {
+    memcpy(link->open + link->open_len + ESPNOW_FRAME_RECORD_HEADER, data, len);
+  }
+  link->open_len = (uint8_t)(link->open_len + ESPNOW_FRAME_RECORD_HEADER + len);
+  ++link->open_count;
+  link->open_reliable = link->open_reliable || reliable;
+  ++link->stats.tx_records;
+  return true;
+}
+
+static inline bool espNowLinkQueueCommand(EspNowLink* link,
+                                          uint16_t request_id,
+                                          const char* line,
+                                          size_t len,
+                                          uint32_t now_ms) {
+  uint8_t record[ESPNOW_FRAME_MAX_RECORD];
+  if (line == NULL || len + 2u > sizeof(record)) {
+    return false;
+  }
+  espNowFramePutU16(record, request_id);
+  memcpy(record + 2, line, len);
+  return espNowLinkQueue(link, ESPNOW_REC_COMMAND, record, len + 2u, true, now_ms);
+}
+
+// `data` is optional JSON; oversized data is refused rather than cut.
+static inline bool espNowLinkQueueResult(EspNowLink* link,
+                                         uint16_t request_id,
+                                         bool ok,
+                                         const char* code,
+                                         const char* data,
+                                         size_t data_len,
+                                         uint32_t now_ms,
+                                         bool reliable) {
+  uint8_t record[ESPNOW_FRAME_MAX_RECORD];
+  const size_t code_len = (code != NULL) ? strlen(code) : 0u;
+  if (code_len > 255u || 4u + code_len + data_len > sizeof(record) || (data == NULL && data_len != 0u)) {
+    return false;
+  }
+  espNowFramePutU16(record, request_id);
+  record[2] = ok ? 1u : 0u;
+  record[3] = (uint8_t)code_len;
+  if (code_len != 0u) {
+    memcpy(record + 4, code, code_len);
+  }
+  if (data_len != 0u) {
+    memcpy(record + 4 + code_len, data, data_len);
+  }
+  return espNowLinkQueue(link, ESPNOW_REC_RESULT, record, 4u + code_len + data_len, reliable, now_ms);
+}
+
+static inline bool espNowRecordParseCommand(const uint8_t* data,
+                                            uint8_t len,
+                                            uint16_t* request_id,
+                                            const char** line,
+                                            uint8_t* line_len) {
+  if (data == NULL || len < 2u) {
+    return false;
+  }
+  *request_id = espNowFrameGetU16(data);
+  *line = (const char*)(data + 2);
+  *line_len = (uint8_t)(len - 2u);
+  return true;
+}
+
+static inline bool espNowRecordParseResult(const uint8_t* data, uint8_t len, EspNowResultView* out) {
+  if (data == NULL || out == NULL || len < 4u || 4u + data[3] > len) {
+    return false;
+  }
+  out->request_id = espNowFrameGetU16(data);
+  out->ok = data[2] != 0u;
+  out->code_len = data[3];
+  out->code = (const char*)(data + 4);
+  out->data = (const char*)(data + 4 + out->code_len);
+  out->data_len = (uint8_t)(len - 4u - out->code_len);
+  return true;
+}
+
+static inline uint32_t espNowLinkRto(const EspNowLink* link, uint8_t tries) {
+  uint32_t rto = link->rto_ms;
+  for (uint8_t i = 1u; i < tries && rto < ESPNOW_FRAME_MAX_RTO_MS; ++i) {
+    rto <<= 1u;
+  }
+  return (rto < ESPNOW_FRAME_MAX_RTO_MS) ? rto : (uint32_t)ESPNOW_FRAME_MAX_RTO_MS;
+}
+
+static inline void espNowLinkStampAck(EspNowLink* link, uint8_t* frame) {
+  if (!link->rx_synced) {
+    frame[1] = (uint8_t)(frame[1] & ~ESPNOW_FRAME_FLAG_ACK);
+    return;
+  }
+  frame[1] = (uint8_t)(frame[1] | ESPNOW_FRAME_FLAG_ACK);
+  frame[6] = link->rx_epoch;
+  espNowFramePutU16(frame + 7, link->rx_base);
+  espNowFramePutU32(frame + 9, link->rx_bits);
+  link->ack_pending = false;
+}
+
+// Returns the next frame to hand to esp_now_send (0: nothing due). Call it
+// until it returns 0 from the loop; `cap` must hold ESPNOW_FRAME_MAX bytes.
+// Order: retransmissions, then new reliable frames, then datagrams, then a
+// bare ack when the delayed ack is due and nothing else carried it.
+static inline size_t espNowLinkPoll(EspNowLink* link, uint32_t now_ms, uint8_t* out, size_t cap) {
+  if (link == NULL || out == NULL || cap < ESPNOW_FRAME_MAX) {
+    return 0u;
+  }
+  if (link->open_count != 0u && ((uint32_t)(now_ms - link->open_ms) >= link->batch_ms || link->ack_pending)) {
+    espNowLinkSeal(link);
+  }
+
+  EspNowFrameSlot* resend = NULL;
+  EspNowFrameSlot* fresh = NULL;
+  for (uint8_t i = 0u; i < link->window; ++i) {
+    EspNowFrameSlot* slot = &link->slots[i];
+    if (slot->state == ESPNOW_SLOT_PENDING) {
+      if (fresh == NULL || (int16_t)(slot->seq - fresh->seq) < 0) {
+        fresh = slot;
+      }
+      continue;
+    }
+    if (slot->state != ESPNOW_SLOT_INFLIGHT) {
+      continue;
+    }
+    const bool timed_out = (uint32_t)(now_ms - slot->sent_ms) >= espNowLinkRto(link, slot->tries);
+    if (timed_out && slot->tries >= link->max_tries) {
+      slot->state = ESPNOW_SLOT_FREE;
+      ++link->stats.tx_expired_frames;
+      link->stats.tx_expired_records += slot->records;
+      continue;
+    }
+    if ((timed_out || slot->fast_retx) && (resend == NULL || (int16_t)(slot->seq - resend->seq) < 0)) {
+      resend = slot;
+    }
+  }
+
+  EspNowFrameSlot* slot = (resend != NULL) ? resend : fresh;
+  if (slot == NULL && link->datagram.state == ESPNOW_SLOT_PENDING) {
+    slot = &link->datagram;
+  }
+  if (slot != NULL) {
+    espNowLinkStampAck(link, slot->buf);
+    memcpy(out, slot->buf, slot->len);
+    ++link->stats.tx_frames;
+    if (slot == &link->datagram) {
+      slot->state = ESPNOW_SLOT_FREE;
+      return slot->len;
+    }
+    if (slot->tries != 0u) {
+      ++link->stats.tx_retransmits;
+    }
+    ++slot->tries;
+    slot->sent_ms = now_ms;
+    slot->fast_retx = false;
+    slot->state = ESPNOW_SLOT_INFLIGHT;
+    return slot->len;
+  }
+
+  if (link->ack_pending && (int32_t)(now_ms - link->ack_due_ms) >= 0) {
+    out[0] = ESPNOW_FRAME_MAGIC;
+    out[1] = (uint8_t)(ESPNOW_FRAME_VERSION << 4u);
+    out[2] = link->tx_epoch;
+    out[3] = 0u;
+    espNowFramePutU16(out + 4, 0u);
+    espNowLinkStampAck(link, out);
+    ++link->stats.tx_acks;
+    return ESPNOW_FRAME_HEADER;
+  }
+  return 0u;
+}
+
+static inline void espNowLinkApplyAck(EspNowLink* link, uint16_t base, uint32_t bits, uint32_t now_ms) {
+  // Highest selectively acked offset: frames in flight below it were probably lost.
+  int8_t highest = -1;
+  for (int8_t bit = ESPNOW_FRAME_ACK_BITS - 1; bit >= 0 && highest < 0; --bit) {
+    if ((bits >> (uint8_t)bit) & 1u) {
+      highest = bit;
+    }
+  }
+  for (uint8_t i = 0u; i < link->window; ++i) {
+    EspNowFrameSlot* slot = &link->slots[i];
+    if (slot->state != ESPNOW_SLOT_INFLIGHT) {
+      continue;
+    }
+    const int16_t offset = (int16_t)(slot->seq - base);
+    const bool acked =
+        offset < 0 || (offset < ESPNOW_FRAME_ACK_BITS && ((bits >> (uint8_t)offset) & 1u) != 0u);
+    if (acked) {
+      if (slot->tries == 1u) {
+        const uint32_t rtt = now_ms - slot->sent_ms;
+        ++link->stats.rtt_samples;
+        link->stats.rtt_total_ms += rtt;
+        if (rtt > link->stats.rtt_max_ms) {
+          link->stats.rtt_max_ms = rtt;
+        }
+      }
+      slot->state = ESPNOW_SLOT_FREE;
+      ++link->stats.tx_acked_frames;
+    } else if (offset < highest && (uint32_t)(now_ms - slot->sent_ms) >= link->rto_ms / 2u) {
+      // A later frame got through and this one has had half an RTO: resend
+      // now rather than after a backed-off timeout.
+      slot->fast_retx = true;
+    }
+  }
+}
+
+// Handles the link part of a received frame: applies its ack and dedupes
+// reliable frames. Records of a reliable stream are delivered on arrival, not
+// reordered. On DELIVER the caller walks the records with
+// espNowFrameNextRecord from ESPNOW_FRAME_HEADER.
+static inline EspNowAcceptResult espNowLinkAccept(EspNowLink* link, const uint8_t* frame, size_t len, uint32_t now_ms) {
+  EspNowFrameHeader header;
+  if (link == NULL) {
+    return ESPNOW_ACCEPT_INVALID;
+  }
+  if (!espNowFrameParseHeader(frame, len, &header)) {
+    ++link->stats.rx_invalid;
+    return ESPNOW_ACCEPT_INVALID;
+  }
+  ++link->stats.rx_frames;
+  if ((header.flags & ESPNOW_FRAME_FLAG_ACK) != 0u && header.ack_epoch == link->tx_epoch) {
+    espNowLinkApplyAck(link, header.ack_base, header.ack_bits, now_ms);
+  }
+  if (header.count == 0u) {
+    return ESPNOW_ACCEPT_DUPLICATE;
+  }
+
+  if ((header.flags & ESPNOW_FRAME_FLAG_RELIABLE) != 0u) {
+    if (!link->rx_synced || header.epoch != link->rx_epoch) {
+      // New sender session: it starts at seq 0, so anything inside the first
+      // window still counts from 0 (frame 0 may have been lost).
+      if (link->rx_synced) {
+        ++link->stats.rx_resyncs;
+      }
+      link->rx_synced = true;
+      link->rx_epoch = header.epoch;
+      link->rx_base = (header.seq < ESPNOW_FRAME_ACK_BITS) ? 0u : header.seq;
+      link->rx_bits = 0u;
+    }
+    int16_t offset = (int16_t)(header.seq - link->rx_base);
+    if (offset < 0 || (offset < ESPNOW_FRAME_ACK_BITS && ((link->rx_bits >> (uint8_t)offset) & 1u) != 0u)) {
+      // Our ack was lost: answer right away so the sender stops resending.
+      ++link->stats.rx_duplicates;
+      link->ack_pending = true;
+      link->ack_due_ms = now_ms;
+      return ESPNOW_ACCEPT_DUPLICATE;
+    }
+    if (offset >= ESPNOW_FRAME_ACK_BITS) {
+      // The sender gave up on older frames; slide so this one is the last bit.
+      const uint16_t shift = (uint16_t)(offset - (ESPNOW_FRAME_ACK_BITS - 1));
+      link->rx_bits = (shift >= ESPNOW_FRAME_ACK_BITS) ? 0u : (link->rx_bits >> shift);
+      link->rx_base = (uint16_t)(link->rx_base + shift);
+      offset = ESPNOW_FRAME_ACK_BITS - 1;
+      ++link->stats.rx_resyncs;
+    }
+    link->rx_bits |= (uint32_t)1u << (uint8_t)offset;
+    while ((link->rx_bits & 1u) != 0u) {
+      link->rx_bits >>= 1u;
+      ++link->rx_base;
+    }
+    if (!link->ack_pending) {
+      link->ack_pending = true;
+      link->ack_due_ms = now_ms + link->ack_delay_ms;
+    }
+  }
+  link->stats.rx_records += header.count;
+  return ESPNOW_ACCEPT_DELIVER;
+}
+
+// espNowLinkAccept + a callback per record. False on a malformed frame.
+static inline bool espNowLinkReceive(EspNowLink* link,
+                                     const uint8_t* frame,
+                                     size_t len,
+                                     uint32_t now_ms,
+                                     EspNowRecordFn fn,
+                                     void* ctx) {
+  const EspNowAcceptResult result = espNowLinkAccept(link, frame, len, now_ms);
+  if (result != ESPNOW_ACCEPT_DELIVER) {
+    return result != ESPNOW_ACCEPT_INVALID;
+  }
+  size_t pos = ESPNOW_FRAME_HEADER;
+  uint8_t type = 0u;
+  const uint8_t* data = NULL;
+  uint8_t data_len = 0u;
+  while (espNowFrameNextRecord(frame, len, &pos, &type, &data, &data_len)) {
+    if (fn != NULL) {
+      fn(ctx, type, data, data_len);
+    }
+  }
+  return true;
+}
+
+#ifdef __cplusplus
+}
+#endif
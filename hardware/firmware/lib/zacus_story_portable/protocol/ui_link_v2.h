@@ -61,6 +61,55 @@ typedef enum UiTouchAction {
   UI_TOUCH_ACTION_UP,
 } UiTouchAction;
 
+// Known v2 field keys, resolved once per field at parse time.
+typedef enum UiLinkKey {
+  UILINK_KEY_UNKNOWN = 0,
+  UILINK_KEY_PROTO,
+  UILINK_KEY_PROTO_MAX,
+  UILINK_KEY_SESSION,
+  UILINK_KEY_CAPS,
+  UILINK_KEY_UI_TYPE,
+  UILINK_KEY_UI_ID,
+  UILINK_KEY_FW,
+  UILINK_KEY_SEQ,
+  UILINK_KEY_MS,
+  UILINK_KEY_MODE,
+  UILINK_KEY_LA,
+  UILINK_KEY_MP3,
+  UILINK_KEY_SD,
+  UILINK_KEY_KEY,
+  UILINK_KEY_TRACK,
+  UILINK_KEY_TRACK_TOTAL,
+  UILINK_KEY_VOL,
+  UILINK_KEY_U_LOCK,
+  UILINK_KEY_U_SON,
+  UILINK_KEY_TUNE_OFF,
+  UILINK_KEY_TUNE_CONF,
+  UILINK_KEY_U_LOCK_LISTEN,
+  UILINK_KEY_MIC,
+  UILINK_KEY_HOLD,
+  UILINK_KEY_STARTUP,
+  UILINK_KEY_APP,
+  UILINK_KEY_UI_PAGE,
+  UILINK_KEY_UI_CURSOR,
+  UILINK_KEY_UI_OFFSET,
+  UILINK_KEY_UI_COUNT,
+  UILINK_KEY_QUEUE,
+  UILINK_KEY_REPEAT,
+  UILINK_KEY_FX,
+  UILINK_KEY_BACKEND,
+  UILINK_KEY_SCAN,
+  UILINK_KEY_ERR,
+  UILINK_KEY_ID,
+  UILINK_KEY_ACTION,
+  UILINK_KEY_TS,
+  UILINK_KEY_X,
+  UILINK_KEY_Y,
+  UILINK_KEY_OP,
+  UILINK_KEY_ARG,
+  UILINK_KEY_COUNT,
+} UiLinkKey;
+
 typedef struct UiLinkField {
   char key[UILINK_V2_KEY_MAX];
   char value[UILINK_V2_VALUE_MAX];
@@ -77,20 +126,54 @@ typedef struct UiLinkFrame {
   bool crc_ok;
 } UiLinkFrame;
 
+// Byte range inside the line a UiLinkView was scanned from.
+typedef struct UiLinkSlice {
+  uint16_t off;
+  uint16_t len;
+} UiLinkSlice;
+
+// Zero-copy parse result: slices into the caller's line buffer, which must
+// outlive the view. Known keys are indexed, so lookups are O(1).
+typedef struct UiLinkView {
+  const char* line;
+  UiLinkMsgType type;
+  UiLinkSlice type_token;
+  uint8_t field_count;
+  UiLinkSlice keys[UILINK_V2_MAX_FIELDS];
+  UiLinkSlice values[UILINK_V2_MAX_FIELDS];
+  uint8_t key_field[UILINK_KEY_COUNT];  // field index + 1, 0 when absent
+  bool has_crc;
+  uint8_t crc_expected;
+  uint8_t crc_computed;
+  bool crc_ok;
+} UiLinkView;
+
 static inline uint8_t uiLinkCrc8(const uint8_t* data, size_t len) {
+  // Poly 0x07, init 0x00: one table step per byte.
+  static const uint8_t kTable[256] = {
+      0x00u, 0x07u, 0x0Eu, 0x09u, 0x1Cu, 0x1Bu, 0x12u, 0x15u, 0x38u, 0x3Fu, 0x36u, 0x31u, 0x24u, 0x23u, 0x2Au, 0x2Du,
+      0x70u, 0x77u, 0x7Eu, 0x79u, 0x6Cu, 0x6Bu, 0x62u, 0x65u, 0x48u, 0x4Fu, 0x46u, 0x41u, 0x54u, 0x53u, 0x5Au, 0x5Du,
+      0xE0u, 0xE7u, 0xEEu, 0xE9u, 0xFCu, 0xFBu, 0xF2u, 0xF5u, 0xD8u, 0xDFu, 0xD6u, 0xD1u, 0xC4u, 0xC3u, 0xCAu, 0xCDu,
+      0x90u, 0x97u, 0x9Eu, 0x99u, 0x8Cu, 0x8Bu, 0x82u, 0x85u, 0xA8u, 0xAFu, 0xA6u, 0xA1u, 0xB4u, 0xB3u, 0xBAu, 0xBDu,
+      0xC7u, 0xC0u, 0xC9u, 0xCEu, 0xDBu, 0xDCu, 0xD5u, 0xD2u, 0xFFu, 0xF8u, 0xF1u, 0xF6u, 0xE3u, 0xE4u, 0xEDu, 0xEAu,
+      0xB7u, 0xB0u, 0xB9u, 0xBEu, 0xABu, 0xACu, 0xA5u, 0xA2u, 0x8Fu, 0x88u, 0x81u, 0x86u, 0x93u, 0x94u, 0x9Du, 0x9Au,
+      0x27u, 0x20u, 0x29u, 0x2Eu, 0x3Bu, 0x3Cu, 0x35u, 0x32u, 0x1Fu, 0x18u, 0x11u, 0x16u, 0x03u, 0x04u, 0x0Du, 0x0Au,
+      0x57u, 0x50u, 0x59u, 0x5Eu, 0x4Bu, 0x4Cu, 0x45u, 0x42u, 0x6Fu, 0x68u, 0x61u, 0x66u, 0x73u, 0x74u, 0x7Du, 0x7Au,
+      0x89u, 0x8Eu, 0x87u, 0x80u, 0x95u, 0x92u, 0x9Bu, 0x9Cu, 0xB1u, 0xB6u, 0xBFu, 0xB8u, 0xADu, 0xAAu, 0xA3u, 0xA4u,
+      0xF9u, 0xFEu, 0xF7u, 0xF0u, 0xE5u, 0xE2u, 0xEBu, 0xECu, 0xC1u, 0xC6u, 0xCFu, 0xC8u, 0xDDu, 0xDAu, 0xD3u, 0xD4u,
+      0x69u, 0x6Eu, 0x67u, 0x60u, 0x75u, 0x72u, 0x7Bu, 0x7Cu, 0x51u, 0x56u, 0x5Fu, 0x58u, 0x4Du, 0x4Au, 0x43u, 0x44u,
+      0x19u, 0x1Eu, 0x17u, 0x10u, 0x05u, 0x02u, 0x0Bu, 0x0Cu, 0x21u, 0x26u, 0x2Fu, 0x28u, 0x3Du, 0x3Au, 0x33u, 0x34u,
+      0x4Eu, 0x49u, 0x40u, 0x47u, 0x52u, 0x55u, 0x5Cu, 0x5Bu, 0x76u, 0x71u, 0x78u, 0x7Fu, 0x6Au, 0x6Du, 0x64u, 0x63u,
+      0x3Eu, 0x39u, 0x30u, 0x37u, 0x22u, 0x25u, 0x2Cu, 0x2Bu, 0x06u, 0x01u, 0x08u, 0x0Fu, 0x1Au, 0x1Du, 0x14u, 0x13u,
+      0xAEu, 0xA9u, 0xA0u, 0xA7u, 0xB2u, 0xB5u, 0xBCu, 0xBBu, 0x96u, 0x91u, 0x98u, 0x9Fu, 0x8Au, 0x8Du, 0x84u, 0x83u,
+      0xDEu, 0xD9u, 0xD0u, 0xD7u, 0xC2u, 0xC5u, 0xCCu, 0xCBu, 0xE6u, 0xE1u, 0xE8u, 0xEFu, 0xFAu, 0xFDu, 0xF4u, 0xF3u,
+  };
   uint8_t crc = 0x00u;
   if (data == NULL) {
     return crc;
   }
   for (size_t i = 0; i < len; ++i) {
-    crc ^= data[i];
-    for (uint8_t bit = 0u; bit < 8u; ++bit) {
-      if ((crc & 0x80u) != 0u) {
-        crc = (uint8_t)((crc << 1u) ^ 0x07u);
-      } else {
-        crc <<= 1u;
-      }
-    }
+    crc = kTable[crc ^ data[i]];
   }
   return crc;
 }
@@ -120,23 +203,226 @@ static inline bool uiLinkParseHexByte(const char* s, uint8_t* out) {
   return true;
 }
 
-static inline UiLinkMsgType uiLinkMsgTypeFromToken(const char* token) {
+static inline UiLinkMsgType uiLinkMsgTypeFromSlice(const char* token, size_t len) {
   if (token == NULL) {
     return UILINK_MSG_UNKNOWN;
   }
-  if (strcmp(token, "HELLO") == 0) return UILINK_MSG_HELLO;
-  if (strcmp(token, "ACK") == 0) return UILINK_MSG_ACK;
-  if (strcmp(token, "CAPS") == 0) return UILINK_MSG_CAPS;
-  if (strcmp(token, "STAT") == 0) return UILINK_MSG_STAT;
-  if (strcmp(token, "KEYFRAME") == 0) return UILINK_MSG_KEYFRAME;
-  if (strcmp(token, "BTN") == 0) return UILINK_MSG_BTN;
-  if (strcmp(token, "TOUCH") == 0) return UILINK_MSG_TOUCH;
-  if (strcmp(token, "CMD") == 0) return UILINK_MSG_CMD;
-  if (strcmp(token, "PING") == 0) return UILINK_MSG_PING;
-  if (strcmp(token, "PONG") == 0) return UILINK_MSG_PONG;
+  switch (len) {
+    case 3u:
+      if (memcmp(token, "ACK", 3u) == 0) return UILINK_MSG_ACK;
+      if (memcmp(token, "BTN", 3u) == 0) return UILINK_MSG_BTN;
+      if (memcmp(token, "CMD", 3u) == 0) return UILINK_MSG_CMD;
+      break;
+    case 4u:
+      if (memcmp(token, "CAPS", 4u) == 0) return UILINK_MSG_CAPS;
+      if (memcmp(token, "STAT", 4u) == 0) return UILINK_MSG_STAT;
+      if (memcmp(token, "PING", 4u) == 0) return UILINK_MSG_PING;
+      if (memcmp(token, "PONG", 4u) == 0) return UILINK_MSG_PONG;
+      break;
+    case 5u:
+      if (memcmp(token, "HELLO", 5u) == 0) return UILINK_MSG_HELLO;
+      if (memcmp(token, "TOUCH", 5u) == 0) return UILINK_MSG_TOUCH;
+      break;
+    case 8u:
+      if (memcmp(token, "KEYFRAME", 8u) == 0) return UILINK_MSG_KEYFRAME;
+      break;
+    default:
+      break;
+  }
   return UILINK_MSG_UNKNOWN;
 }
 
+static inline UiLinkMsgType uiLinkMsgTypeFromToken(const char* token) {
+  if (token == NULL) {
+    return UILINK_MSG_UNKNOWN;
+  }
+  return uiLinkMsgTypeFromSlice(token, strlen(token));
+}
+
+static inline UiLinkKey uiLinkKeyFromSlice(const char* s, size_t len) {
+  if (s == NULL) {
+    return UILINK_KEY_UNKNOWN;
+  }
+  switch (len) {
+    case 1u:
+      if (s[0] == 'x') return UILINK_KEY_X;
+      if (s[0] == 'y') return UILINK_KEY_Y;
+      break;
+    case 2u:
+      switch (s[0]) {
+        case 'f':
+          if (memcmp(s, "fw", 2u) == 0) return UILINK_KEY_FW;
+          if (memcmp(s, "fx", 2u) == 0) return UILINK_KEY_FX;
+          break;
+        case 'i':
+          if (memcmp(s, "id", 2u) == 0) return UILINK_KEY_ID;
+          break;
+        case 'l':
+          if (memcmp(s, "la", 2u) == 0) return UILINK_KEY_LA;
+          break;
+        case 'm':
+          if (memcmp(s, "ms", 2u) == 0) return UILINK_KEY_MS;
+          break;
+        case 'o':
+          if (memcmp(s, "op", 2u) == 0) return UILINK_KEY_OP;
+          break;
+        case 's':
+          if (memcmp(s, "sd", 2u) == 0) return UILINK_KEY_SD;
+          break;
+        case 't':
+          if (memcmp(s, "ts", 2u) == 0) return UILINK_KEY_TS;
+          break;
+        default:
+          break;
+      }
+      break;
+    case 3u:
+      switch (s[0]) {
+        case 'a':
+          if (memcmp(s, "app", 3u) == 0) return UILINK_KEY_APP;
+          if (memcmp(s, "arg", 3u) == 0) return UILINK_KEY_ARG;
+          break;
+        case 'e':
+          if (memcmp(s, "err", 3u) == 0) return UILINK_KEY_ERR;
+          break;
+        case 'k':
+          if (memcmp(s, "key", 3u) == 0) return UILINK_KEY_KEY;
+          break;
+        case 'm':
+          if (memcmp(s, "mic", 3u) == 0) return UILINK_KEY_MIC;
+          if (memcmp(s, "mp3", 3u) == 0) return UILINK_KEY_MP3;
+          break;
+        case 's':
+          if (memcmp(s, "seq", 3u) == 0) return UILINK_KEY_SEQ;
+          break;
+        case 'v':
+          if (memcmp(s, "vol", 3u) == 0) return UILINK_KEY_VOL;
+          break;
+        default:
+          break;
+      }
+      break;
+    case 4u:
+      switch (s[0]) {
+        case 'c':
+          if (memcmp(s, "caps", 4u) == 0) return UILINK_KEY_CAPS;
+          break;
+        case 'h':
+          if (memcmp(s, "hold", 4u) == 0) return UILINK_KEY_HOLD;
+          break;
+        case 'm':
+          if (memcmp(s, "mode", 4u) == 0) return UILINK_KEY_MODE;
+          break;
+        case 's':
+          if (memcmp(s, "scan", 4u) == 0) return UILINK_KEY_SCAN;
+          break;
+        default:
+          break;
+      }
+      break;
+    case 5u:
+      switch (s[0]) {
+        case 'p':
+          if (memcmp(s, "proto", 5u) == 0) return UILINK_KEY_PROTO;
+          break;
+        case 'q':
+          if (memcmp(s, "queue", 5u) == 0) return UILINK_KEY_QUEUE;
+          break;
+        case 't':
+          if (memcmp(s, "track", 5u) == 0) return UILINK_KEY_TRACK;
+          break;
+        case 'u':
+          if (memcmp(s, "u_son", 5u) == 0) return UILINK_KEY_U_SON;
+          if (memcmp(s, "ui_id", 5u) == 0) return UILINK_KEY_UI_ID;
+          break;
+        default:
+          break;
+      }
+      break;
+    case 6u:
+      switch (s[0]) {
+        case 'a':
+          if (memcmp(s, "action", 6u) == 0) return UILINK_KEY_ACTION;
+          break;
+        case 'r':
+          if (memcmp(s, "repeat", 6u) == 0) return UILINK_KEY_REPEAT;
+          break;
+        case 'u':
+          if (memcmp(s, "u_lock", 6u) == 0) return UILINK_KEY_U_LOCK;
+          break;
+        default:
+          break;
+      }
+      break;
+    case 7u:
+      switch (s[0]) {
+        case 'b':
+          if (memcmp(s, "backend", 7u) == 0) return UILINK_KEY_BACKEND;
+          break;
+        case 's':
+          if (memcmp(s, "session", 7u) == 0) return UILINK_KEY_SESSION;
+          if (memcmp(s, "startup", 7u) == 0) return UILINK_KEY_STARTUP;
+          break;
+        case 'u':
+          if (memcmp(s, "ui_page", 7u) == 0) return UILINK_KEY_UI_PAGE;
+          if (memcmp(s, "ui_type", 7u) == 0) return UILINK_KEY_UI_TYPE;
+          break;
+        default:
+          break;
+      }
+      break;
+    case 8u:
+      switch (s[0]) {
+        case 't':
+          if (memcmp(s, "tune_off", 8u) == 0) return UILINK_KEY_TUNE_OFF;
+          break;
+        case 'u':
+          if (memcmp(s, "ui_count", 8u) == 0) return UILINK_KEY_UI_COUNT;
+          break;
+        default:
+          break;
+      }
+      break;
+    case 9u:
+      switch (s[0]) {
+        case 'p':
+          if (memcmp(s, "proto_max", 9u) == 0) return UILINK_KEY_PROTO_MAX;
+          break;
+        case 't':
+          if (memcmp(s, "tune_conf", 9u) == 0) return UILINK_KEY_TUNE_CONF;
+          break;
+        case 'u':
+          if (memcmp(s, "ui_cursor", 9u) == 0) return UILINK_KEY_UI_CURSOR;
+          if (memcmp(s, "ui_offset", 9u) == 0) return UILINK_KEY_UI_OFFSET;
+          break;
+        default:
+          break;
+      }
+      break;
+    case 11u:
+      switch (s[0]) {
+        case 't':
+          if (memcmp(s, "track_total", 11u) == 0) return UILINK_KEY_TRACK_TOTAL;
+          break;
+        default:
+          break;
+      }
+      break;
+    case 13u:
+      switch (s[0]) {
+        case 'u':
+          if (memcmp(s, "u_lock_listen", 13u) == 0) return UILINK_KEY_U_LOCK_LISTEN;
+          break;
+        default:
+          break;
+      }
+      break;
+    default:
+      break;
+  }
+  return UILINK_KEY_UNKNOWN;
+}
+
 static inline UiBtnId uiBtnIdFromToken(const char* token) {
   if (token == NULL) {
     return UI_BTN_UNKNOWN;
@@ -196,112 +482,226 @@ static inline bool uiLinkCopyBounded(char* dst, size_t dst_len, const char* src,
   return true;
 }
 
-static inline bool uiLinkParseLine(const char* line, UiLinkFrame* out) {
-  if (line == NULL || out == NULL) {
+static inline bool uiLinkViewAddToken(UiLinkView* out, size_t start, size_t end) {
+  const char* line = out->line;
+  if (out->type_token.len == 0u) {
+    if (end == start || end - start >= UILINK_V2_TYPE_MAX) {
+      return false;
+    }
+    out->type_token.off = (uint16_t)start;
+    out->type_token.len = (uint16_t)(end - start);
+    out->type = uiLinkMsgTypeFromSlice(line + start, end - start);
+    return out->type != UILINK_MSG_UNKNOWN;
+  }
+  if (out->field_count >= UILINK_V2_MAX_FIELDS) {
     return false;
   }
+  const char* eq = (const char*)memchr(line + start, '=', end - start);
+  if (eq == NULL) {
+    return false;
+  }
+  const size_t key_len = (size_t)(eq - (line + start));
+  if (key_len == 0u || end - start <= key_len + 1u) {
+    return false;
+  }
+  const uint8_t index = out->field_count++;
+  out->keys[index].off = (uint16_t)start;
+  out->keys[index].len = (uint16_t)key_len;
+  out->values[index].off = (uint16_t)(start + key_len + 1u);
+  out->values[index].len = (uint16_t)(end - start - key_len - 1u);
+  const UiLinkKey key = uiLinkKeyFromSlice(line + start, key_len);
+  if (key != UILINK_KEY_UNKNOWN && out->key_field[key] == 0u) {
+    out->key_field[key] = (uint8_t)(index + 1u);
+  }
+  return true;
+}
 
-  memset(out, 0, sizeof(*out));
-
-  size_t line_len = strnlen(line, UILINK_V2_MAX_LINE + 1u);
-  if (line_len == 0u || line_len > UILINK_V2_MAX_LINE) {
+// Single pass over `line` (CRC + tokenizing); nothing is copied. A trailing
+// CR/LF is ignored. On CRC mismatch returns false with has_crc && !crc_ok.
+static inline bool uiLinkViewScan(const char* line, size_t len, UiLinkView* out) {
+  if (out == NULL) {
+    return false;
+  }
+  out->line = line;
+  out->type = UILINK_MSG_UNKNOWN;
+  out->type_token.off = 0u;
+  out->type_token.len = 0u;
+  out->field_count = 0u;
+  memset(out->key_field, 0, sizeof(out->key_field));
+  out->has_crc = false;
+  out->crc_expected = 0u;
+  out->crc_computed = 0u;
+  out->crc_ok = false;
+  if (line == NULL) {
     return false;
   }
 
-  while (line_len > 0u && (line[line_len - 1u] == '\n' || line[line_len - 1u] == '\r')) {
-    --line_len;
+  while (len > 0u && (line[len - 1u] == '\n' || line[len - 1u] == '\r')) {
+    --len;
   }
-  if (line_len == 0u) {
+  if (len == 0u || len > UILINK_V2_MAX_LINE) {
     return false;
   }
 
-  const char* line_end = line + line_len;
-  const char* star = static_cast<const char*>(memchr(line, '*', line_len));
-  size_t payload_len = line_len;
+  const char* star = (const char*)memchr(line, '*', len);
+  size_t payload_len = len;
   if (star != NULL) {
     out->has_crc = true;
-    payload_len = static_cast<size_t>(star - line);
-    const size_t crc_index = payload_len + 1u;
-    if (crc_index + 2u != line_len) {
-      return false;
-    }
-    if (!uiLinkParseHexByte(&line[crc_index], &out->crc_expected)) {
+    payload_len = (size_t)(star - line);
+    if (payload_len + 3u != len || !uiLinkParseHexByte(star + 1, &out->crc_expected)) {
       return false;
     }
   }
-
-  if (payload_len == 0u || payload_len > UILINK_V2_MAX_LINE) {
+  if (payload_len == 0u) {
     return false;
   }
 
-  out->crc_computed = uiLinkCrc8(reinterpret_cast<const uint8_t*>(line), payload_len);
+  out->crc_computed = uiLinkCrc8((const uint8_t*)line, payload_len);
   out->crc_ok = (!out->has_crc) || (out->crc_expected == out->crc_computed);
-  if (out->has_crc && !out->crc_ok) {
+  if (!out->crc_ok) {
     return false;
   }
 
-  const char* payload_end = line + payload_len;
-  const char* cursor = line;
-  const char* comma =
-      static_cast<const char*>(memchr(cursor, ',', static_cast<size_t>(payload_end - cursor)));
-  if (comma == NULL) {
-    if (!uiLinkCopyBounded(out->type_token, sizeof(out->type_token), cursor, payload_len)) {
-      return false;
+  size_t token_start = 0u;
+  for (size_t i = 0u; i < payload_len; ++i) {
+    if (line[i] == ',') {
+      if (!uiLinkViewAddToken(out, token_start, i)) {
+        return false;
+      }
+      token_start = i + 1u;
     }
-    out->type = uiLinkMsgTypeFromToken(out->type_token);
-    return out->type != UILINK_MSG_UNKNOWN;
   }
+  if (token_start == payload_len && out->type_token.len > 0u) {
+    return true;  // trailing comma, accepted like the historical parser
+  }
+  return uiLinkViewAddToken(out, token_start, payload_len);
+}
 
-  const size_t type_len = static_cast<size_t>(comma - cursor);
-  if (!uiLinkCopyBounded(out->type_token, sizeof(out->type_token), cursor, type_len)) {
+static inline bool uiLinkViewFind(const UiLinkView* view, UiLinkKey key, UiLinkSlice* out) {
+  if (view == NULL || key <= UILINK_KEY_UNKNOWN || key >= UILINK_KEY_COUNT || view->key_field[key] == 0u) {
     return false;
   }
-  out->type = uiLinkMsgTypeFromToken(out->type_token);
-  if (out->type == UILINK_MSG_UNKNOWN) {
+  if (out != NULL) {
+    *out = view->values[view->key_field[key] - 1u];
+  }
+  return true;
+}
+
+static inline bool uiLinkViewEquals(const UiLinkView* view, UiLinkKey key, const char* literal) {
+  UiLinkSlice value;
+  if (literal == NULL || !uiLinkViewFind(view, key, &value)) {
     return false;
   }
+  return strlen(literal) == value.len && memcmp(view->line + value.off, literal, value.len) == 0;
+}
 
-  cursor = comma + 1u;
-  while (cursor < payload_end) {
-    if (out->field_count >= UILINK_V2_MAX_FIELDS) {
+static inline bool uiLinkViewU32(const UiLinkView* view, UiLinkKey key, uint32_t* out) {
+  UiLinkSlice value;
+  if (out == NULL || !uiLinkViewFind(view, key, &value) || value.len > 10u) {
+    return false;
+  }
+  uint64_t result = 0u;
+  for (uint16_t i = 0u; i < value.len; ++i) {
+    const char c = view->line[value.off + i];
+    if (c < '0' || c > '9') {
       return false;
     }
+    result = result * 10u + (uint64_t)(c - '0');
+  }
+  if (result > 0xFFFFFFFFull) {
+    return false;
+  }
+  *out = (uint32_t)result;
+  return true;
+}
 
-    const size_t remaining = static_cast<size_t>(payload_end - cursor);
-    const char* next = static_cast<const char*>(memchr(cursor, ',', remaining));
-    const size_t token_len = (next == NULL) ? remaining : static_cast<size_t>(next - cursor);
-    if (token_len == 0u) {
+static inline bool uiLinkViewI32(const UiLinkView* view, UiLinkKey key, int32_t* out) {
+  UiLinkSlice value;
+  if (out == NULL || !uiLinkViewFind(view, key, &value) || value.len > 11u) {
+    return false;
+  }
+  uint16_t i = 0u;
+  bool negative = false;
+  if (view->line[value.off] == '-' || view->line[value.off] == '+') {
+    negative = view->line[value.off] == '-';
+    ++i;
+  }
+  if (i >= value.len) {
+    return false;
+  }
+  int64_t result = 0;
+  for (; i < value.len; ++i) {
+    const char c = view->line[value.off + i];
+    if (c < '0' || c > '9') {
       return false;
     }
+    result = result * 10 + (c - '0');
+  }
+  result = negative ? -result : result;
+  if (result < INT32_MIN || result > INT32_MAX) {
+    return false;
+  }
+  *out = (int32_t)result;
+  return true;
+}
 
-    const char* eq = static_cast<const char*>(memchr(cursor, '=', token_len));
-    if (eq == NULL) {
-      return false;
-    }
-    const size_t key_len = static_cast<size_t>(eq - cursor);
-    if (key_len == 0u) {
-      return false;
-    }
-    if (token_len <= key_len + 1u) {
-      return false;
-    }
-    const size_t value_len = token_len - key_len - 1u;
+static inline bool uiLinkViewBool(const UiLinkView* view, UiLinkKey key, bool* out) {
+  if (out == NULL) {
+    return false;
+  }
+  if (uiLinkViewEquals(view, key, "1") || uiLinkViewEquals(view, key, "true")) {
+    *out = true;
+    return true;
+  }
+  if (uiLinkViewEquals(view, key, "0") || uiLinkViewEquals(view, key, "false")) {
+    *out = false;
+    return true;
+  }
+  return false;
+}
 
-    UiLinkField* field = &out->fields[out->field_count];
-    if (!uiLinkCopyBounded(field->key, sizeof(field->key), cursor, key_len)) {
-      return false;
-    }
-    if (!uiLinkCopyBounded(field->value, sizeof(field->value), eq + 1u, value_len)) {
-      return false;
-    }
+// Copies a slice into a NUL-terminated buffer; false when it does not fit.
+static inline bool uiLinkViewCopy(const UiLinkView* view, UiLinkSlice slice, char* dst, size_t dst_len) {
+  if (view == NULL || view->line == NULL) {
+    return false;
+  }
+  return uiLinkCopyBounded(dst, dst_len, view->line + slice.off, slice.len);
+}
 
-    ++out->field_count;
-    if (next == NULL) {
-      break;
-    }
-    cursor = next + 1u;
+// Compatibility wrapper: scans in place, then copies into the fixed-size frame.
+static inline bool uiLinkParseLine(const char* line, UiLinkFrame* out) {
+  if (line == NULL || out == NULL) {
+    return false;
+  }
+  out->type = UILINK_MSG_UNKNOWN;
+  out->type_token[0] = '\0';
+  out->field_count = 0u;
+
+  // Length limit applies before CR/LF stripping, as it always has.
+  const size_t line_len = strnlen(line, UILINK_V2_MAX_LINE + 1u);
+  UiLinkView view;
+  const bool ok = uiLinkViewScan(line, (line_len > UILINK_V2_MAX_LINE) ? 0u : line_len, &view);
+  out->has_crc = view.has_crc;
+  out->crc_expected = view.crc_expected;
+  out->crc_computed = view.crc_computed;
+  out->crc_ok = view.crc_ok;
+  if (!ok) {
+    return false;
   }
 
+  if (!uiLinkViewCopy(&view, view.type_token, out->type_token, sizeof(out->type_token))) {
+    return false;
+  }
+  for (uint8_t i = 0u; i < view.field_count; ++i) {
+    UiLinkField* field = &out->fields[i];
+    if (!uiLinkViewCopy(&view, view.keys[i], field->key, sizeof(field->key)) ||
+        !uiLinkViewCopy(&view, view.values[i], field->value, sizeof(field->value))) {
+      out->field_count = 0u;
+      return false;
+    }
+  }
+  out->field_count = view.field_count;
+  out->type = view.type;
   return true;
 }
 
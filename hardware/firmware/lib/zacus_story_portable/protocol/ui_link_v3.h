@@ -0,0 +1,505 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// UI Link v3: COBS-framed binary messages negotiated over a v2 HELLO/ACK.
+// See ui_link_v3.md for the wire format and the keyframe/delta rules.
+
+enum {
+  UILINK_V3_PROTO = 3,
+  UILINK_V3_MAX_ITEMS = 32,
+  // type + ref + seq + ms + count + items + crc16
+  UILINK_V3_MAX_RAW = 2 + 5 + 5 + 1 + (UILINK_V3_MAX_ITEMS * 6) + 2,
+  // COBS adds one byte per 254 plus the leading code byte; +1 for the 0x00 delimiter.
+  UILINK_V3_MAX_FRAME = UILINK_V3_MAX_RAW + (UILINK_V3_MAX_RAW / 254) + 2,
+  UILINK_V3_KEYFRAME_PERIOD_MS = 1000,
+  UILINK_V3_KEYFRAME_RETRY_MS = 250,
+  UILINK_V3_BASE_SLOTS = 2,
+};
+
+typedef enum UiLinkV3MsgType {
+  UILINK_V3_MSG_UNKNOWN = 0x00,
+  // ESP32 -> UI
+  UILINK_V3_MSG_KEYFRAME = 0x10,
+  UILINK_V3_MSG_STAT = 0x11,
+  UILINK_V3_MSG_PING = 0x12,
+  // UI -> ESP32
+  UILINK_V3_MSG_KEYFRAME_ACK = 0x20,
+  UILINK_V3_MSG_PONG = 0x21,
+  UILINK_V3_MSG_BTN = 0x22,
+  UILINK_V3_MSG_TOUCH = 0x23,
+  UILINK_V3_MSG_CMD = 0x24,
+} UiLinkV3MsgType;
+
+// State field ids (KEYFRAME/STAT items). Wire id == array index; append only.
+typedef enum UiLinkV3Field {
+  UILINK_V3_F_MODE = 0,
+  UILINK_V3_F_LA,
+  UILINK_V3_F_MP3,
+  UILINK_V3_F_SD,
+  UILINK_V3_F_KEY,
+  UILINK_V3_F_TRACK,
+  UILINK_V3_F_TRACK_TOTAL,
+  UILINK_V3_F_VOL,
+  UILINK_V3_F_U_LOCK,
+  UILINK_V3_F_U_SON,
+  UILINK_V3_F_TUNE_OFF,
+  UILINK_V3_F_TUNE_CONF,
+  UILINK_V3_F_U_LOCK_LISTEN,
+  UILINK_V3_F_MIC,
+  UILINK_V3_F_HOLD,
+  UILINK_V3_F_STARTUP,
+  UILINK_V3_F_APP,
+  UILINK_V3_F_UI_PAGE,
+  UILINK_V3_F_REPEAT,
+  UILINK_V3_F_FX,
+  UILINK_V3_F_BACKEND,
+  UILINK_V3_F_SCAN,
+  UILINK_V3_F_ERR,
+  UILINK_V3_F_UI_CURSOR,
+  UILINK_V3_F_UI_OFFSET,
+  UILINK_V3_F_UI_COUNT,
+  UILINK_V3_F_QUEUE,
+  UILINK_V3_F_MIC_SCOPE,
+  UILINK_V3_F_COUNT,
+} UiLinkV3Field;
+
+// Item ids for UI -> ESP32 messages.
+typedef enum UiLinkV3InputField {
+  UILINK_V3_IN_BTN_ID = 0,
+  UILINK_V3_IN_BTN_ACTION,
+  UILINK_V3_IN_TOUCH_X,
+  UILINK_V3_IN_TOUCH_Y,
+  UILINK_V3_IN_TOUCH_ACTION,
+  UILINK_V3_IN_CMD_OP,
+} UiLinkV3InputField;
+
+typedef enum UiLinkV3Mode {
+  UILINK_V3_MODE_SIGNAL = 0,
+  UILINK_V3_MODE_MP3,
+  UILINK_V3_MODE_U_LOCK,
+  UILINK_V3_MODE_STORY,
+} UiLinkV3Mode;
+
+typedef enum UiLinkV3CmdOp {
+  UILINK_V3_CMD_UNKNOWN = 0,
+  UILINK_V3_CMD_REQUEST_KEYFRAME,
+} UiLinkV3CmdOp;
+
+typedef enum UiLinkV3DecodeResult {
+  UILINK_V3_DECODE_OK = 0,
+  UILINK_V3_DECODE_ERR_FRAMING,
+  UILINK_V3_DECODE_ERR_CRC,
+  UILINK_V3_DECODE_ERR_FORMAT,
+} UiLinkV3DecodeResult;
+
+// One message. `ref` is the keyframe id (KEYFRAME, KEYFRAME_ACK) or the base
+// keyframe id a STAT delta applies to; `ms` carries the UI timestamp on input.
+typedef struct UiLinkV3Msg {
+  uint8_t type;
+  uint8_t ref;
+  uint32_t seq;
+  uint32_t ms;
+  uint8_t count;
+  uint8_t ids[UILINK_V3_MAX_ITEMS];
+  int32_t values[UILINK_V3_MAX_ITEMS];
+} UiLinkV3Msg;
+
+// Byte accumulator for 0x00-delimited frames.
+typedef struct UiLinkV3Rx {
+  uint8_t buf[UILINK_V3_MAX_FRAME];
+  uint16_t len;
+  bool overflow;
+} UiLinkV3Rx;
+
+// UI-side state rebuilt from KEYFRAME + STAT. Keeps the last two keyframes so a
+// delta against the previous base still applies while a new keyframe is acked.
+typedef struct UiLinkV3Mirror {
+  int32_t values[UILINK_V3_F_COUNT];
+  int32_t base_values[UILINK_V3_BASE_SLOTS][UILINK_V3_F_COUNT];
+  uint8_t base_id[UILINK_V3_BASE_SLOTS];
+  bool base_valid[UILINK_V3_BASE_SLOTS];
+  uint8_t next_slot;
+  uint32_t seq;
+  uint32_t ms;
+  bool valid;
+} UiLinkV3Mirror;
+
+typedef enum UiLinkV3ApplyResult {
+  UILINK_V3_APPLY_IGNORED = 0,
+  UILINK_V3_APPLY_KEYFRAME,      // caller acks msg.ref
+  UILINK_V3_APPLY_DELTA,
+  UILINK_V3_APPLY_NEED_KEYFRAME,  // unknown base: caller requests a keyframe
+} UiLinkV3ApplyResult;
+
+// CRC16-CCITT (poly 0x1021, init 0xFFFF, no reflection, no xorout).
+static inline uint16_t uiLinkCrc16(const uint8_t* data, size_t len) {
+  static const uint16_t kTable[256] = {
+      0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+      0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+      0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+      0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+      0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+      0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+      0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+      0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+      0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+      0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+      0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+      0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+      0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+      0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+      0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+      0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+      0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+      0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+      0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+      0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+      0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+      0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+      0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+      0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+      0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+      0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+      0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+      0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+      0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+      0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+      0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+      0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u,
+  };
+  uint16_t crc = 0xFFFFu;
+  if (data == NULL) {
+    return crc;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    crc = (uint16_t)((crc << 8u) ^ kTable[((crc >> 8u) ^ data[i]) & 0xFFu]);
+  }
+  return crc;
+}
+
+// COBS encode without the trailing delimiter. Returns 0 when dst is too small.
+static inline size_t uiLinkCobsEncode(const uint8_t* src, size_t len, uint8_t* dst, size_t dst_size) {
+  if (src == NULL || dst == NULL || dst_size < len + (len / 254u) + 1u) {
+    return 0u;
+  }
+  size_t code_index = 0u;
+  size_t out = 1u;
+  uint8_t code = 1u;
+  for (size_t i = 0u; i < len; ++i) {
+    if (src[i] != 0u) {
+      dst[out++] = src[i];
+      ++code;
+    }
+    if (src[i] == 0u || code == 0xFFu) {
+      dst[code_index] = code;
+      code = 1u;
+      code_index = out++;
+    }
+  }
+  dst[code_index] = code;
+  return out;
+}
+
+// COBS decode of one frame (delimiter excluded). Returns 0 on malformed input.
+static inline size_t uiLinkCobsDecode(const uint8_t* src, size_t len, uint8_t* dst, size_t dst_size) {
+  if (src == NULL || dst == NULL || len == 0u) {
+    return 0u;
+  }
+  size_t in = 0u;
+  size_t out = 0u;
+  while (in < len) {
+    const uint8_t code = src[in++];
+    if (code == 0u || in + code - 1u > len) {
+      return 0u;
+    }
+    for (uint8_t i = 1u; i < code; ++i) {
+      if (out >= dst_size) {
+        return 0u;
+      }
+      dst[out++] = src[in++];
+    }
+    if (code != 0xFFu && in < len) {
+      if (out >= dst_size) {
+        return 0u;
+      }
+      dst[out++] = 0u;
+    }
+  }
+  return out;
+}
+
+static inline size_t uiLinkV3PutVarint(uint8_t* out, size_t pos, size_t cap, uint32_t value) {
+  do {
+    if (pos >= cap) {
+      return 0u;
+    }
+    uint8_t byte = (uint8_t)(value & 0x7Fu);
+    value >>= 7u;
+    if (value != 0u) {
+      byte |= 0x80u;
+    }
+    out[pos++] = byte;
+  } while (value != 0u);
+  return pos;
+}
+
+static inline bool uiLinkV3GetVarint(const uint8_t* in, size_t len, size_t* pos, uint32_t* value) {
+  uint32_t result = 0u;
+  for (uint8_t shift = 0u; shift < 35u; shift = (uint8_t)(shift + 7u)) {
+    if (*pos >= len) {
+      return false;
+    }
+    const uint8_t byte = in[(*pos)++];
+    result |= (uint32_t)(byte & 0x7Fu) << shift;
+    if ((byte & 0x80u) == 0u) {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+static inline uint32_t uiLinkV3ZigZag(int32_t value) {
+  return ((uint32_t)value << 1u) ^ (uint32_t)(value >> 31);
+}
+
+static inline int32_t uiLinkV3UnZigZag(uint32_t value) {
+  return (int32_t)((value >> 1u) ^ (0u - (value & 1u)));
+}
+
+static inline void uiLinkV3InitMsg(UiLinkV3Msg* msg, uint8_t type, uint8_t ref, uint32_t seq, uint32_t ms) {
+  if (msg == NULL) {
+    return;
+  }
+  msg->type = type;
+  msg->ref = ref;
+  msg->seq = seq;
+  msg->ms = ms;
+  msg->count = 0u;
+}
+
+static inline bool uiLinkV3AddItem(UiLinkV3Msg* msg, uint8_t id, int32_t value) {
+  if (msg == NULL || msg->count >= UILINK_V3_MAX_ITEMS) {
+    return false;
+  }
+  msg->ids[msg->count] = id;
+  msg->values[msg->count] = value;
+  ++msg->count;
+  return true;
+}
+
+static inline const int32_t* uiLinkV3FindItem(const UiLinkV3Msg* msg, uint8_t id) {
+  if (msg == NULL) {
+    return NULL;
+  }
+  for (uint8_t i = 0u; i < msg->count; ++i) {
+    if (msg->ids[i] == id) {
+      return &msg->values[i];
+    }
+  }
+  return NULL;
+}
+
+// Encodes msg as a COBS frame including the 0x00 delimiter; 0 on overflow.
+static inline size_t uiLinkV3Encode(const UiLinkV3Msg* msg, uint8_t* out, size_t out_size) {
+  if (msg == NULL || out == NULL || msg->count > UILINK_V3_MAX_ITEMS) {
+    return 0u;
+  }
+  uint8_t raw[UILINK_V3_MAX_RAW];
+  size_t len = 0u;
+  raw[len++] = msg->type;
+  raw[len++] = msg->ref;
+  len = uiLinkV3PutVarint(raw, len, sizeof(raw), msg->seq);
+  len = (len == 0u) ? 0u : uiLinkV3PutVarint(raw, len, sizeof(raw), msg->ms);
+  if (len == 0u) {
+    return 0u;
+  }
+  raw[len++] = msg->count;
+  for (uint8_t i = 0u; i < msg->count; ++i) {
+    raw[len++] = msg->ids[i];
+    len = uiLinkV3PutVarint(raw, len, sizeof(raw), uiLinkV3ZigZag(msg->values[i]));
+    if (len == 0u) {
+      return 0u;
+    }
+  }
+  const uint16_t crc = uiLinkCrc16(raw, len);
+  raw[len++] = (uint8_t)(crc >> 8u);
+  raw[len++] = (uint8_t)(crc & 0xFFu);
+
+  if (out_size == 0u) {
+    return 0u;
+  }
+  const size_t encoded = uiLinkCobsEncode(raw, len, out, out_size - 1u);
+  if (encoded == 0u) {
+    return 0u;
+  }
+  out[encoded] = 0u;
+  return encoded + 1u;
+}
+
+// Decodes one COBS frame (without its delimiter).
+static inline UiLinkV3DecodeResult uiLinkV3Decode(const uint8_t* frame, size_t len, UiLinkV3Msg* out) {
+  if (frame == NULL || out == NULL) {
+    return UILINK_V3_DECODE_ERR_FORMAT;
+  }
+  uint8_t raw[UILINK_V3_MAX_RAW];
+  const size_t raw_len = uiLinkCobsDecode(frame, len, raw, sizeof(raw));
+  if (raw_len < 7u) {
+    return UILINK_V3_DECODE_ERR_FRAMING;
+  }
+  const uint16_t expected = (uint16_t)(((uint16_t)raw[raw_len - 2u] << 8u) | raw[raw_len - 1u]);
+  if (uiLinkCrc16(raw, raw_len - 2u) != expected) {
+    return UILINK_V3_DECODE_ERR_CRC;
+  }
+
+  const size_t body_len = raw_len - 2u;
+  size_t pos = 2u;
+  uiLinkV3InitMsg(out, raw[0], raw[1], 0u, 0u);
+  if (!uiLinkV3GetVarint(raw, body_len, &pos, &out->seq) ||
+      !uiLinkV3GetVarint(raw, body_len, &pos, &out->ms) || pos >= body_len) {
+    return UILINK_V3_DECODE_ERR_FORMAT;
+  }
+  const uint8_t count = raw[pos++];
+  if (count > UILINK_V3_MAX_ITEMS) {
+    return UILINK_V3_DECODE_ERR_FORMAT;
+  }
+  for (uint8_t i = 0u; i < count; ++i) {
+    uint32_t zz = 0u;
+    if (pos >= body_len) {
+      return UILINK_V3_DECODE_ERR_FORMAT;
+    }
+    out->ids[i] = raw[pos++];
+    if (!uiLinkV3GetVarint(raw, body_len, &pos, &zz)) {
+      return UILINK_V3_DECODE_ERR_FORMAT;
+    }
+    out->values[i] = uiLinkV3UnZigZag(zz);
+  }
+  out->count = count;
+  return (pos == body_len) ? UILINK_V3_DECODE_OK : UILINK_V3_DECODE_ERR_FORMAT;
+}
+
+static inline void uiLinkV3RxReset(UiLinkV3Rx* rx) {
+  if (rx != NULL) {
+    rx->len = 0u;
+    rx->overflow = false;
+  }
+}
+
+// Feeds one byte. Returns the frame length (delimiter excluded) when a complete
+// frame sits in rx->buf, 0 otherwise. Overlong frames are dropped whole.
+static inline size_t uiLinkV3RxPush(UiLinkV3Rx* rx, uint8_t byte) {
+  if (rx == NULL) {
+    return 0u;
+  }
+  if (byte == 0u) {
+    const size_t len = rx->overflow ? 0u : rx->len;
+    rx->len = 0u;
+    rx->overflow = false;
+    return len;
+  }
+  if (rx->len >= sizeof(rx->buf)) {
+    rx->overflow = true;
+    return 0u;
+  }
+  rx->buf[rx->len++] = byte;
+  return 0u;
+}
+
+// Writes every field of `values` differing from `base` (or all when base is NULL).
+static inline uint8_t uiLinkV3AddStateItems(UiLinkV3Msg* msg, const int32_t* values, const int32_t* base) {
+  uint8_t added = 0u;
+  if (msg == NULL || values == NULL) {
+    return 0u;
+  }
+  for (uint8_t id = 0u; id < UILINK_V3_F_COUNT; ++id) {
+    if (base != NULL && base[id] == values[id]) {
+      continue;
+    }
+    if (!uiLinkV3AddItem(msg, id, values[id])) {
+      break;
+    }
+    ++added;
+  }
+  return added;
+}
+
+static inline void uiLinkV3MirrorReset(UiLinkV3Mirror* mirror) {
+  if (mirror != NULL) {
+    memset(mirror, 0, sizeof(*mirror));
+  }
+}
+
+static inline UiLinkV3ApplyResult uiLinkV3MirrorApply(UiLinkV3Mirror* mirror, const UiLinkV3Msg* msg) {
+  if (mirror == NULL || msg == NULL) {
+    return UILINK_V3_APPLY_IGNORED;
+  }
+  if (msg->type == UILINK_V3_MSG_KEYFRAME) {
+    uint8_t slot = mirror->next_slot;
+    for (uint8_t i = 0u; i < UILINK_V3_BASE_SLOTS; ++i) {
+      if (mirror->base_valid[i] && mirror->base_id[i] == msg->ref) {
+        slot = i;
+      }
+    }
+    int32_t* base = mirror->base_values[slot];
+    memcpy(base, mirror->values, sizeof(mirror->values));
+    for (uint8_t i = 0u; i < msg->count; ++i) {
+      if (msg->ids[i] < UILINK_V3_F_COUNT) {
+        base[msg->ids[i]] = msg->values[i];
+      }
+    }
+    mirror->base_id[slot] = msg->ref;
+    mirror->base_valid[slot] = true;
+    if (slot == mirror->next_slot) {
+      mirror->next_slot = (uint8_t)((slot + 1u) % UILINK_V3_BASE_SLOTS);
+    }
+    memcpy(mirror->values, base, sizeof(mirror->values));
+    mirror->seq = msg->seq;
+    mirror->ms = msg->ms;
+    mirror->valid = true;
+    return UILINK_V3_APPLY_KEYFRAME;
+  }
+  if (msg->type != UILINK_V3_MSG_STAT) {
+    return UILINK_V3_APPLY_IGNORED;
+  }
+  for (uint8_t slot = 0u; slot < UILINK_V3_BASE_SLOTS; ++slot) {
+    if (!mirror->base_valid[slot] || mirror->base_id[slot] != msg->ref) {
+      continue;
+    }
+    memcpy(mirror->values, mirror->base_values[slot], sizeof(mirror->values));
+    for (uint8_t i = 0u; i < msg->count; ++i) {
+      if (msg->ids[i] < UILINK_V3_F_COUNT) {
+        mirror->values[msg->ids[i]] = msg->values[i];
+      }
+    }
+    mirror->seq = msg->seq;
+    mirror->ms = msg->ms;
+    return UILINK_V3_APPLY_DELTA;
+  }
+  return UILINK_V3_APPLY_NEED_KEYFRAME;
+}
+
+static inline const char* uiLinkV3ModeToken(int32_t mode) {
+  switch (mode) {
+    case UILINK_V3_MODE_MP3:
+      return "MP3";
+    case UILINK_V3_MODE_U_LOCK:
+      return "U_LOCK";
+    case UILINK_V3_MODE_STORY:
+      return "STORY";
+    case UILINK_V3_MODE_SIGNAL:
+    default:
+      return "SIGNAL";
+  }
+}
+
+#ifdef __cplusplus
+}
+#endif
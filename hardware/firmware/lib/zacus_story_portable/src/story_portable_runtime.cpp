@@ -458,6 +458,12 @@ StoryPortableSnapshot StoryPortableRuntime::snapshot(bool enabled, uint32_t nowM
   out.scenarioFromLittleFs = scenarioFromLittleFs_;
   out.lastError = lastError_;
   out.runtimeState = stateLabel();
+  if (scenarioFromLittleFs_ && fsManager_ != nullptr) {
+    const StoryScenarioLoadStats& load = fsManager_->lastLoadStats();
+    out.scenarioLoadMs = load.loadMs;
+    out.scenarioLoadPeakHeap = load.peakHeapBytes;
+    out.scenarioArenaBytes = load.arenaBytes;
+  }
 
   if (controllerV2_ == nullptr) {
     return out;
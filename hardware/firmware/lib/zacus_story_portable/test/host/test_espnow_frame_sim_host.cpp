@@ -0,0 +1,451 @@
+// Host test: ESP-NOW frame v1 codec checks, then a loopback simulator (shared
+// 1 Mbit/s medium, random loss) comparing batched sliding-window links with a
+// stop-and-wait baseline: throughput, latency, retransmissions. `lost` counts
+// events not delivered, either expired after max_tries or still queued when a
+// run hits the time limit (stop-and-wait under heavy loss).
+// Build/run: make espnow-frame-sim-host
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <vector>
+
+#include "espnow_frame_v1.h"
+
+#include "host_check.h"
+
+namespace {
+
+struct Collected {
+  std::vector<uint8_t> types;
+  std::vector<std::vector<uint8_t>> records;
+};
+
+void collectRecord(void* ctx, uint8_t type, const uint8_t* data, uint8_t len) {
+  Collected* out = static_cast<Collected*>(ctx);
+  out->types.push_back(type);
+  out->records.emplace_back(data, data + len);
+}
+
+size_t pollOne(EspNowLink* link, uint32_t now_ms, uint8_t* frame) {
+  return espNowLinkPoll(link, now_ms, frame, ESPNOW_FRAME_MAX);
+}
+
+void runCodecChecks() {
+  EspNowLink a;
+  EspNowLink b;
+  espNowLinkInit(&a, 7u);
+  espNowLinkInit(&b, 9u);
+  uint8_t frame[ESPNOW_FRAME_MAX];
+
+  const char* events[] = {"SERIAL:BTN_NEXT", "UNLOCK", "SCENE_DONE"};
+  for (const char* event : events) {
+    check(espNowLinkQueue(&a, ESPNOW_REC_EVENT, reinterpret_cast<const uint8_t*>(event), strlen(event), true, 0u),
+          "queue event");
+  }
+  check(pollOne(&a, 1u, frame) == 0u, "open frame waits for the batch delay");
+  size_t len = pollOne(&a, ESPNOW_FRAME_DEFAULT_BATCH_MS, frame);
+  check(len == ESPNOW_FRAME_HEADER + 3u * ESPNOW_FRAME_RECORD_HEADER + 15u + 6u + 10u, "three records, one frame");
+
+  Collected got;
+  check(espNowLinkReceive(&b, frame, len, 5u, collectRecord, &got), "receive batch");
+  check(got.records.size() == 3u && got.records[1] == std::vector<uint8_t>({'U', 'N', 'L', 'O', 'C', 'K'}),
+        "records in order");
+  check(espNowLinkReceive(&b, frame, len, 6u, collectRecord, &got) && got.records.size() == 3u, "duplicate dropped");
+  check(b.stats.rx_duplicates == 1u, "duplicate counted");
+
+  // Duplicate forces an immediate bare ack; it frees A's slot.
+  len = pollOne(&b, 6u, frame);
+  check(len == ESPNOW_FRAME_HEADER, "bare ack");
+  check(espNowLinkReceive(&a, frame, len, 7u, nullptr, nullptr) && espNowLinkInFlight(&a) == 0u, "ack frees the slot");
+  check(a.stats.rtt_samples == 1u && a.stats.rtt_max_ms == 3u, "rtt sample");
+
+  // Command and result records.
+  check(espNowLinkQueueCommand(&a, 0x1234u, "SCENE intro", 11u, 10u), "queue command");
+  len = pollOne(&a, 20u, frame);
+  got = Collected();
+  check(espNowLinkReceive(&b, frame, len, 20u, collectRecord, &got) && got.types.size() == 1u &&
+            got.types[0] == ESPNOW_REC_COMMAND,
+        "command record");
+  uint16_t request_id = 0u;
+  const char* line = nullptr;
+  uint8_t line_len = 0u;
+  check(espNowRecordParseCommand(got.records[0].data(), static_cast<uint8_t>(got.records[0].size()), &request_id, &line,
+                                 &line_len) &&
+            request_id == 0x1234u && line_len == 11u && memcmp(line, "SCENE intro", 11u) == 0,
+        "command parse");
+  check(espNowLinkQueueResult(&b, request_id, false, "missing_scene_id", "{}", 2u, 21u, true), "queue result");
+  len = pollOne(&b, 21u, frame);  // ack pending: the open frame goes out now, ack piggybacked
+  check(len != 0u && (frame[1] & ESPNOW_FRAME_FLAG_ACK) != 0u, "result carries the ack");
+  got = Collected();
+  check(espNowLinkReceive(&a, frame, len, 22u, collectRecord, &got) && espNowLinkInFlight(&a) == 0u,
+        "piggybacked ack");
+  EspNowResultView result;
+  check(got.records.size() == 1u &&
+            espNowRecordParseResult(got.records[0].data(), static_cast<uint8_t>(got.records[0].size()), &result) &&
+            result.request_id == 0x1234u && !result.ok && result.code_len == 16u && result.data_len == 2u,
+        "result parse");
+
+  // Malformed frames.
+  uint8_t bad[ESPNOW_FRAME_MAX];
+  memcpy(bad, frame, len);
+  bad[len - 1u] = 0u;
+  check(!espNowLinkReceive(&a, bad, len - 1u, 23u, nullptr, nullptr), "truncated record rejected");
+  bad[0] = '{';
+  check(!espNowFrameIsBinary(bad, len), "JSON is not binary");
+  check(a.stats.rx_invalid == 1u, "invalid counted");
+  uint8_t too_big[ESPNOW_FRAME_MAX_RECORD + 1u] = {};
+  check(!espNowLinkQueue(&a, ESPNOW_REC_TEXT, too_big, sizeof(too_big), true, 30u), "oversized record refused");
+
+  // Sender restart: new epoch, seq back to 0, must not be taken for a duplicate.
+  EspNowLink restarted;
+  espNowLinkInit(&restarted, 8u);
+  check(espNowLinkQueue(&restarted, ESPNOW_REC_EVENT, reinterpret_cast<const uint8_t*>("X"), 1u, true, 0u),
+        "queue after restart");
+  len = pollOne(&restarted, 100u, frame);
+  got = Collected();
+  check(espNowLinkReceive(&b, frame, len, 100u, collectRecord, &got) && got.records.size() == 1u,
+        "new epoch delivered");
+  check(b.stats.rx_resyncs == 1u, "resync counted");
+
+  // Window: a full window refuses more records; expiry frees it.
+  EspNowLink w;
+  espNowLinkInit(&w, 3u);
+  w.window = 2u;
+  w.max_records = 1u;
+  const uint8_t byte = 0x42u;
+  uint32_t queued = 0u;
+  while (espNowLinkQueue(&w, ESPNOW_REC_EVENT, &byte, 1u, true, 0u)) {
+    ++queued;
+  }
+  check(queued == 3u && w.stats.tx_blocked == 1u, "window back-pressure (2 slots + open frame)");
+  uint32_t now = 0u;
+  uint32_t sent = 0u;
+  for (; now < 20000u && !espNowLinkIdle(&w); ++now) {
+    while (pollOne(&w, now, frame) != 0u) {
+      ++sent;
+    }
+  }
+  check(espNowLinkIdle(&w) && w.stats.tx_expired_frames == 3u && w.stats.tx_expired_records == 3u,
+        "unacked frames expire");
+  check(sent == 3u * ESPNOW_FRAME_DEFAULT_TRIES, "retries bounded by max_tries");
+}
+
+// Loopback simulator -------------------------------------------------------
+
+constexpr uint32_t kStepUs = 100u;
+constexpr uint32_t kFrameOverheadUs = 400u;  // preamble, MAC header, 802.11 ack
+constexpr uint32_t kByteUs = 8u;             // 1 Mbit/s
+constexpr uint32_t kEventCount = 3000u;
+constexpr uint32_t kEventPeriodUs = 1000u;
+constexpr uint32_t kCommandPeriodUs = 50000u;
+constexpr uint32_t kTimeLimitUs = 120000000u;
+
+struct Config {
+  const char* name;
+  uint8_t window;
+  uint8_t max_records;
+  uint16_t batch_ms;
+  uint16_t ack_delay_ms;
+};
+
+struct Flight {
+  uint32_t arrive_us;
+  int to;
+  std::vector<uint8_t> bytes;
+};
+
+struct Outgoing {
+  uint8_t type;
+  std::vector<uint8_t> data;
+  uint32_t created_us;
+};
+
+struct Report {
+  bool finished = false;  // everything delivered or expired before the time limit
+  uint32_t delivered = 0u;
+  uint32_t duplicates = 0u;
+  uint32_t lost = 0u;
+  uint32_t expired_records = 0u;
+  uint32_t frames = 0u;
+  uint32_t retransmits = 0u;
+  uint32_t bare_acks = 0u;
+  uint32_t commands = 0u;
+  uint32_t results = 0u;
+  double elapsed_s = 0.0;
+  double events_per_s = 0.0;
+  double goodput_bps = 0.0;
+  double records_per_frame = 0.0;
+  double lat_avg_ms = 0.0;
+  double lat_p99_ms = 0.0;
+  double lat_max_ms = 0.0;
+  double rtt_avg_ms = 0.0;
+  double airtime = 0.0;
+};
+
+struct SimNode {
+  EspNowLink link;
+  std::deque<Outgoing> backlog;
+};
+
+struct SimState {
+  uint32_t now_us = 0u;
+  std::vector<uint32_t> event_created;
+  std::vector<uint8_t> event_seen;
+  std::vector<double> latencies_ms;
+  std::vector<uint32_t> command_created;
+  std::vector<double> rtts_ms;
+  uint64_t payload_bytes = 0u;
+  uint32_t last_delivery_us = 0u;
+  SimNode* responder = nullptr;
+  uint32_t duplicates = 0u;
+  uint32_t results = 0u;
+};
+
+uint32_t eventSize(uint32_t id) {
+  return 8u + (id % 17u);
+}
+
+// Node B: events are checked for exactly-once delivery, commands answered.
+void onResponderRecord(void* ctx, uint8_t type, const uint8_t* data, uint8_t len) {
+  SimState* sim = static_cast<SimState*>(ctx);
+  if (type == ESPNOW_REC_EVENT && len >= 4u) {
+    const uint32_t id = espNowFrameGetU32(data);
+    if (id >= sim->event_seen.size()) {
+      return;
+    }
+    if (sim->event_seen[id] != 0u) {
+      ++sim->duplicates;
+      return;
+    }
+    sim->event_seen[id] = 1u;
+    sim->latencies_ms.push_back((sim->now_us - sim->event_created[id]) / 1000.0);
+    sim->payload_bytes += len;
+    sim->last_delivery_us = sim->now_us;
+    return;
+  }
+  uint16_t request_id = 0u;
+  const char* line = nullptr;
+  uint8_t line_len = 0u;
+  if (type == ESPNOW_REC_COMMAND && espNowRecordParseCommand(data, len, &request_id, &line, &line_len)) {
+    uint8_t record[ESPNOW_FRAME_MAX_RECORD];
+    espNowFramePutU16(record, request_id);
+    record[2] = 1u;
+    record[3] = 6u;
+    memcpy(record + 4, "STATUS", 6u);
+    sim->responder->backlog.push_back({ESPNOW_REC_RESULT, std::vector<uint8_t>(record, record + 10), sim->now_us});
+  }
+}
+
+// Node A: command results.
+void onSenderRecord(void* ctx, uint8_t type, const uint8_t* data, uint8_t len) {
+  SimState* sim = static_cast<SimState*>(ctx);
+  EspNowResultView result;
+  if (type == ESPNOW_REC_RESULT && espNowRecordParseResult(data, len, &result) &&
+      result.request_id < sim->command_created.size()) {
+    ++sim->results;
+    sim->rtts_ms.push_back((sim->now_us - sim->command_created[result.request_id]) / 1000.0);
+  }
+}
+
+void drainBacklog(SimNode* node, uint32_t now_ms) {
+  while (!node->backlog.empty()) {
+    const Outgoing& next = node->backlog.front();
+    if (!espNowLinkQueue(&node->link, next.type, next.data.data(), next.data.size(), true, now_ms)) {
+      return;
+    }
+    node->backlog.pop_front();
+  }
+}
+
+Report simulate(const Config& config, double loss, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> coin(0.0, 1.0);
+  std::uniform_int_distribution<uint32_t> jitter(0u, 300u);
+
+  SimNode nodes[2];
+  espNowLinkInit(&nodes[0].link, 0x11u);
+  espNowLinkInit(&nodes[1].link, 0x22u);
+  for (SimNode& node : nodes) {
+    node.link.window = config.window;
+    node.link.max_records = config.max_records;
+    node.link.batch_ms = config.batch_ms;
+    node.link.ack_delay_ms = config.ack_delay_ms;
+  }
+
+  SimState sim;
+  sim.event_created.assign(kEventCount, 0u);
+  sim.event_seen.assign(kEventCount, 0u);
+  sim.responder = &nodes[1];
+  std::vector<Flight> flights;
+  uint32_t busy_until_us = 0u;
+  uint64_t busy_total_us = 0u;
+  uint32_t generated = 0u;
+  uint32_t next_command_us = 0u;
+  uint32_t tick = 0u;
+
+  for (sim.now_us = 0u; sim.now_us < kTimeLimitUs; sim.now_us += kStepUs, ++tick) {
+    const uint32_t now_ms = sim.now_us / 1000u;
+    while (generated < kEventCount && sim.now_us >= generated * kEventPeriodUs) {
+      std::vector<uint8_t> data(eventSize(generated), static_cast<uint8_t>(generated));
+      espNowFramePutU32(data.data(), generated);
+      sim.event_created[generated] = sim.now_us;
+      nodes[0].backlog.push_back({ESPNOW_REC_EVENT, data, sim.now_us});
+      ++generated;
+    }
+    if (generated < kEventCount && sim.now_us >= next_command_us) {
+      uint8_t record[2 + 6];
+      espNowFramePutU16(record, static_cast<uint16_t>(sim.command_created.size()));
+      memcpy(record + 2, "STATUS", 6u);
+      sim.command_created.push_back(sim.now_us);
+      nodes[0].backlog.push_back({ESPNOW_REC_COMMAND, std::vector<uint8_t>(record, record + sizeof(record)), sim.now_us});
+      next_command_us += kCommandPeriodUs;
+    }
+
+    for (size_t i = 0u; i < flights.size();) {
+      if (flights[i].arrive_us > sim.now_us) {
+        ++i;
+        continue;
+      }
+      const Flight flight = flights[i];
+      flights.erase(flights.begin() + static_cast<std::ptrdiff_t>(i));
+      espNowLinkReceive(&nodes[flight.to].link,
+                        flight.bytes.data(),
+                        flight.bytes.size(),
+                        now_ms,
+                        flight.to == 1 ? onResponderRecord : onSenderRecord,
+                        &sim);
+    }
+
+    for (SimNode& node : nodes) {
+      drainBacklog(&node, now_ms);
+    }
+    // One half-duplex medium; alternate who gets the first chance.
+    for (int turn = 0; turn < 2 && busy_until_us <= sim.now_us; ++turn) {
+      const int from = (turn + static_cast<int>(tick & 1u)) & 1;
+      uint8_t frame[ESPNOW_FRAME_MAX];
+      const size_t len = espNowLinkPoll(&nodes[from].link, now_ms, frame, sizeof(frame));
+      if (len == 0u) {
+        continue;
+      }
+      const uint32_t airtime_us = kFrameOverheadUs + static_cast<uint32_t>(len) * kByteUs;
+      busy_until_us = sim.now_us + airtime_us;
+      busy_total_us += airtime_us;
+      if (coin(rng) >= loss) {
+        flights.push_back({busy_until_us + jitter(rng), 1 - from, std::vector<uint8_t>(frame, frame + len)});
+      }
+    }
+
+    const bool done = generated == kEventCount && nodes[0].backlog.empty() && nodes[1].backlog.empty() &&
+                      flights.empty() && espNowLinkIdle(&nodes[0].link) && espNowLinkIdle(&nodes[1].link);
+    if (done) {
+      break;
+    }
+  }
+
+  Report report;
+  report.finished = sim.now_us < kTimeLimitUs;
+  report.delivered = static_cast<uint32_t>(sim.latencies_ms.size());
+  report.duplicates = sim.duplicates;
+  report.lost = kEventCount - report.delivered;
+  report.expired_records = nodes[0].link.stats.tx_expired_records;
+  report.frames = nodes[0].link.stats.tx_frames + nodes[1].link.stats.tx_frames + nodes[1].link.stats.tx_acks +
+                  nodes[0].link.stats.tx_acks;
+  report.retransmits = nodes[0].link.stats.tx_retransmits + nodes[1].link.stats.tx_retransmits;
+  report.bare_acks = nodes[0].link.stats.tx_acks + nodes[1].link.stats.tx_acks;
+  report.commands = static_cast<uint32_t>(sim.command_created.size());
+  report.results = sim.results;
+  report.elapsed_s = sim.last_delivery_us / 1e6;
+  if (report.elapsed_s > 0.0) {
+    report.events_per_s = report.delivered / report.elapsed_s;
+    report.goodput_bps = static_cast<double>(sim.payload_bytes) / report.elapsed_s;
+  }
+  if (nodes[0].link.stats.tx_frames != 0u) {
+    report.records_per_frame =
+        static_cast<double>(nodes[0].link.stats.tx_records) / (nodes[0].link.stats.tx_frames - nodes[0].link.stats.tx_retransmits);
+  }
+  if (!sim.latencies_ms.empty()) {
+    std::vector<double> sorted = sim.latencies_ms;
+    std::sort(sorted.begin(), sorted.end());
+    double total = 0.0;
+    for (double value : sorted) {
+      total += value;
+    }
+    report.lat_avg_ms = total / sorted.size();
+    report.lat_p99_ms = sorted[(sorted.size() * 99u) / 100u];
+    report.lat_max_ms = sorted.back();
+  }
+  if (!sim.rtts_ms.empty()) {
+    double total = 0.0;
+    for (double value : sim.rtts_ms) {
+      total += value;
+    }
+    report.rtt_avg_ms = total / sim.rtts_ms.size();
+  }
+  report.airtime = sim.now_us != 0u ? static_cast<double>(busy_total_us) / sim.now_us : 0.0;
+  return report;
+}
+
+}  // namespace
+
+int main() {
+  runCodecChecks();
+
+  const Config kWindowed = {"window8+batch", ESPNOW_FRAME_MAX_WINDOW, 255u, ESPNOW_FRAME_DEFAULT_BATCH_MS,
+                            ESPNOW_FRAME_DEFAULT_ACK_DELAY_MS};
+  // One record per frame, one frame in flight, immediate ack: the JSON
+  // envelope + sendEspNowAck behaviour, minus the JSON.
+  const Config kStopAndWait = {"stop-and-wait", 1u, 1u, 0u, 0u};
+  const double kLossRates[] = {0.0, 0.05, 0.10, 0.20, 0.30};
+
+  std::printf("%u events of 8..24 B offered at %u/s, a STATUS command every %u ms\n",
+              kEventCount,
+              1000000u / kEventPeriodUs,
+              kCommandPeriodUs / 1000u);
+  std::printf("%-14s %5s %9s %9s %7s %6s %6s %5s %8s %8s %8s %8s %5s %4s %4s\n",
+              "mode", "loss", "events/s", "goodput", "frames", "retx", "acks", "rec/f", "lat_avg", "lat_p99", "lat_max",
+              "cmd_rtt", "air", "lost", "dup");
+  for (double loss : kLossRates) {
+    Report reports[2];
+    const Config* configs[2] = {&kWindowed, &kStopAndWait};
+    for (int i = 0; i < 2; ++i) {
+      reports[i] = simulate(*configs[i], loss, 1234u);
+      const Report& r = reports[i];
+      std::printf("%-14s %4.0f%% %9.0f %7.0fB/s %7u %6u %6u %5.1f %6.1fms %6.1fms %6.1fms %6.1fms %4.0f%% %4u %4u\n",
+                  configs[i]->name,
+                  loss * 100.0,
+                  r.events_per_s,
+                  r.goodput_bps,
+                  r.frames,
+                  r.retransmits,
+                  r.bare_acks,
+                  r.records_per_frame,
+                  r.lat_avg_ms,
+                  r.lat_p99_ms,
+                  r.lat_max_ms,
+                  r.rtt_avg_ms,
+                  r.airtime * 100.0,
+                  r.lost,
+                  r.duplicates);
+      check(r.duplicates == 0u, "exactly-once: no duplicate delivery");
+      check(!r.finished || r.lost <= r.expired_records, "every lost event was an expired frame");
+    }
+    const Report& windowed = reports[0];
+    const Report& baseline = reports[1];
+    if (loss <= 0.20) {
+      check(windowed.lost == 0u, "window: nothing lost up to 20% loss");
+      check(windowed.results == windowed.commands, "window: every command answered");
+    }
+    check(windowed.events_per_s > baseline.events_per_s, "window beats stop-and-wait throughput");
+    check(windowed.lat_p99_ms < baseline.lat_p99_ms, "window beats stop-and-wait p99 latency");
+  }
+
+  if (g_failures != 0u) {
+    std::printf("[FAIL] %u checks\n", g_failures);
+    return 1;
+  }
+  std::printf("[OK] espnow frame v1\n");
+  return 0;
+}
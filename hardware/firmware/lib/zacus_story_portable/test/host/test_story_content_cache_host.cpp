@@ -0,0 +1,235 @@
+// Host test: fixed-memory story content cache (StoryContentCache + views).
+// Covers hits/misses per kind, strict LRU eviction, pinning by live views,
+// replacement and invalidation while a view is held, chunk fragmentation,
+// streamed inserts and detached views. Loads ten data/story screens as a
+// scene working set and prints the hit rate for a replayed scene sequence.
+// Build/run: make story-content-cache-host
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "fs/story_content_cache.h"
+
+#include "host_check.h"
+
+namespace {
+
+struct MemorySource {
+  const std::string* text;
+  size_t pos;
+  size_t chunk;
+};
+
+size_t readMemory(void* ctx, uint8_t* out, size_t capacity) {
+  MemorySource* src = static_cast<MemorySource*>(ctx);
+  size_t n = src->text->size() - src->pos;
+  if (n > capacity) {
+    n = capacity;
+  }
+  if (n > src->chunk) {
+    n = src->chunk;
+  }
+  std::memcpy(out, src->text->data() + src->pos, n);
+  src->pos += n;
+  return n;
+}
+
+std::string payload(size_t len, char fill) {
+  return std::string(len, fill);
+}
+
+void runBasicChecks() {
+  std::vector<uint8_t> arena(8U * StoryContentCache::kChunkBytes);
+  StoryContentCache cache;
+  cache.begin(arena.data(), arena.size());
+  check(cache.capacity() == arena.size(), "capacity is the arena");
+
+  check(cache.find(StoryContentKind::kScene, "SCENE_A").empty(), "empty cache misses");
+  {
+    const std::string text = "{\"title\":\"A\"}";
+    StoryContentView view =
+        cache.insert(StoryContentKind::kScene, "SCENE_A", "/story/screens/SCENE_A.json", text.data(), text.size());
+    check(!view.empty() && view.cached(), "insert returns a cached view");
+    check(std::strcmp(view.c_str(), text.c_str()) == 0, "payload NUL-terminated and intact");
+    check(std::strcmp(view.aux(), "/story/screens/SCENE_A.json") == 0, "aux kept");
+  }
+  StoryContentView hit = cache.find(StoryContentKind::kScene, "SCENE_A");
+  check(!hit.empty(), "hit after insert");
+  check(cache.find(StoryContentKind::kStoryJson, "SCENE_A").empty(), "kinds do not alias");
+  const StoryContentCache::KindStats scene = cache.stats(StoryContentKind::kScene);
+  check(scene.hits == 1U && scene.misses == 1U && scene.entries == 1U && scene.bytes == 13U, "scene stats");
+  check(cache.hitRatePermille(StoryContentKind::kScene) == 500U, "hit rate 50%");
+
+  // Replacing while a view is held: old bytes stay valid for that view.
+  const std::string v2 = "{\"title\":\"A2\"}";
+  cache.insert(StoryContentKind::kScene, "SCENE_A", "", v2.data(), v2.size());
+  check(std::strcmp(hit.c_str(), "{\"title\":\"A\"}") == 0, "held view survives replacement");
+  check(std::strcmp(cache.find(StoryContentKind::kScene, "SCENE_A").c_str(), v2.c_str()) == 0, "lookup sees new");
+  check(cache.stats(StoryContentKind::kScene).entries == 1U, "replacement keeps one indexed entry");
+  const size_t held_before = cache.bytesHeld();
+  hit = StoryContentView();
+  check(cache.bytesHeld() < held_before, "orphan freed on last release");
+
+  cache.invalidate(StoryContentKind::kScene, "SCENE_A");
+  check(cache.find(StoryContentKind::kScene, "SCENE_A").empty(), "invalidate drops the entry");
+  check(cache.bytesHeld() == 0U, "nothing held after invalidate");
+
+  // Too large for half the arena.
+  const std::string big = payload(5U * StoryContentCache::kChunkBytes, 'x');
+  check(cache.insert(StoryContentKind::kStoryJson, "/big.json", "", big.data(), big.size()).empty(),
+        "entry over half the arena refused");
+}
+
+void runLruChecks() {
+  std::vector<uint8_t> arena(8U * StoryContentCache::kChunkBytes);
+  StoryContentCache cache;
+  cache.begin(arena.data(), arena.size());
+  const std::string two_chunks = payload(StoryContentCache::kChunkBytes + 10U, 'a');
+  cache.insert(StoryContentKind::kScene, "S1", "", two_chunks.data(), two_chunks.size());
+  cache.insert(StoryContentKind::kScene, "S2", "", two_chunks.data(), two_chunks.size());
+  cache.insert(StoryContentKind::kScene, "S3", "", two_chunks.data(), two_chunks.size());
+  cache.insert(StoryContentKind::kScene, "S4", "", two_chunks.data(), two_chunks.size());
+  check(cache.bytesHeld() == cache.capacity(), "arena full");
+  cache.find(StoryContentKind::kScene, "S1");  // S2 is now least recent
+  cache.insert(StoryContentKind::kScene, "S5", "", two_chunks.data(), two_chunks.size());
+  check(!cache.find(StoryContentKind::kScene, "S1").empty(), "recently used survives");
+  check(cache.find(StoryContentKind::kScene, "S2").empty(), "least recently used evicted");
+  check(cache.stats(StoryContentKind::kScene).evictions == 1U, "eviction counted");
+
+  // A view pins its entry: eviction skips it and takes the next LRU.
+  StoryContentView pinned = cache.find(StoryContentKind::kScene, "S3");
+  cache.find(StoryContentKind::kScene, "S4");
+  cache.find(StoryContentKind::kScene, "S5");
+  cache.find(StoryContentKind::kScene, "S1");
+  cache.insert(StoryContentKind::kScene, "S6", "", two_chunks.data(), two_chunks.size());
+  check(!cache.find(StoryContentKind::kScene, "S3").empty(), "pinned entry not evicted");
+  check(cache.find(StoryContentKind::kScene, "S4").empty(), "next unpinned LRU evicted instead");
+  check(pinned.length() == two_chunks.size(), "pinned view intact");
+
+  // Fragmentation: freeing non-adjacent 1-chunk holes does not fit 2 chunks,
+  // so eviction continues until a contiguous run exists.
+  StoryContentCache frag;
+  frag.begin(arena.data(), arena.size());
+  const std::string one_chunk = payload(100U, 'b');
+  for (int i = 0; i < 8; ++i) {
+    const std::string key = "F" + std::to_string(i);
+    frag.insert(StoryContentKind::kStoryJson, key.c_str(), "", one_chunk.data(), one_chunk.size());
+  }
+  frag.find(StoryContentKind::kStoryJson, "F1");
+  StoryContentView held = frag.find(StoryContentKind::kStoryJson, "F2");
+  const StoryContentView fits =
+      frag.insert(StoryContentKind::kStoryJson, "WIDE", "", two_chunks.data(), two_chunks.size());
+  check(!fits.empty(), "two-chunk entry fits after evicting a contiguous run");
+  check(!frag.find(StoryContentKind::kStoryJson, "F2").empty(), "held entry kept through fragmentation");
+
+  // Everything pinned: insert fails instead of corrupting a held view.
+  StoryContentCache pinned_all;
+  pinned_all.begin(arena.data(), 2U * StoryContentCache::kChunkBytes);
+  StoryContentView a = pinned_all.insert(StoryContentKind::kAudioMap, "P1", "", "x", 1U);
+  StoryContentView b = pinned_all.insert(StoryContentKind::kAudioMap, "P2", "", "y", 1U);
+  check(!a.empty() && !b.empty(), "two small entries");
+  check(pinned_all.insert(StoryContentKind::kAudioMap, "P3", "", "z", 1U).empty(), "no room while all pinned");
+  check(std::strcmp(a.c_str(), "x") == 0 && std::strcmp(b.c_str(), "y") == 0, "pinned content untouched");
+}
+
+void runStreamAndDetachedChecks() {
+  std::vector<uint8_t> arena(16U * StoryContentCache::kChunkBytes);
+  StoryContentCache cache;
+  cache.begin(arena.data(), arena.size());
+  const std::string text = payload(1000U, 'q') + "end";
+  MemorySource src = {&text, 0U, 7U};
+  StoryContentView view = cache.insertFrom(StoryContentKind::kStoryJson, "/story/a.json", "", text.size(), readMemory, &src);
+  check(view.length() == text.size() && std::memcmp(view.c_str(), text.data(), text.size()) == 0,
+        "streamed insert intact");
+  MemorySource short_src = {&text, 0U, 7U};
+  check(cache.insertFrom(StoryContentKind::kStoryJson, "/story/b.json", "", text.size() + 5U, readMemory, &short_src)
+            .empty(),
+        "short read leaves no entry");
+  check(cache.find(StoryContentKind::kStoryJson, "/story/b.json").empty(), "failed insert not indexed");
+
+  MemorySource dsrc = {&text, 0U, 64U};
+  StoryContentView detached = StoryContentView::detached(text.size(), readMemory, &dsrc);
+  check(!detached.cached() && detached.length() == text.size(), "detached view filled");
+  StoryContentView copy = detached;
+  detached = StoryContentView();
+  check(std::memcmp(copy.c_str(), text.data(), text.size()) == 0, "detached copy shares the block");
+  check(StoryContentView().c_str()[0] == '\0', "empty view reads as empty string");
+
+  cache.clear();
+  check(cache.find(StoryContentKind::kStoryJson, "/story/a.json").empty(), "clear drops entries");
+  check(view.length() == text.size(), "view outlives clear");
+  view = StoryContentView();
+  check(cache.bytesHeld() == 0U, "clear + release frees everything");
+}
+
+bool readFile(const std::string& path, std::string* out) {
+  FILE* file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  char buffer[512];
+  size_t n = 0U;
+  out->clear();
+  while ((n = std::fread(buffer, 1U, sizeof(buffer), file)) > 0U) {
+    out->append(buffer, n);
+  }
+  std::fclose(file);
+  return true;
+}
+
+// Replays a ten-scene tour twice over the real screen payloads in a
+// 48 KB cache (the firmware budget).
+void runWorkingSet(const char* root) {
+  static const char* kScenes[] = {
+      "SCENE_U_SON_PROTO", "SCENE_LA_DETECTOR", "SCENE_WIN_ETAPE1", "SCENE_WARNING",  "SCENE_CREDITS",
+      "SCENE_WIN_ETAPE2",  "SCENE_QR_DETECTOR", "SCENE_FINAL_WIN",  "SCENE_LOCKED",   "SCENE_READY",
+  };
+  std::vector<uint8_t> arena(48U * 1024U);
+  StoryContentCache cache;
+  cache.begin(arena.data(), arena.size());
+  size_t loaded = 0U;
+  for (int pass = 0; pass < 2; ++pass) {
+    for (const char* id : kScenes) {
+      StoryContentView view = cache.find(StoryContentKind::kScene, id);
+      if (!view.empty()) {
+        continue;
+      }
+      std::string text;
+      const std::string path = std::string(root) + "/screens/" + id + ".json";
+      if (!readFile(path, &text)) {
+        continue;
+      }
+      ++loaded;
+      view = cache.insert(StoryContentKind::kScene, id, path.c_str(), text.data(), text.size());
+      check(!view.empty(), "screen payload fits the budget");
+    }
+  }
+  const StoryContentCache::KindStats stats = cache.stats(StoryContentKind::kScene);
+  check(loaded > 0U, "screens found under data/story");
+  check(stats.hits == loaded, "second pass served from cache");
+  std::printf("scene working set: files=%zu entries=%u payload=%u held=%zu/%zu hit_rate=%u/1000\n",
+              loaded,
+              static_cast<unsigned>(stats.entries),
+              static_cast<unsigned>(stats.bytes),
+              cache.bytesHeld(),
+              cache.capacity(),
+              static_cast<unsigned>(cache.hitRatePermille(StoryContentKind::kScene)));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* root = (argc > 1) ? argv[1] : "data/story";
+  runBasicChecks();
+  runLruChecks();
+  runStreamAndDetachedChecks();
+  runWorkingSet(root);
+  if (g_failures != 0u) {
+    std::printf("story content cache: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("story content cache: ok\n");
+  return 0;
+}
@@ -0,0 +1,199 @@
+// Host test: shared deadline queue (StoryDeadlineQueue).
+// Fixed cases for handles, re-arming and the millis() wrap, then randomized
+// acquire/arm/re-arm/cancel/advance/popDue sequences checked step by step
+// against a brute-force model (linear scan over every armed timer): isDue,
+// dueAtMs, nextDueAtMs, msUntilNext, armedCount and the order popDue returns.
+// Build/run: make story-deadlines-host
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+#include "core/story_deadlines.h"
+
+#include "host_check.h"
+
+uint32_t millis() {
+  return 0U;
+}
+
+namespace {
+
+void runFixedChecks() {
+  StoryDeadlineQueue queue;
+  check(!queue.nextDueAtMs(nullptr), "empty queue has no deadline");
+  check(queue.popDue(0U) == StoryDeadlineQueue::kInvalidTimer, "empty queue pops nothing");
+  check(queue.msUntilNext(0U, 500U) == 500U, "empty queue waits the cap");
+  check(!queue.arm(0, 10U), "unacquired handle refused");
+
+  const int8_t a = queue.acquire("a");
+  const int8_t b = queue.acquire("b");
+  const int8_t c = queue.acquire("c");
+  check(a == 0 && b == 1 && c == 2, "handles in acquisition order");
+  check(queue.tag(b) != nullptr && queue.tag(b)[0] == 'b', "tag kept");
+
+  queue.arm(a, 300U);
+  queue.arm(b, 100U);
+  queue.arm(c, 200U);
+  uint32_t due = 0U;
+  check(queue.nextDueAtMs(&due) && due == 100U, "earliest first");
+  queue.arm(b, 400U);
+  check(queue.nextDueAtMs(&due) && due == 200U, "re-arm moves a timer later");
+  queue.arm(a, 50U);
+  check(queue.nextDueAtMs(&due) && due == 50U, "re-arm moves a timer earlier");
+  check(queue.armedCount() == 3U, "re-arm keeps one entry");
+  check(queue.msUntilNext(20U, 1000U) == 30U, "msUntilNext counts down");
+  check(queue.msUntilNext(60U, 1000U) == 0U, "msUntilNext is 0 once due");
+  check(queue.popDue(49U) == StoryDeadlineQueue::kInvalidTimer, "nothing due early");
+  check(queue.popDue(50U) == a && !queue.armed(a), "popDue disarms");
+  check(queue.cancel(c) && !queue.cancel(c), "cancel once");
+  queue.clear();
+  check(queue.armedCount() == 0U && !queue.armed(b), "clear disarms");
+  check(queue.arm(b, 1U) && queue.armed(b), "handles survive clear");
+
+  // Deadlines straddling the millis() wrap keep their order.
+  StoryDeadlineQueue wrap;
+  const int8_t late = wrap.acquire("late");
+  const int8_t early = wrap.acquire("early");
+  wrap.arm(late, 0x00000020U);
+  wrap.arm(early, 0xFFFFFFF0U);
+  check(wrap.nextDueAtMs(&due) && due == 0xFFFFFFF0U, "pre-wrap deadline first");
+  check(wrap.isDue(early, 0x00000001U) && !wrap.isDue(late, 0x00000001U), "isDue across the wrap");
+  check(wrap.msUntilNext(0xFFFFFFE0U, 1000U) == 16U, "msUntilNext before the wrap");
+  check(wrap.popDue(0x00000030U) == early && wrap.popDue(0x00000030U) == late, "pop order across the wrap");
+
+  StoryDeadlineQueue full;
+  for (uint8_t i = 0U; i < StoryDeadlineQueue::kCapacity; ++i) {
+    full.acquire("t");
+  }
+  check(full.acquire("x") == StoryDeadlineQueue::kInvalidTimer, "pool exhaustion reported");
+}
+
+struct Model {
+  bool armed[StoryDeadlineQueue::kCapacity] = {};
+  uint32_t due[StoryDeadlineQueue::kCapacity] = {};
+  uint8_t acquired = 0U;
+
+  uint8_t armedCount() const {
+    uint8_t count = 0U;
+    for (uint8_t i = 0U; i < acquired; ++i) {
+      count = static_cast<uint8_t>(count + (armed[i] ? 1U : 0U));
+    }
+    return count;
+  }
+
+  // Earliest armed deadline (wrap-safe); false when nothing is armed.
+  bool earliest(uint32_t* out) const {
+    bool found = false;
+    for (uint8_t i = 0U; i < acquired; ++i) {
+      if (armed[i] && (!found || static_cast<int32_t>(due[i] - *out) < 0)) {
+        *out = due[i];
+        found = true;
+      }
+    }
+    return found;
+  }
+};
+
+// Every call is mirrored in the model, then the whole observable state is
+// compared. popDue may return any of several timers due at the same instant.
+uint32_t runRandomized(uint32_t seed, uint32_t steps, uint32_t startMs) {
+  std::mt19937 rng(seed);
+  StoryDeadlineQueue queue;
+  Model model;
+  uint32_t now = startMs;
+  uint32_t mismatches = 0U;
+  uint32_t pops = 0U;
+
+  for (uint32_t step = 0U; step < steps; ++step) {
+    const uint32_t op = rng() % 100U;
+    if (op < 4U && model.acquired < StoryDeadlineQueue::kCapacity) {
+      const int8_t timer = queue.acquire("r");
+      if (timer != static_cast<int8_t>(model.acquired)) {
+        ++mismatches;
+      }
+      ++model.acquired;
+    } else if (op < 45U && model.acquired > 0U) {
+      // Short spans make equal deadlines and re-arms common.
+      const uint8_t timer = static_cast<uint8_t>(rng() % model.acquired);
+      const uint32_t dueAt = now + (rng() % 64U) - 8U;
+      queue.arm(static_cast<int8_t>(timer), dueAt);
+      model.armed[timer] = true;
+      model.due[timer] = dueAt;
+    } else if (op < 60U && model.acquired > 0U) {
+      const uint8_t timer = static_cast<uint8_t>(rng() % model.acquired);
+      if (queue.cancel(static_cast<int8_t>(timer)) != model.armed[timer]) {
+        ++mismatches;
+      }
+      model.armed[timer] = false;
+    } else if (op < 80U) {
+      now += rng() % 16U;
+    } else if (op < 99U) {
+      uint32_t earliest = 0U;
+      const bool anyDue = model.earliest(&earliest) && static_cast<int32_t>(now - earliest) >= 0;
+      const int8_t popped = queue.popDue(now);
+      if (!anyDue) {
+        mismatches += (popped != StoryDeadlineQueue::kInvalidTimer) ? 1U : 0U;
+      } else if (popped < 0 || static_cast<uint8_t>(popped) >= model.acquired ||
+                 !model.armed[static_cast<uint8_t>(popped)] || model.due[static_cast<uint8_t>(popped)] != earliest) {
+        ++mismatches;
+      } else {
+        model.armed[static_cast<uint8_t>(popped)] = false;
+        ++pops;
+      }
+    } else {
+      queue.clear();
+      for (bool& armed : model.armed) {
+        armed = false;
+      }
+    }
+
+    if (queue.armedCount() != model.armedCount()) {
+      ++mismatches;
+    }
+    uint32_t expected = 0U;
+    uint32_t actual = 0U;
+    const bool modelHas = model.earliest(&expected);
+    const bool queueHas = queue.nextDueAtMs(&actual);
+    if (modelHas != queueHas || (modelHas && expected != actual)) {
+      ++mismatches;
+    }
+    const int32_t left = modelHas ? static_cast<int32_t>(expected - now) : 0;
+    const uint32_t wait = !modelHas ? 100U : (left <= 0 ? 0U : (left < 100 ? static_cast<uint32_t>(left) : 100U));
+    if (queue.msUntilNext(now, 100U) != wait) {
+      ++mismatches;
+    }
+    for (uint8_t i = 0U; i < model.acquired; ++i) {
+      const int8_t timer = static_cast<int8_t>(i);
+      const bool due = model.armed[i] && static_cast<int32_t>(now - model.due[i]) >= 0;
+      uint32_t dueAt = 0U;
+      if (queue.armed(timer) != model.armed[i] || queue.isDue(timer, now) != due ||
+          queue.dueAtMs(timer, &dueAt) != model.armed[i] || (model.armed[i] && dueAt != model.due[i])) {
+        ++mismatches;
+      }
+    }
+  }
+  std::printf("random seed=%u start=0x%08x steps=%u pops=%u mismatches=%u\n",
+              static_cast<unsigned int>(seed),
+              static_cast<unsigned int>(startMs),
+              static_cast<unsigned int>(steps),
+              static_cast<unsigned int>(pops),
+              static_cast<unsigned int>(mismatches));
+  return mismatches;
+}
+
+}  // namespace
+
+int main() {
+  runFixedChecks();
+  for (uint32_t seed = 1U; seed <= 8U; ++seed) {
+    // Half the runs start just before the millis() wrap.
+    const uint32_t start = (seed & 1U) ? 1000U : 0xFFFFF000U;
+    check(runRandomized(seed, 50000U, start) == 0U, "heap matches the brute-force model");
+  }
+  if (g_failures != 0u) {
+    std::printf("story deadlines: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("story deadlines: ok\n");
+  return 0;
+}
@@ -0,0 +1,220 @@
+// Host test: story event queue (StoryEventQueue lanes + coalescing).
+// Covers the drain order across lanes, FIFO within a lane, overflow drops,
+// the coalescing window on full 32-bit timestamps (spaced repeats, millis()
+// wrap), then 4 producer threads pushing against a consumer that pops and
+// calls clear() mid-stream: no event is lost, duplicated or reordered within
+// its producer. Run it under TSan as well:
+//   make story-event-queue-host HOST_CXXFLAGS="-std=c++17 -O1 -g -fsanitize=thread"
+// Build/run: make story-event-queue-host
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "core/story_events.h"
+
+#include "host_check.h"
+
+namespace {
+
+StoryQueuedEvent makeEvent(StoryEventType type, uint16_t nameId, int32_t value, uint32_t atMs) {
+  StoryQueuedEvent event;
+  event.type = type;
+  event.nameId = nameId;
+  event.value = value;
+  event.atMs = atMs;
+  return event;
+}
+
+void runOrderChecks() {
+  StoryEventQueue queue;
+  check(queue.push(makeEvent(StoryEventType::kEspNow, 1U, 0, 0U)) == StoryEventQueue::PushResult::kQueued,
+        "espnow queued");
+  check(queue.push(makeEvent(StoryEventType::kButton, 2U, 0, 0U)) == StoryEventQueue::PushResult::kQueued,
+        "button queued");
+  check(queue.push(makeEvent(StoryEventType::kUnlock, 3U, 0, 0U)) == StoryEventQueue::PushResult::kQueued,
+        "unlock queued");
+  check(queue.push(makeEvent(StoryEventType::kTimer, 4U, 0, 0U)) == StoryEventQueue::PushResult::kQueued,
+        "timer queued");
+  check(queue.size() == 4U, "size counts all lanes");
+
+  const StoryEventType expected[] = {StoryEventType::kUnlock, StoryEventType::kTimer, StoryEventType::kButton,
+                                     StoryEventType::kEspNow};
+  StoryQueuedEvent event;
+  for (StoryEventType type : expected) {
+    check(queue.pop(&event) && event.type == type, "lanes drain by priority");
+  }
+  check(!queue.pop(&event), "empty after drain");
+
+  for (int32_t i = 0; i < static_cast<int32_t>(StoryEventQueue::kLaneCapacity); ++i) {
+    queue.push(makeEvent(StoryEventType::kSerial, static_cast<uint16_t>(i), i, 0U));
+  }
+  check(queue.push(makeEvent(StoryEventType::kSerial, 99U, 0, 0U)) == StoryEventQueue::PushResult::kDropped,
+        "full lane drops");
+  check(queue.droppedCount(StoryEventType::kSerial) == 1U, "drop counted on its lane");
+  for (int32_t i = 0; i < static_cast<int32_t>(StoryEventQueue::kLaneCapacity); ++i) {
+    check(queue.pop(&event) && event.value == i, "lane is FIFO");
+  }
+
+  queue.push(makeEvent(StoryEventType::kAction, 1U, 0, 0U));
+  queue.push(makeEvent(StoryEventType::kVoice, 2U, 0, 0U));
+  check(queue.clear() == 2U, "clear discards queued events");
+  check(queue.size() == 0U && !queue.pop(&event), "empty after clear");
+  check(queue.push(makeEvent(StoryEventType::kAction, 1U, 7, 0U)) == StoryEventQueue::PushResult::kQueued &&
+            queue.pop(&event) && event.value == 7,
+        "usable after clear");
+}
+
+void runCoalesceChecks() {
+  StoryEventQueue queue;
+  StoryQueuedEvent event;
+  const StoryEventType lane = StoryEventType::kButton;
+  queue.setCoalesceWindowMs(lane, 40U);
+
+  check(queue.push(makeEvent(lane, 5U, 0, 1000U)) == StoryEventQueue::PushResult::kQueued, "first press queued");
+  check(queue.push(makeEvent(lane, 5U, 0, 1039U)) == StoryEventQueue::PushResult::kCoalesced,
+        "repeat inside window coalesced");
+  check(queue.push(makeEvent(lane, 6U, 0, 1039U)) == StoryEventQueue::PushResult::kQueued,
+        "other name not coalesced");
+  check(queue.push(makeEvent(lane, 6U, 0, 1079U)) == StoryEventQueue::PushResult::kQueued,
+        "repeat at the window edge queued");
+  queue.clear();
+
+  // 32768 ms apart used to alias with the old 15-bit key.
+  check(queue.push(makeEvent(lane, 7U, 0, 5000U)) == StoryEventQueue::PushResult::kQueued, "spaced press 1");
+  check(queue.push(makeEvent(lane, 7U, 0, 5000U + 32768U)) == StoryEventQueue::PushResult::kQueued,
+        "press 32768 ms later queued");
+  check(queue.push(makeEvent(lane, 7U, 0, 5000U + 65536U + 10U)) == StoryEventQueue::PushResult::kQueued,
+        "press 65546 ms later queued");
+  check(queue.push(makeEvent(lane, 7U, 0, 5000U + 0x80000000U)) == StoryEventQueue::PushResult::kQueued,
+        "press half a wrap later queued");
+  queue.clear();
+
+  check(queue.push(makeEvent(lane, 8U, 0, 0xFFFFFFF0U)) == StoryEventQueue::PushResult::kQueued,
+        "press before millis wrap");
+  check(queue.push(makeEvent(lane, 8U, 0, 0x00000010U)) == StoryEventQueue::PushResult::kCoalesced,
+        "repeat across millis wrap coalesced");
+  check(queue.push(makeEvent(lane, 8U, 0, 0xFFFFFFE0U)) == StoryEventQueue::PushResult::kCoalesced,
+        "slightly older repeat coalesced");
+  queue.clear();
+
+  check(queue.push(makeEvent(lane, 9U, 0, 100U)) == StoryEventQueue::PushResult::kQueued, "press before clear");
+  queue.clear();
+  check(queue.push(makeEvent(lane, 9U, 0, 101U)) == StoryEventQueue::PushResult::kQueued,
+        "clear forgets the last key");
+  check(queue.coalescedCount(lane) == 3U, "coalesced counted on its lane");
+
+  queue.setCoalesceWindowMs(lane, 0U);
+  check(queue.push(makeEvent(lane, 9U, 0, 101U)) == StoryEventQueue::PushResult::kQueued, "window 0 disables");
+  while (queue.pop(&event)) {
+  }
+}
+
+// Each producer pushes increasing values under its own name id; producers
+// share lanes in pairs.
+// Coalescing is off so every push is either queued or dropped.
+void runProducerStress() {
+  constexpr uint32_t kProducers = 4U;
+  constexpr int32_t kPerProducer = 50000;
+  const StoryEventType kLanes[kProducers] = {StoryEventType::kButton, StoryEventType::kEspNow,
+                                             StoryEventType::kSerial, StoryEventType::kAction};
+
+  StoryEventQueue queue;
+  for (StoryEventType lane : kLanes) {
+    queue.setCoalesceWindowMs(lane, 0U);
+  }
+  std::atomic<uint32_t> queued[kProducers];
+  std::atomic<uint32_t> running{kProducers};
+  for (std::atomic<uint32_t>& count : queued) {
+    count.store(0U);
+  }
+
+  std::vector<std::thread> producers;
+  for (uint32_t p = 0U; p < kProducers; ++p) {
+    producers.emplace_back([&, p]() {
+      for (int32_t value = 0; value < kPerProducer; ++value) {
+        const StoryEventType lane = kLanes[p / 2U];
+        const StoryQueuedEvent event = makeEvent(lane, static_cast<uint16_t>(p), value, static_cast<uint32_t>(value));
+        if (queue.push(event) == StoryEventQueue::PushResult::kQueued) {
+          queued[p].fetch_add(1U, std::memory_order_relaxed);
+        } else {
+          // Give the consumer a chance so the run is not all drops.
+          std::this_thread::yield();
+        }
+      }
+      running.fetch_sub(1U);
+    });
+  }
+
+  int32_t lastValue[kProducers] = {-1, -1, -1, -1};
+  uint32_t popped[kProducers] = {};
+  uint32_t discarded = 0U;
+  uint32_t bad = 0U;
+  uint32_t loops = 0U;
+  StoryQueuedEvent event;
+  while (running.load() != 0U) {
+    if ((++loops & 15U) == 0U) {
+      // Discarded events are not seen by the order check; only counted.
+      discarded += queue.clear();
+    }
+    while (queue.pop(&event)) {
+      const uint16_t p = event.nameId;
+      if (p >= kProducers || event.type != kLanes[p / 2U] || event.value <= lastValue[p] ||
+          event.atMs != static_cast<uint32_t>(event.value)) {
+        ++bad;
+        continue;
+      }
+      lastValue[p] = event.value;
+      ++popped[p];
+    }
+    std::this_thread::yield();
+  }
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+  while (queue.pop(&event)) {
+    const uint16_t p = event.nameId;
+    if (p >= kProducers || event.value <= lastValue[p]) {
+      ++bad;
+      continue;
+    }
+    lastValue[p] = event.value;
+    ++popped[p];
+  }
+
+  uint32_t totalQueued = 0U;
+  uint32_t totalPopped = 0U;
+  for (uint32_t p = 0U; p < kProducers; ++p) {
+    totalQueued += queued[p].load();
+    totalPopped += popped[p];
+  }
+  check(bad == 0U, "stress: no duplicate, reordered or torn event");
+  check(totalQueued == totalPopped + discarded, "stress: queued == popped + cleared");
+  check(queue.pushedCount() == kProducers * static_cast<uint32_t>(kPerProducer),
+        "stress: every push counted");
+  check(queue.droppedCount() == kProducers * static_cast<uint32_t>(kPerProducer) - totalQueued,
+        "stress: every refused push counted as dropped");
+  check(totalPopped > 0U, "stress: consumer saw events");
+  std::printf("stress: producers=%u pushed=%u queued=%u popped=%u cleared=%u dropped=%u\n",
+              static_cast<unsigned int>(kProducers),
+              static_cast<unsigned int>(queue.pushedCount()),
+              static_cast<unsigned int>(totalQueued),
+              static_cast<unsigned int>(totalPopped),
+              static_cast<unsigned int>(discarded),
+              static_cast<unsigned int>(queue.droppedCount()));
+}
+
+}  // namespace
+
+int main() {
+  runOrderChecks();
+  runCoalesceChecks();
+  runProducerStress();
+  if (g_failures != 0u) {
+    std::printf("story event queue: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("story event queue: ok\n");
+  return 0;
+}
@@ -0,0 +1,419 @@
+// Host test: compiled scenario graph (StoryScenarioGraph) against the linear
+// strcmp selection StoryEngineV2 used before the graph existed.
+// Fixed cases for the priority / declaration-order tie-break, the empty-name
+// and button "ANY" wildcards and kEventUnknown, then 200k-event replays of
+// every built-in scenario and of random scenarios (small name pool, tied
+// priorities, after_ms/immediate edges) through StoryEngineV2. Each tick the
+// engine step, transition id and next deadline must match the reference
+// engine, and the full ranked selectEvent() list must match the linear scan.
+// Build/run: make story-scenario-graph-host
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/scenario_def.h"
+#include "core/scenario_graph.h"
+#include "core/story_engine_v2.h"
+#include "scenarios/default_scenario_v2.h"
+
+#include "host_check.h"
+
+uint32_t millis() {
+  return 0U;
+}
+
+namespace {
+
+constexpr uint8_t kMaxRanked = 32U;
+
+// --- Reference: the selection code StoryEngineV2 ran before the graph. ---
+
+bool refEventNameMatch(const TransitionDef& transition, const char* eventName) {
+  if (transition.eventName == nullptr || transition.eventName[0] == '\0') {
+    return true;
+  }
+  if (eventName == nullptr || eventName[0] == '\0') {
+    return false;
+  }
+  if (transition.eventType == StoryEventType::kButton && strcmp(transition.eventName, "ANY") == 0) {
+    return true;
+  }
+  return strcmp(transition.eventName, eventName) == 0;
+}
+
+bool refEventMatch(const TransitionDef& transition, StoryEventType type, const char* eventName) {
+  return transition.trigger == StoryTransitionTrigger::kOnEvent && transition.eventType == type &&
+         refEventNameMatch(transition, eventName);
+}
+
+// Every match, best first. The old engine only kept the first of these: a
+// later transition replaced it only with a strictly higher priority.
+uint8_t refRankEvent(const StepDef& step, StoryEventType type, const char* eventName, uint8_t* out) {
+  uint8_t count = 0U;
+  for (uint8_t i = 0U; i < step.transitionCount; ++i) {
+    if (!refEventMatch(step.transitions[i], type, eventName)) {
+      continue;
+    }
+    uint8_t pos = count;
+    while (pos > 0U && step.transitions[out[pos - 1U]].priority < step.transitions[i].priority) {
+      out[pos] = out[pos - 1U];
+      --pos;
+    }
+    out[pos] = i;
+    ++count;
+  }
+  return count;
+}
+
+int16_t refSelectEvent(const StepDef& step, StoryEventType type, const char* eventName) {
+  int16_t selected = -1;
+  uint8_t selectedPriority = 0U;
+  for (uint8_t i = 0U; i < step.transitionCount; ++i) {
+    const TransitionDef& transition = step.transitions[i];
+    if (!refEventMatch(transition, type, eventName)) {
+      continue;
+    }
+    if (selected < 0 || transition.priority > selectedPriority) {
+      selected = static_cast<int16_t>(i);
+      selectedPriority = transition.priority;
+    }
+  }
+  return selected;
+}
+
+int16_t refSelectImplicit(const StepDef& step, uint32_t nowMs, uint32_t enteredAtMs) {
+  int16_t selected = -1;
+  uint8_t selectedPriority = 0U;
+  for (uint8_t i = 0U; i < step.transitionCount; ++i) {
+    const TransitionDef& transition = step.transitions[i];
+    bool matched = transition.trigger == StoryTransitionTrigger::kImmediate;
+    if (transition.trigger == StoryTransitionTrigger::kAfterMs) {
+      matched = static_cast<uint32_t>(nowMs - enteredAtMs) >= transition.afterMs;
+    }
+    if (matched && (selected < 0 || transition.priority > selectedPriority)) {
+      selected = static_cast<int16_t>(i);
+      selectedPriority = transition.priority;
+    }
+  }
+  return selected;
+}
+
+uint32_t refNextDueAtMs(const StepDef& step, uint32_t enteredAtMs) {
+  bool found = false;
+  uint32_t afterMs = 0U;
+  for (uint8_t i = 0U; i < step.transitionCount; ++i) {
+    const TransitionDef& transition = step.transitions[i];
+    if (transition.trigger == StoryTransitionTrigger::kAfterMs && (!found || transition.afterMs < afterMs)) {
+      afterMs = transition.afterMs;
+      found = true;
+    }
+  }
+  return found ? enteredAtMs + afterMs : 0U;
+}
+
+// --- Fixed cases. ---
+
+bool rankedIs(const StoryScenarioGraph& graph,
+              StoryEventType type,
+              const char* eventName,
+              const std::vector<uint8_t>& expected) {
+  uint8_t ranked[kMaxRanked] = {};
+  const uint8_t count = graph.selectEvent(0U, type, graph.eventId(eventName), ranked, kMaxRanked);
+  if (count != expected.size()) {
+    return false;
+  }
+  for (uint8_t i = 0U; i < count; ++i) {
+    if (ranked[i] != expected[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void runFixedChecks() {
+  const TransitionDef kTransitions[] = {
+      {"T0_BTN_ANY", StoryTransitionTrigger::kOnEvent, StoryEventType::kButton, "ANY", 0U, "B", 10U, false},
+      {"T1_BTN_EMPTY", StoryTransitionTrigger::kOnEvent, StoryEventType::kButton, "", 0U, "B", 5U, false},
+      {"T2_BTN_GO", StoryTransitionTrigger::kOnEvent, StoryEventType::kButton, "GO", 0U, "C", 10U, false},
+      {"T3_SERIAL_ANY", StoryTransitionTrigger::kOnEvent, StoryEventType::kSerial, "ANY", 0U, "C", 1U, false},
+      {"T4_SERIAL_X", StoryTransitionTrigger::kOnEvent, StoryEventType::kSerial, "X", 0U, "B", 7U, false},
+      {"T5_SERIAL_X", StoryTransitionTrigger::kOnEvent, StoryEventType::kSerial, "X", 0U, "C", 7U, false},
+      {"T6_SERIAL_X_HI", StoryTransitionTrigger::kOnEvent, StoryEventType::kSerial, "X", 0U, "C", 9U, false},
+      {"T7_TIMER_NULL", StoryTransitionTrigger::kOnEvent, StoryEventType::kTimer, nullptr, 0U, "B", 0U, false},
+      {"T8_AFTER", StoryTransitionTrigger::kAfterMs, StoryEventType::kNone, "", 500U, "C", 1U, false},
+      {"T9_AFTER_HI", StoryTransitionTrigger::kAfterMs, StoryEventType::kNone, "", 900U, "B", 3U, false},
+  };
+  const StepDef kSteps[] = {
+      {"A", {}, kTransitions, static_cast<uint8_t>(sizeof(kTransitions) / sizeof(kTransitions[0])), false},
+      {"B", {}, nullptr, 0U, false},
+      {"C", {}, nullptr, 0U, false},
+  };
+  const ScenarioDef scenario = {"GRAPH_FIXED", 1U, kSteps, 3U, "A"};
+
+  StoryScenarioGraph graph;
+  check(graph.compile(scenario), "fixed scenario compiles");
+  check(graph.eventId("") == StoryScenarioGraph::kEventAny && graph.eventId(nullptr) == StoryScenarioGraph::kEventAny,
+        "empty name is kEventAny");
+  check(graph.eventId("NOT_IN_SCENARIO") == StoryScenarioGraph::kEventUnknown, "unknown name is kEventUnknown");
+  check(graph.eventId("GO") >= StoryScenarioGraph::kFirstNamedEvent, "known name interned");
+
+  check(rankedIs(graph, StoryEventType::kButton, "GO", {0U, 2U, 1U}), "button GO: equal priority keeps declaration order");
+  check(rankedIs(graph, StoryEventType::kButton, "", {1U}), "button empty name: only the empty-name wildcard");
+  check(rankedIs(graph, StoryEventType::kButton, "NOT_IN_SCENARIO", {0U, 1U}), "button unknown name: ANY then empty");
+  check(rankedIs(graph, StoryEventType::kButton, "ANY", {0U, 1U}), "button named ANY: wildcards only");
+  check(rankedIs(graph, StoryEventType::kSerial, "X", {6U, 4U, 5U}), "serial X: priority, then declaration order");
+  check(rankedIs(graph, StoryEventType::kSerial, "ANY", {3U}), "serial ANY is a literal name");
+  check(rankedIs(graph, StoryEventType::kSerial, "GO", {}), "serial ANY does not match other names");
+  check(rankedIs(graph, StoryEventType::kSerial, "NOT_IN_SCENARIO", {}), "serial unknown name: no match");
+  check(rankedIs(graph, StoryEventType::kSerial, "", {}), "serial empty name: no match");
+  check(rankedIs(graph, StoryEventType::kTimer, "", {7U}), "null name matches an empty event name");
+  check(rankedIs(graph, StoryEventType::kTimer, "NOT_IN_SCENARIO", {7U}), "null name matches an unknown name");
+  check(rankedIs(graph, StoryEventType::kAction, "GO", {}), "other event type: no match");
+
+  check(graph.implicitCount(0U) == 2U && graph.implicitTransition(0U, 0U) == 9U &&
+            graph.implicitTransition(0U, 1U) == 8U,
+        "implicit transitions ranked by priority");
+  uint32_t afterMs = 0U;
+  check(graph.minAfterMs(0U, &afterMs) && afterMs == 500U, "min after_ms");
+  check(!graph.minAfterMs(1U, nullptr), "step without after_ms");
+  check(graph.targetStepIndex(0U, 2U) == 2 && graph.targetStepIndex(0U, 10U) == -1, "targets resolved");
+
+  // Same scenario through the engine: the first ranked edge wins.
+  StoryEngineV2 engine;
+  check(engine.loadScenario(scenario) && engine.start("GRAPH_FIXED", 0U), "engine starts");
+  StoryEvent event = {StoryEventType::kSerial, "X", 0, 10U};
+  engine.postEvent(event);
+  engine.update(10U);
+  check(engine.lastTransitionId() != nullptr && strcmp(engine.lastTransitionId(), "T6_SERIAL_X_HI") == 0,
+        "engine takes the highest priority edge");
+  engine.jumpToStep("A", "test", 20U);
+  engine.update(519U);
+  check(engine.snapshot().stepIndex == 0U, "after_ms not due yet");
+  engine.update(520U);
+  check(engine.lastTransitionId() != nullptr && strcmp(engine.lastTransitionId(), "T8_AFTER") == 0,
+        "first due after_ms edge fires");
+}
+
+// --- Random scenarios. ---
+
+const char* const kNamePool[] = {"", "ANY", "A", "B", "C", "D"};
+constexpr uint8_t kNamePoolSize = static_cast<uint8_t>(sizeof(kNamePool) / sizeof(kNamePool[0]));
+constexpr uint8_t kEventTypeCount = static_cast<uint8_t>(StoryEventType::kVoice) + 1U;
+
+// Owns the strings and arrays a generated ScenarioDef points into.
+struct RandomScenario {
+  std::vector<std::string> stepIds;
+  std::vector<std::string> transitionIds;
+  std::vector<std::vector<TransitionDef>> transitions;
+  std::vector<StepDef> steps;
+  ScenarioDef def = {};
+
+  void build(std::mt19937& rng) {
+    const uint8_t stepCount = static_cast<uint8_t>(2U + rng() % 10U);
+    stepIds.clear();
+    transitionIds.clear();
+    transitions.assign(stepCount, {});
+    steps.assign(stepCount, StepDef());
+    for (uint8_t s = 0U; s < stepCount; ++s) {
+      stepIds.push_back("S" + std::to_string(s));
+    }
+    transitionIds.reserve(stepCount * 16U);
+    for (uint8_t s = 0U; s < stepCount; ++s) {
+      const uint8_t count = static_cast<uint8_t>(rng() % 16U);
+      for (uint8_t t = 0U; t < count; ++t) {
+        transitionIds.push_back("T" + std::to_string(s) + "_" + std::to_string(t));
+        TransitionDef tr = {};
+        tr.id = transitionIds.back().c_str();
+        tr.targetStepId = stepIds[rng() % stepCount].c_str();
+        tr.priority = static_cast<uint8_t>(rng() % 3U);
+        const uint32_t kind = rng() % 100U;
+        if (kind < 85U) {
+          tr.trigger = StoryTransitionTrigger::kOnEvent;
+          tr.eventType = static_cast<StoryEventType>(1U + rng() % (kEventTypeCount - 1U));
+          tr.eventName = kNamePool[rng() % kNamePoolSize];
+        } else if (kind < 97U) {
+          tr.trigger = StoryTransitionTrigger::kAfterMs;
+          tr.eventType = StoryEventType::kNone;
+          tr.eventName = "";
+          tr.afterMs = rng() % 4000U;
+        } else {
+          tr.trigger = StoryTransitionTrigger::kImmediate;
+          tr.eventType = StoryEventType::kNone;
+          tr.eventName = "";
+        }
+        transitions[s].push_back(tr);
+      }
+    }
+    for (uint8_t s = 0U; s < stepCount; ++s) {
+      steps[s].id = stepIds[s].c_str();
+      steps[s].transitions = transitions[s].empty() ? nullptr : transitions[s].data();
+      steps[s].transitionCount = static_cast<uint8_t>(transitions[s].size());
+    }
+    def.id = "GRAPH_RANDOM";
+    def.version = 1U;
+    def.steps = steps.data();
+    def.stepCount = stepCount;
+    def.initialStepId = stepIds[rng() % stepCount].c_str();
+  }
+};
+
+// --- Replay. ---
+
+// Event names the replay draws from: every name the scenario uses, the
+// wildcards and names no transition listens to.
+std::vector<std::string> eventNamesOf(const ScenarioDef& scenario) {
+  std::vector<std::string> names = {"", "ANY", "NOT_IN_SCENARIO", "a", "ANY2"};
+  for (uint8_t s = 0U; s < scenario.stepCount; ++s) {
+    const StepDef& step = scenario.steps[s];
+    for (uint8_t t = 0U; t < step.transitionCount; ++t) {
+      if (step.transitions[t].eventName != nullptr) {
+        names.push_back(step.transitions[t].eventName);
+      }
+    }
+  }
+  return names;
+}
+
+// Ticks are at least 250 ms apart (the widest coalescing window) and carry at
+// most one event, so the engine queue never coalesces, drops or stalls and
+// the reference needs no queue model.
+uint32_t replay(const ScenarioDef& scenario, uint32_t seed, uint32_t ticks, uint32_t startMs) {
+  std::mt19937 rng(seed);
+  const std::vector<std::string> names = eventNamesOf(scenario);
+  StoryScenarioGraph graph;
+  StoryEngineV2 engine;
+  if (!graph.compile(scenario) || !engine.loadScenario(scenario)) {
+    std::printf("replay %s: load failed\n", scenario.id);
+    return 1U;
+  }
+
+  uint32_t now = startMs;
+  engine.start(scenario.id, now);
+  engine.consumeStepChanged();
+  int16_t refStep = storyFindStepIndex(scenario, scenario.initialStepId);
+  uint32_t refEnteredAtMs = now;
+  uint32_t mismatches = 0U;
+  uint32_t transitions = 0U;
+  uint32_t events = 0U;
+
+  for (uint32_t tick = 0U; tick < ticks; ++tick) {
+    now += 250U + ((rng() % 8U) == 0U ? rng() % 6000U : rng() % 600U);
+    if (rng() % 200U == 0U) {
+      // Built-in scenarios end in terminal steps: jump around to keep every
+      // step in the replay.
+      refStep = static_cast<int16_t>(rng() % scenario.stepCount);
+      refEnteredAtMs = now;
+      if (!engine.jumpToStep(scenario.steps[refStep].id, "replay", now)) {
+        ++mismatches;
+      }
+      engine.consumeStepChanged();
+      continue;
+    }
+    const StepDef& step = scenario.steps[refStep];
+    const char* refTransitionId = nullptr;
+    int16_t refTarget = -1;
+
+    if (rng() % 4U != 0U) {
+      StoryEvent event = {};
+      event.type = static_cast<StoryEventType>(rng() % kEventTypeCount);
+      snprintf(event.name, sizeof(event.name), "%s", names[rng() % names.size()].c_str());
+      if (step.transitionCount > 0U && rng() % 2U == 0U) {
+        // Half the events reuse the type of an edge of the current step.
+        event.type = step.transitions[rng() % step.transitionCount].eventType;
+      }
+      event.atMs = now;
+      engine.postEvent(event);
+      ++events;
+
+      uint8_t ranked[kMaxRanked] = {};
+      uint8_t expected[kMaxRanked] = {};
+      const uint8_t count = graph.selectEvent(static_cast<uint8_t>(refStep), event.type, graph.eventId(event.name),
+                                              ranked, kMaxRanked);
+      const uint8_t expectedCount = refRankEvent(step, event.type, event.name, expected);
+      if (count != expectedCount || memcmp(ranked, expected, count) != 0) {
+        ++mismatches;
+      }
+      const int16_t selected = refSelectEvent(step, event.type, event.name);
+      if ((selected < 0) != (expectedCount == 0U) || (selected >= 0 && selected != expected[0])) {
+        ++mismatches;
+      }
+      if (selected >= 0) {
+        refTransitionId = step.transitions[selected].id;
+        refTarget = storyFindStepIndex(scenario, step.transitions[selected].targetStepId);
+        if (graph.targetStepIndex(static_cast<uint8_t>(refStep), static_cast<uint8_t>(selected)) != refTarget) {
+          ++mismatches;
+        }
+      }
+    }
+    if (refTarget < 0) {
+      const int16_t implicit = refSelectImplicit(step, now, refEnteredAtMs);
+      if (implicit >= 0) {
+        refTransitionId = step.transitions[implicit].id;
+        refTarget = storyFindStepIndex(scenario, step.transitions[implicit].targetStepId);
+      }
+    }
+
+    engine.update(now);
+    const bool refChanged = refTarget >= 0;
+    if (refChanged) {
+      refStep = refTarget;
+      refEnteredAtMs = now;
+      ++transitions;
+    }
+    const StorySnapshot snapshot = engine.snapshot();
+    if (engine.consumeStepChanged() != refChanged || snapshot.stepIndex != static_cast<uint8_t>(refStep) ||
+        snapshot.enteredAtMs != refEnteredAtMs ||
+        snapshot.nextDueAtMs != refNextDueAtMs(scenario.steps[refStep], refEnteredAtMs)) {
+      ++mismatches;
+    }
+    if (refChanged &&
+        (engine.lastTransitionId() == nullptr || strcmp(engine.lastTransitionId(), refTransitionId) != 0)) {
+      ++mismatches;
+    }
+  }
+  if (engine.droppedEvents() != 0U || engine.stats().coalescedEvents != 0U) {
+    ++mismatches;
+  }
+  std::printf("replay %s seed=%u ticks=%u events=%u transitions=%u mismatches=%u\n",
+              scenario.id,
+              static_cast<unsigned int>(seed),
+              static_cast<unsigned int>(ticks),
+              static_cast<unsigned int>(events),
+              static_cast<unsigned int>(transitions),
+              static_cast<unsigned int>(mismatches));
+  return mismatches;
+}
+
+}  // namespace
+
+int main() {
+  runFixedChecks();
+
+  for (uint8_t i = 0U; i < storyScenarioV2Count(); ++i) {
+    const ScenarioDef* scenario = storyScenarioV2ById(storyScenarioV2IdAt(i));
+    check(scenario != nullptr, "built-in scenario resolves");
+    if (scenario != nullptr) {
+      check(replay(*scenario, 100U + i, 200000U, 1000U) == 0U, "built-in replay matches the linear engine");
+    }
+  }
+
+  std::mt19937 rng(7U);
+  uint32_t randomMismatches = 0U;
+  for (uint32_t seed = 1U; seed <= 40U; ++seed) {
+    RandomScenario random;
+    random.build(rng);
+    // Half the runs start just before the millis() wrap.
+    randomMismatches += replay(random.def, seed, 5000U, (seed & 1U) ? 0U : 0xFFFF0000U);
+  }
+  check(randomMismatches == 0U, "random scenario replays match the linear engine");
+
+  if (g_failures != 0u) {
+    std::printf("story scenario graph: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("story scenario graph: ok\n");
+  return 0;
+}
@@ -0,0 +1,295 @@
+// Host test: single-pass scenario loader (StoryJsonReader + StoryArena).
+// Loads every scenario under data/story/scenarios, checks the result against
+// storyValidateScenarioDef, then covers escapes, malformed input, the arena
+// retry path and a scenario well past the old 12-step / 12-transition caps,
+// including 200 transitions per step driven through StoryEngineV2. Prints file size, arena bytes and parse time per scenario.
+// Build/run: make story-scenario-load-host
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "core/story_engine_v2.h"
+#include "fs/story_scenario_loader.h"
+
+#include "host_check.h"
+
+uint32_t millis() {
+  return 0U;
+}
+
+namespace {
+
+// Hands out at most `chunk` bytes per call, like a small file read.
+struct MemorySource {
+  const std::string* text;
+  size_t pos;
+  size_t chunk;
+};
+
+size_t readMemory(void* ctx, uint8_t* out, size_t capacity) {
+  MemorySource* src = static_cast<MemorySource*>(ctx);
+  size_t n = src->text->size() - src->pos;
+  if (n > capacity) {
+    n = capacity;
+  }
+  if (n > src->chunk) {
+    n = src->chunk;
+  }
+  std::memcpy(out, src->text->data() + src->pos, n);
+  src->pos += n;
+  return n;
+}
+
+struct LoadResult {
+  bool ok = false;
+  uint8_t attempts = 0U;
+  StoryScenarioParseError error;
+  StoryScenarioImage image;
+  size_t parseArenaBytes = 0U;
+  size_t parseArenaUsed = 0U;
+  double parseUs = 0.0;
+};
+
+// Same sequence as StoryFsManager::loadScenario: hint, one retry, compact.
+LoadResult load(const std::string& text, StoryArena& final, size_t arenaSize = 0U, size_t chunk = 64U) {
+  LoadResult result;
+  StoryArena parse;
+  StoryScenarioImage parsed;
+  size_t size = (arenaSize != 0U) ? arenaSize : storyScenarioArenaHint(text.size());
+  const auto start = std::chrono::steady_clock::now();
+  for (uint8_t attempt = 0U; attempt < 2U; ++attempt) {
+    parse.reserve(size);
+    MemorySource src = {&text, 0U, chunk};
+    StoryJsonReader reader(readMemory, &src);
+    ++result.attempts;
+    result.ok = storyParseScenario(reader, parse, &parsed, &result.error);
+    if (result.ok || std::strcmp(result.error.code, "arena_full") != 0) {
+      break;
+    }
+    size *= 2U;
+  }
+  if (result.ok) {
+    result.ok = storyCompactScenario(parsed, parse, final, &result.image);
+  }
+  result.parseUs =
+      std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  result.parseArenaBytes = parse.capacity();
+  result.parseArenaUsed = parse.used();
+  return result;
+}
+
+bool readFile(const std::string& path, std::string* out) {
+  FILE* file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  char buffer[512];
+  size_t n = 0U;
+  out->clear();
+  while ((n = std::fread(buffer, 1U, sizeof(buffer), file)) > 0U) {
+    out->append(buffer, n);
+  }
+  std::fclose(file);
+  return true;
+}
+
+bool everyPointerIn(const StoryScenarioImage& image, const StoryArena& arena) {
+  const ScenarioDef& scenario = image.scenario;
+  // "" literals are the only strings allowed outside the arena.
+  auto ok = [&](const char* text) { return text == nullptr || arena.contains(text) || text[0] == '\0'; };
+  if (!ok(scenario.id) || !ok(scenario.initialStepId) || !arena.contains(scenario.steps)) {
+    return false;
+  }
+  for (uint8_t i = 0U; i < scenario.stepCount; ++i) {
+    const StepDef& step = scenario.steps[i];
+    if (!ok(step.id) || !ok(step.resources.screenSceneId) || !ok(step.resources.audioPackId)) {
+      return false;
+    }
+    for (uint8_t t = 0U; t < step.transitionCount; ++t) {
+      if (!arena.contains(&step.transitions[t]) || !ok(step.transitions[t].targetStepId)) {
+        return false;
+      }
+    }
+    for (uint8_t a = 0U; a < step.resources.actionCount; ++a) {
+      if (!ok(step.resources.actionIds[a])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void runDataScenarios(const char* root) {
+  static const char* kScenarios[] = {
+      "DEFAULT", "EXAMPLE_UNLOCK_EXPRESS", "EXEMPLE_UNLOCK_EXPRESS_DONE", "SPECTRE_RADIO_LAB", "ZACUS_V1_UNLOCK_ETAPE2",
+  };
+  std::printf("%-28s %6s %5s %5s %7s %7s %8s\n", "scenario", "file", "steps", "trans", "parse", "final", "us");
+  for (const char* id : kScenarios) {
+    std::string text;
+    const std::string path = std::string(root) + "/scenarios/" + id + ".json";
+    if (!readFile(path, &text)) {
+      std::printf("[FAIL] missing %s\n", path.c_str());
+      ++g_failures;
+      continue;
+    }
+    StoryArena final;
+    const LoadResult result = load(text, final);
+    if (!result.ok) {
+      std::printf("[FAIL] %s: %s at %zu\n", id, result.error.code, result.error.offset);
+      ++g_failures;
+      continue;
+    }
+    StoryValidationError error = {};
+    const bool valid = storyValidateScenarioDef(result.image.scenario, &error);
+    if (!valid) {
+      std::printf("[FAIL] %s invalid: %s %s\n", id, error.code, error.detail);
+      ++g_failures;
+    }
+    check(result.attempts == 1U, "data scenario fits the hinted arena");
+    check(everyPointerIn(result.image, final), "compacted pointers stay in the final arena");
+    check(final.capacity() < text.size(), "final arena smaller than the file");
+    std::printf("%-28s %6zu %5u %5u %7zu %7zu %8.1f\n",
+                id,
+                text.size(),
+                static_cast<unsigned>(result.image.scenario.stepCount),
+                static_cast<unsigned>(result.image.transitionCount),
+                result.parseArenaBytes,
+                final.capacity(),
+                result.parseUs);
+    if (std::strcmp(id, "DEFAULT") == 0) {
+      check(result.image.scenario.stepCount == 11U, "DEFAULT has 11 steps");
+      check(storyFindStepIndex(result.image.scenario, result.image.scenario.initialStepId) >= 0,
+            "DEFAULT initial step resolves");
+    }
+  }
+}
+
+std::string bigScenario(uint8_t steps, uint8_t transitions) {
+  std::string text = "{\"id\":\"BIG\",\"version\":3,\"initial_step\":\"S0\",\"steps\":[";
+  for (uint8_t s = 0U; s < steps; ++s) {
+    if (s != 0U) {
+      text += ",";
+    }
+    text += "{\"step_id\":\"S" + std::to_string(s) + "\",\"screen_scene_id\":\"SCENE_LOCKED\",";
+    text += "\"actions\":[\"ACTION_A\",\"ACTION_B\"],\"apps\":[\"APP_AUDIO\"],\"transitions\":[";
+    for (uint8_t t = 0U; t < transitions; ++t) {
+      if (t != 0U) {
+        text += ",";
+      }
+      text += "{\"id\":\"T" + std::to_string(s) + "_" + std::to_string(t) +
+              "\",\"trigger\":\"on_event\",\"event_type\":\"serial\",\"event_name\":\"E" + std::to_string(t) +
+              "\",\"target_step_id\":\"S" + std::to_string((s + 1U) % steps) + "\",\"priority\":" +
+              std::to_string(t) + "}";
+    }
+    text += "]}";
+  }
+  text += "]}";
+  return text;
+}
+
+void runSyntheticChecks() {
+  {
+    StoryArena final;
+    const std::string text = bigScenario(40U, 20U);
+    const LoadResult result = load(text, final, 0U, 5U);
+    check(result.ok, "40x20 scenario loads");
+    check(result.image.scenario.stepCount == 40U, "40 steps kept");
+    check(result.image.transitionCount == 800U, "800 transitions kept");
+    check(result.ok && result.image.scenario.steps[39].transitionCount == 20U, "last step keeps 20 transitions");
+    check(result.ok && std::strcmp(result.image.scenario.steps[39].transitions[19].targetStepId, "S0") == 0,
+          "last transition wraps to S0");
+    StoryValidationError error = {};
+    check(result.ok && storyValidateScenarioDef(result.image.scenario, &error), "40x20 scenario validates");
+    std::printf("synthetic 40x20: file=%zu parse_arena=%zu final=%zu attempts=%u us=%.1f\n",
+                text.size(),
+                result.parseArenaBytes,
+                final.capacity(),
+                static_cast<unsigned>(result.attempts),
+                result.parseUs);
+  }
+  {
+    // Transition indexes past 127 must survive selection in the engine.
+    StoryArena final;
+    const std::string text = bigScenario(3U, 200U);
+    const LoadResult result = load(text, final, 0U, 256U);
+    check(result.ok && result.image.scenario.steps[0].transitionCount == 200U, "200 transitions per step kept");
+    StoryEngineV2 engine;
+    check(result.ok && engine.loadScenario(result.image.scenario) && engine.start("BIG", 0U), "3x200 scenario starts");
+    StoryEvent event = {StoryEventType::kSerial, "E199", 0, 10U};
+    check(engine.postEvent(event), "E199 posted");
+    engine.update(10U);
+    check(std::strcmp(engine.lastTransitionId(), "T0_199") == 0, "transition 199 fires");
+    check(engine.currentStep() != nullptr && std::strcmp(engine.currentStep()->id, "S1") == 0, "transition 199 target");
+    event = {StoryEventType::kSerial, "E128", 0, 20U};
+    engine.postEvent(event);
+    engine.update(20U);
+    check(std::strcmp(engine.lastTransitionId(), "T1_128") == 0, "transition 128 fires");
+    event = {StoryEventType::kSerial, "E127", 0, 30U};
+    engine.postEvent(event);
+    engine.update(30U);
+    check(std::strcmp(engine.lastTransitionId(), "T2_127") == 0, "transition 127 fires");
+    check(engine.currentStep() != nullptr && std::strcmp(engine.currentStep()->id, "S0") == 0, "back to S0");
+  }
+  {
+    StoryArena final;
+    const std::string text = bigScenario(4U, 3U);
+    const size_t needed = load(text, final, 1U << 16).parseArenaUsed;
+    const LoadResult result = load(text, final, (needed * 3U) / 4U);
+    check(result.ok && result.attempts == 2U, "undersized arena retried once at twice the size");
+    const LoadResult tiny = load(text, final, needed / 4U);
+    check(!tiny.ok && std::strcmp(tiny.error.code, "arena_full") == 0, "arena still full after retry reports arena_full");
+  }
+  {
+    StoryArena final;
+    const std::string text =
+        "{\"id\":\"ESC\\u00e9\\n\",\"extra\":{\"a\":[1,2.5e3,{\"b\":null}],\"c\":true},\"initial_step\":\"A\","
+        "\"steps\":[{\"step_id\":\"A\",\"mp3_gate_open\":true,\"actions\":[7,null,\"X\"],"
+        "\"transitions\":[{\"trigger\":\"after_ms\",\"after_ms\":1500,\"target_step_id\":\"A\"}]}]}";
+    const LoadResult result = load(text, final, 0U, 3U);
+    check(result.ok, "escapes and unknown keys parse");
+    check(result.ok && std::strcmp(result.image.scenario.id, "ESC\xC3\xA9\n") == 0, "escapes decoded to UTF-8");
+    check(result.ok && result.image.scenario.steps[0].mp3GateOpen, "mp3_gate_open read");
+    check(result.ok && result.image.scenario.steps[0].resources.actionCount == 3U, "non-string actions kept empty");
+    check(result.ok && result.image.scenario.steps[0].transitions[0].trigger == StoryTransitionTrigger::kAfterMs,
+          "after_ms trigger");
+    check(result.ok && result.image.scenario.steps[0].transitions[0].afterMs == 1500U, "after_ms value");
+  }
+  {
+    static const char* kBad[] = {
+        "{\"id\":\"X\",\"steps\":[{\"step_id\":\"A\"}",      // truncated
+        "{\"id\":\"X\" \"steps\":[]}",                      // missing comma
+        "{\"id\":\"X\",\"steps\":[{\"step_id\":\"A\\q\"}]}",  // bad escape
+        "{\"id\":\"X\"}",                                   // no steps
+        "{\"id\":\"X\",\"steps\":[]} trailing",             // trailing data
+    };
+    for (const char* bad : kBad) {
+      StoryArena final;
+      const LoadResult result = load(bad, final);
+      check(!result.ok && result.error.code != nullptr, bad);
+    }
+  }
+  {
+    StoryArena arena;
+    arena.reserve(256U);
+    const char* a = arena.storeString("SCENE_LOCKED");
+    const char* b = arena.storeString("SCENE_LOCKED");
+    check(a == b, "identical strings interned");
+    check(arena.stringBytes() == std::strlen("SCENE_LOCKED") + 1U, "interned string stored once");
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* root = (argc > 1) ? argv[1] : "data/story";
+  runDataScenarios(root);
+  runSyntheticChecks();
+  if (g_failures != 0u) {
+    std::printf("story scenario load: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("story scenario load: ok\n");
+  return 0;
+}
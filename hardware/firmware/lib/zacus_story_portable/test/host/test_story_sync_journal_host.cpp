@@ -0,0 +1,161 @@
+// Host test: SD -> LittleFS story sync plan (StorySyncJournal) and the delta
+// rule (storySyncNeedsCopy). Covers the plan image, resume from appended
+// completion markers, corrupt journals, capacity/path limits, and a simulated
+// power loss replayed over an in-memory "flash" copy.
+// Build/run: make story-sync-journal-host
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "fs/story_sync_journal.h"
+
+#include "host_check.h"
+
+namespace {
+
+StorySyncProbe probe(uint32_t size, StoryDigestKind kind, uint8_t seed) {
+  StorySyncProbe out;
+  out.present = true;
+  out.size = size;
+  out.kind = kind;
+  for (size_t i = 0U; i < StoryVerifyCache::kDigestBytes; ++i) {
+    out.digest[i] = static_cast<uint8_t>(seed + i);
+  }
+  return out;
+}
+
+void runDeltaChecks() {
+  const StorySyncProbe sd = probe(100U, StoryDigestKind::kSha256, 1U);
+  StorySyncProbe fs = sd;
+  check(!storySyncNeedsCopy(sd, fs), "identical size and digest skip");
+  fs.present = false;
+  check(storySyncNeedsCopy(sd, fs), "missing target copies");
+  fs = sd;
+  fs.size = 99U;
+  check(storySyncNeedsCopy(sd, fs), "size change copies");
+  fs = sd;
+  fs.digest[31] ^= 1U;
+  check(storySyncNeedsCopy(sd, fs), "digest change copies");
+  fs = sd;
+  fs.kind = StoryDigestKind::kFnv1a32;
+  check(storySyncNeedsCopy(sd, fs), "different digest kinds copy");
+
+  StorySyncProbe fnv_sd = probe(8U, StoryDigestKind::kFnv1a32, 3U);
+  StorySyncProbe fnv_fs = fnv_sd;
+  fnv_fs.digest[10] ^= 0xFFU;
+  check(!storySyncNeedsCopy(fnv_sd, fnv_fs), "fnv compares its 4 bytes only");
+  fnv_fs.digest[0] ^= 0xFFU;
+  check(storySyncNeedsCopy(fnv_sd, fnv_fs), "fnv difference copies");
+
+  StorySyncProbe none = sd;
+  none.kind = StoryDigestKind::kNone;
+  check(storySyncNeedsCopy(none, none), "no digest always copies");
+  StorySyncProbe gone;
+  check(!storySyncNeedsCopy(gone, sd), "missing source never copies");
+}
+
+std::vector<uint8_t> image(const StorySyncJournal& journal) {
+  std::vector<uint8_t> out(journal.serializedSize());
+  journal.serialize(out.data(), out.size());
+  return out;
+}
+
+void runJournalChecks() {
+  StorySyncJournal journal;
+  const StorySyncProbe a = probe(10U, StoryDigestKind::kSha256, 9U);
+  check(journal.add("/story/screens/SCENE_A.json", 10U, a.kind, a.digest), "add first entry");
+  check(journal.add("/story/apps/APP_WIFI.json", 20U, StoryDigestKind::kFnv1a32, a.digest), "add second entry");
+  check(journal.add("/story/integrity.sha256", 30U, StoryDigestKind::kFnv1a32, a.digest), "add third entry");
+  check(!journal.add("", 1U, a.kind, a.digest), "empty path refused");
+  const std::string long_path = "/story/" + std::string(StorySyncJournal::kMaxPath, 'x');
+  check(!journal.add(long_path.c_str(), 1U, a.kind, a.digest), "path longer than the slot refused");
+  check(journal.count() == 3U && journal.totalBytes() == 60U, "count and total bytes");
+  check(!journal.finished(), "fresh plan not finished");
+
+  std::vector<uint8_t> bytes = image(journal);
+  StorySyncJournal loaded;
+  check(loaded.deserialize(bytes.data(), bytes.size()), "plan image loads");
+  check(loaded.count() == 3U && loaded.completed() == 0U, "no markers -> nothing completed");
+  check(std::strcmp(loaded.entry(1U).path, "/story/apps/APP_WIFI.json") == 0, "path kept");
+  check(loaded.entry(0U).size == 10U && std::memcmp(loaded.entry(0U).digest, a.digest, sizeof(a.digest)) == 0,
+        "size and digest kept");
+
+  bytes.push_back(StorySyncJournal::completedMarker());
+  bytes.push_back(StorySyncJournal::completedMarker());
+  check(loaded.deserialize(bytes.data(), bytes.size()) && loaded.completed() == 2U, "two markers resume at entry 2");
+  loaded.markCompleted();
+  check(loaded.finished(), "last marker finishes the plan");
+  loaded.markCompleted();
+  check(loaded.completed() == 3U, "completed never passes count");
+
+  std::vector<uint8_t> bad = bytes;
+  bad.push_back(StorySyncJournal::completedMarker());
+  bad.push_back(StorySyncJournal::completedMarker());
+  check(!loaded.deserialize(bad.data(), bad.size()) && loaded.count() == 0U, "more markers than entries rejected");
+  bad = bytes;
+  bad.back() = 0x00U;
+  check(!loaded.deserialize(bad.data(), bad.size()), "torn marker rejected");
+  bad = bytes;
+  bad[0] ^= 0xFFU;
+  check(!loaded.deserialize(bad.data(), bad.size()), "bad magic rejected");
+  check(!loaded.deserialize(bytes.data(), 20U), "truncated plan rejected");
+
+  StorySyncJournal full;
+  size_t added = 0U;
+  for (size_t i = 0U; i < StorySyncJournal::kCapacity + 5U; ++i) {
+    const std::string path = "/story/audio/A" + std::to_string(i) + ".json";
+    added += full.add(path.c_str(), 1U, a.kind, a.digest) ? 1U : 0U;
+  }
+  check(added == StorySyncJournal::kCapacity, "plan stops at capacity");
+}
+
+// Replays a sync over in-memory "flash", cutting power after `cut_after`
+// committed files, then resumes from the persisted journal image.
+void runPowerLossReplay(size_t cut_after) {
+  const size_t kFiles = 6U;
+  std::vector<std::string> sd(kFiles);
+  std::vector<std::string> flash(kFiles, "old");
+  StorySyncJournal plan;
+  for (size_t i = 0U; i < kFiles; ++i) {
+    sd[i] = "payload-" + std::to_string(i);
+    const std::string path = "/story/screens/S" + std::to_string(i) + ".json";
+    const StorySyncProbe p = probe(static_cast<uint32_t>(sd[i].size()), StoryDigestKind::kSha256, static_cast<uint8_t>(i));
+    plan.add(path.c_str(), p.size, p.kind, p.digest);
+  }
+  std::vector<uint8_t> persisted = image(plan);
+  uint32_t copies = 0U;
+  for (size_t i = 0U; i < cut_after; ++i) {
+    flash[i] = sd[i];
+    ++copies;
+    persisted.push_back(StorySyncJournal::completedMarker());
+  }
+  // Power lost here: file `cut_after` may be half written to its .part only.
+  StorySyncJournal resumed;
+  check(resumed.deserialize(persisted.data(), persisted.size()), "journal survives power loss");
+  check(resumed.completed() == cut_after, "resume point matches committed files");
+  while (!resumed.finished()) {
+    flash[resumed.completed()] = sd[resumed.completed()];
+    ++copies;
+    resumed.markCompleted();
+  }
+  check(flash == sd, "flash matches SD after resume");
+  check(copies == kFiles, "no file copied twice");
+}
+
+}  // namespace
+
+int main() {
+  runDeltaChecks();
+  runJournalChecks();
+  for (size_t cut = 0U; cut <= 6U; ++cut) {
+    runPowerLossReplay(cut);
+  }
+  if (g_failures != 0u) {
+    std::printf("story sync journal: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("story sync journal: ok\n");
+  return 0;
+}
@@ -0,0 +1,145 @@
+// Host test: story integrity verification helpers (StoryVerifyCache +
+// StoryManifest). Covers stamp-keyed hits and misses, invalidation, the
+// persisted image and its rejection paths, eviction when full, and manifest
+// parsing fed in small chunks.
+// Build/run: make story-verify-cache-host
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "fs/story_verify_cache.h"
+
+#include "host_check.h"
+
+namespace {
+
+void fillDigest(uint8_t* digest, uint8_t seed) {
+  for (size_t i = 0U; i < StoryVerifyCache::kDigestBytes; ++i) {
+    digest[i] = static_cast<uint8_t>(seed + i);
+  }
+}
+
+StoryFileStamp stamp(uint32_t size, uint32_t mtime) {
+  StoryFileStamp out;
+  out.size = size;
+  out.mtime = mtime;
+  return out;
+}
+
+void runCacheChecks() {
+  StoryVerifyCache cache;
+  uint8_t digest[StoryVerifyCache::kDigestBytes] = {};
+  uint8_t found[StoryVerifyCache::kDigestBytes] = {};
+  fillDigest(digest, 7U);
+
+  check(!cache.lookup("/story/apps/APP_WIFI.json", StoryDigestKind::kSha256, stamp(10U, 5U), found),
+        "empty cache misses");
+  cache.store("/story/apps/APP_WIFI.json", StoryDigestKind::kSha256, stamp(10U, 5U), digest);
+  check(cache.dirty(), "store marks dirty");
+  check(cache.lookup("story/apps/APP_WIFI.json", StoryDigestKind::kSha256, stamp(10U, 5U), found),
+        "hit with or without leading slash");
+  check(std::memcmp(found, digest, sizeof(digest)) == 0, "hit returns the stored digest");
+  check(!cache.lookup("/story/apps/APP_WIFI.json", StoryDigestKind::kSha256, stamp(11U, 5U), found),
+        "size change misses");
+  check(!cache.lookup("/story/apps/APP_WIFI.json", StoryDigestKind::kSha256, stamp(10U, 6U), found),
+        "mtime change misses");
+  check(!cache.lookup("/story/apps/APP_WIFI.json", StoryDigestKind::kFnv1a32, stamp(10U, 5U), found),
+        "other digest kind misses");
+  check(cache.hits() == 1U && cache.misses() == 4U, "hit/miss counters");
+
+  cache.store("/story/apps/APP_WIFI.json", StoryDigestKind::kFnv1a32, stamp(10U, 5U), digest);
+  check(cache.count() == 2U, "one entry per kind");
+  cache.store("/story/apps/APP_WIFI.json", StoryDigestKind::kSha256, stamp(12U, 9U), digest);
+  check(cache.count() == 2U, "restore replaces in place");
+  cache.invalidate("/story/apps/APP_WIFI.json");
+  check(cache.count() == 0U, "invalidate drops every kind");
+
+  // Persisted image round trip.
+  for (uint8_t i = 0U; i < 5U; ++i) {
+    const std::string path = "/story/screens/S" + std::to_string(i) + ".json";
+    fillDigest(digest, i);
+    cache.store(path.c_str(), StoryDigestKind::kSha256, stamp(100U + i, 1U), digest);
+  }
+  std::vector<uint8_t> image(cache.serializedSize());
+  check(cache.serialize(image.data(), image.size()) == image.size(), "serialize fills the image");
+  check(cache.serialize(image.data(), image.size() - 1U) == 0U, "serialize refuses a short buffer");
+  StoryVerifyCache loaded;
+  check(loaded.deserialize(image.data(), image.size()), "image loads back");
+  check(loaded.count() == 5U && !loaded.dirty(), "loaded cache is clean with every entry");
+  fillDigest(digest, 3U);
+  check(loaded.lookup("/story/screens/S3.json", StoryDigestKind::kSha256, stamp(103U, 1U), found) &&
+            std::memcmp(found, digest, sizeof(digest)) == 0,
+        "loaded entry hits");
+
+  std::vector<uint8_t> bad = image;
+  bad[0] ^= 0xFFU;
+  check(!loaded.deserialize(bad.data(), bad.size()) && loaded.count() == 0U, "bad magic rejected and cleared");
+  check(!loaded.deserialize(image.data(), image.size() - 3U), "truncated image rejected");
+  bad = image;
+  bad[4] = 0xFFU;
+  check(!loaded.deserialize(bad.data(), bad.size()), "oversized count rejected");
+
+  // Eviction keeps the cache bounded and the newest entry reachable.
+  StoryVerifyCache full;
+  for (size_t i = 0U; i < StoryVerifyCache::kCapacity + 10U; ++i) {
+    const std::string path = "/story/audio/A" + std::to_string(i) + ".json";
+    fillDigest(digest, static_cast<uint8_t>(i));
+    full.store(path.c_str(), StoryDigestKind::kSha256, stamp(1U, 1U), digest);
+  }
+  check(full.count() == StoryVerifyCache::kCapacity, "cache stays at capacity");
+  const std::string last = "/story/audio/A" + std::to_string(StoryVerifyCache::kCapacity + 9U) + ".json";
+  check(full.lookup(last.c_str(), StoryDigestKind::kSha256, stamp(1U, 1U), found), "newest entry survives eviction");
+  check(!full.lookup("/story/audio/A0.json", StoryDigestKind::kSha256, stamp(1U, 1U), found),
+        "oldest entry evicted first");
+}
+
+void runManifestChecks() {
+  const std::string hex_a(64U, 'a');
+  const std::string hex_b = "0123456789ABCDEF0123456789abcdef0123456789abcdef0123456789ABCDEF";
+  const std::string text = "# story bundle\n" + hex_a + "  story/scenarios/DEFAULT.json\n\n" + hex_b +
+                           " */story/apps/APP_WIFI.json\r\n" + "not-a-digest  story/x.json\n" + hex_a +
+                           "story/glued.json\n" + hex_a + "  story/" + std::string(200U, 'x') + ".json\n" + hex_a +
+                           "  story/last.json";
+  StoryManifest manifest;
+  for (size_t offset = 0U; offset < text.size(); offset += 7U) {
+    const size_t len = (text.size() - offset < 7U) ? text.size() - offset : 7U;
+    manifest.feed(text.data() + offset, len);
+  }
+  manifest.finish();
+  check(manifest.count() == 3U, "three valid manifest lines");
+  check(manifest.rejectedLines() == 3U, "bad, glued and overlong lines rejected");
+
+  const uint8_t* expected = manifest.expected("/story/scenarios/DEFAULT.json");
+  check(expected != nullptr && expected[0] == 0xAAU && expected[31] == 0xAAU, "leading slash optional on lookup");
+  expected = manifest.expected("story/apps/APP_WIFI.json");
+  check(expected != nullptr && expected[0] == 0x01U && expected[7] == 0xEFU && expected[31] == 0xEFU,
+        "binary marker, slash and CRLF handled; hex is case-insensitive");
+  check(manifest.expected("story/last.json") != nullptr, "unterminated last line kept by finish()");
+  check(manifest.expected("story/x.json") == nullptr, "rejected line not listed");
+
+  uint8_t digest[StoryVerifyCache::kDigestBytes] = {};
+  char formatted[StoryVerifyCache::kDigestBytes * 2U + 1U] = {};
+  check(storyParseSha256Hex(hex_b.c_str(), digest), "hex parses");
+  storyFormatSha256Hex(digest, formatted, sizeof(formatted));
+  std::string lower = hex_b;
+  for (char& c : lower) {
+    c = static_cast<char>((c >= 'A' && c <= 'F') ? c - 'A' + 'a' : c);
+  }
+  check(lower == formatted, "format writes lowercase hex");
+  check(!storyParseSha256Hex("zz", digest), "short or bad hex fails");
+}
+
+}  // namespace
+
+int main() {
+  runCacheChecks();
+  runManifestChecks();
+  if (g_failures != 0u) {
+    std::printf("story verify cache: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("story verify cache: ok\n");
+  return 0;
+}
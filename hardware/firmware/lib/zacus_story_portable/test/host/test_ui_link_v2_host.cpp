@@ -0,0 +1,288 @@
+// Host test: UI Link v2 zero-copy view vs the historical copying parser
+// (fuzz agreement, CRC table, throughput).
+// Build/run: make ui-link-parse-host (trace from tools/test/ui_link_sim.py --emit-trace)
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "ui_link_v2.h"
+
+namespace {
+
+// Pre-table implementation, kept as the reference.
+uint8_t referenceCrc8(const uint8_t* data, size_t len) {
+  uint8_t crc = 0x00u;
+  for (size_t i = 0; i < len; ++i) {
+    crc ^= data[i];
+    for (uint8_t bit = 0u; bit < 8u; ++bit) {
+      crc = ((crc & 0x80u) != 0u) ? static_cast<uint8_t>((crc << 1u) ^ 0x07u) : static_cast<uint8_t>(crc << 1u);
+    }
+  }
+  return crc;
+}
+
+// Pre-view uiLinkParseLine (bitwise CRC, copies every token).
+bool referenceParseLine(const char* line, UiLinkFrame* out) {
+  memset(out, 0, sizeof(*out));
+  size_t line_len = strnlen(line, UILINK_V2_MAX_LINE + 1u);
+  if (line_len == 0u || line_len > UILINK_V2_MAX_LINE) {
+    return false;
+  }
+  while (line_len > 0u && (line[line_len - 1u] == '\n' || line[line_len - 1u] == '\r')) {
+    --line_len;
+  }
+  if (line_len == 0u) {
+    return false;
+  }
+  const char* star = static_cast<const char*>(memchr(line, '*', line_len));
+  size_t payload_len = line_len;
+  if (star != nullptr) {
+    out->has_crc = true;
+    payload_len = static_cast<size_t>(star - line);
+    if (payload_len + 3u != line_len || !uiLinkParseHexByte(star + 1, &out->crc_expected)) {
+      return false;
+    }
+  }
+  if (payload_len == 0u) {
+    return false;
+  }
+  out->crc_computed = referenceCrc8(reinterpret_cast<const uint8_t*>(line), payload_len);
+  out->crc_ok = (!out->has_crc) || (out->crc_expected == out->crc_computed);
+  if (!out->crc_ok) {
+    return false;
+  }
+
+  const char* payload_end = line + payload_len;
+  const char* comma = static_cast<const char*>(memchr(line, ',', payload_len));
+  const size_t type_len = (comma == nullptr) ? payload_len : static_cast<size_t>(comma - line);
+  if (!uiLinkCopyBounded(out->type_token, sizeof(out->type_token), line, type_len)) {
+    return false;
+  }
+  out->type = uiLinkMsgTypeFromToken(out->type_token);
+  if (out->type == UILINK_MSG_UNKNOWN) {
+    return false;
+  }
+  if (comma == nullptr) {
+    return true;
+  }
+
+  const char* cursor = comma + 1u;
+  while (cursor < payload_end) {
+    if (out->field_count >= UILINK_V2_MAX_FIELDS) {
+      return false;
+    }
+    const size_t remaining = static_cast<size_t>(payload_end - cursor);
+    const char* next = static_cast<const char*>(memchr(cursor, ',', remaining));
+    const size_t token_len = (next == nullptr) ? remaining : static_cast<size_t>(next - cursor);
+    const char* eq = static_cast<const char*>(memchr(cursor, '=', token_len));
+    if (token_len == 0u || eq == nullptr) {
+      return false;
+    }
+    const size_t key_len = static_cast<size_t>(eq - cursor);
+    if (key_len == 0u || token_len <= key_len + 1u) {
+      return false;
+    }
+    UiLinkField* field = &out->fields[out->field_count];
+    if (!uiLinkCopyBounded(field->key, sizeof(field->key), cursor, key_len) ||
+        !uiLinkCopyBounded(field->value, sizeof(field->value), eq + 1u, token_len - key_len - 1u)) {
+      return false;
+    }
+    ++out->field_count;
+    if (next == nullptr) {
+      break;
+    }
+    cursor = next + 1u;
+  }
+  return true;
+}
+
+const char* const kKeyNames[UILINK_KEY_COUNT] = {
+    "",          "proto",     "proto_max",  "session",   "caps",          "ui_type", "ui_id",   "fw",
+    "seq",       "ms",        "mode",       "la",        "mp3",           "sd",      "key",     "track",
+    "track_total", "vol",     "u_lock",     "u_son",     "tune_off",      "tune_conf", "u_lock_listen", "mic",
+    "hold",      "startup",   "app",        "ui_page",   "ui_cursor",     "ui_offset", "ui_count", "queue",
+    "repeat",    "fx",        "backend",    "scan",      "err",           "id",      "action",  "ts",
+    "x",         "y",         "op",         "arg",
+};
+
+uint32_t g_failures = 0U;
+
+void fail(const char* what, const std::string& line) {
+  if (g_failures < 10U) {
+    std::printf("[FAIL] %s: %s\n", what, line.c_str());
+  }
+  ++g_failures;
+}
+
+// Same verdict as the reference parser, and identical content when accepted.
+void checkLine(const std::string& line) {
+  UiLinkFrame expected;
+  UiLinkFrame actual;
+  const bool ref_ok = referenceParseLine(line.c_str(), &expected);
+  const bool compat_ok = uiLinkParseLine(line.c_str(), &actual);
+  if (ref_ok != compat_ok) {
+    fail("compat verdict", line);
+    return;
+  }
+  if (expected.has_crc != actual.has_crc || expected.crc_ok != actual.crc_ok) {
+    fail("crc flags", line);
+  }
+  if (!ref_ok) {
+    return;
+  }
+  if (expected.type != actual.type || strcmp(expected.type_token, actual.type_token) != 0 ||
+      expected.field_count != actual.field_count) {
+    fail("compat header", line);
+    return;
+  }
+
+  UiLinkView view;
+  if (!uiLinkViewScan(line.data(), line.size(), &view)) {
+    fail("view rejected", line);
+    return;
+  }
+  for (uint8_t i = 0U; i < expected.field_count; ++i) {
+    if (strcmp(expected.fields[i].key, actual.fields[i].key) != 0 ||
+        strcmp(expected.fields[i].value, actual.fields[i].value) != 0) {
+      fail("compat field", line);
+      return;
+    }
+  }
+  // Every known key must resolve to the same (first) value uiLinkFindField returns.
+  for (int key = 1; key < UILINK_KEY_COUNT; ++key) {
+    const UiLinkField* field = uiLinkFindField(&expected, kKeyNames[key]);
+    UiLinkSlice slice;
+    const bool found = uiLinkViewFind(&view, static_cast<UiLinkKey>(key), &slice);
+    if (found != (field != nullptr)) {
+      fail("key index", line);
+      return;
+    }
+    if (found && (strlen(field->value) != slice.len || memcmp(field->value, line.data() + slice.off, slice.len) != 0)) {
+      fail("key value", line);
+      return;
+    }
+  }
+}
+
+std::vector<std::string> loadTrace(const char* path) {
+  std::vector<std::string> lines;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    lines.push_back(line + "\n");
+  }
+  return lines;
+}
+
+std::string mutate(const std::string& seed, std::mt19937& rng) {
+  static const char kAlphabet[] = ",=*0123456789ABCDEFabcdefSTATPINGmsq\r\n";
+  std::string line = seed;
+  const uint32_t edits = 1U + rng() % 4U;
+  for (uint32_t i = 0U; i < edits && !line.empty(); ++i) {
+    const size_t pos = rng() % line.size();
+    switch (rng() % 4U) {
+      case 0:
+        line[pos] = kAlphabet[rng() % (sizeof(kAlphabet) - 1U)];
+        break;
+      case 1:
+        line.erase(pos, 1U + rng() % 8U);
+        break;
+      case 2:
+        line.insert(pos, 1U, kAlphabet[rng() % (sizeof(kAlphabet) - 1U)]);
+        break;
+      default:
+        line[pos] = static_cast<char>(1U + rng() % 255U);
+        break;
+    }
+  }
+  return line;
+}
+
+template <typename Fn>
+double linesPerSecond(const std::vector<std::string>& lines, uint32_t rounds, Fn fn) {
+  uint32_t matched = 0U;
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t round = 0U; round < rounds; ++round) {
+    for (const std::string& line : lines) {
+      matched += fn(line) ? 1U : 0U;
+    }
+  }
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::printf("  matched=%u ", matched / rounds);
+  return static_cast<double>(lines.size()) * rounds / (seconds > 0.0 ? seconds : 1e-9);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<std::string> trace;
+  if (argc > 1) {
+    trace = loadTrace(argv[1]);
+  }
+  if (trace.empty()) {
+    std::printf("[WARN] no trace given, using built-in lines\n");
+    trace = {"HELLO,proto=2,proto_max=3,ui_type=TFT*00\n", "PING,ms=42\n", "STAT,seq=1,mode=MP3,vol=20\n"};
+  }
+
+  // CRC table against the bitwise reference.
+  std::mt19937 rng(0xC0FFEEU);
+  for (uint32_t i = 0U; i < 4096U; ++i) {
+    uint8_t buf[64];
+    const size_t len = rng() % sizeof(buf);
+    for (size_t j = 0U; j < len; ++j) {
+      buf[j] = static_cast<uint8_t>(rng());
+    }
+    if (uiLinkCrc8(buf, len) != referenceCrc8(buf, len)) {
+      fail("crc8 table", std::to_string(i));
+    }
+  }
+
+  for (const std::string& line : trace) {
+    checkLine(line);
+  }
+  uint32_t fuzzed = 0U;
+  for (uint32_t i = 0U; i < 200000U; ++i) {
+    checkLine(mutate(trace[rng() % trace.size()], rng));
+    ++fuzzed;
+  }
+  for (uint32_t i = 0U; i < 20000U; ++i) {
+    std::string noise(rng() % 400U, '\0');
+    for (char& c : noise) {
+      c = static_cast<char>(1U + rng() % 255U);
+    }
+    checkLine(noise);
+    ++fuzzed;
+  }
+  std::printf("fuzz: trace=%zu mutated=%u failures=%u\n", trace.size(), fuzzed, g_failures);
+
+  const uint32_t rounds = 50U;
+  UiLinkFrame frame;
+  std::printf("throughput (%zu lines x %u):\n", trace.size(), rounds);
+  const double legacy = linesPerSecond(trace, rounds, [&](const std::string& line) {
+    return referenceParseLine(line.c_str(), &frame) && uiLinkFindField(&frame, "mic") != nullptr;
+  });
+  std::printf("legacy copy+strcmp %.0f lines/s\n", legacy);
+  const double compat = linesPerSecond(trace, rounds, [&](const std::string& line) {
+    return uiLinkParseLine(line.c_str(), &frame) && uiLinkFindField(&frame, "mic") != nullptr;
+  });
+  std::printf("compat wrapper     %.0f lines/s\n", compat);
+  UiLinkView view;
+  const double zero_copy = linesPerSecond(trace, rounds, [&](const std::string& line) {
+    uint32_t mic = 0U;
+    return uiLinkViewScan(line.data(), line.size(), &view) && uiLinkViewU32(&view, UILINK_KEY_MIC, &mic);
+  });
+  std::printf("view + key index   %.0f lines/s (x%.1f vs legacy)\n", zero_copy, zero_copy / legacy);
+  std::printf("sizeof UiLinkFrame=%zu UiLinkView=%zu\n", sizeof(UiLinkFrame), sizeof(UiLinkView));
+
+  if (g_failures != 0U) {
+    std::printf("[FAIL] %u mismatches\n", g_failures);
+    return 1;
+  }
+  std::printf("[OK] ui_link_v2 parser\n");
+  return 0;
+}
@@ -0,0 +1,498 @@
+// Host test: UI Link v3 (COBS framing, CRC16, varint messages, UI mirror) and
+// the ESP32 UiLink session on a loopback serial.
+// Covers COBS zero runs and 254-byte blocks, CRC16 vectors, encode/decode
+// round trips and corruption, the rx accumulator, mirror deltas against a
+// stale base and an evicted one (NEED_KEYFRAME), then HELLO/ACK negotiation,
+// keyframe retry/ack, request_keyframe and the fallback to v2 text on timeout.
+// Build/run: make ui-link-v3-host
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "ui_link/ui_link.h"
+#include "ui_link_v2.h"
+#include "ui_link_v3.h"
+
+#include "host_check.h"
+
+namespace {
+
+uint32_t g_nowMs = 0U;
+
+}  // namespace
+
+uint32_t millis() {
+  return g_nowMs;
+}
+
+namespace {
+
+// Bitwise CRC16-CCITT, kept as the reference for the table.
+uint16_t referenceCrc16(const uint8_t* data, size_t len) {
+  uint16_t crc = 0xFFFFu;
+  for (size_t i = 0; i < len; ++i) {
+    crc = static_cast<uint16_t>(crc ^ (static_cast<uint16_t>(data[i]) << 8u));
+    for (uint8_t bit = 0u; bit < 8u; ++bit) {
+      crc = ((crc & 0x8000u) != 0u) ? static_cast<uint16_t>((crc << 1u) ^ 0x1021u) : static_cast<uint16_t>(crc << 1u);
+    }
+  }
+  return crc;
+}
+
+void runCrcChecks() {
+  const char* check_string = "123456789";
+  check(uiLinkCrc16(reinterpret_cast<const uint8_t*>(check_string), 9u) == 0x29B1u, "CRC16 check value 0x29B1");
+  check(uiLinkCrc16(nullptr, 0u) == 0xFFFFu, "CRC16 of nothing is the init value");
+  const uint8_t zero = 0u;
+  check(uiLinkCrc16(&zero, 1u) == 0xE1F0u, "CRC16 of 0x00");
+  const uint8_t letter = 'A';
+  check(uiLinkCrc16(&letter, 1u) == 0xB915u, "CRC16 of 'A'");
+
+  std::mt19937 rng(16U);
+  uint8_t data[300];
+  bool same = true;
+  for (uint32_t round = 0U; round < 2000U; ++round) {
+    const size_t len = rng() % sizeof(data);
+    for (size_t i = 0; i < len; ++i) {
+      data[i] = static_cast<uint8_t>(rng());
+    }
+    same = same && uiLinkCrc16(data, len) == referenceCrc16(data, len);
+  }
+  check(same, "CRC16 table matches the bitwise reference");
+}
+
+bool cobsIs(const std::vector<uint8_t>& raw, const std::vector<uint8_t>& expected) {
+  uint8_t encoded[600];
+  const size_t len = uiLinkCobsEncode(raw.data(), raw.size(), encoded, sizeof(encoded));
+  return len == expected.size() && memcmp(encoded, expected.data(), len) == 0;
+}
+
+bool cobsRoundTrip(const std::vector<uint8_t>& raw, size_t* encodedLen) {
+  uint8_t encoded[1200];
+  uint8_t decoded[1200];
+  const size_t len = uiLinkCobsEncode(raw.data(), raw.size(), encoded, sizeof(encoded));
+  *encodedLen = len;
+  if (len == 0u || len > raw.size() + (raw.size() / 254u) + 1u || memchr(encoded, 0, len) != nullptr) {
+    return false;
+  }
+  const size_t back = uiLinkCobsDecode(encoded, len, decoded, sizeof(decoded));
+  return back == raw.size() && memcmp(decoded, raw.data(), back) == 0;
+}
+
+void runCobsChecks() {
+  check(cobsIs({0x00}, {0x01, 0x01}), "COBS single zero");
+  check(cobsIs({0x00, 0x00}, {0x01, 0x01, 0x01}), "COBS two zeros");
+  check(cobsIs({0x00, 0x11, 0x00}, {0x01, 0x02, 0x11, 0x01}), "COBS zero-wrapped byte");
+  check(cobsIs({0x11, 0x22, 0x00, 0x33}, {0x03, 0x11, 0x22, 0x02, 0x33}), "COBS inner zero");
+  check(cobsIs({0x11, 0x22, 0x33, 0x44}, {0x05, 0x11, 0x22, 0x33, 0x44}), "COBS no zero");
+  check(cobsIs({0x11, 0x00, 0x00, 0x00}, {0x02, 0x11, 0x01, 0x01, 0x01}), "COBS trailing zero run");
+
+  size_t len = 0u;
+  check(cobsRoundTrip(std::vector<uint8_t>(40, 0x00), &len) && len == 41u, "COBS run of 40 zeros");
+
+  // 254 non-zero bytes fill one block exactly; 255 spill into a second one.
+  std::vector<uint8_t> block;
+  for (uint16_t i = 1u; i <= 254u; ++i) {
+    block.push_back(static_cast<uint8_t>(i));
+  }
+  check(cobsRoundTrip(block, &len) && len <= 256u, "COBS 254-byte block");
+  std::vector<uint8_t> spill = block;
+  spill.push_back(0xFFu);
+  std::vector<uint8_t> expected = {0xFFu};
+  expected.insert(expected.end(), block.begin(), block.end());
+  expected.push_back(0x02u);
+  expected.push_back(0xFFu);
+  check(cobsIs(spill, expected), "COBS 255 bytes: full block then a short one");
+  std::vector<uint8_t> zeroAfter = block;
+  zeroAfter.push_back(0x00u);
+  check(cobsRoundTrip(zeroAfter, &len), "COBS zero right after a full block");
+  std::vector<uint8_t> twoBlocks = block;
+  twoBlocks.insert(twoBlocks.end(), block.begin(), block.end());
+  check(cobsRoundTrip(twoBlocks, &len) && len <= 508u + 2u + 1u, "COBS two full blocks");
+
+  uint8_t small[8];
+  check(uiLinkCobsEncode(block.data(), block.size(), small, sizeof(small)) == 0u, "COBS encode refuses a short buffer");
+  const uint8_t truncated[] = {0x05, 0x11, 0x22};
+  uint8_t out[16];
+  check(uiLinkCobsDecode(truncated, sizeof(truncated), out, sizeof(out)) == 0u, "COBS decode rejects a short block");
+  const uint8_t zeroCode[] = {0x00, 0x11};
+  check(uiLinkCobsDecode(zeroCode, sizeof(zeroCode), out, sizeof(out)) == 0u, "COBS decode rejects a zero code");
+
+  std::mt19937 rng(254U);
+  bool ok = true;
+  for (uint32_t round = 0U; round < 3000U; ++round) {
+    std::vector<uint8_t> raw(1u + rng() % 600u);
+    const uint32_t zeroOdds = 1u + rng() % 300u;
+    for (uint8_t& byte : raw) {
+      byte = (rng() % zeroOdds == 0u) ? 0u : static_cast<uint8_t>(1u + rng() % 255u);
+    }
+    ok = ok && cobsRoundTrip(raw, &len);
+  }
+  check(ok, "COBS random round trips");
+}
+
+UiLinkV3Msg makeMsg(uint8_t type, uint8_t ref, uint32_t seq, uint32_t ms) {
+  UiLinkV3Msg msg;
+  uiLinkV3InitMsg(&msg, type, ref, seq, ms);
+  return msg;
+}
+
+bool sameMsg(const UiLinkV3Msg& a, const UiLinkV3Msg& b) {
+  if (a.type != b.type || a.ref != b.ref || a.seq != b.seq || a.ms != b.ms || a.count != b.count) {
+    return false;
+  }
+  for (uint8_t i = 0u; i < a.count; ++i) {
+    if (a.ids[i] != b.ids[i] || a.values[i] != b.values[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void runMessageChecks() {
+  UiLinkV3Msg msg = makeMsg(UILINK_V3_MSG_KEYFRAME, 0u, 0xFFFFFFFFu, 0u);
+  const int32_t extremes[] = {0, -1, 1, 127, -128, 0x7FFFFFFF, static_cast<int32_t>(0x80000000u), 0x00FF00FF};
+  for (uint8_t i = 0u; i < UILINK_V3_MAX_ITEMS; ++i) {
+    check(uiLinkV3AddItem(&msg, static_cast<uint8_t>(i == 3u ? 0u : i), extremes[i % 8u]), "add item");
+  }
+  check(!uiLinkV3AddItem(&msg, 0u, 0), "item list is bounded");
+
+  uint8_t frame[UILINK_V3_MAX_FRAME];
+  const size_t len = uiLinkV3Encode(&msg, frame, sizeof(frame));
+  check(len > 0u && len <= UILINK_V3_MAX_FRAME, "full message fits UILINK_V3_MAX_FRAME");
+  check(frame[len - 1u] == 0u && memchr(frame, 0, len - 1u) == nullptr, "only the delimiter is zero");
+  UiLinkV3Msg back;
+  check(uiLinkV3Decode(frame, len - 1u, &back) == UILINK_V3_DECODE_OK && sameMsg(msg, back), "message round trip");
+  check(uiLinkV3Encode(&msg, frame, len - 1u) == 0u, "encode refuses a short buffer");
+
+  // Every single-byte corruption is caught (CRC, COBS or format).
+  uint8_t corrupt[UILINK_V3_MAX_FRAME];
+  bool caught = true;
+  for (size_t i = 0u; i + 1u < len; ++i) {
+    memcpy(corrupt, frame, len);
+    corrupt[i] = static_cast<uint8_t>(corrupt[i] == 0xFFu ? 0x01u : corrupt[i] + 1u);
+    caught = caught && uiLinkV3Decode(corrupt, len - 1u, &back) != UILINK_V3_DECODE_OK;
+  }
+  check(caught, "single-byte corruption never decodes");
+  for (size_t cut = 1u; cut + 1u < len; cut += 7u) {
+    caught = caught && uiLinkV3Decode(frame, cut, &back) != UILINK_V3_DECODE_OK;
+  }
+  check(caught, "truncated frames never decode");
+
+  UiLinkV3Msg crcMsg = makeMsg(UILINK_V3_MSG_STAT, 4u, 9u, 10u);
+  uiLinkV3AddItem(&crcMsg, UILINK_V3_F_VOL, 50);
+  const size_t crcLen = uiLinkV3Encode(&crcMsg, frame, sizeof(frame));
+  frame[crcLen - 2u] ^= 0x01u;
+  check(uiLinkV3Decode(frame, crcLen - 1u, &back) == UILINK_V3_DECODE_ERR_CRC, "bad CRC reported as such");
+
+  // Rx accumulator: garbage, two frames back to back, an overlong frame.
+  UiLinkV3Rx rx;
+  uiLinkV3RxReset(&rx);
+  std::vector<uint8_t> stream = {0x42, 0x43, 0x00};
+  const size_t msgLen = uiLinkV3Encode(&crcMsg, frame, sizeof(frame));
+  stream.insert(stream.end(), frame, frame + msgLen);
+  stream.insert(stream.end(), frame, frame + msgLen);
+  stream.insert(stream.end(), UILINK_V3_MAX_FRAME + 10u, 0x33);
+  stream.push_back(0x00);
+  stream.insert(stream.end(), frame, frame + msgLen);
+  uint32_t decoded = 0U;
+  uint32_t rejected = 0U;
+  for (uint8_t byte : stream) {
+    const size_t got = uiLinkV3RxPush(&rx, byte);
+    if (got == 0u) {
+      continue;
+    }
+    if (uiLinkV3Decode(rx.buf, got, &back) == UILINK_V3_DECODE_OK && sameMsg(crcMsg, back)) {
+      ++decoded;
+    } else {
+      ++rejected;
+    }
+  }
+  check(decoded == 3U && rejected == 1U, "rx splits frames and drops overlong ones");
+
+  std::mt19937 rng(3U);
+  for (uint32_t round = 0U; round < 20000U; ++round) {
+    uint8_t noise[64];
+    const size_t noiseLen = 1u + rng() % sizeof(noise);
+    for (size_t i = 0u; i < noiseLen; ++i) {
+      noise[i] = static_cast<uint8_t>(1u + rng() % 255u);
+    }
+    uiLinkV3Decode(noise, noiseLen, &back);
+  }
+}
+
+UiLinkV3Msg stat(uint8_t ref, uint8_t field, int32_t value) {
+  UiLinkV3Msg msg = makeMsg(UILINK_V3_MSG_STAT, ref, 0u, 0u);
+  uiLinkV3AddItem(&msg, field, value);
+  return msg;
+}
+
+void runMirrorChecks() {
+  UiLinkV3Mirror mirror;
+  uiLinkV3MirrorReset(&mirror);
+  UiLinkV3Msg msg = stat(1u, UILINK_V3_F_VOL, 5);
+  check(uiLinkV3MirrorApply(&mirror, &msg) == UILINK_V3_APPLY_NEED_KEYFRAME && !mirror.valid,
+        "delta before any keyframe needs one");
+
+  msg = makeMsg(UILINK_V3_MSG_KEYFRAME, 1u, 1u, 0u);
+  uiLinkV3AddItem(&msg, UILINK_V3_F_VOL, 10);
+  uiLinkV3AddItem(&msg, UILINK_V3_F_KEY, 3);
+  check(uiLinkV3MirrorApply(&mirror, &msg) == UILINK_V3_APPLY_KEYFRAME && mirror.valid, "keyframe 1");
+
+  msg = stat(1u, UILINK_V3_F_VOL, 11);
+  check(uiLinkV3MirrorApply(&mirror, &msg) == UILINK_V3_APPLY_DELTA && mirror.values[UILINK_V3_F_VOL] == 11,
+        "delta on keyframe 1");
+  msg = stat(1u, UILINK_V3_F_KEY, 4);
+  uiLinkV3MirrorApply(&mirror, &msg);
+  check(mirror.values[UILINK_V3_F_VOL] == 10 && mirror.values[UILINK_V3_F_KEY] == 4,
+        "deltas apply to the base, not to the previous delta");
+
+  // Partial keyframe 2 inherits the fields it does not carry.
+  msg = makeMsg(UILINK_V3_MSG_KEYFRAME, 2u, 2u, 0u);
+  uiLinkV3AddItem(&msg, UILINK_V3_F_VOL, 20);
+  uiLinkV3MirrorApply(&mirror, &msg);
+  check(mirror.values[UILINK_V3_F_VOL] == 20 && mirror.values[UILINK_V3_F_KEY] == 4, "keyframe 2");
+
+  // The ESP32 has not seen the ack of keyframe 2 yet: its deltas still use 1.
+  msg = stat(1u, UILINK_V3_F_MIC, 7);
+  check(uiLinkV3MirrorApply(&mirror, &msg) == UILINK_V3_APPLY_DELTA && mirror.values[UILINK_V3_F_VOL] == 10 &&
+            mirror.values[UILINK_V3_F_KEY] == 3 && mirror.values[UILINK_V3_F_MIC] == 7,
+        "delta against the stale base 1");
+  msg = stat(2u, UILINK_V3_F_MIC, 8);
+  check(uiLinkV3MirrorApply(&mirror, &msg) == UILINK_V3_APPLY_DELTA && mirror.values[UILINK_V3_F_VOL] == 20 &&
+            mirror.values[UILINK_V3_F_MIC] == 8,
+        "delta against base 2");
+
+  // Keyframe 3 evicts base 1; a retried keyframe 3 reuses its own slot.
+  msg = makeMsg(UILINK_V3_MSG_KEYFRAME, 3u, 3u, 0u);
+  uiLinkV3AddItem(&msg, UILINK_V3_F_VOL, 30);
+  uiLinkV3MirrorApply(&mirror, &msg);
+  uiLinkV3MirrorApply(&mirror, &msg);
+  int32_t before[UILINK_V3_F_COUNT];
+  memcpy(before, mirror.values, sizeof(before));
+  msg = stat(1u, UILINK_V3_F_VOL, 99);
+  check(uiLinkV3MirrorApply(&mirror, &msg) == UILINK_V3_APPLY_NEED_KEYFRAME &&
+            memcmp(before, mirror.values, sizeof(before)) == 0,
+        "evicted base needs a keyframe and leaves the state alone");
+  msg = stat(2u, UILINK_V3_F_VOL, 21);
+  check(uiLinkV3MirrorApply(&mirror, &msg) == UILINK_V3_APPLY_DELTA && mirror.values[UILINK_V3_F_VOL] == 21,
+        "base 2 survives a retried keyframe 3");
+
+  msg = stat(3u, 200u, 1);
+  check(uiLinkV3MirrorApply(&mirror, &msg) == UILINK_V3_APPLY_DELTA, "unknown field ids skipped");
+  msg = makeMsg(UILINK_V3_MSG_PING, 0u, 0u, 0u);
+  check(uiLinkV3MirrorApply(&mirror, &msg) == UILINK_V3_APPLY_IGNORED, "non-state messages ignored");
+}
+
+// --- UiLink session on a loopback serial. ---
+
+constexpr uint16_t kTimeoutMs = 1500u;
+
+void sendLine(HardwareSerial& serial, const char* type, const UiLinkField* fields, uint8_t count) {
+  char line[UILINK_V2_MAX_LINE + 1u] = {};
+  const size_t len = uiLinkBuildLine(line, sizeof(line), type, fields, count);
+  serial.rx.append(line, len);
+}
+
+void sendHello(HardwareSerial& serial, bool offerV3) {
+  UiLinkField fields[2] = {};
+  snprintf(fields[0].key, sizeof(fields[0].key), "proto");
+  snprintf(fields[0].value, sizeof(fields[0].value), "2");
+  snprintf(fields[1].key, sizeof(fields[1].key), "proto_max");
+  snprintf(fields[1].value, sizeof(fields[1].value), "3");
+  sendLine(serial, "HELLO", fields, offerV3 ? 2u : 1u);
+}
+
+void sendBinary(HardwareSerial& serial, const UiLinkV3Msg& msg) {
+  uint8_t frame[UILINK_V3_MAX_FRAME];
+  const size_t len = uiLinkV3Encode(&msg, frame, sizeof(frame));
+  serial.rx.append(reinterpret_cast<const char*>(frame), len);
+}
+
+std::string takeTx(HardwareSerial& serial) {
+  std::string out;
+  out.swap(serial.tx);
+  return out;
+}
+
+std::vector<UiLinkV3Msg> binaryFrames(const std::string& bytes) {
+  std::vector<UiLinkV3Msg> out;
+  UiLinkV3Rx rx;
+  uiLinkV3RxReset(&rx);
+  for (char c : bytes) {
+    const size_t len = uiLinkV3RxPush(&rx, static_cast<uint8_t>(c));
+    UiLinkV3Msg msg;
+    if (len > 0u && uiLinkV3Decode(rx.buf, len, &msg) == UILINK_V3_DECODE_OK) {
+      out.push_back(msg);
+    }
+  }
+  return out;
+}
+
+bool hasLine(const std::string& bytes, const char* prefix) {
+  return bytes.find(prefix) != std::string::npos && bytes.find('\0') == std::string::npos;
+}
+
+// Applies every state message of tx to the mirror; returns the last result.
+UiLinkV3ApplyResult applyTx(UiLinkV3Mirror* mirror, const std::string& bytes, UiLinkV3Msg* last) {
+  UiLinkV3ApplyResult result = UILINK_V3_APPLY_IGNORED;
+  for (const UiLinkV3Msg& msg : binaryFrames(bytes)) {
+    if (msg.type == UILINK_V3_MSG_KEYFRAME || msg.type == UILINK_V3_MSG_STAT) {
+      result = uiLinkV3MirrorApply(mirror, &msg);
+      *last = msg;
+    }
+  }
+  return result;
+}
+
+void runLinkChecks() {
+  HardwareSerial serial;
+  UiLink link(serial, 16u, 17u, 57600u, 100u, 50u, 1000u, kTimeoutMs);
+  g_nowMs = 1000U;
+  link.begin();
+  link.poll(g_nowMs);
+  check(hasLine(takeTx(serial), "PING,"), "text ping before HELLO");
+
+  // v2-only UI: ACK,proto=2 and text state.
+  sendHello(serial, false);
+  g_nowMs = 1010U;
+  link.poll(g_nowMs);
+  check(hasLine(takeTx(serial), "ACK,proto=2,session=1*") && link.protocolVersion() == 2u, "v2 peer stays on text");
+
+  // v3-capable UI renegotiates.
+  sendHello(serial, true);
+  g_nowMs = 1020U;
+  link.poll(g_nowMs);
+  check(hasLine(takeTx(serial), "ACK,proto=3,session=2*") && link.protocolVersion() == 3u, "v3 negotiated");
+
+  ScreenFrame frame;
+  frame.volumePercent = 40u;
+  frame.sequence = 1u;
+  frame.nowMs = 1030U;
+  UiLinkV3Mirror ui;
+  uiLinkV3MirrorReset(&ui);
+  UiLinkV3Msg last;
+  check(link.update(frame) && applyTx(&ui, takeTx(serial), &last) == UILINK_V3_APPLY_KEYFRAME &&
+            ui.values[UILINK_V3_F_VOL] == 40,
+        "first v3 frame is a keyframe");
+  const uint8_t firstKeyframe = last.ref;
+
+  // Unacked keyframe: nothing until the retry period, then a new keyframe.
+  frame.volumePercent = 41u;
+  frame.nowMs = 1100U;
+  check(!link.update(frame) && takeTx(serial).empty(), "no delta before the keyframe is acked");
+  frame.nowMs = 1030U + UILINK_V3_KEYFRAME_RETRY_MS;
+  check(link.update(frame) && applyTx(&ui, takeTx(serial), &last) == UILINK_V3_APPLY_KEYFRAME &&
+            last.ref != firstKeyframe,
+        "keyframe retried under a new id");
+  const uint8_t secondKeyframe = last.ref;
+
+  // A late ack of the first keyframe does not move the base.
+  UiLinkV3Msg ack = makeMsg(UILINK_V3_MSG_KEYFRAME_ACK, firstKeyframe, 0u, 0u);
+  sendBinary(serial, ack);
+  g_nowMs = frame.nowMs + 10U;
+  link.poll(g_nowMs);
+  frame.volumePercent = 42u;
+  frame.nowMs = g_nowMs + 40U;
+  check(!link.update(frame), "stale ack ignored");
+  takeTx(serial);
+
+  ack.ref = secondKeyframe;
+  sendBinary(serial, ack);
+  g_nowMs = frame.nowMs + 10U;
+  link.poll(g_nowMs);
+  frame.volumePercent = 43u;
+  frame.sequence = 2u;
+  frame.nowMs = g_nowMs + 40U;
+  check(link.update(frame) && applyTx(&ui, takeTx(serial), &last) == UILINK_V3_APPLY_DELTA &&
+            last.ref == secondKeyframe && last.count == 1u && ui.values[UILINK_V3_F_VOL] == 43,
+        "delta against the acked keyframe");
+
+  // A UI that lost its bases asks for a keyframe.
+  UiLinkV3Mirror rebooted;
+  uiLinkV3MirrorReset(&rebooted);
+  check(uiLinkV3MirrorApply(&rebooted, &last) == UILINK_V3_APPLY_NEED_KEYFRAME, "fresh mirror needs a keyframe");
+  UiLinkV3Msg cmd = makeMsg(UILINK_V3_MSG_CMD, 0u, 0u, 0u);
+  uiLinkV3AddItem(&cmd, UILINK_V3_IN_CMD_OP, UILINK_V3_CMD_REQUEST_KEYFRAME);
+  sendBinary(serial, cmd);
+  g_nowMs = frame.nowMs + 5U;
+  link.poll(g_nowMs);
+  frame.nowMs = g_nowMs + 5U;
+  check(link.update(frame) && applyTx(&rebooted, takeTx(serial), &last) == UILINK_V3_APPLY_KEYFRAME &&
+            memcmp(rebooted.values, ui.values, sizeof(ui.values)) == 0,
+        "request_keyframe answered with a full keyframe");
+
+  // Binary input and a corrupted frame.
+  UiLinkV3Msg btn = makeMsg(UILINK_V3_MSG_BTN, 0u, 0u, 777u);
+  uiLinkV3AddItem(&btn, UILINK_V3_IN_BTN_ID, UI_BTN_OK);
+  uiLinkV3AddItem(&btn, UILINK_V3_IN_BTN_ACTION, UI_BTN_ACTION_DOWN);
+  sendBinary(serial, btn);
+  uint8_t bad[UILINK_V3_MAX_FRAME];
+  const size_t badLen = uiLinkV3Encode(&btn, bad, sizeof(bad));
+  bad[badLen - 2u] ^= 0x40u;
+  serial.rx.append(reinterpret_cast<const char*>(bad), badLen);
+  const uint32_t crcErrors = link.crcErrorCount();
+  g_nowMs += 10U;
+  link.poll(g_nowMs);
+  UiLinkInputEvent event;
+  check(link.consumeInputEvent(&event) && event.btnId == UI_BTN_OK && event.tsMs == 777u &&
+            !link.consumeInputEvent(&event),
+        "binary button decoded once");
+  check(link.crcErrorCount() == crcErrors + 1u, "corrupted frame counted as a CRC error");
+  takeTx(serial);
+
+  // Silence past the timeout: back to v2 text until the UI says HELLO again.
+  const uint32_t lastRx = g_nowMs;
+  g_nowMs = lastRx + kTimeoutMs;
+  link.poll(g_nowMs);
+  check(link.connected() && link.protocolVersion() == 3u, "no fallback at the timeout edge");
+  g_nowMs = lastRx + kTimeoutMs + 1U;
+  link.poll(g_nowMs);
+  check(!link.connected() && link.protocolVersion() == 2u, "timeout falls back to v2");
+  takeTx(serial);
+  frame.volumePercent = 44u;
+  frame.nowMs = g_nowMs + 200U;
+  const bool sent = link.update(frame);
+  const std::string text = takeTx(serial);
+  check(sent && hasLine(text, "STAT,") && text.find("vol=44") != std::string::npos, "state sent as v2 text");
+  // Disconnected: pings retry every 500 ms, as text.
+  g_nowMs = frame.nowMs + 500U;
+  link.poll(g_nowMs);
+  check(hasLine(takeTx(serial), "PING,"), "text ping after the fallback");
+
+  sendHello(serial, true);
+  g_nowMs += 10U;
+  link.poll(g_nowMs);
+  check(hasLine(takeTx(serial), "ACK,proto=3,session=3*") && link.protocolVersion() == 3u, "v3 renegotiated");
+  frame.nowMs = g_nowMs + 10U;
+  uiLinkV3MirrorReset(&ui);
+  check(link.update(frame) && applyTx(&ui, takeTx(serial), &last) == UILINK_V3_APPLY_KEYFRAME &&
+            ui.values[UILINK_V3_F_VOL] == 44,
+        "new session starts with a keyframe");
+
+  // A rebooted v2-only UI is heard while the link is binary.
+  sendHello(serial, false);
+  g_nowMs += 10U;
+  link.poll(g_nowMs);
+  check(hasLine(takeTx(serial), "ACK,proto=2,session=4*") && link.protocolVersion() == 2u,
+        "text HELLO in v3 renegotiates down to v2");
+}
+
+}  // namespace
+
+int main() {
+  runCrcChecks();
+  runCobsChecks();
+  runMessageChecks();
+  runMirrorChecks();
+  runLinkChecks();
+  if (g_failures != 0u) {
+    std::printf("ui link v3: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("ui link v3: ok\n");
+  return 0;
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// Compatibility shim after protocol tree migration.
+#include "../lib/zacus_story_portable/protocol/espnow_frame_v1.h"
@@ -0,0 +1,17 @@
+// host_check.h - pass/fail scaffold shared by the firmware and Freenove host
+// tests (make *-host in hardware/firmware).
+// A failed check prints its label and is counted; main() returns non-zero
+// when g_failures is set. Header-only, one test binary per translation unit.
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+inline uint32_t g_failures = 0u;
+
+inline void check(bool condition, const char* what) {
+  if (!condition) {
+    std::printf("[FAIL] %s\n", what);
+    ++g_failures;
+  }
+}
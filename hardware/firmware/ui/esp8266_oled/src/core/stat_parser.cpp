@@ -1,82 +1,79 @@
 #include "stat_parser.h"
 
-#include <cstdlib>
 #include <cstring>
 
 namespace screen_core {
 
 namespace {
 
-bool parseUint32Field(const UiLinkFrame& frame, const char* key, uint32_t* outValue) {
-  if (outValue == nullptr) {
-    return false;
-  }
-  const UiLinkField* field = uiLinkFindField(&frame, key);
-  if (field == nullptr || field->value[0] == '\0') {
-    return false;
+uint8_t clampU8(int32_t value, uint8_t minValue, uint8_t maxValue) {
+  if (value < minValue) {
+    return minValue;
   }
-  char* end = nullptr;
-  const unsigned long value = strtoul(field->value, &end, 10);
-  if (end == nullptr || *end != '\0') {
-    return false;
+  if (value > maxValue) {
+    return maxValue;
   }
-  *outValue = static_cast<uint32_t>(value);
-  return true;
+  return static_cast<uint8_t>(value);
 }
 
-bool parseInt32Field(const UiLinkFrame& frame, const char* key, int32_t* outValue) {
-  if (outValue == nullptr) {
-    return false;
+int8_t clampTuningOffset(int32_t value) {
+  if (value < -8) {
+    return -8;
   }
-  const UiLinkField* field = uiLinkFindField(&frame, key);
-  if (field == nullptr || field->value[0] == '\0') {
-    return false;
+  if (value > 8) {
+    return 8;
   }
-  char* end = nullptr;
-  const long value = strtol(field->value, &end, 10);
-  if (end == nullptr || *end != '\0') {
-    return false;
-  }
-  *outValue = static_cast<int32_t>(value);
-  return true;
+  return static_cast<int8_t>(value);
 }
 
-bool parseBoolField(const UiLinkFrame& frame, const char* key, bool* outValue) {
-  if (outValue == nullptr) {
-    return false;
-  }
-  const UiLinkField* field = uiLinkFindField(&frame, key);
-  if (field == nullptr || field->value[0] == '\0') {
-    return false;
+uint8_t clampStartupStage(uint32_t value) {
+  return (value == kStartupStageBootValidation) ? kStartupStageBootValidation : kStartupStageInactive;
+}
+
+uint8_t clampAppStage(uint32_t value) {
+  return (value > kAppStageMp3) ? kAppStageULockWaiting : static_cast<uint8_t>(value);
+}
+
+int32_t modeFromSlice(const char* token, size_t len) {
+  if (len == 3U && memcmp(token, "MP3", 3U) == 0) {
+    return UILINK_V3_MODE_MP3;
   }
-  if (strcmp(field->value, "1") == 0 || strcmp(field->value, "true") == 0) {
-    *outValue = true;
-    return true;
+  if (len == 6U && memcmp(token, "U_LOCK", 6U) == 0) {
+    return UILINK_V3_MODE_U_LOCK;
   }
-  if (strcmp(field->value, "0") == 0 || strcmp(field->value, "false") == 0) {
-    *outValue = false;
-    return true;
+  if (len == 5U && memcmp(token, "STORY", 5U) == 0) {
+    return UILINK_V3_MODE_STORY;
   }
-  return false;
+  return UILINK_V3_MODE_SIGNAL;
 }
 
-uint8_t clampU8(int32_t value, uint8_t minValue, uint8_t maxValue) {
-  if (value < minValue) {
-    return minValue;
-  }
-  if (value > maxValue) {
-    return maxValue;
+void applyMode(int32_t mode, TelemetryState* out) {
+  if (mode == UILINK_V3_MODE_MP3) {
+    out->mp3Mode = true;
+    out->appStage = kAppStageMp3;
+  } else if (mode == UILINK_V3_MODE_U_LOCK) {
+    out->mp3Mode = false;
+    if (!out->uLockMode) {
+      out->uLockMode = true;
+    }
+    if (out->appStage > kAppStageULockListening) {
+      out->appStage = kAppStageULockWaiting;
+    }
+  } else if (mode == UILINK_V3_MODE_STORY) {
+    out->mp3Mode = false;
+    out->uSonFunctional = true;
+  } else {
+    out->mp3Mode = false;
   }
-  return static_cast<uint8_t>(value);
 }
 
 }  // namespace
 
-bool parseStatFrame(const UiLinkFrame& frame, TelemetryState* out, uint32_t nowMs) {
+bool parseStatFrame(const UiLinkView& view, TelemetryState* out, uint32_t nowMs) {
   if (out == nullptr) {
     return false;
   }
-  if (frame.type != UILINK_MSG_STAT && frame.type != UILINK_MSG_KEYFRAME) {
+  if (view.type != UILINK_MSG_STAT && view.type != UILINK_MSG_KEYFRAME) {
     return false;
   }
 
@@ -84,126 +81,142 @@ bool parseStatFrame(const UiLinkFrame& frame, TelemetryState* out, uint32_t nowM
   int32_t i32 = 0;
   bool b = false;
 
-  if (parseUint32Field(frame, "seq", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_SEQ, &u32)) {
     out->frameSeq = u32;
   }
-  if (parseUint32Field(frame, "ms", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_MS, &u32)) {
     out->uptimeMs = u32;
   }
 
-  if (parseBoolField(frame, "la", &b)) {
+  if (uiLinkViewBool(&view, UILINK_KEY_LA, &b)) {
     out->laDetected = b;
   }
-  if (parseBoolField(frame, "mp3", &b)) {
+  if (uiLinkViewBool(&view, UILINK_KEY_MP3, &b)) {
     out->mp3Playing = b;
   }
-  if (parseBoolField(frame, "sd", &b)) {
+  if (uiLinkViewBool(&view, UILINK_KEY_SD, &b)) {
     out->sdReady = b;
   }
-  if (parseBoolField(frame, "u_lock", &b)) {
+  if (uiLinkViewBool(&view, UILINK_KEY_U_LOCK, &b)) {
     out->uLockMode = b;
   }
-  if (parseBoolField(frame, "u_lock_listen", &b)) {
+  if (uiLinkViewBool(&view, UILINK_KEY_U_LOCK_LISTEN, &b)) {
     out->uLockListening = b;
   }
-  if (parseBoolField(frame, "u_son", &b)) {
+  if (uiLinkViewBool(&view, UILINK_KEY_U_SON, &b)) {
     out->uSonFunctional = b;
   }
-  if (parseBoolField(frame, "fx", &b)) {
+  if (uiLinkViewBool(&view, UILINK_KEY_FX, &b)) {
     out->fxActive = b;
   }
-  if (parseBoolField(frame, "scan", &b)) {
+  if (uiLinkViewBool(&view, UILINK_KEY_SCAN, &b)) {
     out->scanBusy = b;
   }
 
-  if (parseUint32Field(frame, "key", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_KEY, &u32)) {
     out->key = clampU8(static_cast<int32_t>(u32), 0, 6);
   }
-  if (parseUint32Field(frame, "track", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_TRACK, &u32)) {
     out->track = static_cast<uint16_t>(u32);
   }
-  if (parseUint32Field(frame, "track_total", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_TRACK_TOTAL, &u32)) {
     out->trackCount = static_cast<uint16_t>(u32);
   }
-  if (parseUint32Field(frame, "vol", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_VOL, &u32)) {
     out->volumePercent = clampU8(static_cast<int32_t>(u32), 0, 100);
   }
-  if (parseInt32Field(frame, "tune_off", &i32)) {
-    if (i32 < -8) {
-      i32 = -8;
-    }
-    if (i32 > 8) {
-      i32 = 8;
-    }
-    out->tuningOffset = static_cast<int8_t>(i32);
+  if (uiLinkViewI32(&view, UILINK_KEY_TUNE_OFF, &i32)) {
+    out->tuningOffset = clampTuningOffset(i32);
   }
-  if (parseUint32Field(frame, "tune_conf", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_TUNE_CONF, &u32)) {
     out->tuningConfidence = clampU8(static_cast<int32_t>(u32), 0, 100);
   }
-  if (parseUint32Field(frame, "mic", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_MIC, &u32)) {
     out->micLevelPercent = clampU8(static_cast<int32_t>(u32), 0, 100);
   }
-  if (parseUint32Field(frame, "hold", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_HOLD, &u32)) {
     out->unlockHoldPercent = clampU8(static_cast<int32_t>(u32), 0, 100);
   }
-  if (parseUint32Field(frame, "startup", &u32)) {
-    out->startupStage = (u32 == kStartupStageBootValidation) ? kStartupStageBootValidation
-                                                             : kStartupStageInactive;
+  if (uiLinkViewU32(&view, UILINK_KEY_STARTUP, &u32)) {
+    out->startupStage = clampStartupStage(u32);
   }
-  if (parseUint32Field(frame, "app", &u32)) {
-    if (u32 > kAppStageMp3) {
-      u32 = kAppStageULockWaiting;
-    }
-    out->appStage = static_cast<uint8_t>(u32);
+  if (uiLinkViewU32(&view, UILINK_KEY_APP, &u32)) {
+    out->appStage = clampAppStage(u32);
   }
-  if (parseUint32Field(frame, "ui_page", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_UI_PAGE, &u32)) {
     out->uiPage = static_cast<uint8_t>(u32);
   }
-  if (parseUint32Field(frame, "ui_cursor", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_UI_CURSOR, &u32)) {
     out->uiCursor = static_cast<uint16_t>(u32);
   }
-  if (parseUint32Field(frame, "ui_offset", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_UI_OFFSET, &u32)) {
     out->uiOffset = static_cast<uint16_t>(u32);
   }
-  if (parseUint32Field(frame, "ui_count", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_UI_COUNT, &u32)) {
     out->uiCount = static_cast<uint16_t>(u32);
   }
-  if (parseUint32Field(frame, "queue", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_QUEUE, &u32)) {
     out->queueCount = static_cast<uint16_t>(u32);
   }
-  if (parseUint32Field(frame, "repeat", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_REPEAT, &u32)) {
     out->repeatMode = static_cast<uint8_t>(u32);
   }
-  if (parseUint32Field(frame, "backend", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_BACKEND, &u32)) {
     out->backendMode = static_cast<uint8_t>(u32);
   }
-  if (parseUint32Field(frame, "err", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_ERR, &u32)) {
     out->errorCode = static_cast<uint8_t>(u32);
   }
 
-  const UiLinkField* modeField = uiLinkFindField(&frame, "mode");
-  if (modeField != nullptr) {
-    if (strcmp(modeField->value, "MP3") == 0) {
-      out->mp3Mode = true;
-      out->appStage = kAppStageMp3;
-    } else if (strcmp(modeField->value, "U_LOCK") == 0) {
-      out->mp3Mode = false;
-      if (!out->uLockMode) {
-        out->uLockMode = true;
-      }
-      if (out->appStage > kAppStageULockListening) {
-        out->appStage = kAppStageULockWaiting;
-      }
-    } else if (strcmp(modeField->value, "STORY") == 0) {
-      out->mp3Mode = false;
-      out->uSonFunctional = true;
-    } else {
-      out->mp3Mode = false;
-    }
+  UiLinkSlice mode = {};
+  if (uiLinkViewFind(&view, UILINK_KEY_MODE, &mode)) {
+    applyMode(modeFromSlice(view.line + mode.off, mode.len), out);
   }
 
   out->lastRxMs = nowMs;
   return true;
 }
 
+bool parseStatState(const UiLinkV3Mirror& state, TelemetryState* out, uint32_t nowMs) {
+  if (out == nullptr || !state.valid) {
+    return false;
+  }
+  const int32_t* v = state.values;
+  out->frameSeq = state.seq;
+  out->uptimeMs = state.ms;
+
+  out->laDetected = v[UILINK_V3_F_LA] != 0;
+  out->mp3Playing = v[UILINK_V3_F_MP3] != 0;
+  out->sdReady = v[UILINK_V3_F_SD] != 0;
+  out->uLockMode = v[UILINK_V3_F_U_LOCK] != 0;
+  out->uLockListening = v[UILINK_V3_F_U_LOCK_LISTEN] != 0;
+  out->uSonFunctional = v[UILINK_V3_F_U_SON] != 0;
+  out->fxActive = v[UILINK_V3_F_FX] != 0;
+  out->scanBusy = v[UILINK_V3_F_SCAN] != 0;
+  out->micScopeEnabled = v[UILINK_V3_F_MIC_SCOPE] != 0;
+
+  out->key = clampU8(v[UILINK_V3_F_KEY], 0, 6);
+  out->track = static_cast<uint16_t>(v[UILINK_V3_F_TRACK]);
+  out->trackCount = static_cast<uint16_t>(v[UILINK_V3_F_TRACK_TOTAL]);
+  out->volumePercent = clampU8(v[UILINK_V3_F_VOL], 0, 100);
+  out->tuningOffset = clampTuningOffset(v[UILINK_V3_F_TUNE_OFF]);
+  out->tuningConfidence = clampU8(v[UILINK_V3_F_TUNE_CONF], 0, 100);
+  out->micLevelPercent = clampU8(v[UILINK_V3_F_MIC], 0, 100);
+  out->unlockHoldPercent = clampU8(v[UILINK_V3_F_HOLD], 0, 100);
+  out->startupStage = clampStartupStage(static_cast<uint32_t>(v[UILINK_V3_F_STARTUP]));
+  out->appStage = clampAppStage(static_cast<uint32_t>(v[UILINK_V3_F_APP]));
+  out->uiPage = static_cast<uint8_t>(v[UILINK_V3_F_UI_PAGE]);
+  out->uiCursor = static_cast<uint16_t>(v[UILINK_V3_F_UI_CURSOR]);
+  out->uiOffset = static_cast<uint16_t>(v[UILINK_V3_F_UI_OFFSET]);
+  out->uiCount = static_cast<uint16_t>(v[UILINK_V3_F_UI_COUNT]);
+  out->queueCount = static_cast<uint16_t>(v[UILINK_V3_F_QUEUE]);
+  out->repeatMode = static_cast<uint8_t>(v[UILINK_V3_F_REPEAT]);
+  out->backendMode = static_cast<uint8_t>(v[UILINK_V3_F_BACKEND]);
+  out->errorCode = static_cast<uint8_t>(v[UILINK_V3_F_ERR]);
+
+  applyMode(v[UILINK_V3_F_MODE], out);
+  out->lastRxMs = nowMs;
+  return true;
+}
+
 }  // namespace screen_core
@@ -4,9 +4,13 @@
 
 #include "telemetry_state.h"
 #include "ui_link_v2.h"
+#include "ui_link_v3.h"
 
 namespace screen_core {
 
-bool parseStatFrame(const UiLinkFrame& frame, TelemetryState* out, uint32_t nowMs);
+// `view` slices the receive line; only fields present in the frame are updated.
+bool parseStatFrame(const UiLinkView& view, TelemetryState* out, uint32_t nowMs);
+// UI Link v3: maps a mirror rebuilt from KEYFRAME/STAT deltas.
+bool parseStatState(const UiLinkV3Mirror& state, TelemetryState* out, uint32_t nowMs);
 
 }  // namespace screen_core
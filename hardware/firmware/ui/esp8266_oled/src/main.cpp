@@ -19,6 +19,7 @@ UiNavEngine g_nav;
 #include "core/stat_parser.h"
 #include "core/telemetry_state.h"
 #include "ui_link_v2.h"
+#include "ui_link_v3.h"
 
 namespace {
 
@@ -103,8 +104,11 @@ bool g_scopeFilled = false;
 uint32_t g_unlockSequenceStartMs = 0;
 uint32_t g_bootSplashUntilMs = 0;
 uint32_t g_lastHelloMs = 0;
-UiLinkFrame g_cachedFrame;
 bool g_linkAcked = false;
+// Set by ACK,proto=3: the link carries COBS binary frames until it drops.
+bool g_linkBinary = false;
+UiLinkV3Rx g_linkFrame;
+UiLinkV3Mirror g_linkMirror;
 uint32_t g_uiDiagStartMs = 0;
 uint32_t g_uiDiagTxFrames = 0;
 uint32_t g_uiDiagRxFrames = 0;
@@ -162,11 +166,11 @@ void uiDiagLogTx(const char* type, size_t lineLen) {
                 static_cast<unsigned long>(g_uiDiagTxFrames));
 }
 
-void uiDiagLogRx(const UiLinkFrame& frame) {
+void uiDiagLogRx(const UiLinkView& view) {
   ++g_uiDiagRxFrames;
-  if (frame.type == UILINK_MSG_PING) {
+  if (view.type == UILINK_MSG_PING) {
     ++g_uiDiagPingRx;
-  } else if (frame.type == UILINK_MSG_ACK) {
+  } else if (view.type == UILINK_MSG_ACK) {
     ++g_uiDiagAckRx;
   }
   const uint32_t nowMs = millis();
@@ -174,11 +178,12 @@ void uiDiagLogRx(const UiLinkFrame& frame) {
     return;
   }
   ++g_uiDiagRxLogs;
-  Serial.printf("[UI_DIAG][ESP8266][RX] ms=%lu type=%s fields=%u crc=%u rx_frames=%lu\n",
+  Serial.printf("[UI_DIAG][ESP8266][RX] ms=%lu type=%.*s fields=%u crc=%u rx_frames=%lu\n",
                 static_cast<unsigned long>(nowMs),
-                frame.type_token,
-                static_cast<unsigned int>(frame.field_count),
-                frame.crc_ok ? 1U : 0U,
+                static_cast<int>(view.type_token.len),
+                view.line + view.type_token.off,
+                static_cast<unsigned int>(view.field_count),
+                view.crc_ok ? 1U : 0U,
                 static_cast<unsigned long>(g_uiDiagRxFrames));
 }
 
@@ -1090,26 +1095,119 @@ void sendHelloFrame() {
   if (!g_linkState.linkEnabled) {
     return;
   }
-  UiLinkField fields[2] = {};
+  UiLinkField fields[3] = {};
   snprintf(fields[0].key, sizeof(fields[0].key), "proto");
   snprintf(fields[0].value, sizeof(fields[0].value), "2");
   snprintf(fields[1].key, sizeof(fields[1].key), "ui_type");
   snprintf(fields[1].value, sizeof(fields[1].value), "OLED");
-  if (sendLinkFrame("HELLO", fields, 2U)) {
+  snprintf(fields[2].key, sizeof(fields[2].key), "proto_max");
+  snprintf(fields[2].value, sizeof(fields[2].value), "3");
+  if (sendLinkFrame("HELLO", fields, 3U)) {
     g_lastHelloMs = millis();
   }
 }
 
+bool sendBinaryFrame(const char* type, const UiLinkV3Msg& msg) {
+  if (!g_linkState.linkEnabled) {
+    return false;
+  }
+  uint8_t encoded[UILINK_V3_MAX_FRAME];
+  const size_t len = uiLinkV3Encode(&msg, encoded, sizeof(encoded));
+  if (len == 0U) {
+    return false;
+  }
+  g_link.write(encoded, len);
+  uiDiagLogTx(type, len);
+  return true;
+}
+
 void sendPongFrame(uint32_t nowMs) {
   if (!g_linkState.linkEnabled) {
     return;
   }
+  if (g_linkBinary) {
+    UiLinkV3Msg msg;
+    uiLinkV3InitMsg(&msg, UILINK_V3_MSG_PONG, 0U, 0U, nowMs);
+    (void)sendBinaryFrame("PONG", msg);
+    return;
+  }
   UiLinkField fields[1] = {};
   snprintf(fields[0].key, sizeof(fields[0].key), "ms");
   snprintf(fields[0].value, sizeof(fields[0].value), "%lu", static_cast<unsigned long>(nowMs));
   (void)sendLinkFrame("PONG", fields, 1U);
 }
 
+void commitParsedState(const screen_core::TelemetryState& parsed) {
+  if (g_hasValidState &&
+      (parsed.uptimeMs + kPeerUptimeRollbackSlackMs) < g_state.uptimeMs) {
+      g_linkState.peerRebootUntilMs = millis() + kPeerRebootGraceMs;
+      Serial.println(String("[UI_LINK] DEBUG: Peer reboot detecte: uptime ") + String(g_state.uptimeMs) + " -> " + String(parsed.uptimeMs));
+  }
+  if (g_state.appStage != screen_core::kAppStageUSonFunctional &&
+      parsed.appStage == screen_core::kAppStageUSonFunctional) {
+    g_unlockSequenceStartMs = millis();
+  } else if (g_state.appStage == screen_core::kAppStageUSonFunctional &&
+             parsed.appStage != screen_core::kAppStageUSonFunctional) {
+    g_unlockSequenceStartMs = 0;
+  }
+  if (g_hasValidState) {
+    if (parsed.frameSeq < g_state.frameSeq) {
+      ++g_seqRollbackCount;
+    } else if (parsed.frameSeq > (g_state.frameSeq + 1U)) {
+      g_seqGapCount += (parsed.frameSeq - g_state.frameSeq - 1U);
+    }
+  }
+  pushScopeSample(parsed.micLevelPercent);
+  g_state = parsed;
+  g_hasValidState = true;
+  g_stateDirty = true;
+}
+
+void handleBinaryFrame(size_t len) {
+  UiLinkV3Msg msg;
+  const UiLinkV3DecodeResult result = uiLinkV3Decode(g_linkFrame.buf, len, &msg);
+  if (result == UILINK_V3_DECODE_ERR_CRC) {
+    ++g_crcErrorCount;
+    uiDiagLogError("crc_v3");
+    return;
+  }
+  if (result != UILINK_V3_DECODE_OK) {
+    ++g_parseErrorCount;
+    uiDiagLogError("parse_v3");
+    return;
+  }
+  ++g_uiDiagRxFrames;
+  const uint32_t nowMs = millis();
+  if (msg.type == UILINK_V3_MSG_PING) {
+    ++g_uiDiagPingRx;
+    sendPongFrame(nowMs);
+    return;
+  }
+
+  UiLinkV3Msg reply;
+  switch (uiLinkV3MirrorApply(&g_linkMirror, &msg)) {
+    case UILINK_V3_APPLY_KEYFRAME:
+      uiLinkV3InitMsg(&reply, UILINK_V3_MSG_KEYFRAME_ACK, msg.ref, 0U, nowMs);
+      (void)sendBinaryFrame("KF_ACK", reply);
+      break;
+    case UILINK_V3_APPLY_DELTA:
+      break;
+    case UILINK_V3_APPLY_NEED_KEYFRAME:
+      uiLinkV3InitMsg(&reply, UILINK_V3_MSG_CMD, 0U, 0U, nowMs);
+      uiLinkV3AddItem(&reply, UILINK_V3_IN_CMD_OP, UILINK_V3_CMD_REQUEST_KEYFRAME);
+      (void)sendBinaryFrame("CMD", reply);
+      return;
+    case UILINK_V3_APPLY_IGNORED:
+    default:
+      return;
+  }
+
+  screen_core::TelemetryState parsed = g_state;
+  if (screen_core::parseStatState(g_linkMirror, &parsed, nowMs)) {
+    commitParsedState(parsed);
+  }
+}
+
 void handleIncoming() {
   const uint32_t budgetStartUs = micros();
   uint16_t consumedBytes = 0;
@@ -1122,53 +1220,44 @@ void handleIncoming() {
     }
     ++consumedBytes;
     g_linkState.lastByteMs = millis();
-    const char c = static_cast<char>(g_link.read());
+    const int raw = g_link.read();
+    if (g_linkBinary) {
+      const size_t frameLen = uiLinkV3RxPush(&g_linkFrame, static_cast<uint8_t>(raw));
+      if (frameLen > 0U) {
+        handleBinaryFrame(frameLen);
+      }
+      continue;
+    }
+    const char c = static_cast<char>(raw);
     if (c == '\r') {
       continue;
     }
 
     if (c == '\n') {
       if (!g_dropLineUntilNewline) {
-        g_lineBuffer[g_lineLen] = '\0';
-        UiLinkFrame* frame = &g_cachedFrame;
-        if (uiLinkParseLine(g_lineBuffer, frame)) {
-          uiDiagLogRx(*frame);
+        UiLinkView view;
+        if (uiLinkViewScan(g_lineBuffer, g_lineLen, &view)) {
+          uiDiagLogRx(view);
           const uint32_t nowMs = millis();
-          if (frame->type == UILINK_MSG_PING) {
+          if (view.type == UILINK_MSG_PING) {
             sendPongFrame(nowMs);
-          } else if (frame->type == UILINK_MSG_ACK) {
+          } else if (view.type == UILINK_MSG_ACK) {
             g_linkAcked = true;
             g_stateDirty = true;
+            if (uiLinkViewEquals(&view, UILINK_KEY_PROTO, "3")) {
+              // Bytes after this line are COBS frames.
+              g_linkBinary = true;
+              uiLinkV3RxReset(&g_linkFrame);
+              uiLinkV3MirrorReset(&g_linkMirror);
+            }
           } else {
             screen_core::TelemetryState parsed = g_state;
-            if (screen_core::parseStatFrame(*frame, &parsed, nowMs)) {
-              if (g_hasValidState &&
-                  (parsed.uptimeMs + kPeerUptimeRollbackSlackMs) < g_state.uptimeMs) {
-                  g_linkState.peerRebootUntilMs = millis() + kPeerRebootGraceMs;
-                  Serial.println(String("[UI_LINK] DEBUG: Peer reboot detecte: uptime ") + String(g_state.uptimeMs) + " -> " + String(parsed.uptimeMs));
-              }
-              if (g_state.appStage != screen_core::kAppStageUSonFunctional &&
-                  parsed.appStage == screen_core::kAppStageUSonFunctional) {
-                g_unlockSequenceStartMs = millis();
-              } else if (g_state.appStage == screen_core::kAppStageUSonFunctional &&
-                         parsed.appStage != screen_core::kAppStageUSonFunctional) {
-                g_unlockSequenceStartMs = 0;
-              }
-              if (g_hasValidState) {
-                if (parsed.frameSeq < g_state.frameSeq) {
-                  ++g_seqRollbackCount;
-                } else if (parsed.frameSeq > (g_state.frameSeq + 1U)) {
-                  g_seqGapCount += (parsed.frameSeq - g_state.frameSeq - 1U);
-                }
-              }
-              pushScopeSample(parsed.micLevelPercent);
-              g_state = parsed;
-              g_hasValidState = true;
-              g_stateDirty = true;
+            if (screen_core::parseStatFrame(view, &parsed, nowMs)) {
+              commitParsedState(parsed);
             }
           }
         } else if (g_lineLen > 0U) {
-          if (strchr(g_lineBuffer, '*') != nullptr) {
+          if (view.has_crc && !view.crc_ok) {
             ++g_crcErrorCount;
             uiDiagLogError("crc");
           } else {
@@ -1320,6 +1409,10 @@ void loop() {
   if (!linkAlive && g_linkWasAlive) {
     ++g_linkLossCount;
     g_linkAcked = false;
+    // Renegotiate from text with the next HELLO.
+    g_linkBinary = false;
+    g_lineLen = 0;
+    g_dropLineUntilNewline = false;
     g_stateDirty = true;
   }
   if (linkAlive) {
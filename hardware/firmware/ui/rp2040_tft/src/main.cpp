@@ -47,40 +47,6 @@ lv_obj_t* g_labelVolume = nullptr;
 lv_obj_t* g_labelTune = nullptr;
 lv_obj_t* g_labelMeta = nullptr;
 
-bool parseUint32(const UiLinkFrame& frame, const char* key, uint32_t* outValue) {
-  if (outValue == nullptr) {
-    return false;
-  }
-  const UiLinkField* field = uiLinkFindField(&frame, key);
-  if (field == nullptr || field->value[0] == '\0') {
-    return false;
-  }
-  char* end = nullptr;
-  const unsigned long parsed = strtoul(field->value, &end, 10);
-  if (end == nullptr || *end != '\0') {
-    return false;
-  }
-  *outValue = static_cast<uint32_t>(parsed);
-  return true;
-}
-
-bool parseInt32(const UiLinkFrame& frame, const char* key, int32_t* outValue) {
-  if (outValue == nullptr) {
-    return false;
-  }
-  const UiLinkField* field = uiLinkFindField(&frame, key);
-  if (field == nullptr || field->value[0] == '\0') {
-    return false;
-  }
-  char* end = nullptr;
-  const long parsed = strtol(field->value, &end, 10);
-  if (end == nullptr || *end != '\0') {
-    return false;
-  }
-  *outValue = static_cast<int32_t>(parsed);
-  return true;
-}
-
 void renderSnapshot(uint32_t nowMs) {
   const bool linkUp = g_link.connected();
   if (g_labelLink != nullptr) {
@@ -124,44 +90,44 @@ void renderSnapshot(uint32_t nowMs) {
   (void)nowMs;
 }
 
-void onIncomingFrame(const UiLinkFrame& frame, uint32_t nowMs, void* ctx) {
+void onIncomingFrame(const UiLinkView& view, uint32_t nowMs, void* ctx) {
   (void)ctx;
-  if (frame.type != UILINK_MSG_STAT && frame.type != UILINK_MSG_KEYFRAME) {
+  if (view.type != UILINK_MSG_STAT && view.type != UILINK_MSG_KEYFRAME) {
     return;
   }
 
-  const UiLinkField* mode = uiLinkFindField(&frame, "mode");
-  if (mode != nullptr) {
-    snprintf(g_snapshot.mode, sizeof(g_snapshot.mode), "%s", mode->value);
+  UiLinkSlice mode = {};
+  if (uiLinkViewFind(&view, UILINK_KEY_MODE, &mode)) {
+    uiLinkViewCopy(&view, mode, g_snapshot.mode, sizeof(g_snapshot.mode));
   }
 
   uint32_t u32 = 0;
   int32_t i32 = 0;
-  if (parseUint32(frame, "seq", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_SEQ, &u32)) {
     g_snapshot.seq = u32;
   }
-  if (parseUint32(frame, "ms", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_MS, &u32)) {
     g_snapshot.ms = u32;
   }
-  if (parseUint32(frame, "track", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_TRACK, &u32)) {
     g_snapshot.track = static_cast<uint16_t>(u32);
   }
-  if (parseUint32(frame, "track_total", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_TRACK_TOTAL, &u32)) {
     g_snapshot.trackTotal = static_cast<uint16_t>(u32);
   }
-  if (parseUint32(frame, "vol", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_VOL, &u32)) {
     g_snapshot.volume = static_cast<uint8_t>(u32 > 100U ? 100U : u32);
   }
-  if (parseUint32(frame, "hold", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_HOLD, &u32)) {
     g_snapshot.hold = static_cast<uint8_t>(u32 > 100U ? 100U : u32);
   }
-  if (parseUint32(frame, "tune_conf", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_TUNE_CONF, &u32)) {
     g_snapshot.tuningConfidence = static_cast<uint8_t>(u32 > 100U ? 100U : u32);
   }
-  if (parseUint32(frame, "key", &u32)) {
+  if (uiLinkViewU32(&view, UILINK_KEY_KEY, &u32)) {
     g_snapshot.key = static_cast<uint8_t>(u32);
   }
-  if (parseInt32(frame, "tune_off", &i32)) {
+  if (uiLinkViewI32(&view, UILINK_KEY_TUNE_OFF, &i32)) {
     if (i32 < -8) {
       i32 = -8;
     }
@@ -175,6 +141,29 @@ void onIncomingFrame(const UiLinkFrame& frame, uint32_t nowMs, void* ctx) {
   (void)nowMs;
 }
 
+uint8_t clampPercent(int32_t value) {
+  return static_cast<uint8_t>(value < 0 ? 0 : (value > 100 ? 100 : value));
+}
+
+void onIncomingState(const UiLinkV3Mirror& state, uint32_t nowMs, void* ctx) {
+  (void)ctx;
+  const int32_t* v = state.values;
+  snprintf(g_snapshot.mode, sizeof(g_snapshot.mode), "%s", uiLinkV3ModeToken(v[UILINK_V3_F_MODE]));
+  g_snapshot.seq = state.seq;
+  g_snapshot.ms = state.ms;
+  g_snapshot.track = static_cast<uint16_t>(v[UILINK_V3_F_TRACK]);
+  g_snapshot.trackTotal = static_cast<uint16_t>(v[UILINK_V3_F_TRACK_TOTAL]);
+  g_snapshot.volume = clampPercent(v[UILINK_V3_F_VOL]);
+  g_snapshot.hold = clampPercent(v[UILINK_V3_F_HOLD]);
+  g_snapshot.tuningConfidence = clampPercent(v[UILINK_V3_F_TUNE_CONF]);
+  g_snapshot.key = static_cast<uint8_t>(v[UILINK_V3_F_KEY]);
+  const int32_t offset = v[UILINK_V3_F_TUNE_OFF];
+  g_snapshot.tuningOffset = static_cast<int8_t>(offset < -8 ? -8 : (offset > 8 ? 8 : offset));
+
+  g_snapshotDirty = true;
+  (void)nowMs;
+}
+
 void onButtonEvent(lv_event_t* event) {
   if (event == nullptr) {
     return;
@@ -279,6 +268,7 @@ void setup() {
   Serial1.setTX(ui_config::kPinUartTx);
   g_link.begin(Serial1, ui_config::kSerialBaud);
   g_link.setFrameHandler(onIncomingFrame, nullptr);
+  g_link.setStateHandler(onIncomingState, nullptr);
   maybeSendHello(millis());
 }
 
@@ -57,6 +57,9 @@ void UiLinkClient::begin(HardwareSerial& serial, uint32_t baud) {
   serial_->begin(baud);
   lineLen_ = 0U;
   dropLine_ = false;
+  v3Active_ = false;
+  uiLinkV3RxReset(&rxFrame_);
+  uiLinkV3MirrorReset(&mirror_);
   connected_ = false;
   lastRxMs_ = 0U;
 }
@@ -66,6 +69,11 @@ void UiLinkClient::setFrameHandler(FrameHandler handler, void* ctx) {
   frameHandlerCtx_ = ctx;
 }
 
+void UiLinkClient::setStateHandler(StateHandler handler, void* ctx) {
+  stateHandler_ = handler;
+  stateHandlerCtx_ = ctx;
+}
+
 bool UiLinkClient::sendFrame(const char* type, const UiLinkField* fields, uint8_t fieldCount) {
   if (serial_ == nullptr || type == nullptr) {
     return false;
@@ -79,17 +87,36 @@ bool UiLinkClient::sendFrame(const char* type, const UiLinkField* fields, uint8_
   return true;
 }
 
+bool UiLinkClient::sendBinary(const UiLinkV3Msg& msg) {
+  if (serial_ == nullptr) {
+    return false;
+  }
+  uint8_t encoded[UILINK_V3_MAX_FRAME];
+  const size_t len = uiLinkV3Encode(&msg, encoded, sizeof(encoded));
+  if (len == 0U) {
+    return false;
+  }
+  serial_->write(encoded, len);
+  return true;
+}
+
 bool UiLinkClient::sendHello(const char* uiType, const char* uiId, const char* fw, const char* caps) {
-  UiLinkField fields[5] = {};
+  UiLinkField fields[6] = {};
   setField(&fields[0], "proto", "2");
-  setField(&fields[1], "ui_type", uiType);
-  setField(&fields[2], "ui_id", uiId);
-  setField(&fields[3], "fw", fw);
-  setField(&fields[4], "caps", caps);
-  return sendFrame("HELLO", fields, 5U);
+  setField(&fields[1], "proto_max", "3");
+  setField(&fields[2], "ui_type", uiType);
+  setField(&fields[3], "ui_id", uiId);
+  setField(&fields[4], "fw", fw);
+  setField(&fields[5], "caps", caps);
+  return sendFrame("HELLO", fields, 6U);
 }
 
 bool UiLinkClient::sendPong(uint32_t nowMs) {
+  if (v3Active_) {
+    UiLinkV3Msg msg;
+    uiLinkV3InitMsg(&msg, UILINK_V3_MSG_PONG, 0U, 0U, nowMs);
+    return sendBinary(msg);
+  }
   UiLinkField fields[1] = {};
   char ts[20] = {};
   snprintf(ts, sizeof(ts), "%lu", static_cast<unsigned long>(nowMs));
@@ -98,6 +125,13 @@ bool UiLinkClient::sendPong(uint32_t nowMs) {
 }
 
 bool UiLinkClient::sendButton(UiBtnId id, UiBtnAction action, uint32_t nowMs) {
+  if (v3Active_) {
+    UiLinkV3Msg msg;
+    uiLinkV3InitMsg(&msg, UILINK_V3_MSG_BTN, 0U, 0U, nowMs);
+    uiLinkV3AddItem(&msg, UILINK_V3_IN_BTN_ID, id);
+    uiLinkV3AddItem(&msg, UILINK_V3_IN_BTN_ACTION, action);
+    return sendBinary(msg);
+  }
   UiLinkField fields[3] = {};
   setField(&fields[0], "id", buttonIdToken(id));
   setField(&fields[1], "action", buttonActionToken(action));
@@ -107,6 +141,61 @@ bool UiLinkClient::sendButton(UiBtnId id, UiBtnAction action, uint32_t nowMs) {
   return sendFrame("BTN", fields, 3U);
 }
 
+void UiLinkClient::handleLine(uint32_t nowMs) {
+  UiLinkView view;
+  if (!uiLinkViewScan(lineBuf_, lineLen_, &view)) {
+    return;
+  }
+  lastRxMs_ = nowMs;
+  if (view.type == UILINK_MSG_ACK) {
+    connected_ = true;
+    if (uiLinkViewEquals(&view, UILINK_KEY_PROTO, "3")) {
+      // Everything after this ACK line is binary.
+      v3Active_ = true;
+      uiLinkV3RxReset(&rxFrame_);
+      uiLinkV3MirrorReset(&mirror_);
+    }
+  } else if (view.type == UILINK_MSG_PING) {
+    sendPong(nowMs);
+  }
+  if (frameHandler_ != nullptr) {
+    frameHandler_(view, nowMs, frameHandlerCtx_);
+  }
+}
+
+void UiLinkClient::handleBinaryFrame(size_t len, uint32_t nowMs) {
+  UiLinkV3Msg msg;
+  if (uiLinkV3Decode(rxFrame_.buf, len, &msg) != UILINK_V3_DECODE_OK) {
+    return;
+  }
+  lastRxMs_ = nowMs;
+  if (msg.type == UILINK_V3_MSG_PING) {
+    sendPong(nowMs);
+    return;
+  }
+
+  UiLinkV3Msg reply;
+  switch (uiLinkV3MirrorApply(&mirror_, &msg)) {
+    case UILINK_V3_APPLY_KEYFRAME:
+      uiLinkV3InitMsg(&reply, UILINK_V3_MSG_KEYFRAME_ACK, msg.ref, 0U, nowMs);
+      sendBinary(reply);
+      break;
+    case UILINK_V3_APPLY_DELTA:
+      break;
+    case UILINK_V3_APPLY_NEED_KEYFRAME:
+      uiLinkV3InitMsg(&reply, UILINK_V3_MSG_CMD, 0U, 0U, nowMs);
+      uiLinkV3AddItem(&reply, UILINK_V3_IN_CMD_OP, UILINK_V3_CMD_REQUEST_KEYFRAME);
+      sendBinary(reply);
+      return;
+    case UILINK_V3_APPLY_IGNORED:
+    default:
+      return;
+  }
+  if (stateHandler_ != nullptr) {
+    stateHandler_(mirror_, nowMs, stateHandlerCtx_);
+  }
+}
+
 void UiLinkClient::poll(uint32_t nowMs) {
   if (serial_ == nullptr) {
     return;
@@ -118,6 +207,14 @@ void UiLinkClient::poll(uint32_t nowMs) {
       break;
     }
 
+    if (v3Active_) {
+      const size_t frameLen = uiLinkV3RxPush(&rxFrame_, static_cast<uint8_t>(raw));
+      if (frameLen > 0U) {
+        handleBinaryFrame(frameLen, nowMs);
+      }
+      continue;
+    }
+
     const char c = static_cast<char>(raw);
     if (c == '\r') {
       continue;
@@ -125,19 +222,7 @@ void UiLinkClient::poll(uint32_t nowMs) {
 
     if (c == '\n') {
       if (!dropLine_ && lineLen_ > 0U) {
-        lineBuf_[lineLen_] = '\0';
-        UiLinkFrame frame = {};
-        if (uiLinkParseLine(lineBuf_, &frame)) {
-          lastRxMs_ = nowMs;
-          if (frame.type == UILINK_MSG_ACK) {
-            connected_ = true;
-          } else if (frame.type == UILINK_MSG_PING) {
-            sendPong(nowMs);
-          }
-          if (frameHandler_ != nullptr) {
-            frameHandler_(frame, nowMs, frameHandlerCtx_);
-          }
-        }
+        handleLine(nowMs);
       }
       lineLen_ = 0U;
       dropLine_ = false;
@@ -156,7 +241,9 @@ void UiLinkClient::poll(uint32_t nowMs) {
   }
 
   if (lastRxMs_ > 0U && static_cast<uint32_t>(nowMs - lastRxMs_) > UILINK_V2_TIMEOUT_MS) {
+    // Back to text so the next HELLO renegotiates.
     connected_ = false;
+    v3Active_ = false;
   }
 }
 
@@ -164,6 +251,10 @@ bool UiLinkClient::connected() const {
   return connected_;
 }
 
+bool UiLinkClient::binaryActive() const {
+  return v3Active_;
+}
+
 uint32_t UiLinkClient::lastRxMs() const {
   return lastRxMs_;
 }
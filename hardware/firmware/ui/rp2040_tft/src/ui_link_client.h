@@ -3,13 +3,18 @@
 #include <Arduino.h>
 
 #include "ui_link_v2.h"
+#include "ui_link_v3.h"
 
 class UiLinkClient {
  public:
-  using FrameHandler = void (*)(const UiLinkFrame& frame, uint32_t nowMs, void* ctx);
+  // The view points into the client's line buffer: valid for the call only.
+  using FrameHandler = void (*)(const UiLinkView& view, uint32_t nowMs, void* ctx);
+  // v3 sessions deliver the rebuilt state (KEYFRAME or STAT delta applied).
+  using StateHandler = void (*)(const UiLinkV3Mirror& state, uint32_t nowMs, void* ctx);
 
   void begin(HardwareSerial& serial, uint32_t baud);
   void setFrameHandler(FrameHandler handler, void* ctx);
+  void setStateHandler(StateHandler handler, void* ctx);
   void poll(uint32_t nowMs);
 
   bool sendHello(const char* uiType, const char* uiId, const char* fw, const char* caps);
@@ -17,19 +22,29 @@ class UiLinkClient {
   bool sendButton(UiBtnId id, UiBtnAction action, uint32_t nowMs);
 
   bool connected() const;
+  bool binaryActive() const;
   uint32_t lastRxMs() const;
 
  private:
   bool sendFrame(const char* type, const UiLinkField* fields, uint8_t fieldCount);
+  bool sendBinary(const UiLinkV3Msg& msg);
+  void handleLine(uint32_t nowMs);
+  void handleBinaryFrame(size_t len, uint32_t nowMs);
 
   HardwareSerial* serial_ = nullptr;
   FrameHandler frameHandler_ = nullptr;
   void* frameHandlerCtx_ = nullptr;
+  StateHandler stateHandler_ = nullptr;
+  void* stateHandlerCtx_ = nullptr;
 
   char lineBuf_[UILINK_V2_MAX_LINE + 1U] = {};
   size_t lineLen_ = 0U;
   bool dropLine_ = false;
 
+  bool v3Active_ = false;
+  UiLinkV3Rx rxFrame_ = {};
+  UiLinkV3Mirror mirror_ = {};
+
   bool connected_ = false;
   uint32_t lastRxMs_ = 0U;
 };
@@ -2296,7 +2296,7 @@ void printMp3Status(const char* source) {
   const Mp3BackendRuntimeStats backendStats = g_mp3.backendStats();
   const PlayerUiPage page = currentPlayerUiPage();
   Serial.printf(
-      "[MP3_DBG] %s mode=%s u_son=%u sd=%u tracks=%u cur=%u play=%u pause=%u repeat=%s vol=%u%% fx_mode=%s fx=%u(%s,%lums) duck=%u%% mix=%u%% backend=%s/%s err=%s b_attempt=%lu b_fail=%lu b_retry=%lu b_fallback=%lu scan_busy=%u scan_ms=%lu ui=%s browse=%s file=%s\n",
+      "[MP3_DBG] %s mode=%s u_son=%u sd=%u tracks=%u cur=%u play=%u pause=%u repeat=%s vol=%u%% fx_mode=%s fx=%u(%s,%lums) duck=%u%% mix=%u%% backend=%s/%s err=%s b_attempt=%lu b_fail=%lu b_retry=%lu b_fallback=%lu gapless=%lu cold=%lu preroll_miss=%lu underrun=%lu/%lu scan_busy=%u scan_ms=%lu ui=%s browse=%s file=%s\n",
       source,
       runtimeModeLabel(),
       g_uSonFunctional ? 1U : 0U,
@@ -2320,6 +2320,11 @@ void printMp3Status(const char* source) {
       static_cast<unsigned long>(backendStats.startFailures),
       static_cast<unsigned long>(backendStats.retriesScheduled),
       static_cast<unsigned long>(backendStats.fallbackCount),
+      static_cast<unsigned long>(backendStats.gaplessTransitions),
+      static_cast<unsigned long>(backendStats.coldTransitions),
+      static_cast<unsigned long>(backendStats.prerollMisses),
+      static_cast<unsigned long>(backendStats.boundaryUnderruns),
+      static_cast<unsigned long>(backendStats.underruns),
       g_mp3.isScanBusy() ? 1U : 0U,
       static_cast<unsigned long>(stats.scanMs),
       playerUiPageLabel(page),
@@ -2,8 +2,15 @@
 
 #include <ctype.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <esp_heap_caps.h>
+#endif
+
 namespace {
 
 uint32_t parseSynchsafe32(const uint8_t* in) {
@@ -152,6 +159,95 @@ int compareSegment(const char* a, const char* b, size_t* usedA, size_t* usedB) {
   return 0;
 }
 
+
+constexpr char kIndexMagic[4] = {'U', 'S', 'I', 'X'};
+constexpr uint32_t kFnvOffset = 2166136261UL;
+constexpr uint32_t kFnvPrime = 16777619UL;
+constexpr uint32_t kNoText = 0xFFFFFFFFUL;
+constexpr uint32_t kInitialTracks = 64U;
+constexpr uint32_t kInitialFolders = 16U;
+constexpr uint32_t kInitialPoolBytes = 4096U;
+constexpr uint16_t kInitialStage = 16U;
+constexpr uint32_t kInitialStagePoolBytes = 1024U;
+
+// On-disk layout: header, folder records, track records, string pool. Records
+// are stored as in memory (little-endian, natural alignment).
+struct CatalogIndexHeader {
+  char magic[4];
+  uint16_t version;
+  uint16_t headerBytes;
+  uint32_t folderCount;
+  uint32_t trackCount;
+  uint32_t poolBytes;
+  uint32_t checksum;
+  uint32_t reserved[2];
+};
+static_assert(sizeof(CatalogIndexHeader) == 32U, "index header layout");
+
+uint32_t fnv1a(uint32_t hash, const void* data, size_t len) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0U; i < len; ++i) {
+    hash ^= bytes[i];
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+// Catalog arrays can reach a few hundred KB: prefer PSRAM, fall back to the
+// default heap when it is absent or full.
+void* catalogRealloc(void* ptr, size_t bytes) {
+#if defined(ARDUINO_ARCH_ESP32)
+  void* grown = heap_caps_realloc(ptr, bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (grown != nullptr) {
+    return grown;
+  }
+#endif
+  return realloc(ptr, bytes);
+}
+
+template <typename T, typename Count>
+bool growArray(T** items, Count* capacity, uint32_t needed, uint32_t initial) {
+  if (*items != nullptr && needed <= *capacity) {
+    return true;
+  }
+  uint32_t next = (*capacity == 0U) ? initial : static_cast<uint32_t>(*capacity);
+  while (next < needed) {
+    next *= 2U;
+  }
+  T* grown = static_cast<T*>(catalogRealloc(*items, sizeof(T) * next));
+  if (grown == nullptr) {
+    return false;
+  }
+  *items = grown;
+  *capacity = static_cast<Count>(next);
+  return true;
+}
+
+// "/a/b/c.mp3" -> folder "/a/b", name "c.mp3"; "/c.mp3" -> folder "".
+const char* splitFolder(const char* path, char* folder, size_t folderLen) {
+  const char* slash = strrchr(path, '/');
+  if (slash == nullptr) {
+    folder[0] = '\0';
+    return path;
+  }
+  size_t len = static_cast<size_t>(slash - path);
+  if (len >= folderLen) {
+    len = folderLen - 1U;
+  }
+  memcpy(folder, path, len);
+  folder[len] = '\0';
+  return slash + 1;
+}
+
+void normalizeFolder(const char* in, char* out, size_t outLen) {
+  snprintf(out, outLen, "%s", (in != nullptr) ? in : "");
+  normalizePath(out, outLen);
+  size_t len = strlen(out);
+  while (len > 0U && out[len - 1U] == '/') {
+    out[--len] = '\0';
+  }
+}
+
 }  // namespace
 
 const char* catalogCodecLabel(CatalogCodec codec) {
@@ -196,8 +292,43 @@ CatalogCodec catalogCodecFromPath(const char* path) {
   return CatalogCodec::kUnknown;
 }
 
+void CatalogFolderFingerprint::addEntry(const char* name,
+                                        uint32_t sizeBytes,
+                                        uint32_t lastWrite,
+                                        bool isDir) {
+  const char* base = basenamePtr(name);
+  hash = fnv1a(hash, base, strlen(base));
+  const uint8_t tail[9] = {static_cast<uint8_t>(sizeBytes),
+                           static_cast<uint8_t>(sizeBytes >> 8U),
+                           static_cast<uint8_t>(sizeBytes >> 16U),
+                           static_cast<uint8_t>(sizeBytes >> 24U),
+                           static_cast<uint8_t>(lastWrite),
+                           static_cast<uint8_t>(lastWrite >> 8U),
+                           static_cast<uint8_t>(lastWrite >> 16U),
+                           static_cast<uint8_t>(lastWrite >> 24U),
+                           static_cast<uint8_t>(isDir ? 1U : 0U)};
+  hash = fnv1a(hash, tail, sizeof(tail));
+  ++entries;
+}
+
+TrackCatalog::~TrackCatalog() {
+  free(records_);
+  free(folders_);
+  free(folderOrder_);
+  free(pool_);
+  free(stage_);
+  free(stagePool_);
+}
+
 void TrackCatalog::clear() {
-  count_ = 0U;
+  recordCount_ = 0U;
+  liveCount_ = 0U;
+  visibleCount_ = 0U;
+  folderCount_ = 0U;
+  poolUsed_ = (pool_ != nullptr) ? 1U : 0U;
+  sorted_ = true;
+  refreshing_ = false;
+  resetStage();
 }
 
 bool TrackCatalog::scan(fs::FS& storage,
@@ -212,7 +343,7 @@ bool TrackCatalog::scan(fs::FS& storage,
   const bool ok = scanDirRecursive(storage, root, 0U, maxDepth, metadataTimeoutMs, &stats);
   if (ok) {
     sortEntries();
-    stats.tracks = count_;
+    stats.tracks = size();
     stats.scanMs = millis() - beginMs;
     stats.indexed = true;
   }
@@ -231,96 +362,297 @@ bool TrackCatalog::loadIndex(fs::FS& storage, const char* path, CatalogStats* ou
     return false;
   }
 
-  clear();
-  CatalogStats stats;
-  stats.indexed = true;
+  CatalogIndexHeader header;
+  memset(&header, 0, sizeof(header));
+  const bool headerOk =
+      static_cast<size_t>(file.read(reinterpret_cast<uint8_t*>(&header), sizeof(header))) == sizeof(header) &&
+      memcmp(header.magic, kIndexMagic, sizeof(kIndexMagic)) == 0 &&
+      header.version == kIndexVersion && header.headerBytes == sizeof(header) &&
+      header.trackCount > 0U && header.trackCount <= kMaxTracks &&
+      header.folderCount > 0U && header.folderCount <= 0xFFFFUL &&
+      header.poolBytes > 0U &&
+      static_cast<uint32_t>(file.size()) ==
+          sizeof(header) + header.folderCount * sizeof(FolderRecord) +
+              header.trackCount * sizeof(TrackRecord) + header.poolBytes;
+  if (!headerOk) {
+    file.close();
+    return false;
+  }
 
-  while (file.available() > 0) {
-    String line = file.readStringUntil('\n');
-    line.trim();
-    if (line.isEmpty()) {
-      continue;
+  clear();
+  bool ok = reserveFolders(header.folderCount) && reserveTracks(header.trackCount) &&
+            growArray(&pool_, &poolCapacity_, header.poolBytes, kInitialPoolBytes);
+  if (ok) {
+    const size_t folderBytes = header.folderCount * sizeof(FolderRecord);
+    const size_t trackBytes = header.trackCount * sizeof(TrackRecord);
+    ok = static_cast<size_t>(file.read(reinterpret_cast<uint8_t*>(folders_), folderBytes)) == folderBytes &&
+         static_cast<size_t>(file.read(reinterpret_cast<uint8_t*>(records_), trackBytes)) == trackBytes &&
+         static_cast<size_t>(file.read(reinterpret_cast<uint8_t*>(pool_), header.poolBytes)) == header.poolBytes;
+    if (ok) {
+      uint32_t checksum = fnv1a(kFnvOffset, folders_, folderBytes);
+      checksum = fnv1a(checksum, records_, trackBytes);
+      checksum = fnv1a(checksum, pool_, header.poolBytes);
+      ok = checksum == header.checksum && pool_[0] == '\0' && pool_[header.poolBytes - 1U] == '\0';
     }
+  }
+  file.close();
 
-    TrackEntry entry;
-    memset(&entry, 0, sizeof(entry));
-
-    const int p1 = line.indexOf('\t');
-    if (p1 < 0) {
-      continue;
-    }
-    const int p2 = line.indexOf('\t', p1 + 1);
-    const int p3 = line.indexOf('\t', (p2 >= 0) ? p2 + 1 : -1);
-    const int p4 = line.indexOf('\t', (p3 >= 0) ? p3 + 1 : -1);
-    const int p5 = line.indexOf('\t', (p4 >= 0) ? p4 + 1 : -1);
-    const int p6 = line.indexOf('\t', (p5 >= 0) ? p5 + 1 : -1);
+  for (uint32_t i = 0U; ok && i < header.folderCount; ++i) {
+    ok = folders_[i].pathOffset < header.poolBytes;
+    folders_[i].flags = static_cast<uint8_t>(folders_[i].flags & kFolderHasFingerprint);
+  }
+  for (uint32_t i = 0U; ok && i < header.trackCount; ++i) {
+    const TrackRecord& r = records_[i];
+    ok = r.nameOffset != 0U && r.nameOffset < header.poolBytes && r.titleOffset < header.poolBytes &&
+         r.artistOffset < header.poolBytes && r.albumOffset < header.poolBytes &&
+         r.folderId < header.folderCount;
+    records_[i].flags = 0U;
+  }
+  if (!ok) {
+    clear();
+    return false;
+  }
 
-    if (p2 < 0 || p3 < 0 || p4 < 0 || p5 < 0 || p6 < 0) {
-      continue;
-    }
+  folderCount_ = header.folderCount;
+  recordCount_ = header.trackCount;
+  liveCount_ = recordCount_;
+  visibleCount_ = recordCount_;
+  poolUsed_ = header.poolBytes;
+  rebuildFolderOrder();
 
-    const String pathValue = line.substring(0, p1);
-    const String codecValue = line.substring(p1 + 1, p2);
-    const String sizeValue = line.substring(p2 + 1, p3);
-    const String titleValue = line.substring(p3 + 1, p4);
-    const String artistValue = line.substring(p4 + 1, p5);
-    const String albumValue = line.substring(p5 + 1, p6);
-    const String durationValue = line.substring(p6 + 1);
-
-    copyStr(entry.path, sizeof(entry.path), pathValue.c_str());
-    copyStr(entry.codec, sizeof(entry.codec), codecValue.c_str());
-    copyStr(entry.title, sizeof(entry.title), titleValue.c_str());
-    copyStr(entry.artist, sizeof(entry.artist), artistValue.c_str());
-    copyStr(entry.album, sizeof(entry.album), albumValue.c_str());
-    entry.sizeBytes = static_cast<uint32_t>(sizeValue.toInt());
-    entry.durationMs = static_cast<uint32_t>(durationValue.toInt());
-    normalizePath(entry.path, sizeof(entry.path));
-    sanitizeText(entry.title, sizeof(entry.title));
-    sanitizeText(entry.artist, sizeof(entry.artist));
-    sanitizeText(entry.album, sizeof(entry.album));
-
-    if (!addTrackEntry(entry)) {
+  // Saved sorted; only re-sort if the file came from an older ordering.
+  sorted_ = true;
+  char prev[120] = {};
+  char cur[120] = {};
+  for (uint32_t i = 0U; i < recordCount_; ++i) {
+    buildPath(records_[i], cur, sizeof(cur));
+    if (i > 0U && compareNatural(prev, cur) > 0) {
+      sorted_ = false;
       break;
     }
+    memcpy(prev, cur, sizeof(prev));
+  }
+  if (!sorted_) {
+    sortEntries();
   }
-  file.close();
 
-  stats.tracks = count_;
   if (outStats != nullptr) {
+    CatalogStats stats;
+    stats.indexed = true;
+    stats.tracks = size();
+    stats.folders = folderCount();
     *outStats = stats;
   }
-  return count_ > 0U;
+  return true;
 }
 
 bool TrackCatalog::saveIndex(fs::FS& storage, const char* path) const {
-  if (path == nullptr || path[0] == '\0') {
+  if (path == nullptr || path[0] == '\0' || refreshing_ || recordCount_ == 0U || pool_ == nullptr) {
     return false;
   }
 
+  CatalogIndexHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kIndexMagic, sizeof(kIndexMagic));
+  header.version = kIndexVersion;
+  header.headerBytes = sizeof(header);
+  header.folderCount = folderCount_;
+  header.trackCount = recordCount_;
+  header.poolBytes = poolUsed_;
+  const size_t folderBytes = folderCount_ * sizeof(FolderRecord);
+  const size_t trackBytes = recordCount_ * sizeof(TrackRecord);
+  header.checksum = fnv1a(kFnvOffset, folders_, folderBytes);
+  header.checksum = fnv1a(header.checksum, records_, trackBytes);
+  header.checksum = fnv1a(header.checksum, pool_, poolUsed_);
+
+  // Write next to the live index and swap, so a reset mid-write keeps the old one.
+  char tmpPath[96] = {};
+  snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+  if (storage.exists(tmpPath)) {
+    storage.remove(tmpPath);
+  }
+  fs::File file = storage.open(tmpPath, FILE_WRITE);
+  if (!file || file.isDirectory()) {
+    return false;
+  }
+  const bool ok = file.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header) &&
+                  file.write(reinterpret_cast<const uint8_t*>(folders_), folderBytes) == folderBytes &&
+                  file.write(reinterpret_cast<const uint8_t*>(records_), trackBytes) == trackBytes &&
+                  file.write(reinterpret_cast<const uint8_t*>(pool_), poolUsed_) == poolUsed_;
+  file.close();
+  if (!ok) {
+    storage.remove(tmpPath);
+    return false;
+  }
   if (storage.exists(path)) {
     storage.remove(path);
   }
+  return storage.rename(tmpPath, path);
+}
 
-  fs::File file = storage.open(path, FILE_WRITE);
-  if (!file || file.isDirectory()) {
+void TrackCatalog::beginRefresh() {
+  refreshing_ = true;
+  visibleCount_ = recordCount_;
+  for (uint32_t i = 0U; i < folderCount_; ++i) {
+    folders_[i].flags = static_cast<uint8_t>(folders_[i].flags & ~kFolderSeen);
+  }
+  foldersReused_ = 0U;
+  foldersRescanned_ = 0U;
+  refreshChanged_ = false;
+  resetStage();
+}
+
+bool TrackCatalog::stageFile(const char* name, uint32_t sizeBytes) {
+  const char* base = basenamePtr(name);
+  if (!refreshing_ || base[0] == '\0' || !isSupportedPath(base)) {
     return false;
   }
-
-  for (uint16_t i = 0U; i < count_; ++i) {
-    const TrackEntry& e = entries_[i];
-    file.printf("%s\t%s\t%lu\t%s\t%s\t%s\t%lu\n",
-                e.path,
-                e.codec,
-                static_cast<unsigned long>(e.sizeBytes),
-                e.title,
-                e.artist,
-                e.album,
-                static_cast<unsigned long>(e.durationMs));
+  const uint32_t len = static_cast<uint32_t>(strlen(base)) + 1U;
+  if (!growArray(&stage_, &stageCapacity_, stageCount_ + 1U, kInitialStage) ||
+      !growArray(&stagePool_, &stagePoolCapacity_, stagePoolUsed_ + len, kInitialStagePoolBytes)) {
+    return false;
   }
-  file.close();
+  memcpy(stagePool_ + stagePoolUsed_, base, len);
+  stage_[stageCount_].nameOffset = stagePoolUsed_;
+  stage_[stageCount_].sizeBytes = sizeBytes;
+  stage_[stageCount_].matched = false;
+  ++stageCount_;
+  stagePoolUsed_ += len;
   return true;
 }
 
+bool TrackCatalog::commitFolder(const char* folderPath, const CatalogFolderFingerprint& fingerprint) {
+  if (!refreshing_) {
+    resetStage();
+    return false;
+  }
+  char folder[120] = {};
+  normalizeFolder(folderPath, folder, sizeof(folder));
+
+  int32_t id = findFolder(folder);
+  if (id >= 0) {
+    FolderRecord& known = folders_[id];
+    if ((known.flags & kFolderHasFingerprint) != 0U && known.fingerprint == fingerprint.hash &&
+        known.entries == fingerprint.entries) {
+      known.flags = static_cast<uint8_t>(known.flags | kFolderSeen);
+      ++foldersReused_;
+      resetStage();
+      return true;
+    }
+  } else {
+    id = internFolder(folder);
+    if (id < 0) {
+      resetStage();
+      return false;
+    }
+  }
+  ++foldersRescanned_;
+
+  // Keep records whose name and size still match (and their metadata), drop
+  // the rest, then append what is new in this listing.
+  for (uint32_t i = 0U; i < recordCount_; ++i) {
+    TrackRecord& record = records_[i];
+    if (record.folderId != static_cast<uint16_t>(id) || (record.flags & kRecordDead) != 0U) {
+      continue;
+    }
+    const char* name = text(record.nameOffset);
+    bool kept = false;
+    for (uint16_t s = 0U; s < stageCount_; ++s) {
+      StagedFile& staged = stage_[s];
+      if (!staged.matched && staged.sizeBytes == record.sizeBytes &&
+          strcmp(stagePool_ + staged.nameOffset, name) == 0) {
+        staged.matched = true;
+        kept = true;
+        break;
+      }
+    }
+    if (!kept) {
+      record.flags = static_cast<uint8_t>(record.flags | kRecordDead);
+      --liveCount_;
+      refreshChanged_ = true;
+    }
+  }
+
+  bool ok = true;
+  for (uint16_t s = 0U; s < stageCount_; ++s) {
+    if (stage_[s].matched) {
+      continue;
+    }
+    if (!appendRecord(static_cast<uint16_t>(id),
+                      stagePool_ + stage_[s].nameOffset,
+                      stage_[s].sizeBytes,
+                      nullptr,
+                      nullptr,
+                      nullptr,
+                      0U)) {
+      ok = false;
+      break;
+    }
+    refreshChanged_ = true;
+  }
+
+  FolderRecord& folderRecord = folders_[id];
+  folderRecord.fingerprint = fingerprint.hash;
+  folderRecord.entries = fingerprint.entries;
+  folderRecord.flags = static_cast<uint8_t>(folderRecord.flags | kFolderSeen);
+  if (ok) {
+    folderRecord.flags = static_cast<uint8_t>(folderRecord.flags | kFolderHasFingerprint);
+  } else {
+    // Truncated listing: force a rescan of this folder next time.
+    folderRecord.flags = static_cast<uint8_t>(folderRecord.flags & ~kFolderHasFingerprint);
+  }
+  resetStage();
+  return ok;
+}
+
+bool TrackCatalog::finishRefresh(bool complete) {
+  if (!refreshing_) {
+    return false;
+  }
+  refreshing_ = false;
+  resetStage();
+
+  bool anyDead = (liveCount_ != recordCount_);
+  if (complete) {
+    bool droppedFolder = false;
+    for (uint32_t i = 0U; i < folderCount_; ++i) {
+      if ((folders_[i].flags & kFolderSeen) == 0U) {
+        folders_[i].flags = static_cast<uint8_t>(folders_[i].flags | kFolderDead);
+        droppedFolder = true;
+      }
+    }
+    if (droppedFolder) {
+      for (uint32_t i = 0U; i < recordCount_; ++i) {
+        TrackRecord& record = records_[i];
+        if ((record.flags & kRecordDead) == 0U &&
+            (folders_[record.folderId].flags & kFolderDead) != 0U) {
+          record.flags = static_cast<uint8_t>(record.flags | kRecordDead);
+          --liveCount_;
+          refreshChanged_ = true;
+        }
+      }
+      anyDead = true;
+    }
+  }
+
+  if (anyDead) {
+    compact();
+  }
+  visibleCount_ = recordCount_;
+  if (refreshChanged_) {
+    sortEntries();
+  }
+  return refreshChanged_;
+}
+
+uint16_t TrackCatalog::foldersReused() const {
+  return foldersReused_;
+}
+
+uint16_t TrackCatalog::foldersRescanned() const {
+  return foldersRescanned_;
+}
+
 bool TrackCatalog::appendFallbackPath(const char* path, uint32_t sizeBytes) {
   if (path == nullptr || path[0] == '\0') {
     return false;
@@ -328,29 +660,37 @@ bool TrackCatalog::appendFallbackPath(const char* path, uint32_t sizeBytes) {
   TrackEntry entry;
   memset(&entry, 0, sizeof(entry));
   copyStr(entry.path, sizeof(entry.path), path);
-  normalizePath(entry.path, sizeof(entry.path));
-  const CatalogCodec codec = catalogCodecFromPath(entry.path);
-  if (codec == CatalogCodec::kUnknown) {
-    return false;
-  }
-  copyStr(entry.codec, sizeof(entry.codec), catalogCodecLabel(codec));
   entry.sizeBytes = sizeBytes;
-  return addTrackEntry(entry);
+  return addTrack(entry);
 }
 
 void TrackCatalog::sort() {
-  sortEntries();
+  if (!refreshing_ && !sorted_) {
+    sortEntries();
+  }
 }
 
 uint16_t TrackCatalog::size() const {
-  return count_;
+  return static_cast<uint16_t>(visibleCount_);
+}
+
+uint16_t TrackCatalog::folderCount() const {
+  return static_cast<uint16_t>(folderCount_);
 }
 
 const TrackEntry* TrackCatalog::entry(uint16_t index) const {
-  if (index >= count_) {
+  if (index >= visibleCount_) {
     return nullptr;
   }
-  return &entries_[index];
+  const TrackRecord& record = records_[index];
+  buildPath(record, view_.path, sizeof(view_.path));
+  copyStr(view_.title, sizeof(view_.title), text(record.titleOffset));
+  copyStr(view_.artist, sizeof(view_.artist), text(record.artistOffset));
+  copyStr(view_.album, sizeof(view_.album), text(record.albumOffset));
+  copyStr(view_.codec, sizeof(view_.codec), catalogCodecLabel(static_cast<CatalogCodec>(record.codec)));
+  view_.durationMs = record.durationMs;
+  view_.sizeBytes = record.sizeBytes;
+  return &view_;
 }
 
 int16_t TrackCatalog::indexOfPath(const char* path) const {
@@ -360,10 +700,29 @@ int16_t TrackCatalog::indexOfPath(const char* path) const {
   char normalized[120] = {};
   copyStr(normalized, sizeof(normalized), path);
   normalizePath(normalized, sizeof(normalized));
-  for (uint16_t i = 0U; i < count_; ++i) {
-    if (strcmp(entries_[i].path, normalized) == 0) {
+
+  char candidate[120] = {};
+  if (!sorted_) {
+    for (uint32_t i = 0U; i < visibleCount_; ++i) {
+      buildPath(records_[i], candidate, sizeof(candidate));
+      if (strcmp(candidate, normalized) == 0) {
+        return static_cast<int16_t>(i);
+      }
+    }
+    return -1;
+  }
+
+  // Natural order folds case and leading zeros, so check the whole run of
+  // equivalent paths for the exact one.
+  uint32_t i = lowerBound(normalized);
+  for (; i < visibleCount_; ++i) {
+    buildPath(records_[i], candidate, sizeof(candidate));
+    if (strcmp(candidate, normalized) == 0) {
       return static_cast<int16_t>(i);
     }
+    if (compareNatural(candidate, normalized) != 0) {
+      break;
+    }
   }
   return -1;
 }
@@ -373,11 +732,16 @@ uint16_t TrackCatalog::listByPrefix(const char* prefix,
                                     uint16_t limit,
                                     Print& out) const {
   const char* safePrefix = (prefix == nullptr) ? "/" : prefix;
+  uint32_t begin = 0U;
+  uint32_t end = visibleCount_;
+  prefixRange(safePrefix, &begin, &end);
   uint16_t total = 0U;
   uint16_t emitted = 0U;
-  for (uint16_t i = 0U; i < count_; ++i) {
-    const TrackEntry& e = entries_[i];
-    if (!startsWithPathPrefix(e.path, safePrefix)) {
+  char path[120] = {};
+  for (uint32_t i = begin; i < end; ++i) {
+    const TrackRecord& record = records_[i];
+    buildPath(record, path, sizeof(path));
+    if (!startsWithPathPrefix(path, safePrefix)) {
       continue;
     }
     ++total;
@@ -388,22 +752,27 @@ uint16_t TrackCatalog::listByPrefix(const char* prefix,
       continue;
     }
     ++emitted;
-    const char* title = (e.title[0] != '\0') ? e.title : basenamePtr(e.path);
+    const char* title = (record.titleOffset != 0U) ? text(record.titleOffset) : text(record.nameOffset);
     out.printf("[%u] %s | %s | %s | %s\n",
                static_cast<unsigned int>(i + 1U),
                title,
-               e.artist[0] != '\0' ? e.artist : "-",
-               e.codec,
-               e.path);
+               record.artistOffset != 0U ? text(record.artistOffset) : "-",
+               catalogCodecLabel(static_cast<CatalogCodec>(record.codec)),
+               path);
   }
   return total;
 }
 
 uint16_t TrackCatalog::countByPrefix(const char* prefix) const {
   const char* safePrefix = (prefix == nullptr) ? "/" : prefix;
+  uint32_t begin = 0U;
+  uint32_t end = visibleCount_;
+  prefixRange(safePrefix, &begin, &end);
   uint16_t total = 0U;
-  for (uint16_t i = 0U; i < count_; ++i) {
-    if (startsWithPathPrefix(entries_[i].path, safePrefix)) {
+  char path[120] = {};
+  for (uint32_t i = begin; i < end; ++i) {
+    buildPath(records_[i], path, sizeof(path));
+    if (startsWithPathPrefix(path, safePrefix)) {
       ++total;
     }
   }
@@ -630,27 +999,299 @@ void TrackCatalog::parseId3v1(fs::File& file, TrackEntry* entry) {
   }
 }
 
-bool TrackCatalog::addTrackEntry(const TrackEntry& entry) {
-  if (count_ >= kMaxTracks) {
+bool TrackCatalog::reserveTracks(uint32_t count) {
+  return growArray(&records_, &recordCapacity_, count, kInitialTracks);
+}
+
+bool TrackCatalog::reserveFolders(uint32_t count) {
+  if (count > 0xFFFFUL) {
+    return false;
+  }
+  uint32_t capacity = folderCapacity_;
+  if (!growArray(&folders_, &capacity, count, kInitialFolders)) {
+    return false;
+  }
+  if (capacity != folderCapacity_ || folderOrder_ == nullptr) {
+    uint16_t* order = static_cast<uint16_t*>(catalogRealloc(folderOrder_, sizeof(uint16_t) * capacity));
+    if (order == nullptr) {
+      return false;
+    }
+    folderOrder_ = order;
+  }
+  folderCapacity_ = capacity;
+  return true;
+}
+
+bool TrackCatalog::reservePool(uint32_t bytes) {
+  const uint32_t used = (poolUsed_ == 0U) ? 1U : poolUsed_;
+  if (!growArray(&pool_, &poolCapacity_, used + bytes, kInitialPoolBytes)) {
     return false;
   }
-  entries_[count_++] = entry;
+  if (poolUsed_ == 0U) {
+    pool_[0] = '\0';
+    poolUsed_ = 1U;
+  }
   return true;
 }
 
+uint32_t TrackCatalog::internText(const char* value) {
+  if (value == nullptr || value[0] == '\0') {
+    return 0U;
+  }
+  const uint32_t len = static_cast<uint32_t>(strlen(value)) + 1U;
+  if (!reservePool(len)) {
+    return kNoText;
+  }
+  const uint32_t offset = poolUsed_;
+  memcpy(pool_ + offset, value, len);
+  poolUsed_ += len;
+  return offset;
+}
+
+const char* TrackCatalog::text(uint32_t offset) const {
+  return (pool_ == nullptr || offset >= poolUsed_) ? "" : (pool_ + offset);
+}
+
+int32_t TrackCatalog::findFolder(const char* folderPath) const {
+  uint32_t lo = 0U;
+  uint32_t hi = folderCount_;
+  while (lo < hi) {
+    const uint32_t mid = lo + ((hi - lo) / 2U);
+    const uint16_t id = folderOrder_[mid];
+    const int cmp = strcmp(text(folders_[id].pathOffset), folderPath);
+    if (cmp == 0) {
+      return id;
+    }
+    if (cmp < 0) {
+      lo = mid + 1U;
+    } else {
+      hi = mid;
+    }
+  }
+  return -1;
+}
+
+int32_t TrackCatalog::internFolder(const char* folderPath) {
+  const int32_t existing = findFolder(folderPath);
+  if (existing >= 0) {
+    return existing;
+  }
+  if (!reserveFolders(folderCount_ + 1U)) {
+    return -1;
+  }
+  const uint32_t offset = internText(folderPath);
+  if (offset == kNoText) {
+    return -1;
+  }
+  uint32_t pos = 0U;
+  uint32_t hi = folderCount_;
+  while (pos < hi) {
+    const uint32_t mid = pos + ((hi - pos) / 2U);
+    if (strcmp(text(folders_[folderOrder_[mid]].pathOffset), folderPath) < 0) {
+      pos = mid + 1U;
+    } else {
+      hi = mid;
+    }
+  }
+  const uint16_t id = static_cast<uint16_t>(folderCount_);
+  FolderRecord& folder = folders_[id];
+  folder.pathOffset = offset;
+  folder.fingerprint = 0U;
+  folder.entries = 0U;
+  folder.flags = refreshing_ ? kFolderSeen : 0U;
+  folder.reserved = 0U;
+  memmove(&folderOrder_[pos + 1U], &folderOrder_[pos], sizeof(uint16_t) * (folderCount_ - pos));
+  folderOrder_[pos] = id;
+  ++folderCount_;
+  return id;
+}
+
+void TrackCatalog::rebuildFolderOrder() {
+  for (uint32_t i = 0U; i < folderCount_; ++i) {
+    folderOrder_[i] = static_cast<uint16_t>(i);
+  }
+  std::sort(folderOrder_, folderOrder_ + folderCount_, [this](uint16_t lhs, uint16_t rhs) {
+    return strcmp(text(folders_[lhs].pathOffset), text(folders_[rhs].pathOffset)) < 0;
+  });
+}
+
+bool TrackCatalog::addTrack(const TrackEntry& entry) {
+  char path[120] = {};
+  copyStr(path, sizeof(path), entry.path);
+  normalizePath(path, sizeof(path));
+  char folder[120] = {};
+  const char* name = splitFolder(path, folder, sizeof(folder));
+  if (name[0] == '\0' || !isSupportedPath(name)) {
+    return false;
+  }
+  const int32_t folderId = internFolder(folder);
+  if (folderId < 0) {
+    return false;
+  }
+  return appendRecord(static_cast<uint16_t>(folderId),
+                      name,
+                      entry.sizeBytes,
+                      entry.title,
+                      entry.artist,
+                      entry.album,
+                      entry.durationMs);
+}
+
+bool TrackCatalog::appendRecord(uint16_t folderId,
+                                const char* name,
+                                uint32_t sizeBytes,
+                                const char* title,
+                                const char* artist,
+                                const char* album,
+                                uint32_t durationMs) {
+  if (liveCount_ >= kMaxTracks || !reserveTracks(recordCount_ + 1U)) {
+    return false;
+  }
+  TrackRecord record;
+  record.nameOffset = internText(name);
+  record.titleOffset = internText(title);
+  record.artistOffset = internText(artist);
+  record.albumOffset = internText(album);
+  if (record.nameOffset == kNoText || record.nameOffset == 0U || record.titleOffset == kNoText ||
+      record.artistOffset == kNoText || record.albumOffset == kNoText) {
+    return false;
+  }
+  record.sizeBytes = sizeBytes;
+  record.durationMs = durationMs;
+  record.folderId = folderId;
+  record.codec = static_cast<uint8_t>(catalogCodecFromPath(name));
+  record.flags = 0U;
+  records_[recordCount_++] = record;
+  ++liveCount_;
+  if (!refreshing_) {
+    visibleCount_ = recordCount_;
+    sorted_ = false;
+  }
+  return true;
+}
+
+void TrackCatalog::buildPath(const TrackRecord& record, char* out, size_t outLen) const {
+  snprintf(out, outLen, "%s/%s", text(folders_[record.folderId].pathOffset), text(record.nameOffset));
+}
+
+void TrackCatalog::compact() {
+  // Renumber live folders, then copy live records and their strings into a
+  // fresh pool so deleted entries stop costing memory.
+  uint32_t liveFolders = 0U;
+  for (uint32_t i = 0U; i < folderCount_; ++i) {
+    if ((folders_[i].flags & kFolderDead) == 0U) {
+      folderOrder_[i] = static_cast<uint16_t>(liveFolders++);
+    }
+  }
+
+  char* freshPool = static_cast<char*>(catalogRealloc(nullptr, (poolUsed_ > 0U) ? poolUsed_ : 1U));
+  uint32_t freshUsed = 1U;
+  if (freshPool != nullptr) {
+    freshPool[0] = '\0';
+  }
+  auto move = [&](uint32_t offset) -> uint32_t {
+    if (freshPool == nullptr || offset == 0U) {
+      return offset;
+    }
+    const char* value = text(offset);
+    const uint32_t len = static_cast<uint32_t>(strlen(value)) + 1U;
+    memcpy(freshPool + freshUsed, value, len);
+    freshUsed += len;
+    return freshUsed - len;
+  };
+
+  uint32_t out = 0U;
+  for (uint32_t i = 0U; i < folderCount_; ++i) {
+    if ((folders_[i].flags & kFolderDead) != 0U) {
+      continue;
+    }
+    FolderRecord folder = folders_[i];
+    folder.pathOffset = move(folder.pathOffset);
+    folders_[out++] = folder;
+  }
+  out = 0U;
+  for (uint32_t i = 0U; i < recordCount_; ++i) {
+    TrackRecord record = records_[i];
+    if ((record.flags & kRecordDead) != 0U) {
+      continue;
+    }
+    record.folderId = folderOrder_[record.folderId];
+    record.nameOffset = move(record.nameOffset);
+    record.titleOffset = move(record.titleOffset);
+    record.artistOffset = move(record.artistOffset);
+    record.albumOffset = move(record.albumOffset);
+    records_[out++] = record;
+  }
+  recordCount_ = out;
+  liveCount_ = out;
+  folderCount_ = liveFolders;
+  if (freshPool != nullptr) {
+    free(pool_);
+    pool_ = freshPool;
+    poolCapacity_ = (poolUsed_ > 0U) ? poolUsed_ : 1U;
+    poolUsed_ = freshUsed;
+  }
+  rebuildFolderOrder();
+}
+
 void TrackCatalog::sortEntries() {
-  if (count_ < 2U) {
+  if (recordCount_ >= 2U) {
+    std::sort(records_, records_ + recordCount_, [this](const TrackRecord& lhs, const TrackRecord& rhs) {
+      char a[120] = {};
+      char b[120] = {};
+      buildPath(lhs, a, sizeof(a));
+      buildPath(rhs, b, sizeof(b));
+      return compareNatural(a, b) < 0;
+    });
+  }
+  sorted_ = true;
+}
+
+uint32_t TrackCatalog::lowerBound(const char* path) const {
+  uint32_t lo = 0U;
+  uint32_t hi = visibleCount_;
+  char candidate[120] = {};
+  while (lo < hi) {
+    const uint32_t mid = lo + ((hi - lo) / 2U);
+    buildPath(records_[mid], candidate, sizeof(candidate));
+    if (compareNatural(candidate, path) < 0) {
+      lo = mid + 1U;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+void TrackCatalog::prefixRange(const char* prefix, uint32_t* begin, uint32_t* end) const {
+  *begin = 0U;
+  *end = visibleCount_;
+  if (!sorted_ || prefix[0] == '\0' || strcmp(prefix, "/") == 0) {
     return;
   }
-  for (uint16_t i = 0U; i < count_ - 1U; ++i) {
-    for (uint16_t j = i + 1U; j < count_; ++j) {
-      if (compareNatural(entries_[j].path, entries_[i].path) < 0) {
-        const TrackEntry tmp = entries_[i];
-        entries_[i] = entries_[j];
-        entries_[j] = tmp;
-      }
+  // Everything under "prefix/" sorts between "prefix" and "prefix/\xFF" in
+  // natural order; callers still filter with startsWithPathPrefix().
+  char upper[124] = {};
+  snprintf(upper, sizeof(upper), "%s/\xFF", prefix);
+  *begin = lowerBound(prefix);
+  uint32_t lo = *begin;
+  uint32_t hi = visibleCount_;
+  char candidate[120] = {};
+  while (lo < hi) {
+    const uint32_t mid = lo + ((hi - lo) / 2U);
+    buildPath(records_[mid], candidate, sizeof(candidate));
+    if (compareNatural(candidate, upper) <= 0) {
+      lo = mid + 1U;
+    } else {
+      hi = mid;
     }
   }
+  *end = lo;
+}
+
+void TrackCatalog::resetStage() {
+  stageCount_ = 0U;
+  stagePoolUsed_ = 0U;
 }
 
 bool TrackCatalog::scanDirRecursive(fs::FS& storage,
@@ -666,39 +1307,30 @@ bool TrackCatalog::scanDirRecursive(fs::FS& storage,
   if (stats != nullptr) {
     ++stats->folders;
   }
+  const char* parent = (strcmp(dirPath, "/") == 0) ? "" : dirPath;
 
   fs::File file = dir.openNextFile();
   while (file) {
-    if (count_ >= kMaxTracks) {
+    if (liveCount_ >= kMaxTracks) {
       file.close();
       break;
     }
 
+    char path[120] = {};
+    snprintf(path, sizeof(path), "%s/%s", parent, basenamePtr(file.name()));
     if (file.isDirectory()) {
+      file.close();
       if (depth < maxDepth) {
-        String next = String(file.name());
-        if (!next.startsWith("/")) {
-          next = "/" + next;
-        }
-        file.close();
-        scanDirRecursive(storage, next.c_str(), static_cast<uint8_t>(depth + 1U), maxDepth, metadataTimeoutMs, stats);
-      } else {
-        file.close();
+        scanDirRecursive(storage, path, static_cast<uint8_t>(depth + 1U), maxDepth, metadataTimeoutMs, stats);
       }
     } else {
-      String path = String(file.name());
-      if (!path.startsWith("/")) {
-        path = "/" + path;
-      }
-      CatalogCodec codec = CatalogCodec::kUnknown;
-      if (isSupportedPath(path.c_str(), &codec)) {
+      if (isSupportedPath(path)) {
         TrackEntry entry;
         memset(&entry, 0, sizeof(entry));
-        copyStr(entry.path, sizeof(entry.path), path.c_str());
-        copyStr(entry.codec, sizeof(entry.codec), catalogCodecLabel(codec));
+        copyStr(entry.path, sizeof(entry.path), path);
         entry.sizeBytes = static_cast<uint32_t>(file.size());
         parseMetadata(storage, &entry, metadataTimeoutMs);
-        if (!addTrackEntry(entry)) {
+        if (!addTrack(entry)) {
           file.close();
           break;
         }
@@ -33,14 +33,31 @@ struct CatalogStats {
   bool metadataBestEffort = true;
 };
 
+// Soft cap only: records and strings are heap-allocated (PSRAM when present)
+// and grow on demand up to this many tracks.
 #ifndef USON_TRACK_CATALOG_MAX_TRACKS
-#define USON_TRACK_CATALOG_MAX_TRACKS 250
+#define USON_TRACK_CATALOG_MAX_TRACKS 4000
 #endif
 
+// Running fingerprint of one directory listing (names, sizes, mtimes). Feed it
+// subfolders and audio files only, so index/state writes do not churn it.
+struct CatalogFolderFingerprint {
+  uint32_t hash = 2166136261UL;
+  uint16_t entries = 0U;
+
+  void addEntry(const char* name, uint32_t sizeBytes, uint32_t lastWrite, bool isDir);
+};
+
 class TrackCatalog {
  public:
   static constexpr uint16_t kMaxTracks = USON_TRACK_CATALOG_MAX_TRACKS;
   static constexpr uint8_t kDefaultMaxDepth = 4;
+  static constexpr uint16_t kIndexVersion = 2U;
+
+  TrackCatalog() = default;
+  ~TrackCatalog();
+  TrackCatalog(const TrackCatalog&) = delete;
+  TrackCatalog& operator=(const TrackCatalog&) = delete;
 
   void clear();
 
@@ -52,10 +69,25 @@ class TrackCatalog {
   bool loadIndex(fs::FS& storage, const char* path, CatalogStats* outStats = nullptr);
   bool saveIndex(fs::FS& storage, const char* path) const;
 
+  // Incremental refresh: stage the files of one directory, then commitFolder()
+  // with its fingerprint. Unchanged folders keep their tracks (and metadata);
+  // changed ones are replaced. finishRefresh() drops folders not seen again,
+  // compacts storage and re-sorts. Returns true when the catalog changed.
+  // Until then size()/entry() keep exposing the previous snapshot. Pass
+  // complete=false when the walk was cut short: unseen folders are kept.
+  void beginRefresh();
+  bool stageFile(const char* name, uint32_t sizeBytes);
+  bool commitFolder(const char* folderPath, const CatalogFolderFingerprint& fingerprint);
+  bool finishRefresh(bool complete);
+  uint16_t foldersReused() const;
+  uint16_t foldersRescanned() const;
+
   bool appendFallbackPath(const char* path, uint32_t sizeBytes);
   void sort();
 
   uint16_t size() const;
+  uint16_t folderCount() const;
+  // The returned view is rebuilt on each call; copy what must outlive it.
   const TrackEntry* entry(uint16_t index) const;
   int16_t indexOfPath(const char* path) const;
 
@@ -66,17 +98,66 @@ class TrackCatalog {
   uint16_t countByPrefix(const char* prefix) const;
 
  private:
+  // Paths are split into an interned folder ("" for root, else "/a/b") and a
+  // base name; all text lives in pool_ and is referenced by offset. Offset 0
+  // is the empty string.
+  struct TrackRecord {
+    uint32_t nameOffset;
+    uint32_t titleOffset;
+    uint32_t artistOffset;
+    uint32_t albumOffset;
+    uint32_t sizeBytes;
+    uint32_t durationMs;
+    uint16_t folderId;
+    uint8_t codec;
+    uint8_t flags;
+  };
+
+  struct FolderRecord {
+    uint32_t pathOffset;
+    uint32_t fingerprint;
+    uint16_t entries;
+    uint8_t flags;
+    uint8_t reserved;
+  };
+
+  static constexpr uint8_t kRecordDead = 0x01U;
+  static constexpr uint8_t kFolderSeen = 0x01U;
+  static constexpr uint8_t kFolderDead = 0x02U;
+  static constexpr uint8_t kFolderHasFingerprint = 0x04U;
+
   static bool isSupportedPath(const char* path, CatalogCodec* outCodec = nullptr);
   static int compareNatural(const char* lhs, const char* rhs);
   static void sanitizeText(char* text, size_t len);
   static bool copyStr(char* out, size_t outLen, const char* in);
   static bool startsWithPathPrefix(const char* path, const char* prefix);
 
+  bool reserveTracks(uint32_t count);
+  bool reserveFolders(uint32_t count);
+  bool reservePool(uint32_t bytes);
+  uint32_t internText(const char* text);
+  int32_t findFolder(const char* folderPath) const;
+  int32_t internFolder(const char* folderPath);
+  bool addTrack(const TrackEntry& entry);
+  bool appendRecord(uint16_t folderId,
+                    const char* name,
+                    uint32_t sizeBytes,
+                    const char* title,
+                    const char* artist,
+                    const char* album,
+                    uint32_t durationMs);
+  void buildPath(const TrackRecord& record, char* out, size_t outLen) const;
+  const char* text(uint32_t offset) const;
+  uint32_t lowerBound(const char* path) const;
+  void prefixRange(const char* prefix, uint32_t* begin, uint32_t* end) const;
+  void compact();
+  void sortEntries();
+  void rebuildFolderOrder();
+  void resetStage();
+
   void parseMetadata(fs::FS& storage, TrackEntry* entry, uint32_t timeoutMs);
   void parseId3v2(fs::File& file, TrackEntry* entry, uint32_t timeoutMs);
   void parseId3v1(fs::File& file, TrackEntry* entry);
-  bool addTrackEntry(const TrackEntry& entry);
-  void sortEntries();
 
   bool scanDirRecursive(fs::FS& storage,
                         const char* dirPath,
@@ -85,6 +166,37 @@ class TrackCatalog {
                         uint32_t metadataTimeoutMs,
                         CatalogStats* stats);
 
-  TrackEntry entries_[kMaxTracks];
-  uint16_t count_ = 0;
+  TrackRecord* records_ = nullptr;
+  uint32_t recordCount_ = 0U;
+  uint32_t recordCapacity_ = 0U;
+  uint32_t liveCount_ = 0U;
+  uint32_t visibleCount_ = 0U;
+  FolderRecord* folders_ = nullptr;
+  uint32_t folderCount_ = 0U;
+  uint32_t folderCapacity_ = 0U;
+  // Folder ids sorted bytewise by path, for O(log n) folder lookup.
+  uint16_t* folderOrder_ = nullptr;
+  char* pool_ = nullptr;
+  uint32_t poolUsed_ = 0U;
+  uint32_t poolCapacity_ = 0U;
+  bool sorted_ = true;
+  bool refreshing_ = false;
+
+  // Staged directory listing for the folder being refreshed.
+  struct StagedFile {
+    uint32_t nameOffset;
+    uint32_t sizeBytes;
+    bool matched;
+  };
+  StagedFile* stage_ = nullptr;
+  uint16_t stageCount_ = 0U;
+  uint16_t stageCapacity_ = 0U;
+  char* stagePool_ = nullptr;
+  uint32_t stagePoolUsed_ = 0U;
+  uint32_t stagePoolCapacity_ = 0U;
+  uint16_t foldersReused_ = 0U;
+  uint16_t foldersRescanned_ = 0U;
+  bool refreshChanged_ = false;
+
+  mutable TrackEntry view_;
 };
@@ -1,6 +1,7 @@
 #include "audio_effect_id.h"
 
 #include <cctype>
+#include <cstddef>
 #include <cstring>
 
 namespace {
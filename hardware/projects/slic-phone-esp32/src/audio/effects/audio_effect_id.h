@@ -1,6 +1,6 @@
 #pragma once
 
-#include <Arduino.h>
+#include <stdint.h>
 
 enum class AudioEffectId : uint8_t {
   kFmSweep = 0,
@@ -0,0 +1,367 @@
+#include "fx_block_synth.h"
+
+#include <math.h>
+
+namespace {
+
+constexpr float kTwoPi = 6.28318530718f;
+constexpr uint8_t kSineBits = 9U;
+constexpr uint32_t kSineSize = 1UL << kSineBits;
+constexpr uint8_t kSineShift = 32U - kSineBits;
+
+constexpr char kMorsePattern[] = ".-- .. -.";  // "WIN"
+constexpr uint16_t kMorseUnitMs = 90U;
+constexpr uint16_t kMorseFreqHz = 680U;
+
+constexpr uint16_t kWinNotesHz[] = {
+    523U, 659U, 784U, 1047U, 1319U, 1047U, 1568U, 1319U, 0U};
+constexpr uint16_t kWinNotesMs[] = {
+    120U, 120U, 120U, 150U, 180U, 120U, 210U, 260U, 180U};
+constexpr uint16_t kWinNoteCount = sizeof(kWinNotesHz) / sizeof(kWinNotesHz[0]);
+
+float g_sine[kSineSize] = {};
+bool g_sineReady = false;
+
+void ensureSineTable() {
+  if (g_sineReady) {
+    return;
+  }
+  for (uint32_t i = 0U; i < kSineSize; ++i) {
+    g_sine[i] = sinf(kTwoPi * static_cast<float>(i) / static_cast<float>(kSineSize));
+  }
+  g_sineReady = true;
+}
+
+inline float sinPhase(uint32_t phase) {
+  return g_sine[phase >> kSineShift];
+}
+
+inline float sinTurns(float turns) {
+  turns -= static_cast<float>(static_cast<int32_t>(turns));
+  if (turns < 0.0f) {
+    turns += 1.0f;
+  }
+  return g_sine[static_cast<uint32_t>(turns * static_cast<float>(kSineSize)) & (kSineSize - 1U)];
+}
+
+inline float clampUnit(float value) {
+  if (value < -1.0f) {
+    return -1.0f;
+  }
+  if (value > 1.0f) {
+    return 1.0f;
+  }
+  return value;
+}
+
+uint32_t msToSamples(uint32_t sampleRateHz, uint32_t ms) {
+  return (sampleRateHz * ms) / 1000UL;
+}
+
+uint32_t atLeastOne(uint32_t value) {
+  return (value > 0U) ? value : 1U;
+}
+
+}  // namespace
+
+const FxSynthProfile kFxProfileMp3Overlay = {
+    2600U, 1200U, 130U, 200U, 420U, 0U,
+    1300.0f, 680.0f, 220.0f, 4.0f, 0.0f, 0.92f,
+    0.8f, 0.80f,
+    0.70f, 0.70f, 5U, 18U,
+    30000.0f,
+};
+
+const FxSynthProfile kFxProfileRadioScan = {
+    2800U, 1300U, 150U, 220U, 540U, 4U,
+    1200.0f, 760.0f, 240.0f, 4.5f, 0.03f, 0.90f,
+    0.7f, 0.82f,
+    0.72f, 0.72f, 4U, 16U,
+    32000.0f,
+};
+
+void FxBlockSynth::reset(AudioEffectId effect,
+                         uint32_t sampleRateHz,
+                         const FxSynthProfile& profile,
+                         uint32_t seed) {
+  ensureSineTable();
+  profile_ = &profile;
+  effect_ = effect;
+  sampleRateHz_ = (sampleRateHz > 0U) ? sampleRateHz : 44100U;
+  phaseScale_ = 4294967296.0f / static_cast<float>(sampleRateHz_);
+  noiseState_ = (seed != 0U) ? seed : 0x9E3779B9UL;
+
+  sweepPeriodSamples_ = msToSamples(sampleRateHz_, profile.fmSweepPeriodMs);
+  invSweepPeriod_ = (sweepPeriodSamples_ > 0U) ? (1.0f / static_cast<float>(sweepPeriodSamples_)) : 0.0f;
+  sweepPos_ = 0U;
+  sweepCycle_ = 0U;
+  fmPhaseA_ = 0U;
+  fmPhaseB_ = 0U;
+  fmNoiseLp_ = 0.0f;
+
+  sonarPeriodSamples_ = msToSamples(sampleRateHz_, profile.sonarPeriodMs);
+  sonarPingSamples_ = msToSamples(sampleRateHz_, profile.sonarPingMs);
+  sonarEchoStartSamples_ = msToSamples(sampleRateHz_, profile.sonarEchoStartMs);
+  sonarEchoLenSamples_ = msToSamples(sampleRateHz_, profile.sonarEchoLenMs);
+  sonarClickSamples_ = msToSamples(sampleRateHz_, profile.sonarClickMs);
+  invPingSamples_ = (sonarPingSamples_ > 0U) ? (1.0f / static_cast<float>(sonarPingSamples_)) : 0.0f;
+  invEchoLenSamples_ =
+      (sonarEchoLenSamples_ > 0U) ? (1.0f / static_cast<float>(sonarEchoLenSamples_)) : 0.0f;
+  echoDecayPerSample_ = expf(-profile.sonarEchoDecay * invEchoLenSamples_);
+  echoEnv_ = 1.0f;
+  sonarCycle_ = 0U;
+  sonarPhase_ = 0U;
+  sonarEchoPhase_ = 0U;
+
+  morseUnitSamples_ = atLeastOne(msToSamples(sampleRateHz_, kMorseUnitMs));
+  morseWarbleInc_ = phaseInc(profile.morseWarbleHz);
+  morseWarblePhase_ = 0U;
+  morsePhase_ = 0U;
+  morseToneSamplesLeft_ = 0U;
+  morseGapSamplesLeft_ = 0U;
+  morsePatternPos_ = 0U;
+
+  winAttackSamples_ = atLeastOne(msToSamples(sampleRateHz_, profile.winAttackMs));
+  winReleaseSamples_ = atLeastOne(msToSamples(sampleRateHz_, profile.winReleaseMs));
+  invWinAttack_ = 1.0f / static_cast<float>(winAttackSamples_);
+  invWinRelease_ = 1.0f / static_cast<float>(winReleaseSamples_);
+  winPhase_ = 0U;
+  winInc_ = 0U;
+  winStepSamplesLeft_ = 0U;
+  winStepTotalSamples_ = 0U;
+  invWinStepTotal_ = 0.0f;
+  winStepIndex_ = 0U;
+  winCurrentFreqHz_ = 0U;
+
+  if (effect_ == AudioEffectId::kMorse) {
+    prepareMorseState();
+  } else if (effect_ == AudioEffectId::kWin) {
+    prepareWinState();
+  }
+}
+
+void FxBlockSynth::render(int16_t* outMono, size_t frames) {
+  if (outMono == nullptr || frames == 0U) {
+    return;
+  }
+  switch (effect_) {
+    case AudioEffectId::kSonar:
+      renderSonar(outMono, frames);
+      break;
+    case AudioEffectId::kMorse:
+      renderMorse(outMono, frames);
+      break;
+    case AudioEffectId::kWin:
+      renderWin(outMono, frames);
+      break;
+    case AudioEffectId::kFmSweep:
+    default:
+      renderFm(outMono, frames);
+      break;
+  }
+}
+
+AudioEffectId FxBlockSynth::effect() const {
+  return effect_;
+}
+
+uint32_t FxBlockSynth::sampleRateHz() const {
+  return sampleRateHz_;
+}
+
+void FxBlockSynth::renderFm(int16_t* out, size_t frames) {
+  for (size_t i = 0U; i < frames; ++i) {
+    float sweepT = static_cast<float>(sweepPos_) * invSweepPeriod_;
+    if ((sweepCycle_ & 1U) != 0U) {
+      sweepT = 1.0f - sweepT;
+    }
+
+    const bool stationWindow = (sweepT > 0.20f && sweepT < 0.34f) || (sweepT > 0.58f && sweepT < 0.74f);
+    const float carrierLfo = sinPhase(fmPhaseB_);
+    const float sweepHz = stationWindow ? (240.0f + (130.0f * sinTurns(sweepT * 2.0f)))
+                                        : (95.0f + (1300.0f * sweepT));
+    const float carrierHz = stationWindow ? (560.0f + (120.0f * carrierLfo))
+                                          : (760.0f + (280.0f * carrierLfo));
+    fmPhaseA_ += phaseInc(sweepHz);
+    fmPhaseB_ += phaseInc(carrierHz);
+
+    const float rawNoise = noise();
+    fmNoiseLp_ = (0.985f * fmNoiseLp_) + (0.015f * rawNoise);
+    const float hiss = rawNoise - fmNoiseLp_;
+
+    float sampleF = 0.0f;
+    sampleF += (stationWindow ? 0.28f : 0.45f) * sinPhase(fmPhaseA_);
+    sampleF += (stationWindow ? 0.20f : 0.15f) * sinPhase(fmPhaseB_);
+    sampleF += (stationWindow ? 0.16f : 0.32f) * hiss;
+    out[i] = toPcm(sampleF);
+
+    ++sweepPos_;
+    if (sweepPos_ >= sweepPeriodSamples_) {
+      sweepPos_ = 0U;
+      ++sweepCycle_;
+    }
+  }
+}
+
+void FxBlockSynth::renderSonar(int16_t* out, size_t frames) {
+  const FxSynthProfile& p = *profile_;
+  const uint32_t echoEnd = sonarEchoStartSamples_ + sonarEchoLenSamples_;
+  for (size_t i = 0U; i < frames; ++i) {
+    const uint32_t cycle = sonarCycle_;
+    float sampleF = 0.0f;
+
+    if (cycle < sonarPingSamples_) {
+      const float pingT = static_cast<float>(cycle) * invPingSamples_;
+      sonarPhase_ += phaseInc(1800.0f - (p.sonarPingSpanHz * pingT));
+      const float env = (1.0f - pingT) * (1.0f - pingT);
+      sampleF += p.sonarPingAmp * sinPhase(sonarPhase_) * env;
+      if (cycle < sonarClickSamples_) {
+        sampleF += 0.22f;
+      }
+    }
+
+    if (cycle >= sonarEchoStartSamples_ && cycle < echoEnd) {
+      if (cycle == sonarEchoStartSamples_) {
+        echoEnv_ = 1.0f;
+      }
+      const float echoT = static_cast<float>(cycle - sonarEchoStartSamples_) * invEchoLenSamples_;
+      sonarEchoPhase_ += phaseInc(p.sonarEchoStartHz - (p.sonarEchoSpanHz * echoT));
+      sampleF += 0.46f * sinPhase(sonarEchoPhase_) * echoEnv_;
+      echoEnv_ *= echoDecayPerSample_;
+    }
+
+    if (p.sonarNoise > 0.0f) {
+      sampleF += p.sonarNoise * noise();
+    }
+    out[i] = toPcm(sampleF);
+
+    ++sonarCycle_;
+    if (sonarCycle_ >= sonarPeriodSamples_) {
+      sonarCycle_ = 0U;
+    }
+  }
+}
+
+bool FxBlockSynth::prepareMorseState() {
+  while (true) {
+    const char symbol = kMorsePattern[morsePatternPos_];
+    if (symbol == '\0') {
+      morsePatternPos_ = 0U;
+      morseGapSamplesLeft_ = morseUnitSamples_ * 7U;
+      return false;
+    }
+    ++morsePatternPos_;
+
+    if (symbol == ' ') {
+      morseGapSamplesLeft_ = morseUnitSamples_ * 3U;
+      return false;
+    }
+    if (symbol == '.') {
+      morseToneSamplesLeft_ = morseUnitSamples_;
+      morseGapSamplesLeft_ = morseUnitSamples_;
+      return true;
+    }
+    if (symbol == '-') {
+      morseToneSamplesLeft_ = morseUnitSamples_ * 3U;
+      morseGapSamplesLeft_ = morseUnitSamples_;
+      return true;
+    }
+  }
+}
+
+void FxBlockSynth::renderMorse(int16_t* out, size_t frames) {
+  const float amp = profile_->morseAmp;
+  for (size_t i = 0U; i < frames; ++i) {
+    morseWarblePhase_ += morseWarbleInc_;
+    if (morseToneSamplesLeft_ == 0U) {
+      if (morseGapSamplesLeft_ > 0U) {
+        --morseGapSamplesLeft_;
+        out[i] = 0;
+        continue;
+      }
+      if (!prepareMorseState()) {
+        out[i] = 0;
+        continue;
+      }
+    }
+
+    const float warble = 1.0f + (0.05f * sinPhase(morseWarblePhase_));
+    morsePhase_ += phaseInc(static_cast<float>(kMorseFreqHz) * warble);
+
+    float sampleF = amp * sinPhase(morsePhase_);
+    sampleF += 0.10f * sinPhase(morsePhase_ << 1);
+    out[i] = toPcm(sampleF);
+    --morseToneSamplesLeft_;
+  }
+}
+
+bool FxBlockSynth::prepareWinState() {
+  if (winStepIndex_ >= kWinNoteCount) {
+    winStepIndex_ = 0U;
+  }
+  const uint16_t idx = winStepIndex_;
+  winCurrentFreqHz_ = kWinNotesHz[idx];
+  winInc_ = phaseInc(static_cast<float>(winCurrentFreqHz_));
+  const uint32_t stepSamples = atLeastOne(msToSamples(sampleRateHz_, kWinNotesMs[idx]));
+  winStepSamplesLeft_ = stepSamples;
+  winStepTotalSamples_ = stepSamples;
+  invWinStepTotal_ = 1.0f / static_cast<float>(stepSamples);
+  ++winStepIndex_;
+  return true;
+}
+
+void FxBlockSynth::renderWin(int16_t* out, size_t frames) {
+  const FxSynthProfile& p = *profile_;
+  const float squareMix = 1.0f - p.winSineMix;
+  for (size_t i = 0U; i < frames; ++i) {
+    if (winStepSamplesLeft_ == 0U) {
+      prepareWinState();
+    }
+
+    float sampleF = 0.0f;
+    if (winCurrentFreqHz_ > 0U) {
+      winPhase_ += winInc_;
+      const float sineWave = sinPhase(winPhase_);
+      const float squareWave = (sineWave >= 0.0f) ? 1.0f : -1.0f;
+      const uint32_t elapsed = winStepTotalSamples_ - winStepSamplesLeft_;
+      float env = 1.0f - (p.winDecay * static_cast<float>(elapsed) * invWinStepTotal_);
+      if (winStepSamplesLeft_ < winReleaseSamples_) {
+        const float releaseEnv = static_cast<float>(winStepSamplesLeft_) * invWinRelease_;
+        if (releaseEnv < env) {
+          env = releaseEnv;
+        }
+      }
+      if (elapsed < winAttackSamples_) {
+        const float attackEnv = static_cast<float>(elapsed) * invWinAttack_;
+        if (attackEnv < env) {
+          env = attackEnv;
+        }
+      }
+
+      sampleF = (p.winSineMix * sineWave) + (squareMix * squareWave);
+      sampleF += 0.18f * sinPhase(winPhase_ + (winPhase_ >> 1));
+      sampleF *= env;
+    }
+
+    --winStepSamplesLeft_;
+    out[i] = toPcm(sampleF);
+  }
+}
+
+float FxBlockSynth::noise() {
+  noiseState_ ^= noiseState_ << 13;
+  noiseState_ ^= noiseState_ >> 17;
+  noiseState_ ^= noiseState_ << 5;
+  return static_cast<float>(static_cast<int32_t>(noiseState_ >> 24) - 128) * (1.0f / 128.0f);
+}
+
+uint32_t FxBlockSynth::phaseInc(float hz) const {
+  if (hz <= 0.0f) {
+    return 0U;
+  }
+  return static_cast<uint32_t>(hz * phaseScale_);
+}
+
+int16_t FxBlockSynth::toPcm(float sample) const {
+  return static_cast<int16_t>(clampUnit(sample) * profile_->outputScale);
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "audio_effect_id.h"
+
+// Tuning of one FX voice family. The MP3 overlay and the boot radio-scan share
+// the same synthesizers and only differ by these constants.
+struct FxSynthProfile {
+  uint16_t fmSweepPeriodMs;
+  uint16_t sonarPeriodMs;
+  uint16_t sonarPingMs;
+  uint16_t sonarEchoStartMs;
+  uint16_t sonarEchoLenMs;
+  uint16_t sonarClickMs;
+  float sonarPingSpanHz;
+  float sonarEchoStartHz;
+  float sonarEchoSpanHz;
+  float sonarEchoDecay;
+  float sonarNoise;
+  float sonarPingAmp;
+  float morseWarbleHz;
+  float morseAmp;
+  float winSineMix;
+  float winDecay;
+  uint8_t winAttackMs;
+  uint8_t winReleaseMs;
+  float outputScale;
+};
+
+extern const FxSynthProfile kFxProfileMp3Overlay;
+extern const FxSynthProfile kFxProfileRadioScan;
+
+// Block renderer for the FM/SONAR/MORSE/WIN voices. Everything that only
+// depends on the sample rate is resolved in reset(); render() runs integer
+// phase accumulators over a sine table so the per-sample cost stays flat.
+// Arduino-free so the host benchmark can link it directly.
+class FxBlockSynth {
+ public:
+  void reset(AudioEffectId effect, uint32_t sampleRateHz, const FxSynthProfile& profile, uint32_t seed);
+  void render(int16_t* outMono, size_t frames);
+
+  AudioEffectId effect() const;
+  uint32_t sampleRateHz() const;
+
+ private:
+  void renderFm(int16_t* out, size_t frames);
+  void renderSonar(int16_t* out, size_t frames);
+  void renderMorse(int16_t* out, size_t frames);
+  void renderWin(int16_t* out, size_t frames);
+  bool prepareMorseState();
+  bool prepareWinState();
+  float noise();
+  uint32_t phaseInc(float hz) const;
+  int16_t toPcm(float sample) const;
+
+  const FxSynthProfile* profile_ = &kFxProfileMp3Overlay;
+  AudioEffectId effect_ = AudioEffectId::kFmSweep;
+  uint32_t sampleRateHz_ = 44100U;
+  float phaseScale_ = 0.0f;
+  uint32_t noiseState_ = 0x9E3779B9UL;
+
+  uint32_t sweepPeriodSamples_ = 0U;
+  uint32_t sweepPos_ = 0U;
+  uint32_t sweepCycle_ = 0U;
+  float invSweepPeriod_ = 0.0f;
+  uint32_t fmPhaseA_ = 0U;
+  uint32_t fmPhaseB_ = 0U;
+  float fmNoiseLp_ = 0.0f;
+
+  uint32_t sonarPeriodSamples_ = 0U;
+  uint32_t sonarPingSamples_ = 0U;
+  uint32_t sonarEchoStartSamples_ = 0U;
+  uint32_t sonarEchoLenSamples_ = 0U;
+  uint32_t sonarClickSamples_ = 0U;
+  uint32_t sonarCycle_ = 0U;
+  float invPingSamples_ = 0.0f;
+  float invEchoLenSamples_ = 0.0f;
+  float echoDecayPerSample_ = 1.0f;
+  float echoEnv_ = 1.0f;
+  uint32_t sonarPhase_ = 0U;
+  uint32_t sonarEchoPhase_ = 0U;
+
+  uint32_t morseUnitSamples_ = 1U;
+  uint32_t morsePhase_ = 0U;
+  uint32_t morseWarblePhase_ = 0U;
+  uint32_t morseWarbleInc_ = 0U;
+  uint32_t morseToneSamplesLeft_ = 0U;
+  uint32_t morseGapSamplesLeft_ = 0U;
+  uint16_t morsePatternPos_ = 0U;
+
+  uint32_t winPhase_ = 0U;
+  uint32_t winInc_ = 0U;
+  uint32_t winStepSamplesLeft_ = 0U;
+  uint32_t winStepTotalSamples_ = 0U;
+  float invWinStepTotal_ = 0.0f;
+  uint32_t winAttackSamples_ = 1U;
+  uint32_t winReleaseSamples_ = 1U;
+  float invWinAttack_ = 1.0f;
+  float invWinRelease_ = 1.0f;
+  uint16_t winStepIndex_ = 0U;
+  uint16_t winCurrentFreqHz_ = 0U;
+};
@@ -0,0 +1,60 @@
+#include "fx_mix_q15.h"
+
+namespace {
+
+inline int16_t sat16(int32_t value) {
+  if (value > 32767) {
+    return 32767;
+  }
+  if (value < -32767) {
+    return -32767;
+  }
+  return static_cast<int16_t>(value);
+}
+
+}  // namespace
+
+int16_t fx_gain_to_q15(float gain) {
+  if (gain <= 0.0f) {
+    return 0;
+  }
+  if (gain >= 1.0f) {
+    return 32767;
+  }
+  return static_cast<int16_t>(gain * 32768.0f);
+}
+
+void fx_s16_gain_q15(int16_t* dst, const int16_t* src, int16_t gain_q15, size_t n) {
+  if (dst == nullptr || src == nullptr || n == 0U) {
+    return;
+  }
+  const int32_t g = gain_q15;
+  size_t i = 0U;
+  for (; (i + 4U) <= n; i += 4U) {
+    dst[i] = sat16((static_cast<int32_t>(src[i]) * g + 16384) >> 15);
+    dst[i + 1U] = sat16((static_cast<int32_t>(src[i + 1U]) * g + 16384) >> 15);
+    dst[i + 2U] = sat16((static_cast<int32_t>(src[i + 2U]) * g + 16384) >> 15);
+    dst[i + 3U] = sat16((static_cast<int32_t>(src[i + 3U]) * g + 16384) >> 15);
+  }
+  for (; i < n; ++i) {
+    dst[i] = sat16((static_cast<int32_t>(src[i]) * g + 16384) >> 15);
+  }
+}
+
+void fx_s16_duck_mix_q15(int16_t* stereo,
+                         const int16_t* fx_mono,
+                         size_t frames,
+                         int16_t music_q15,
+                         int16_t fx_q15) {
+  if (stereo == nullptr || fx_mono == nullptr || frames == 0U) {
+    return;
+  }
+  const int32_t gm = music_q15;
+  const int32_t gf = fx_q15;
+  for (size_t i = 0U; i < frames; ++i) {
+    const int32_t fx = static_cast<int32_t>(fx_mono[i]) * gf;
+    int16_t* frame = &stereo[i * 2U];
+    frame[0] = sat16((static_cast<int32_t>(frame[0]) * gm + fx + 16384) >> 15);
+    frame[1] = sat16((static_cast<int32_t>(frame[1]) * gm + fx + 16384) >> 15);
+  }
+}
@@ -0,0 +1,18 @@
+// fx_mix_q15.h - block mix/duck kernels for the MP3 FX overlay (Q15 gains).
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+int16_t fx_gain_to_q15(float gain);
+
+// dst[i] = sat(src[i] * gain)
+void fx_s16_gain_q15(int16_t* dst, const int16_t* src, int16_t gain_q15, size_t n);
+
+// Interleaved stereo music ducked by music_q15, plus the mono FX voice scaled
+// by fx_q15 on both channels. Operates in place on `stereo`.
+void fx_s16_duck_mix_q15(int16_t* stereo,
+                         const int16_t* fx_mono,
+                         size_t frames,
+                         int16_t music_q15,
+                         int16_t fx_q15);
@@ -3,6 +3,7 @@
 #include <Arduino.h>
 
 #include "effects/audio_effect_id.h"
+#include "effects/fx_block_synth.h"
 
 namespace audio_tools {
 class I2SStream;
@@ -33,13 +34,8 @@ class FmRadioScanFx {
  private:
   bool writeFrameBuffer(const int16_t* interleavedStereo, size_t frameCount);
   void resetSynthesisState();
-  int16_t nextSample();
+  void renderBlock(int16_t* mono, uint16_t frames);
   int16_t nextSampleFmSweep();
-  int16_t nextSampleSonar();
-  int16_t nextSampleMorse();
-  int16_t nextSampleWin();
-  bool morsePrepareNextState();
-  bool winPrepareNextStep();
 
   static constexpr uint16_t kSynthRateHz = 22050U;
 
@@ -63,15 +59,5 @@ class FmRadioScanFx {
   uint32_t sweepCycle_ = 0;
   uint32_t sweepPosInCycle_ = 0;
   uint32_t sampleClock_ = 0;
-  float sonarPhase_ = 0.0f;
-  float sonarEchoPhase_ = 0.0f;
-  float morsePhase_ = 0.0f;
-  float winPhase_ = 0.0f;
-  uint32_t morseToneSamplesLeft_ = 0;
-  uint32_t morseGapSamplesLeft_ = 0;
-  uint16_t morsePatternPos_ = 0;
-  uint32_t winStepSamplesLeft_ = 0;
-  uint32_t winStepTotalSamples_ = 0;
-  uint16_t winStepIndex_ = 0;
-  uint16_t winCurrentFreqHz_ = 0;
+  FxBlockSynth voiceSynth_;
 };
@@ -4,6 +4,8 @@
 #include <AudioOutputI2S.h>
 
 #include "effects/audio_effect_id.h"
+#include "effects/fx_block_synth.h"
+#include "player/i2s_underrun_estimator.h"
 
 using Mp3FxEffect = AudioEffectId;
 
@@ -12,12 +14,18 @@ enum class Mp3FxMode : uint8_t {
   kOverlay,
 };
 
+// Decoded samples are accumulated into one DMA-sized block; FX are rendered and
+// mixed per block, then the block is pushed to I2S with a single write.
 class Mp3FxOverlayOutput : public AudioOutputI2S {
  public:
+  static constexpr uint16_t kBlockFrames = 128U;
+
   Mp3FxOverlayOutput(int port = 0, int output_mode = EXTERNAL_I2S, int dma_buf_count = 8, int use_apll = APLL_DISABLE);
 
   bool SetRate(int hz) override;
   bool ConsumeSample(int16_t sample[2]) override;
+  void flush() override;
+  bool stop() override;
 
   void setFxMode(Mp3FxMode mode);
   Mp3FxMode fxMode() const;
@@ -28,6 +36,16 @@ class Mp3FxOverlayOutput : public AudioOutputI2S {
   void setOverlayGain(float gain);
   float overlayGain() const;
 
+  // While set, stop()/flush() from a finishing decoder only queue the pending
+  // block: the I2S driver keeps running so the next decoder can continue on
+  // this output without a gap.
+  void setKeepAliveOnStop(bool keepAlive);
+  bool keepAliveOnStop() const;
+  uint32_t underrunCount() const;
+  uint32_t framesWritten() const;
+  uint32_t sampleRateHz() const;
+  void resetUnderrunClock();
+
   bool triggerFx(Mp3FxEffect effect, uint32_t durationMs);
   void stopFx();
   bool isFxActive() const;
@@ -35,44 +53,30 @@ class Mp3FxOverlayOutput : public AudioOutputI2S {
   uint32_t fxRemainingMs() const;
 
  private:
-  int16_t nextFxSample();
-  int16_t nextFmSample();
-  int16_t nextSonarSample();
-  int16_t nextMorseSample();
-  int16_t nextWinSample();
-
-  bool prepareMorseState();
-  bool prepareWinState();
+  void processBlock();
+  void mixFxBlock(size_t frames);
+  void finalizeI2sBlock(size_t frames);
+  bool drainBlock();
+  void resetBlock();
   static float clampf(float value, float minValue, float maxValue);
-  static int16_t clamp16(int32_t value);
-
-  static constexpr char kMorsePattern_[] = ".-- .. -.";  // WIN
 
   uint32_t sampleRateHz_ = 44100U;
   Mp3FxMode mode_ = Mp3FxMode::kDucking;
   float duckingGain_ = 0.45f;
   float overlayGain_ = 0.42f;
+  int16_t duckingGainQ15_ = 0;
+  int16_t overlayGainQ15_ = 0;
 
   bool fxActive_ = false;
   Mp3FxEffect fxEffect_ = Mp3FxEffect::kFmSweep;
   uint32_t fxRemainingSamples_ = 0;
-  uint32_t fxSampleClock_ = 0;
-
-  float fmPhaseA_ = 0.0f;
-  float fmPhaseB_ = 0.0f;
-  float fmNoiseLp_ = 0.0f;
-
-  float sonarPhase_ = 0.0f;
-  float sonarEchoPhase_ = 0.0f;
-
-  float morsePhase_ = 0.0f;
-  uint32_t morseToneSamplesLeft_ = 0;
-  uint32_t morseGapSamplesLeft_ = 0;
-  uint16_t morsePatternPos_ = 0;
-
-  float winPhase_ = 0.0f;
-  uint32_t winStepSamplesLeft_ = 0;
-  uint32_t winStepTotalSamples_ = 0;
-  uint16_t winStepIndex_ = 0;
-  uint16_t winCurrentFreqHz_ = 0;
+  FxBlockSynth synth_;
+
+  int16_t block_[kBlockFrames * 2U] = {};
+  int16_t fxBlock_[kBlockFrames] = {};
+  uint16_t blockFill_ = 0U;
+  uint16_t drainBytes_ = 0U;
+  bool blockReady_ = false;
+  bool keepAliveOnStop_ = false;
+  I2sUnderrunEstimator underrun_;
 };
@@ -5,6 +5,7 @@
 
 #include "../config.h"
 
+#include <AudioFileSourceBuffer.h>
 #include <AudioFileSourceFS.h>
 #include <AudioGenerator.h>
 #include <AudioGeneratorMP3.h>
@@ -27,7 +28,8 @@
 
 namespace {
 
-constexpr const char* kIndexPath = "/.uson_index_v1.csv";
+constexpr const char* kIndexPath = "/.uson_index_v2.bin";
+constexpr const char* kLegacyIndexPath = "/.uson_index_v1.csv";
 constexpr const char* kStatePath = "/.uson_player_state_v1.json";
 constexpr uint32_t kScanTickBudgetMs = 4U;
 constexpr uint16_t kScanTickEntryBudget = 24U;
@@ -162,12 +164,19 @@ void Mp3Player::update(uint32_t nowMs, bool allowPlayback) {
     return;
   }
 
+  updateBoundaryWatch(nowMs, false);
+
   if (activeBackend_ == PlayerBackendId::kAudioTools) {
     audioTools_.update();
+    if (audioTools_.takeHandoff()) {
+      onAudioToolsHandoff(nowMs);
+    }
     if (audioTools_.isActive()) {
+      updatePreroll();
       return;
     }
 
+    onColdTransition(true);
     if (repeatMode_ == RepeatMode::kAll && trackCount_ > 0U) {
       currentTrack_ = static_cast<uint16_t>((currentTrack_ + 1U) % trackCount_);
     }
@@ -178,15 +187,22 @@ void Mp3Player::update(uint32_t nowMs, bool allowPlayback) {
   if (activeBackend_ == PlayerBackendId::kLegacy && decoder_ != nullptr) {
     if (decoder_->isRunning()) {
       if (decoder_->loop()) {
+        updatePreroll();
         return;
       }
 
-      const String failedTrack = currentTrackName();
-      Serial.printf("[MP3] Decoder loop stop [%s]: %s\n",
-                    codecLabel(activeCodec_),
-                    failedTrack.isEmpty() ? "-" : failedTrack.c_str());
+      if (!preroll_.ready) {
+        const String failedTrack = currentTrackName();
+        Serial.printf("[MP3] Decoder loop stop [%s]: %s\n",
+                      codecLabel(activeCodec_),
+                      failedTrack.isEmpty() ? "-" : failedTrack.c_str());
+      }
     }
 
+    if (handoffLegacyPreroll(followingTrackIndex(), nowMs)) {
+      return;
+    }
+    onColdTransition(true);
     stopLegacyTrack();
     if (repeatMode_ == RepeatMode::kAll && trackCount_ > 0U) {
       currentTrack_ = static_cast<uint16_t>((currentTrack_ + 1U) % trackCount_);
@@ -206,6 +222,11 @@ void Mp3Player::togglePause() {
     return;
   }
   paused_ = !paused_;
+  // Silence during a pause is not starvation.
+  if (i2sOut_ != nullptr) {
+    i2sOut_->resetUnderrunClock();
+  }
+  audioTools_.resetUnderrunClock();
   markStateDirty();
 }
 
@@ -224,8 +245,14 @@ void Mp3Player::nextTrack() {
   }
 
   paused_ = false;
+  const uint16_t next = static_cast<uint16_t>((currentTrack_ + 1U) % trackCount_);
+  // A skip onto the pre-rolled track reuses the running output.
+  if (activeBackend_ == PlayerBackendId::kLegacy && handoffLegacyPreroll(next, millis())) {
+    markStateDirty();
+    return;
+  }
   stop();
-  currentTrack_ = static_cast<uint16_t>((currentTrack_ + 1U) % trackCount_);
+  currentTrack_ = next;
   markStateDirty();
   startCurrentTrack();
 }
@@ -275,6 +302,14 @@ void Mp3Player::requestCatalogScan(bool forceRebuild) {
 bool Mp3Player::cancelCatalogScan() {
   const bool wasBusy = scanService_.isBusy();
   scanService_.cancel();
+  if (scanCtx_.active) {
+    const String currentPath = currentTrackName();
+    if (catalog_.finishRefresh(false) && currentPath.length() > 0U) {
+      const int16_t idx = catalog_.indexOfPath(currentPath.c_str());
+      currentTrack_ = (idx >= 0) ? static_cast<uint16_t>(idx) : 0U;
+    }
+    trackCount_ = catalog_.size();
+  }
   clearScanContext();
   scanBusy_ = false;
   scanProgress_.active = false;
@@ -513,7 +548,9 @@ Mp3ScanProgress Mp3Player::scanProgress() const {
 }
 
 Mp3BackendRuntimeStats Mp3Player::backendStats() const {
-  return backendStats_;
+  Mp3BackendRuntimeStats stats = backendStats_;
+  stats.underruns = totalUnderruns();
+  return stats;
 }
 
 const TrackEntry* Mp3Player::trackEntryByNumber(uint16_t oneBasedNumber) const {
@@ -718,21 +755,30 @@ void Mp3Player::beginScanIfRequested(uint32_t nowMs) {
   }
 
   if (loadedFromIndex) {
-    scanProgress_.tracksAccepted = catalog_.size();
-    setScanReason(&scanProgress_, "INDEX_HIT");
-    finalizeScan(nowMs, true, true);
-    return;
+    // Tracks are playable right away; the walk below only re-lists folders and
+    // rescans the ones whose fingerprint changed.
+    trackCount_ = catalog_.size();
+    if (currentTrack_ >= trackCount_) {
+      currentTrack_ = 0U;
+    }
+    restoreTrackFromStatePath();
+    catalogStats_.folders = 0U;
+    scanProgress_.tracksAccepted = trackCount_;
+    Serial.printf("[MP3] %u track(s) from index, validating folders.\n",
+                  static_cast<unsigned int>(trackCount_));
+  } else {
+    catalog_.clear();
+    trackCount_ = 0U;
+    currentTrack_ = 0U;
   }
 
-  catalog_.clear();
-  trackCount_ = 0U;
-  currentTrack_ = 0U;
-
+  catalog_.beginRefresh();
   scanCtx_.active = true;
-  setScanReason(&scanProgress_, forceRebuild ? "REBUILD" : "SCAN");
+  scanCtx_.fromIndex = loadedFromIndex;
+  setScanReason(&scanProgress_, loadedFromIndex ? "VALIDATE" : (forceRebuild ? "REBUILD" : "SCAN"));
   if (!pushScanDir("/", 0U)) {
     setScanReason(&scanProgress_, "STACK_OVF");
-    finalizeScan(nowMs, false, false);
+    finalizeScan(nowMs, false, loadedFromIndex);
   }
 }
 
@@ -750,7 +796,7 @@ void Mp3Player::updateScan(uint32_t nowMs) {
       uint8_t depth = 0U;
       if (!popScanDir(&dirPath, &depth)) {
         setScanReason(&scanProgress_, "COMPLETE");
-        finalizeScan(nowMs, true, false);
+        finalizeScan(nowMs, true, scanCtx_.fromIndex);
         return;
       }
       scanCtx_.currentDir = SD_MMC.open(dirPath.c_str());
@@ -760,6 +806,8 @@ void Mp3Player::updateScan(uint32_t nowMs) {
         }
         continue;
       }
+      copyCStr(scanCtx_.currentPath, sizeof(scanCtx_.currentPath), dirPath.c_str());
+      scanCtx_.fingerprint = CatalogFolderFingerprint();
       scanCtx_.currentDepth = depth;
       scanProgress_.depth = depth;
       scanProgress_.stackSize = scanCtx_.stackSize;
@@ -771,28 +819,42 @@ void Mp3Player::updateScan(uint32_t nowMs) {
     fs::File entry = scanCtx_.currentDir.openNextFile();
     if (!entry) {
       scanCtx_.currentDir.close();
+      const bool committed = catalog_.commitFolder(scanCtx_.currentPath, scanCtx_.fingerprint);
+      scanProgress_.foldersReused = catalog_.foldersReused();
+      scanProgress_.foldersRescanned = catalog_.foldersRescanned();
+      if (!committed) {
+        scanCtx_.limitReached = true;
+        scanProgress_.limitReached = true;
+        setScanReason(&scanProgress_, "LIMIT");
+        finalizeScan(nowMs, true, scanCtx_.fromIndex);
+        return;
+      }
       continue;
     }
 
-    String path = String(entry.name());
+    // Some cores return a bare name, others the full path: rebuild it from
+    // the directory being listed.
+    const char* parent = (strcmp(scanCtx_.currentPath, "/") == 0) ? "" : scanCtx_.currentPath;
+    const char* name = entry.name();
+    const char* slash = (name != nullptr) ? strrchr(name, '/') : nullptr;
+    char path[120] = {};
+    snprintf(path, sizeof(path), "%s/%s", parent, (slash != nullptr) ? (slash + 1) : (name != nullptr ? name : ""));
     const bool isDir = entry.isDirectory();
-    const uint32_t fileSize = static_cast<uint32_t>(entry.size());
+    const uint32_t fileSize = isDir ? 0U : static_cast<uint32_t>(entry.size());
+    const uint32_t lastWrite = static_cast<uint32_t>(entry.getLastWrite());
     entry.close();
     ++entriesThisTick;
     ++scanProgress_.filesScanned;
 
-    if (!path.startsWith("/")) {
-      path = "/" + path;
-    }
-
     if (isDir) {
+      scanCtx_.fingerprint.addEntry(path, 0U, lastWrite, true);
       if (scanCtx_.currentDepth < kScanMaxDepth) {
-        if (!pushScanDir(path.c_str(), static_cast<uint8_t>(scanCtx_.currentDepth + 1U))) {
+        if (!pushScanDir(path, static_cast<uint8_t>(scanCtx_.currentDepth + 1U))) {
           Serial.printf("[MP3] Catalog scan queue overflow at '%s' (max=%u).\n",
-                        path.c_str(),
+                        path,
                         static_cast<unsigned int>(kScanDirStackMax));
           setScanReason(&scanProgress_, "STACK_OVF");
-          finalizeScan(nowMs, false, false);
+          finalizeScan(nowMs, false, scanCtx_.fromIndex);
           return;
         }
         scanProgress_.stackSize = scanCtx_.stackSize;
@@ -800,18 +862,21 @@ void Mp3Player::updateScan(uint32_t nowMs) {
       continue;
     }
 
-    if (catalogCodecFromPath(path.c_str()) == CatalogCodec::kUnknown) {
+    if (catalogCodecFromPath(path) == CatalogCodec::kUnknown) {
       continue;
     }
 
-    if (!catalog_.appendFallbackPath(path.c_str(), fileSize)) {
+    scanCtx_.fingerprint.addEntry(path, fileSize, lastWrite, false);
+    if (!catalog_.stageFile(path, fileSize)) {
       scanCtx_.limitReached = true;
       scanProgress_.limitReached = true;
       setScanReason(&scanProgress_, "LIMIT");
-      finalizeScan(nowMs, true, false);
+      finalizeScan(nowMs, true, scanCtx_.fromIndex);
       return;
     }
-    scanProgress_.tracksAccepted = catalog_.size();
+    if (!scanCtx_.fromIndex) {
+      ++scanProgress_.tracksAccepted;
+    }
   }
 
   ++scanProgress_.ticks;
@@ -832,6 +897,18 @@ void Mp3Player::finalizeScan(uint32_t nowMs, bool success, bool loadedFromIndex)
   scanProgress_.active = false;
   scanProgress_.entriesThisTick = 0U;
 
+  // Indices may shift once the refresh is applied: follow the current track
+  // by path.
+  const String currentPath = currentTrackName();
+  const bool catalogChanged = catalog_.finishRefresh(success && !wasTruncated);
+  trackCount_ = catalog_.size();
+  if (catalogChanged && currentPath.length() > 0U) {
+    const int16_t idx = catalog_.indexOfPath(currentPath.c_str());
+    currentTrack_ = (idx >= 0) ? static_cast<uint16_t>(idx) : 0U;
+  }
+  scanProgress_.foldersReused = catalog_.foldersReused();
+  scanProgress_.foldersRescanned = catalog_.foldersRescanned();
+
   if (!success) {
     scanBusy_ = false;
     scanService_.finish(CatalogScanService::State::kFailed, nowMs);
@@ -856,8 +933,9 @@ void Mp3Player::finalizeScan(uint32_t nowMs, bool success, bool loadedFromIndex)
   catalogStats_.tracks = trackCount_;
   catalogStats_.indexed = true;
   catalogStats_.metadataBestEffort = loadedFromIndex;
-  if (!loadedFromIndex) {
-    catalog_.saveIndex(SD_MMC, kIndexPath);
+  if ((!loadedFromIndex || catalogChanged) && catalog_.saveIndex(SD_MMC, kIndexPath) &&
+      SD_MMC.exists(kLegacyIndexPath)) {
+    SD_MMC.remove(kLegacyIndexPath);
   }
 
   if (trackCount_ == 0U) {
@@ -872,13 +950,15 @@ void Mp3Player::finalizeScan(uint32_t nowMs, bool success, bool loadedFromIndex)
   if (currentTrack_ >= trackCount_) {
     currentTrack_ = 0U;
   }
-  restoreTrackFromStatePath();
+  if (!loadedFromIndex) {
+    restoreTrackFromStatePath();
+  }
 
   scanBusy_ = false;
   scanProgress_.tracksAccepted = trackCount_;
   scanProgress_.limitReached = wasTruncated;
   if (loadedFromIndex) {
-    setScanReason(&scanProgress_, "INDEX_HIT");
+    setScanReason(&scanProgress_, catalogChanged ? "INDEX_SYNC" : "INDEX_HIT");
   } else if (wasTruncated) {
     setScanReason(&scanProgress_, "DONE_LIMIT");
   } else {
@@ -886,9 +966,12 @@ void Mp3Player::finalizeScan(uint32_t nowMs, bool success, bool loadedFromIndex)
   }
   scanService_.finish(CatalogScanService::State::kDone, nowMs);
   clearScanContext();
-  Serial.printf("[MP3] %u track(s) loaded. index=%s%s\n",
+  Serial.printf("[MP3] %u track(s) loaded. index=%s folders=%u reused=%u rescanned=%u%s\n",
                 static_cast<unsigned int>(trackCount_),
-                loadedFromIndex ? "HIT" : "REBUILD",
+                loadedFromIndex ? (catalogChanged ? "SYNC" : "HIT") : "REBUILD",
+                static_cast<unsigned int>(catalog_.folderCount()),
+                static_cast<unsigned int>(catalog_.foldersReused()),
+                static_cast<unsigned int>(catalog_.foldersRescanned()),
                 wasTruncated ? " (TRUNCATED)" : "");
 }
 
@@ -923,6 +1006,7 @@ void Mp3Player::clearScanContext() {
   }
   scanCtx_.active = false;
   scanCtx_.limitReached = false;
+  scanCtx_.fromIndex = false;
   scanCtx_.stackSize = 0U;
   scanCtx_.currentDepth = 0U;
 }
@@ -987,6 +1071,7 @@ bool Mp3Player::startLegacyTrack() {
     return false;
   }
 
+  trackFramesBase_ = 0U;
   i2sOut_->SetPinout(i2sBclk_, i2sLrc_, i2sDout_);
   i2sOut_->SetGain(gain_);
   i2sOut_->setFxMode(fxMode_);
@@ -1106,6 +1191,7 @@ void Mp3Player::startCurrentTrack() {
 }
 
 void Mp3Player::stopLegacyTrack() {
+  releasePreroll();
   if (decoder_ != nullptr) {
     if (decoder_->isRunning()) {
       decoder_->stop();
@@ -1114,12 +1200,19 @@ void Mp3Player::stopLegacyTrack() {
     decoder_ = nullptr;
   }
 
+  if (mp3Buffer_ != nullptr) {
+    delete mp3Buffer_;
+    mp3Buffer_ = nullptr;
+  }
+
   if (mp3File_ != nullptr) {
     delete mp3File_;
     mp3File_ = nullptr;
   }
 
   if (i2sOut_ != nullptr) {
+    updateBoundaryWatch(millis(), true);
+    retiredUnderruns_ += i2sOut_->underrunCount();
     delete i2sOut_;
     i2sOut_ = nullptr;
   }
@@ -1136,6 +1229,216 @@ void Mp3Player::stop() {
   activeCodec_ = AudioCodec::kUnknown;
 }
 
+uint16_t Mp3Player::followingTrackIndex() const {
+  if (trackCount_ == 0U) {
+    return 0U;
+  }
+  if (repeatMode_ == RepeatMode::kOne) {
+    return currentTrack_;
+  }
+  return static_cast<uint16_t>((currentTrack_ + 1U) % trackCount_);
+}
+
+uint32_t Mp3Player::legacyRemainingMs() const {
+  if (mp3File_ == nullptr || i2sOut_ == nullptr || i2sOut_->sampleRateHz() == 0U) {
+    return UINT32_MAX;
+  }
+  // Bytes per ms are measured from what has actually been played, so VBR MP3
+  // and WAV both work without parsing headers here.
+  const uint32_t frames = i2sOut_->framesWritten() - trackFramesBase_;
+  const uint32_t size = mp3File_->getSize();
+  const uint32_t pos = mp3File_->getPos();
+  if (size > 0U && pos >= size) {
+    return 0U;
+  }
+  const uint64_t playedMs = (static_cast<uint64_t>(frames) * 1000ULL) / i2sOut_->sampleRateHz();
+  if (pos == 0U || playedMs < 1000ULL) {
+    return UINT32_MAX;
+  }
+  return static_cast<uint32_t>((static_cast<uint64_t>(size - pos) * playedMs) / pos);
+}
+
+void Mp3Player::updatePreroll() {
+  if (preroll_.ready) {
+    if (preroll_.buffer != nullptr) {
+      preroll_.buffer->loop();
+    }
+    return;
+  }
+  if (preroll_.attempted || trackCount_ == 0U) {
+    return;
+  }
+  const uint32_t remainingMs = (activeBackend_ == PlayerBackendId::kAudioTools) ? audioTools_.remainingMs()
+                                                                               : legacyRemainingMs();
+  if (remainingMs > kPrerollLeadMs) {
+    return;
+  }
+  preroll_.attempted = true;
+  startPreroll(followingTrackIndex());
+}
+
+bool Mp3Player::startPreroll(uint16_t index) {
+  const TrackEntry* entry = catalog_.entry(index);
+  if (entry == nullptr || entry->path[0] == '\0') {
+    return false;
+  }
+  copyCStr(preroll_.path, sizeof(preroll_.path), entry->path);
+  preroll_.track = index;
+  preroll_.codec = codecForPath(String(preroll_.path));
+  preroll_.backend = activeBackend_;
+
+  if (activeBackend_ == PlayerBackendId::kAudioTools) {
+    // Only WAV stays on this backend; anything else goes through a normal start.
+    if (!audioTools_.preload(preroll_.path)) {
+      return false;
+    }
+  } else {
+    if (preroll_.codec == AudioCodec::kUnknown || i2sOut_ == nullptr) {
+      return false;
+    }
+    preroll_.file = new (std::nothrow) AudioFileSourceFS(SD_MMC, preroll_.path);
+    if (preroll_.file != nullptr && preroll_.file->isOpen()) {
+      preroll_.buffer = new (std::nothrow) AudioFileSourceBuffer(preroll_.file, kPrerollBufferBytes);
+    }
+    preroll_.decoder = createDecoder(preroll_.codec);
+    if (preroll_.buffer == nullptr || preroll_.decoder == nullptr) {
+      releasePreroll();
+      return false;
+    }
+    preroll_.buffer->loop();
+    i2sOut_->setKeepAliveOnStop(true);
+  }
+
+  preroll_.ready = true;
+  ++backendStats_.prerollStarts;
+  Serial.printf("[MP3] Pre-roll %u/%u: %s\n",
+                static_cast<unsigned int>(index + 1U),
+                static_cast<unsigned int>(trackCount_),
+                preroll_.path);
+  return true;
+}
+
+void Mp3Player::releasePreroll() {
+  if (preroll_.decoder != nullptr) {
+    delete preroll_.decoder;
+  }
+  if (preroll_.buffer != nullptr) {
+    delete preroll_.buffer;
+  }
+  if (preroll_.file != nullptr) {
+    delete preroll_.file;
+  }
+  if (preroll_.backend == PlayerBackendId::kAudioTools) {
+    audioTools_.clearPreload();
+  }
+  if (i2sOut_ != nullptr) {
+    i2sOut_->setKeepAliveOnStop(false);
+  }
+  preroll_ = PrerollContext();
+}
+
+bool Mp3Player::handoffLegacyPreroll(uint16_t index, uint32_t nowMs) {
+  if (!preroll_.ready || preroll_.backend != PlayerBackendId::kLegacy || preroll_.track != index ||
+      i2sOut_ == nullptr || decoder_ == nullptr) {
+    return false;
+  }
+  // The catalog may have been refreshed since the pre-roll was opened.
+  const TrackEntry* entry = catalog_.entry(index);
+  if (entry == nullptr || strcmp(entry->path, preroll_.path) != 0) {
+    releasePreroll();
+    return false;
+  }
+
+  const uint32_t underrunBase = totalUnderruns();
+  // Retire the finished decoder while the output still ignores stop().
+  if (decoder_->isRunning()) {
+    decoder_->stop();
+  }
+  delete decoder_;
+  delete mp3Buffer_;
+  delete mp3File_;
+
+  decoder_ = preroll_.decoder;
+  mp3Buffer_ = preroll_.buffer;
+  mp3File_ = preroll_.file;
+  const AudioCodec codec = preroll_.codec;
+  preroll_.decoder = nullptr;
+  preroll_.buffer = nullptr;
+  preroll_.file = nullptr;
+  releasePreroll();
+
+  if (!decoder_->begin(mp3Buffer_, i2sOut_)) {
+    Serial.printf("[MP3] Pre-roll start failed [%s]: %s\n", codecLabel(codec), entry->path);
+    stopLegacyTrack();
+    activeBackend_ = PlayerBackendId::kNone;
+    return false;
+  }
+
+  currentTrack_ = index;
+  activeCodec_ = codec;
+  trackFramesBase_ = i2sOut_->framesWritten();
+  ++backendStats_.gaplessTransitions;
+  beginBoundaryWatch(nowMs, underrunBase);
+  Serial.printf("[MP3] Playing %u/%u [%s|LEGACY|GAPLESS]: %s\n",
+                static_cast<unsigned int>(currentTrack_ + 1U),
+                static_cast<unsigned int>(trackCount_),
+                codecLabel(codec),
+                catalog_.entry(currentTrack_) != nullptr ? catalog_.entry(currentTrack_)->path : "-");
+  return true;
+}
+
+void Mp3Player::onAudioToolsHandoff(uint32_t nowMs) {
+  const int16_t idx = catalog_.indexOfPath(preroll_.path);
+  currentTrack_ = (idx >= 0) ? static_cast<uint16_t>(idx) : preroll_.track;
+  activeCodec_ = preroll_.codec;
+  preroll_ = PrerollContext();
+  ++backendStats_.gaplessTransitions;
+  // The swap happened inside update(); its first write is still ahead.
+  beginBoundaryWatch(nowMs, totalUnderruns());
+  Serial.printf("[MP3] Playing %u/%u [%s|AUDIO_TOOLS|GAPLESS]: %s\n",
+                static_cast<unsigned int>(currentTrack_ + 1U),
+                static_cast<unsigned int>(trackCount_),
+                codecLabel(activeCodec_),
+                currentTrackName().c_str());
+}
+
+void Mp3Player::onColdTransition(bool naturalEnd) {
+  ++backendStats_.coldTransitions;
+  ++backendStats_.boundaryUnderruns;
+  if (naturalEnd && !preroll_.ready) {
+    ++backendStats_.prerollMisses;
+  }
+}
+
+uint32_t Mp3Player::totalUnderruns() const {
+  uint32_t total = retiredUnderruns_ + audioTools_.underrunCount();
+  if (i2sOut_ != nullptr) {
+    total += i2sOut_->underrunCount();
+  }
+  return total;
+}
+
+void Mp3Player::beginBoundaryWatch(uint32_t nowMs, uint32_t underrunBase) {
+  updateBoundaryWatch(nowMs, true);
+  boundaryWatchActive_ = true;
+  boundaryWatchUntilMs_ = nowMs + kBoundaryWatchMs;
+  boundaryUnderrunBase_ = underrunBase;
+}
+
+void Mp3Player::updateBoundaryWatch(uint32_t nowMs, bool force) {
+  if (!boundaryWatchActive_) {
+    return;
+  }
+  if (!force && static_cast<int32_t>(nowMs - boundaryWatchUntilMs_) < 0) {
+    return;
+  }
+  boundaryWatchActive_ = false;
+  const uint32_t total = totalUnderruns();
+  if (total > boundaryUnderrunBase_) {
+    backendStats_.boundaryUnderruns += total - boundaryUnderrunBase_;
+  }
+}
+
 void Mp3Player::markStateDirty() {
   stateDirty_ = true;
   nextStateSaveMs_ = millis() + kStateSaveDebounceMs;
@@ -9,6 +9,7 @@
 #include "player/player_backend.h"
 #include "../services/storage/catalog_scan_service.h"
 
+class AudioFileSourceBuffer;
 class AudioFileSourceFS;
 class AudioGenerator;
 
@@ -34,6 +35,8 @@ struct Mp3ScanProgress {
   uint8_t depth = 0U;
   uint8_t stackSize = 0U;
   uint16_t foldersScanned = 0U;
+  uint16_t foldersReused = 0U;
+  uint16_t foldersRescanned = 0U;
   uint16_t filesScanned = 0U;
   uint16_t tracksAccepted = 0U;
   uint16_t entriesThisTick = 0U;
@@ -53,6 +56,14 @@ struct Mp3BackendRuntimeStats {
   uint32_t fallbackCount = 0U;
   uint32_t legacyStarts = 0U;
   uint32_t audioToolsStarts = 0U;
+  uint32_t gaplessTransitions = 0U;
+  uint32_t coldTransitions = 0U;
+  uint32_t prerollStarts = 0U;
+  uint32_t prerollMisses = 0U;
+  uint32_t underruns = 0U;
+  // Underruns seen within kBoundaryWatchMs of a track change; a cold
+  // transition (output torn down and reopened) always counts one.
+  uint32_t boundaryUnderruns = 0U;
   char lastFailureReason[24] = "OK";
   char lastFallbackPath[24] = "NONE";
 };
@@ -131,6 +142,9 @@ class Mp3Player {
  private:
   static constexpr uint16_t kStateSaveDebounceMs = 1200;
   static constexpr uint8_t kScanDirStackMax = 24;
+  static constexpr uint32_t kPrerollLeadMs = 3000U;
+  static constexpr uint32_t kPrerollBufferBytes = 16U * 1024U;
+  static constexpr uint32_t kBoundaryWatchMs = 750U;
 
   bool mountStorage(uint32_t nowMs);
   void unmountStorage(uint32_t nowMs);
@@ -158,6 +172,18 @@ class Mp3Player {
   static bool parseJsonString(const String& json, const char* key, String* outValue);
   static bool parseJsonFloat(const String& json, const char* key, float* outValue);
 
+  uint16_t followingTrackIndex() const;
+  uint32_t legacyRemainingMs() const;
+  void updatePreroll();
+  bool startPreroll(uint16_t index);
+  void releasePreroll();
+  bool handoffLegacyPreroll(uint16_t index, uint32_t nowMs);
+  void onAudioToolsHandoff(uint32_t nowMs);
+  void onColdTransition(bool naturalEnd);
+  uint32_t totalUnderruns() const;
+  void beginBoundaryWatch(uint32_t nowMs, uint32_t underrunBase);
+  void updateBoundaryWatch(uint32_t nowMs, bool force);
+
   void startCurrentTrack();
   void stop();
 
@@ -187,11 +213,14 @@ class Mp3Player {
   struct ScanContext {
     bool active = false;
     bool limitReached = false;
+    bool fromIndex = false;
     uint8_t stackSize = 0U;
     uint8_t currentDepth = 0U;
     char stackPath[kScanDirStackMax][120] = {};
     uint8_t stackDepth[kScanDirStackMax] = {};
     fs::File currentDir;
+    char currentPath[120] = {};
+    CatalogFolderFingerprint fingerprint;
   } scanCtx_;
   AudioCodec activeCodec_ = AudioCodec::kUnknown;
   bool stateDirty_ = false;
@@ -211,5 +240,26 @@ class Mp3Player {
   Mp3FxEffect fxLastEffect_ = Mp3FxEffect::kFmSweep;
   AudioGenerator* decoder_ = nullptr;
   AudioFileSourceFS* mp3File_ = nullptr;
+  // Set when the source came from a pre-roll; the decoder then reads through it.
+  AudioFileSourceBuffer* mp3Buffer_ = nullptr;
   Mp3FxOverlayOutput* i2sOut_ = nullptr;
+
+  // Next track opened (and, for the legacy backend, read ahead into a buffer)
+  // during the last kPrerollLeadMs of the current one.
+  struct PrerollContext {
+    bool ready = false;
+    bool attempted = false;
+    uint16_t track = 0U;
+    PlayerBackendId backend = PlayerBackendId::kNone;
+    AudioCodec codec = AudioCodec::kUnknown;
+    char path[120] = {};
+    AudioFileSourceFS* file = nullptr;
+    AudioFileSourceBuffer* buffer = nullptr;
+    AudioGenerator* decoder = nullptr;
+  } preroll_;
+  uint32_t trackFramesBase_ = 0U;
+  uint32_t retiredUnderruns_ = 0U;
+  bool boundaryWatchActive_ = false;
+  uint32_t boundaryWatchUntilMs_ = 0U;
+  uint32_t boundaryUnderrunBase_ = 0U;
 };
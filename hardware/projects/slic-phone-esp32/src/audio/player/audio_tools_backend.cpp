@@ -16,6 +16,10 @@ using audio_tools::StreamCopy;
 using audio_tools::TX_MODE;
 using audio_tools::WAVDecoder;
 
+// setupI2s() always runs the stream as 44.1 kHz / 16-bit stereo.
+constexpr uint32_t kStreamRateHz = 44100U;
+constexpr uint32_t kStreamFrameBytes = 4U;
+
 bool endsWithIgnoreCase(const char* value, const char* suffix) {
   if (value == nullptr || suffix == nullptr) {
     return false;
@@ -62,6 +66,7 @@ bool AudioToolsBackend::start(const char* path, float gain) {
   if (!setupI2s()) {
     return false;
   }
+  underrun_.begin(kStreamRateHz, kStreamFrameBytes);
 
   auto* file = new fs::File();
   *file = SD_MMC.open(path, FILE_READ);
@@ -104,6 +109,7 @@ void AudioToolsBackend::update() {
 
   const size_t moved = copy->copy();
   if (moved > 0U) {
+    underrun_.onWrite(micros(), static_cast<uint32_t>(moved));
     idleLoops_ = 0U;
     return;
   }
@@ -114,14 +120,122 @@ void AudioToolsBackend::update() {
 
   ++idleLoops_;
   if (idleLoops_ > 2U) {
+    if (nextFile_ != nullptr && swapToPreload()) {
+      return;
+    }
     eof_ = true;
     stop();
   }
 }
 
+bool AudioToolsBackend::preload(const char* path) {
+  clearPreload();
+  if (!active_ || path == nullptr || path[0] == '\0' || !canHandlePath(path)) {
+    return false;
+  }
+  auto* file = new fs::File();
+  *file = SD_MMC.open(path, FILE_READ);
+  if (!(*file) || file->isDirectory()) {
+    delete file;
+    return false;
+  }
+  nextFile_ = file;
+  snprintf(nextPath_, sizeof(nextPath_), "%s", path);
+  return true;
+}
+
+void AudioToolsBackend::clearPreload() {
+  auto* next = static_cast<fs::File*>(nextFile_);
+  if (next != nullptr) {
+    if (*next) {
+      next->close();
+    }
+    delete next;
+    nextFile_ = nullptr;
+  }
+  nextPath_[0] = '\0';
+}
+
+bool AudioToolsBackend::hasPreload() const {
+  return nextFile_ != nullptr;
+}
+
+const char* AudioToolsBackend::preloadPath() const {
+  return nextPath_;
+}
+
+bool AudioToolsBackend::takeHandoff() {
+  const bool pending = handoffPending_;
+  handoffPending_ = false;
+  return pending;
+}
+
+uint32_t AudioToolsBackend::remainingMs() const {
+  auto* file = static_cast<fs::File*>(file_);
+  if (!active_ || file == nullptr || !(*file)) {
+    return 0U;
+  }
+  const uint32_t size = static_cast<uint32_t>(file->size());
+  const uint32_t pos = static_cast<uint32_t>(file->position());
+  const uint32_t remaining = (pos < size) ? (size - pos) : 0U;
+  return static_cast<uint32_t>((static_cast<uint64_t>(remaining) * 1000ULL) /
+                               (kStreamRateHz * kStreamFrameBytes));
+}
+
+uint32_t AudioToolsBackend::underrunCount() const {
+  return underrun_.underruns();
+}
+
+void AudioToolsBackend::resetUnderrunClock() {
+  underrun_.reset();
+}
+
+bool AudioToolsBackend::swapToPreload() {
+  // Tear down the per-file decoder chain only; the I2S stream keeps running.
+  auto* copy = static_cast<StreamCopy*>(copier_);
+  delete copy;
+  copier_ = nullptr;
+  auto* encoded = static_cast<EncodedAudioStream*>(encoded_);
+  if (encoded != nullptr) {
+    encoded->end();
+    delete encoded;
+    encoded_ = nullptr;
+  }
+  auto* decoder = static_cast<AudioDecoder*>(decoder_);
+  if (decoder != nullptr) {
+    decoder->end();
+    delete decoder;
+    decoder_ = nullptr;
+  }
+  auto* file = static_cast<fs::File*>(file_);
+  if (file != nullptr) {
+    if (*file) {
+      file->close();
+    }
+    delete file;
+  }
+
+  file_ = nextFile_;
+  nextFile_ = nullptr;
+  char path[sizeof(nextPath_)] = {};
+  snprintf(path, sizeof(path), "%s", nextPath_);
+  nextPath_[0] = '\0';
+  if (!setupDecoderForPath(path)) {
+    return false;
+  }
+  auto* fileStream = static_cast<fs::File*>(file_);
+  copier_ = new StreamCopy(*static_cast<EncodedAudioStream*>(encoded_), *fileStream);
+  idleLoops_ = 0U;
+  handoffPending_ = true;
+  return true;
+}
+
 void AudioToolsBackend::stop() {
   active_ = false;
   idleLoops_ = 0U;
+  handoffPending_ = false;
+  clearPreload();
+  underrun_.reset();
 
   auto* copy = static_cast<StreamCopy*>(copier_);
   if (copy != nullptr) {
@@ -2,6 +2,8 @@
 
 #include <Arduino.h>
 
+#include "i2s_underrun_estimator.h"
+
 class AudioToolsBackend {
  public:
   AudioToolsBackend(uint8_t i2sBclk, uint8_t i2sLrc, uint8_t i2sDout, uint8_t i2sPort);
@@ -10,6 +12,18 @@ class AudioToolsBackend {
   void update();
   void stop();
 
+  // Opens the next file ahead of time; when the current one ends, update()
+  // swaps decoders on the running I2S stream instead of stopping it.
+  bool preload(const char* path);
+  void clearPreload();
+  bool hasPreload() const;
+  const char* preloadPath() const;
+  // True once after update() performed a preloaded hand-off.
+  bool takeHandoff();
+  uint32_t remainingMs() const;
+  uint32_t underrunCount() const;
+  void resetUnderrunClock();
+
   bool isActive() const;
   bool canHandlePath(const char* path) const;
   const char* lastError() const;
@@ -20,6 +34,7 @@ class AudioToolsBackend {
  private:
   bool setupI2s();
   bool setupDecoderForPath(const char* path);
+  bool swapToPreload();
   void setLastError(const char* code);
 
   uint8_t i2sBclk_;
@@ -32,10 +47,14 @@ class AudioToolsBackend {
   bool eof_ = false;
   uint8_t idleLoops_ = 0U;
   char lastError_[24] = "OK";
+  bool handoffPending_ = false;
+  char nextPath_[120] = {};
+  I2sUnderrunEstimator underrun_;
 
   void* i2s_ = nullptr;
   void* decoder_ = nullptr;
   void* encoded_ = nullptr;
   void* copier_ = nullptr;
   void* file_ = nullptr;
+  void* nextFile_ = nullptr;
 };
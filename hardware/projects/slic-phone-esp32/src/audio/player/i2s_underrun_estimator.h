@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdint.h>
+
+// Producer-side I2S starvation estimate. Every write pushes a play-out deadline
+// forward by its duration; a write that lands after the deadline means the DMA
+// ring ran dry in between. Call reset() when output stops on purpose (pause,
+// teardown) so the next write starts a fresh stream instead of an underrun.
+class I2sUnderrunEstimator {
+ public:
+  static constexpr uint32_t kSlackUs = 1000U;
+
+  void begin(uint32_t sampleRateHz, uint32_t bytesPerFrame) {
+    sampleRateHz_ = sampleRateHz;
+    bytesPerFrame_ = (bytesPerFrame == 0U) ? 1U : bytesPerFrame;
+    reset();
+  }
+
+  void reset() {
+    running_ = false;
+    deadlineUs_ = 0U;
+    pendingBytes_ = 0U;
+  }
+
+  void onWrite(uint32_t nowUs, uint32_t bytes) {
+    if (bytes == 0U || sampleRateHz_ == 0U) {
+      return;
+    }
+    if (!running_) {
+      running_ = true;
+      deadlineUs_ = nowUs;
+    } else if (static_cast<int32_t>(nowUs - deadlineUs_) > static_cast<int32_t>(kSlackUs)) {
+      ++underruns_;
+      deadlineUs_ = nowUs;
+    }
+    pendingBytes_ += bytes;
+    const uint32_t frames = pendingBytes_ / bytesPerFrame_;
+    pendingBytes_ -= frames * bytesPerFrame_;
+    framesWritten_ += frames;
+    deadlineUs_ += static_cast<uint32_t>((static_cast<uint64_t>(frames) * 1000000ULL) / sampleRateHz_);
+  }
+
+  uint32_t underruns() const { return underruns_; }
+  uint32_t framesWritten() const { return framesWritten_; }
+  uint32_t sampleRateHz() const { return sampleRateHz_; }
+
+ private:
+  uint32_t sampleRateHz_ = 0U;
+  uint32_t bytesPerFrame_ = 4U;
+  uint32_t deadlineUs_ = 0U;
+  uint32_t pendingBytes_ = 0U;
+  uint32_t underruns_ = 0U;
+  uint32_t framesWritten_ = 0U;
+  bool running_ = false;
+};
@@ -122,6 +122,12 @@ void jsonStatusReply(Print& out, const StorySerialRuntimeContext& ctx, uint32_t
     data["scenario"] = snap.scenarioId != nullptr ? snap.scenarioId : "";
     data["step"] = snap.stepId != nullptr ? snap.stepId : "";
     data["scenario_from_fs"] = snap.scenarioFromLittleFs;
+    if (snap.scenarioFromLittleFs) {
+      JsonObject load = data.createNestedObject("scenario_load");
+      load["ms"] = snap.scenarioLoadMs;
+      load["peak_heap"] = snap.scenarioLoadPeakHeap;
+      load["arena_bytes"] = snap.scenarioArenaBytes;
+    }
     data["error"] = snap.lastError != nullptr ? snap.lastError : "";
   } else if (ctx.v2 != nullptr) {
     const auto snap = ctx.v2->snapshot(true, nowMs);
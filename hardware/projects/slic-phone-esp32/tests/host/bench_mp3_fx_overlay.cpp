@@ -0,0 +1,170 @@
+// Host benchmark: MP3 FX overlay, legacy per-sample path vs block path.
+// Build/run: make bench-fx-host
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "audio/effects/fx_block_synth.h"
+#include "audio/effects/fx_mix_q15.h"
+
+namespace {
+
+constexpr uint32_t kRateHz = 44100U;
+constexpr uint32_t kSeconds = 20U;
+constexpr size_t kBlock = 128U;
+constexpr float kTwoPi = 6.28318530718f;
+
+// Reference: the previous per-sample Mp3FxOverlayOutput FM/SONAR voices and
+// float ducking, kept verbatim enough to compare cost.
+struct LegacyOverlay {
+  uint32_t clock = 0U;
+  float fmA = 0.0f;
+  float fmB = 0.0f;
+  float lp = 0.0f;
+  float sonarPhase = 0.0f;
+  float echoPhase = 0.0f;
+  AudioEffectId effect = AudioEffectId::kFmSweep;
+
+  static float clampf(float v) { return v < -1.0f ? -1.0f : (v > 1.0f ? 1.0f : v); }
+
+  int16_t fm() {
+    const uint32_t period = (kRateHz * 2600UL) / 1000UL;
+    float t = static_cast<float>(clock % period) / static_cast<float>(period);
+    if (((clock / period) & 1U) != 0U) {
+      t = 1.0f - t;
+    }
+    const bool st = (t > 0.20f && t < 0.34f) || (t > 0.58f && t < 0.74f);
+    const float sweepHz = st ? (240.0f + 130.0f * sinf(kTwoPi * t * 2.0f)) : (95.0f + 1300.0f * t);
+    const float carrierHz = st ? (560.0f + 120.0f * sinf(fmB)) : (760.0f + 280.0f * sinf(fmB));
+    fmA += kTwoPi * (sweepHz / static_cast<float>(kRateHz));
+    if (fmA >= kTwoPi) {
+      fmA -= kTwoPi;
+    }
+    fmB += kTwoPi * (carrierHz / static_cast<float>(kRateHz));
+    if (fmB >= kTwoPi) {
+      fmB -= kTwoPi;
+    }
+    const float raw = static_cast<float>((rand() % 256) - 128) / 128.0f;
+    lp = 0.985f * lp + 0.015f * raw;
+    const float hiss = raw - lp;
+    float s = (st ? 0.28f : 0.45f) * sinf(fmA);
+    s += (st ? 0.20f : 0.15f) * sinf(fmB);
+    s += (st ? 0.16f : 0.32f) * hiss;
+    return static_cast<int16_t>(clampf(s) * 28000.0f);
+  }
+
+  int16_t sonar() {
+    const uint32_t period = (kRateHz * 1200UL) / 1000UL;
+    const uint32_t ping = (kRateHz * 130UL) / 1000UL;
+    const uint32_t echoStart = (kRateHz * 200UL) / 1000UL;
+    const uint32_t echoLen = (kRateHz * 420UL) / 1000UL;
+    const uint32_t cycle = clock % period;
+    float s = 0.0f;
+    if (cycle < ping) {
+      const float pt = static_cast<float>(cycle) / static_cast<float>(ping);
+      sonarPhase += kTwoPi * ((1800.0f - 1300.0f * pt) / static_cast<float>(kRateHz));
+      if (sonarPhase >= kTwoPi) {
+        sonarPhase -= kTwoPi;
+      }
+      s += 0.92f * sinf(sonarPhase) * (1.0f - pt) * (1.0f - pt);
+    }
+    if (cycle >= echoStart && cycle < echoStart + echoLen) {
+      const float et = static_cast<float>(cycle - echoStart) / static_cast<float>(echoLen);
+      echoPhase += kTwoPi * ((680.0f - 220.0f * et) / static_cast<float>(kRateHz));
+      if (echoPhase >= kTwoPi) {
+        echoPhase -= kTwoPi;
+      }
+      s += 0.46f * sinf(echoPhase) * expf(-4.0f * et);
+    }
+    return static_cast<int16_t>(clampf(s) * 30000.0f);
+  }
+
+  void consume(int16_t sample[2], float duck, float overlay) {
+    int32_t l = static_cast<int32_t>(static_cast<float>(sample[0]) * duck);
+    int32_t r = static_cast<int32_t>(static_cast<float>(sample[1]) * duck);
+    const int16_t fx = (effect == AudioEffectId::kSonar) ? sonar() : fm();
+    ++clock;
+    const int32_t mixed = static_cast<int32_t>(static_cast<float>(fx) * overlay);
+    l += mixed;
+    r += mixed;
+    sample[0] = static_cast<int16_t>(l > 32767 ? 32767 : (l < -32767 ? -32767 : l));
+    sample[1] = static_cast<int16_t>(r > 32767 ? 32767 : (r < -32767 ? -32767 : r));
+  }
+};
+
+std::vector<int16_t> makeMusic(size_t frames) {
+  std::vector<int16_t> pcm(frames * 2U);
+  for (size_t i = 0U; i < frames; ++i) {
+    const float t = static_cast<float>(i) / static_cast<float>(kRateHz);
+    pcm[i * 2U] = static_cast<int16_t>(9000.0f * sinf(kTwoPi * 220.0f * t));
+    pcm[i * 2U + 1U] = static_cast<int16_t>(9000.0f * sinf(kTwoPi * 330.0f * t));
+  }
+  return pcm;
+}
+
+double nsPerSecond(std::chrono::steady_clock::duration d) {
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()) /
+         static_cast<double>(kSeconds);
+}
+
+uint64_t checksum(const std::vector<int16_t>& pcm) {
+  uint64_t acc = 0U;
+  for (const int16_t s : pcm) {
+    acc += static_cast<uint64_t>(static_cast<int64_t>(s) * s);
+  }
+  return acc;
+}
+
+void benchEffect(AudioEffectId effect, const char* label) {
+  const size_t frames = static_cast<size_t>(kRateHz) * kSeconds;
+  const std::vector<int16_t> music = makeMusic(frames);
+
+  std::vector<int16_t> legacyOut = music;
+  LegacyOverlay legacy;
+  legacy.effect = effect;
+  const auto t0 = std::chrono::steady_clock::now();
+  for (size_t i = 0U; i < frames; ++i) {
+    legacy.consume(&legacyOut[i * 2U], 0.45f, 0.42f);
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+
+  std::vector<int16_t> blockOut = music;
+  FxBlockSynth synth;
+  synth.reset(effect, kRateHz, kFxProfileMp3Overlay, 1234U);
+  int16_t fx[kBlock] = {};
+  const int16_t duckQ15 = fx_gain_to_q15(0.45f);
+  const int16_t overlayQ15 = fx_gain_to_q15(0.42f);
+  const auto t2 = std::chrono::steady_clock::now();
+  for (size_t pos = 0U; pos < frames; pos += kBlock) {
+    const size_t n = (frames - pos < kBlock) ? (frames - pos) : kBlock;
+    synth.render(fx, n);
+    fx_s16_duck_mix_q15(&blockOut[pos * 2U], fx, n, duckQ15, overlayQ15);
+  }
+  const auto t3 = std::chrono::steady_clock::now();
+
+  const double legacyNs = nsPerSecond(t1 - t0);
+  const double blockNs = nsPerSecond(t3 - t2);
+  const double energyRatio =
+      static_cast<double>(checksum(blockOut)) / static_cast<double>(checksum(legacyOut) + 1U);
+  std::printf("%-6s legacy=%9.0f ns/s  block=%9.0f ns/s  speedup=%5.2fx  energy_ratio=%.3f\n",
+              label,
+              legacyNs,
+              blockNs,
+              (blockNs > 0.0) ? (legacyNs / blockNs) : 0.0,
+              energyRatio);
+}
+
+}  // namespace
+
+int main() {
+  std::printf("MP3 FX overlay benchmark: %u Hz stereo, %u s decoded, block=%u frames\n",
+              static_cast<unsigned>(kRateHz),
+              static_cast<unsigned>(kSeconds),
+              static_cast<unsigned>(kBlock));
+  benchEffect(AudioEffectId::kFmSweep, "FM");
+  benchEffect(AudioEffectId::kSonar, "SONAR");
+  return 0;
+}
@@ -125,11 +125,21 @@ run_checks() {
     c++ -std=c++17 -Wall -Wextra -pedantic -Isrc test/host/test_dtmf_host.cpp src/telephony/DtmfDecoder.cpp -o .pio/host/test_dtmf_host
     .pio/host/test_dtmf_host
 
+    log "tests host resampler polyphase"
+    python3 scripts/gen_resampler_tables.py --check
+    c++ -std=c++17 -O2 -Wall -Wextra -pedantic -Isrc test/host/test_polyphase_resampler_host.cpp src/audio/PolyphaseResampler.cpp src/audio/PolyphaseResamplerTables.cpp -o .pio/host/test_polyphase_resampler_host
+    .pio/host/test_polyphase_resampler_host
+
+    log "tests host command dispatcher"
+    c++ -std=c++17 -O2 -Wall -Wextra -pedantic -Isrc -Itest/host/shim test/host/test_command_dispatcher_host.cpp src/core/CommandDispatcher.cpp -o .pio/host/test_command_dispatcher_host
+    .pio/host/test_command_dispatcher_host
+
     log "tests contrat parity/runtime/hw_validation"
     python3 -m unittest \
         scripts/test_check_web_route_parity.py \
         scripts/test_runtime_contracts.py \
-        scripts/test_hw_validation_contracts.py
+        scripts/test_hw_validation_contracts.py \
+        scripts/test_build_loudness_index.py
 
     log "contrôle route/command parity avec rapport JSON"
     mkdir -p "$(dirname "${REPORT_JSON}")"
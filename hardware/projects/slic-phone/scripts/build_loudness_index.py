@@ -0,0 +1,378 @@
+#!/usr/bin/env python3
+"""Build per-directory loudness sidecars (.loudness.idx) for WAV/MP3 media.
+
+Each asset is measured offline (ITU-R BS.1770 / EBU R128 integrated loudness
+with K-weighting and gating, plus 4x oversampled true peak). Results are
+written next to the media as a small open-addressing hash table that
+AudioEngine reads in O(1) at playback start (see src/audio/LoudnessIndex.h).
+MP3 decoding needs ffmpeg in PATH; WAV PCM is read directly.
+"""
+
+from __future__ import annotations
+
+import argparse
+import io
+import math
+import shutil
+import struct
+import subprocess
+import sys
+import wave
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Dict, List, Optional, Sequence, Tuple
+
+SIDECAR_NAME = ".loudness.idx"
+MAGIC = b"ZLDX"
+VERSION = 1
+HEADER_BYTES = 16
+BUCKET_BYTES = 16
+# Must match LoudnessIndex::kMaxProbes on the device.
+MAX_PROBES = 8
+MIN_BUCKETS = 8
+DEFAULT_EXTENSIONS = (".wav", ".mp3")
+
+ABSOLUTE_GATE_LUFS = -70.0
+RELATIVE_GATE_LU = -10.0
+BLOCK_S = 0.400
+STEP_S = 0.100
+SILENCE_LUFS = -70.0
+TRUE_PEAK_OVERSAMPLE = 4
+TRUE_PEAK_HALF_TAPS = 12
+
+
+@dataclass
+class Measurement:
+    integrated_lufs: float
+    true_peak_dbtp: float
+    sample_rate: int
+    channels: int
+    frames: int
+
+
+def fnv1a32(name: str) -> int:
+    value = 2166136261
+    for byte in name.encode("utf-8"):
+        value ^= byte
+        value = (value * 16777619) & 0xFFFFFFFF
+    # 0 marks an empty bucket.
+    return value or 1
+
+
+def _biquad(samples: Sequence[float], b: Tuple[float, float, float], a: Tuple[float, float]) -> List[float]:
+    b0, b1, b2 = b
+    a1, a2 = a
+    x1 = x2 = y1 = y2 = 0.0
+    out: List[float] = []
+    append = out.append
+    for x in samples:
+        y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2
+        x2, x1 = x1, x
+        y2, y1 = y1, y
+        append(y)
+    return out
+
+
+def k_weight(samples: Sequence[float], sample_rate: int) -> List[float]:
+    # BS.1770 pre-filter (high shelf) and RLB high-pass, re-derived for any rate.
+    f0 = 1681.974450955533
+    gain_db = 3.999843853973347
+    q = 0.7071752369554196
+    k = math.tan(math.pi * f0 / sample_rate)
+    vh = 10.0 ** (gain_db / 20.0)
+    vb = vh ** 0.4996667741545416
+    a0 = 1.0 + k / q + k * k
+    shelf_b = ((vh + vb * k / q + k * k) / a0, 2.0 * (k * k - vh) / a0, (vh - vb * k / q + k * k) / a0)
+    shelf_a = (2.0 * (k * k - 1.0) / a0, (1.0 - k / q + k * k) / a0)
+
+    f0 = 38.13547087602444
+    q = 0.5003270373238773
+    k = math.tan(math.pi * f0 / sample_rate)
+    a0 = 1.0 + k / q + k * k
+    hp_b = (1.0, -2.0, 1.0)
+    hp_a = (2.0 * (k * k - 1.0) / a0, (1.0 - k / q + k * k) / a0)
+    return _biquad(_biquad(samples, shelf_b, shelf_a), hp_b, hp_a)
+
+
+def integrated_loudness(channels: Sequence[Sequence[float]], sample_rate: int) -> float:
+    if not channels or not channels[0]:
+        return SILENCE_LUFS
+    weighted = [k_weight(ch, sample_rate) for ch in channels]
+    frames = len(weighted[0])
+    block = max(1, int(round(BLOCK_S * sample_rate)))
+    step = max(1, int(round(STEP_S * sample_rate)))
+    if frames < block:
+        block = frames
+        step = frames
+
+    # Prefix sums of squares make every 400 ms block O(1).
+    prefix: List[List[float]] = []
+    for ch in weighted:
+        acc = 0.0
+        sums = [0.0]
+        for v in ch:
+            acc += v * v
+            sums.append(acc)
+        prefix.append(sums)
+
+    powers: List[float] = []
+    for start in range(0, frames - block + 1, step):
+        end = start + block
+        power = sum((sums[end] - sums[start]) / block for sums in prefix)
+        powers.append(power)
+
+    def to_lufs(power: float) -> float:
+        return -0.691 + 10.0 * math.log10(power) if power > 0.0 else -math.inf
+
+    gated = [p for p in powers if to_lufs(p) > ABSOLUTE_GATE_LUFS]
+    if not gated:
+        return SILENCE_LUFS
+    relative_gate = to_lufs(sum(gated) / len(gated)) + RELATIVE_GATE_LU
+    gated = [p for p in gated if to_lufs(p) > relative_gate]
+    if not gated:
+        return SILENCE_LUFS
+    return max(SILENCE_LUFS, to_lufs(sum(gated) / len(gated)))
+
+
+def _oversample_kernel() -> List[List[float]]:
+    # Hann-windowed sinc, one row of 2 * HALF_TAPS coefficients per fractional phase.
+    phases: List[List[float]] = []
+    span = TRUE_PEAK_HALF_TAPS
+    for phase in range(1, TRUE_PEAK_OVERSAMPLE):
+        frac = phase / TRUE_PEAK_OVERSAMPLE
+        row: List[float] = []
+        for tap in range(-span + 1, span + 1):
+            t = tap - frac
+            sinc = 1.0 if t == 0.0 else math.sin(math.pi * t) / (math.pi * t)
+            window = 0.5 + 0.5 * math.cos(math.pi * t / span)
+            row.append(sinc * window)
+        phases.append(row)
+    return phases
+
+
+_KERNEL = _oversample_kernel()
+
+
+def true_peak(channels: Sequence[Sequence[float]]) -> float:
+    sample_peak = 0.0
+    for ch in channels:
+        for v in ch:
+            if abs(v) > sample_peak:
+                sample_peak = abs(v)
+    if sample_peak <= 0.0:
+        return -math.inf
+
+    # Inter-sample overs only occur next to large samples, so only those
+    # neighbourhoods are interpolated.
+    threshold = 0.5 * sample_peak
+    span = TRUE_PEAK_HALF_TAPS
+    peak = sample_peak
+    for ch in channels:
+        n = len(ch)
+        for i in range(n - 1):
+            if abs(ch[i]) < threshold and abs(ch[i + 1]) < threshold:
+                continue
+            lo = i - span + 1
+            window = [ch[j] if 0 <= j < n else 0.0 for j in range(lo, i + span + 1)]
+            # window[k] is sample i - span + 1 + k, which lines up with row[k].
+            for row in _KERNEL:
+                acc = 0.0
+                for coeff, value in zip(row, window):
+                    acc += coeff * value
+                if abs(acc) > peak:
+                    peak = abs(acc)
+    return 20.0 * math.log10(peak)
+
+
+def _decode_wav_bytes(raw: bytes) -> Tuple[List[List[float]], int]:
+    with wave.open(io.BytesIO(raw), "rb") as wav:
+        channels = wav.getnchannels()
+        width = wav.getsampwidth()
+        rate = wav.getframerate()
+        data = wav.readframes(wav.getnframes())
+    frame_bytes = width * channels
+    frames = len(data) // frame_bytes
+    out: List[List[float]] = [[0.0] * frames for _ in range(channels)]
+    if width == 1:
+        scale = 1.0 / 128.0
+        for i in range(frames):
+            for c in range(channels):
+                out[c][i] = (data[i * frame_bytes + c] - 128) * scale
+    elif width == 2:
+        values = struct.unpack("<%dh" % (frames * channels), data[: frames * frame_bytes])
+        scale = 1.0 / 32768.0
+        for c in range(channels):
+            out[c] = [v * scale for v in values[c::channels]]
+    elif width in (3, 4):
+        scale = 1.0 / float(1 << (8 * width - 1))
+        for i in range(frames):
+            for c in range(channels):
+                off = i * frame_bytes + c * width
+                out[c][i] = int.from_bytes(data[off : off + width], "little", signed=True) * scale
+    else:
+        raise ValueError(f"unsupported sample width {width}")
+    return out, rate
+
+
+def decode_audio(path: Path) -> Tuple[List[List[float]], int]:
+    if path.suffix.lower() == ".wav":
+        try:
+            return _decode_wav_bytes(path.read_bytes())
+        except (wave.Error, ValueError, EOFError):
+            pass  # float/extensible WAV: let ffmpeg convert it.
+    if shutil.which("ffmpeg") is None:
+        raise RuntimeError("ffmpeg not found in PATH (required for MP3 and non-PCM WAV)")
+    result = subprocess.run(
+        ["ffmpeg", "-v", "error", "-i", str(path), "-acodec", "pcm_s16le", "-f", "wav", "pipe:1"],
+        check=True,
+        capture_output=True,
+    )
+    return _decode_wav_bytes(result.stdout)
+
+
+def measure(path: Path) -> Measurement:
+    channels, rate = decode_audio(path)
+    frames = len(channels[0]) if channels else 0
+    return Measurement(
+        integrated_lufs=integrated_loudness(channels, rate),
+        true_peak_dbtp=true_peak(channels),
+        sample_rate=rate,
+        channels=len(channels),
+        frames=frames,
+    )
+
+
+def _centi(value: float) -> int:
+    if math.isinf(value) or math.isnan(value):
+        value = SILENCE_LUFS if value < 0 else 0.0
+    return max(-32768, min(32767, int(round(value * 100.0))))
+
+
+def build_table(entries: Dict[str, Tuple[int, Measurement]]) -> bytes:
+    bucket_count = MIN_BUCKETS
+    while bucket_count < 2 * len(entries):
+        bucket_count *= 2
+
+    while True:
+        slots: List[Optional[Tuple[int, int, Measurement]]] = [None] * bucket_count
+        placed = True
+        for name in sorted(entries):
+            size, meas = entries[name]
+            key = fnv1a32(name)
+            home = key & (bucket_count - 1)
+            for probe in range(MAX_PROBES):
+                slot = (home + probe) & (bucket_count - 1)
+                if slots[slot] is None:
+                    slots[slot] = (key, size, meas)
+                    break
+            else:
+                placed = False
+                break
+        if placed:
+            break
+        bucket_count *= 2
+        if bucket_count > 0x8000:
+            raise RuntimeError("loudness index too large")
+
+    out = bytearray(MAGIC)
+    out += struct.pack("<HHII", VERSION, bucket_count, len(entries), 0)
+    for slot in slots:
+        if slot is None:
+            out += bytes(BUCKET_BYTES)
+            continue
+        key, size, meas = slot
+        out += struct.pack("<IIhhI", key, size, _centi(meas.integrated_lufs), _centi(meas.true_peak_dbtp), 0)
+    return bytes(out)
+
+
+def parse_table(raw: bytes) -> Dict[int, Tuple[int, float, float]]:
+    if len(raw) < HEADER_BYTES or raw[:4] != MAGIC:
+        raise ValueError("not a loudness index")
+    version, bucket_count, _count, _reserved = struct.unpack_from("<HHII", raw, 4)
+    if version != VERSION:
+        raise ValueError(f"unsupported loudness index version {version}")
+    out: Dict[int, Tuple[int, float, float]] = {}
+    for slot in range(bucket_count):
+        key, size, lufs, tp, _ = struct.unpack_from("<IIhhI", raw, HEADER_BYTES + slot * BUCKET_BYTES)
+        if key:
+            out[key] = (size, lufs / 100.0, tp / 100.0)
+    return out
+
+
+def lookup(raw: bytes, name: str, size: int) -> Optional[Tuple[float, float]]:
+    """Mirror of LoudnessIndex::lookup, used by the tests."""
+    if len(raw) < HEADER_BYTES or raw[:4] != MAGIC:
+        return None
+    _version, bucket_count, _count, _reserved = struct.unpack_from("<HHII", raw, 4)
+    key = fnv1a32(name)
+    slot = key & (bucket_count - 1)
+    for _ in range(min(MAX_PROBES, bucket_count)):
+        bucket_key, bucket_size, lufs, tp, _ = struct.unpack_from("<IIhhI", raw, HEADER_BYTES + slot * BUCKET_BYTES)
+        if bucket_key == 0:
+            return None
+        if bucket_key == key and bucket_size == size:
+            return lufs / 100.0, tp / 100.0
+        slot = (slot + 1) & (bucket_count - 1)
+    return None
+
+
+def index_directory(directory: Path, root: Path, extensions: Sequence[str], dry_run: bool) -> int:
+    media = sorted(p for p in directory.iterdir() if p.is_file() and p.suffix.lower() in extensions)
+    if not media:
+        return 0
+
+    entries: Dict[str, Tuple[int, Measurement]] = {}
+    seen: Dict[int, str] = {}
+    for path in media:
+        key = fnv1a32(path.name)
+        if key in seen:
+            print(f"[loudness] warning: hash collision {seen[key]} / {path.name}, skipping {path.name}")
+            continue
+        try:
+            meas = measure(path)
+        except (RuntimeError, subprocess.CalledProcessError, wave.Error, ValueError) as exc:
+            print(f"[loudness] warning: {path}: {exc}")
+            continue
+        seen[key] = path.name
+        entries[path.name] = (path.stat().st_size, meas)
+        print(
+            f"[loudness] {path.relative_to(root)}: "
+            f"{meas.integrated_lufs:6.2f} LUFS  {meas.true_peak_dbtp:6.2f} dBTP  "
+            f"({meas.sample_rate} Hz, {meas.channels} ch)"
+        )
+
+    if not entries:
+        return 0
+    table = build_table(entries)
+    if not dry_run:
+        (directory / SIDECAR_NAME).write_bytes(table)
+    return len(entries)
+
+
+def main(argv: Optional[Sequence[str]] = None) -> int:
+    parser = argparse.ArgumentParser(description="Build .loudness.idx sidecars for audio assets")
+    parser.add_argument("root", nargs="?", default="data", help="media root directory (default: data)")
+    parser.add_argument(
+        "--ext",
+        default=",".join(DEFAULT_EXTENSIONS),
+        help="comma-separated file extensions to analyze (default: .wav,.mp3)",
+    )
+    parser.add_argument("--dry-run", action="store_true", help="measure only, do not write sidecars")
+    args = parser.parse_args(argv)
+
+    root = Path(args.root).resolve()
+    if not root.is_dir():
+        print(f"[loudness] media root not found: {root}", file=sys.stderr)
+        return 1
+
+    extensions = tuple(item.strip().lower() for item in args.ext.split(",") if item.strip())
+    directories = [root] + sorted(p for p in root.rglob("*") if p.is_dir())
+    total = 0
+    for directory in directories:
+        total += index_directory(directory, root, extensions, args.dry_run)
+    print(f"[loudness] {total} asset(s) indexed under {root}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -32,6 +32,8 @@ BACKEND_DISPATCH_DYNAMIC_RE = re.compile(
     r'handleDispatch\(\s*request\s*,\s*[A-Za-z_][A-Za-z0-9_]*'
 )
 COMMAND_REG_RE = re.compile(r'registerCommand\(\s*"(?P<command>[A-Z0-9_]+)"')
+STATIC_TABLE_RE = re.compile(r"StaticCommand\s+\w+\[\]\s*=\s*\{")
+STATIC_ENTRY_RE = re.compile(r'\{\s*"(?P<command>[A-Z0-9_]+)"\s*,')
 FRONTEND_CALL_START_RE = re.compile(r"\brequestJson\(")
 FRONTEND_PATH_ARG_RE = re.compile(r"^\s*([\"'])(?P<path>/api/[^\"']+)\1")
 METHOD_RE = re.compile(r"method\s*:\s*[\"'](?P<method>[A-Z]+)[\"']")
@@ -158,7 +160,15 @@ def parse_frontend_routes(source: str) -> set[Route]:
 
 
 def parse_registered_commands(source: str) -> set[str]:
-    return {match.group("command") for match in COMMAND_REG_RE.finditer(source)}
+    commands = {match.group("command") for match in COMMAND_REG_RE.finditer(source)}
+    for table in STATIC_TABLE_RE.finditer(source):
+        open_index = table.end() - 1
+        close_index = find_matching_delim(source, open_index, "{", "}")
+        if close_index < 0:
+            continue
+        body = source[open_index + 1 : close_index]
+        commands.update(match.group("command") for match in STATIC_ENTRY_RE.finditer(body))
+    return commands
 
 
 def format_routes(routes: Iterable[Route]) -> str:
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""Generate the Q15 polyphase filter banks used by PolyphaseResampler.
+
+Every ordered pair of the media/codec rates (8000, 16000, 22050, 24000,
+44100, 48000 Hz) is reduced to L/M and designed offline with the same Kaiser
+sinc, per-phase DC normalisation and Q15 rounding as the runtime fallback in
+src/audio/PolyphaseResampler.cpp, so configure() only has to point at a const
+table in flash. Other ratios are still designed on the device.
+
+Usage:
+  scripts/gen_resampler_tables.py          # rewrite the generated source
+  scripts/gen_resampler_tables.py --check  # exit 1 when it is out of date
+"""
+
+from __future__ import annotations
+
+import argparse
+import math
+import sys
+from pathlib import Path
+from typing import List, Tuple
+
+RATES_HZ = (8000, 16000, 22050, 24000, 44100, 48000)
+# Must match PolyphaseResampler (header constants and buildBank()).
+MIN_TAPS_PER_PHASE = 16
+MAX_TAPS_PER_PHASE = 64
+MAX_PHASES = 480
+PASSBAND_RATIO = 0.90
+KAISER_BETA = 8.6
+
+OUTPUT = Path(__file__).resolve().parent.parent / "src" / "audio" / "PolyphaseResamplerTables.cpp"
+VALUES_PER_LINE = 12
+
+
+def reduce_ratio(in_hz: int, out_hz: int) -> Tuple[int, int]:
+    g = math.gcd(in_hz, out_hz)
+    return out_hz // g, in_hz // g
+
+
+def taps_for(up: int, down: int) -> int:
+    taps = MIN_TAPS_PER_PHASE
+    if down > up:
+        taps = (MIN_TAPS_PER_PHASE * down + up - 1) // up
+    taps = (taps + 3) & ~3
+    return min(taps, MAX_TAPS_PER_PHASE)
+
+
+def bessel_i0(x: float) -> float:
+    total = 1.0
+    term = 1.0
+    half = x * 0.5
+    for k in range(1, 32):
+        term *= (half / k) * (half / k)
+        total += term
+        if term < total * 1.0e-12:
+            break
+    return total
+
+
+def round_half_away(value: float) -> int:
+    return int(math.copysign(math.floor(abs(value) + 0.5), value))
+
+
+def design_bank(up: int, down: int, taps: int) -> List[int]:
+    total = up * taps
+    narrow = min(up, down)
+    cutoff = (0.5 * PASSBAND_RATIO * narrow) / (up * down)
+    center = (total - 1.0) * 0.5
+    i0_beta = bessel_i0(KAISER_BETA)
+    proto = []
+    for n in range(total):
+        t = n - center
+        x = 2.0 * cutoff * t
+        sinc = 1.0 if abs(x) < 1.0e-12 else math.sin(math.pi * x) / (math.pi * x)
+        ratio = t / center if center > 0.0 else 0.0
+        window = bessel_i0(KAISER_BETA * math.sqrt(max(0.0, 1.0 - ratio * ratio))) / i0_beta
+        proto.append(2.0 * cutoff * sinc * window)
+
+    bank = []
+    for p in range(up):
+        phase = [proto[k * up + p] for k in range(taps)]
+        total_gain = sum(phase)
+        scale = 1.0 / total_gain if abs(total_gain) > 1.0e-9 else 0.0
+        for coeff in phase:
+            bank.append(max(-32768, min(32767, round_half_away(coeff * scale * 32768.0))))
+    return bank
+
+
+def render() -> str:
+    banks = {}
+    for in_hz in RATES_HZ:
+        for out_hz in RATES_HZ:
+            up, down = reduce_ratio(in_hz, out_hz)
+            if up > MAX_PHASES:
+                continue
+            key = (up, down, taps_for(up, down))
+            banks.setdefault(key, []).append((in_hz, out_hz))
+
+    lines = [
+        "// Generated by scripts/gen_resampler_tables.py; do not edit.",
+        "// Q15 polyphase banks (phase-major, taps per phase) for every pair of",
+        "// " + "/".join(str(rate) for rate in RATES_HZ) + " Hz.",
+        '#include "audio/PolyphaseResamplerTables.h"',
+        "",
+        "namespace {",
+        "",
+    ]
+    entries = []
+    total_values = 0
+    for (up, down, taps), pairs in sorted(banks.items()):
+        name = f"kBank{up}x{down}x{taps}"
+        values = design_bank(up, down, taps)
+        total_values += len(values)
+        pair_text = ", ".join(f"{a}->{b}" for a, b in pairs)
+        lines.append(f"// L/M={up}/{down}, {taps} taps: {pair_text}")
+        lines.append(f"const int16_t {name}[{len(values)}] = {{")
+        for start in range(0, len(values), VALUES_PER_LINE):
+            chunk = values[start:start + VALUES_PER_LINE]
+            lines.append("    " + ", ".join(str(v) for v in chunk) + ",")
+        lines.append("};")
+        lines.append("")
+        entries.append(f"    {{{up}U, {down}U, {taps}U, {name}}},")
+
+    lines.append("}  // namespace")
+    lines.append("")
+    lines.append(f"// {len(entries)} banks, {total_values * 2} bytes.")
+    lines.append("const PolyphaseBankTable kPolyphaseBankTables[] = {")
+    lines.extend(entries)
+    lines.append("};")
+    lines.append("")
+    lines.append("const size_t kPolyphaseBankTableCount = sizeof(kPolyphaseBankTables) / sizeof(kPolyphaseBankTables[0]);")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def main(argv: List[str]) -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--check", action="store_true", help="fail when the generated source is out of date")
+    args = parser.parse_args(argv)
+
+    text = render()
+    if args.check:
+        current = OUTPUT.read_text(encoding="utf-8") if OUTPUT.exists() else ""
+        if current != text:
+            print(f"{OUTPUT} is out of date; run scripts/gen_resampler_tables.py", file=sys.stderr)
+            return 1
+        return 0
+    OUTPUT.write_text(text, encoding="utf-8")
+    print(f"wrote {OUTPUT}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -68,7 +68,11 @@ def main() -> int:
     parser.add_argument("--baud", type=int, default=115200)
     parser.add_argument("--root", default="data/audio", help="local media root directory")
     parser.add_argument("--chunk-bytes", type=int, default=48, help="raw bytes per base64 serial frame")
-    parser.add_argument("--ext", default=".wav", help="comma-separated file extensions to provision (default: .wav)")
+    parser.add_argument(
+        "--ext",
+        default=".wav,.idx",
+        help="comma-separated file extensions to provision (default: .wav,.idx for loudness sidecars)",
+    )
     args = parser.parse_args()
 
     root = Path(args.root).resolve()
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Unit tests for the offline loudness sidecar builder."""
+
+from __future__ import annotations
+
+import math
+import struct
+import tempfile
+import unittest
+import wave
+from pathlib import Path
+
+from scripts.build_loudness_index import (
+    Measurement,
+    SIDECAR_NAME,
+    build_table,
+    fnv1a32,
+    index_directory,
+    integrated_loudness,
+    lookup,
+    parse_table,
+    true_peak,
+)
+
+
+def sine(freq_hz: float, amplitude: float, rate: int, seconds: float, phase: float = 0.0) -> list[float]:
+    count = int(rate * seconds)
+    return [amplitude * math.sin(2.0 * math.pi * freq_hz * i / rate + phase) for i in range(count)]
+
+
+def write_wav(path: Path, samples: list[float], rate: int) -> None:
+    with wave.open(str(path), "wb") as wav:
+        wav.setnchannels(1)
+        wav.setsampwidth(2)
+        wav.setframerate(rate)
+        wav.writeframes(struct.pack("<%dh" % len(samples), *(int(round(v * 32767.0)) for v in samples)))
+
+
+class LoudnessMeasurementTest(unittest.TestCase):
+    def test_reference_tone_matches_bs1770(self) -> None:
+        # A 997 Hz sine at -20 dBFS on one channel reads -23.0 LUFS.
+        tone = sine(997.0, 10.0 ** (-20.0 / 20.0), 48000, 3.0)
+        self.assertAlmostEqual(integrated_loudness([tone], 48000), -23.0, delta=0.1)
+
+    def test_other_rates_agree(self) -> None:
+        for rate in (8000, 16000, 22050, 44100):
+            tone = sine(997.0, 10.0 ** (-20.0 / 20.0), rate, 2.0)
+            self.assertAlmostEqual(integrated_loudness([tone], rate), -23.0, delta=0.3, msg=str(rate))
+
+    def test_silence_is_gated(self) -> None:
+        self.assertEqual(integrated_loudness([[0.0] * 16000], 16000), -70.0)
+
+    def test_true_peak_sees_intersample_overs(self) -> None:
+        # fs/4 tone at 45 degrees: every sample sits at 0.707 of the real peak.
+        tone = sine(12000.0, 0.5, 48000, 0.5, phase=math.pi / 4.0)
+        sample_peak_db = 20.0 * math.log10(max(abs(v) for v in tone))
+        self.assertAlmostEqual(true_peak([tone]) - sample_peak_db, 3.0, delta=0.3)
+
+
+class LoudnessTableTest(unittest.TestCase):
+    def test_every_entry_is_found_within_probe_limit(self) -> None:
+        meas = Measurement(-18.5, -1.25, 16000, 1, 16000)
+        entries = {f"prompt_{i:03d}.wav": (1000 + i, meas) for i in range(150)}
+        raw = build_table(entries)
+        self.assertEqual(len(parse_table(raw)), 150)
+        for name, (size, _) in entries.items():
+            self.assertEqual(lookup(raw, name, size), (-18.5, -1.25))
+        self.assertIsNone(lookup(raw, "prompt_000.wav", 999))
+        self.assertIsNone(lookup(raw, "missing.wav", 1000))
+
+    def test_hash_matches_device_fnv1a(self) -> None:
+        self.assertEqual(fnv1a32(""), 2166136261)
+        self.assertEqual(fnv1a32("a"), 0xE40C292C)
+
+    def test_directory_sidecar_written(self) -> None:
+        with tempfile.TemporaryDirectory() as tmp:
+            root = Path(tmp)
+            write_wav(root / "tone.wav", sine(997.0, 0.1, 16000, 1.0), 16000)
+            self.assertEqual(index_directory(root, root, (".wav",), dry_run=False), 1)
+            raw = (root / SIDECAR_NAME).read_bytes()
+            hit = lookup(raw, "tone.wav", (root / "tone.wav").stat().st_size)
+            self.assertIsNotNone(hit)
+            assert hit is not None
+            self.assertAlmostEqual(hit[0], -23.0, delta=0.3)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -81,6 +81,17 @@ class BackendParsingTest(unittest.TestCase):
         commands = parse_registered_commands(source)
         self.assertEqual(commands, {"WIFI_CONNECT", "PLAY"})
 
+    def test_static_command_table_detection(self) -> None:
+        source = """
+        const CommandDispatcher::StaticCommand kStaticCommands[] = {
+            {"AMP_OFF", cmdAmpOff},
+            {"VOLUME_GET", cmdVolumeGet},
+        };
+        g_dispatcher.registerCommand("PLAY", [](const String&) {});
+        """
+        commands = parse_registered_commands(source)
+        self.assertEqual(commands, {"AMP_OFF", "VOLUME_GET", "PLAY"})
+
 
 class ParityReportTest(unittest.TestCase):
     def test_collects_missing_static_commands(self) -> None:
@@ -285,6 +285,76 @@ int AudioEngine::BlockingOutput::availableForWrite() {
     return (out_ == nullptr) ? 0 : 4096;
 }
 
+bool AudioEngine::PolyphaseOutput::begin(const audio_tools::AudioInfo& input,
+                                         const audio_tools::AudioInfo& output,
+                                         Print* out) {
+    out_ = nullptr;
+    in_fill_bytes_ = 0U;
+    if (out == nullptr || input.bits_per_sample != 16U || output.bits_per_sample != 16U) {
+        return false;
+    }
+    if (!resampler_.configure(static_cast<uint32_t>(input.sample_rate),
+                              static_cast<uint32_t>(output.sample_rate),
+                              static_cast<uint8_t>(input.channels),
+                              static_cast<uint8_t>(output.channels))) {
+        return false;
+    }
+    out_ = out;
+    return true;
+}
+
+void AudioEngine::PolyphaseOutput::end() {
+    out_ = nullptr;
+    in_fill_bytes_ = 0U;
+    resampler_.reset();
+}
+
+size_t AudioEngine::PolyphaseOutput::write(uint8_t b) {
+    return write(&b, 1U);
+}
+
+size_t AudioEngine::PolyphaseOutput::write(const uint8_t* data, size_t len) {
+    if (out_ == nullptr || data == nullptr || len == 0U || !resampler_.configured()) {
+        return 0U;
+    }
+
+    const uint8_t in_channels = resampler_.inChannels();
+    const size_t frame_bytes = static_cast<size_t>(in_channels) * sizeof(int16_t);
+    const size_t out_frame_bytes = static_cast<size_t>(resampler_.outChannels()) * sizeof(int16_t);
+    uint8_t* in_bytes = reinterpret_cast<uint8_t*>(in_buf_);
+    size_t offset = 0U;
+    while (offset < len) {
+        // Staging copy keeps samples aligned and carries split frames across writes.
+        const size_t take = std::min(sizeof(in_buf_) - in_fill_bytes_, len - offset);
+        memcpy(in_bytes + in_fill_bytes_, data + offset, take);
+        in_fill_bytes_ += take;
+        offset += take;
+
+        const size_t frames = in_fill_bytes_ / frame_bytes;
+        size_t done = 0U;
+        while (done < frames) {
+            size_t consumed = 0U;
+            const size_t produced =
+                resampler_.process(&in_buf_[done * in_channels], frames - done, &consumed, out_buf_, kOutFrames);
+            if (produced > 0U) {
+                out_->write(reinterpret_cast<const uint8_t*>(out_buf_), produced * out_frame_bytes);
+            }
+            done += consumed;
+        }
+
+        const size_t used = frames * frame_bytes;
+        in_fill_bytes_ -= used;
+        if (in_fill_bytes_ > 0U) {
+            memmove(in_bytes, in_bytes + used, in_fill_bytes_);
+        }
+    }
+    return len;
+}
+
+int AudioEngine::PolyphaseOutput::availableForWrite() {
+    return (out_ == nullptr) ? 0 : 4096;
+}
+
 AudioConfig defaultAudioConfigForProfile(BoardProfile profile) {
     AudioConfig cfg;
     if (profile == BoardProfile::ESP32_S3) {
@@ -505,6 +575,7 @@ void AudioEngine::stopPlaybackFileUnlocked() {
     }
     mp3_pcm_sink_ = nullptr;
     mp3_source_last_pos_ = 0U;
+    playback_polyphase_output_.end();
     playback_resample_stream_.end();
     playback_channel_converter_stream_.end();
     playback_channel_converter_stream_.setOutput(playback_volume_stream_);
@@ -525,6 +596,7 @@ void AudioEngine::stopPlaybackFileUnlocked() {
     playback_input_audio_info_.clear();
     playback_resampler_active_ = false;
     playback_channel_upmix_active_ = false;
+    playback_polyphase_active_ = false;
     playback_loudness_auto_ = false;
     playback_limiter_active_ = false;
     playback_rate_fallback_ = 0;
@@ -541,7 +613,7 @@ void AudioEngine::stopPlaybackFile() {
     unlockPlaybackState();
 }
 
-bool AudioEngine::prepareWavPlayback(File& file, const char* path) {
+bool AudioEngine::prepareWavPlayback(File& file, const char* path, fs::FS* fs) {
     if (!file) {
         return false;
     }
@@ -605,9 +677,15 @@ bool AudioEngine::prepareWavPlayback(File& file, const char* path) {
     playback_loudness_auto_ = wavAutoLoudnessEnabled(_config);
     playback_limiter_active_ = false;
     playback_loudness_gain_db_ = 0.0f;
+    const char* loudness_source = "off";
     if (playback_loudness_auto_) {
         bool limiter_active = false;
-        playback_loudness_gain_db_ = analyzeWavLoudnessGainDb(file, wav_info, data_offset, data_size, limiter_active);
+        loudness_source = "index";
+        if (!lookupLoudnessGainDb(fs, path, static_cast<uint32_t>(file.size()), playback_loudness_gain_db_, limiter_active)) {
+            // No precomputed metadata: fall back to scanning the head of the data chunk.
+            loudness_source = "scan";
+            playback_loudness_gain_db_ = analyzeWavLoudnessGainDb(file, wav_info, data_offset, data_size, limiter_active);
+        }
         playback_limiter_active_ = limiter_active;
     }
     playback_volume_stream_.setVolume(kPlaybackBoostLinear);
@@ -618,7 +696,7 @@ bool AudioEngine::prepareWavPlayback(File& file, const char* path) {
                   static_cast<unsigned>(wav_info.bits_per_sample),
                   path_text);
     Serial.printf(
-        "[AudioEngine] playback resolved in(sr=%u,ch=%u,bits=%u) -> out(sr=%u,ch=%u,bits=%u) resampler=%s upmix=%s fallback=%u gain_db=%.2f limiter=%s\n",
+        "[AudioEngine] playback resolved in(sr=%u,ch=%u,bits=%u) -> out(sr=%u,ch=%u,bits=%u) resampler=%s upmix=%s fallback=%u gain_db=%.2f limiter=%s loudness=%s\n",
         static_cast<unsigned>(wav_info.sample_rate),
         static_cast<unsigned>(wav_info.channels),
         static_cast<unsigned>(wav_info.bits_per_sample),
@@ -629,7 +707,8 @@ bool AudioEngine::prepareWavPlayback(File& file, const char* path) {
         playback_channel_upmix_active_ ? "true" : "false",
         static_cast<unsigned>(playback_rate_fallback_),
         static_cast<double>(playback_loudness_gain_db_),
-        playback_limiter_active_ ? "true" : "false");
+        playback_limiter_active_ ? "true" : "false",
+        loudness_source);
     return true;
 }
 
@@ -758,7 +837,7 @@ bool AudioEngine::readMp3HeaderInfo(File& file, audio_tools::AudioInfo& info, ui
     return false;
 }
 
-bool AudioEngine::prepareMp3Playback(File& file, const char* path) {
+bool AudioEngine::prepareMp3Playback(File& file, const char* path, fs::FS* fs) {
     if (!file) {
         return false;
     }
@@ -775,6 +854,14 @@ bool AudioEngine::prepareMp3Playback(File& file, const char* path) {
     playback_channel_upmix_active_ = false;
     playback_volume_stream_.setVolume(kPlaybackBoostLinear);
 
+    // MP3 has no on-device scan; auto gain only applies when the sidecar has it.
+    if (wavAutoLoudnessEnabled(_config)) {
+        bool limiter_active = false;
+        playback_loudness_auto_ = lookupLoudnessGainDb(
+            fs, path, static_cast<uint32_t>(file.size()), playback_loudness_gain_db_, limiter_active);
+        playback_limiter_active_ = playback_loudness_auto_ && limiter_active;
+    }
+
     audio_tools::AudioInfo mp3_info{};
     uint32_t mp3_bitrate_bps = 0U;
     if (!readMp3HeaderInfo(file, mp3_info, &mp3_bitrate_bps) || !isPlaybackAudioInfoSupported(mp3_info)) {
@@ -993,12 +1080,24 @@ audio_tools::AudioInfo AudioEngine::resolvePlaybackFormat(const audio_tools::Aud
 }
 
 bool AudioEngine::configureWavPlaybackPipeline(const audio_tools::AudioInfo& input, const audio_tools::AudioInfo& output) {
+    playback_polyphase_output_.end();
+    playback_polyphase_active_ = false;
     playback_resample_stream_.end();
     playback_channel_converter_stream_.end();
     playback_channel_converter_stream_.setOutput(playback_volume_stream_);
     playback_resample_stream_.setOutput(playback_channel_converter_stream_);
     wav_stream_.setOutput(playback_volume_stream_);
 
+    // 16-bit PCM goes through the fixed-point polyphase stage (rate + channels
+    // in one pass); other layouts keep the generic audio-tools resampler.
+    if (playback_resampler_active_ &&
+        playback_polyphase_output_.begin(input, output, &playback_volume_stream_)) {
+        playback_polyphase_active_ = true;
+        wav_stream_.setOutput(playback_polyphase_output_);
+        logPolyphasePipeline("wav");
+        return true;
+    }
+
     const bool channel_convert_active = (output.channels != input.channels);
 
     if (playback_resampler_active_) {
@@ -1039,6 +1138,8 @@ bool AudioEngine::configureWavPlaybackPipeline(const audio_tools::AudioInfo& inp
 }
 
 bool AudioEngine::configureMp3PlaybackPipeline(const audio_tools::AudioInfo& input, const audio_tools::AudioInfo& output) {
+    playback_polyphase_output_.end();
+    playback_polyphase_active_ = false;
     playback_resample_stream_.end();
     playback_channel_converter_stream_.end();
     playback_channel_converter_stream_.setOutput(playback_volume_stream_);
@@ -1047,7 +1148,12 @@ bool AudioEngine::configureMp3PlaybackPipeline(const audio_tools::AudioInfo& inp
 
     const bool channel_convert_active = (output.channels != input.channels);
 
-    if (playback_resampler_active_) {
+    if (playback_resampler_active_ &&
+        playback_polyphase_output_.begin(input, output, &playback_volume_stream_)) {
+        playback_polyphase_active_ = true;
+        mp3_pcm_sink_ = &playback_polyphase_output_;
+        logPolyphasePipeline("mp3");
+    } else if (playback_resampler_active_) {
         if (channel_convert_active) {
             playback_resample_stream_.setOutput(playback_channel_converter_stream_);
         } else {
@@ -1068,7 +1174,7 @@ bool AudioEngine::configureMp3PlaybackPipeline(const audio_tools::AudioInfo& inp
         }
     }
 
-    if (channel_convert_active) {
+    if (channel_convert_active && !playback_polyphase_active_) {
         audio_tools::AudioInfo converter_input = input;
         if (playback_resampler_active_) {
             converter_input.sample_rate = output.sample_rate;
@@ -1088,6 +1194,19 @@ bool AudioEngine::configureMp3PlaybackPipeline(const audio_tools::AudioInfo& inp
     return mp3_pcm_sink_ != nullptr;
 }
 
+void AudioEngine::logPolyphasePipeline(const char* codec) const {
+    const PolyphaseResampler& resampler = playback_polyphase_output_.resampler();
+    Serial.printf("[AudioEngine] %s polyphase resampler %u->%u L/M=%u/%u taps=%u ch=%u->%u\n",
+                  codec,
+                  static_cast<unsigned>(resampler.inRateHz()),
+                  static_cast<unsigned>(resampler.outRateHz()),
+                  static_cast<unsigned>(resampler.interpolation()),
+                  static_cast<unsigned>(resampler.decimation()),
+                  static_cast<unsigned>(resampler.tapsPerPhase()),
+                  static_cast<unsigned>(resampler.inChannels()),
+                  static_cast<unsigned>(resampler.outChannels()));
+}
+
 void AudioEngine::applyPlaybackAudioInfo(const audio_tools::AudioInfo& info) {
     if (!driver_installed_) {
         return;
@@ -1251,6 +1370,30 @@ float AudioEngine::analyzeWavLoudnessGainDb(
     return linearToDb(desired_gain);
 }
 
+bool AudioEngine::lookupLoudnessGainDb(
+    fs::FS* fs,
+    const char* path,
+    uint32_t file_size,
+    float& out_gain_db,
+    bool& out_limiter_active) const {
+    out_limiter_active = false;
+    LoudnessMetadata meta;
+    if (fs == nullptr || !LoudnessIndex::lookup(*fs, path, file_size, meta)) {
+        return false;
+    }
+
+    // Integrated loudness stands in for the RMS estimate of the scan path;
+    // true peak bounds the gain the same way the sample peak does there.
+    float desired_db = static_cast<float>(_config.wav_target_rms_dbfs) - meta.integrated_lufs;
+    const float peak_limited_db = static_cast<float>(_config.wav_limiter_ceiling_dbfs) - meta.true_peak_dbtp;
+    if (desired_db > peak_limited_db) {
+        desired_db = peak_limited_db;
+        out_limiter_active = true;
+    }
+    out_gain_db = linearToDb(clampFloat(dbToLinear(desired_db), 0.125f, 4.0f));
+    return true;
+}
+
 void AudioEngine::restorePlaybackAudioInfo() {
     if (!driver_installed_) {
         return;
@@ -1767,7 +1910,7 @@ bool AudioEngine::playFileFromSource(const char* path, MediaSource source) {
 
     const bool use_mp3_decoder = isMp3Path(path);
     if (use_mp3_decoder) {
-        if (!prepareMp3Playback(playback_file_, path)) {
+        if (!prepareMp3Playback(playback_file_, path, mounted_fs)) {
             playback_last_error_ = "mp3_prepare_failed";
             stopPlaybackFileUnlocked();
             unlockPlaybackState();
@@ -1807,11 +1950,12 @@ bool AudioEngine::playFileFromSource(const char* path, MediaSource source) {
             return false;
         }
 
-        playback_volume_stream_.setVolume(kPlaybackBoostLinear);
+        const float gain_linear = dbToLinear(playback_loudness_gain_db_);
+        playback_volume_stream_.setVolume(clampFloat(kPlaybackBoostLinear * gain_linear, 0.05f, 4.0f));
         mp3_source_last_pos_ = mp3_source_ != nullptr ? mp3_source_->getPos() : 0U;
         playback_codec_ = PlaybackCodec::MP3;
     } else {
-        if (!prepareWavPlayback(playback_file_, path)) {
+        if (!prepareWavPlayback(playback_file_, path, mounted_fs)) {
             playback_last_error_ = "wav_prepare_failed";
             stopPlaybackFileUnlocked();
             unlockPlaybackState();
@@ -2402,6 +2546,10 @@ bool AudioEngine::probePlaybackFileFromSource(const char* path, MediaSource sour
         out.loudness_auto = false;
         out.loudness_gain_db = 0.0f;
         out.limiter_active = false;
+        if (wavAutoLoudnessEnabled(_config)) {
+            out.loudness_auto = lookupLoudnessGainDb(
+                mounted_fs, path, file_size_bytes, out.loudness_gain_db, out.limiter_active);
+        }
         out.rate_fallback = fallback_rate_hz;
         out.data_size_bytes = file_size_bytes;
         out.duration_ms = 0U;
@@ -2438,7 +2586,8 @@ bool AudioEngine::probePlaybackFileFromSource(const char* path, MediaSource sour
     bool limiter_active = false;
     float gain_db = 0.0f;
     const bool loudness_auto = wavAutoLoudnessEnabled(_config);
-    if (loudness_auto) {
+    if (loudness_auto &&
+        !lookupLoudnessGainDb(mounted_fs, path, static_cast<uint32_t>(playback_file_.size()), gain_db, limiter_active)) {
         gain_db = analyzeWavLoudnessGainDb(playback_file_, wav_info, data_offset, data_size, limiter_active);
     }
     playback_file_.close();
@@ -11,6 +11,8 @@
 #include <freertos/semphr.h>
 
 #include "core/PlatformProfile.h"
+#include "audio/LoudnessIndex.h"
+#include "audio/PolyphaseResampler.h"
 #include "audio/ToneCatalog.h"
 #include "media/MediaRouting.h"
 
@@ -162,6 +164,28 @@ private:
         Print* out_ = nullptr;
     };
 
+    // 16-bit playback resampler + channel conversion in one Print stage.
+    // The filter bank survives end() and is reused when the next track has
+    // the same rate ratio.
+    class PolyphaseOutput : public Print {
+    public:
+        bool begin(const audio_tools::AudioInfo& input, const audio_tools::AudioInfo& output, Print* out);
+        void end();
+        const PolyphaseResampler& resampler() const { return resampler_; }
+        size_t write(uint8_t b) override;
+        size_t write(const uint8_t* data, size_t len) override;
+        int availableForWrite() override;
+
+    private:
+        static constexpr size_t kInFrames = 128U;
+        static constexpr size_t kOutFrames = 128U;
+        PolyphaseResampler resampler_;
+        Print* out_ = nullptr;
+        int16_t in_buf_[kInFrames * 2U] = {0};
+        int16_t out_buf_[kOutFrames * 2U] = {0};
+        size_t in_fill_bytes_ = 0U;
+    };
+
     static size_t activeChannelCount(i2s_channel_fmt_t channel_format);
     static void audioTaskFn(void* arg);
     size_t captureFromAdc(int16_t* dst, size_t samples, bool blocking);
@@ -187,8 +211,8 @@ private:
     bool openPlaybackFileForSource(const char* path, MediaSource source, fs::FS*& out_fs, MediaSource& out_source);
     void stopPlaybackFile();
     void stopPlaybackFileUnlocked();
-    bool prepareWavPlayback(File& file, const char* path);
-    bool prepareMp3Playback(File& file, const char* path);
+    bool prepareWavPlayback(File& file, const char* path, fs::FS* fs = nullptr);
+    bool prepareMp3Playback(File& file, const char* path, fs::FS* fs = nullptr);
     bool isMp3Path(const char* path) const;
     bool readMp3HeaderInfo(File& file, audio_tools::AudioInfo& info, uint32_t* out_bitrate = nullptr) const;
     bool readWavHeaderInfo(
@@ -206,6 +230,12 @@ private:
         uint32_t data_offset,
         uint32_t data_size,
         bool& out_limiter_active) const;
+    bool lookupLoudnessGainDb(
+        fs::FS* fs,
+        const char* path,
+        uint32_t file_size,
+        float& out_gain_db,
+        bool& out_limiter_active) const;
     bool decodePcmSample(const uint8_t* bytes, uint8_t bits_per_sample, int32_t& out) const;
     void updateToneJitter(uint32_t now_ms);
     void restorePlaybackAudioInfo();
@@ -213,6 +243,7 @@ private:
     bool advanceToneStep();
     bool configureWavPlaybackPipeline(const audio_tools::AudioInfo& input, const audio_tools::AudioInfo& output);
     bool configureMp3PlaybackPipeline(const audio_tools::AudioInfo& input, const audio_tools::AudioInfo& output);
+    void logPolyphasePipeline(const char* codec) const;
     bool loadTonePattern(ToneProfile profile, ToneEvent event);
     int16_t sampleToneWave(float& phase, uint16_t freq_hz) const;
     void updateAdcDspConfig(const AudioConfig& cfg);
@@ -265,6 +296,7 @@ private:
     audio_tools::AudioInfo active_playback_audio_info_;
     bool playback_resampler_active_ = false;
     bool playback_channel_upmix_active_ = false;
+    bool playback_polyphase_active_ = false;
     bool playback_loudness_auto_ = false;
     float playback_loudness_gain_db_ = 0.0f;
     bool playback_limiter_active_ = false;
@@ -322,6 +354,7 @@ private:
     audio_tools::ConverterStream<int16_t> playback_gain_stream_;
     audio_tools::ResampleStream playback_resample_stream_;
     audio_tools::ChannelFormatConverterStream playback_channel_converter_stream_;
+    PolyphaseOutput playback_polyphase_output_;
     audio_tools::WAVDecoder wav_decoder_;
     audio_tools::EncodedAudioStream wav_stream_;
     audio_tools::StreamCopy wav_copy_;
@@ -0,0 +1,103 @@
+#include "audio/LoudnessIndex.h"
+
+#include <cstring>
+
+namespace {
+
+constexpr size_t kHeaderBytes = 16U;
+constexpr size_t kBucketBytes = 16U;
+constexpr size_t kMaxSidecarPath = 160U;
+
+uint16_t readU16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (static_cast<uint16_t>(p[1]) << 8U));
+}
+
+uint32_t readU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8U) |
+           (static_cast<uint32_t>(p[2]) << 16U) | (static_cast<uint32_t>(p[3]) << 24U);
+}
+
+const char* baseName(const char* path) {
+    const char* slash = std::strrchr(path, '/');
+    return (slash == nullptr) ? path : slash + 1;
+}
+
+}  // namespace
+
+uint32_t LoudnessIndex::hashName(const char* name) {
+    uint32_t hash = 2166136261UL;
+    for (const char* p = name; p != nullptr && *p != '\0'; ++p) {
+        hash ^= static_cast<uint8_t>(*p);
+        hash *= 16777619UL;
+    }
+    // 0 marks an empty bucket in the sidecar.
+    return (hash == 0U) ? 1U : hash;
+}
+
+bool LoudnessIndex::lookup(fs::FS& fs, const char* media_path, uint32_t file_size, LoudnessMetadata& out) {
+    if (media_path == nullptr || media_path[0] == '\0') {
+        return false;
+    }
+
+    const char* name = baseName(media_path);
+    const size_t dir_len = static_cast<size_t>(name - media_path);
+    const size_t sidecar_len = std::strlen(kSidecarName);
+    if (name[0] == '\0' || dir_len + sidecar_len + 2U > kMaxSidecarPath) {
+        return false;
+    }
+
+    char sidecar_path[kMaxSidecarPath];
+    size_t pos = 0U;
+    if (dir_len == 0U) {
+        sidecar_path[pos++] = '/';
+    } else {
+        std::memcpy(sidecar_path, media_path, dir_len);
+        pos = dir_len;
+    }
+    std::memcpy(sidecar_path + pos, kSidecarName, sidecar_len + 1U);
+
+    if (!fs.exists(sidecar_path)) {
+        return false;
+    }
+    File index = fs.open(sidecar_path, FILE_READ);
+    if (!index) {
+        return false;
+    }
+
+    uint8_t header[kHeaderBytes];
+    if (index.read(header, sizeof(header)) != sizeof(header) || std::memcmp(header, "ZLDX", 4U) != 0 ||
+        readU16(header + 4U) != kVersion) {
+        index.close();
+        return false;
+    }
+    const uint16_t bucket_count = readU16(header + 6U);
+    if (bucket_count == 0U || (bucket_count & (bucket_count - 1U)) != 0U) {
+        index.close();
+        return false;
+    }
+
+    const uint32_t hash = hashName(name);
+    const uint16_t mask = static_cast<uint16_t>(bucket_count - 1U);
+    uint16_t slot = static_cast<uint16_t>(hash & mask);
+    bool found = false;
+    for (uint8_t probe = 0U; probe < kMaxProbes && probe < bucket_count; ++probe) {
+        uint8_t bucket[kBucketBytes];
+        if (!index.seek(kHeaderBytes + static_cast<size_t>(slot) * kBucketBytes) ||
+            index.read(bucket, sizeof(bucket)) != sizeof(bucket)) {
+            break;
+        }
+        const uint32_t bucket_hash = readU32(bucket);
+        if (bucket_hash == 0U) {
+            break;
+        }
+        if (bucket_hash == hash && readU32(bucket + 4U) == file_size) {
+            out.integrated_lufs = static_cast<float>(static_cast<int16_t>(readU16(bucket + 8U))) / 100.0f;
+            out.true_peak_dbtp = static_cast<float>(static_cast<int16_t>(readU16(bucket + 10U))) / 100.0f;
+            found = true;
+            break;
+        }
+        slot = static_cast<uint16_t>((slot + 1U) & mask);
+    }
+    index.close();
+    return found;
+}
@@ -0,0 +1,34 @@
+#ifndef LOUDNESS_INDEX_H
+#define LOUDNESS_INDEX_H
+
+#include <FS.h>
+#include <stdint.h>
+
+// Per-directory loudness sidecar written by scripts/build_loudness_index.py.
+//
+// Layout (little-endian), one file named kSidecarName per media directory:
+//   header  16 B: "ZLDX", u16 version, u16 bucket_count (power of two),
+//                 u32 entry_count, u32 reserved
+//   buckets 16 B: u32 name_hash (FNV-1a of the file name, 0 = empty),
+//                 u32 file_size, i16 integrated_lufs_x100,
+//                 i16 true_peak_dbtp_x100, u32 reserved
+// Lookup hashes the base name and probes linearly from hash & (count - 1),
+// so a hit costs one header read plus one or two bucket reads.
+struct LoudnessMetadata {
+    float integrated_lufs = 0.0f;
+    float true_peak_dbtp = 0.0f;
+};
+
+class LoudnessIndex {
+public:
+    static constexpr const char* kSidecarName = ".loudness.idx";
+    static constexpr uint16_t kVersion = 1U;
+    static constexpr uint8_t kMaxProbes = 8U;
+
+    static uint32_t hashName(const char* name);
+    // Looks up the sidecar next to media_path. file_size guards against stale
+    // entries after the asset was replaced.
+    static bool lookup(fs::FS& fs, const char* media_path, uint32_t file_size, LoudnessMetadata& out);
+};
+
+#endif  // LOUDNESS_INDEX_H
@@ -0,0 +1,275 @@
+#include "audio/PolyphaseResampler.h"
+
+#include <cmath>
+#include <cstring>
+#include <new>
+
+#include "audio/PolyphaseResamplerTables.h"
+
+namespace {
+
+// Pass-band edge as a fraction of the narrower Nyquist band.
+// Design constants are shared with scripts/gen_resampler_tables.py.
+constexpr float kPassbandRatio = 0.90f;
+// Kaiser beta ~8.6 gives roughly 90 dB stop-band for the tap counts used here.
+constexpr float kKaiserBeta = 8.6f;
+constexpr float kPi = 3.14159265358979f;
+
+uint32_t gcdU32(uint32_t a, uint32_t b) {
+    while (b != 0U) {
+        const uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+float besselI0(float x) {
+    float sum = 1.0f;
+    float term = 1.0f;
+    const float half = x * 0.5f;
+    for (int k = 1; k < 32; ++k) {
+        term *= (half / static_cast<float>(k)) * (half / static_cast<float>(k));
+        sum += term;
+        if (term < (sum * 1.0e-7f)) {
+            break;
+        }
+    }
+    return sum;
+}
+
+int16_t saturate16(int64_t value) {
+    if (value > 32767) {
+        return 32767;
+    }
+    if (value < -32768) {
+        return -32768;
+    }
+    return static_cast<int16_t>(value);
+}
+
+}  // namespace
+
+PolyphaseResampler::~PolyphaseResampler() {
+    release();
+}
+
+bool PolyphaseResampler::configure(uint32_t in_rate_hz,
+                                   uint32_t out_rate_hz,
+                                   uint8_t in_channels,
+                                   uint8_t out_channels) {
+    if (in_rate_hz == 0U || out_rate_hz == 0U || in_channels == 0U || in_channels > 2U ||
+        out_channels == 0U || out_channels > 2U) {
+        return false;
+    }
+
+    const uint32_t g = gcdU32(in_rate_hz, out_rate_hz);
+    const uint32_t up = out_rate_hz / g;
+    const uint32_t down = in_rate_hz / g;
+    if (up > kMaxPhases || down > 0xFFFFU) {
+        return false;
+    }
+
+    uint32_t taps = kMinTapsPerPhase;
+    if (down > up) {
+        taps = (kMinTapsPerPhase * down + up - 1U) / up;
+    }
+    taps = (taps + 3U) & ~3U;
+    if (taps > kMaxTapsPerPhase) {
+        taps = kMaxTapsPerPhase;
+    }
+
+    const bool bank_reusable = (bank_ != nullptr && up_ == up && down_ == down && taps_ == taps);
+    const uint8_t filter_channels = (in_channels == 2U && out_channels == 2U) ? 2U : 1U;
+    if (!bank_reusable) {
+        release();
+        if (!buildBank(static_cast<uint16_t>(up), static_cast<uint16_t>(down), static_cast<uint16_t>(taps))) {
+            return false;
+        }
+    }
+    if (history_ == nullptr || filter_channels != filter_channels_ || !bank_reusable) {
+        delete[] history_;
+        history_ = new (std::nothrow) int16_t[static_cast<size_t>(filter_channels) * 2U * taps_];
+        if (history_ == nullptr) {
+            release();
+            return false;
+        }
+    }
+
+    in_rate_hz_ = in_rate_hz;
+    out_rate_hz_ = out_rate_hz;
+    in_channels_ = in_channels;
+    out_channels_ = out_channels;
+    filter_channels_ = filter_channels;
+    reset();
+    return true;
+}
+
+void PolyphaseResampler::reset() {
+    if (history_ != nullptr) {
+        std::memset(history_, 0, static_cast<size_t>(filter_channels_) * 2U * taps_ * sizeof(int16_t));
+    }
+    history_pos_ = 0U;
+    phase_ = 0U;
+    phase_pending_ = false;
+}
+
+void PolyphaseResampler::release() {
+    delete[] owned_bank_;
+    owned_bank_ = nullptr;
+    bank_ = nullptr;
+    delete[] history_;
+    history_ = nullptr;
+    up_ = 0U;
+    down_ = 0U;
+    taps_ = 0U;
+    filter_channels_ = 0U;
+    history_pos_ = 0U;
+    phase_ = 0U;
+    phase_pending_ = false;
+}
+
+size_t PolyphaseResampler::maxOutputFrames(size_t in_frames) const {
+    if (down_ == 0U) {
+        return 0U;
+    }
+    return ((in_frames + 1U) * up_) / down_ + 2U;
+}
+
+bool PolyphaseResampler::buildBank(uint16_t up, uint16_t down, uint16_t taps) {
+    for (size_t i = 0U; i < kPolyphaseBankTableCount; ++i) {
+        const PolyphaseBankTable& table = kPolyphaseBankTables[i];
+        if (table.up == up && table.down == down && table.taps == taps) {
+            bank_ = table.coeffs;
+            up_ = up;
+            down_ = down;
+            taps_ = taps;
+            return true;
+        }
+    }
+
+    owned_bank_ = new (std::nothrow) int16_t[static_cast<size_t>(up) * taps];
+    if (owned_bank_ == nullptr) {
+        return false;
+    }
+    designBank(up, down, taps, owned_bank_);
+    bank_ = owned_bank_;
+    up_ = up;
+    down_ = down;
+    taps_ = taps;
+    return true;
+}
+
+void PolyphaseResampler::designBank(uint16_t up, uint16_t down, uint16_t taps, int16_t* out) {
+    // Prototype low-pass runs at up * Fin; cutoff is relative to that rate.
+    // Tap n of the prototype is tap k = n / up of phase p = n % up, so each
+    // phase is computed, normalised to unity DC gain and quantised on its own.
+    const float narrow = (up < down) ? static_cast<float>(up) : static_cast<float>(down);
+    const float cutoff = (0.5f * kPassbandRatio * narrow) / (static_cast<float>(up) * static_cast<float>(down));
+    const float center = (static_cast<float>(up) * static_cast<float>(taps) - 1.0f) * 0.5f;
+    const float i0_beta = besselI0(kKaiserBeta);
+    float phase_taps[kMaxTapsPerPhase];
+    for (uint16_t p = 0U; p < up; ++p) {
+        float sum = 0.0f;
+        for (uint16_t k = 0U; k < taps; ++k) {
+            const float t = static_cast<float>(static_cast<uint32_t>(k) * up + p) - center;
+            const float x = 2.0f * cutoff * t;
+            const float sinc = (std::fabs(x) < 1.0e-7f) ? 1.0f : std::sin(kPi * x) / (kPi * x);
+            const float ratio = (center > 0.0f) ? (t / center) : 0.0f;
+            const float window = besselI0(kKaiserBeta * std::sqrt(std::fmax(0.0f, 1.0f - ratio * ratio))) / i0_beta;
+            phase_taps[k] = 2.0f * cutoff * sinc * window;
+            sum += phase_taps[k];
+        }
+        const float scale = (std::fabs(sum) > 1.0e-9f) ? (32768.0f / sum) : 0.0f;
+        for (uint16_t k = 0U; k < taps; ++k) {
+            out[static_cast<size_t>(p) * taps + k] = saturate16(static_cast<int64_t>(std::lround(phase_taps[k] * scale)));
+        }
+    }
+}
+
+void PolyphaseResampler::pushFrame(const int16_t* frame) {
+    history_pos_ = (history_pos_ == 0U) ? static_cast<uint16_t>(taps_ - 1U) : static_cast<uint16_t>(history_pos_ - 1U);
+    if (filter_channels_ == 2U) {
+        int16_t* left = history_;
+        int16_t* right = history_ + (2U * taps_);
+        left[history_pos_] = left[history_pos_ + taps_] = frame[0];
+        right[history_pos_] = right[history_pos_ + taps_] = frame[1];
+        return;
+    }
+    int16_t sample = frame[0];
+    if (in_channels_ == 2U) {
+        sample = static_cast<int16_t>((static_cast<int32_t>(frame[0]) + frame[1]) >> 1);
+    }
+    history_[history_pos_] = history_[history_pos_ + taps_] = sample;
+}
+
+int16_t PolyphaseResampler::filterChannel(uint8_t channel, uint16_t phase) const {
+    const int16_t* h = bank_ + static_cast<size_t>(phase) * taps_;
+    const int16_t* x = history_ + (static_cast<size_t>(channel) * 2U * taps_) + history_pos_;
+    int32_t acc0 = 0;
+    int32_t acc1 = 0;
+    for (uint16_t k = 0U; k < taps_; k += 4U) {
+        acc0 += static_cast<int32_t>(h[k]) * x[k];
+        acc1 += static_cast<int32_t>(h[k + 1U]) * x[k + 1U];
+        acc0 += static_cast<int32_t>(h[k + 2U]) * x[k + 2U];
+        acc1 += static_cast<int32_t>(h[k + 3U]) * x[k + 3U];
+    }
+    // Halves are summed in 64-bit: a full-scale step can exceed int32 briefly.
+    const int64_t acc = static_cast<int64_t>(acc0) + acc1 + (1 << 14);
+    return saturate16(acc >> 15);
+}
+
+size_t PolyphaseResampler::process(const int16_t* in,
+                                   size_t in_frames,
+                                   size_t* consumed_frames,
+                                   int16_t* out,
+                                   size_t out_capacity_frames) {
+    size_t consumed = 0U;
+    size_t produced = 0U;
+    if (bank_ == nullptr || history_ == nullptr || out == nullptr) {
+        if (consumed_frames != nullptr) {
+            *consumed_frames = 0U;
+        }
+        return 0U;
+    }
+
+    while (true) {
+        while (phase_pending_ && phase_ < up_) {
+            if (produced >= out_capacity_frames) {
+                if (consumed_frames != nullptr) {
+                    *consumed_frames = consumed;
+                }
+                return produced;
+            }
+            int16_t* dst = out + (produced * out_channels_);
+            const uint16_t phase = static_cast<uint16_t>(phase_);
+            if (filter_channels_ == 2U) {
+                dst[0] = filterChannel(0U, phase);
+                dst[1] = filterChannel(1U, phase);
+            } else {
+                const int16_t sample = filterChannel(0U, phase);
+                dst[0] = sample;
+                if (out_channels_ == 2U) {
+                    dst[1] = sample;
+                }
+            }
+            ++produced;
+            phase_ += down_;
+        }
+        if (phase_pending_) {
+            phase_ -= up_;
+            phase_pending_ = false;
+        }
+        if (in == nullptr || consumed >= in_frames) {
+            break;
+        }
+        pushFrame(in + (consumed * in_channels_));
+        ++consumed;
+        phase_pending_ = true;
+    }
+
+    if (consumed_frames != nullptr) {
+        *consumed_frames = consumed;
+    }
+    return produced;
+}
@@ -0,0 +1,78 @@
+#ifndef POLYPHASE_RESAMPLER_H
+#define POLYPHASE_RESAMPLER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-point polyphase resampler (Q15 taps, int32 accumulators) for the
+// playback path. The rate ratio is reduced to L/M and configure() selects a
+// Kaiser-windowed sinc bank of L phases: a const table from
+// PolyphaseResamplerTables.cpp for the common media rates, otherwise one
+// designed on the spot (float, one phase at a time). process() then only runs
+// one short dot product per output frame. Channel up/down-mix is fused:
+// stereo->mono is folded before filtering, mono->stereo duplicates the result.
+class PolyphaseResampler {
+public:
+    static constexpr uint16_t kMinTapsPerPhase = 16U;
+    static constexpr uint16_t kMaxTapsPerPhase = 64U;
+    static constexpr uint16_t kMaxPhases = 480U;
+
+    PolyphaseResampler() = default;
+    ~PolyphaseResampler();
+    PolyphaseResampler(const PolyphaseResampler&) = delete;
+    PolyphaseResampler& operator=(const PolyphaseResampler&) = delete;
+
+    bool configure(uint32_t in_rate_hz, uint32_t out_rate_hz, uint8_t in_channels, uint8_t out_channels);
+    void reset();
+    void release();
+
+    // Consumes whole interleaved int16 input frames and produces up to
+    // out_capacity_frames interleaved output frames. Returns frames written;
+    // *consumed_frames reports how much input was accepted.
+    size_t process(const int16_t* in,
+                   size_t in_frames,
+                   size_t* consumed_frames,
+                   int16_t* out,
+                   size_t out_capacity_frames);
+
+    bool configured() const { return bank_ != nullptr; }
+    uint32_t inRateHz() const { return in_rate_hz_; }
+    uint32_t outRateHz() const { return out_rate_hz_; }
+    uint8_t inChannels() const { return in_channels_; }
+    uint8_t outChannels() const { return out_channels_; }
+    uint16_t interpolation() const { return up_; }
+    uint16_t decimation() const { return down_; }
+    uint16_t tapsPerPhase() const { return taps_; }
+    // True when the bank is a generated const table rather than a heap copy.
+    bool bankFromTable() const { return bank_ != nullptr && owned_bank_ == nullptr; }
+    // Upper bound of output frames for in_frames of input (for buffer sizing).
+    size_t maxOutputFrames(size_t in_frames) const;
+
+    // Runtime bank design for ratios without a table: fills up * taps Q15
+    // coefficients, phase-major. Same filter as scripts/gen_resampler_tables.py.
+    static void designBank(uint16_t up, uint16_t down, uint16_t taps, int16_t* out);
+
+private:
+    bool buildBank(uint16_t up, uint16_t down, uint16_t taps);
+    void pushFrame(const int16_t* frame);
+    int16_t filterChannel(uint8_t channel, uint16_t phase) const;
+
+    uint32_t in_rate_hz_ = 0U;
+    uint32_t out_rate_hz_ = 0U;
+    uint8_t in_channels_ = 0U;
+    uint8_t out_channels_ = 0U;
+    uint8_t filter_channels_ = 0U;
+    uint16_t up_ = 0U;
+    uint16_t down_ = 0U;
+    uint16_t taps_ = 0U;
+    const int16_t* bank_ = nullptr;
+    // Set only when the bank was designed at runtime.
+    int16_t* owned_bank_ = nullptr;
+    // Mirrored history: each sample is stored twice so a window is contiguous.
+    int16_t* history_ = nullptr;
+    uint16_t history_pos_ = 0U;
+    uint32_t phase_ = 0U;
+    bool phase_pending_ = false;
+};
+
+#endif  // POLYPHASE_RESAMPLER_H
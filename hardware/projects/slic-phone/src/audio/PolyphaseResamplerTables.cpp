@@ -0,0 +1,5365 @@
+// Generated by scripts/gen_resampler_tables.py; do not edit.
+// Q15 polyphase banks (phase-major, taps per phase) for every pair of
+// 8000/16000/22050/24000/44100/48000 Hz.
+#include "audio/PolyphaseResamplerTables.h"
+
+namespace {
+
+// L/M=1/1, 16 taps: 8000->8000, 16000->16000, 22050->22050, 24000->24000, 44100->44100, 48000->48000
+const int16_t kBank1x1x16[16] = {
+    1, -14, 23, 73, -534, 1860, -5263, 20238, 20238, -5263, 1860, -534,
+    73, 23, -14, 1,
+};
+
+// L/M=1/2, 32 taps: 16000->8000, 44100->22050, 48000->24000
+const int16_t kBank1x2x32[32] = {
+    0, 5, 3, -30, -34, 91, 155, -172, -470, 178, 1119, 128,
+    -2352, -1436, 5708, 13491, 13491, 5708, -1436, -2352, 128, 1119, 178, -470,
+    -172, 155, 91, -34, -30, 3, 5, 0,
+};
+
+// L/M=1/3, 48 taps: 24000->8000, 48000->16000
+const int16_t kBank1x3x48[48] = {
+    0, 1, 5, 4, -7, -27, -30, 10, 82, 116, 28, -172,
+    -320, -193, 251, 702, 645, -183, -1350, -1778, -426, 2818, 6756, 9453,
+    9453, 6756, 2818, -426, -1778, -1350, -183, 645, 702, 251, -193, -320,
+    -172, 28, 116, 82, 10, -30, -27, -7, 4, 5, 1, 0,
+};
+
+// L/M=1/6, 64 taps: 48000->8000
+const int16_t kBank1x6x64[64] = {
+    0, 1, 2, 3, 3, -1, -8, -19, -31, -39, -37, -17,
+    22, 79, 142, 192, 203, 152, 28, -165, -395, -609, -733, -692,
+    -422, 106, 875, 1819, 2826, 3758, 4475, 4865, 4865, 4475, 3758, 2826,
+    1819, 875, 106, -422, -692, -733, -609, -395, -165, 28, 152, 203,
+    192, 142, 79, 22, -17, -37, -39, -31, -19, -8, -1, 3,
+    3, 2, 1, 0,
+};
+
+// L/M=2/1, 16 taps: 8000->16000, 22050->44100, 24000->48000
+const int16_t kBank2x1x16[32] = {
+    0, 7, -69, 310, -941, 2237, -4704, 11417, 26983, -2873, 257, 357,
+    -344, 182, -60, 10, 10, -60, 182, -344, 357, 257, -2873, 26983,
+    11417, -4704, 2237, -941, 310, -69, 7, 0,
+};
+
+// L/M=2/3, 24 taps: 24000->16000
+const int16_t kBank2x3x24[48] = {
+    0, 9, -15, -60, 164, 56, -640, 501, 1290, -2700, -852, 13511,
+    18907, 5636, -3557, -366, 1404, -386, -344, 232, 20, -53, 8, 3,
+    3, 8, -53, 20, 232, -344, -386, 1404, -366, -3557, 5636, 18907,
+    13511, -852, -2700, 1290, 501, -640, 56, 164, -60, -15, 9, 0,
+};
+
+// L/M=3/1, 16 taps: 8000->24000, 16000->48000
+const int16_t kBank3x1x16[48] = {
+    0, 12, -89, 349, -960, 2106, -4051, 8454, 28360, -1278, -550, 752,
+    -517, 246, -80, 14, 4, -22, 30, 84, -579, 1935, -5336, 20268,
+    20268, -5336, 1935, -579, 84, 30, -22, 4, 14, -80, 246, -517,
+    752, -550, -1278, 28360, 8454, -4051, 2106, -960, 349, -89, 12, 0,
+};
+
+// L/M=3/2, 16 taps: 16000->24000
+const int16_t kBank3x2x16[48] = {
+    0, 12, -89, 349, -960, 2106, -4051, 8454, 28360, -1278, -550, 752,
+    -517, 246, -80, 14, 4, -22, 30, 84, -579, 1935, -5336, 20268,
+    20268, -5336, 1935, -579, 84, 30, -22, 4, 14, -80, 246, -517,
+    752, -550, -1278, 28360, 8454, -4051, 2106, -960, 349, -89, 12, 0,
+};
+
+// L/M=6/1, 16 taps: 8000->48000
+const int16_t kBank6x1x16[96] = {
+    -1, 17, -104, 365, -926, 1874, -3254, 5631, 29205, 700, -1441, 1162,
+    -688, 308, -98, 18, 0, 8, -78, 336, -984, 2288, -4746, 11434,
+    26987, -2885, 261, 368, -365, 202, -72, 14, 3, -11, -14, 198,
+    -790, 2214, -5441, 17438, 22870, -4914, 1534, -324, -47, 85, -40, 8,
+    8, -40, 85, -47, -324, 1534, -4914, 22870, 17438, -5441, 2214, -790,
+    198, -14, -11, 3, 14, -72, 202, -365, 368, 261, -2885, 26987,
+    11434, -4746, 2288, -984, 336, -78, 8, 0, 18, -98, 308, -688,
+    1162, -1441, 700, 29205, 5631, -3254, 1874, -926, 365, -104, 17, -1,
+};
+
+// L/M=80/147, 32 taps: 44100->24000
+const int16_t kBank80x147x32[2560] = {
+    0, -4, 6, 27, -23, -100, 58, 276, -117, -645, 194, 1375,
+    -278, -3003, 362, 10324, 16049, 10198, 266, -2993, -238, 1373, 175, -645,
+    -108, 276, 55, -100, -21, 27, 5, -4, 0, -4, 6, 27,
+    -24, -99, 62, 276, -126, -645, 213, 1377, -318, -3013, 459, 10449,
+    16047, 10071, 171, -2981, -199, 1371, 156, -644, -99, 276, 51, -100,
+    -20, 27, 5, -4, 0, -4, 6, 27, -25, -99, 66, 276,
+    -135, -645, 232, 1378, -358, -3021, 558, 10574, 16043, 9944, 77, -2969,
+    -160, 1368, 137, -643, -91, 276, 48, -99, -19, 27, 5, -4,
+    -1, -4, 7, 27, -26, -99, 69, 275, -144, -644, 252, 1378,
+    -399, -3029, 658, 10698, 16037, 9816, -15, -2955, -121, 1364, 118, -642,
+    -82, 276, 44, -99, -18, 27, 5, -4, -1, -4, 7, 27,
+    -28, -99, 73, 275, -153, -643, 271, 1378, -439, -3035, 759, 10821,
+    16028, 9688, -106, -2941, -82, 1360, 100, -641, -73, 275, 40, -99,
+    -17, 27, 4, -4, -1, -4, 7, 27, -29, -99, 77, 274,
+    -162, -642, 291, 1377, -480, -3040, 861, 10943, 16018, 9558, -196, -2925,
+    -44, 1356, 81, -639, -65, 275, 37, -99, -15, 27, 4, -4,
+    -1, -4, 8, 27, -30, -99, 81, 274, -171, -641, 310, 1376,
+    -521, -3044, 964, 11064, 16006, 9429, -285, -2908, -6, 1350, 63, -638,
+    -56, 274, 33, -99, -14, 26, 4, -4, -1, -4, 8, 27,
+    -31, -98, 84, 273, -180, -640, 330, 1374, -563, -3047, 1069, 11185,
+    15991, 9299, -372, -2891, 31, 1345, 45, -636, -48, 273, 30, -98,
+    -13, 26, 4, -4, -1, -4, 8, 27, -33, -98, 88, 272,
+    -189, -638, 350, 1372, -604, -3049, 1174, 11304, 15975, 9168, -458, -2873,
+    68, 1339, 27, -633, -39, 272, 27, -98, -12, 26, 3, -4,
+    -1, -4, 8, 26, -34, -97, 92, 271, -198, -636, 369, 1369,
+    -646, -3049, 1281, 11423, 15957, 9037, -542, -2853, 105, 1333, 9, -631,
+    -31, 271, 23, -98, -11, 26, 3, -4, -1, -4, 9, 26,
+    -35, -97, 96, 269, -207, -633, 389, 1366, -688, -3049, 1389, 11540,
+    15936, 8905, -626, -2833, 141, 1326, -9, -628, -23, 270, 20, -97,
+    -10, 26, 3, -4, -1, -4, 9, 26, -36, -96, 99, 268,
+    -216, -631, 409, 1362, -730, -3047, 1497, 11657, 15914, 8773, -708, -2812,
+    177, 1318, -26, -625, -15, 269, 17, -97, -9, 26, 3, -4,
+    -1, -4, 9, 26, -38, -96, 103, 267, -225, -628, 429, 1357,
+    -772, -3044, 1607, 11772, 15889, 8641, -788, -2790, 213, 1311, -44, -622,
+    -7, 268, 13, -97, -8, 26, 2, -4, -1, -4, 10, 26,
+    -39, -95, 107, 265, -235, -625, 448, 1352, -814, -3040, 1718, 11887,
+    15862, 8508, -867, -2767, 248, 1302, -61, -619, 1, 267, 10, -96,
+    -7, 26, 2, -4, -1, -4, 10, 26, -40, -95, 111, 263,
+    -244, -621, 468, 1346, -856, -3034, 1830, 12000, 15834, 8375, -945, -2743,
+    283, 1294, -78, -615, 9, 265, 7, -96, -5, 25, 2, -3,
+    -1, -4, 10, 26, -42, -94, 115, 262, -253, -617, 488, 1340,
+    -899, -3027, 1943, 12113, 15803, 8242, -1021, -2719, 317, 1285, -95, -612,
+    17, 264, 4, -95, -4, 25, 2, -3, -1, -4, 11, 25,
+    -43, -93, 118, 260, -262, -613, 508, 1333, -941, -3019, 2057, 12224,
+    15771, 8108, -1096, -2694, 351, 1275, -111, -608, 25, 262, 1, -94,
+    -3, 25, 1, -3, -1, -4, 11, 25, -44, -92, 122, 258,
+    -271, -609, 528, 1326, -983, -3010, 2172, 12334, 15736, 7975, -1170, -2668,
+    384, 1265, -128, -603, 32, 260, -3, -94, -2, 25, 1, -3,
+    -1, -4, 11, 25, -46, -91, 126, 255, -280, -604, 548, 1318,
+    -1026, -3000, 2288, 12443, 15700, 7841, -1242, -2641, 417, 1255, -144, -599,
+    40, 259, -6, -93, -1, 25, 1, -3, -1, -4, 12, 25,
+    -47, -91, 130, 253, -289, -600, 567, 1309, -1068, -2988, 2405, 12551,
+    15661, 7707, -1313, -2614, 450, 1244, -160, -595, 47, 257, -9, -92,
+    0, 24, 1, -3, -1, -4, 12, 24, -48, -90, 133, 250,
+    -298, -594, 587, 1300, -1111, -2975, 2522, 12657, 15621, 7572, -1382, -2585,
+    482, 1233, -176, -590, 55, 255, -12, -92, 0, 24, 1, -3,
+    -1, -4, 12, 24, -50, -89, 137, 248, -307, -589, 607, 1290,
+    -1153, -2960, 2641, 12762, 15578, 7438, -1450, -2556, 513, 1222, -192, -585,
+    62, 253, -15, -91, 1, 24, 0, -3, -1, -4, 13, 24,
+    -51, -88, 141, 245, -316, -583, 626, 1280, -1196, -2945, 2761, 12866,
+    15534, 7304, -1517, -2527, 544, 1210, -207, -580, 69, 251, -17, -90,
+    2, 24, 0, -3, -1, -4, 13, 23, -52, -86, 145, 242,
+    -325, -577, 646, 1269, -1238, -2928, 2881, 12969, 15487, 7169, -1582, -2496,
+    575, 1198, -222, -574, 76, 249, -20, -89, 3, 23, 0, -3,
+    -1, -4, 13, 23, -53, -85, 148, 239, -334, -571, 665, 1257,
+    -1281, -2909, 3002, 13070, 15439, 7035, -1646, -2465, 605, 1185, -237, -569,
+    83, 246, -23, -89, 4, 23, 0, -3, -1, -4, 14, 23,
+    -55, -84, 152, 236, -343, -564, 685, 1245, -1323, -2890, 3124, 13170,
+    15389, 6900, -1708, -2434, 634, 1172, -252, -563, 90, 244, -26, -88,
+    5, 23, 0, -3, -1, -4, 14, 22, -56, -83, 156, 233,
+    -352, -557, 704, 1232, -1365, -2869, 3247, 13269, 15337, 6766, -1769, -2402,
+    663, 1159, -266, -557, 97, 242, -29, -87, 6, 23, -1, -3,
+    -1, -4, 14, 22, -57, -81, 159, 229, -361, -550, 723, 1219,
+    -1407, -2846, 3370, 13366, 15283, 6631, -1828, -2369, 692, 1145, -280, -551,
+    103, 239, -31, -86, 7, 22, -1, -3, -2, -3, 15, 22,
+    -59, -80, 163, 226, -370, -543, 742, 1205, -1449, -2822, 3494, 13462,
+    15227, 6497, -1886, -2335, 719, 1131, -294, -545, 110, 236, -34, -85,
+    8, 22, -1, -3, -2, -3, 15, 21, -60, -79, 167, 222,
+    -378, -535, 761, 1190, -1491, -2797, 3619, 13556, 15169, 6363, -1943, -2301,
+    747, 1117, -308, -539, 116, 234, -36, -84, 8, 22, -1, -3,
+    -2, -3, 15, 21, -61, -77, 170, 219, -387, -527, 780, 1175,
+    -1532, -2771, 3745, 13649, 15110, 6229, -1998, -2267, 774, 1103, -322, -533,
+    122, 231, -39, -83, 9, 22, -1, -3, -2, -3, 16, 20,
+    -62, -76, 174, 215, -395, -519, 799, 1159, -1574, -2743, 3871, 13741,
+    15048, 6095, -2051, -2232, 800, 1088, -335, -526, 129, 228, -41, -82,
+    10, 21, -1, -3, -2, -3, 16, 20, -64, -74, 177, 211,
+    -404, -510, 817, 1143, -1615, -2714, 3998, 13831, 14985, 5961, -2104, -2196,
+    826, 1073, -348, -519, 135, 226, -44, -81, 11, 21, -2, -3,
+    -2, -3, 16, 19, -65, -72, 181, 206, -412, -501, 836, 1126,
+    -1656, -2683, 4125, 13919, 14920, 5827, -2154, -2160, 851, 1057, -360, -512,
+    141, 223, -46, -80, 11, 21, -2, -2, -2, -3, 17, 19,
+    -66, -71, 184, 202, -421, -492, 854, 1108, -1697, -2651, 4253, 14006,
+    14854, 5694, -2204, -2124, 875, 1042, -373, -505, 146, 220, -48, -79,
+    12, 20, -2, -2, -2, -3, 17, 18, -67, -69, 188, 198,
+    -429, -483, 872, 1090, -1737, -2617, 4382, 14091, 14785, 5561, -2251, -2087,
+    899, 1026, -385, -498, 152, 217, -51, -78, 13, 20, -2, -2,
+    -2, -3, 17, 18, -69, -67, 191, 193, -437, -473, 890, 1071,
+    -1777, -2582, 4511, 14175, 14715, 5429, -2298, -2050, 923, 1010, -397, -491,
+    158, 214, -53, -77, 14, 20, -2, -2, -2, -3, 18, 17,
+    -70, -65, 195, 188, -445, -463, 908, 1052, -1817, -2546, 4641, 14257,
+    14643, 5296, -2343, -2012, 946, 993, -409, -484, 163, 211, -55, -76,
+    14, 19, -2, -2, -2, -3, 18, 17, -71, -63, 198, 184,
+    -453, -453, 925, 1032, -1857, -2508, 4771, 14337, 14569, 5165, -2386, -1974,
+    968, 976, -420, -476, 168, 208, -57, -74, 15, 19, -2, -2,
+    -2, -3, 18, 16, -72, -61, 201, 179, -461, -442, 942, 1011,
+    -1896, -2469, 4902, 14416, 14493, 5033, -2428, -1935, 990, 960, -431, -468,
+    174, 204, -59, -73, 15, 19, -2, -2, -2, -2, 19, 15,
+    -73, -59, 204, 174, -468, -431, 960, 990, -1935, -2428, 5033, 14493,
+    14416, 4902, -2469, -1896, 1011, 942, -442, -461, 179, 201, -61, -72,
+    16, 18, -3, -2, -2, -2, 19, 15, -74, -57, 208, 168,
+    -476, -420, 976, 968, -1974, -2386, 5165, 14569, 14337, 4771, -2508, -1857,
+    1032, 925, -453, -453, 184, 198, -63, -71, 17, 18, -3, -2,
+    -2, -2, 19, 14, -76, -55, 211, 163, -484, -409, 993, 946,
+    -2012, -2343, 5296, 14643, 14257, 4641, -2546, -1817, 1052, 908, -463, -445,
+    188, 195, -65, -70, 17, 18, -3, -2, -2, -2, 20, 14,
+    -77, -53, 214, 158, -491, -397, 1010, 923, -2050, -2298, 5429, 14715,
+    14175, 4511, -2582, -1777, 1071, 890, -473, -437, 193, 191, -67, -69,
+    18, 17, -3, -2, -2, -2, 20, 13, -78, -51, 217, 152,
+    -498, -385, 1026, 899, -2087, -2251, 5561, 14785, 14091, 4382, -2617, -1737,
+    1090, 872, -483, -429, 198, 188, -69, -67, 18, 17, -3, -2,
+    -2, -2, 20, 12, -79, -48, 220, 146, -505, -373, 1042, 875,
+    -2124, -2204, 5694, 14854, 14006, 4253, -2651, -1697, 1108, 854, -492, -421,
+    202, 184, -71, -66, 19, 17, -3, -2, -2, -2, 21, 11,
+    -80, -46, 223, 141, -512, -360, 1057, 851, -2160, -2154, 5827, 14920,
+    13919, 4125, -2683, -1656, 1126, 836, -501, -412, 206, 181, -72, -65,
+    19, 16, -3, -2, -3, -2, 21, 11, -81, -44, 226, 135,
+    -519, -348, 1073, 826, -2196, -2104, 5961, 14985, 13831, 3998, -2714, -1615,
+    1143, 817, -510, -404, 211, 177, -74, -64, 20, 16, -3, -2,
+    -3, -1, 21, 10, -82, -41, 228, 129, -526, -335, 1088, 800,
+    -2232, -2051, 6095, 15048, 13741, 3871, -2743, -1574, 1159, 799, -519, -395,
+    215, 174, -76, -62, 20, 16, -3, -2, -3, -1, 22, 9,
+    -83, -39, 231, 122, -533, -322, 1103, 774, -2267, -1998, 6229, 15110,
+    13649, 3745, -2771, -1532, 1175, 780, -527, -387, 219, 170, -77, -61,
+    21, 15, -3, -2, -3, -1, 22, 8, -84, -36, 234, 116,
+    -539, -308, 1117, 747, -2301, -1943, 6363, 15169, 13556, 3619, -2797, -1491,
+    1190, 761, -535, -378, 222, 167, -79, -60, 21, 15, -3, -2,
+    -3, -1, 22, 8, -85, -34, 236, 110, -545, -294, 1131, 719,
+    -2335, -1886, 6497, 15227, 13462, 3494, -2822, -1449, 1205, 742, -543, -370,
+    226, 163, -80, -59, 22, 15, -3, -2, -3, -1, 22, 7,
+    -86, -31, 239, 103, -551, -280, 1145, 692, -2369, -1828, 6631, 15283,
+    13366, 3370, -2846, -1407, 1219, 723, -550, -361, 229, 159, -81, -57,
+    22, 14, -4, -1, -3, -1, 23, 6, -87, -29, 242, 97,
+    -557, -266, 1159, 663, -2402, -1769, 6766, 15337, 13269, 3247, -2869, -1365,
+    1232, 704, -557, -352, 233, 156, -83, -56, 22, 14, -4, -1,
+    -3, 0, 23, 5, -88, -26, 244, 90, -563, -252, 1172, 634,
+    -2434, -1708, 6900, 15389, 13170, 3124, -2890, -1323, 1245, 685, -564, -343,
+    236, 152, -84, -55, 23, 14, -4, -1, -3, 0, 23, 4,
+    -89, -23, 246, 83, -569, -237, 1185, 605, -2465, -1646, 7035, 15439,
+    13070, 3002, -2909, -1281, 1257, 665, -571, -334, 239, 148, -85, -53,
+    23, 13, -4, -1, -3, 0, 23, 3, -89, -20, 249, 76,
+    -574, -222, 1198, 575, -2496, -1582, 7169, 15487, 12969, 2881, -2928, -1238,
+    1269, 646, -577, -325, 242, 145, -86, -52, 23, 13, -4, -1,
+    -3, 0, 24, 2, -90, -17, 251, 69, -580, -207, 1210, 544,
+    -2527, -1517, 7304, 15534, 12866, 2761, -2945, -1196, 1280, 626, -583, -316,
+    245, 141, -88, -51, 24, 13, -4, -1, -3, 0, 24, 1,
+    -91, -15, 253, 62, -585, -192, 1222, 513, -2556, -1450, 7438, 15578,
+    12762, 2641, -2960, -1153, 1290, 607, -589, -307, 248, 137, -89, -50,
+    24, 12, -4, -1, -3, 1, 24, 0, -92, -12, 255, 55,
+    -590, -176, 1233, 482, -2585, -1382, 7572, 15621, 12657, 2522, -2975, -1111,
+    1300, 587, -594, -298, 250, 133, -90, -48, 24, 12, -4, -1,
+    -3, 1, 24, 0, -92, -9, 257, 47, -595, -160, 1244, 450,
+    -2614, -1313, 7707, 15661, 12551, 2405, -2988, -1068, 1309, 567, -600, -289,
+    253, 130, -91, -47, 25, 12, -4, -1, -3, 1, 25, -1,
+    -93, -6, 259, 40, -599, -144, 1255, 417, -2641, -1242, 7841, 15700,
+    12443, 2288, -3000, -1026, 1318, 548, -604, -280, 255, 126, -91, -46,
+    25, 11, -4, -1, -3, 1, 25, -2, -94, -3, 260, 32,
+    -603, -128, 1265, 384, -2668, -1170, 7975, 15736, 12334, 2172, -3010, -983,
+    1326, 528, -609, -271, 258, 122, -92, -44, 25, 11, -4, -1,
+    -3, 1, 25, -3, -94, 1, 262, 25, -608, -111, 1275, 351,
+    -2694, -1096, 8108, 15771, 12224, 2057, -3019, -941, 1333, 508, -613, -262,
+    260, 118, -93, -43, 25, 11, -4, -1, -3, 2, 25, -4,
+    -95, 4, 264, 17, -612, -95, 1285, 317, -2719, -1021, 8242, 15803,
+    12113, 1943, -3027, -899, 1340, 488, -617, -253, 262, 115, -94, -42,
+    26, 10, -4, -1, -3, 2, 25, -5, -96, 7, 265, 9,
+    -615, -78, 1294, 283, -2743, -945, 8375, 15834, 12000, 1830, -3034, -856,
+    1346, 468, -621, -244, 263, 111, -95, -40, 26, 10, -4, -1,
+    -4, 2, 26, -7, -96, 10, 267, 1, -619, -61, 1302, 248,
+    -2767, -867, 8508, 15862, 11887, 1718, -3040, -814, 1352, 448, -625, -235,
+    265, 107, -95, -39, 26, 10, -4, -1, -4, 2, 26, -8,
+    -97, 13, 268, -7, -622, -44, 1311, 213, -2790, -788, 8641, 15889,
+    11772, 1607, -3044, -772, 1357, 429, -628, -225, 267, 103, -96, -38,
+    26, 9, -4, -1, -4, 3, 26, -9, -97, 17, 269, -15,
+    -625, -26, 1318, 177, -2812, -708, 8773, 15914, 11657, 1497, -3047, -730,
+    1362, 409, -631, -216, 268, 99, -96, -36, 26, 9, -4, -1,
+    -4, 3, 26, -10, -97, 20, 270, -23, -628, -9, 1326, 141,
+    -2833, -626, 8905, 15936, 11540, 1389, -3049, -688, 1366, 389, -633, -207,
+    269, 96, -97, -35, 26, 9, -4, -1, -4, 3, 26, -11,
+    -98, 23, 271, -31, -631, 9, 1333, 105, -2853, -542, 9037, 15957,
+    11423, 1281, -3049, -646, 1369, 369, -636, -198, 271, 92, -97, -34,
+    26, 8, -4, -1, -4, 3, 26, -12, -98, 27, 272, -39,
+    -633, 27, 1339, 68, -2873, -458, 9168, 15975, 11304, 1174, -3049, -604,
+    1372, 350, -638, -189, 272, 88, -98, -33, 27, 8, -4, -1,
+    -4, 4, 26, -13, -98, 30, 273, -48, -636, 45, 1345, 31,
+    -2891, -372, 9299, 15991, 11185, 1069, -3047, -563, 1374, 330, -640, -180,
+    273, 84, -98, -31, 27, 8, -4, -1, -4, 4, 26, -14,
+    -99, 33, 274, -56, -638, 63, 1350, -6, -2908, -285, 9429, 16006,
+    11064, 964, -3044, -521, 1376, 310, -641, -171, 274, 81, -99, -30,
+    27, 8, -4, -1, -4, 4, 27, -15, -99, 37, 275, -65,
+    -639, 81, 1356, -44, -2925, -196, 9558, 16018, 10943, 861, -3040, -480,
+    1377, 291, -642, -162, 274, 77, -99, -29, 27, 7, -4, -1,
+    -4, 4, 27, -17, -99, 40, 275, -73, -641, 100, 1360, -82,
+    -2941, -106, 9688, 16028, 10821, 759, -3035, -439, 1378, 271, -643, -153,
+    275, 73, -99, -28, 27, 7, -4, -1, -4, 5, 27, -18,
+    -99, 44, 276, -82, -642, 118, 1364, -121, -2955, -15, 9816, 16037,
+    10698, 658, -3029, -399, 1378, 252, -644, -144, 275, 69, -99, -26,
+    27, 7, -4, -1, -4, 5, 27, -19, -99, 48, 276, -91,
+    -643, 137, 1368, -160, -2969, 77, 9944, 16043, 10574, 558, -3021, -358,
+    1378, 232, -645, -135, 276, 66, -99, -25, 27, 6, -4, 0,
+    -4, 5, 27, -20, -100, 51, 276, -99, -644, 156, 1371, -199,
+    -2981, 171, 10071, 16047, 10449, 459, -3013, -318, 1377, 213, -645, -126,
+    276, 62, -99, -24, 27, 6, -4, 0, -4, 5, 27, -21,
+    -100, 55, 276, -108, -645, 175, 1373, -238, -2993, 266, 10198, 16049,
+    10324, 362, -3003, -278, 1375, 194, -645, -117, 276, 58, -100, -23,
+    27, 6, -4, 0,
+};
+
+// L/M=80/441, 64 taps: 44100->8000
+const int16_t kBank80x441x64[5120] = {
+    0, 0, 1, 3, 6, 10, 10, 5, -8, -28, -51, -68,
+    -66, -36, 28, 117, 209, 268, 258, 149, -63, -349, -638, -833,
+    -827, -529, 101, 1037, 2177, 3361, 4395, 5101, 5350, 5095, 4384, 3346,
+    2162, 1024, 92, -534, -828, -832, -635, -345, -60, 151, 259, 268,
+    208, 116, 27, -36, -67, -68, -51, -28, -7, 5, 10, 10,
+    6, 3, 1, 0, 0, 0, 1, 3, 6, 10, 10, 5,
+    -8, -28, -51, -68, -66, -35, 29, 118, 210, 269, 258, 147,
+    -67, -353, -641, -835, -825, -523, 111, 1050, 2192, 3375, 4407, 5107,
+    5350, 5089, 4373, 3332, 2148, 1011, 82, -540, -830, -831, -632, -341,
+    -57, 153, 260, 268, 207, 115, 26, -37, -67, -68, -50, -27,
+    -7, 5, 10, 9, 6, 3, 1, 0, 0, 0, 1, 3,
+    6, 10, 10, 5, -8, -28, -52, -68, -66, -35, 30, 119,
+    211, 269, 257, 145, -70, -356, -645, -836, -823, -517, 121, 1064,
+    2207, 3389, 4418, 5114, 5350, 5083, 4362, 3318, 2133, 997, 72, -546,
+    -832, -829, -628, -337, -54, 155, 260, 267, 206, 113, 25, -38,
+    -67, -68, -50, -27, -7, 6, 10, 9, 6, 3, 1, 0,
+    0, 0, 1, 3, 6, 10, 10, 5, -8, -29, -52, -68,
+    -66, -34, 31, 121, 212, 270, 256, 143, -73, -360, -648, -837,
+    -821, -511, 131, 1077, 2222, 3403, 4429, 5119, 5349, 5076, 4350, 3303,
+    2118, 984, 62, -551, -833, -828, -625, -334, -51, 157, 261, 267,
+    205, 112, 24, -38, -67, -67, -50, -27, -7, 6, 10, 9,
+    6, 3, 1, 0, 0, 0, 1, 3, 6, 10, 10, 5,
+    -8, -29, -52, -68, -66, -33, 32, 122, 213, 270, 255, 141,
+    -76, -364, -651, -839, -819, -505, 142, 1090, 2237, 3417, 4440, 5125,
+    5349, 5070, 4339, 3289, 2103, 971, 52, -557, -835, -826, -622, -330,
+    -47, 159, 262, 266, 203, 111, 23, -39, -67, -67, -50, -26,
+    -6, 6, 10, 9, 6, 3, 1, 0, 0, 0, 1, 3,
+    7, 10, 10, 5, -9, -29, -52, -68, -65, -33, 33, 123,
+    214, 270, 255, 139, -80, -368, -654, -840, -817, -499, 152, 1104,
+    2252, 3432, 4451, 5131, 5349, 5063, 4327, 3275, 2088, 958, 43, -562,
+    -836, -824, -618, -326, -44, 161, 262, 266, 202, 110, 22, -39,
+    -67, -67, -49, -26, -6, 6, 10, 9, 6, 3, 1, 0,
+    0, 0, 1, 3, 7, 10, 10, 5, -9, -30, -53, -69,
+    -65, -32, 34, 124, 215, 271, 254, 137, -83, -371, -657, -841,
+    -815, -493, 162, 1117, 2267, 3446, 4462, 5137, 5348, 5056, 4316, 3260,
+    2073, 945, 33, -568, -838, -823, -615, -322, -41, 163, 263, 266,
+    201, 109, 21, -40, -68, -67, -49, -26, -6, 6, 10, 9,
+    6, 3, 1, 0, 0, 0, 1, 3, 7, 10, 10, 4,
+    -9, -30, -53, -69, -65, -31, 35, 125, 216, 271, 253, 135,
+    -86, -375, -661, -842, -813, -487, 172, 1131, 2282, 3460, 4473, 5143,
+    5348, 5050, 4304, 3246, 2058, 932, 24, -573, -839, -821, -612, -319,
+    -38, 165, 263, 265, 200, 108, 20, -40, -68, -67, -49, -26,
+    -6, 6, 10, 9, 6, 3, 1, 0, 0, 0, 1, 3,
+    7, 10, 10, 4, -9, -30, -53, -69, -65, -31, 36, 127,
+    217, 271, 252, 132, -89, -379, -664, -844, -811, -481, 182, 1144,
+    2297, 3474, 4483, 5148, 5347, 5043, 4292, 3231, 2044, 919, 14, -579,
+    -841, -820, -608, -315, -35, 167, 264, 265, 199, 106, 19, -41,
+    -68, -67, -49, -25, -6, 6, 10, 9, 6, 3, 1, 0,
+    0, 0, 1, 3, 7, 10, 10, 4, -9, -30, -53, -69,
+    -65, -30, 37, 128, 218, 271, 251, 130, -93, -383, -667, -845,
+    -809, -475, 193, 1158, 2312, 3488, 4494, 5154, 5346, 5036, 4281, 3217,
+    2029, 906, 5, -584, -842, -818, -605, -311, -32, 169, 265, 264,
+    198, 105, 18, -41, -68, -67, -48, -25, -5, 6, 10, 9,
+    6, 3, 1, 0, 0, 0, 1, 3, 7, 10, 10, 4,
+    -10, -31, -54, -69, -64, -30, 38, 129, 219, 272, 250, 128,
+    -96, -386, -670, -846, -807, -468, 203, 1171, 2327, 3502, 4505, 5159,
+    5346, 5029, 4269, 3202, 2014, 893, -5, -589, -843, -816, -602, -307,
+    -29, 171, 265, 264, 197, 104, 17, -42, -68, -66, -48, -25,
+    -5, 6, 10, 9, 6, 3, 1, 0, 0, 0, 1, 3,
+    7, 10, 10, 4, -10, -31, -54, -69, -64, -29, 39, 130,
+    220, 272, 250, 126, -99, -390, -673, -847, -804, -462, 214, 1185,
+    2342, 3516, 4516, 5165, 5345, 5022, 4257, 3188, 1999, 880, -14, -594,
+    -844, -814, -598, -304, -26, 172, 266, 263, 196, 103, 17, -42,
+    -68, -66, -48, -24, -5, 6, 10, 9, 6, 3, 1, 0,
+    0, 0, 1, 3, 7, 10, 10, 4, -10, -31, -54, -69,
+    -64, -28, 40, 131, 221, 272, 249, 124, -103, -394, -676, -848,
+    -802, -456, 224, 1198, 2357, 3530, 4526, 5170, 5344, 5015, 4245, 3173,
+    1984, 868, -23, -599, -846, -813, -595, -300, -23, 174, 266, 263,
+    195, 102, 16, -43, -68, -66, -47, -24, -5, 7, 10, 9,
+    6, 2, 0, 0, 0, 0, 1, 3, 7, 10, 10, 4,
+    -10, -32, -55, -69, -64, -28, 41, 133, 222, 273, 248, 121,
+    -106, -398, -679, -849, -800, -449, 235, 1212, 2372, 3544, 4537, 5175,
+    5343, 5008, 4233, 3159, 1970, 855, -33, -604, -847, -811, -591, -296,
+    -19, 176, 267, 262, 194, 100, 15, -44, -69, -66, -47, -24,
+    -5, 7, 10, 9, 6, 2, 0, 0, 0, 0, 1, 3,
+    7, 10, 10, 4, -11, -32, -55, -69, -63, -27, 42, 134,
+    223, 273, 247, 119, -109, -402, -682, -850, -797, -443, 245, 1226,
+    2387, 3558, 4547, 5180, 5342, 5001, 4222, 3144, 1955, 842, -42, -609,
+    -848, -809, -588, -292, -16, 178, 267, 261, 193, 99, 14, -44,
+    -69, -66, -47, -24, -4, 7, 10, 9, 6, 2, 0, 0,
+    0, 0, 1, 4, 7, 10, 10, 4, -11, -32, -55, -69,
+    -63, -26, 43, 135, 223, 273, 246, 117, -113, -405, -685, -851,
+    -795, -436, 256, 1239, 2402, 3572, 4558, 5185, 5340, 4994, 4210, 3130,
+    1940, 829, -51, -614, -849, -807, -584, -289, -13, 180, 268, 261,
+    192, 98, 13, -45, -69, -66, -47, -23, -4, 7, 10, 9,
+    6, 2, 0, 0, 0, 0, 1, 4, 7, 10, 10, 3,
+    -11, -32, -55, -69, -63, -26, 44, 136, 224, 273, 245, 115,
+    -116, -409, -688, -851, -792, -429, 266, 1253, 2416, 3586, 4568, 5190,
+    5339, 4986, 4197, 3115, 1925, 817, -60, -619, -850, -805, -581, -285,
+    -10, 181, 268, 260, 191, 97, 12, -45, -69, -65, -46, -23,
+    -4, 7, 10, 9, 6, 2, 0, 0, 0, 0, 1, 4,
+    7, 10, 10, 3, -11, -33, -56, -70, -63, -25, 45, 137,
+    225, 273, 244, 112, -120, -413, -691, -852, -790, -423, 277, 1267,
+    2431, 3599, 4578, 5195, 5338, 4979, 4185, 3100, 1911, 804, -69, -624,
+    -851, -803, -577, -281, -7, 183, 268, 260, 189, 96, 11, -46,
+    -69, -65, -46, -23, -4, 7, 10, 9, 5, 2, 0, 0,
+    0, 0, 1, 4, 7, 10, 10, 3, -12, -33, -56, -70,
+    -62, -24, 46, 138, 226, 274, 243, 110, -123, -417, -694, -853,
+    -787, -416, 288, 1281, 2446, 3613, 4589, 5200, 5336, 4971, 4173, 3086,
+    1896, 791, -78, -629, -852, -801, -574, -277, -4, 185, 269, 259,
+    188, 95, 10, -46, -69, -65, -46, -23, -4, 7, 10, 9,
+    5, 2, 0, 0, 0, 0, 1, 4, 7, 10, 10, 3,
+    -12, -33, -56, -70, -62, -24, 47, 140, 227, 274, 242, 108,
+    -126, -420, -697, -854, -785, -409, 299, 1295, 2461, 3627, 4599, 5205,
+    5335, 4964, 4161, 3071, 1881, 779, -87, -634, -853, -799, -570, -274,
+    -1, 187, 269, 259, 187, 93, 9, -47, -69, -65, -45, -22,
+    -4, 7, 10, 9, 5, 2, 0, 0, 0, 0, 1, 4,
+    7, 10, 10, 3, -12, -34, -56, -70, -62, -23, 49, 141,
+    228, 274, 241, 105, -130, -424, -700, -855, -782, -403, 309, 1308,
+    2476, 3641, 4609, 5210, 5333, 4956, 4149, 3056, 1866, 766, -96, -638,
+    -854, -797, -567, -270, 1, 188, 270, 258, 186, 92, 8, -47,
+    -69, -65, -45, -22, -3, 7, 10, 9, 5, 2, 0, 0,
+    0, 0, 1, 4, 7, 10, 10, 3, -12, -34, -57, -70,
+    -62, -22, 50, 142, 229, 274, 240, 103, -133, -428, -703, -855,
+    -779, -396, 320, 1322, 2491, 3655, 4619, 5214, 5331, 4949, 4137, 3042,
+    1852, 754, -105, -643, -854, -795, -563, -266, 4, 190, 270, 257,
+    185, 91, 7, -48, -69, -65, -45, -22, -3, 7, 10, 9,
+    5, 2, 0, 0, 0, 0, 1, 4, 7, 10, 10, 3,
+    -12, -34, -57, -70, -61, -21, 51, 143, 230, 274, 239, 101,
+    -137, -432, -706, -856, -776, -389, 331, 1336, 2506, 3668, 4629, 5219,
+    5330, 4941, 4124, 3027, 1837, 741, -114, -648, -855, -793, -560, -263,
+    7, 192, 270, 257, 184, 90, 6, -48, -69, -64, -45, -21,
+    -3, 7, 10, 9, 5, 2, 0, 0, 0, 0, 1, 4,
+    7, 10, 10, 2, -13, -35, -57, -70, -61, -21, 52, 144,
+    231, 274, 238, 98, -140, -435, -709, -857, -774, -382, 342, 1350,
+    2521, 3682, 4639, 5223, 5328, 4933, 4112, 3012, 1822, 729, -122, -652,
+    -856, -791, -556, -259, 10, 193, 271, 256, 183, 89, 6, -48,
+    -70, -64, -44, -21, -3, 8, 10, 9, 5, 2, 0, 0,
+    0, 0, 1, 4, 7, 10, 9, 2, -13, -35, -57, -70,
+    -61, -20, 53, 146, 232, 274, 237, 96, -144, -439, -712, -857,
+    -771, -375, 353, 1364, 2536, 3695, 4649, 5228, 5326, 4925, 4100, 2998,
+    1808, 717, -131, -657, -856, -789, -553, -255, 13, 195, 271, 256,
+    182, 88, 5, -49, -70, -64, -44, -21, -3, 8, 10, 9,
+    5, 2, 0, 0, 0, 0, 1, 4, 7, 10, 9, 2,
+    -13, -35, -58, -70, -60, -19, 54, 147, 233, 274, 236, 93,
+    -147, -443, -714, -858, -768, -368, 364, 1378, 2551, 3709, 4659, 5232,
+    5324, 4917, 4087, 2983, 1793, 704, -140, -661, -857, -787, -549, -251,
+    16, 196, 271, 255, 181, 86, 4, -49, -70, -64, -44, -21,
+    -2, 8, 10, 9, 5, 2, 0, 0, 0, 0, 1, 4,
+    7, 10, 9, 2, -13, -35, -58, -70, -60, -19, 55, 148,
+    233, 275, 234, 91, -151, -447, -717, -858, -765, -361, 375, 1392,
+    2566, 3723, 4669, 5236, 5322, 4909, 4075, 2968, 1779, 692, -148, -666,
+    -858, -785, -546, -248, 19, 198, 272, 254, 179, 85, 3, -50,
+    -70, -64, -43, -20, -2, 8, 10, 9, 5, 2, 0, 0,
+    0, 0, 1, 4, 8, 10, 9, 2, -14, -36, -58, -70,
+    -60, -18, 56, 149, 234, 275, 233, 88, -154, -450, -720, -859,
+    -762, -353, 387, 1406, 2581, 3736, 4678, 5241, 5320, 4901, 4062, 2953,
+    1764, 680, -157, -670, -858, -783, -542, -244, 22, 200, 272, 254,
+    178, 84, 2, -50, -70, -63, -43, -20, -2, 8, 10, 9,
+    5, 2, 0, 0, 0, 0, 1, 4, 8, 10, 9, 2,
+    -14, -36, -58, -70, -59, -17, 57, 150, 235, 275, 232, 86,
+    -158, -454, -723, -859, -759, -346, 398, 1420, 2596, 3750, 4688, 5245,
+    5318, 4893, 4050, 2939, 1750, 667, -165, -674, -859, -780, -539, -240,
+    25, 201, 272, 253, 177, 83, 1, -51, -70, -63, -43, -20,
+    -2, 8, 10, 9, 5, 2, 0, 0, 0, 0, 1, 4,
+    8, 10, 9, 2, -14, -36, -58, -70, -59, -16, 58, 152,
+    236, 275, 231, 83, -161, -458, -726, -860, -756, -339, 409, 1434,
+    2611, 3763, 4698, 5249, 5315, 4885, 4037, 2924, 1735, 655, -174, -678,
+    -859, -778, -535, -237, 27, 203, 272, 252, 176, 82, 0, -51,
+    -70, -63, -42, -20, -2, 8, 10, 8, 5, 2, 0, 0,
+    0, 0, 1, 4, 8, 10, 9, 1, -14, -37, -59, -70,
+    -59, -16, 59, 153, 237, 275, 230, 81, -165, -462, -728, -860,
+    -752, -332, 420, 1448, 2626, 3776, 4707, 5253, 5313, 4877, 4024, 2909,
+    1720, 643, -182, -683, -860, -776, -531, -233, 30, 204, 273, 252,
+    175, 81, 0, -52, -70, -63, -42, -19, -2, 8, 10, 8,
+    5, 2, 0, 0, 0, 0, 1, 4, 8, 10, 9, 1,
+    -15, -37, -59, -70, -58, -15, 60, 154, 238, 275, 229, 78,
+    -168, -465, -731, -860, -749, -324, 432, 1462, 2641, 3790, 4717, 5257,
+    5310, 4868, 4012, 2894, 1706, 631, -190, -687, -860, -774, -528, -229,
+    33, 206, 273, 251, 174, 80, -1, -52, -70, -63, -42, -19,
+    -1, 8, 10, 8, 5, 2, 0, 0, 0, 0, 1, 4,
+    8, 10, 9, 1, -15, -37, -59, -70, -58, -14, 62, 155,
+    239, 275, 227, 76, -172, -469, -734, -861, -746, -317, 443, 1477,
+    2656, 3803, 4726, 5260, 5308, 4860, 3999, 2879, 1691, 619, -199, -691,
+    -860, -771, -524, -226, 36, 207, 273, 250, 173, 78, -2, -52,
+    -70, -62, -42, -19, -1, 8, 10, 8, 5, 2, 0, 0,
+    0, 0, 1, 4, 8, 10, 9, 1, -15, -37, -59, -70,
+    -58, -13, 63, 156, 239, 275, 226, 73, -175, -473, -736, -861,
+    -743, -309, 455, 1491, 2671, 3816, 4735, 5264, 5305, 4851, 3986, 2865,
+    1677, 607, -207, -695, -861, -769, -521, -222, 39, 209, 273, 249,
+    171, 77, -3, -53, -70, -62, -41, -18, -1, 8, 10, 8,
+    5, 2, 0, 0, 0, 0, 1, 4, 8, 10, 9, 1,
+    -15, -38, -60, -70, -57, -13, 64, 157, 240, 275, 225, 71,
+    -179, -476, -739, -861, -739, -302, 466, 1505, 2686, 3830, 4745, 5268,
+    5303, 4843, 3973, 2850, 1663, 595, -215, -699, -861, -767, -517, -218,
+    41, 210, 274, 249, 170, 76, -4, -53, -70, -62, -41, -18,
+    -1, 8, 10, 8, 5, 2, 0, 0, 0, 0, 2, 4,
+    8, 10, 9, 1, -16, -38, -60, -70, -57, -12, 65, 159,
+    241, 275, 224, 68, -182, -480, -742, -861, -736, -294, 478, 1519,
+    2701, 3843, 4754, 5271, 5300, 4834, 3960, 2835, 1648, 583, -223, -703,
+    -861, -764, -513, -215, 44, 212, 274, 248, 169, 75, -5, -54,
+    -70, -62, -41, -18, -1, 8, 10, 8, 5, 2, 0, 0,
+    0, 0, 2, 4, 8, 10, 9, 1, -16, -38, -60, -70,
+    -57, -11, 66, 160, 242, 275, 222, 65, -186, -484, -744, -861,
+    -732, -286, 489, 1533, 2716, 3856, 4763, 5275, 5297, 4826, 3948, 2820,
+    1634, 571, -231, -707, -861, -762, -510, -211, 47, 213, 274, 247,
+    168, 74, -5, -54, -70, -62, -40, -18, -1, 8, 10, 8,
+    5, 2, 0, 0, 0, 0, 2, 4, 8, 10, 9, 0,
+    -16, -39, -60, -70, -56, -10, 67, 161, 243, 275, 221, 63,
+    -190, -488, -747, -862, -729, -279, 501, 1548, 2731, 3869, 4772, 5278,
+    5294, 4817, 3935, 2805, 1619, 559, -239, -711, -861, -759, -506, -208,
+    50, 214, 274, 247, 167, 73, -6, -54, -70, -61, -40, -17,
+    0, 9, 10, 8, 5, 2, 0, 0, 0, 0, 2, 4,
+    8, 10, 9, 0, -16, -39, -61, -70, -56, -9, 68, 162,
+    243, 275, 220, 60, -193, -491, -749, -862, -725, -271, 512, 1562,
+    2746, 3882, 4781, 5281, 5291, 4808, 3922, 2790, 1605, 548, -247, -714,
+    -862, -757, -502, -204, 52, 216, 274, 246, 166, 72, -7, -55,
+    -70, -61, -40, -17, 0, 9, 10, 8, 5, 2, 0, 0,
+    0, 0, 2, 4, 8, 10, 9, 0, -17, -39, -61, -70,
+    -56, -9, 69, 163, 244, 274, 218, 58, -197, -495, -752, -862,
+    -722, -263, 524, 1576, 2760, 3896, 4790, 5285, 5288, 4799, 3909, 2775,
+    1591, 536, -255, -718, -862, -754, -499, -200, 55, 217, 274, 245,
+    164, 70, -8, -55, -70, -61, -40, -17, 0, 9, 10, 8,
+    5, 2, 0, 0, 0, 0, 2, 5, 8, 10, 9, 0,
+    -17, -40, -61, -70, -55, -8, 70, 164, 245, 274, 217, 55,
+    -200, -499, -754, -862, -718, -255, 536, 1591, 2775, 3909, 4799, 5288,
+    5285, 4790, 3896, 2760, 1576, 524, -263, -722, -862, -752, -495, -197,
+    58, 218, 274, 244, 163, 69, -9, -56, -70, -61, -39, -17,
+    0, 9, 10, 8, 4, 2, 0, 0, 0, 0, 2, 5,
+    8, 10, 9, 0, -17, -40, -61, -70, -55, -7, 72, 166,
+    246, 274, 216, 52, -204, -502, -757, -862, -714, -247, 548, 1605,
+    2790, 3922, 4808, 5291, 5281, 4781, 3882, 2746, 1562, 512, -271, -725,
+    -862, -749, -491, -193, 60, 220, 275, 243, 162, 68, -9, -56,
+    -70, -61, -39, -16, 0, 9, 10, 8, 4, 2, 0, 0,
+    0, 0, 2, 5, 8, 10, 9, 0, -17, -40, -61, -70,
+    -54, -6, 73, 167, 247, 274, 214, 50, -208, -506, -759, -861,
+    -711, -239, 559, 1619, 2805, 3935, 4817, 5294, 5278, 4772, 3869, 2731,
+    1548, 501, -279, -729, -862, -747, -488, -190, 63, 221, 275, 243,
+    161, 67, -10, -56, -70, -60, -39, -16, 0, 9, 10, 8,
+    4, 2, 0, 0, 0, 0, 2, 5, 8, 10, 8, -1,
+    -18, -40, -62, -70, -54, -5, 74, 168, 247, 274, 213, 47,
+    -211, -510, -762, -861, -707, -231, 571, 1634, 2820, 3948, 4826, 5297,
+    5275, 4763, 3856, 2716, 1533, 489, -286, -732, -861, -744, -484, -186,
+    65, 222, 275, 242, 160, 66, -11, -57, -70, -60, -38, -16,
+    1, 9, 10, 8, 4, 2, 0, 0, 0, 0, 2, 5,
+    8, 10, 8, -1, -18, -41, -62, -70, -54, -5, 75, 169,
+    248, 274, 212, 44, -215, -513, -764, -861, -703, -223, 583, 1648,
+    2835, 3960, 4834, 5300, 5271, 4754, 3843, 2701, 1519, 478, -294, -736,
+    -861, -742, -480, -182, 68, 224, 275, 241, 159, 65, -12, -57,
+    -70, -60, -38, -16, 1, 9, 10, 8, 4, 2, 0, 0,
+    0, 0, 2, 5, 8, 10, 8, -1, -18, -41, -62, -70,
+    -53, -4, 76, 170, 249, 274, 210, 41, -218, -517, -767, -861,
+    -699, -215, 595, 1663, 2850, 3973, 4843, 5303, 5268, 4745, 3830, 2686,
+    1505, 466, -302, -739, -861, -739, -476, -179, 71, 225, 275, 240,
+    157, 64, -13, -57, -70, -60, -38, -15, 1, 9, 10, 8,
+    4, 1, 0, 0, 0, 0, 2, 5, 8, 10, 8, -1,
+    -18, -41, -62, -70, -53, -3, 77, 171, 249, 273, 209, 39,
+    -222, -521, -769, -861, -695, -207, 607, 1677, 2865, 3986, 4851, 5305,
+    5264, 4735, 3816, 2671, 1491, 455, -309, -743, -861, -736, -473, -175,
+    73, 226, 275, 239, 156, 63, -13, -58, -70, -59, -37, -15,
+    1, 9, 10, 8, 4, 1, 0, 0, 0, 0, 2, 5,
+    8, 10, 8, -1, -19, -42, -62, -70, -52, -2, 78, 173,
+    250, 273, 207, 36, -226, -524, -771, -860, -691, -199, 619, 1691,
+    2879, 3999, 4860, 5308, 5260, 4726, 3803, 2656, 1477, 443, -317, -746,
+    -861, -734, -469, -172, 76, 227, 275, 239, 155, 62, -14, -58,
+    -70, -59, -37, -15, 1, 9, 10, 8, 4, 1, 0, 0,
+    0, 0, 2, 5, 8, 10, 8, -1, -19, -42, -63, -70,
+    -52, -1, 80, 174, 251, 273, 206, 33, -229, -528, -774, -860,
+    -687, -190, 631, 1706, 2894, 4012, 4868, 5310, 5257, 4717, 3790, 2641,
+    1462, 432, -324, -749, -860, -731, -465, -168, 78, 229, 275, 238,
+    154, 60, -15, -58, -70, -59, -37, -15, 1, 9, 10, 8,
+    4, 1, 0, 0, 0, 0, 2, 5, 8, 10, 8, -2,
+    -19, -42, -63, -70, -52, 0, 81, 175, 252, 273, 204, 30,
+    -233, -531, -776, -860, -683, -182, 643, 1720, 2909, 4024, 4877, 5313,
+    5253, 4707, 3776, 2626, 1448, 420, -332, -752, -860, -728, -462, -165,
+    81, 230, 275, 237, 153, 59, -16, -59, -70, -59, -37, -14,
+    1, 9, 10, 8, 4, 1, 0, 0, 0, 0, 2, 5,
+    8, 10, 8, -2, -20, -42, -63, -70, -51, 0, 82, 176,
+    252, 272, 203, 27, -237, -535, -778, -859, -678, -174, 655, 1735,
+    2924, 4037, 4885, 5315, 5249, 4698, 3763, 2611, 1434, 409, -339, -756,
+    -860, -726, -458, -161, 83, 231, 275, 236, 152, 58, -16, -59,
+    -70, -58, -36, -14, 2, 9, 10, 8, 4, 1, 0, 0,
+    0, 0, 2, 5, 9, 10, 8, -2, -20, -43, -63, -70,
+    -51, 1, 83, 177, 253, 272, 201, 25, -240, -539, -780, -859,
+    -674, -165, 667, 1750, 2939, 4050, 4893, 5318, 5245, 4688, 3750, 2596,
+    1420, 398, -346, -759, -859, -723, -454, -158, 86, 232, 275, 235,
+    150, 57, -17, -59, -70, -58, -36, -14, 2, 9, 10, 8,
+    4, 1, 0, 0, 0, 0, 2, 5, 9, 10, 8, -2,
+    -20, -43, -63, -70, -50, 2, 84, 178, 254, 272, 200, 22,
+    -244, -542, -783, -858, -670, -157, 680, 1764, 2953, 4062, 4901, 5320,
+    5241, 4678, 3736, 2581, 1406, 387, -353, -762, -859, -720, -450, -154,
+    88, 233, 275, 234, 149, 56, -18, -60, -70, -58, -36, -14,
+    2, 9, 10, 8, 4, 1, 0, 0, 0, 0, 2, 5,
+    9, 10, 8, -2, -20, -43, -64, -70, -50, 3, 85, 179,
+    254, 272, 198, 19, -248, -546, -785, -858, -666, -148, 692, 1779,
+    2968, 4075, 4909, 5322, 5236, 4669, 3723, 2566, 1392, 375, -361, -765,
+    -858, -717, -447, -151, 91, 234, 275, 233, 148, 55, -19, -60,
+    -70, -58, -35, -13, 2, 9, 10, 7, 4, 1, 0, 0,
+    0, 0, 2, 5, 9, 10, 8, -2, -21, -44, -64, -70,
+    -49, 4, 86, 181, 255, 271, 196, 16, -251, -549, -787, -857,
+    -661, -140, 704, 1793, 2983, 4087, 4917, 5324, 5232, 4659, 3709, 2551,
+    1378, 364, -368, -768, -858, -714, -443, -147, 93, 236, 274, 233,
+    147, 54, -19, -60, -70, -58, -35, -13, 2, 9, 10, 7,
+    4, 1, 0, 0, 0, 0, 2, 5, 9, 10, 8, -3,
+    -21, -44, -64, -70, -49, 5, 88, 182, 256, 271, 195, 13,
+    -255, -553, -789, -856, -657, -131, 717, 1808, 2998, 4100, 4925, 5326,
+    5228, 4649, 3695, 2536, 1364, 353, -375, -771, -857, -712, -439, -144,
+    96, 237, 274, 232, 146, 53, -20, -61, -70, -57, -35, -13,
+    2, 9, 10, 7, 4, 1, 0, 0, 0, 0, 2, 5,
+    9, 10, 8, -3, -21, -44, -64, -70, -48, 6, 89, 183,
+    256, 271, 193, 10, -259, -556, -791, -856, -652, -122, 729, 1822,
+    3012, 4112, 4933, 5328, 5223, 4639, 3682, 2521, 1350, 342, -382, -774,
+    -857, -709, -435, -140, 98, 238, 274, 231, 144, 52, -21, -61,
+    -70, -57, -35, -13, 2, 10, 10, 7, 4, 1, 0, 0,
+    0, 0, 2, 5, 9, 10, 7, -3, -21, -45, -64, -69,
+    -48, 6, 90, 184, 257, 270, 192, 7, -263, -560, -793, -855,
+    -648, -114, 741, 1837, 3027, 4124, 4941, 5330, 5219, 4629, 3668, 2506,
+    1336, 331, -389, -776, -856, -706, -432, -137, 101, 239, 274, 230,
+    143, 51, -21, -61, -70, -57, -34, -12, 3, 10, 10, 7,
+    4, 1, 0, 0, 0, 0, 2, 5, 9, 10, 7, -3,
+    -22, -45, -65, -69, -48, 7, 91, 185, 257, 270, 190, 4,
+    -266, -563, -795, -854, -643, -105, 754, 1852, 3042, 4137, 4949, 5331,
+    5214, 4619, 3655, 2491, 1322, 320, -396, -779, -855, -703, -428, -133,
+    103, 240, 274, 229, 142, 50, -22, -62, -70, -57, -34, -12,
+    3, 10, 10, 7, 4, 1, 0, 0, 0, 0, 2, 5,
+    9, 10, 7, -3, -22, -45, -65, -69, -47, 8, 92, 186,
+    258, 270, 188, 1, -270, -567, -797, -854, -638, -96, 766, 1866,
+    3056, 4149, 4956, 5333, 5210, 4609, 3641, 2476, 1308, 309, -403, -782,
+    -855, -700, -424, -130, 105, 241, 274, 228, 141, 49, -23, -62,
+    -70, -56, -34, -12, 3, 10, 10, 7, 4, 1, 0, 0,
+    0, 0, 2, 5, 9, 10, 7, -4, -22, -45, -65, -69,
+    -47, 9, 93, 187, 259, 269, 187, -1, -274, -570, -799, -853,
+    -634, -87, 779, 1881, 3071, 4161, 4964, 5335, 5205, 4599, 3627, 2461,
+    1295, 299, -409, -785, -854, -697, -420, -126, 108, 242, 274, 227,
+    140, 47, -24, -62, -70, -56, -33, -12, 3, 10, 10, 7,
+    4, 1, 0, 0, 0, 0, 2, 5, 9, 10, 7, -4,
+    -23, -46, -65, -69, -46, 10, 95, 188, 259, 269, 185, -4,
+    -277, -574, -801, -852, -629, -78, 791, 1896, 3086, 4173, 4971, 5336,
+    5200, 4589, 3613, 2446, 1281, 288, -416, -787, -853, -694, -417, -123,
+    110, 243, 274, 226, 138, 46, -24, -62, -70, -56, -33, -12,
+    3, 10, 10, 7, 4, 1, 0, 0, 0, 0, 2, 5,
+    9, 10, 7, -4, -23, -46, -65, -69, -46, 11, 96, 189,
+    260, 268, 183, -7, -281, -577, -803, -851, -624, -69, 804, 1911,
+    3100, 4185, 4979, 5338, 5195, 4578, 3599, 2431, 1267, 277, -423, -790,
+    -852, -691, -413, -120, 112, 244, 273, 225, 137, 45, -25, -63,
+    -70, -56, -33, -11, 3, 10, 10, 7, 4, 1, 0, 0,
+    0, 0, 2, 6, 9, 10, 7, -4, -23, -46, -65, -69,
+    -45, 12, 97, 191, 260, 268, 181, -10, -285, -581, -805, -850,
+    -619, -60, 817, 1925, 3115, 4197, 4986, 5339, 5190, 4568, 3586, 2416,
+    1253, 266, -429, -792, -851, -688, -409, -116, 115, 245, 273, 224,
+    136, 44, -26, -63, -69, -55, -32, -11, 3, 10, 10, 7,
+    4, 1, 0, 0, 0, 0, 2, 6, 9, 10, 7, -4,
+    -23, -47, -66, -69, -45, 13, 98, 192, 261, 268, 180, -13,
+    -289, -584, -807, -849, -614, -51, 829, 1940, 3130, 4210, 4994, 5340,
+    5185, 4558, 3572, 2402, 1239, 256, -436, -795, -851, -685, -405, -113,
+    117, 246, 273, 223, 135, 43, -26, -63, -69, -55, -32, -11,
+    4, 10, 10, 7, 4, 1, 0, 0, 0, 0, 2, 6,
+    9, 10, 7, -4, -24, -47, -66, -69, -44, 14, 99, 193,
+    261, 267, 178, -16, -292, -588, -809, -848, -609, -42, 842, 1955,
+    3144, 4222, 5001, 5342, 5180, 4547, 3558, 2387, 1226, 245, -443, -797,
+    -850, -682, -402, -109, 119, 247, 273, 223, 134, 42, -27, -63,
+    -69, -55, -32, -11, 4, 10, 10, 7, 3, 1, 0, 0,
+    0, 0, 2, 6, 9, 10, 7, -5, -24, -47, -66, -69,
+    -44, 15, 100, 194, 262, 267, 176, -19, -296, -591, -811, -847,
+    -604, -33, 855, 1970, 3159, 4233, 5008, 5343, 5175, 4537, 3544, 2372,
+    1212, 235, -449, -800, -849, -679, -398, -106, 121, 248, 273, 222,
+    133, 41, -28, -64, -69, -55, -32, -10, 4, 10, 10, 7,
+    3, 1, 0, 0, 0, 0, 2, 6, 9, 10, 7, -5,
+    -24, -47, -66, -68, -43, 16, 102, 195, 263, 266, 174, -23,
+    -300, -595, -813, -846, -599, -23, 868, 1984, 3173, 4245, 5015, 5344,
+    5170, 4526, 3530, 2357, 1198, 224, -456, -802, -848, -676, -394, -103,
+    124, 249, 272, 221, 131, 40, -28, -64, -69, -54, -31, -10,
+    4, 10, 10, 7, 3, 1, 0, 0, 0, 1, 3, 6,
+    9, 10, 6, -5, -24, -48, -66, -68, -42, 17, 103, 196,
+    263, 266, 172, -26, -304, -598, -814, -844, -594, -14, 880, 1999,
+    3188, 4257, 5022, 5345, 5165, 4516, 3516, 2342, 1185, 214, -462, -804,
+    -847, -673, -390, -99, 126, 250, 272, 220, 130, 39, -29, -64,
+    -69, -54, -31, -10, 4, 10, 10, 7, 3, 1, 0, 0,
+    0, 1, 3, 6, 9, 10, 6, -5, -25, -48, -66, -68,
+    -42, 17, 104, 197, 264, 265, 171, -29, -307, -602, -816, -843,
+    -589, -5, 893, 2014, 3202, 4269, 5029, 5346, 5159, 4505, 3502, 2327,
+    1171, 203, -468, -807, -846, -670, -386, -96, 128, 250, 272, 219,
+    129, 38, -30, -64, -69, -54, -31, -10, 4, 10, 10, 7,
+    3, 1, 0, 0, 0, 1, 3, 6, 9, 10, 6, -5,
+    -25, -48, -67, -68, -41, 18, 105, 198, 264, 265, 169, -32,
+    -311, -605, -818, -842, -584, 5, 906, 2029, 3217, 4281, 5036, 5346,
+    5154, 4494, 3488, 2312, 1158, 193, -475, -809, -845, -667, -383, -93,
+    130, 251, 271, 218, 128, 37, -30, -65, -69, -53, -30, -9,
+    4, 10, 10, 7, 3, 1, 0, 0, 0, 1, 3, 6,
+    9, 10, 6, -6, -25, -49, -67, -68, -41, 19, 106, 199,
+    265, 264, 167, -35, -315, -608, -820, -841, -579, 14, 919, 2044,
+    3231, 4292, 5043, 5347, 5148, 4483, 3474, 2297, 1144, 182, -481, -811,
+    -844, -664, -379, -89, 132, 252, 271, 217, 127, 36, -31, -65,
+    -69, -53, -30, -9, 4, 10, 10, 7, 3, 1, 0, 0,
+    0, 1, 3, 6, 9, 10, 6, -6, -26, -49, -67, -68,
+    -40, 20, 108, 200, 265, 263, 165, -38, -319, -612, -821, -839,
+    -573, 24, 932, 2058, 3246, 4304, 5050, 5348, 5143, 4473, 3460, 2282,
+    1131, 172, -487, -813, -842, -661, -375, -86, 135, 253, 271, 216,
+    125, 35, -31, -65, -69, -53, -30, -9, 4, 10, 10, 7,
+    3, 1, 0, 0, 0, 1, 3, 6, 9, 10, 6, -6,
+    -26, -49, -67, -68, -40, 21, 109, 201, 266, 263, 163, -41,
+    -322, -615, -823, -838, -568, 33, 945, 2073, 3260, 4316, 5056, 5348,
+    5137, 4462, 3446, 2267, 1117, 162, -493, -815, -841, -657, -371, -83,
+    137, 254, 271, 215, 124, 34, -32, -65, -69, -53, -30, -9,
+    5, 10, 10, 7, 3, 1, 0, 0, 0, 1, 3, 6,
+    9, 10, 6, -6, -26, -49, -67, -67, -39, 22, 110, 202,
+    266, 262, 161, -44, -326, -618, -824, -836, -562, 43, 958, 2088,
+    3275, 4327, 5063, 5349, 5131, 4451, 3432, 2252, 1104, 152, -499, -817,
+    -840, -654, -368, -80, 139, 255, 270, 214, 123, 33, -33, -65,
+    -68, -52, -29, -9, 5, 10, 10, 7, 3, 1, 0, 0,
+    0, 1, 3, 6, 9, 10, 6, -6, -26, -50, -67, -67,
+    -39, 23, 111, 203, 266, 262, 159, -47, -330, -622, -826, -835,
+    -557, 52, 971, 2103, 3289, 4339, 5070, 5349, 5125, 4440, 3417, 2237,
+    1090, 142, -505, -819, -839, -651, -364, -76, 141, 255, 270, 213,
+    122, 32, -33, -66, -68, -52, -29, -8, 5, 10, 10, 6,
+    3, 1, 0, 0, 0, 1, 3, 6, 9, 10, 6, -7,
+    -27, -50, -67, -67, -38, 24, 112, 205, 267, 261, 157, -51,
+    -334, -625, -828, -833, -551, 62, 984, 2118, 3303, 4350, 5076, 5349,
+    5119, 4429, 3403, 2222, 1077, 131, -511, -821, -837, -648, -360, -73,
+    143, 256, 270, 212, 121, 31, -34, -66, -68, -52, -29, -8,
+    5, 10, 10, 6, 3, 1, 0, 0, 0, 1, 3, 6,
+    9, 10, 6, -7, -27, -50, -68, -67, -38, 25, 113, 206,
+    267, 260, 155, -54, -337, -628, -829, -832, -546, 72, 997, 2133,
+    3318, 4362, 5083, 5350, 5114, 4418, 3389, 2207, 1064, 121, -517, -823,
+    -836, -645, -356, -70, 145, 257, 269, 211, 119, 30, -35, -66,
+    -68, -52, -28, -8, 5, 10, 10, 6, 3, 1, 0, 0,
+    0, 1, 3, 6, 9, 10, 5, -7, -27, -50, -68, -67,
+    -37, 26, 115, 207, 268, 260, 153, -57, -341, -632, -831, -830,
+    -540, 82, 1011, 2148, 3332, 4373, 5089, 5350, 5107, 4407, 3375, 2192,
+    1050, 111, -523, -825, -835, -641, -353, -67, 147, 258, 269, 210,
+    118, 29, -35, -66, -68, -51, -28, -8, 5, 10, 10, 6,
+    3, 1, 0, 0, 0, 1, 3, 6, 10, 10, 5, -7,
+    -28, -51, -68, -67, -36, 27, 116, 208, 268, 259, 151, -60,
+    -345, -635, -832, -828, -534, 92, 1024, 2162, 3346, 4384, 5095, 5350,
+    5101, 4395, 3361, 2177, 1037, 101, -529, -827, -833, -638, -349, -63,
+    149, 258, 268, 209, 117, 28, -36, -66, -68, -51, -28, -8,
+    5, 10, 10, 6, 3, 1, 0, 0,
+};
+
+// L/M=147/80, 16 taps: 24000->44100
+const int16_t kBank147x80x16[2352] = {
+    -1, 21, -111, 360, -848, 1576, -2409, 3126, 29489, 2924, -2334, 1546,
+    -838, 358, -111, 21, -1, 21, -112, 362, -858, 1605, -2484, 3330,
+    29486, 2724, -2259, 1516, -828, 355, -111, 21, -1, 21, -112, 365,
+    -868, 1634, -2559, 3537, 29478, 2525, -2183, 1486, -818, 353, -110, 21,
+    -1, 21, -112, 367, -877, 1663, -2633, 3744, 29467, 2329, -2108, 1455,
+    -807, 350, -110, 21, -1, 21, -112, 369, -886, 1691, -2707, 3954,
+    29451, 2135, -2033, 1424, -796, 347, -110, 21, -1, 20, -112, 370,
+    -895, 1719, -2781, 4166, 29432, 1942, -1957, 1393, -785, 344, -109, 21,
+    -1, 20, -112, 372, -903, 1746, -2855, 4379, 29410, 1752, -1882, 1362,
+    -774, 341, -109, 21, -1, 20, -112, 374, -911, 1773, -2928, 4594,
+    29383, 1564, -1806, 1330, -762, 338, -108, 21, -1, 20, -112, 375,
+    -919, 1800, -3001, 4810, 29353, 1378, -1731, 1299, -750, 334, -107, 21,
+    -1, 20, -112, 376, -927, 1826, -3073, 5029, 29318, 1195, -1656, 1267,
+    -739, 331, -107, 21, -1, 20, -111, 377, -935, 1852, -3145, 5248,
+    29281, 1013, -1581, 1234, -727, 327, -106, 20, -1, 20, -111, 378,
+    -942, 1877, -3217, 5470, 29239, 834, -1506, 1202, -715, 324, -105, 20,
+    -1, 19, -111, 379, -948, 1902, -3288, 5692, 29193, 657, -1431, 1170,
+    -702, 320, -105, 20, -1, 19, -110, 380, -955, 1926, -3358, 5917,
+    29144, 482, -1356, 1137, -690, 316, -104, 20, -1, 19, -110, 380,
+    -961, 1950, -3428, 6143, 29091, 310, -1282, 1104, -677, 313, -103, 20,
+    -1, 19, -109, 381, -967, 1973, -3497, 6370, 29035, 140, -1208, 1072,
+    -664, 309, -102, 20, -1, 18, -109, 381, -972, 1995, -3566, 6598,
+    28975, -28, -1134, 1039, -652, 305, -101, 20, -1, 18, -108, 381,
+    -977, 2017, -3634, 6828, 28911, -193, -1061, 1006, -639, 301, -100, 20,
+    -1, 18, -107, 381, -982, 2039, -3701, 7059, 28843, -356, -988, 973,
+    -626, 296, -99, 20, -1, 18, -107, 380, -987, 2060, -3768, 7291,
+    28772, -517, -915, 940, -612, 292, -98, 19, -1, 17, -106, 380,
+    -991, 2080, -3833, 7525, 28697, -675, -842, 906, -599, 288, -97, 19,
+    -1, 17, -105, 379, -995, 2100, -3898, 7759, 28618, -830, -770, 873,
+    -586, 284, -96, 19, -1, 16, -104, 379, -998, 2119, -3962, 7995,
+    28536, -984, -699, 840, -572, 279, -95, 19, -1, 16, -103, 378,
+    -1001, 2137, -4026, 8232, 28450, -1134, -627, 807, -559, 275, -94, 19,
+    -1, 16, -102, 376, -1004, 2155, -4088, 8469, 28361, -1283, -557, 774,
+    -545, 270, -93, 18, 0, 15, -101, 375, -1006, 2172, -4149, 8708,
+    28268, -1428, -487, 741, -532, 266, -92, 18, 0, 15, -99, 374,
+    -1008, 2188, -4210, 8947, 28172, -1572, -417, 707, -518, 261, -91, 18,
+    0, 14, -98, 372, -1009, 2204, -4269, 9188, 28072, -1712, -348, 674,
+    -504, 256, -89, 18, 0, 14, -97, 370, -1010, 2218, -4327, 9429,
+    27969, -1850, -279, 641, -490, 252, -88, 18, 0, 13, -95, 368,
+    -1011, 2233, -4385, 9671, 27862, -1986, -211, 609, -476, 247, -87, 17,
+    0, 13, -94, 366, -1011, 2246, -4441, 9913, 27752, -2119, -144, 576,
+    -462, 242, -86, 17, 0, 12, -92, 363, -1011, 2259, -4496, 10157,
+    27639, -2249, -77, 543, -448, 237, -85, 17, 0, 12, -91, 361,
+    -1011, 2270, -4550, 10401, 27522, -2377, -11, 511, -435, 232, -83, 17,
+    0, 11, -89, 358, -1010, 2281, -4603, 10645, 27402, -2502, 55, 478,
+    -421, 228, -82, 17, 0, 11, -87, 355, -1008, 2292, -4654, 10890,
+    27278, -2625, 119, 446, -407, 223, -81, 16, 0, 10, -85, 352,
+    -1007, 2301, -4704, 11135, 27152, -2745, 183, 414, -393, 218, -79, 16,
+    0, 9, -84, 349, -1004, 2310, -4753, 11381, 27022, -2862, 247, 382,
+    -379, 213, -78, 16, 0, 9, -82, 345, -1002, 2318, -4801, 11627,
+    26889, -2977, 309, 350, -365, 208, -77, 16, 1, 8, -80, 341,
+    -999, 2325, -4847, 11874, 26752, -3089, 371, 318, -351, 203, -75, 15,
+    1, 7, -78, 338, -995, 2331, -4891, 12120, 26613, -3199, 432, 287,
+    -337, 198, -74, 15, 1, 7, -75, 333, -991, 2336, -4935, 12367,
+    26470, -3305, 493, 256, -323, 193, -73, 15, 1, 6, -73, 329,
+    -987, 2340, -4977, 12614, 26324, -3410, 552, 225, -309, 188, -71, 15,
+    1, 5, -71, 325, -982, 2344, -5017, 12862, 26176, -3511, 611, 194,
+    -295, 183, -70, 14, 1, 5, -68, 320, -977, 2346, -5056, 13109,
+    26024, -3610, 669, 163, -281, 177, -68, 14, 1, 4, -66, 315,
+    -971, 2348, -5093, 13356, 25869, -3706, 726, 133, -268, 172, -67, 14,
+    1, 3, -64, 310, -965, 2349, -5129, 13603, 25712, -3800, 782, 103,
+    -254, 167, -66, 13, 1, 2, -61, 305, -958, 2349, -5163, 13850,
+    25551, -3891, 838, 73, -240, 162, -64, 13, 2, 1, -58, 299,
+    -951, 2348, -5195, 14097, 25388, -3979, 892, 44, -227, 157, -63, 13,
+    2, 0, -56, 294, -943, 2346, -5226, 14344, 25222, -4065, 946, 14,
+    -213, 152, -61, 13, 2, 0, -53, 288, -935, 2343, -5255, 14590,
+    25053, -4148, 998, -14, -200, 147, -60, 12, 2, -1, -50, 282,
+    -927, 2339, -5283, 14836, 24881, -4228, 1050, -43, -186, 142, -58, 12,
+    2, -2, -47, 275, -918, 2334, -5308, 15082, 24707, -4306, 1101, -71,
+    -173, 137, -57, 12, 2, -3, -44, 269, -908, 2328, -5332, 15327,
+    24530, -4381, 1151, -99, -160, 132, -56, 12, 2, -4, -41, 262,
+    -898, 2321, -5354, 15572, 24350, -4453, 1200, -127, -147, 127, -54, 11,
+    3, -5, -38, 256, -888, 2313, -5374, 15816, 24168, -4523, 1248, -154,
+    -134, 122, -53, 11, 3, -6, -35, 249, -877, 2304, -5392, 16060,
+    23984, -4590, 1295, -181, -121, 117, -51, 11, 3, -7, -31, 241,
+    -865, 2294, -5408, 16302, 23796, -4655, 1341, -208, -108, 112, -50, 11,
+    3, -8, -28, 234, -854, 2283, -5423, 16545, 23607, -4717, 1386, -234,
+    -95, 107, -48, 10, 3, -9, -25, 226, -841, 2272, -5435, 16786,
+    23415, -4777, 1430, -260, -83, 102, -47, 10, 3, -10, -21, 218,
+    -828, 2259, -5446, 17027, 23221, -4834, 1473, -285, -70, 97, -46, 10,
+    4, -11, -18, 210, -815, 2245, -5454, 17267, 23024, -4888, 1515, -311,
+    -58, 93, -44, 9, 4, -12, -14, 202, -801, 2230, -5460, 17505,
+    22825, -4940, 1556, -335, -46, 88, -43, 9, 4, -13, -11, 194,
+    -787, 2214, -5465, 17743, 22624, -4989, 1596, -360, -34, 83, -41, 9,
+    4, -15, -7, 185, -773, 2197, -5467, 17980, 22421, -5036, 1636, -384,
+    -22, 78, -40, 9, 4, -16, -3, 177, -757, 2179, -5467, 18216,
+    22215, -5080, 1674, -407, -10, 74, -39, 8, 5, -17, 1, 168,
+    -742, 2160, -5465, 18451, 22008, -5122, 1711, -430, 2, 69, -37, 8,
+    5, -18, 5, 159, -726, 2139, -5460, 18684, 21799, -5161, 1746, -453,
+    13, 64, -36, 8, 5, -19, 8, 149, -709, 2118, -5454, 18916,
+    21587, -5198, 1781, -475, 25, 60, -35, 8, 5, -20, 12, 140,
+    -692, 2096, -5445, 19147, 21374, -5232, 1815, -497, 36, 55, -33, 7,
+    5, -22, 16, 130, -675, 2073, -5434, 19377, 21159, -5264, 1848, -519,
+    47, 51, -32, 7, 6, -23, 21, 121, -657, 2048, -5421, 19605,
+    20942, -5294, 1880, -540, 58, 46, -31, 7, 6, -24, 25, 111,
+    -639, 2023, -5406, 19832, 20723, -5321, 1910, -561, 69, 42, -29, 7,
+    6, -25, 29, 100, -620, 1996, -5388, 20057, 20503, -5346, 1940, -581,
+    80, 37, -28, 7, 6, -27, 33, 90, -600, 1969, -5368, 20281,
+    20281, -5368, 1969, -600, 90, 33, -27, 6, 7, -28, 37, 80,
+    -581, 1940, -5346, 20503, 20057, -5388, 1996, -620, 100, 29, -25, 6,
+    7, -29, 42, 69, -561, 1910, -5321, 20723, 19832, -5406, 2023, -639,
+    111, 25, -24, 6, 7, -31, 46, 58, -540, 1880, -5294, 20942,
+    19605, -5421, 2048, -657, 121, 21, -23, 6, 7, -32, 51, 47,
+    -519, 1848, -5264, 21159, 19377, -5434, 2073, -675, 130, 16, -22, 5,
+    7, -33, 55, 36, -497, 1815, -5232, 21374, 19147, -5445, 2096, -692,
+    140, 12, -20, 5, 8, -35, 60, 25, -475, 1781, -5198, 21587,
+    18916, -5454, 2118, -709, 149, 8, -19, 5, 8, -36, 64, 13,
+    -453, 1746, -5161, 21799, 18684, -5460, 2139, -726, 159, 5, -18, 5,
+    8, -37, 69, 2, -430, 1711, -5122, 22008, 18451, -5465, 2160, -742,
+    168, 1, -17, 5, 8, -39, 74, -10, -407, 1674, -5080, 22215,
+    18216, -5467, 2179, -757, 177, -3, -16, 4, 9, -40, 78, -22,
+    -384, 1636, -5036, 22421, 17980, -5467, 2197, -773, 185, -7, -15, 4,
+    9, -41, 83, -34, -360, 1596, -4989, 22624, 17743, -5465, 2214, -787,
+    194, -11, -13, 4, 9, -43, 88, -46, -335, 1556, -4940, 22825,
+    17505, -5460, 2230, -801, 202, -14, -12, 4, 9, -44, 93, -58,
+    -311, 1515, -4888, 23024, 17267, -5454, 2245, -815, 210, -18, -11, 4,
+    10, -46, 97, -70, -285, 1473, -4834, 23221, 17027, -5446, 2259, -828,
+    218, -21, -10, 3, 10, -47, 102, -83, -260, 1430, -4777, 23415,
+    16786, -5435, 2272, -841, 226, -25, -9, 3, 10, -48, 107, -95,
+    -234, 1386, -4717, 23607, 16545, -5423, 2283, -854, 234, -28, -8, 3,
+    11, -50, 112, -108, -208, 1341, -4655, 23796, 16302, -5408, 2294, -865,
+    241, -31, -7, 3, 11, -51, 117, -121, -181, 1295, -4590, 23984,
+    16060, -5392, 2304, -877, 249, -35, -6, 3, 11, -53, 122, -134,
+    -154, 1248, -4523, 24168, 15816, -5374, 2313, -888, 256, -38, -5, 3,
+    11, -54, 127, -147, -127, 1200, -4453, 24350, 15572, -5354, 2321, -898,
+    262, -41, -4, 2, 12, -56, 132, -160, -99, 1151, -4381, 24530,
+    15327, -5332, 2328, -908, 269, -44, -3, 2, 12, -57, 137, -173,
+    -71, 1101, -4306, 24707, 15082, -5308, 2334, -918, 275, -47, -2, 2,
+    12, -58, 142, -186, -43, 1050, -4228, 24881, 14836, -5283, 2339, -927,
+    282, -50, -1, 2, 12, -60, 147, -200, -14, 998, -4148, 25053,
+    14590, -5255, 2343, -935, 288, -53, 0, 2, 13, -61, 152, -213,
+    14, 946, -4065, 25222, 14344, -5226, 2346, -943, 294, -56, 0, 2,
+    13, -63, 157, -227, 44, 892, -3979, 25388, 14097, -5195, 2348, -951,
+    299, -58, 1, 2, 13, -64, 162, -240, 73, 838, -3891, 25551,
+    13850, -5163, 2349, -958, 305, -61, 2, 1, 13, -66, 167, -254,
+    103, 782, -3800, 25712, 13603, -5129, 2349, -965, 310, -64, 3, 1,
+    14, -67, 172, -268, 133, 726, -3706, 25869, 13356, -5093, 2348, -971,
+    315, -66, 4, 1, 14, -68, 177, -281, 163, 669, -3610, 26024,
+    13109, -5056, 2346, -977, 320, -68, 5, 1, 14, -70, 183, -295,
+    194, 611, -3511, 26176, 12862, -5017, 2344, -982, 325, -71, 5, 1,
+    15, -71, 188, -309, 225, 552, -3410, 26324, 12614, -4977, 2340, -987,
+    329, -73, 6, 1, 15, -73, 193, -323, 256, 493, -3305, 26470,
+    12367, -4935, 2336, -991, 333, -75, 7, 1, 15, -74, 198, -337,
+    287, 432, -3199, 26613, 12120, -4891, 2331, -995, 338, -78, 7, 1,
+    15, -75, 203, -351, 318, 371, -3089, 26752, 11874, -4847, 2325, -999,
+    341, -80, 8, 1, 16, -77, 208, -365, 350, 309, -2977, 26889,
+    11627, -4801, 2318, -1002, 345, -82, 9, 0, 16, -78, 213, -379,
+    382, 247, -2862, 27022, 11381, -4753, 2310, -1004, 349, -84, 9, 0,
+    16, -79, 218, -393, 414, 183, -2745, 27152, 11135, -4704, 2301, -1007,
+    352, -85, 10, 0, 16, -81, 223, -407, 446, 119, -2625, 27278,
+    10890, -4654, 2292, -1008, 355, -87, 11, 0, 17, -82, 228, -421,
+    478, 55, -2502, 27402, 10645, -4603, 2281, -1010, 358, -89, 11, 0,
+    17, -83, 232, -435, 511, -11, -2377, 27522, 10401, -4550, 2270, -1011,
+    361, -91, 12, 0, 17, -85, 237, -448, 543, -77, -2249, 27639,
+    10157, -4496, 2259, -1011, 363, -92, 12, 0, 17, -86, 242, -462,
+    576, -144, -2119, 27752, 9913, -4441, 2246, -1011, 366, -94, 13, 0,
+    17, -87, 247, -476, 609, -211, -1986, 27862, 9671, -4385, 2233, -1011,
+    368, -95, 13, 0, 18, -88, 252, -490, 641, -279, -1850, 27969,
+    9429, -4327, 2218, -1010, 370, -97, 14, 0, 18, -89, 256, -504,
+    674, -348, -1712, 28072, 9188, -4269, 2204, -1009, 372, -98, 14, 0,
+    18, -91, 261, -518, 707, -417, -1572, 28172, 8947, -4210, 2188, -1008,
+    374, -99, 15, 0, 18, -92, 266, -532, 741, -487, -1428, 28268,
+    8708, -4149, 2172, -1006, 375, -101, 15, 0, 18, -93, 270, -545,
+    774, -557, -1283, 28361, 8469, -4088, 2155, -1004, 376, -102, 16, -1,
+    19, -94, 275, -559, 807, -627, -1134, 28450, 8232, -4026, 2137, -1001,
+    378, -103, 16, -1, 19, -95, 279, -572, 840, -699, -984, 28536,
+    7995, -3962, 2119, -998, 379, -104, 16, -1, 19, -96, 284, -586,
+    873, -770, -830, 28618, 7759, -3898, 2100, -995, 379, -105, 17, -1,
+    19, -97, 288, -599, 906, -842, -675, 28697, 7525, -3833, 2080, -991,
+    380, -106, 17, -1, 19, -98, 292, -612, 940, -915, -517, 28772,
+    7291, -3768, 2060, -987, 380, -107, 18, -1, 20, -99, 296, -626,
+    973, -988, -356, 28843, 7059, -3701, 2039, -982, 381, -107, 18, -1,
+    20, -100, 301, -639, 1006, -1061, -193, 28911, 6828, -3634, 2017, -977,
+    381, -108, 18, -1, 20, -101, 305, -652, 1039, -1134, -28, 28975,
+    6598, -3566, 1995, -972, 381, -109, 18, -1, 20, -102, 309, -664,
+    1072, -1208, 140, 29035, 6370, -3497, 1973, -967, 381, -109, 19, -1,
+    20, -103, 313, -677, 1104, -1282, 310, 29091, 6143, -3428, 1950, -961,
+    380, -110, 19, -1, 20, -104, 316, -690, 1137, -1356, 482, 29144,
+    5917, -3358, 1926, -955, 380, -110, 19, -1, 20, -105, 320, -702,
+    1170, -1431, 657, 29193, 5692, -3288, 1902, -948, 379, -111, 19, -1,
+    20, -105, 324, -715, 1202, -1506, 834, 29239, 5470, -3217, 1877, -942,
+    378, -111, 20, -1, 20, -106, 327, -727, 1234, -1581, 1013, 29281,
+    5248, -3145, 1852, -935, 377, -111, 20, -1, 21, -107, 331, -739,
+    1267, -1656, 1195, 29318, 5029, -3073, 1826, -927, 376, -112, 20, -1,
+    21, -107, 334, -750, 1299, -1731, 1378, 29353, 4810, -3001, 1800, -919,
+    375, -112, 20, -1, 21, -108, 338, -762, 1330, -1806, 1564, 29383,
+    4594, -2928, 1773, -911, 374, -112, 20, -1, 21, -109, 341, -774,
+    1362, -1882, 1752, 29410, 4379, -2855, 1746, -903, 372, -112, 20, -1,
+    21, -109, 344, -785, 1393, -1957, 1942, 29432, 4166, -2781, 1719, -895,
+    370, -112, 20, -1, 21, -110, 347, -796, 1424, -2033, 2135, 29451,
+    3954, -2707, 1691, -886, 369, -112, 21, -1, 21, -110, 350, -807,
+    1455, -2108, 2329, 29467, 3744, -2633, 1663, -877, 367, -112, 21, -1,
+    21, -110, 353, -818, 1486, -2183, 2525, 29478, 3537, -2559, 1634, -868,
+    365, -112, 21, -1, 21, -111, 355, -828, 1516, -2259, 2724, 29486,
+    3330, -2484, 1605, -858, 362, -112, 21, -1, 21, -111, 358, -838,
+    1546, -2334, 2924, 29489, 3126, -2409, 1576, -848, 360, -111, 21, -1,
+};
+
+// L/M=147/160, 20 taps: 24000->22050, 48000->44100
+const int16_t kBank147x160x20[2940] = {
+    1, -14, 51, -95, 46, 286, -1090, 2396, -3950, 5278, 27096, 5089,
+    -3896, 2389, -1098, 296, 39, -92, 51, -14, 1, -14, 52, -98,
+    52, 275, -1080, 2402, -4003, 5469, 27093, 4900, -3841, 2381, -1107, 306,
+    33, -90, 50, -14, 1, -14, 53, -100, 58, 265, -1070, 2408,
+    -4056, 5661, 27087, 4713, -3785, 2373, -1115, 315, 27, -87, 49, -13,
+    1, -14, 53, -103, 65, 254, -1060, 2412, -4107, 5853, 27078, 4527,
+    -3729, 2364, -1123, 325, 21, -84, 48, -13, 1, -14, 54, -106,
+    71, 243, -1050, 2416, -4158, 6047, 27067, 4342, -3672, 2354, -1130, 334,
+    14, -82, 48, -13, 1, -14, 55, -108, 78, 232, -1039, 2420,
+    -4208, 6242, 27052, 4158, -3614, 2343, -1136, 344, 8, -79, 47, -13,
+    1, -14, 56, -111, 85, 221, -1027, 2422, -4257, 6438, 27035, 3976,
+    -3556, 2332, -1143, 352, 2, -76, 46, -13, 1, -14, 56, -114,
+    91, 210, -1015, 2424, -4305, 6634, 27014, 3794, -3497, 2320, -1149, 361,
+    -4, -74, 45, -13, 1, -15, 57, -116, 98, 198, -1003, 2425,
+    -4352, 6832, 26991, 3615, -3437, 2308, -1154, 370, -10, -71, 44, -13,
+    1, -15, 58, -119, 105, 186, -990, 2425, -4398, 7030, 26964, 3436,
+    -3377, 2295, -1159, 378, -15, -68, 44, -13, 1, -15, 58, -122,
+    111, 174, -977, 2424, -4443, 7229, 26935, 3259, -3316, 2281, -1164, 386,
+    -21, -66, 43, -12, 1, -15, 59, -124, 118, 162, -963, 2423,
+    -4487, 7429, 26903, 3083, -3255, 2266, -1168, 394, -27, -63, 42, -12,
+    1, -15, 59, -127, 125, 150, -949, 2420, -4530, 7630, 26868, 2909,
+    -3193, 2251, -1172, 402, -32, -60, 41, -12, 1, -15, 60, -130,
+    132, 138, -934, 2417, -4572, 7831, 26831, 2736, -3131, 2235, -1175, 410,
+    -38, -58, 40, -12, 1, -15, 61, -132, 139, 125, -919, 2413,
+    -4613, 8034, 26790, 2565, -3068, 2219, -1178, 417, -43, -55, 40, -12,
+    1, -15, 61, -135, 146, 112, -904, 2409, -4652, 8236, 26746, 2395,
+    -3005, 2202, -1180, 424, -49, -53, 39, -12, 1, -15, 62, -137,
+    153, 99, -888, 2403, -4691, 8440, 26700, 2227, -2941, 2185, -1182, 431,
+    -54, -50, 38, -12, 1, -15, 62, -140, 160, 86, -872, 2397,
+    -4728, 8644, 26651, 2060, -2877, 2167, -1184, 438, -59, -47, 37, -11,
+    1, -15, 63, -142, 167, 73, -855, 2389, -4764, 8848, 26599, 1894,
+    -2813, 2148, -1185, 444, -65, -45, 36, -11, 1, -15, 63, -145,
+    173, 60, -838, 2381, -4799, 9053, 26544, 1731, -2748, 2129, -1186, 451,
+    -70, -42, 35, -11, 1, -15, 64, -147, 180, 47, -821, 2372,
+    -4833, 9259, 26486, 1569, -2683, 2109, -1187, 457, -75, -40, 35, -11,
+    1, -15, 64, -150, 187, 33, -803, 2363, -4865, 9465, 26426, 1408,
+    -2617, 2089, -1187, 463, -80, -37, 34, -11, 1, -15, 65, -152,
+    194, 19, -785, 2352, -4896, 9671, 26363, 1249, -2552, 2068, -1187, 468,
+    -84, -35, 33, -11, 1, -15, 65, -155, 201, 5, -766, 2340,
+    -4926, 9878, 26297, 1092, -2486, 2047, -1186, 474, -89, -32, 32, -10,
+    1, -15, 66, -157, 208, -9, -747, 2328, -4955, 10085, 26228, 937,
+    -2420, 2025, -1185, 479, -94, -30, 31, -10, 1, -15, 66, -159,
+    215, -23, -727, 2315, -4982, 10293, 26156, 783, -2353, 2003, -1183, 484,
+    -99, -28, 31, -10, 1, -15, 66, -162, 222, -37, -707, 2301,
+    -5008, 10501, 26082, 631, -2287, 1980, -1181, 489, -103, -25, 30, -10,
+    1, -15, 67, -164, 229, -51, -687, 2286, -5032, 10709, 26005, 480,
+    -2220, 1957, -1179, 493, -108, -23, 29, -10, 1, -15, 67, -166,
+    236, -66, -666, 2270, -5055, 10917, 25925, 332, -2153, 1933, -1177, 498,
+    -112, -20, 28, -10, 1, -15, 67, -168, 243, -80, -645, 2253,
+    -5077, 11125, 25843, 185, -2086, 1909, -1174, 502, -116, -18, 27, -9,
+    1, -15, 68, -171, 250, -95, -623, 2236, -5097, 11334, 25758, 40,
+    -2019, 1885, -1170, 506, -120, -16, 26, -9, 1, -14, 68, -173,
+    257, -109, -602, 2217, -5115, 11542, 25670, -103, -1952, 1860, -1167, 510,
+    -125, -13, 26, -9, 1, -14, 68, -175, 264, -124, -579, 2198,
+    -5133, 11751, 25580, -245, -1885, 1834, -1163, 514, -129, -11, 25, -9,
+    1, -14, 68, -177, 271, -139, -557, 2178, -5148, 11959, 25487, -384,
+    -1818, 1808, -1158, 517, -132, -9, 24, -9, 1, -14, 69, -179,
+    278, -154, -534, 2157, -5162, 12168, 25391, -522, -1751, 1782, -1154, 520,
+    -136, -7, 23, -9, 1, -14, 69, -181, 285, -169, -510, 2135,
+    -5175, 12377, 25293, -658, -1683, 1756, -1149, 523, -140, -5, 22, -8,
+    1, -14, 69, -183, 292, -184, -487, 2112, -5186, 12585, 25193, -792,
+    -1616, 1729, -1143, 526, -144, -2, 22, -8, 1, -14, 69, -185,
+    298, -200, -463, 2088, -5196, 12793, 25089, -924, -1549, 1702, -1137, 528,
+    -147, 0, 21, -8, 1, -14, 69, -187, 305, -215, -438, 2064,
+    -5203, 13002, 24984, -1054, -1482, 1674, -1131, 531, -151, 2, 20, -8,
+    0, -13, 69, -189, 312, -230, -413, 2038, -5210, 13210, 24876, -1182,
+    -1415, 1646, -1125, 533, -154, 4, 19, -8, 0, -13, 69, -190,
+    319, -246, -388, 2012, -5214, 13417, 24765, -1309, -1348, 1618, -1118, 535,
+    -158, 6, 19, -7, 0, -13, 69, -192, 325, -261, -363, 1985,
+    -5217, 13625, 24652, -1433, -1281, 1589, -1111, 537, -161, 8, 18, -7,
+    0, -13, 69, -194, 332, -277, -337, 1957, -5218, 13832, 24536, -1556,
+    -1215, 1561, -1104, 538, -164, 10, 17, -7, 0, -13, 69, -195,
+    338, -292, -311, 1928, -5218, 14039, 24418, -1676, -1148, 1531, -1096, 540,
+    -167, 12, 16, -7, 0, -13, 69, -197, 345, -308, -285, 1898,
+    -5216, 14245, 24298, -1795, -1082, 1502, -1088, 541, -170, 14, 16, -7,
+    0, -12, 69, -199, 351, -323, -258, 1867, -5212, 14451, 24175, -1911,
+    -1016, 1472, -1080, 542, -173, 16, 15, -7, 0, -12, 69, -200,
+    358, -339, -231, 1835, -5206, 14657, 24050, -2026, -950, 1443, -1071, 543,
+    -176, 17, 14, -6, 0, -12, 69, -201, 364, -355, -204, 1803,
+    -5199, 14862, 23923, -2138, -885, 1412, -1063, 543, -178, 19, 13, -6,
+    0, -12, 69, -203, 370, -370, -176, 1770, -5190, 15066, 23793, -2249,
+    -820, 1382, -1054, 544, -181, 21, 13, -6, 0, -11, 69, -204,
+    376, -386, -148, 1736, -5179, 15270, 23661, -2357, -755, 1351, -1044, 544,
+    -183, 23, 12, -6, 0, -11, 69, -205, 383, -402, -120, 1701,
+    -5166, 15473, 23527, -2464, -690, 1321, -1035, 544, -186, 25, 11, -6,
+    0, -11, 68, -207, 389, -418, -92, 1665, -5152, 15676, 23391, -2568,
+    -626, 1290, -1025, 544, -188, 26, 10, -6, 0, -11, 68, -208,
+    395, -433, -63, 1628, -5135, 15878, 23252, -2671, -562, 1259, -1015, 544,
+    -190, 28, 10, -5, 0, -10, 68, -209, 401, -449, -34, 1591,
+    -5117, 16079, 23111, -2771, -498, 1227, -1004, 543, -192, 30, 9, -5,
+    0, -10, 68, -210, 406, -465, -5, 1552, -5097, 16279, 22969, -2870,
+    -435, 1196, -994, 542, -194, 31, 8, -5, -1, -10, 67, -211,
+    412, -480, 25, 1513, -5075, 16479, 22824, -2966, -372, 1164, -983, 541,
+    -196, 33, 8, -5, -1, -9, 67, -212, 418, -496, 54, 1473,
+    -5051, 16678, 22677, -3060, -309, 1133, -972, 540, -198, 34, 7, -5,
+    -1, -9, 66, -213, 423, -512, 84, 1433, -5025, 16876, 22528, -3153,
+    -247, 1101, -960, 539, -200, 36, 6, -5, -1, -9, 66, -213,
+    429, -527, 114, 1391, -4998, 17073, 22377, -3243, -185, 1069, -949, 538,
+    -202, 37, 6, -5, -1, -8, 65, -214, 434, -543, 144, 1349,
+    -4968, 17269, 22224, -3331, -124, 1037, -937, 536, -203, 39, 5, -4,
+    -1, -8, 65, -215, 439, -558, 175, 1305, -4937, 17464, 22069, -3417,
+    -64, 1005, -925, 535, -205, 40, 5, -4, -1, -8, 64, -215,
+    445, -574, 205, 1262, -4903, 17658, 21912, -3501, -3, 972, -913, 533,
+    -206, 42, 4, -4, -1, -7, 64, -216, 450, -589, 236, 1217,
+    -4868, 17850, 21753, -3583, 56, 940, -900, 531, -208, 43, 3, -4,
+    -1, -7, 63, -216, 455, -604, 267, 1171, -4831, 18042, 21593, -3663,
+    116, 908, -888, 529, -209, 44, 3, -4, -1, -7, 63, -217,
+    460, -619, 298, 1125, -4792, 18233, 21430, -3741, 174, 876, -875, 526,
+    -210, 45, 2, -4, -2, -6, 62, -217, 464, -635, 330, 1078,
+    -4750, 18423, 21266, -3816, 232, 843, -862, 524, -211, 47, 2, -3,
+    -2, -6, 61, -217, 469, -650, 361, 1030, -4707, 18611, 21100, -3890,
+    290, 811, -849, 521, -212, 48, 1, -3, -2, -5, 60, -217,
+    474, -665, 393, 982, -4662, 18798, 20933, -3962, 347, 778, -836, 518,
+    -213, 49, 1, -3, -2, -5, 60, -217, 478, -680, 424, 933,
+    -4615, 18984, 20763, -4031, 403, 746, -822, 515, -214, 50, 0, -3,
+    -2, -4, 59, -217, 482, -694, 456, 883, -4566, 19168, 20592, -4099,
+    459, 714, -808, 512, -214, 51, -1, -3, -2, -4, 58, -217,
+    487, -709, 488, 832, -4514, 19351, 20420, -4164, 514, 681, -795, 509,
+    -215, 52, -1, -3, -2, -4, 57, -217, 491, -724, 520, 781,
+    -4461, 19533, 20245, -4228, 569, 649, -781, 506, -216, 53, -2, -3,
+    -2, -3, 56, -217, 495, -738, 552, 729, -4406, 19713, 20069, -4289,
+    623, 617, -767, 502, -216, 54, -2, -3, -2, -3, 55, -217,
+    498, -752, 584, 676, -4349, 19892, 19892, -4349, 676, 584, -752, 498,
+    -217, 55, -3, -2, -3, -2, 54, -216, 502, -767, 617, 623,
+    -4289, 20069, 19713, -4406, 729, 552, -738, 495, -217, 56, -3, -2,
+    -3, -2, 53, -216, 506, -781, 649, 569, -4228, 20245, 19533, -4461,
+    781, 520, -724, 491, -217, 57, -4, -2, -3, -1, 52, -215,
+    509, -795, 681, 514, -4164, 20420, 19351, -4514, 832, 488, -709, 487,
+    -217, 58, -4, -2, -3, -1, 51, -214, 512, -808, 714, 459,
+    -4099, 20592, 19168, -4566, 883, 456, -694, 482, -217, 59, -4, -2,
+    -3, 0, 50, -214, 515, -822, 746, 403, -4031, 20763, 18984, -4615,
+    933, 424, -680, 478, -217, 60, -5, -2, -3, 1, 49, -213,
+    518, -836, 778, 347, -3962, 20933, 18798, -4662, 982, 393, -665, 474,
+    -217, 60, -5, -2, -3, 1, 48, -212, 521, -849, 811, 290,
+    -3890, 21100, 18611, -4707, 1030, 361, -650, 469, -217, 61, -6, -2,
+    -3, 2, 47, -211, 524, -862, 843, 232, -3816, 21266, 18423, -4750,
+    1078, 330, -635, 464, -217, 62, -6, -2, -4, 2, 45, -210,
+    526, -875, 876, 174, -3741, 21430, 18233, -4792, 1125, 298, -619, 460,
+    -217, 63, -7, -1, -4, 3, 44, -209, 529, -888, 908, 116,
+    -3663, 21593, 18042, -4831, 1171, 267, -604, 455, -216, 63, -7, -1,
+    -4, 3, 43, -208, 531, -900, 940, 56, -3583, 21753, 17850, -4868,
+    1217, 236, -589, 450, -216, 64, -7, -1, -4, 4, 42, -206,
+    533, -913, 972, -3, -3501, 21912, 17658, -4903, 1262, 205, -574, 445,
+    -215, 64, -8, -1, -4, 5, 40, -205, 535, -925, 1005, -64,
+    -3417, 22069, 17464, -4937, 1305, 175, -558, 439, -215, 65, -8, -1,
+    -4, 5, 39, -203, 536, -937, 1037, -124, -3331, 22224, 17269, -4968,
+    1349, 144, -543, 434, -214, 65, -8, -1, -5, 6, 37, -202,
+    538, -949, 1069, -185, -3243, 22377, 17073, -4998, 1391, 114, -527, 429,
+    -213, 66, -9, -1, -5, 6, 36, -200, 539, -960, 1101, -247,
+    -3153, 22528, 16876, -5025, 1433, 84, -512, 423, -213, 66, -9, -1,
+    -5, 7, 34, -198, 540, -972, 1133, -309, -3060, 22677, 16678, -5051,
+    1473, 54, -496, 418, -212, 67, -9, -1, -5, 8, 33, -196,
+    541, -983, 1164, -372, -2966, 22824, 16479, -5075, 1513, 25, -480, 412,
+    -211, 67, -10, -1, -5, 8, 31, -194, 542, -994, 1196, -435,
+    -2870, 22969, 16279, -5097, 1552, -5, -465, 406, -210, 68, -10, 0,
+    -5, 9, 30, -192, 543, -1004, 1227, -498, -2771, 23111, 16079, -5117,
+    1591, -34, -449, 401, -209, 68, -10, 0, -5, 10, 28, -190,
+    544, -1015, 1259, -562, -2671, 23252, 15878, -5135, 1628, -63, -433, 395,
+    -208, 68, -11, 0, -6, 10, 26, -188, 544, -1025, 1290, -626,
+    -2568, 23391, 15676, -5152, 1665, -92, -418, 389, -207, 68, -11, 0,
+    -6, 11, 25, -186, 544, -1035, 1321, -690, -2464, 23527, 15473, -5166,
+    1701, -120, -402, 383, -205, 69, -11, 0, -6, 12, 23, -183,
+    544, -1044, 1351, -755, -2357, 23661, 15270, -5179, 1736, -148, -386, 376,
+    -204, 69, -11, 0, -6, 13, 21, -181, 544, -1054, 1382, -820,
+    -2249, 23793, 15066, -5190, 1770, -176, -370, 370, -203, 69, -12, 0,
+    -6, 13, 19, -178, 543, -1063, 1412, -885, -2138, 23923, 14862, -5199,
+    1803, -204, -355, 364, -201, 69, -12, 0, -6, 14, 17, -176,
+    543, -1071, 1443, -950, -2026, 24050, 14657, -5206, 1835, -231, -339, 358,
+    -200, 69, -12, 0, -7, 15, 16, -173, 542, -1080, 1472, -1016,
+    -1911, 24175, 14451, -5212, 1867, -258, -323, 351, -199, 69, -12, 0,
+    -7, 16, 14, -170, 541, -1088, 1502, -1082, -1795, 24298, 14245, -5216,
+    1898, -285, -308, 345, -197, 69, -13, 0, -7, 16, 12, -167,
+    540, -1096, 1531, -1148, -1676, 24418, 14039, -5218, 1928, -311, -292, 338,
+    -195, 69, -13, 0, -7, 17, 10, -164, 538, -1104, 1561, -1215,
+    -1556, 24536, 13832, -5218, 1957, -337, -277, 332, -194, 69, -13, 0,
+    -7, 18, 8, -161, 537, -1111, 1589, -1281, -1433, 24652, 13625, -5217,
+    1985, -363, -261, 325, -192, 69, -13, 0, -7, 19, 6, -158,
+    535, -1118, 1618, -1348, -1309, 24765, 13417, -5214, 2012, -388, -246, 319,
+    -190, 69, -13, 0, -8, 19, 4, -154, 533, -1125, 1646, -1415,
+    -1182, 24876, 13210, -5210, 2038, -413, -230, 312, -189, 69, -13, 0,
+    -8, 20, 2, -151, 531, -1131, 1674, -1482, -1054, 24984, 13002, -5203,
+    2064, -438, -215, 305, -187, 69, -14, 1, -8, 21, 0, -147,
+    528, -1137, 1702, -1549, -924, 25089, 12793, -5196, 2088, -463, -200, 298,
+    -185, 69, -14, 1, -8, 22, -2, -144, 526, -1143, 1729, -1616,
+    -792, 25193, 12585, -5186, 2112, -487, -184, 292, -183, 69, -14, 1,
+    -8, 22, -5, -140, 523, -1149, 1756, -1683, -658, 25293, 12377, -5175,
+    2135, -510, -169, 285, -181, 69, -14, 1, -9, 23, -7, -136,
+    520, -1154, 1782, -1751, -522, 25391, 12168, -5162, 2157, -534, -154, 278,
+    -179, 69, -14, 1, -9, 24, -9, -132, 517, -1158, 1808, -1818,
+    -384, 25487, 11959, -5148, 2178, -557, -139, 271, -177, 68, -14, 1,
+    -9, 25, -11, -129, 514, -1163, 1834, -1885, -245, 25580, 11751, -5133,
+    2198, -579, -124, 264, -175, 68, -14, 1, -9, 26, -13, -125,
+    510, -1167, 1860, -1952, -103, 25670, 11542, -5115, 2217, -602, -109, 257,
+    -173, 68, -14, 1, -9, 26, -16, -120, 506, -1170, 1885, -2019,
+    40, 25758, 11334, -5097, 2236, -623, -95, 250, -171, 68, -15, 1,
+    -9, 27, -18, -116, 502, -1174, 1909, -2086, 185, 25843, 11125, -5077,
+    2253, -645, -80, 243, -168, 67, -15, 1, -10, 28, -20, -112,
+    498, -1177, 1933, -2153, 332, 25925, 10917, -5055, 2270, -666, -66, 236,
+    -166, 67, -15, 1, -10, 29, -23, -108, 493, -1179, 1957, -2220,
+    480, 26005, 10709, -5032, 2286, -687, -51, 229, -164, 67, -15, 1,
+    -10, 30, -25, -103, 489, -1181, 1980, -2287, 631, 26082, 10501, -5008,
+    2301, -707, -37, 222, -162, 66, -15, 1, -10, 31, -28, -99,
+    484, -1183, 2003, -2353, 783, 26156, 10293, -4982, 2315, -727, -23, 215,
+    -159, 66, -15, 1, -10, 31, -30, -94, 479, -1185, 2025, -2420,
+    937, 26228, 10085, -4955, 2328, -747, -9, 208, -157, 66, -15, 1,
+    -10, 32, -32, -89, 474, -1186, 2047, -2486, 1092, 26297, 9878, -4926,
+    2340, -766, 5, 201, -155, 65, -15, 1, -11, 33, -35, -84,
+    468, -1187, 2068, -2552, 1249, 26363, 9671, -4896, 2352, -785, 19, 194,
+    -152, 65, -15, 1, -11, 34, -37, -80, 463, -1187, 2089, -2617,
+    1408, 26426, 9465, -4865, 2363, -803, 33, 187, -150, 64, -15, 1,
+    -11, 35, -40, -75, 457, -1187, 2109, -2683, 1569, 26486, 9259, -4833,
+    2372, -821, 47, 180, -147, 64, -15, 1, -11, 35, -42, -70,
+    451, -1186, 2129, -2748, 1731, 26544, 9053, -4799, 2381, -838, 60, 173,
+    -145, 63, -15, 1, -11, 36, -45, -65, 444, -1185, 2148, -2813,
+    1894, 26599, 8848, -4764, 2389, -855, 73, 167, -142, 63, -15, 1,
+    -11, 37, -47, -59, 438, -1184, 2167, -2877, 2060, 26651, 8644, -4728,
+    2397, -872, 86, 160, -140, 62, -15, 1, -12, 38, -50, -54,
+    431, -1182, 2185, -2941, 2227, 26700, 8440, -4691, 2403, -888, 99, 153,
+    -137, 62, -15, 1, -12, 39, -53, -49, 424, -1180, 2202, -3005,
+    2395, 26746, 8236, -4652, 2409, -904, 112, 146, -135, 61, -15, 1,
+    -12, 40, -55, -43, 417, -1178, 2219, -3068, 2565, 26790, 8034, -4613,
+    2413, -919, 125, 139, -132, 61, -15, 1, -12, 40, -58, -38,
+    410, -1175, 2235, -3131, 2736, 26831, 7831, -4572, 2417, -934, 138, 132,
+    -130, 60, -15, 1, -12, 41, -60, -32, 402, -1172, 2251, -3193,
+    2909, 26868, 7630, -4530, 2420, -949, 150, 125, -127, 59, -15, 1,
+    -12, 42, -63, -27, 394, -1168, 2266, -3255, 3083, 26903, 7429, -4487,
+    2423, -963, 162, 118, -124, 59, -15, 1, -12, 43, -66, -21,
+    386, -1164, 2281, -3316, 3259, 26935, 7229, -4443, 2424, -977, 174, 111,
+    -122, 58, -15, 1, -13, 44, -68, -15, 378, -1159, 2295, -3377,
+    3436, 26964, 7030, -4398, 2425, -990, 186, 105, -119, 58, -15, 1,
+    -13, 44, -71, -10, 370, -1154, 2308, -3437, 3615, 26991, 6832, -4352,
+    2425, -1003, 198, 98, -116, 57, -15, 1, -13, 45, -74, -4,
+    361, -1149, 2320, -3497, 3794, 27014, 6634, -4305, 2424, -1015, 210, 91,
+    -114, 56, -14, 1, -13, 46, -76, 2, 352, -1143, 2332, -3556,
+    3976, 27035, 6438, -4257, 2422, -1027, 221, 85, -111, 56, -14, 1,
+    -13, 47, -79, 8, 344, -1136, 2343, -3614, 4158, 27052, 6242, -4208,
+    2420, -1039, 232, 78, -108, 55, -14, 1, -13, 48, -82, 14,
+    334, -1130, 2354, -3672, 4342, 27067, 6047, -4158, 2416, -1050, 243, 71,
+    -106, 54, -14, 1, -13, 48, -84, 21, 325, -1123, 2364, -3729,
+    4527, 27078, 5853, -4107, 2412, -1060, 254, 65, -103, 53, -14, 1,
+    -13, 49, -87, 27, 315, -1115, 2373, -3785, 4713, 27087, 5661, -4056,
+    2408, -1070, 265, 58, -100, 53, -14, 1, -14, 50, -90, 33,
+    306, -1107, 2381, -3841, 4900, 27093, 5469, -4003, 2402, -1080, 275, 52,
+    -98, 52, -14, 1, -14, 51, -92, 39, 296, -1098, 2389, -3896,
+    5089, 27096, 5278, -3950, 2396, -1090, 286, 46, -95, 51, -14, 1,
+};
+
+// L/M=147/320, 36 taps: 48000->22050
+const int16_t kBank147x320x36[5292] = {
+    -1, 0, 9, 12, -24, -63, 14, 176, 109, -305, -462, 262,
+    1095, 312, -1893, -2121, 2590, 9944, 13547, 9900, 2543, -2135, -1880, 324,
+    1093, 254, -464, -302, 111, 176, 13, -63, -24, 12, 9, 0,
+    -1, 0, 9, 12, -25, -63, 15, 177, 107, -308, -461, 269,
+    1096, 299, -1907, -2106, 2638, 9989, 13547, 9855, 2496, -2149, -1867, 337,
+    1091, 247, -466, -299, 113, 175, 12, -63, -23, 12, 9, 0,
+    -1, 0, 9, 12, -25, -63, 16, 178, 106, -311, -459, 276,
+    1098, 287, -1920, -2092, 2685, 10033, 13546, 9810, 2449, -2162, -1853, 349,
+    1089, 240, -467, -296, 115, 174, 11, -63, -23, 12, 8, 0,
+    -1, 0, 9, 12, -25, -63, 17, 179, 104, -313, -457, 283,
+    1100, 274, -1933, -2077, 2733, 10077, 13545, 9764, 2403, -2175, -1840, 361,
+    1087, 233, -469, -293, 117, 173, 10, -63, -23, 12, 8, 0,
+    -1, 0, 9, 12, -26, -63, 18, 179, 102, -316, -455, 290,
+    1101, 261, -1946, -2062, 2780, 10121, 13543, 9719, 2356, -2188, -1826, 373,
+    1085, 226, -471, -290, 119, 173, 9, -63, -22, 12, 8, 0,
+    -1, 0, 9, 11, -26, -63, 20, 180, 100, -319, -453, 298,
+    1102, 249, -1958, -2047, 2828, 10165, 13541, 9673, 2310, -2201, -1812, 385,
+    1082, 219, -472, -286, 120, 172, 8, -63, -22, 12, 8, 0,
+    -1, 0, 9, 11, -26, -63, 21, 181, 98, -322, -451, 305,
+    1104, 236, -1971, -2031, 2876, 10209, 13539, 9627, 2264, -2214, -1799, 397,
+    1080, 212, -474, -283, 122, 171, 7, -63, -22, 12, 8, 0,
+    -1, 0, 9, 11, -27, -63, 22, 181, 96, -325, -449, 312,
+    1105, 223, -1984, -2015, 2924, 10252, 13537, 9581, 2218, -2226, -1785, 409,
+    1078, 205, -475, -280, 124, 170, 6, -63, -21, 13, 8, -1,
+    -1, 0, 9, 11, -27, -63, 23, 182, 94, -328, -447, 319,
+    1106, 210, -1996, -1999, 2972, 10295, 13534, 9535, 2172, -2238, -1771, 420,
+    1075, 197, -476, -277, 126, 169, 5, -63, -21, 13, 8, -1,
+    -1, 0, 9, 11, -28, -63, 24, 183, 92, -331, -445, 327,
+    1107, 197, -2008, -1983, 3021, 10338, 13530, 9489, 2126, -2250, -1757, 432,
+    1073, 190, -478, -274, 127, 168, 4, -63, -21, 13, 8, -1,
+    -1, 0, 10, 11, -28, -63, 25, 183, 90, -334, -442, 334,
+    1108, 183, -2021, -1966, 3069, 10381, 13527, 9442, 2080, -2262, -1743, 444,
+    1070, 183, -479, -271, 129, 168, 3, -63, -20, 13, 8, -1,
+    -1, 0, 10, 11, -28, -63, 26, 184, 88, -337, -440, 341,
+    1109, 170, -2033, -1949, 3118, 10424, 13523, 9396, 2035, -2273, -1729, 455,
+    1067, 176, -480, -268, 131, 167, 2, -63, -20, 13, 8, -1,
+    -1, 0, 10, 11, -29, -63, 27, 185, 85, -339, -438, 348,
+    1110, 157, -2045, -1932, 3166, 10466, 13518, 9349, 1990, -2284, -1714, 466,
+    1064, 169, -481, -265, 132, 166, 1, -63, -19, 13, 8, -1,
+    -1, 0, 10, 11, -29, -63, 28, 185, 83, -342, -435, 356,
+    1111, 143, -2057, -1915, 3215, 10508, 13513, 9302, 1945, -2295, -1700, 478,
+    1062, 162, -482, -262, 134, 165, 0, -63, -19, 13, 8, -1,
+    -1, 0, 10, 10, -29, -63, 29, 186, 81, -345, -433, 363,
+    1111, 130, -2069, -1897, 3264, 10550, 13508, 9255, 1900, -2305, -1686, 489,
+    1059, 155, -484, -259, 135, 164, -1, -63, -19, 13, 8, -1,
+    -1, 0, 10, 10, -30, -62, 30, 186, 79, -348, -431, 370,
+    1112, 116, -2080, -1879, 3313, 10592, 13503, 9208, 1855, -2316, -1671, 500,
+    1056, 148, -485, -256, 137, 163, -2, -63, -18, 13, 7, -1,
+    -1, 0, 10, 10, -30, -62, 32, 187, 77, -351, -428, 377,
+    1112, 103, -2092, -1861, 3362, 10633, 13497, 9160, 1810, -2326, -1657, 511,
+    1053, 141, -486, -253, 139, 162, -3, -63, -18, 13, 7, -1,
+    -1, 0, 10, 10, -31, -62, 33, 187, 75, -353, -426, 385,
+    1113, 89, -2104, -1843, 3412, 10675, 13491, 9113, 1766, -2335, -1642, 522,
+    1049, 135, -487, -249, 140, 161, -4, -62, -18, 13, 7, -1,
+    -1, 0, 10, 10, -31, -62, 34, 188, 72, -356, -423, 392,
+    1113, 75, -2115, -1824, 3461, 10716, 13484, 9065, 1722, -2345, -1627, 533,
+    1046, 128, -487, -246, 142, 160, -4, -62, -17, 13, 7, -1,
+    -1, 0, 10, 10, -31, -62, 35, 189, 70, -359, -420, 399,
+    1113, 61, -2126, -1805, 3510, 10756, 13477, 9017, 1677, -2354, -1613, 544,
+    1043, 121, -488, -243, 143, 159, -5, -62, -17, 13, 7, -1,
+    -1, 0, 10, 10, -32, -62, 36, 189, 68, -362, -418, 407,
+    1113, 48, -2137, -1786, 3560, 10797, 13470, 8969, 1634, -2364, -1598, 554,
+    1040, 114, -489, -240, 145, 159, -6, -62, -17, 13, 7, -1,
+    -1, 0, 10, 10, -32, -62, 37, 190, 66, -364, -415, 414,
+    1113, 34, -2148, -1767, 3610, 10837, 13462, 8921, 1590, -2372, -1583, 565,
+    1036, 107, -490, -237, 146, 158, -7, -62, -16, 13, 7, -1,
+    -1, 0, 10, 9, -32, -62, 38, 190, 63, -367, -412, 421,
+    1113, 20, -2159, -1747, 3659, 10878, 13454, 8873, 1546, -2381, -1568, 575,
+    1033, 100, -491, -234, 147, 157, -8, -62, -16, 13, 7, -1,
+    -1, 0, 11, 9, -33, -61, 39, 190, 61, -370, -409, 428,
+    1113, 5, -2170, -1727, 3709, 10917, 13446, 8824, 1503, -2389, -1553, 586,
+    1029, 93, -491, -231, 149, 156, -9, -62, -16, 13, 7, -1,
+    -1, 1, 11, 9, -33, -61, 41, 191, 59, -372, -406, 436,
+    1112, -9, -2181, -1707, 3759, 10957, 13437, 8776, 1460, -2398, -1538, 596,
+    1025, 87, -492, -227, 150, 155, -10, -62, -15, 13, 7, -1,
+    -1, 1, 11, 9, -34, -61, 42, 191, 56, -375, -403, 443,
+    1112, -23, -2191, -1686, 3809, 10997, 13428, 8727, 1417, -2405, -1523, 606,
+    1022, 80, -492, -224, 152, 154, -11, -62, -15, 14, 7, -1,
+    -1, 1, 11, 9, -34, -61, 43, 192, 54, -377, -400, 450,
+    1112, -37, -2202, -1666, 3860, 11036, 13418, 8678, 1374, -2413, -1508, 616,
+    1018, 73, -493, -221, 153, 153, -12, -61, -15, 14, 7, -1,
+    -1, 1, 11, 9, -34, -61, 44, 192, 52, -380, -397, 457,
+    1111, -52, -2212, -1645, 3910, 11075, 13408, 8629, 1331, -2420, -1493, 626,
+    1014, 67, -494, -218, 154, 152, -13, -61, -14, 14, 6, -1,
+    -1, 1, 11, 9, -35, -61, 45, 193, 49, -383, -394, 465,
+    1110, -66, -2222, -1624, 3960, 11113, 13398, 8580, 1289, -2428, -1477, 636,
+    1010, 60, -494, -215, 156, 151, -13, -61, -14, 14, 6, -1,
+    -1, 1, 11, 8, -35, -60, 46, 193, 47, -385, -391, 472,
+    1110, -80, -2232, -1602, 4011, 11152, 13387, 8531, 1247, -2435, -1462, 646,
+    1006, 53, -494, -212, 157, 150, -14, -61, -14, 14, 6, -1,
+    -1, 1, 11, 8, -35, -60, 48, 193, 44, -388, -388, 479,
+    1109, -95, -2242, -1580, 4061, 11190, 13376, 8482, 1204, -2441, -1447, 656,
+    1002, 47, -495, -208, 158, 149, -15, -61, -13, 14, 6, -1,
+    -1, 1, 11, 8, -36, -60, 49, 194, 42, -390, -385, 486,
+    1108, -110, -2252, -1558, 4112, 11228, 13365, 8432, 1163, -2448, -1431, 665,
+    998, 40, -495, -205, 159, 148, -16, -61, -13, 14, 6, -1,
+    -1, 1, 11, 8, -36, -60, 50, 194, 40, -393, -382, 494,
+    1107, -124, -2261, -1536, 4163, 11266, 13353, 8383, 1121, -2454, -1416, 675,
+    994, 33, -495, -202, 161, 147, -17, -60, -13, 14, 6, -1,
+    -1, 1, 11, 8, -37, -60, 51, 194, 37, -395, -378, 501,
+    1106, -139, -2271, -1514, 4213, 11303, 13341, 8333, 1079, -2460, -1400, 684,
+    989, 27, -496, -199, 162, 145, -18, -60, -12, 14, 6, -1,
+    -1, 1, 11, 8, -37, -59, 52, 195, 35, -397, -375, 508,
+    1104, -154, -2280, -1491, 4264, 11341, 13329, 8284, 1038, -2466, -1385, 693,
+    985, 20, -496, -196, 163, 144, -18, -60, -12, 14, 6, -1,
+    -1, 1, 11, 8, -37, -59, 54, 195, 32, -400, -371, 515,
+    1103, -168, -2289, -1468, 4315, 11378, 13316, 8234, 997, -2471, -1369, 703,
+    981, 14, -496, -192, 164, 143, -19, -60, -12, 14, 6, -1,
+    -1, 1, 11, 7, -38, -59, 55, 195, 30, -402, -368, 522,
+    1101, -183, -2298, -1445, 4366, 11414, 13303, 8184, 956, -2477, -1354, 712,
+    976, 7, -496, -189, 165, 142, -20, -60, -11, 14, 6, -1,
+    -1, 1, 12, 7, -38, -59, 56, 195, 27, -405, -365, 530,
+    1100, -198, -2307, -1421, 4417, 11451, 13290, 8134, 915, -2482, -1338, 721,
+    972, 1, -496, -186, 166, 141, -21, -60, -11, 14, 6, -1,
+    -1, 1, 12, 7, -38, -58, 57, 196, 24, -407, -361, 537,
+    1098, -213, -2316, -1397, 4469, 11487, 13276, 8084, 875, -2487, -1322, 730,
+    967, -5, -496, -183, 167, 140, -22, -59, -11, 14, 6, -1,
+    -1, 1, 12, 7, -39, -58, 58, 196, 22, -409, -357, 544,
+    1097, -228, -2324, -1373, 4520, 11523, 13262, 8033, 835, -2491, -1307, 738,
+    963, -12, -496, -180, 169, 139, -22, -59, -10, 14, 6, -1,
+    -1, 1, 12, 7, -39, -58, 59, 196, 19, -412, -354, 551,
+    1095, -243, -2333, -1349, 4571, 11558, 13247, 7983, 795, -2496, -1291, 747,
+    958, -18, -496, -177, 170, 138, -23, -59, -10, 14, 5, -1,
+    -1, 1, 12, 6, -39, -58, 61, 196, 17, -414, -350, 558,
+    1093, -258, -2341, -1324, 4622, 11594, 13232, 7933, 755, -2500, -1275, 756,
+    953, -24, -496, -173, 171, 137, -24, -59, -10, 14, 5, -1,
+    -1, 1, 12, 6, -40, -57, 62, 196, 14, -416, -346, 565,
+    1091, -274, -2349, -1300, 4674, 11629, 13217, 7882, 715, -2504, -1259, 764,
+    948, -31, -496, -170, 172, 136, -25, -59, -9, 14, 5, -1,
+    -1, 1, 12, 6, -40, -57, 63, 197, 11, -418, -343, 572,
+    1089, -289, -2357, -1275, 4725, 11664, 13202, 7832, 676, -2507, -1243, 773,
+    944, -37, -496, -167, 173, 135, -25, -58, -9, 14, 5, -1,
+    -1, 1, 12, 6, -41, -57, 64, 197, 9, -420, -339, 579,
+    1086, -304, -2365, -1249, 4777, 11698, 13186, 7781, 636, -2511, -1228, 781,
+    939, -43, -495, -164, 174, 134, -26, -58, -9, 14, 5, -1,
+    -1, 1, 12, 6, -41, -56, 65, 197, 6, -423, -335, 586,
+    1084, -319, -2373, -1224, 4828, 11733, 13169, 7730, 597, -2514, -1212, 789,
+    934, -49, -495, -161, 175, 132, -27, -58, -8, 14, 5, -1,
+    -1, 2, 12, 6, -41, -56, 67, 197, 3, -425, -331, 593,
+    1082, -335, -2380, -1198, 4880, 11767, 13153, 7679, 558, -2517, -1196, 797,
+    929, -55, -495, -157, 176, 131, -28, -58, -8, 14, 5, -1,
+    -1, 2, 12, 5, -42, -56, 68, 197, 1, -427, -327, 600,
+    1079, -350, -2387, -1172, 4932, 11800, 13136, 7628, 520, -2520, -1180, 805,
+    924, -62, -494, -154, 176, 130, -28, -57, -8, 14, 5, -1,
+    -1, 2, 12, 5, -42, -55, 69, 197, -2, -429, -323, 607,
+    1076, -365, -2395, -1145, 4983, 11834, 13118, 7577, 481, -2523, -1164, 813,
+    918, -68, -494, -151, 177, 129, -29, -57, -7, 14, 5, -1,
+    -1, 2, 12, 5, -42, -55, 70, 197, -5, -431, -319, 614,
+    1074, -381, -2402, -1119, 5035, 11867, 13101, 7526, 443, -2525, -1148, 821,
+    913, -74, -494, -148, 178, 128, -30, -57, -7, 14, 5, -1,
+    -1, 2, 12, 5, -43, -55, 72, 197, -7, -433, -315, 621,
+    1071, -396, -2409, -1092, 5087, 11900, 13083, 7475, 405, -2527, -1132, 829,
+    908, -80, -493, -145, 179, 127, -31, -57, -7, 14, 5, -1,
+    -1, 2, 12, 5, -43, -54, 73, 197, -10, -435, -311, 628,
+    1068, -412, -2415, -1065, 5139, 11933, 13064, 7424, 367, -2529, -1116, 836,
+    903, -86, -493, -142, 180, 126, -31, -57, -7, 14, 5, -1,
+    -1, 2, 12, 4, -43, -54, 74, 197, -13, -437, -306, 635,
+    1065, -428, -2422, -1038, 5191, 11965, 13046, 7373, 330, -2531, -1100, 844,
+    897, -92, -492, -138, 181, 124, -32, -56, -6, 14, 5, -1,
+    -1, 2, 12, 4, -44, -54, 75, 197, -16, -439, -302, 642,
+    1062, -443, -2428, -1010, 5242, 11997, 13027, 7321, 293, -2532, -1084, 851,
+    892, -98, -492, -135, 181, 123, -33, -56, -6, 14, 5, -1,
+    -1, 2, 13, 4, -44, -53, 76, 197, -18, -441, -298, 649,
+    1059, -459, -2434, -982, 5294, 12029, 13007, 7270, 255, -2534, -1068, 858,
+    886, -103, -491, -132, 182, 122, -33, -56, -6, 14, 4, -1,
+    -1, 2, 13, 4, -44, -53, 78, 197, -21, -443, -294, 656,
+    1055, -474, -2440, -954, 5346, 12060, 12988, 7218, 219, -2535, -1052, 866,
+    881, -109, -490, -129, 183, 121, -34, -56, -5, 14, 4, -1,
+    -1, 2, 13, 4, -45, -52, 79, 197, -24, -445, -289, 663,
+    1052, -490, -2446, -926, 5398, 12092, 12967, 7167, 182, -2536, -1035, 873,
+    875, -115, -490, -126, 184, 120, -35, -55, -5, 14, 4, -1,
+    -1, 2, 13, 3, -45, -52, 80, 197, -27, -447, -285, 670,
+    1048, -506, -2452, -897, 5450, 12122, 12947, 7115, 145, -2536, -1019, 880,
+    870, -121, -489, -123, 184, 119, -35, -55, -5, 14, 4, -1,
+    -1, 2, 13, 3, -45, -52, 81, 197, -30, -448, -280, 676,
+    1044, -522, -2458, -868, 5503, 12153, 12926, 7064, 109, -2537, -1003, 887,
+    864, -127, -488, -120, 185, 117, -36, -55, -4, 14, 4, -1,
+    -1, 2, 13, 3, -46, -51, 82, 197, -33, -450, -276, 683,
+    1041, -537, -2463, -839, 5555, 12183, 12905, 7012, 73, -2537, -987, 893,
+    859, -132, -487, -117, 186, 116, -37, -54, -4, 14, 4, -1,
+    -1, 2, 13, 3, -46, -51, 84, 197, -35, -452, -271, 690,
+    1037, -553, -2468, -810, 5607, 12213, 12884, 6960, 38, -2537, -971, 900,
+    853, -138, -486, -113, 186, 115, -37, -54, -4, 14, 4, -1,
+    -1, 2, 13, 2, -46, -50, 85, 196, -38, -454, -267, 696,
+    1033, -569, -2473, -780, 5659, 12243, 12862, 6908, 2, -2537, -955, 907,
+    847, -144, -486, -110, 187, 114, -38, -54, -4, 14, 4, -1,
+    -1, 2, 13, 2, -47, -50, 86, 196, -41, -455, -262, 703,
+    1029, -585, -2478, -751, 5711, 12272, 12840, 6857, -33, -2536, -939, 913,
+    841, -149, -485, -107, 188, 113, -38, -54, -3, 14, 4, -1,
+    -1, 2, 13, 2, -47, -50, 87, 196, -44, -457, -257, 710,
+    1025, -601, -2483, -720, 5763, 12301, 12818, 6805, -68, -2536, -923, 919,
+    835, -155, -484, -104, 188, 112, -39, -53, -3, 14, 4, -1,
+    -1, 3, 13, 2, -47, -49, 89, 196, -47, -459, -253, 716,
+    1020, -617, -2487, -690, 5815, 12330, 12795, 6753, -103, -2535, -906, 926,
+    829, -160, -483, -101, 189, 110, -40, -53, -3, 14, 4, -1,
+    -1, 3, 13, 1, -48, -49, 90, 196, -50, -460, -248, 723,
+    1016, -633, -2491, -660, 5867, 12359, 12772, 6701, -138, -2534, -890, 932,
+    823, -166, -482, -98, 189, 109, -40, -53, -3, 14, 4, -1,
+    -1, 3, 13, 1, -48, -48, 91, 195, -53, -462, -243, 729,
+    1012, -649, -2495, -629, 5920, 12387, 12748, 6649, -172, -2533, -874, 938,
+    817, -171, -481, -95, 190, 108, -41, -52, -2, 14, 4, -1,
+    -1, 3, 13, 1, -48, -48, 92, 195, -56, -463, -238, 736,
+    1007, -665, -2499, -598, 5972, 12415, 12725, 6597, -206, -2531, -858, 944,
+    811, -177, -479, -92, 190, 107, -41, -52, -2, 14, 4, -1,
+    -1, 3, 13, 1, -49, -47, 93, 195, -59, -465, -233, 742,
+    1002, -681, -2503, -566, 6024, 12442, 12701, 6545, -240, -2530, -842, 950,
+    805, -182, -478, -89, 191, 106, -42, -52, -2, 14, 3, -1,
+    -1, 3, 13, 1, -49, -47, 95, 195, -62, -466, -228, 749,
+    997, -697, -2507, -535, 6076, 12470, 12676, 6493, -274, -2528, -826, 955,
+    799, -187, -477, -86, 191, 104, -42, -52, -1, 14, 3, -1,
+    -1, 3, 13, 0, -49, -46, 96, 194, -65, -468, -223, 755,
+    993, -713, -2510, -503, 6128, 12497, 12651, 6441, -307, -2526, -810, 961,
+    793, -192, -476, -83, 192, 103, -43, -51, -1, 14, 3, -1,
+    -1, 3, 13, 0, -50, -46, 97, 194, -68, -469, -218, 762,
+    988, -729, -2513, -471, 6180, 12523, 12626, 6389, -341, -2524, -793, 967,
+    787, -198, -475, -80, 192, 102, -44, -51, -1, 13, 3, -1,
+    -1, 3, 13, 0, -50, -45, 98, 194, -71, -471, -213, 768,
+    982, -745, -2516, -439, 6232, 12549, 12601, 6337, -374, -2521, -777, 972,
+    781, -203, -473, -77, 193, 101, -44, -51, -1, 13, 3, -1,
+    -1, 3, 13, 0, -50, -45, 100, 193, -74, -472, -208, 774,
+    977, -761, -2519, -406, 6285, 12575, 12575, 6285, -406, -2519, -761, 977,
+    774, -208, -472, -74, 193, 100, -45, -50, 0, 13, 3, -1,
+    -1, 3, 13, -1, -51, -44, 101, 193, -77, -473, -203, 781,
+    972, -777, -2521, -374, 6337, 12601, 12549, 6232, -439, -2516, -745, 982,
+    768, -213, -471, -71, 194, 98, -45, -50, 0, 13, 3, -1,
+    -1, 3, 13, -1, -51, -44, 102, 192, -80, -475, -198, 787,
+    967, -793, -2524, -341, 6389, 12626, 12523, 6180, -471, -2513, -729, 988,
+    762, -218, -469, -68, 194, 97, -46, -50, 0, 13, 3, -1,
+    -1, 3, 14, -1, -51, -43, 103, 192, -83, -476, -192, 793,
+    961, -810, -2526, -307, 6441, 12651, 12497, 6128, -503, -2510, -713, 993,
+    755, -223, -468, -65, 194, 96, -46, -49, 0, 13, 3, -1,
+    -1, 3, 14, -1, -52, -42, 104, 191, -86, -477, -187, 799,
+    955, -826, -2528, -274, 6493, 12676, 12470, 6076, -535, -2507, -697, 997,
+    749, -228, -466, -62, 195, 95, -47, -49, 1, 13, 3, -1,
+    -1, 3, 14, -2, -52, -42, 106, 191, -89, -478, -182, 805,
+    950, -842, -2530, -240, 6545, 12701, 12442, 6024, -566, -2503, -681, 1002,
+    742, -233, -465, -59, 195, 93, -47, -49, 1, 13, 3, -1,
+    -1, 4, 14, -2, -52, -41, 107, 190, -92, -479, -177, 811,
+    944, -858, -2531, -206, 6597, 12725, 12415, 5972, -598, -2499, -665, 1007,
+    736, -238, -463, -56, 195, 92, -48, -48, 1, 13, 3, -1,
+    -1, 4, 14, -2, -52, -41, 108, 190, -95, -481, -171, 817,
+    938, -874, -2533, -172, 6649, 12748, 12387, 5920, -629, -2495, -649, 1012,
+    729, -243, -462, -53, 195, 91, -48, -48, 1, 13, 3, -1,
+    -1, 4, 14, -3, -53, -40, 109, 189, -98, -482, -166, 823,
+    932, -890, -2534, -138, 6701, 12772, 12359, 5867, -660, -2491, -633, 1016,
+    723, -248, -460, -50, 196, 90, -49, -48, 1, 13, 3, -1,
+    -1, 4, 14, -3, -53, -40, 110, 189, -101, -483, -160, 829,
+    926, -906, -2535, -103, 6753, 12795, 12330, 5815, -690, -2487, -617, 1020,
+    716, -253, -459, -47, 196, 89, -49, -47, 2, 13, 3, -1,
+    -1, 4, 14, -3, -53, -39, 112, 188, -104, -484, -155, 835,
+    919, -923, -2536, -68, 6805, 12818, 12301, 5763, -720, -2483, -601, 1025,
+    710, -257, -457, -44, 196, 87, -50, -47, 2, 13, 2, -1,
+    -1, 4, 14, -3, -54, -38, 113, 188, -107, -485, -149, 841,
+    913, -939, -2536, -33, 6857, 12840, 12272, 5711, -751, -2478, -585, 1029,
+    703, -262, -455, -41, 196, 86, -50, -47, 2, 13, 2, -1,
+    -1, 4, 14, -4, -54, -38, 114, 187, -110, -486, -144, 847,
+    907, -955, -2537, 2, 6908, 12862, 12243, 5659, -780, -2473, -569, 1033,
+    696, -267, -454, -38, 196, 85, -50, -46, 2, 13, 2, -1,
+    -1, 4, 14, -4, -54, -37, 115, 186, -113, -486, -138, 853,
+    900, -971, -2537, 38, 6960, 12884, 12213, 5607, -810, -2468, -553, 1037,
+    690, -271, -452, -35, 197, 84, -51, -46, 3, 13, 2, -1,
+    -1, 4, 14, -4, -54, -37, 116, 186, -117, -487, -132, 859,
+    893, -987, -2537, 73, 7012, 12905, 12183, 5555, -839, -2463, -537, 1041,
+    683, -276, -450, -33, 197, 82, -51, -46, 3, 13, 2, -1,
+    -1, 4, 14, -4, -55, -36, 117, 185, -120, -488, -127, 864,
+    887, -1003, -2537, 109, 7064, 12926, 12153, 5503, -868, -2458, -522, 1044,
+    676, -280, -448, -30, 197, 81, -52, -45, 3, 13, 2, -1,
+    -1, 4, 14, -5, -55, -35, 119, 184, -123, -489, -121, 870,
+    880, -1019, -2536, 145, 7115, 12947, 12122, 5450, -897, -2452, -506, 1048,
+    670, -285, -447, -27, 197, 80, -52, -45, 3, 13, 2, -1,
+    -1, 4, 14, -5, -55, -35, 120, 184, -126, -490, -115, 875,
+    873, -1035, -2536, 182, 7167, 12967, 12092, 5398, -926, -2446, -490, 1052,
+    663, -289, -445, -24, 197, 79, -52, -45, 4, 13, 2, -1,
+    -1, 4, 14, -5, -56, -34, 121, 183, -129, -490, -109, 881,
+    866, -1052, -2535, 219, 7218, 12988, 12060, 5346, -954, -2440, -474, 1055,
+    656, -294, -443, -21, 197, 78, -53, -44, 4, 13, 2, -1,
+    -1, 4, 14, -6, -56, -33, 122, 182, -132, -491, -103, 886,
+    858, -1068, -2534, 255, 7270, 13007, 12029, 5294, -982, -2434, -459, 1059,
+    649, -298, -441, -18, 197, 76, -53, -44, 4, 13, 2, -1,
+    -1, 5, 14, -6, -56, -33, 123, 181, -135, -492, -98, 892,
+    851, -1084, -2532, 293, 7321, 13027, 11997, 5242, -1010, -2428, -443, 1062,
+    642, -302, -439, -16, 197, 75, -54, -44, 4, 12, 2, -1,
+    -1, 5, 14, -6, -56, -32, 124, 181, -138, -492, -92, 897,
+    844, -1100, -2531, 330, 7373, 13046, 11965, 5191, -1038, -2422, -428, 1065,
+    635, -306, -437, -13, 197, 74, -54, -43, 4, 12, 2, -1,
+    -1, 5, 14, -7, -57, -31, 126, 180, -142, -493, -86, 903,
+    836, -1116, -2529, 367, 7424, 13064, 11933, 5139, -1065, -2415, -412, 1068,
+    628, -311, -435, -10, 197, 73, -54, -43, 5, 12, 2, -1,
+    -1, 5, 14, -7, -57, -31, 127, 179, -145, -493, -80, 908,
+    829, -1132, -2527, 405, 7475, 13083, 11900, 5087, -1092, -2409, -396, 1071,
+    621, -315, -433, -7, 197, 72, -55, -43, 5, 12, 2, -1,
+    -1, 5, 14, -7, -57, -30, 128, 178, -148, -494, -74, 913,
+    821, -1148, -2525, 443, 7526, 13101, 11867, 5035, -1119, -2402, -381, 1074,
+    614, -319, -431, -5, 197, 70, -55, -42, 5, 12, 2, -1,
+    -1, 5, 14, -7, -57, -29, 129, 177, -151, -494, -68, 918,
+    813, -1164, -2523, 481, 7577, 13118, 11834, 4983, -1145, -2395, -365, 1076,
+    607, -323, -429, -2, 197, 69, -55, -42, 5, 12, 2, -1,
+    -1, 5, 14, -8, -57, -28, 130, 176, -154, -494, -62, 924,
+    805, -1180, -2520, 520, 7628, 13136, 11800, 4932, -1172, -2387, -350, 1079,
+    600, -327, -427, 1, 197, 68, -56, -42, 5, 12, 2, -1,
+    -1, 5, 14, -8, -58, -28, 131, 176, -157, -495, -55, 929,
+    797, -1196, -2517, 558, 7679, 13153, 11767, 4880, -1198, -2380, -335, 1082,
+    593, -331, -425, 3, 197, 67, -56, -41, 6, 12, 2, -1,
+    -1, 5, 14, -8, -58, -27, 132, 175, -161, -495, -49, 934,
+    789, -1212, -2514, 597, 7730, 13169, 11733, 4828, -1224, -2373, -319, 1084,
+    586, -335, -423, 6, 197, 65, -56, -41, 6, 12, 1, -1,
+    -1, 5, 14, -9, -58, -26, 134, 174, -164, -495, -43, 939,
+    781, -1228, -2511, 636, 7781, 13186, 11698, 4777, -1249, -2365, -304, 1086,
+    579, -339, -420, 9, 197, 64, -57, -41, 6, 12, 1, -1,
+    -1, 5, 14, -9, -58, -25, 135, 173, -167, -496, -37, 944,
+    773, -1243, -2507, 676, 7832, 13202, 11664, 4725, -1275, -2357, -289, 1089,
+    572, -343, -418, 11, 197, 63, -57, -40, 6, 12, 1, -1,
+    -1, 5, 14, -9, -59, -25, 136, 172, -170, -496, -31, 948,
+    764, -1259, -2504, 715, 7882, 13217, 11629, 4674, -1300, -2349, -274, 1091,
+    565, -346, -416, 14, 196, 62, -57, -40, 6, 12, 1, -1,
+    -1, 5, 14, -10, -59, -24, 137, 171, -173, -496, -24, 953,
+    756, -1275, -2500, 755, 7933, 13232, 11594, 4622, -1324, -2341, -258, 1093,
+    558, -350, -414, 17, 196, 61, -58, -39, 6, 12, 1, -1,
+    -1, 5, 14, -10, -59, -23, 138, 170, -177, -496, -18, 958,
+    747, -1291, -2496, 795, 7983, 13247, 11558, 4571, -1349, -2333, -243, 1095,
+    551, -354, -412, 19, 196, 59, -58, -39, 7, 12, 1, -1,
+    -1, 6, 14, -10, -59, -22, 139, 169, -180, -496, -12, 963,
+    738, -1307, -2491, 835, 8033, 13262, 11523, 4520, -1373, -2324, -228, 1097,
+    544, -357, -409, 22, 196, 58, -58, -39, 7, 12, 1, -1,
+    -1, 6, 14, -11, -59, -22, 140, 167, -183, -496, -5, 967,
+    730, -1322, -2487, 875, 8084, 13276, 11487, 4469, -1397, -2316, -213, 1098,
+    537, -361, -407, 24, 196, 57, -58, -38, 7, 12, 1, -1,
+    -1, 6, 14, -11, -60, -21, 141, 166, -186, -496, 1, 972,
+    721, -1338, -2482, 915, 8134, 13290, 11451, 4417, -1421, -2307, -198, 1100,
+    530, -365, -405, 27, 195, 56, -59, -38, 7, 12, 1, -1,
+    -1, 6, 14, -11, -60, -20, 142, 165, -189, -496, 7, 976,
+    712, -1354, -2477, 956, 8184, 13303, 11414, 4366, -1445, -2298, -183, 1101,
+    522, -368, -402, 30, 195, 55, -59, -38, 7, 11, 1, -1,
+    -1, 6, 14, -12, -60, -19, 143, 164, -192, -496, 14, 981,
+    703, -1369, -2471, 997, 8234, 13316, 11378, 4315, -1468, -2289, -168, 1103,
+    515, -371, -400, 32, 195, 54, -59, -37, 8, 11, 1, -1,
+    -1, 6, 14, -12, -60, -18, 144, 163, -196, -496, 20, 985,
+    693, -1385, -2466, 1038, 8284, 13329, 11341, 4264, -1491, -2280, -154, 1104,
+    508, -375, -397, 35, 195, 52, -59, -37, 8, 11, 1, -1,
+    -1, 6, 14, -12, -60, -18, 145, 162, -199, -496, 27, 989,
+    684, -1400, -2460, 1079, 8333, 13341, 11303, 4213, -1514, -2271, -139, 1106,
+    501, -378, -395, 37, 194, 51, -60, -37, 8, 11, 1, -1,
+    -1, 6, 14, -13, -60, -17, 147, 161, -202, -495, 33, 994,
+    675, -1416, -2454, 1121, 8383, 13353, 11266, 4163, -1536, -2261, -124, 1107,
+    494, -382, -393, 40, 194, 50, -60, -36, 8, 11, 1, -1,
+    -1, 6, 14, -13, -61, -16, 148, 159, -205, -495, 40, 998,
+    665, -1431, -2448, 1163, 8432, 13365, 11228, 4112, -1558, -2252, -110, 1108,
+    486, -385, -390, 42, 194, 49, -60, -36, 8, 11, 1, -1,
+    -1, 6, 14, -13, -61, -15, 149, 158, -208, -495, 47, 1002,
+    656, -1447, -2441, 1204, 8482, 13376, 11190, 4061, -1580, -2242, -95, 1109,
+    479, -388, -388, 44, 193, 48, -60, -35, 8, 11, 1, -1,
+    -1, 6, 14, -14, -61, -14, 150, 157, -212, -494, 53, 1006,
+    646, -1462, -2435, 1247, 8531, 13387, 11152, 4011, -1602, -2232, -80, 1110,
+    472, -391, -385, 47, 193, 46, -60, -35, 8, 11, 1, -1,
+    -1, 6, 14, -14, -61, -13, 151, 156, -215, -494, 60, 1010,
+    636, -1477, -2428, 1289, 8580, 13398, 11113, 3960, -1624, -2222, -66, 1110,
+    465, -394, -383, 49, 193, 45, -61, -35, 9, 11, 1, -1,
+    -1, 6, 14, -14, -61, -13, 152, 154, -218, -494, 67, 1014,
+    626, -1493, -2420, 1331, 8629, 13408, 11075, 3910, -1645, -2212, -52, 1111,
+    457, -397, -380, 52, 192, 44, -61, -34, 9, 11, 1, -1,
+    -1, 7, 14, -15, -61, -12, 153, 153, -221, -493, 73, 1018,
+    616, -1508, -2413, 1374, 8678, 13418, 11036, 3860, -1666, -2202, -37, 1112,
+    450, -400, -377, 54, 192, 43, -61, -34, 9, 11, 1, -1,
+    -1, 7, 14, -15, -62, -11, 154, 152, -224, -492, 80, 1022,
+    606, -1523, -2405, 1417, 8727, 13428, 10997, 3809, -1686, -2191, -23, 1112,
+    443, -403, -375, 56, 191, 42, -61, -34, 9, 11, 1, -1,
+    -1, 7, 13, -15, -62, -10, 155, 150, -227, -492, 87, 1025,
+    596, -1538, -2398, 1460, 8776, 13437, 10957, 3759, -1707, -2181, -9, 1112,
+    436, -406, -372, 59, 191, 41, -61, -33, 9, 11, 1, -1,
+    -1, 7, 13, -16, -62, -9, 156, 149, -231, -491, 93, 1029,
+    586, -1553, -2389, 1503, 8824, 13446, 10917, 3709, -1727, -2170, 5, 1113,
+    428, -409, -370, 61, 190, 39, -61, -33, 9, 11, 0, -1,
+    -1, 7, 13, -16, -62, -8, 157, 147, -234, -491, 100, 1033,
+    575, -1568, -2381, 1546, 8873, 13454, 10878, 3659, -1747, -2159, 20, 1113,
+    421, -412, -367, 63, 190, 38, -62, -32, 9, 10, 0, -1,
+    -1, 7, 13, -16, -62, -7, 158, 146, -237, -490, 107, 1036,
+    565, -1583, -2372, 1590, 8921, 13462, 10837, 3610, -1767, -2148, 34, 1113,
+    414, -415, -364, 66, 190, 37, -62, -32, 10, 10, 0, -1,
+    -1, 7, 13, -17, -62, -6, 159, 145, -240, -489, 114, 1040,
+    554, -1598, -2364, 1634, 8969, 13470, 10797, 3560, -1786, -2137, 48, 1113,
+    407, -418, -362, 68, 189, 36, -62, -32, 10, 10, 0, -1,
+    -1, 7, 13, -17, -62, -5, 159, 143, -243, -488, 121, 1043,
+    544, -1613, -2354, 1677, 9017, 13477, 10756, 3510, -1805, -2126, 61, 1113,
+    399, -420, -359, 70, 189, 35, -62, -31, 10, 10, 0, -1,
+    -1, 7, 13, -17, -62, -4, 160, 142, -246, -487, 128, 1046,
+    533, -1627, -2345, 1722, 9065, 13484, 10716, 3461, -1824, -2115, 75, 1113,
+    392, -423, -356, 72, 188, 34, -62, -31, 10, 10, 0, -1,
+    -1, 7, 13, -18, -62, -4, 161, 140, -249, -487, 135, 1049,
+    522, -1642, -2335, 1766, 9113, 13491, 10675, 3412, -1843, -2104, 89, 1113,
+    385, -426, -353, 75, 187, 33, -62, -31, 10, 10, 0, -1,
+    -1, 7, 13, -18, -63, -3, 162, 139, -253, -486, 141, 1053,
+    511, -1657, -2326, 1810, 9160, 13497, 10633, 3362, -1861, -2092, 103, 1112,
+    377, -428, -351, 77, 187, 32, -62, -30, 10, 10, 0, -1,
+    -1, 7, 13, -18, -63, -2, 163, 137, -256, -485, 148, 1056,
+    500, -1671, -2316, 1855, 9208, 13503, 10592, 3313, -1879, -2080, 116, 1112,
+    370, -431, -348, 79, 186, 30, -62, -30, 10, 10, 0, -1,
+    -1, 8, 13, -19, -63, -1, 164, 135, -259, -484, 155, 1059,
+    489, -1686, -2305, 1900, 9255, 13508, 10550, 3264, -1897, -2069, 130, 1111,
+    363, -433, -345, 81, 186, 29, -63, -29, 10, 10, 0, -1,
+    -1, 8, 13, -19, -63, 0, 165, 134, -262, -482, 162, 1062,
+    478, -1700, -2295, 1945, 9302, 13513, 10508, 3215, -1915, -2057, 143, 1111,
+    356, -435, -342, 83, 185, 28, -63, -29, 11, 10, 0, -1,
+    -1, 8, 13, -19, -63, 1, 166, 132, -265, -481, 169, 1064,
+    466, -1714, -2284, 1990, 9349, 13518, 10466, 3166, -1932, -2045, 157, 1110,
+    348, -438, -339, 85, 185, 27, -63, -29, 11, 10, 0, -1,
+    -1, 8, 13, -20, -63, 2, 167, 131, -268, -480, 176, 1067,
+    455, -1729, -2273, 2035, 9396, 13523, 10424, 3118, -1949, -2033, 170, 1109,
+    341, -440, -337, 88, 184, 26, -63, -28, 11, 10, 0, -1,
+    -1, 8, 13, -20, -63, 3, 168, 129, -271, -479, 183, 1070,
+    444, -1743, -2262, 2080, 9442, 13527, 10381, 3069, -1966, -2021, 183, 1108,
+    334, -442, -334, 90, 183, 25, -63, -28, 11, 10, 0, -1,
+    -1, 8, 13, -21, -63, 4, 168, 127, -274, -478, 190, 1073,
+    432, -1757, -2250, 2126, 9489, 13530, 10338, 3021, -1983, -2008, 197, 1107,
+    327, -445, -331, 92, 183, 24, -63, -28, 11, 9, 0, -1,
+    -1, 8, 13, -21, -63, 5, 169, 126, -277, -476, 197, 1075,
+    420, -1771, -2238, 2172, 9535, 13534, 10295, 2972, -1999, -1996, 210, 1106,
+    319, -447, -328, 94, 182, 23, -63, -27, 11, 9, 0, -1,
+    -1, 8, 13, -21, -63, 6, 170, 124, -280, -475, 205, 1078,
+    409, -1785, -2226, 2218, 9581, 13537, 10252, 2924, -2015, -1984, 223, 1105,
+    312, -449, -325, 96, 181, 22, -63, -27, 11, 9, 0, -1,
+    0, 8, 12, -22, -63, 7, 171, 122, -283, -474, 212, 1080,
+    397, -1799, -2214, 2264, 9627, 13539, 10209, 2876, -2031, -1971, 236, 1104,
+    305, -451, -322, 98, 181, 21, -63, -26, 11, 9, 0, -1,
+    0, 8, 12, -22, -63, 8, 172, 120, -286, -472, 219, 1082,
+    385, -1812, -2201, 2310, 9673, 13541, 10165, 2828, -2047, -1958, 249, 1102,
+    298, -453, -319, 100, 180, 20, -63, -26, 11, 9, 0, -1,
+    0, 8, 12, -22, -63, 9, 173, 119, -290, -471, 226, 1085,
+    373, -1826, -2188, 2356, 9719, 13543, 10121, 2780, -2062, -1946, 261, 1101,
+    290, -455, -316, 102, 179, 18, -63, -26, 12, 9, 0, -1,
+    0, 8, 12, -23, -63, 10, 173, 117, -293, -469, 233, 1087,
+    361, -1840, -2175, 2403, 9764, 13545, 10077, 2733, -2077, -1933, 274, 1100,
+    283, -457, -313, 104, 179, 17, -63, -25, 12, 9, 0, -1,
+    0, 8, 12, -23, -63, 11, 174, 115, -296, -467, 240, 1089,
+    349, -1853, -2162, 2449, 9810, 13546, 10033, 2685, -2092, -1920, 287, 1098,
+    276, -459, -311, 106, 178, 16, -63, -25, 12, 9, 0, -1,
+    0, 9, 12, -23, -63, 12, 175, 113, -299, -466, 247, 1091,
+    337, -1867, -2149, 2496, 9855, 13547, 9989, 2638, -2106, -1907, 299, 1096,
+    269, -461, -308, 107, 177, 15, -63, -25, 12, 9, 0, -1,
+    0, 9, 12, -24, -63, 13, 176, 111, -302, -464, 254, 1093,
+    324, -1880, -2135, 2543, 9900, 13547, 9944, 2590, -2121, -1893, 312, 1095,
+    262, -462, -305, 109, 176, 14, -63, -24, 12, 9, 0, -1,
+};
+
+// L/M=160/147, 16 taps: 22050->24000, 44100->48000
+const int16_t kBank160x147x16[2560] = {
+    -1, 21, -111, 360, -848, 1575, -2406, 3118, 29489, 2932, -2337, 1547,
+    -839, 358, -111, 21, -1, 21, -112, 362, -857, 1601, -2475, 3305,
+    29486, 2748, -2268, 1520, -829, 356, -111, 21, -1, 21, -112, 364,
+    -866, 1628, -2543, 3495, 29480, 2565, -2199, 1492, -820, 353, -111, 21,
+    -1, 21, -112, 366, -874, 1655, -2612, 3685, 29470, 2385, -2130, 1464,
+    -810, 351, -110, 21, -1, 21, -112, 368, -883, 1681, -2680, 3877,
+    29457, 2206, -2060, 1436, -800, 348, -110, 21, -1, 20, -112, 370,
+    -891, 1706, -2748, 4071, 29441, 2028, -1991, 1407, -790, 345, -109, 21,
+    -1, 20, -112, 371, -899, 1732, -2816, 4266, 29422, 1853, -1922, 1379,
+    -780, 342, -109, 21, -1, 20, -112, 373, -907, 1757, -2883, 4463,
+    29400, 1679, -1852, 1350, -769, 340, -108, 21, -1, 20, -112, 374,
+    -914, 1782, -2951, 4661, 29374, 1507, -1783, 1321, -759, 337, -108, 21,
+    -1, 20, -112, 375, -921, 1806, -3017, 4860, 29345, 1336, -1714, 1291,
+    -748, 334, -107, 21, -1, 20, -112, 377, -928, 1830, -3084, 5061,
+    29313, 1168, -1645, 1262, -737, 330, -107, 21, -1, 20, -111, 378,
+    -935, 1854, -3150, 5263, 29278, 1002, -1576, 1232, -726, 327, -106, 20,
+    -1, 20, -111, 378, -942, 1877, -3216, 5466, 29240, 837, -1507, 1203,
+    -715, 324, -105, 20, -1, 19, -111, 379, -948, 1899, -3281, 5671,
+    29198, 674, -1438, 1173, -703, 321, -105, 20, -1, 19, -110, 380,
+    -954, 1922, -3346, 5877, 29153, 513, -1370, 1143, -692, 317, -104, 20,
+    -1, 19, -110, 380, -959, 1944, -3410, 6084, 29105, 355, -1301, 1113,
+    -681, 314, -103, 20, -1, 19, -109, 381, -965, 1965, -3474, 6292,
+    29055, 198, -1233, 1083, -669, 310, -102, 20, -1, 19, -109, 381,
+    -970, 1986, -3537, 6502, 29000, 43, -1165, 1053, -657, 306, -102, 20,
+    -1, 18, -108, 381, -975, 2007, -3600, 6712, 28943, -110, -1098, 1022,
+    -645, 303, -101, 20, -1, 18, -108, 381, -980, 2027, -3662, 6924,
+    28883, -261, -1030, 992, -633, 299, -100, 20, -1, 18, -107, 381,
+    -984, 2046, -3724, 7137, 28820, -410, -963, 962, -621, 295, -99, 19,
+    -1, 17, -106, 380, -988, 2065, -3784, 7350, 28753, -557, -896, 931,
+    -609, 291, -98, 19, -1, 17, -106, 380, -992, 2084, -3845, 7565,
+    28683, -702, -830, 901, -597, 287, -97, 19, -1, 17, -105, 379,
+    -995, 2101, -3904, 7781, 28611, -844, -764, 870, -585, 283, -96, 19,
+    -1, 16, -104, 379, -998, 2119, -3963, 7997, 28535, -985, -698, 840,
+    -572, 279, -95, 19, -1, 16, -103, 378, -1001, 2136, -4021, 8215,
+    28457, -1124, -633, 809, -560, 275, -94, 19, -1, 16, -102, 377,
+    -1003, 2152, -4079, 8433, 28375, -1260, -568, 779, -547, 271, -93, 19,
+    0, 15, -101, 376, -1006, 2168, -4135, 8652, 28290, -1395, -503, 748,
+    -535, 267, -92, 18, 0, 15, -100, 374, -1007, 2183, -4191, 8872,
+    28203, -1527, -439, 718, -522, 263, -91, 18, 0, 15, -99, 373,
+    -1009, 2197, -4246, 9092, 28112, -1657, -375, 688, -510, 258, -90, 18,
+    0, 14, -97, 371, -1010, 2211, -4300, 9313, 28019, -1785, -312, 657,
+    -497, 254, -89, 18, 0, 14, -96, 369, -1011, 2225, -4353, 9535,
+    27922, -1910, -249, 627, -484, 250, -88, 18, 0, 13, -95, 367,
+    -1011, 2237, -4405, 9758, 27823, -2034, -187, 597, -471, 245, -87, 17,
+    0, 13, -93, 365, -1011, 2250, -4456, 9981, 27721, -2156, -125, 567,
+    -459, 241, -85, 17, 0, 12, -92, 363, -1011, 2261, -4507, 10205,
+    27616, -2275, -64, 537, -446, 236, -84, 17, 0, 12, -91, 361,
+    -1011, 2272, -4556, 10429, 27508, -2392, -3, 507, -433, 232, -83, 17,
+    0, 11, -89, 358, -1010, 2282, -4604, 10653, 27398, -2507, 57, 477,
+    -420, 227, -82, 17, 0, 11, -87, 355, -1009, 2291, -4652, 10878,
+    27284, -2619, 116, 447, -407, 223, -81, 16, 0, 10, -86, 352,
+    -1007, 2300, -4698, 11104, 27168, -2730, 175, 418, -394, 218, -79, 16,
+    0, 10, -84, 349, -1005, 2308, -4743, 11330, 27049, -2838, 234, 388,
+    -382, 214, -78, 16, 0, 9, -82, 346, -1003, 2316, -4787, 11556,
+    26928, -2944, 291, 359, -369, 209, -77, 16, 0, 8, -80, 343,
+    -1000, 2322, -4830, 11782, 26803, -3048, 348, 330, -356, 205, -76, 15,
+    1, 8, -79, 339, -997, 2328, -4871, 12009, 26676, -3149, 405, 301,
+    -343, 200, -75, 15, 1, 7, -77, 336, -993, 2333, -4912, 12235,
+    26547, -3249, 461, 272, -330, 195, -73, 15, 1, 6, -75, 332,
+    -990, 2338, -4951, 12462, 26415, -3346, 516, 244, -318, 191, -72, 15,
+    1, 6, -72, 328, -985, 2342, -4989, 12689, 26280, -3441, 570, 215,
+    -305, 186, -71, 14, 1, 5, -70, 324, -981, 2345, -5026, 12917,
+    26142, -3533, 624, 187, -292, 181, -69, 14, 1, 4, -68, 319,
+    -976, 2347, -5061, 13144, 26003, -3624, 677, 159, -279, 177, -68, 14,
+    1, 4, -66, 315, -971, 2348, -5095, 13371, 25860, -3712, 729, 131,
+    -267, 172, -67, 14, 1, 3, -64, 310, -965, 2349, -5128, 13598,
+    25715, -3798, 781, 104, -254, 167, -66, 13, 1, 2, -61, 305,
+    -959, 2349, -5160, 13825, 25568, -3881, 832, 76, -242, 163, -64, 13,
+    2, 1, -59, 300, -952, 2348, -5190, 14052, 25418, -3963, 882, 49,
+    -229, 158, -63, 13, 2, 1, -56, 295, -945, 2346, -5218, 14278,
+    25266, -4042, 932, 22, -217, 153, -62, 13, 2, 0, -54, 290,
+    -938, 2344, -5245, 14505, 25112, -4119, 980, -4, -204, 149, -60, 12,
+    2, -1, -51, 284, -930, 2340, -5271, 14731, 24955, -4194, 1028, -31,
+    -192, 144, -59, 12, 2, -2, -49, 279, -922, 2336, -5295, 14957,
+    24796, -4266, 1075, -57, -180, 140, -58, 12, 2, -3, -46, 273,
+    -914, 2331, -5318, 15182, 24635, -4337, 1122, -83, -168, 135, -56, 12,
+    2, -3, -43, 267, -905, 2326, -5339, 15407, 24471, -4405, 1167, -108,
+    -156, 130, -55, 12, 2, -4, -40, 261, -896, 2319, -5359, 15632,
+    24306, -4471, 1212, -134, -144, 126, -54, 11, 3, -5, -37, 254,
+    -886, 2312, -5377, 15856, 24138, -4534, 1256, -159, -132, 121, -52, 11,
+    3, -6, -34, 248, -876, 2303, -5394, 16080, 23968, -4596, 1299, -183,
+    -120, 117, -51, 11, 3, -7, -31, 241, -865, 2294, -5409, 16303,
+    23796, -4655, 1341, -208, -108, 112, -50, 11, 3, -8, -28, 234,
+    -855, 2284, -5422, 16526, 23622, -4712, 1383, -232, -96, 108, -49, 10,
+    3, -9, -25, 228, -843, 2274, -5433, 16748, 23446, -4767, 1423, -256,
+    -85, 103, -47, 10, 3, -10, -22, 220, -832, 2262, -5443, 16969,
+    23267, -4820, 1463, -279, -73, 99, -46, 10, 4, -11, -19, 213,
+    -820, 2249, -5452, 17190, 23087, -4871, 1502, -303, -62, 94, -45, 10,
+    4, -12, -16, 206, -807, 2236, -5458, 17409, 22905, -4919, 1540, -325,
+    -51, 90, -43, 9, 4, -13, -12, 198, -794, 2222, -5463, 17628,
+    22722, -4965, 1577, -348, -39, 85, -42, 9, 4, -14, -9, 190,
+    -781, 2207, -5466, 17846, 22536, -5010, 1614, -370, -28, 81, -41, 9,
+    4, -15, -6, 182, -767, 2191, -5467, 18064, 22348, -5052, 1649, -392,
+    -17, 77, -40, 9, 4, -16, -2, 174, -753, 2174, -5466, 18280,
+    22159, -5092, 1684, -414, -7, 72, -38, 8, 5, -17, 1, 166,
+    -739, 2156, -5464, 18495, 21968, -5130, 1717, -435, 4, 68, -37, 8,
+    5, -18, 5, 158, -724, 2137, -5460, 18710, 21776, -5165, 1750, -456,
+    15, 64, -36, 8, 5, -19, 9, 149, -709, 2118, -5454, 18923,
+    21581, -5199, 1782, -476, 25, 60, -35, 8, 5, -20, 12, 140,
+    -693, 2097, -5446, 19135, 21385, -5231, 1813, -496, 36, 55, -33, 8,
+    5, -22, 16, 132, -677, 2076, -5436, 19346, 21188, -5260, 1844, -516,
+    46, 51, -32, 7, 6, -23, 20, 123, -661, 2054, -5424, 19556,
+    20989, -5288, 1873, -535, 56, 47, -31, 7, 6, -24, 23, 114,
+    -644, 2030, -5411, 19765, 20788, -5313, 1902, -554, 66, 43, -30, 7,
+    6, -25, 27, 104, -627, 2006, -5395, 19972, 20586, -5337, 1929, -573,
+    76, 39, -28, 7, 6, -26, 31, 95, -609, 1982, -5378, 20178,
+    20383, -5358, 1956, -591, 85, 35, -27, 6, 6, -27, 35, 85,
+    -591, 1956, -5358, 20383, 20178, -5378, 1982, -609, 95, 31, -26, 6,
+    7, -28, 39, 76, -573, 1929, -5337, 20586, 19972, -5395, 2006, -627,
+    104, 27, -25, 6, 7, -30, 43, 66, -554, 1902, -5313, 20788,
+    19765, -5411, 2030, -644, 114, 23, -24, 6, 7, -31, 47, 56,
+    -535, 1873, -5288, 20989, 19556, -5424, 2054, -661, 123, 20, -23, 6,
+    7, -32, 51, 46, -516, 1844, -5260, 21188, 19346, -5436, 2076, -677,
+    132, 16, -22, 5, 8, -33, 55, 36, -496, 1813, -5231, 21385,
+    19135, -5446, 2097, -693, 140, 12, -20, 5, 8, -35, 60, 25,
+    -476, 1782, -5199, 21581, 18923, -5454, 2118, -709, 149, 9, -19, 5,
+    8, -36, 64, 15, -456, 1750, -5165, 21776, 18710, -5460, 2137, -724,
+    158, 5, -18, 5, 8, -37, 68, 4, -435, 1717, -5130, 21968,
+    18495, -5464, 2156, -739, 166, 1, -17, 5, 8, -38, 72, -7,
+    -414, 1684, -5092, 22159, 18280, -5466, 2174, -753, 174, -2, -16, 4,
+    9, -40, 77, -17, -392, 1649, -5052, 22348, 18064, -5467, 2191, -767,
+    182, -6, -15, 4, 9, -41, 81, -28, -370, 1614, -5010, 22536,
+    17846, -5466, 2207, -781, 190, -9, -14, 4, 9, -42, 85, -39,
+    -348, 1577, -4965, 22722, 17628, -5463, 2222, -794, 198, -12, -13, 4,
+    9, -43, 90, -51, -325, 1540, -4919, 22905, 17409, -5458, 2236, -807,
+    206, -16, -12, 4, 10, -45, 94, -62, -303, 1502, -4871, 23087,
+    17190, -5452, 2249, -820, 213, -19, -11, 4, 10, -46, 99, -73,
+    -279, 1463, -4820, 23267, 16969, -5443, 2262, -832, 220, -22, -10, 3,
+    10, -47, 103, -85, -256, 1423, -4767, 23446, 16748, -5433, 2274, -843,
+    228, -25, -9, 3, 10, -49, 108, -96, -232, 1383, -4712, 23622,
+    16526, -5422, 2284, -855, 234, -28, -8, 3, 11, -50, 112, -108,
+    -208, 1341, -4655, 23796, 16303, -5409, 2294, -865, 241, -31, -7, 3,
+    11, -51, 117, -120, -183, 1299, -4596, 23968, 16080, -5394, 2303, -876,
+    248, -34, -6, 3, 11, -52, 121, -132, -159, 1256, -4534, 24138,
+    15856, -5377, 2312, -886, 254, -37, -5, 3, 11, -54, 126, -144,
+    -134, 1212, -4471, 24306, 15632, -5359, 2319, -896, 261, -40, -4, 2,
+    12, -55, 130, -156, -108, 1167, -4405, 24471, 15407, -5339, 2326, -905,
+    267, -43, -3, 2, 12, -56, 135, -168, -83, 1122, -4337, 24635,
+    15182, -5318, 2331, -914, 273, -46, -3, 2, 12, -58, 140, -180,
+    -57, 1075, -4266, 24796, 14957, -5295, 2336, -922, 279, -49, -2, 2,
+    12, -59, 144, -192, -31, 1028, -4194, 24955, 14731, -5271, 2340, -930,
+    284, -51, -1, 2, 12, -60, 149, -204, -4, 980, -4119, 25112,
+    14505, -5245, 2344, -938, 290, -54, 0, 2, 13, -62, 153, -217,
+    22, 932, -4042, 25266, 14278, -5218, 2346, -945, 295, -56, 1, 2,
+    13, -63, 158, -229, 49, 882, -3963, 25418, 14052, -5190, 2348, -952,
+    300, -59, 1, 2, 13, -64, 163, -242, 76, 832, -3881, 25568,
+    13825, -5160, 2349, -959, 305, -61, 2, 1, 13, -66, 167, -254,
+    104, 781, -3798, 25715, 13598, -5128, 2349, -965, 310, -64, 3, 1,
+    14, -67, 172, -267, 131, 729, -3712, 25860, 13371, -5095, 2348, -971,
+    315, -66, 4, 1, 14, -68, 177, -279, 159, 677, -3624, 26003,
+    13144, -5061, 2347, -976, 319, -68, 4, 1, 14, -69, 181, -292,
+    187, 624, -3533, 26142, 12917, -5026, 2345, -981, 324, -70, 5, 1,
+    14, -71, 186, -305, 215, 570, -3441, 26280, 12689, -4989, 2342, -985,
+    328, -72, 6, 1, 15, -72, 191, -318, 244, 516, -3346, 26415,
+    12462, -4951, 2338, -990, 332, -75, 6, 1, 15, -73, 195, -330,
+    272, 461, -3249, 26547, 12235, -4912, 2333, -993, 336, -77, 7, 1,
+    15, -75, 200, -343, 301, 405, -3149, 26676, 12009, -4871, 2328, -997,
+    339, -79, 8, 1, 15, -76, 205, -356, 330, 348, -3048, 26803,
+    11782, -4830, 2322, -1000, 343, -80, 8, 0, 16, -77, 209, -369,
+    359, 291, -2944, 26928, 11556, -4787, 2316, -1003, 346, -82, 9, 0,
+    16, -78, 214, -382, 388, 234, -2838, 27049, 11330, -4743, 2308, -1005,
+    349, -84, 10, 0, 16, -79, 218, -394, 418, 175, -2730, 27168,
+    11104, -4698, 2300, -1007, 352, -86, 10, 0, 16, -81, 223, -407,
+    447, 116, -2619, 27284, 10878, -4652, 2291, -1009, 355, -87, 11, 0,
+    17, -82, 227, -420, 477, 57, -2507, 27398, 10653, -4604, 2282, -1010,
+    358, -89, 11, 0, 17, -83, 232, -433, 507, -3, -2392, 27508,
+    10429, -4556, 2272, -1011, 361, -91, 12, 0, 17, -84, 236, -446,
+    537, -64, -2275, 27616, 10205, -4507, 2261, -1011, 363, -92, 12, 0,
+    17, -85, 241, -459, 567, -125, -2156, 27721, 9981, -4456, 2250, -1011,
+    365, -93, 13, 0, 17, -87, 245, -471, 597, -187, -2034, 27823,
+    9758, -4405, 2237, -1011, 367, -95, 13, 0, 18, -88, 250, -484,
+    627, -249, -1910, 27922, 9535, -4353, 2225, -1011, 369, -96, 14, 0,
+    18, -89, 254, -497, 657, -312, -1785, 28019, 9313, -4300, 2211, -1010,
+    371, -97, 14, 0, 18, -90, 258, -510, 688, -375, -1657, 28112,
+    9092, -4246, 2197, -1009, 373, -99, 15, 0, 18, -91, 263, -522,
+    718, -439, -1527, 28203, 8872, -4191, 2183, -1007, 374, -100, 15, 0,
+    18, -92, 267, -535, 748, -503, -1395, 28290, 8652, -4135, 2168, -1006,
+    376, -101, 15, 0, 19, -93, 271, -547, 779, -568, -1260, 28375,
+    8433, -4079, 2152, -1003, 377, -102, 16, -1, 19, -94, 275, -560,
+    809, -633, -1124, 28457, 8215, -4021, 2136, -1001, 378, -103, 16, -1,
+    19, -95, 279, -572, 840, -698, -985, 28535, 7997, -3963, 2119, -998,
+    379, -104, 16, -1, 19, -96, 283, -585, 870, -764, -844, 28611,
+    7781, -3904, 2101, -995, 379, -105, 17, -1, 19, -97, 287, -597,
+    901, -830, -702, 28683, 7565, -3845, 2084, -992, 380, -106, 17, -1,
+    19, -98, 291, -609, 931, -896, -557, 28753, 7350, -3784, 2065, -988,
+    380, -106, 17, -1, 19, -99, 295, -621, 962, -963, -410, 28820,
+    7137, -3724, 2046, -984, 381, -107, 18, -1, 20, -100, 299, -633,
+    992, -1030, -261, 28883, 6924, -3662, 2027, -980, 381, -108, 18, -1,
+    20, -101, 303, -645, 1022, -1098, -110, 28943, 6712, -3600, 2007, -975,
+    381, -108, 18, -1, 20, -102, 306, -657, 1053, -1165, 43, 29000,
+    6502, -3537, 1986, -970, 381, -109, 19, -1, 20, -102, 310, -669,
+    1083, -1233, 198, 29055, 6292, -3474, 1965, -965, 381, -109, 19, -1,
+    20, -103, 314, -681, 1113, -1301, 355, 29105, 6084, -3410, 1944, -959,
+    380, -110, 19, -1, 20, -104, 317, -692, 1143, -1370, 513, 29153,
+    5877, -3346, 1922, -954, 380, -110, 19, -1, 20, -105, 321, -703,
+    1173, -1438, 674, 29198, 5671, -3281, 1899, -948, 379, -111, 19, -1,
+    20, -105, 324, -715, 1203, -1507, 837, 29240, 5466, -3216, 1877, -942,
+    378, -111, 20, -1, 20, -106, 327, -726, 1232, -1576, 1002, 29278,
+    5263, -3150, 1854, -935, 378, -111, 20, -1, 21, -107, 330, -737,
+    1262, -1645, 1168, 29313, 5061, -3084, 1830, -928, 377, -112, 20, -1,
+    21, -107, 334, -748, 1291, -1714, 1336, 29345, 4860, -3017, 1806, -921,
+    375, -112, 20, -1, 21, -108, 337, -759, 1321, -1783, 1507, 29374,
+    4661, -2951, 1782, -914, 374, -112, 20, -1, 21, -108, 340, -769,
+    1350, -1852, 1679, 29400, 4463, -2883, 1757, -907, 373, -112, 20, -1,
+    21, -109, 342, -780, 1379, -1922, 1853, 29422, 4266, -2816, 1732, -899,
+    371, -112, 20, -1, 21, -109, 345, -790, 1407, -1991, 2028, 29441,
+    4071, -2748, 1706, -891, 370, -112, 20, -1, 21, -110, 348, -800,
+    1436, -2060, 2206, 29457, 3877, -2680, 1681, -883, 368, -112, 21, -1,
+    21, -110, 351, -810, 1464, -2130, 2385, 29470, 3685, -2612, 1655, -874,
+    366, -112, 21, -1, 21, -111, 353, -820, 1492, -2199, 2565, 29480,
+    3495, -2543, 1628, -866, 364, -112, 21, -1, 21, -111, 356, -829,
+    1520, -2268, 2748, 29486, 3305, -2475, 1601, -857, 362, -112, 21, -1,
+    21, -111, 358, -839, 1547, -2337, 2932, 29489, 3118, -2406, 1575, -848,
+    360, -111, 21, -1,
+};
+
+// L/M=160/441, 48 taps: 22050->8000, 44100->16000
+const int16_t kBank160x441x48[7680] = {
+    0, -2, -2, 4, 15, 15, -15, -58, -55, 38, 161, 155,
+    -76, -372, -370, 125, 773, 819, -176, -1601, -1908, 220, 4510, 8868,
+    10699, 8846, 4481, 198, -1912, -1594, -168, 822, 770, 121, -372, -371,
+    -74, 155, 161, 37, -55, -58, -15, 15, 15, 4, -2, -2,
+    0, -2, -2, 4, 15, 15, -15, -58, -55, 39, 162, 154,
+    -78, -373, -369, 129, 776, 816, -185, -1608, -1903, 241, 4540, 8889,
+    10699, 8824, 4451, 177, -1917, -1587, -159, 824, 767, 117, -373, -369,
+    -72, 156, 160, 37, -56, -58, -14, 15, 15, 4, -2, -2,
+    0, -2, -2, 4, 15, 15, -15, -58, -54, 40, 162, 153,
+    -80, -374, -367, 134, 779, 813, -194, -1616, -1898, 263, 4570, 8911,
+    10699, 8802, 4421, 156, -1922, -1579, -150, 827, 764, 112, -375, -368,
+    -70, 157, 160, 36, -56, -57, -14, 15, 15, 4, -2, -2,
+    0, -2, -2, 4, 15, 15, -16, -59, -54, 41, 163, 152,
+    -82, -376, -365, 138, 782, 810, -203, -1623, -1892, 284, 4600, 8932,
+    10699, 8780, 4391, 135, -1927, -1572, -141, 830, 761, 108, -376, -366,
+    -68, 158, 159, 35, -56, -57, -14, 15, 15, 4, -2, -2,
+    0, -2, -2, 4, 15, 15, -16, -59, -54, 41, 163, 152,
+    -84, -377, -364, 142, 784, 806, -212, -1630, -1887, 306, 4630, 8953,
+    10698, 8758, 4361, 114, -1931, -1565, -133, 833, 758, 104, -378, -365,
+    -66, 158, 158, 34, -56, -57, -13, 15, 15, 3, -2, -2,
+    0, -2, -2, 4, 15, 14, -16, -59, -53, 42, 164, 151,
+    -86, -378, -362, 146, 787, 803, -221, -1637, -1882, 328, 4660, 8975,
+    10697, 8736, 4331, 93, -1935, -1557, -124, 836, 754, 100, -379, -364,
+    -64, 159, 158, 33, -57, -57, -13, 15, 15, 3, -2, -2,
+    0, -2, -2, 4, 15, 14, -16, -59, -53, 43, 164, 150,
+    -88, -379, -360, 151, 790, 800, -230, -1644, -1876, 350, 4690, 8996,
+    10696, 8714, 4301, 72, -1940, -1550, -115, 838, 751, 96, -381, -362,
+    -62, 160, 157, 33, -57, -56, -13, 15, 15, 3, -2, -2,
+    0, -2, -2, 4, 16, 14, -17, -59, -53, 44, 165, 149,
+    -90, -381, -359, 155, 793, 797, -239, -1651, -1871, 372, 4720, 9017,
+    10695, 8691, 4272, 51, -1944, -1542, -106, 841, 748, 91, -382, -361,
+    -60, 160, 157, 32, -57, -56, -13, 16, 15, 3, -2, -2,
+    0, -2, -2, 4, 16, 14, -17, -59, -52, 45, 165, 148,
+    -92, -382, -357, 159, 796, 794, -248, -1658, -1865, 394, 4750, 9038,
+    10694, 8669, 4242, 31, -1948, -1534, -98, 843, 745, 87, -384, -360,
+    -58, 161, 156, 31, -57, -56, -12, 16, 15, 3, -3, -2,
+    0, -2, -2, 4, 16, 14, -17, -60, -52, 45, 166, 147,
+    -94, -383, -355, 164, 799, 790, -257, -1664, -1859, 416, 4779, 9058,
+    10693, 8646, 4212, 10, -1952, -1527, -89, 846, 742, 83, -385, -358,
+    -57, 162, 155, 30, -58, -56, -12, 16, 15, 3, -3, -2,
+    0, -2, -2, 4, 16, 14, -18, -60, -52, 46, 166, 147,
+    -96, -384, -353, 168, 801, 787, -266, -1671, -1853, 438, 4809, 9079,
+    10691, 8623, 4182, -10, -1956, -1519, -81, 848, 739, 79, -386, -357,
+    -55, 162, 155, 29, -58, -56, -12, 16, 14, 3, -3, -2,
+    0, -2, -2, 4, 16, 14, -18, -60, -51, 47, 167, 146,
+    -98, -385, -352, 172, 804, 783, -275, -1678, -1847, 461, 4839, 9100,
+    10689, 8601, 4152, -31, -1960, -1511, -72, 851, 735, 75, -388, -355,
+    -53, 163, 154, 29, -58, -55, -12, 16, 14, 3, -3, -2,
+    0, -2, -2, 5, 16, 14, -18, -60, -51, 48, 167, 145,
+    -100, -387, -350, 177, 807, 780, -284, -1685, -1841, 483, 4869, 9120,
+    10688, 8578, 4123, -51, -1963, -1504, -63, 853, 732, 71, -389, -354,
+    -51, 164, 154, 28, -58, -55, -11, 16, 14, 3, -3, -2,
+    0, -2, -2, 5, 16, 14, -18, -60, -51, 49, 168, 144,
+    -102, -388, -348, 181, 809, 776, -293, -1691, -1835, 506, 4899, 9140,
+    10686, 8555, 4093, -71, -1967, -1496, -55, 856, 729, 67, -390, -352,
+    -49, 164, 153, 27, -59, -55, -11, 16, 14, 3, -3, -2,
+    0, -2, -2, 5, 16, 14, -19, -61, -50, 50, 168, 143,
+    -104, -389, -346, 185, 812, 773, -302, -1698, -1829, 528, 4929, 9160,
+    10684, 8531, 4063, -91, -1970, -1488, -46, 858, 725, 62, -392, -351,
+    -47, 165, 152, 26, -59, -55, -11, 16, 14, 3, -3, -2,
+    0, -2, -2, 5, 16, 13, -19, -61, -50, 50, 169, 142,
+    -106, -390, -344, 189, 815, 769, -311, -1704, -1822, 551, 4959, 9181,
+    10681, 8508, 4033, -111, -1974, -1480, -38, 860, 722, 58, -393, -349,
+    -45, 165, 152, 25, -59, -55, -11, 16, 14, 3, -3, -2,
+    0, -2, -2, 5, 16, 13, -19, -61, -50, 51, 169, 141,
+    -108, -391, -342, 194, 817, 766, -320, -1711, -1816, 574, 4989, 9201,
+    10679, 8485, 4004, -131, -1977, -1472, -29, 862, 719, 54, -394, -348,
+    -43, 166, 151, 25, -59, -54, -10, 16, 14, 3, -3, -2,
+    0, -2, -2, 5, 16, 13, -20, -61, -49, 52, 170, 140,
+    -110, -392, -340, 198, 820, 762, -329, -1717, -1809, 597, 5018, 9220,
+    10676, 8462, 3974, -151, -1980, -1464, -21, 865, 715, 50, -395, -346,
+    -41, 167, 151, 24, -60, -54, -10, 16, 14, 3, -3, -2,
+    0, -2, -2, 5, 16, 13, -20, -61, -49, 53, 170, 140,
+    -112, -393, -338, 203, 822, 758, -338, -1724, -1802, 620, 5048, 9240,
+    10673, 8438, 3944, -170, -1983, -1456, -13, 867, 712, 46, -396, -345,
+    -39, 167, 150, 23, -60, -54, -10, 16, 14, 3, -3, -2,
+    0, -2, -2, 5, 16, 13, -20, -61, -49, 54, 170, 139,
+    -114, -394, -336, 207, 825, 754, -348, -1730, -1796, 643, 5078, 9260,
+    10671, 8415, 3915, -190, -1986, -1448, -4, 869, 708, 42, -398, -343,
+    -37, 168, 149, 22, -60, -54, -10, 16, 14, 3, -3, -2,
+    0, -2, -2, 5, 16, 13, -20, -62, -48, 55, 171, 138,
+    -116, -395, -334, 211, 827, 751, -357, -1736, -1789, 666, 5108, 9279,
+    10668, 8391, 3885, -209, -1989, -1440, 4, 871, 705, 38, -399, -342,
+    -36, 168, 149, 22, -60, -53, -9, 16, 14, 2, -3, -2,
+    0, -2, -2, 5, 16, 13, -21, -62, -48, 55, 171, 137,
+    -118, -397, -332, 216, 830, 747, -366, -1742, -1782, 689, 5138, 9299,
+    10664, 8367, 3855, -229, -1992, -1432, 13, 873, 702, 34, -400, -340,
+    -34, 169, 148, 21, -60, -53, -9, 16, 14, 2, -3, -2,
+    0, -2, -2, 5, 16, 13, -21, -62, -48, 56, 172, 136,
+    -120, -398, -330, 220, 832, 743, -375, -1749, -1774, 712, 5168, 9318,
+    10661, 8343, 3826, -248, -1995, -1424, 21, 875, 698, 30, -401, -339,
+    -32, 169, 147, 20, -61, -53, -9, 17, 14, 2, -3, -2,
+    0, -2, -2, 5, 16, 13, -21, -62, -47, 57, 172, 135,
+    -122, -399, -328, 224, 834, 739, -384, -1755, -1767, 736, 5197, 9337,
+    10658, 8319, 3796, -267, -1997, -1416, 29, 877, 695, 26, -402, -337,
+    -30, 170, 147, 19, -61, -53, -9, 17, 14, 2, -3, -2,
+    0, -2, -2, 5, 16, 12, -21, -62, -47, 58, 173, 134,
+    -124, -400, -326, 229, 837, 735, -394, -1761, -1760, 759, 5227, 9356,
+    10654, 8295, 3767, -286, -2000, -1408, 37, 879, 691, 22, -403, -336,
+    -28, 170, 146, 19, -61, -52, -8, 17, 14, 2, -3, -2,
+    0, -2, -2, 5, 16, 12, -22, -62, -46, 59, 173, 133,
+    -126, -401, -324, 233, 839, 731, -403, -1767, -1752, 783, 5257, 9375,
+    10650, 8271, 3737, -305, -2002, -1400, 46, 881, 688, 18, -404, -334,
+    -26, 171, 145, 18, -61, -52, -8, 17, 13, 2, -3, -2,
+    0, -2, -2, 6, 17, 12, -22, -62, -46, 60, 173, 132,
+    -128, -402, -322, 237, 841, 727, -412, -1773, -1745, 806, 5287, 9394,
+    10646, 8247, 3708, -324, -2005, -1391, 54, 882, 684, 14, -405, -332,
+    -24, 171, 145, 17, -61, -52, -8, 17, 13, 2, -3, -2,
+    0, -2, -2, 6, 17, 12, -22, -63, -46, 60, 174, 131,
+    -130, -402, -320, 242, 844, 723, -421, -1779, -1737, 830, 5317, 9413,
+    10642, 8223, 3678, -343, -2007, -1383, 62, 884, 680, 10, -406, -331,
+    -23, 172, 144, 16, -62, -52, -8, 17, 13, 2, -3, -2,
+    0, -2, -2, 6, 17, 12, -23, -63, -45, 61, 174, 130,
+    -132, -403, -318, 246, 846, 718, -431, -1785, -1729, 854, 5346, 9431,
+    10638, 8198, 3649, -362, -2009, -1375, 70, 886, 677, 6, -407, -329,
+    -21, 172, 143, 16, -62, -51, -7, 17, 13, 2, -3, -2,
+    0, -2, -2, 6, 17, 12, -23, -63, -45, 62, 175, 129,
+    -134, -404, -315, 251, 848, 714, -440, -1790, -1722, 878, 5376, 9450,
+    10633, 8174, 3619, -380, -2011, -1367, 78, 887, 673, 2, -408, -327,
+    -19, 173, 143, 15, -62, -51, -7, 17, 13, 2, -3, -2,
+    0, -2, -2, 6, 17, 12, -23, -63, -44, 63, 175, 128,
+    -136, -405, -313, 255, 850, 710, -449, -1796, -1714, 902, 5406, 9468,
+    10629, 8149, 3590, -399, -2013, -1358, 86, 889, 670, -2, -409, -326,
+    -17, 173, 142, 14, -62, -51, -7, 17, 13, 2, -3, -2,
+    -1, -2, -2, 6, 17, 12, -23, -63, -44, 64, 175, 127,
+    -138, -406, -311, 259, 852, 706, -459, -1802, -1706, 926, 5435, 9487,
+    10624, 8125, 3560, -417, -2015, -1350, 94, 891, 666, -6, -410, -324,
+    -15, 174, 141, 13, -62, -51, -7, 17, 13, 2, -3, -2,
+    -1, -2, -2, 6, 17, 12, -24, -63, -44, 65, 176, 126,
+    -140, -407, -309, 264, 855, 701, -468, -1807, -1697, 950, 5465, 9505,
+    10619, 8100, 3531, -435, -2017, -1341, 102, 892, 662, -10, -411, -323,
+    -13, 174, 141, 13, -63, -50, -6, 17, 13, 2, -3, -2,
+    -1, -2, -2, 6, 17, 11, -24, -63, -43, 65, 176, 125,
+    -142, -408, -306, 268, 857, 697, -477, -1813, -1689, 974, 5495, 9523,
+    10614, 8075, 3502, -454, -2018, -1333, 110, 894, 659, -14, -412, -321,
+    -12, 175, 140, 12, -63, -50, -6, 17, 13, 2, -3, -2,
+    -1, -2, -2, 6, 17, 11, -24, -64, -43, 66, 176, 124,
+    -144, -409, -304, 273, 859, 692, -487, -1818, -1681, 998, 5524, 9541,
+    10609, 8050, 3472, -472, -2020, -1324, 118, 895, 655, -18, -413, -319,
+    -10, 175, 139, 11, -63, -50, -6, 17, 13, 2, -3, -1,
+    -1, -2, -2, 6, 17, 11, -25, -64, -42, 67, 177, 123,
+    -146, -410, -302, 277, 861, 688, -496, -1824, -1672, 1023, 5554, 9558,
+    10604, 8025, 3443, -490, -2021, -1316, 126, 896, 651, -21, -413, -318,
+    -8, 175, 139, 10, -63, -50, -6, 17, 13, 2, -3, -1,
+    -1, -2, -2, 6, 17, 11, -25, -64, -42, 68, 177, 121,
+    -148, -410, -300, 281, 863, 683, -505, -1829, -1664, 1047, 5584, 9576,
+    10598, 8000, 3414, -508, -2023, -1307, 134, 898, 647, -25, -414, -316,
+    -6, 176, 138, 10, -63, -49, -5, 17, 13, 2, -3, -1,
+    -1, -2, -2, 6, 17, 11, -25, -64, -41, 69, 177, 120,
+    -150, -411, -297, 286, 865, 679, -515, -1834, -1655, 1072, 5613, 9593,
+    10593, 7975, 3385, -525, -2024, -1299, 142, 899, 644, -29, -415, -314,
+    -4, 176, 137, 9, -63, -49, -5, 17, 13, 2, -3, -1,
+    -1, -2, -2, 6, 17, 11, -26, -64, -41, 70, 178, 119,
+    -152, -412, -295, 290, 867, 674, -524, -1840, -1646, 1096, 5643, 9611,
+    10587, 7950, 3355, -543, -2025, -1290, 150, 900, 640, -33, -416, -312,
+    -3, 176, 136, 8, -63, -49, -5, 17, 13, 1, -3, -1,
+    -1, -2, -2, 6, 17, 11, -26, -64, -40, 71, 178, 118,
+    -154, -413, -292, 295, 868, 669, -533, -1845, -1637, 1121, 5672, 9628,
+    10581, 7925, 3326, -561, -2026, -1282, 158, 902, 636, -37, -417, -311,
+    -1, 177, 136, 7, -64, -49, -5, 17, 12, 1, -3, -1,
+    -1, -2, -2, 7, 17, 10, -26, -64, -40, 71, 178, 117,
+    -156, -414, -290, 299, 870, 665, -543, -1850, -1628, 1146, 5702, 9645,
+    10575, 7899, 3297, -578, -2028, -1273, 165, 903, 632, -41, -417, -309,
+    1, 177, 135, 7, -64, -48, -4, 17, 12, 1, -3, -1,
+    -1, -2, -2, 7, 17, 10, -26, -64, -40, 72, 179, 116,
+    -158, -414, -288, 303, 872, 660, -552, -1855, -1619, 1170, 5731, 9662,
+    10569, 7874, 3268, -596, -2028, -1264, 173, 904, 628, -44, -418, -307,
+    3, 178, 134, 6, -64, -48, -4, 17, 12, 1, -3, -1,
+    -1, -2, -2, 7, 17, 10, -27, -64, -39, 73, 179, 115,
+    -161, -415, -285, 308, 874, 655, -561, -1860, -1610, 1195, 5761, 9679,
+    10562, 7848, 3239, -613, -2029, -1256, 181, 905, 625, -48, -419, -306,
+    4, 178, 134, 5, -64, -48, -4, 17, 12, 1, -3, -1,
+    -1, -2, -2, 7, 17, 10, -27, -65, -39, 74, 179, 114,
+    -163, -416, -283, 312, 876, 650, -571, -1865, -1600, 1220, 5790, 9696,
+    10556, 7823, 3210, -630, -2030, -1247, 189, 906, 621, -52, -419, -304,
+    6, 178, 133, 5, -64, -48, -4, 17, 12, 1, -3, -1,
+    -1, -2, -2, 7, 17, 10, -27, -65, -38, 75, 179, 112,
+    -165, -416, -280, 317, 877, 646, -580, -1870, -1591, 1245, 5820, 9713,
+    10549, 7797, 3181, -647, -2031, -1238, 196, 907, 617, -56, -420, -302,
+    8, 179, 132, 4, -64, -47, -3, 17, 12, 1, -3, -1,
+    -1, -2, -2, 7, 17, 10, -28, -65, -38, 76, 180, 111,
+    -167, -417, -278, 321, 879, 641, -590, -1875, -1581, 1270, 5849, 9729,
+    10542, 7771, 3152, -664, -2031, -1229, 204, 908, 613, -59, -421, -300,
+    10, 179, 131, 3, -64, -47, -3, 18, 12, 1, -3, -1,
+    -1, -2, -1, 7, 17, 10, -28, -65, -37, 76, 180, 110,
+    -169, -418, -275, 326, 881, 636, -599, -1880, -1572, 1296, 5878, 9745,
+    10536, 7745, 3123, -681, -2032, -1220, 211, 909, 609, -63, -421, -299,
+    11, 179, 131, 2, -65, -47, -3, 18, 12, 1, -3, -1,
+    -1, -2, -1, 7, 17, 9, -28, -65, -37, 77, 180, 109,
+    -171, -418, -273, 330, 882, 631, -609, -1884, -1562, 1321, 5908, 9762,
+    10528, 7720, 3094, -698, -2032, -1212, 219, 910, 605, -67, -422, -297,
+    13, 179, 130, 2, -65, -47, -3, 18, 12, 1, -3, -1,
+    -1, -2, -1, 7, 17, 9, -28, -65, -36, 78, 180, 108,
+    -173, -419, -270, 334, 884, 626, -618, -1889, -1552, 1346, 5937, 9778,
+    10521, 7694, 3065, -714, -2033, -1203, 226, 911, 601, -71, -422, -295,
+    15, 180, 129, 1, -65, -46, -3, 18, 12, 1, -3, -1,
+    -1, -2, -1, 7, 17, 9, -29, -65, -36, 79, 181, 106,
+    -175, -420, -267, 339, 886, 621, -627, -1893, -1542, 1371, 5966, 9794,
+    10514, 7667, 3036, -731, -2033, -1194, 234, 912, 597, -74, -423, -293,
+    17, 180, 128, 0, -65, -46, -2, 18, 12, 1, -3, -1,
+    -1, -2, -1, 7, 17, 9, -29, -65, -35, 80, 181, 105,
+    -177, -420, -265, 343, 887, 615, -637, -1898, -1532, 1397, 5995, 9810,
+    10506, 7641, 3008, -747, -2033, -1185, 241, 912, 593, -78, -423, -291,
+    18, 180, 128, 0, -65, -46, -2, 18, 12, 1, -3, -1,
+    -1, -2, -1, 7, 17, 9, -29, -65, -35, 81, 181, 104,
+    -179, -421, -262, 348, 889, 610, -646, -1902, -1522, 1423, 6025, 9826,
+    10499, 7615, 2979, -764, -2033, -1176, 249, 913, 589, -82, -424, -290,
+    20, 181, 127, -1, -65, -46, -2, 18, 12, 1, -3, -1,
+    -1, -2, -1, 7, 17, 9, -30, -65, -34, 81, 181, 103,
+    -181, -421, -260, 352, 890, 605, -656, -1907, -1511, 1448, 6054, 9841,
+    10491, 7589, 2950, -780, -2033, -1167, 256, 914, 585, -85, -424, -288,
+    22, 181, 126, -2, -65, -45, -2, 18, 12, 1, -3, -1,
+    -1, -2, -1, 7, 18, 9, -30, -65, -34, 82, 182, 101,
+    -183, -422, -257, 356, 892, 600, -665, -1911, -1501, 1474, 6083, 9857,
+    10483, 7563, 2921, -796, -2033, -1158, 264, 914, 581, -89, -425, -286,
+    23, 181, 125, -2, -65, -45, -1, 18, 11, 1, -3, -1,
+    -1, -2, -1, 8, 18, 8, -30, -66, -33, 83, 182, 100,
+    -185, -422, -254, 361, 893, 594, -675, -1915, -1490, 1500, 6112, 9872,
+    10475, 7536, 2893, -812, -2033, -1149, 271, 915, 577, -93, -425, -284,
+    25, 181, 125, -3, -65, -45, -1, 18, 11, 1, -3, -1,
+    -1, -2, -1, 8, 18, 8, -30, -66, -33, 84, 182, 99,
+    -187, -423, -251, 365, 894, 589, -684, -1919, -1480, 1525, 6141, 9887,
+    10466, 7510, 2864, -828, -2032, -1140, 278, 915, 573, -96, -426, -282,
+    27, 182, 124, -4, -65, -44, -1, 18, 11, 1, -3, -1,
+    -1, -2, -1, 8, 18, 8, -31, -66, -32, 85, 182, 98,
+    -189, -423, -249, 370, 896, 584, -694, -1923, -1469, 1551, 6170, 9902,
+    10458, 7483, 2836, -844, -2032, -1131, 285, 916, 569, -100, -426, -281,
+    28, 182, 123, -4, -65, -44, -1, 18, 11, 1, -3, -1,
+    -1, -3, -1, 8, 18, 8, -31, -66, -32, 86, 182, 96,
+    -191, -424, -246, 374, 897, 578, -703, -1927, -1458, 1577, 6199, 9917,
+    10449, 7456, 2807, -860, -2031, -1122, 293, 916, 565, -103, -427, -279,
+    30, 182, 122, -5, -66, -44, -1, 18, 11, 1, -3, -1,
+    -1, -3, -1, 8, 18, 8, -31, -66, -31, 87, 182, 95,
+    -193, -424, -243, 378, 898, 573, -712, -1931, -1447, 1603, 6228, 9932,
+    10441, 7430, 2779, -875, -2031, -1113, 300, 917, 561, -107, -427, -277,
+    32, 182, 121, -6, -66, -44, 0, 18, 11, 1, -3, -1,
+    -1, -3, -1, 8, 18, 8, -32, -66, -31, 87, 183, 94,
+    -195, -425, -240, 383, 899, 567, -722, -1935, -1436, 1629, 6257, 9947,
+    10432, 7403, 2750, -891, -2030, -1104, 307, 917, 557, -110, -427, -275,
+    33, 182, 121, -6, -66, -43, 0, 18, 11, 0, -3, -1,
+    -1, -3, -1, 8, 18, 7, -32, -66, -30, 88, 183, 92,
+    -197, -425, -238, 387, 901, 562, -731, -1939, -1425, 1655, 6286, 9961,
+    10423, 7376, 2722, -906, -2030, -1095, 314, 918, 553, -114, -428, -273,
+    35, 183, 120, -7, -66, -43, 0, 18, 11, 0, -3, -1,
+    -1, -3, -1, 8, 18, 7, -32, -66, -30, 89, 183, 91,
+    -199, -426, -235, 391, 902, 556, -741, -1943, -1414, 1682, 6315, 9976,
+    10414, 7349, 2694, -922, -2029, -1086, 321, 918, 549, -117, -428, -271,
+    37, 183, 119, -8, -66, -43, 0, 18, 11, 0, -3, -1,
+    -1, -3, -1, 8, 18, 7, -33, -66, -29, 90, 183, 90,
+    -201, -426, -232, 396, 903, 551, -750, -1947, -1402, 1708, 6344, 9990,
+    10404, 7322, 2665, -937, -2028, -1077, 328, 918, 545, -121, -428, -269,
+    38, 183, 118, -8, -66, -43, 1, 18, 11, 0, -3, -1,
+    -1, -3, -1, 8, 18, 7, -33, -66, -29, 91, 183, 89,
+    -203, -426, -229, 400, 904, 545, -760, -1950, -1391, 1734, 6372, 10004,
+    10395, 7295, 2637, -952, -2027, -1068, 335, 918, 541, -124, -428, -267,
+    40, 183, 118, -9, -66, -42, 1, 18, 11, 0, -3, -1,
+    -1, -3, -1, 8, 18, 7, -33, -66, -28, 92, 183, 87,
+    -205, -427, -226, 405, 905, 539, -769, -1954, -1379, 1761, 6401, 10018,
+    10385, 7268, 2609, -967, -2026, -1058, 342, 919, 537, -128, -429, -266,
+    41, 183, 117, -10, -66, -42, 1, 18, 11, 0, -3, -1,
+    -1, -3, -1, 8, 18, 7, -33, -66, -28, 92, 183, 86,
+    -207, -427, -223, 409, 906, 533, -779, -1957, -1368, 1787, 6430, 10032,
+    10376, 7241, 2581, -982, -2025, -1049, 349, 919, 533, -131, -429, -264,
+    43, 183, 116, -10, -66, -42, 1, 18, 11, 0, -3, -1,
+    -1, -3, -1, 8, 18, 6, -34, -66, -27, 93, 184, 84,
+    -209, -427, -220, 413, 907, 528, -788, -1961, -1356, 1814, 6458, 10046,
+    10366, 7214, 2553, -997, -2023, -1040, 356, 919, 528, -135, -429, -262,
+    45, 183, 115, -11, -66, -41, 1, 18, 10, 0, -3, -1,
+    -1, -3, -1, 9, 18, 6, -34, -66, -27, 94, 184, 83,
+    -211, -428, -217, 418, 908, 522, -797, -1964, -1344, 1840, 6487, 10060,
+    10356, 7187, 2524, -1011, -2022, -1031, 363, 919, 524, -138, -429, -260,
+    46, 184, 114, -12, -66, -41, 2, 18, 10, 0, -3, -1,
+    -1, -3, -1, 9, 18, 6, -34, -66, -26, 95, 184, 82,
+    -213, -428, -214, 422, 909, 516, -807, -1967, -1332, 1867, 6516, 10073,
+    10346, 7159, 2496, -1026, -2021, -1022, 370, 919, 520, -141, -429, -258,
+    48, 184, 114, -12, -66, -41, 2, 18, 10, 0, -3, -1,
+    -1, -3, -1, 9, 18, 6, -35, -66, -25, 96, 184, 80,
+    -215, -428, -211, 426, 910, 510, -816, -1970, -1320, 1894, 6544, 10087,
+    10335, 7132, 2469, -1040, -2019, -1012, 376, 919, 516, -145, -430, -256,
+    49, 184, 113, -13, -66, -41, 2, 18, 10, 0, -3, -1,
+    -1, -3, -1, 9, 18, 6, -35, -66, -25, 97, 184, 79,
+    -217, -429, -208, 431, 910, 504, -826, -1973, -1308, 1921, 6573, 10100,
+    10325, 7104, 2441, -1055, -2018, -1003, 383, 919, 512, -148, -430, -254,
+    51, 184, 112, -14, -66, -40, 2, 18, 10, 0, -3, -1,
+    -1, -3, -1, 9, 18, 6, -35, -66, -24, 97, 184, 78,
+    -219, -429, -205, 435, 911, 498, -835, -1976, -1295, 1947, 6601, 10113,
+    10314, 7077, 2413, -1069, -2016, -994, 390, 919, 508, -151, -430, -252,
+    52, 184, 111, -14, -66, -40, 2, 18, 10, 0, -3, -1,
+    -1, -3, -1, 9, 18, 5, -35, -66, -24, 98, 184, 76,
+    -221, -429, -202, 439, 912, 492, -844, -1979, -1283, 1974, 6630, 10126,
+    10304, 7049, 2385, -1083, -2014, -985, 397, 919, 503, -155, -430, -250,
+    54, 184, 110, -15, -66, -40, 3, 18, 10, 0, -3, -1,
+    -1, -3, -1, 9, 18, 5, -36, -66, -23, 99, 184, 75,
+    -223, -429, -199, 444, 913, 486, -854, -1982, -1270, 2001, 6658, 10139,
+    10293, 7022, 2357, -1097, -2013, -975, 403, 918, 499, -158, -430, -248,
+    55, 184, 110, -15, -66, -39, 3, 18, 10, 0, -3, -1,
+    -1, -3, -1, 9, 18, 5, -36, -66, -23, 100, 184, 73,
+    -225, -429, -196, 448, 913, 480, -863, -1985, -1258, 2028, 6686, 10151,
+    10282, 6994, 2330, -1111, -2011, -966, 410, 918, 495, -161, -430, -247,
+    57, 184, 109, -16, -66, -39, 3, 18, 10, 0, -3, -1,
+    -1, -3, -1, 9, 18, 5, -36, -66, -22, 101, 184, 72,
+    -227, -430, -193, 452, 914, 474, -873, -1988, -1245, 2055, 6714, 10164,
+    10271, 6966, 2302, -1125, -2009, -957, 416, 918, 491, -165, -430, -245,
+    59, 184, 108, -17, -66, -39, 3, 18, 10, 0, -3, -1,
+    -1, -3, -1, 9, 18, 5, -37, -66, -21, 102, 184, 70,
+    -229, -430, -190, 457, 915, 467, -882, -1990, -1232, 2083, 6743, 10176,
+    10259, 6939, 2274, -1139, -2007, -948, 423, 918, 486, -168, -430, -243,
+    60, 184, 107, -17, -66, -39, 3, 18, 10, 0, -3, -1,
+    -1, -3, 0, 9, 18, 4, -37, -66, -21, 102, 184, 69,
+    -231, -430, -187, 461, 915, 461, -891, -1993, -1219, 2110, 6771, 10189,
+    10248, 6911, 2247, -1152, -2005, -938, 429, 917, 482, -171, -430, -241,
+    62, 184, 106, -18, -66, -38, 4, 18, 10, 0, -3, -1,
+    -1, -3, 0, 9, 18, 4, -37, -66, -20, 103, 184, 67,
+    -233, -430, -184, 465, 916, 455, -901, -1995, -1206, 2137, 6799, 10201,
+    10236, 6883, 2219, -1166, -2003, -929, 436, 917, 478, -174, -430, -239,
+    63, 184, 106, -18, -66, -38, 4, 18, 10, 0, -3, -1,
+    -1, -3, 0, 9, 18, 4, -37, -66, -20, 104, 184, 66,
+    -235, -430, -181, 469, 916, 448, -910, -1998, -1193, 2164, 6827, 10213,
+    10225, 6855, 2192, -1179, -2000, -920, 442, 917, 474, -177, -430, -237,
+    65, 184, 105, -19, -66, -38, 4, 18, 10, 0, -3, -1,
+    -1, -3, 0, 10, 18, 4, -38, -66, -19, 105, 184, 65,
+    -237, -430, -177, 474, 917, 442, -920, -2000, -1179, 2192, 6855, 10225,
+    10213, 6827, 2164, -1193, -1998, -910, 448, 916, 469, -181, -430, -235,
+    66, 184, 104, -20, -66, -37, 4, 18, 9, 0, -3, -1,
+    -1, -3, 0, 10, 18, 4, -38, -66, -18, 106, 184, 63,
+    -239, -430, -174, 478, 917, 436, -929, -2003, -1166, 2219, 6883, 10236,
+    10201, 6799, 2137, -1206, -1995, -901, 455, 916, 465, -184, -430, -233,
+    67, 184, 103, -20, -66, -37, 4, 18, 9, 0, -3, -1,
+    -1, -3, 0, 10, 18, 4, -38, -66, -18, 106, 184, 62,
+    -241, -430, -171, 482, 917, 429, -938, -2005, -1152, 2247, 6911, 10248,
+    10189, 6771, 2110, -1219, -1993, -891, 461, 915, 461, -187, -430, -231,
+    69, 184, 102, -21, -66, -37, 4, 18, 9, 0, -3, -1,
+    -1, -3, 0, 10, 18, 3, -39, -66, -17, 107, 184, 60,
+    -243, -430, -168, 486, 918, 423, -948, -2007, -1139, 2274, 6939, 10259,
+    10176, 6743, 2083, -1232, -1990, -882, 467, 915, 457, -190, -430, -229,
+    70, 184, 102, -21, -66, -37, 5, 18, 9, -1, -3, -1,
+    -1, -3, 0, 10, 18, 3, -39, -66, -17, 108, 184, 59,
+    -245, -430, -165, 491, 918, 416, -957, -2009, -1125, 2302, 6966, 10271,
+    10164, 6714, 2055, -1245, -1988, -873, 474, 914, 452, -193, -430, -227,
+    72, 184, 101, -22, -66, -36, 5, 18, 9, -1, -3, -1,
+    -1, -3, 0, 10, 18, 3, -39, -66, -16, 109, 184, 57,
+    -247, -430, -161, 495, 918, 410, -966, -2011, -1111, 2330, 6994, 10282,
+    10151, 6686, 2028, -1258, -1985, -863, 480, 913, 448, -196, -429, -225,
+    73, 184, 100, -23, -66, -36, 5, 18, 9, -1, -3, -1,
+    -1, -3, 0, 10, 18, 3, -39, -66, -15, 110, 184, 55,
+    -248, -430, -158, 499, 918, 403, -975, -2013, -1097, 2357, 7022, 10293,
+    10139, 6658, 2001, -1270, -1982, -854, 486, 913, 444, -199, -429, -223,
+    75, 184, 99, -23, -66, -36, 5, 18, 9, -1, -3, -1,
+    -1, -3, 0, 10, 18, 3, -40, -66, -15, 110, 184, 54,
+    -250, -430, -155, 503, 919, 397, -985, -2014, -1083, 2385, 7049, 10304,
+    10126, 6630, 1974, -1283, -1979, -844, 492, 912, 439, -202, -429, -221,
+    76, 184, 98, -24, -66, -35, 5, 18, 9, -1, -3, -1,
+    -1, -3, 0, 10, 18, 2, -40, -66, -14, 111, 184, 52,
+    -252, -430, -151, 508, 919, 390, -994, -2016, -1069, 2413, 7077, 10314,
+    10113, 6601, 1947, -1295, -1976, -835, 498, 911, 435, -205, -429, -219,
+    78, 184, 97, -24, -66, -35, 6, 18, 9, -1, -3, -1,
+    -1, -3, 0, 10, 18, 2, -40, -66, -14, 112, 184, 51,
+    -254, -430, -148, 512, 919, 383, -1003, -2018, -1055, 2441, 7104, 10325,
+    10100, 6573, 1921, -1308, -1973, -826, 504, 910, 431, -208, -429, -217,
+    79, 184, 97, -25, -66, -35, 6, 18, 9, -1, -3, -1,
+    -1, -3, 0, 10, 18, 2, -41, -66, -13, 113, 184, 49,
+    -256, -430, -145, 516, 919, 376, -1012, -2019, -1040, 2469, 7132, 10335,
+    10087, 6544, 1894, -1320, -1970, -816, 510, 910, 426, -211, -428, -215,
+    80, 184, 96, -25, -66, -35, 6, 18, 9, -1, -3, -1,
+    -1, -3, 0, 10, 18, 2, -41, -66, -12, 114, 184, 48,
+    -258, -429, -141, 520, 919, 370, -1022, -2021, -1026, 2496, 7159, 10346,
+    10073, 6516, 1867, -1332, -1967, -807, 516, 909, 422, -214, -428, -213,
+    82, 184, 95, -26, -66, -34, 6, 18, 9, -1, -3, -1,
+    -1, -3, 0, 10, 18, 2, -41, -66, -12, 114, 184, 46,
+    -260, -429, -138, 524, 919, 363, -1031, -2022, -1011, 2524, 7187, 10356,
+    10060, 6487, 1840, -1344, -1964, -797, 522, 908, 418, -217, -428, -211,
+    83, 184, 94, -27, -66, -34, 6, 18, 9, -1, -3, -1,
+    -1, -3, 0, 10, 18, 1, -41, -66, -11, 115, 183, 45,
+    -262, -429, -135, 528, 919, 356, -1040, -2023, -997, 2553, 7214, 10366,
+    10046, 6458, 1814, -1356, -1961, -788, 528, 907, 413, -220, -427, -209,
+    84, 184, 93, -27, -66, -34, 6, 18, 8, -1, -3, -1,
+    -1, -3, 0, 11, 18, 1, -42, -66, -10, 116, 183, 43,
+    -264, -429, -131, 533, 919, 349, -1049, -2025, -982, 2581, 7241, 10376,
+    10032, 6430, 1787, -1368, -1957, -779, 533, 906, 409, -223, -427, -207,
+    86, 183, 92, -28, -66, -33, 7, 18, 8, -1, -3, -1,
+    -1, -3, 0, 11, 18, 1, -42, -66, -10, 117, 183, 41,
+    -266, -429, -128, 537, 919, 342, -1058, -2026, -967, 2609, 7268, 10385,
+    10018, 6401, 1761, -1379, -1954, -769, 539, 905, 405, -226, -427, -205,
+    87, 183, 92, -28, -66, -33, 7, 18, 8, -1, -3, -1,
+    -1, -3, 0, 11, 18, 1, -42, -66, -9, 118, 183, 40,
+    -267, -428, -124, 541, 918, 335, -1068, -2027, -952, 2637, 7295, 10395,
+    10004, 6372, 1734, -1391, -1950, -760, 545, 904, 400, -229, -426, -203,
+    89, 183, 91, -29, -66, -33, 7, 18, 8, -1, -3, -1,
+    -1, -3, 0, 11, 18, 1, -43, -66, -8, 118, 183, 38,
+    -269, -428, -121, 545, 918, 328, -1077, -2028, -937, 2665, 7322, 10404,
+    9990, 6344, 1708, -1402, -1947, -750, 551, 903, 396, -232, -426, -201,
+    90, 183, 90, -29, -66, -33, 7, 18, 8, -1, -3, -1,
+    -1, -3, 0, 11, 18, 0, -43, -66, -8, 119, 183, 37,
+    -271, -428, -117, 549, 918, 321, -1086, -2029, -922, 2694, 7349, 10414,
+    9976, 6315, 1682, -1414, -1943, -741, 556, 902, 391, -235, -426, -199,
+    91, 183, 89, -30, -66, -32, 7, 18, 8, -1, -3, -1,
+    -1, -3, 0, 11, 18, 0, -43, -66, -7, 120, 183, 35,
+    -273, -428, -114, 553, 918, 314, -1095, -2030, -906, 2722, 7376, 10423,
+    9961, 6286, 1655, -1425, -1939, -731, 562, 901, 387, -238, -425, -197,
+    92, 183, 88, -30, -66, -32, 7, 18, 8, -1, -3, -1,
+    -1, -3, 0, 11, 18, 0, -43, -66, -6, 121, 182, 33,
+    -275, -427, -110, 557, 917, 307, -1104, -2030, -891, 2750, 7403, 10432,
+    9947, 6257, 1629, -1436, -1935, -722, 567, 899, 383, -240, -425, -195,
+    94, 183, 87, -31, -66, -32, 8, 18, 8, -1, -3, -1,
+    -1, -3, 1, 11, 18, 0, -44, -66, -6, 121, 182, 32,
+    -277, -427, -107, 561, 917, 300, -1113, -2031, -875, 2779, 7430, 10441,
+    9932, 6228, 1603, -1447, -1931, -712, 573, 898, 378, -243, -424, -193,
+    95, 182, 87, -31, -66, -31, 8, 18, 8, -1, -3, -1,
+    -1, -3, 1, 11, 18, -1, -44, -66, -5, 122, 182, 30,
+    -279, -427, -103, 565, 916, 293, -1122, -2031, -860, 2807, 7456, 10449,
+    9917, 6199, 1577, -1458, -1927, -703, 578, 897, 374, -246, -424, -191,
+    96, 182, 86, -32, -66, -31, 8, 18, 8, -1, -3, -1,
+    -1, -3, 1, 11, 18, -1, -44, -65, -4, 123, 182, 28,
+    -281, -426, -100, 569, 916, 285, -1131, -2032, -844, 2836, 7483, 10458,
+    9902, 6170, 1551, -1469, -1923, -694, 584, 896, 370, -249, -423, -189,
+    98, 182, 85, -32, -66, -31, 8, 18, 8, -1, -2, -1,
+    -1, -3, 1, 11, 18, -1, -44, -65, -4, 124, 182, 27,
+    -282, -426, -96, 573, 915, 278, -1140, -2032, -828, 2864, 7510, 10466,
+    9887, 6141, 1525, -1480, -1919, -684, 589, 894, 365, -251, -423, -187,
+    99, 182, 84, -33, -66, -30, 8, 18, 8, -1, -2, -1,
+    -1, -3, 1, 11, 18, -1, -45, -65, -3, 125, 181, 25,
+    -284, -425, -93, 577, 915, 271, -1149, -2033, -812, 2893, 7536, 10475,
+    9872, 6112, 1500, -1490, -1915, -675, 594, 893, 361, -254, -422, -185,
+    100, 182, 83, -33, -66, -30, 8, 18, 8, -1, -2, -1,
+    -1, -3, 1, 11, 18, -1, -45, -65, -2, 125, 181, 23,
+    -286, -425, -89, 581, 914, 264, -1158, -2033, -796, 2921, 7563, 10483,
+    9857, 6083, 1474, -1501, -1911, -665, 600, 892, 356, -257, -422, -183,
+    101, 182, 82, -34, -65, -30, 9, 18, 7, -1, -2, -1,
+    -1, -3, 1, 12, 18, -2, -45, -65, -2, 126, 181, 22,
+    -288, -424, -85, 585, 914, 256, -1167, -2033, -780, 2950, 7589, 10491,
+    9841, 6054, 1448, -1511, -1907, -656, 605, 890, 352, -260, -421, -181,
+    103, 181, 81, -34, -65, -30, 9, 17, 7, -1, -2, -1,
+    -1, -3, 1, 12, 18, -2, -46, -65, -1, 127, 181, 20,
+    -290, -424, -82, 589, 913, 249, -1176, -2033, -764, 2979, 7615, 10499,
+    9826, 6025, 1423, -1522, -1902, -646, 610, 889, 348, -262, -421, -179,
+    104, 181, 81, -35, -65, -29, 9, 17, 7, -1, -2, -1,
+    -1, -3, 1, 12, 18, -2, -46, -65, 0, 128, 180, 18,
+    -291, -423, -78, 593, 912, 241, -1185, -2033, -747, 3008, 7641, 10506,
+    9810, 5995, 1397, -1532, -1898, -637, 615, 887, 343, -265, -420, -177,
+    105, 181, 80, -35, -65, -29, 9, 17, 7, -1, -2, -1,
+    -1, -3, 1, 12, 18, -2, -46, -65, 0, 128, 180, 17,
+    -293, -423, -74, 597, 912, 234, -1194, -2033, -731, 3036, 7667, 10514,
+    9794, 5966, 1371, -1542, -1893, -627, 621, 886, 339, -267, -420, -175,
+    106, 181, 79, -36, -65, -29, 9, 17, 7, -1, -2, -1,
+    -1, -3, 1, 12, 18, -3, -46, -65, 1, 129, 180, 15,
+    -295, -422, -71, 601, 911, 226, -1203, -2033, -714, 3065, 7694, 10521,
+    9778, 5937, 1346, -1552, -1889, -618, 626, 884, 334, -270, -419, -173,
+    108, 180, 78, -36, -65, -28, 9, 17, 7, -1, -2, -1,
+    -1, -3, 1, 12, 18, -3, -47, -65, 2, 130, 179, 13,
+    -297, -422, -67, 605, 910, 219, -1212, -2032, -698, 3094, 7720, 10528,
+    9762, 5908, 1321, -1562, -1884, -609, 631, 882, 330, -273, -418, -171,
+    109, 180, 77, -37, -65, -28, 9, 17, 7, -1, -2, -1,
+    -1, -3, 1, 12, 18, -3, -47, -65, 2, 131, 179, 11,
+    -299, -421, -63, 609, 909, 211, -1220, -2032, -681, 3123, 7745, 10536,
+    9745, 5878, 1296, -1572, -1880, -599, 636, 881, 326, -275, -418, -169,
+    110, 180, 76, -37, -65, -28, 10, 17, 7, -1, -2, -1,
+    -1, -3, 1, 12, 18, -3, -47, -64, 3, 131, 179, 10,
+    -300, -421, -59, 613, 908, 204, -1229, -2031, -664, 3152, 7771, 10542,
+    9729, 5849, 1270, -1581, -1875, -590, 641, 879, 321, -278, -417, -167,
+    111, 180, 76, -38, -65, -28, 10, 17, 7, -2, -2, -1,
+    -1, -3, 1, 12, 17, -3, -47, -64, 4, 132, 179, 8,
+    -302, -420, -56, 617, 907, 196, -1238, -2031, -647, 3181, 7797, 10549,
+    9713, 5820, 1245, -1591, -1870, -580, 646, 877, 317, -280, -416, -165,
+    112, 179, 75, -38, -65, -27, 10, 17, 7, -2, -2, -1,
+    -1, -3, 1, 12, 17, -4, -48, -64, 5, 133, 178, 6,
+    -304, -419, -52, 621, 906, 189, -1247, -2030, -630, 3210, 7823, 10556,
+    9696, 5790, 1220, -1600, -1865, -571, 650, 876, 312, -283, -416, -163,
+    114, 179, 74, -39, -65, -27, 10, 17, 7, -2, -2, -1,
+    -1, -3, 1, 12, 17, -4, -48, -64, 5, 134, 178, 4,
+    -306, -419, -48, 625, 905, 181, -1256, -2029, -613, 3239, 7848, 10562,
+    9679, 5761, 1195, -1610, -1860, -561, 655, 874, 308, -285, -415, -161,
+    115, 179, 73, -39, -64, -27, 10, 17, 7, -2, -2, -1,
+    -1, -3, 1, 12, 17, -4, -48, -64, 6, 134, 178, 3,
+    -307, -418, -44, 628, 904, 173, -1264, -2028, -596, 3268, 7874, 10569,
+    9662, 5731, 1170, -1619, -1855, -552, 660, 872, 303, -288, -414, -158,
+    116, 179, 72, -40, -64, -26, 10, 17, 7, -2, -2, -1,
+    -1, -3, 1, 12, 17, -4, -48, -64, 7, 135, 177, 1,
+    -309, -417, -41, 632, 903, 165, -1273, -2028, -578, 3297, 7899, 10575,
+    9645, 5702, 1146, -1628, -1850, -543, 665, 870, 299, -290, -414, -156,
+    117, 178, 71, -40, -64, -26, 10, 17, 7, -2, -2, -1,
+    -1, -3, 1, 12, 17, -5, -49, -64, 7, 136, 177, -1,
+    -311, -417, -37, 636, 902, 158, -1282, -2026, -561, 3326, 7925, 10581,
+    9628, 5672, 1121, -1637, -1845, -533, 669, 868, 295, -292, -413, -154,
+    118, 178, 71, -40, -64, -26, 11, 17, 6, -2, -2, -1,
+    -1, -3, 1, 13, 17, -5, -49, -63, 8, 136, 176, -3,
+    -312, -416, -33, 640, 900, 150, -1290, -2025, -543, 3355, 7950, 10587,
+    9611, 5643, 1096, -1646, -1840, -524, 674, 867, 290, -295, -412, -152,
+    119, 178, 70, -41, -64, -26, 11, 17, 6, -2, -2, -1,
+    -1, -3, 2, 13, 17, -5, -49, -63, 9, 137, 176, -4,
+    -314, -415, -29, 644, 899, 142, -1299, -2024, -525, 3385, 7975, 10593,
+    9593, 5613, 1072, -1655, -1834, -515, 679, 865, 286, -297, -411, -150,
+    120, 177, 69, -41, -64, -25, 11, 17, 6, -2, -2, -1,
+    -1, -3, 2, 13, 17, -5, -49, -63, 10, 138, 176, -6,
+    -316, -414, -25, 647, 898, 134, -1307, -2023, -508, 3414, 8000, 10598,
+    9576, 5584, 1047, -1664, -1829, -505, 683, 863, 281, -300, -410, -148,
+    121, 177, 68, -42, -64, -25, 11, 17, 6, -2, -2, -1,
+    -1, -3, 2, 13, 17, -6, -50, -63, 10, 139, 175, -8,
+    -318, -413, -21, 651, 896, 126, -1316, -2021, -490, 3443, 8025, 10604,
+    9558, 5554, 1023, -1672, -1824, -496, 688, 861, 277, -302, -410, -146,
+    123, 177, 67, -42, -64, -25, 11, 17, 6, -2, -2, -1,
+    -1, -3, 2, 13, 17, -6, -50, -63, 11, 139, 175, -10,
+    -319, -413, -18, 655, 895, 118, -1324, -2020, -472, 3472, 8050, 10609,
+    9541, 5524, 998, -1681, -1818, -487, 692, 859, 273, -304, -409, -144,
+    124, 176, 66, -43, -64, -24, 11, 17, 6, -2, -2, -1,
+    -2, -3, 2, 13, 17, -6, -50, -63, 12, 140, 175, -12,
+    -321, -412, -14, 659, 894, 110, -1333, -2018, -454, 3502, 8075, 10614,
+    9523, 5495, 974, -1689, -1813, -477, 697, 857, 268, -306, -408, -142,
+    125, 176, 65, -43, -63, -24, 11, 17, 6, -2, -2, -1,
+    -2, -3, 2, 13, 17, -6, -50, -63, 13, 141, 174, -13,
+    -323, -411, -10, 662, 892, 102, -1341, -2017, -435, 3531, 8100, 10619,
+    9505, 5465, 950, -1697, -1807, -468, 701, 855, 264, -309, -407, -140,
+    126, 176, 65, -44, -63, -24, 12, 17, 6, -2, -2, -1,
+    -2, -3, 2, 13, 17, -7, -51, -62, 13, 141, 174, -15,
+    -324, -410, -6, 666, 891, 94, -1350, -2015, -417, 3560, 8125, 10624,
+    9487, 5435, 926, -1706, -1802, -459, 706, 852, 259, -311, -406, -138,
+    127, 175, 64, -44, -63, -23, 12, 17, 6, -2, -2, -1,
+    -2, -3, 2, 13, 17, -7, -51, -62, 14, 142, 173, -17,
+    -326, -409, -2, 670, 889, 86, -1358, -2013, -399, 3590, 8149, 10629,
+    9468, 5406, 902, -1714, -1796, -449, 710, 850, 255, -313, -405, -136,
+    128, 175, 63, -44, -63, -23, 12, 17, 6, -2, -2, 0,
+    -2, -3, 2, 13, 17, -7, -51, -62, 15, 143, 173, -19,
+    -327, -408, 2, 673, 887, 78, -1367, -2011, -380, 3619, 8174, 10633,
+    9450, 5376, 878, -1722, -1790, -440, 714, 848, 251, -315, -404, -134,
+    129, 175, 62, -45, -63, -23, 12, 17, 6, -2, -2, 0,
+    -2, -3, 2, 13, 17, -7, -51, -62, 16, 143, 172, -21,
+    -329, -407, 6, 677, 886, 70, -1375, -2009, -362, 3649, 8198, 10638,
+    9431, 5346, 854, -1729, -1785, -431, 718, 846, 246, -318, -403, -132,
+    130, 174, 61, -45, -63, -23, 12, 17, 6, -2, -2, 0,
+    -2, -3, 2, 13, 17, -8, -52, -62, 16, 144, 172, -23,
+    -331, -406, 10, 680, 884, 62, -1383, -2007, -343, 3678, 8223, 10642,
+    9413, 5317, 830, -1737, -1779, -421, 723, 844, 242, -320, -402, -130,
+    131, 174, 60, -46, -63, -22, 12, 17, 6, -2, -2, 0,
+    -2, -3, 2, 13, 17, -8, -52, -61, 17, 145, 171, -24,
+    -332, -405, 14, 684, 882, 54, -1391, -2005, -324, 3708, 8247, 10646,
+    9394, 5287, 806, -1745, -1773, -412, 727, 841, 237, -322, -402, -128,
+    132, 173, 60, -46, -62, -22, 12, 17, 6, -2, -2, 0,
+    -2, -3, 2, 13, 17, -8, -52, -61, 18, 145, 171, -26,
+    -334, -404, 18, 688, 881, 46, -1400, -2002, -305, 3737, 8271, 10650,
+    9375, 5257, 783, -1752, -1767, -403, 731, 839, 233, -324, -401, -126,
+    133, 173, 59, -46, -62, -22, 12, 16, 5, -2, -2, 0,
+    -2, -3, 2, 14, 17, -8, -52, -61, 19, 146, 170, -28,
+    -336, -403, 22, 691, 879, 37, -1408, -2000, -286, 3767, 8295, 10654,
+    9356, 5227, 759, -1760, -1761, -394, 735, 837, 229, -326, -400, -124,
+    134, 173, 58, -47, -62, -21, 12, 16, 5, -2, -2, 0,
+    -2, -3, 2, 14, 17, -9, -53, -61, 19, 147, 170, -30,
+    -337, -402, 26, 695, 877, 29, -1416, -1997, -267, 3796, 8319, 10658,
+    9337, 5197, 736, -1767, -1755, -384, 739, 834, 224, -328, -399, -122,
+    135, 172, 57, -47, -62, -21, 13, 16, 5, -2, -2, 0,
+    -2, -3, 2, 14, 17, -9, -53, -61, 20, 147, 169, -32,
+    -339, -401, 30, 698, 875, 21, -1424, -1995, -248, 3826, 8343, 10661,
+    9318, 5168, 712, -1774, -1749, -375, 743, 832, 220, -330, -398, -120,
+    136, 172, 56, -48, -62, -21, 13, 16, 5, -2, -2, 0,
+    -2, -3, 2, 14, 16, -9, -53, -60, 21, 148, 169, -34,
+    -340, -400, 34, 702, 873, 13, -1432, -1992, -229, 3855, 8367, 10664,
+    9299, 5138, 689, -1782, -1742, -366, 747, 830, 216, -332, -397, -118,
+    137, 171, 55, -48, -62, -21, 13, 16, 5, -2, -2, 0,
+    -2, -3, 2, 14, 16, -9, -53, -60, 22, 149, 168, -36,
+    -342, -399, 38, 705, 871, 4, -1440, -1989, -209, 3885, 8391, 10668,
+    9279, 5108, 666, -1789, -1736, -357, 751, 827, 211, -334, -395, -116,
+    138, 171, 55, -48, -62, -20, 13, 16, 5, -2, -2, 0,
+    -2, -3, 3, 14, 16, -10, -54, -60, 22, 149, 168, -37,
+    -343, -398, 42, 708, 869, -4, -1448, -1986, -190, 3915, 8415, 10671,
+    9260, 5078, 643, -1796, -1730, -348, 754, 825, 207, -336, -394, -114,
+    139, 170, 54, -49, -61, -20, 13, 16, 5, -2, -2, 0,
+    -2, -3, 3, 14, 16, -10, -54, -60, 23, 150, 167, -39,
+    -345, -396, 46, 712, 867, -13, -1456, -1983, -170, 3944, 8438, 10673,
+    9240, 5048, 620, -1802, -1724, -338, 758, 822, 203, -338, -393, -112,
+    140, 170, 53, -49, -61, -20, 13, 16, 5, -2, -2, 0,
+    -2, -3, 3, 14, 16, -10, -54, -60, 24, 151, 167, -41,
+    -346, -395, 50, 715, 865, -21, -1464, -1980, -151, 3974, 8462, 10676,
+    9220, 5018, 597, -1809, -1717, -329, 762, 820, 198, -340, -392, -110,
+    140, 170, 52, -49, -61, -20, 13, 16, 5, -2, -2, 0,
+    -2, -3, 3, 14, 16, -10, -54, -59, 25, 151, 166, -43,
+    -348, -394, 54, 719, 862, -29, -1472, -1977, -131, 4004, 8485, 10679,
+    9201, 4989, 574, -1816, -1711, -320, 766, 817, 194, -342, -391, -108,
+    141, 169, 51, -50, -61, -19, 13, 16, 5, -2, -2, 0,
+    -2, -3, 3, 14, 16, -11, -55, -59, 25, 152, 165, -45,
+    -349, -393, 58, 722, 860, -38, -1480, -1974, -111, 4033, 8508, 10681,
+    9181, 4959, 551, -1822, -1704, -311, 769, 815, 189, -344, -390, -106,
+    142, 169, 50, -50, -61, -19, 13, 16, 5, -2, -2, 0,
+    -2, -3, 3, 14, 16, -11, -55, -59, 26, 152, 165, -47,
+    -351, -392, 62, 725, 858, -46, -1488, -1970, -91, 4063, 8531, 10684,
+    9160, 4929, 528, -1829, -1698, -302, 773, 812, 185, -346, -389, -104,
+    143, 168, 50, -50, -61, -19, 14, 16, 5, -2, -2, 0,
+    -2, -3, 3, 14, 16, -11, -55, -59, 27, 153, 164, -49,
+    -352, -390, 67, 729, 856, -55, -1496, -1967, -71, 4093, 8555, 10686,
+    9140, 4899, 506, -1835, -1691, -293, 776, 809, 181, -348, -388, -102,
+    144, 168, 49, -51, -60, -18, 14, 16, 5, -2, -2, 0,
+    -2, -3, 3, 14, 16, -11, -55, -58, 28, 154, 164, -51,
+    -354, -389, 71, 732, 853, -63, -1504, -1963, -51, 4123, 8578, 10688,
+    9120, 4869, 483, -1841, -1685, -284, 780, 807, 177, -350, -387, -100,
+    145, 167, 48, -51, -60, -18, 14, 16, 5, -2, -2, 0,
+    -2, -3, 3, 14, 16, -12, -55, -58, 29, 154, 163, -53,
+    -355, -388, 75, 735, 851, -72, -1511, -1960, -31, 4152, 8601, 10689,
+    9100, 4839, 461, -1847, -1678, -275, 783, 804, 172, -352, -385, -98,
+    146, 167, 47, -51, -60, -18, 14, 16, 4, -2, -2, 0,
+    -2, -3, 3, 14, 16, -12, -56, -58, 29, 155, 162, -55,
+    -357, -386, 79, 739, 848, -81, -1519, -1956, -10, 4182, 8623, 10691,
+    9079, 4809, 438, -1853, -1671, -266, 787, 801, 168, -353, -384, -96,
+    147, 166, 46, -52, -60, -18, 14, 16, 4, -2, -2, 0,
+    -2, -3, 3, 15, 16, -12, -56, -58, 30, 155, 162, -57,
+    -358, -385, 83, 742, 846, -89, -1527, -1952, 10, 4212, 8646, 10693,
+    9058, 4779, 416, -1859, -1664, -257, 790, 799, 164, -355, -383, -94,
+    147, 166, 45, -52, -60, -17, 14, 16, 4, -2, -2, 0,
+    -2, -3, 3, 15, 16, -12, -56, -57, 31, 156, 161, -58,
+    -360, -384, 87, 745, 843, -98, -1534, -1948, 31, 4242, 8669, 10694,
+    9038, 4750, 394, -1865, -1658, -248, 794, 796, 159, -357, -382, -92,
+    148, 165, 45, -52, -59, -17, 14, 16, 4, -2, -2, 0,
+    -2, -2, 3, 15, 16, -13, -56, -57, 32, 157, 160, -60,
+    -361, -382, 91, 748, 841, -106, -1542, -1944, 51, 4272, 8691, 10695,
+    9017, 4720, 372, -1871, -1651, -239, 797, 793, 155, -359, -381, -90,
+    149, 165, 44, -53, -59, -17, 14, 16, 4, -2, -2, 0,
+    -2, -2, 3, 15, 15, -13, -56, -57, 33, 157, 160, -62,
+    -362, -381, 96, 751, 838, -115, -1550, -1940, 72, 4301, 8714, 10696,
+    8996, 4690, 350, -1876, -1644, -230, 800, 790, 151, -360, -379, -88,
+    150, 164, 43, -53, -59, -16, 14, 15, 4, -2, -2, 0,
+    -2, -2, 3, 15, 15, -13, -57, -57, 33, 158, 159, -64,
+    -364, -379, 100, 754, 836, -124, -1557, -1935, 93, 4331, 8736, 10697,
+    8975, 4660, 328, -1882, -1637, -221, 803, 787, 146, -362, -378, -86,
+    151, 164, 42, -53, -59, -16, 14, 15, 4, -2, -2, 0,
+    -2, -2, 3, 15, 15, -13, -57, -56, 34, 158, 158, -66,
+    -365, -378, 104, 758, 833, -133, -1565, -1931, 114, 4361, 8758, 10698,
+    8953, 4630, 306, -1887, -1630, -212, 806, 784, 142, -364, -377, -84,
+    152, 163, 41, -54, -59, -16, 15, 15, 4, -2, -2, 0,
+    -2, -2, 4, 15, 15, -14, -57, -56, 35, 159, 158, -68,
+    -366, -376, 108, 761, 830, -141, -1572, -1927, 135, 4391, 8780, 10699,
+    8932, 4600, 284, -1892, -1623, -203, 810, 782, 138, -365, -376, -82,
+    152, 163, 41, -54, -59, -16, 15, 15, 4, -2, -2, 0,
+    -2, -2, 4, 15, 15, -14, -57, -56, 36, 160, 157, -70,
+    -368, -375, 112, 764, 827, -150, -1579, -1922, 156, 4421, 8802, 10699,
+    8911, 4570, 263, -1898, -1616, -194, 813, 779, 134, -367, -374, -80,
+    153, 162, 40, -54, -58, -15, 15, 15, 4, -2, -2, 0,
+    -2, -2, 4, 15, 15, -14, -58, -56, 37, 160, 156, -72,
+    -369, -373, 117, 767, 824, -159, -1587, -1917, 177, 4451, 8824, 10699,
+    8889, 4540, 241, -1903, -1608, -185, 816, 776, 129, -369, -373, -78,
+    154, 162, 39, -55, -58, -15, 15, 15, 4, -2, -2, 0,
+    -2, -2, 4, 15, 15, -15, -58, -55, 37, 161, 155, -74,
+    -371, -372, 121, 770, 822, -168, -1594, -1912, 198, 4481, 8846, 10699,
+    8868, 4510, 220, -1908, -1601, -176, 819, 773, 125, -370, -372, -76,
+    155, 161, 38, -55, -58, -15, 15, 15, 4, -2, -2, 0,
+};
+
+// L/M=320/147, 16 taps: 22050->48000
+const int16_t kBank320x147x16[5120] = {
+    -1, 21, -111, 360, -846, 1568, -2389, 3072, 29490, 2979, -2355, 1554,
+    -841, 359, -111, 21, -1, 21, -112, 361, -851, 1582, -2423, 3165,
+    29489, 2886, -2320, 1541, -837, 358, -111, 21, -1, 21, -112, 362,
+    -855, 1595, -2458, 3259, 29487, 2794, -2285, 1527, -832, 356, -111, 21,
+    -1, 21, -112, 363, -860, 1609, -2492, 3353, 29485, 2702, -2251, 1513,
+    -827, 355, -111, 21, -1, 21, -112, 364, -864, 1622, -2527, 3447,
+    29482, 2611, -2216, 1499, -823, 354, -111, 21, -1, 21, -112, 365,
+    -868, 1635, -2561, 3542, 29478, 2520, -2182, 1485, -818, 353, -111, 21,
+    -1, 21, -112, 366, -873, 1648, -2595, 3637, 29473, 2430, -2147, 1471,
+    -813, 352, -110, 21, -1, 21, -112, 367, -877, 1662, -2629, 3733,
+    29467, 2340, -2112, 1457, -808, 350, -110, 21, -1, 21, -112, 368,
+    -881, 1675, -2663, 3829, 29461, 2250, -2078, 1443, -803, 349, -110, 21,
+    -1, 21, -112, 369, -885, 1688, -2697, 3926, 29454, 2161, -2043, 1429,
+    -798, 348, -110, 21, -1, 21, -112, 370, -889, 1700, -2731, 4022,
+    29446, 2072, -2009, 1415, -793, 346, -110, 21, -1, 21, -112, 370,
+    -893, 1713, -2765, 4120, 29437, 1984, -1974, 1400, -788, 345, -109, 21,
+    -1, 20, -112, 371, -897, 1726, -2799, 4217, 29427, 1896, -1939, 1386,
+    -783, 343, -109, 21, -1, 20, -112, 372, -901, 1739, -2833, 4315,
+    29417, 1809, -1905, 1372, -777, 342, -109, 21, -1, 20, -112, 373,
+    -905, 1751, -2867, 4413, 29406, 1722, -1870, 1357, -772, 341, -109, 21,
+    -1, 20, -112, 373, -909, 1764, -2901, 4512, 29394, 1636, -1835, 1343,
+    -767, 339, -108, 21, -1, 20, -112, 374, -913, 1776, -2934, 4611,
+    29381, 1550, -1801, 1328, -762, 338, -108, 21, -1, 20, -112, 375,
+    -916, 1788, -2968, 4710, 29367, 1464, -1766, 1314, -756, 336, -108, 21,
+    -1, 20, -112, 375, -920, 1800, -3001, 4810, 29353, 1379, -1731, 1299,
+    -751, 335, -108, 21, -1, 20, -112, 376, -923, 1812, -3034, 4910,
+    29337, 1294, -1697, 1284, -746, 333, -107, 21, -1, 20, -112, 377,
+    -927, 1824, -3068, 5011, 29321, 1210, -1662, 1270, -740, 331, -107, 21,
+    -1, 20, -112, 377, -930, 1836, -3101, 5111, 29305, 1126, -1628, 1255,
+    -735, 330, -107, 21, -1, 20, -112, 378, -934, 1848, -3134, 5212,
+    29287, 1043, -1593, 1240, -729, 328, -106, 21, -1, 20, -111, 378,
+    -937, 1860, -3167, 5314, 29269, 960, -1559, 1225, -724, 327, -106, 21,
+    -1, 20, -111, 378, -940, 1871, -3200, 5415, 29249, 878, -1524, 1210,
+    -718, 325, -106, 20, -1, 20, -111, 379, -944, 1883, -3232, 5517,
+    29229, 796, -1490, 1196, -712, 323, -105, 20, -1, 19, -111, 379,
+    -947, 1894, -3265, 5620, 29209, 715, -1456, 1181, -707, 322, -105, 20,
+    -1, 19, -111, 380, -950, 1905, -3297, 5722, 29187, 634, -1421, 1166,
+    -701, 320, -105, 20, -1, 19, -111, 380, -953, 1917, -3330, 5825,
+    29165, 553, -1387, 1151, -695, 318, -104, 20, -1, 19, -110, 380,
+    -956, 1928, -3362, 5929, 29142, 473, -1353, 1136, -690, 316, -104, 20,
+    -1, 19, -110, 380, -958, 1939, -3394, 6032, 29118, 394, -1319, 1121,
+    -684, 315, -103, 20, -1, 19, -110, 381, -961, 1949, -3426, 6136,
+    29093, 315, -1284, 1106, -678, 313, -103, 20, -1, 19, -110, 381,
+    -964, 1960, -3458, 6240, 29068, 237, -1250, 1091, -672, 311, -103, 20,
+    -1, 19, -109, 381, -967, 1971, -3490, 6345, 29041, 159, -1216, 1076,
+    -666, 309, -102, 20, -1, 19, -109, 381, -969, 1981, -3522, 6449,
+    29014, 81, -1182, 1060, -660, 308, -102, 20, -1, 18, -109, 381,
+    -972, 1992, -3553, 6554, 28986, 4, -1148, 1045, -654, 306, -101, 20,
+    -1, 18, -109, 381, -974, 2002, -3585, 6660, 28958, -72, -1115, 1030,
+    -649, 304, -101, 20, -1, 18, -108, 381, -977, 2012, -3616, 6765,
+    28928, -148, -1081, 1015, -643, 302, -101, 20, -1, 18, -108, 381,
+    -979, 2022, -3647, 6871, 28898, -224, -1047, 1000, -637, 300, -100, 20,
+    -1, 18, -108, 381, -981, 2032, -3678, 6977, 28867, -299, -1014, 985,
+    -631, 298, -100, 20, -1, 18, -107, 381, -983, 2042, -3709, 7083,
+    28836, -373, -980, 969, -625, 296, -99, 20, -1, 18, -107, 381,
+    -985, 2051, -3739, 7190, 28803, -447, -947, 954, -619, 294, -99, 19,
+    -1, 18, -107, 381, -987, 2061, -3770, 7297, 28770, -520, -913, 939,
+    -612, 292, -98, 19, -1, 17, -106, 381, -989, 2070, -3800, 7404,
+    28736, -593, -880, 924, -606, 290, -98, 19, -1, 17, -106, 380,
+    -991, 2079, -3830, 7511, 28701, -666, -847, 909, -600, 288, -97, 19,
+    -1, 17, -106, 380, -993, 2089, -3860, 7619, 28666, -738, -813, 893,
+    -594, 286, -97, 19, -1, 17, -105, 380, -995, 2098, -3890, 7727,
+    28629, -809, -780, 878, -588, 284, -97, 19, -1, 17, -105, 379,
+    -996, 2106, -3919, 7835, 28592, -880, -747, 863, -582, 282, -96, 19,
+    -1, 17, -104, 379, -998, 2115, -3949, 7943, 28554, -950, -714, 848,
+    -576, 280, -96, 19, -1, 16, -104, 379, -999, 2124, -3978, 8052,
+    28516, -1020, -682, 832, -569, 278, -95, 19, -1, 16, -103, 378,
+    -1001, 2132, -4007, 8160, 28477, -1089, -649, 817, -563, 276, -95, 19,
+    -1, 16, -103, 378, -1002, 2140, -4036, 8269, 28437, -1158, -616, 802,
+    -557, 274, -94, 19, -1, 16, -102, 377, -1003, 2149, -4065, 8378,
+    28396, -1226, -584, 787, -551, 272, -94, 19, -1, 16, -102, 377,
+    -1004, 2157, -4093, 8488, 28354, -1294, -551, 771, -544, 270, -93, 19,
+    -1, 15, -101, 376, -1005, 2164, -4121, 8597, 28312, -1361, -519, 756,
+    -538, 268, -92, 18, 0, 15, -101, 375, -1006, 2172, -4149, 8707,
+    28269, -1428, -487, 741, -532, 266, -92, 18, 0, 15, -100, 375,
+    -1007, 2180, -4177, 8817, 28225, -1494, -455, 726, -526, 264, -91, 18,
+    0, 15, -100, 374, -1008, 2187, -4205, 8927, 28180, -1560, -423, 711,
+    -519, 262, -91, 18, 0, 15, -99, 373, -1009, 2194, -4232, 9037,
+    28135, -1625, -391, 695, -513, 260, -90, 18, 0, 14, -98, 373,
+    -1010, 2201, -4260, 9148, 28089, -1689, -359, 680, -507, 257, -90, 18,
+    0, 14, -98, 372, -1010, 2208, -4287, 9258, 28042, -1753, -328, 665,
+    -500, 255, -89, 18, 0, 14, -97, 371, -1011, 2215, -4313, 9369,
+    27995, -1816, -296, 650, -494, 253, -89, 18, 0, 14, -97, 370,
+    -1011, 2222, -4340, 9480, 27947, -1879, -265, 635, -488, 251, -88, 18,
+    0, 14, -96, 369, -1011, 2228, -4366, 9591, 27898, -1942, -234, 620,
+    -481, 249, -88, 18, 0, 13, -95, 368, -1012, 2235, -4393, 9702,
+    27848, -2003, -202, 605, -475, 247, -87, 17, 0, 13, -95, 367,
+    -1012, 2241, -4418, 9814, 27798, -2065, -171, 589, -468, 244, -86, 17,
+    0, 13, -94, 366, -1012, 2247, -4444, 9925, 27747, -2125, -141, 574,
+    -462, 242, -86, 17, 0, 13, -93, 365, -1012, 2253, -4469, 10037,
+    27695, -2186, -110, 559, -456, 240, -85, 17, 0, 12, -93, 364,
+    -1012, 2259, -4495, 10149, 27643, -2245, -79, 544, -449, 238, -85, 17,
+    0, 12, -92, 363, -1012, 2264, -4520, 10261, 27589, -2304, -49, 529,
+    -443, 235, -84, 17, 0, 12, -91, 362, -1011, 2270, -4544, 10373,
+    27536, -2363, -18, 514, -436, 233, -84, 17, 0, 12, -90, 360,
+    -1011, 2275, -4569, 10485, 27481, -2421, 12, 499, -430, 231, -83, 17,
+    0, 11, -90, 359, -1011, 2280, -4593, 10597, 27426, -2478, 42, 485,
+    -424, 229, -82, 17, 0, 11, -89, 358, -1010, 2285, -4617, 10710,
+    27370, -2535, 72, 470, -417, 226, -82, 16, 0, 11, -88, 356,
+    -1009, 2289, -4640, 10822, 27313, -2591, 101, 455, -411, 224, -81, 16,
+    0, 11, -87, 355, -1009, 2294, -4664, 10935, 27255, -2647, 131, 440,
+    -404, 222, -81, 16, 0, 10, -86, 353, -1008, 2298, -4687, 11048,
+    27197, -2702, 161, 425, -398, 220, -80, 16, 0, 10, -85, 352,
+    -1007, 2303, -4710, 11160, 27139, -2757, 190, 411, -391, 217, -79, 16,
+    0, 10, -85, 350, -1006, 2307, -4732, 11273, 27079, -2811, 219, 396,
+    -385, 215, -79, 16, 0, 9, -84, 349, -1005, 2311, -4754, 11386,
+    27019, -2865, 248, 381, -379, 213, -78, 16, 0, 9, -83, 347,
+    -1004, 2314, -4776, 11499, 26958, -2918, 277, 366, -372, 210, -77, 16,
+    0, 9, -82, 346, -1002, 2318, -4798, 11612, 26897, -2970, 306, 352,
+    -366, 208, -77, 16, 0, 9, -81, 344, -1001, 2321, -4819, 11726,
+    26835, -3022, 334, 337, -359, 206, -76, 15, 1, 8, -80, 342,
+    -1000, 2324, -4841, 11839, 26772, -3074, 363, 323, -353, 204, -76, 15,
+    1, 8, -79, 341, -998, 2327, -4861, 11952, 26708, -3124, 391, 308,
+    -346, 201, -75, 15, 1, 8, -78, 339, -996, 2330, -4882, 12066,
+    26644, -3175, 419, 294, -340, 199, -74, 15, 1, 7, -77, 337,
+    -995, 2333, -4902, 12179, 26579, -3224, 447, 280, -334, 197, -74, 15,
+    1, 7, -76, 335, -993, 2335, -4922, 12292, 26514, -3273, 475, 265,
+    -327, 194, -73, 15, 1, 7, -75, 333, -991, 2337, -4942, 12406,
+    26448, -3322, 502, 251, -321, 192, -72, 15, 1, 6, -74, 331,
+    -989, 2339, -4961, 12519, 26381, -3370, 530, 237, -315, 190, -72, 15,
+    1, 6, -73, 329, -987, 2341, -4980, 12633, 26314, -3417, 557, 222,
+    -308, 187, -71, 15, 1, 6, -72, 327, -985, 2343, -4999, 12746,
+    26246, -3464, 584, 208, -302, 185, -71, 14, 1, 5, -71, 325,
+    -982, 2344, -5017, 12860, 26177, -3510, 611, 194, -295, 183, -70, 14,
+    1, 5, -70, 323, -980, 2346, -5035, 12973, 26108, -3556, 637, 180,
+    -289, 180, -69, 14, 1, 5, -69, 321, -978, 2347, -5053, 13087,
+    26038, -3601, 664, 166, -283, 178, -69, 14, 1, 4, -68, 318,
+    -975, 2348, -5070, 13201, 25967, -3646, 690, 152, -276, 176, -68, 14,
+    1, 4, -67, 316, -972, 2348, -5087, 13314, 25896, -3690, 717, 138,
+    -270, 173, -67, 14, 1, 4, -65, 314, -970, 2349, -5104, 13428,
+    25824, -3734, 743, 124, -264, 171, -67, 14, 1, 3, -64, 312,
+    -967, 2349, -5121, 13541, 25752, -3777, 768, 111, -257, 169, -66, 14,
+    1, 3, -63, 309, -964, 2349, -5137, 13655, 25679, -3819, 794, 97,
+    -251, 166, -65, 13, 1, 2, -62, 307, -961, 2349, -5152, 13768,
+    25605, -3861, 819, 83, -245, 164, -65, 13, 1, 2, -61, 304,
+    -957, 2349, -5168, 13882, 25531, -3902, 845, 69, -239, 162, -64, 13,
+    2, 2, -59, 302, -954, 2349, -5183, 13995, 25456, -3943, 870, 56,
+    -232, 159, -63, 13, 2, 1, -58, 299, -951, 2348, -5197, 14108,
+    25381, -3983, 895, 42, -226, 157, -63, 13, 2, 1, -57, 297,
+    -947, 2347, -5212, 14222, 25305, -4023, 919, 29, -220, 155, -62, 13,
+    2, 0, -56, 294, -944, 2346, -5226, 14335, 25228, -4062, 944, 16,
+    -214, 152, -61, 13, 2, 0, -55, 291, -940, 2345, -5239, 14448,
+    25151, -4100, 968, 2, -208, 150, -61, 13, 2, 0, -53, 289,
+    -936, 2343, -5252, 14561, 25073, -4138, 992, -11, -201, 148, -60, 12,
+    2, -1, -52, 286, -933, 2342, -5265, 14674, 24995, -4176, 1016, -24,
+    -195, 146, -59, 12, 2, -1, -51, 283, -929, 2340, -5278, 14788,
+    24916, -4212, 1040, -37, -189, 143, -59, 12, 2, -2, -49, 280,
+    -925, 2338, -5290, 14900, 24836, -4249, 1064, -50, -183, 141, -58, 12,
+    2, -2, -48, 277, -921, 2336, -5302, 15013, 24756, -4284, 1087, -63,
+    -177, 139, -57, 12, 2, -2, -47, 275, -916, 2333, -5313, 15126,
+    24675, -4320, 1110, -76, -171, 136, -57, 12, 2, -3, -45, 272,
+    -912, 2331, -5324, 15239, 24594, -4354, 1133, -89, -165, 134, -56, 12,
+    2, -3, -44, 269, -907, 2328, -5335, 15351, 24512, -4388, 1156, -102,
+    -159, 132, -55, 12, 2, -4, -42, 266, -903, 2325, -5345, 15464,
+    24430, -4422, 1179, -115, -153, 129, -55, 11, 2, -4, -41, 262,
+    -898, 2321, -5355, 15576, 24347, -4455, 1201, -127, -147, 127, -54, 11,
+    3, -5, -40, 259, -894, 2318, -5364, 15688, 24264, -4487, 1223, -140,
+    -141, 125, -54, 11, 3, -5, -38, 256, -889, 2314, -5373, 15800,
+    24180, -4519, 1245, -153, -135, 122, -53, 11, 3, -5, -37, 253,
+    -884, 2310, -5382, 15912, 24096, -4550, 1267, -165, -129, 120, -52, 11,
+    3, -6, -35, 250, -879, 2306, -5390, 16024, 24011, -4581, 1288, -177,
+    -123, 118, -52, 11, 3, -6, -34, 246, -874, 2302, -5398, 16136,
+    23925, -4611, 1310, -190, -117, 116, -51, 11, 3, -7, -32, 243,
+    -868, 2297, -5405, 16248, 23839, -4641, 1331, -202, -111, 113, -50, 11,
+    3, -7, -31, 240, -863, 2292, -5412, 16359, 23753, -4670, 1352, -214,
+    -105, 111, -50, 11, 3, -8, -29, 236, -858, 2287, -5419, 16470,
+    23666, -4699, 1373, -226, -99, 109, -49, 10, 3, -8, -28, 233,
+    -852, 2282, -5425, 16582, 23578, -4727, 1393, -238, -93, 107, -48, 10,
+    3, -9, -26, 229, -846, 2277, -5431, 16692, 23490, -4754, 1413, -250,
+    -88, 104, -48, 10, 3, -9, -25, 226, -841, 2271, -5436, 16803,
+    23401, -4781, 1433, -262, -82, 102, -47, 10, 3, -10, -23, 222,
+    -835, 2265, -5441, 16914, 23312, -4807, 1453, -274, -76, 100, -46, 10,
+    3, -10, -21, 219, -829, 2259, -5446, 17024, 23223, -4833, 1473, -285,
+    -70, 98, -46, 10, 4, -11, -20, 215, -823, 2253, -5450, 17135,
+    23133, -4858, 1493, -297, -65, 95, -45, 10, 4, -11, -18, 211,
+    -817, 2246, -5454, 17245, 23042, -4883, 1512, -308, -59, 93, -44, 10,
+    4, -12, -17, 208, -811, 2240, -5457, 17355, 22951, -4907, 1531, -320,
+    -53, 91, -44, 9, 4, -12, -15, 204, -804, 2233, -5460, 17464,
+    22860, -4931, 1550, -331, -48, 89, -43, 9, 4, -13, -13, 200,
+    -798, 2226, -5462, 17574, 22768, -4954, 1568, -342, -42, 87, -42, 9,
+    4, -13, -12, 196, -791, 2218, -5464, 17683, 22675, -4977, 1587, -354,
+    -37, 84, -42, 9, 4, -14, -10, 192, -785, 2211, -5466, 17792,
+    22583, -4999, 1605, -365, -31, 82, -41, 9, 4, -14, -8, 188,
+    -778, 2203, -5467, 17901, 22489, -5021, 1623, -376, -26, 80, -41, 9,
+    4, -15, -6, 184, -771, 2195, -5467, 18010, 22396, -5042, 1641, -387,
+    -20, 78, -40, 9, 4, -15, -5, 180, -764, 2187, -5467, 18118,
+    22301, -5062, 1658, -398, -15, 76, -39, 9, 4, -16, -3, 176,
+    -757, 2178, -5467, 18226, 22207, -5082, 1675, -408, -9, 73, -39, 8,
+    5, -16, -1, 172, -750, 2170, -5466, 18334, 22112, -5102, 1693, -419,
+    -4, 71, -38, 8, 5, -17, 0, 168, -743, 2161, -5465, 18442,
+    22016, -5121, 1709, -430, 1, 69, -37, 8, 5, -17, 2, 164,
+    -735, 2152, -5464, 18549, 21920, -5139, 1726, -440, 7, 67, -37, 8,
+    5, -18, 4, 160, -728, 2142, -5461, 18656, 21824, -5157, 1742, -451,
+    12, 65, -36, 8, 5, -18, 6, 156, -721, 2133, -5459, 18763,
+    21727, -5174, 1759, -461, 17, 63, -36, 8, 5, -19, 8, 151,
+    -713, 2123, -5456, 18870, 21630, -5191, 1775, -471, 23, 61, -35, 8,
+    5, -20, 9, 147, -705, 2113, -5452, 18976, 21533, -5207, 1790, -481,
+    28, 59, -34, 8, 5, -20, 11, 143, -697, 2103, -5448, 19082,
+    21435, -5223, 1806, -491, 33, 57, -34, 8, 5, -21, 13, 138,
+    -689, 2092, -5444, 19188, 21336, -5238, 1821, -501, 38, 54, -33, 7,
+    5, -21, 15, 134, -681, 2082, -5439, 19294, 21238, -5253, 1837, -511,
+    43, 52, -32, 7, 5, -22, 17, 130, -673, 2071, -5434, 19399,
+    21138, -5267, 1851, -521, 48, 50, -32, 7, 6, -22, 19, 125,
+    -665, 2060, -5428, 19504, 21039, -5281, 1866, -531, 53, 48, -31, 7,
+    6, -23, 21, 120, -657, 2048, -5421, 19608, 20939, -5294, 1881, -540,
+    58, 46, -31, 7, 6, -24, 23, 116, -648, 2037, -5415, 19713,
+    20839, -5307, 1895, -550, 63, 44, -30, 7, 6, -24, 24, 111,
+    -640, 2025, -5407, 19817, 20738, -5319, 1909, -559, 68, 42, -29, 7,
+    6, -25, 26, 107, -631, 2013, -5400, 19921, 20637, -5331, 1923, -569,
+    73, 40, -29, 7, 6, -25, 28, 102, -623, 2001, -5391, 20024,
+    20536, -5342, 1936, -578, 78, 38, -28, 7, 6, -26, 30, 97,
+    -614, 1988, -5382, 20127, 20434, -5353, 1949, -587, 83, 36, -28, 6,
+    6, -26, 32, 93, -605, 1976, -5373, 20230, 20332, -5363, 1963, -596,
+    88, 34, -27, 6, 6, -27, 34, 88, -596, 1963, -5363, 20332,
+    20230, -5373, 1976, -605, 93, 32, -26, 6, 6, -28, 36, 83,
+    -587, 1949, -5353, 20434, 20127, -5382, 1988, -614, 97, 30, -26, 6,
+    7, -28, 38, 78, -578, 1936, -5342, 20536, 20024, -5391, 2001, -623,
+    102, 28, -25, 6, 7, -29, 40, 73, -569, 1923, -5331, 20637,
+    19921, -5400, 2013, -631, 107, 26, -25, 6, 7, -29, 42, 68,
+    -559, 1909, -5319, 20738, 19817, -5407, 2025, -640, 111, 24, -24, 6,
+    7, -30, 44, 63, -550, 1895, -5307, 20839, 19713, -5415, 2037, -648,
+    116, 23, -24, 6, 7, -31, 46, 58, -540, 1881, -5294, 20939,
+    19608, -5421, 2048, -657, 120, 21, -23, 6, 7, -31, 48, 53,
+    -531, 1866, -5281, 21039, 19504, -5428, 2060, -665, 125, 19, -22, 6,
+    7, -32, 50, 48, -521, 1851, -5267, 21138, 19399, -5434, 2071, -673,
+    130, 17, -22, 5, 7, -32, 52, 43, -511, 1837, -5253, 21238,
+    19294, -5439, 2082, -681, 134, 15, -21, 5, 7, -33, 54, 38,
+    -501, 1821, -5238, 21336, 19188, -5444, 2092, -689, 138, 13, -21, 5,
+    8, -34, 57, 33, -491, 1806, -5223, 21435, 19082, -5448, 2103, -697,
+    143, 11, -20, 5, 8, -34, 59, 28, -481, 1790, -5207, 21533,
+    18976, -5452, 2113, -705, 147, 9, -20, 5, 8, -35, 61, 23,
+    -471, 1775, -5191, 21630, 18870, -5456, 2123, -713, 151, 8, -19, 5,
+    8, -36, 63, 17, -461, 1759, -5174, 21727, 18763, -5459, 2133, -721,
+    156, 6, -18, 5, 8, -36, 65, 12, -451, 1742, -5157, 21824,
+    18656, -5461, 2142, -728, 160, 4, -18, 5, 8, -37, 67, 7,
+    -440, 1726, -5139, 21920, 18549, -5464, 2152, -735, 164, 2, -17, 5,
+    8, -37, 69, 1, -430, 1709, -5121, 22016, 18442, -5465, 2161, -743,
+    168, 0, -17, 5, 8, -38, 71, -4, -419, 1693, -5102, 22112,
+    18334, -5466, 2170, -750, 172, -1, -16, 5, 8, -39, 73, -9,
+    -408, 1675, -5082, 22207, 18226, -5467, 2178, -757, 176, -3, -16, 4,
+    9, -39, 76, -15, -398, 1658, -5062, 22301, 18118, -5467, 2187, -764,
+    180, -5, -15, 4, 9, -40, 78, -20, -387, 1641, -5042, 22396,
+    18010, -5467, 2195, -771, 184, -6, -15, 4, 9, -41, 80, -26,
+    -376, 1623, -5021, 22489, 17901, -5467, 2203, -778, 188, -8, -14, 4,
+    9, -41, 82, -31, -365, 1605, -4999, 22583, 17792, -5466, 2211, -785,
+    192, -10, -14, 4, 9, -42, 84, -37, -354, 1587, -4977, 22675,
+    17683, -5464, 2218, -791, 196, -12, -13, 4, 9, -42, 87, -42,
+    -342, 1568, -4954, 22768, 17574, -5462, 2226, -798, 200, -13, -13, 4,
+    9, -43, 89, -48, -331, 1550, -4931, 22860, 17464, -5460, 2233, -804,
+    204, -15, -12, 4, 9, -44, 91, -53, -320, 1531, -4907, 22951,
+    17355, -5457, 2240, -811, 208, -17, -12, 4, 10, -44, 93, -59,
+    -308, 1512, -4883, 23042, 17245, -5454, 2246, -817, 211, -18, -11, 4,
+    10, -45, 95, -65, -297, 1493, -4858, 23133, 17135, -5450, 2253, -823,
+    215, -20, -11, 4, 10, -46, 98, -70, -285, 1473, -4833, 23223,
+    17024, -5446, 2259, -829, 219, -21, -10, 3, 10, -46, 100, -76,
+    -274, 1453, -4807, 23312, 16914, -5441, 2265, -835, 222, -23, -10, 3,
+    10, -47, 102, -82, -262, 1433, -4781, 23401, 16803, -5436, 2271, -841,
+    226, -25, -9, 3, 10, -48, 104, -88, -250, 1413, -4754, 23490,
+    16692, -5431, 2277, -846, 229, -26, -9, 3, 10, -48, 107, -93,
+    -238, 1393, -4727, 23578, 16582, -5425, 2282, -852, 233, -28, -8, 3,
+    10, -49, 109, -99, -226, 1373, -4699, 23666, 16470, -5419, 2287, -858,
+    236, -29, -8, 3, 11, -50, 111, -105, -214, 1352, -4670, 23753,
+    16359, -5412, 2292, -863, 240, -31, -7, 3, 11, -50, 113, -111,
+    -202, 1331, -4641, 23839, 16248, -5405, 2297, -868, 243, -32, -7, 3,
+    11, -51, 116, -117, -190, 1310, -4611, 23925, 16136, -5398, 2302, -874,
+    246, -34, -6, 3, 11, -52, 118, -123, -177, 1288, -4581, 24011,
+    16024, -5390, 2306, -879, 250, -35, -6, 3, 11, -52, 120, -129,
+    -165, 1267, -4550, 24096, 15912, -5382, 2310, -884, 253, -37, -5, 3,
+    11, -53, 122, -135, -153, 1245, -4519, 24180, 15800, -5373, 2314, -889,
+    256, -38, -5, 3, 11, -54, 125, -141, -140, 1223, -4487, 24264,
+    15688, -5364, 2318, -894, 259, -40, -5, 3, 11, -54, 127, -147,
+    -127, 1201, -4455, 24347, 15576, -5355, 2321, -898, 262, -41, -4, 2,
+    11, -55, 129, -153, -115, 1179, -4422, 24430, 15464, -5345, 2325, -903,
+    266, -42, -4, 2, 12, -55, 132, -159, -102, 1156, -4388, 24512,
+    15351, -5335, 2328, -907, 269, -44, -3, 2, 12, -56, 134, -165,
+    -89, 1133, -4354, 24594, 15239, -5324, 2331, -912, 272, -45, -3, 2,
+    12, -57, 136, -171, -76, 1110, -4320, 24675, 15126, -5313, 2333, -916,
+    275, -47, -2, 2, 12, -57, 139, -177, -63, 1087, -4284, 24756,
+    15013, -5302, 2336, -921, 277, -48, -2, 2, 12, -58, 141, -183,
+    -50, 1064, -4249, 24836, 14900, -5290, 2338, -925, 280, -49, -2, 2,
+    12, -59, 143, -189, -37, 1040, -4212, 24916, 14788, -5278, 2340, -929,
+    283, -51, -1, 2, 12, -59, 146, -195, -24, 1016, -4176, 24995,
+    14674, -5265, 2342, -933, 286, -52, -1, 2, 12, -60, 148, -201,
+    -11, 992, -4138, 25073, 14561, -5252, 2343, -936, 289, -53, 0, 2,
+    13, -61, 150, -208, 2, 968, -4100, 25151, 14448, -5239, 2345, -940,
+    291, -55, 0, 2, 13, -61, 152, -214, 16, 944, -4062, 25228,
+    14335, -5226, 2346, -944, 294, -56, 0, 2, 13, -62, 155, -220,
+    29, 919, -4023, 25305, 14222, -5212, 2347, -947, 297, -57, 1, 2,
+    13, -63, 157, -226, 42, 895, -3983, 25381, 14108, -5197, 2348, -951,
+    299, -58, 1, 2, 13, -63, 159, -232, 56, 870, -3943, 25456,
+    13995, -5183, 2349, -954, 302, -59, 2, 2, 13, -64, 162, -239,
+    69, 845, -3902, 25531, 13882, -5168, 2349, -957, 304, -61, 2, 1,
+    13, -65, 164, -245, 83, 819, -3861, 25605, 13768, -5152, 2349, -961,
+    307, -62, 2, 1, 13, -65, 166, -251, 97, 794, -3819, 25679,
+    13655, -5137, 2349, -964, 309, -63, 3, 1, 14, -66, 169, -257,
+    111, 768, -3777, 25752, 13541, -5121, 2349, -967, 312, -64, 3, 1,
+    14, -67, 171, -264, 124, 743, -3734, 25824, 13428, -5104, 2349, -970,
+    314, -65, 4, 1, 14, -67, 173, -270, 138, 717, -3690, 25896,
+    13314, -5087, 2348, -972, 316, -67, 4, 1, 14, -68, 176, -276,
+    152, 690, -3646, 25967, 13201, -5070, 2348, -975, 318, -68, 4, 1,
+    14, -69, 178, -283, 166, 664, -3601, 26038, 13087, -5053, 2347, -978,
+    321, -69, 5, 1, 14, -69, 180, -289, 180, 637, -3556, 26108,
+    12973, -5035, 2346, -980, 323, -70, 5, 1, 14, -70, 183, -295,
+    194, 611, -3510, 26177, 12860, -5017, 2344, -982, 325, -71, 5, 1,
+    14, -71, 185, -302, 208, 584, -3464, 26246, 12746, -4999, 2343, -985,
+    327, -72, 6, 1, 15, -71, 187, -308, 222, 557, -3417, 26314,
+    12633, -4980, 2341, -987, 329, -73, 6, 1, 15, -72, 190, -315,
+    237, 530, -3370, 26381, 12519, -4961, 2339, -989, 331, -74, 6, 1,
+    15, -72, 192, -321, 251, 502, -3322, 26448, 12406, -4942, 2337, -991,
+    333, -75, 7, 1, 15, -73, 194, -327, 265, 475, -3273, 26514,
+    12292, -4922, 2335, -993, 335, -76, 7, 1, 15, -74, 197, -334,
+    280, 447, -3224, 26579, 12179, -4902, 2333, -995, 337, -77, 7, 1,
+    15, -74, 199, -340, 294, 419, -3175, 26644, 12066, -4882, 2330, -996,
+    339, -78, 8, 1, 15, -75, 201, -346, 308, 391, -3124, 26708,
+    11952, -4861, 2327, -998, 341, -79, 8, 1, 15, -76, 204, -353,
+    323, 363, -3074, 26772, 11839, -4841, 2324, -1000, 342, -80, 8, 1,
+    15, -76, 206, -359, 337, 334, -3022, 26835, 11726, -4819, 2321, -1001,
+    344, -81, 9, 0, 16, -77, 208, -366, 352, 306, -2970, 26897,
+    11612, -4798, 2318, -1002, 346, -82, 9, 0, 16, -77, 210, -372,
+    366, 277, -2918, 26958, 11499, -4776, 2314, -1004, 347, -83, 9, 0,
+    16, -78, 213, -379, 381, 248, -2865, 27019, 11386, -4754, 2311, -1005,
+    349, -84, 9, 0, 16, -79, 215, -385, 396, 219, -2811, 27079,
+    11273, -4732, 2307, -1006, 350, -85, 10, 0, 16, -79, 217, -391,
+    411, 190, -2757, 27139, 11160, -4710, 2303, -1007, 352, -85, 10, 0,
+    16, -80, 220, -398, 425, 161, -2702, 27197, 11048, -4687, 2298, -1008,
+    353, -86, 10, 0, 16, -81, 222, -404, 440, 131, -2647, 27255,
+    10935, -4664, 2294, -1009, 355, -87, 11, 0, 16, -81, 224, -411,
+    455, 101, -2591, 27313, 10822, -4640, 2289, -1009, 356, -88, 11, 0,
+    16, -82, 226, -417, 470, 72, -2535, 27370, 10710, -4617, 2285, -1010,
+    358, -89, 11, 0, 17, -82, 229, -424, 485, 42, -2478, 27426,
+    10597, -4593, 2280, -1011, 359, -90, 11, 0, 17, -83, 231, -430,
+    499, 12, -2421, 27481, 10485, -4569, 2275, -1011, 360, -90, 12, 0,
+    17, -84, 233, -436, 514, -18, -2363, 27536, 10373, -4544, 2270, -1011,
+    362, -91, 12, 0, 17, -84, 235, -443, 529, -49, -2304, 27589,
+    10261, -4520, 2264, -1012, 363, -92, 12, 0, 17, -85, 238, -449,
+    544, -79, -2245, 27643, 10149, -4495, 2259, -1012, 364, -93, 12, 0,
+    17, -85, 240, -456, 559, -110, -2186, 27695, 10037, -4469, 2253, -1012,
+    365, -93, 13, 0, 17, -86, 242, -462, 574, -141, -2125, 27747,
+    9925, -4444, 2247, -1012, 366, -94, 13, 0, 17, -86, 244, -468,
+    589, -171, -2065, 27798, 9814, -4418, 2241, -1012, 367, -95, 13, 0,
+    17, -87, 247, -475, 605, -202, -2003, 27848, 9702, -4393, 2235, -1012,
+    368, -95, 13, 0, 18, -88, 249, -481, 620, -234, -1942, 27898,
+    9591, -4366, 2228, -1011, 369, -96, 14, 0, 18, -88, 251, -488,
+    635, -265, -1879, 27947, 9480, -4340, 2222, -1011, 370, -97, 14, 0,
+    18, -89, 253, -494, 650, -296, -1816, 27995, 9369, -4313, 2215, -1011,
+    371, -97, 14, 0, 18, -89, 255, -500, 665, -328, -1753, 28042,
+    9258, -4287, 2208, -1010, 372, -98, 14, 0, 18, -90, 257, -507,
+    680, -359, -1689, 28089, 9148, -4260, 2201, -1010, 373, -98, 14, 0,
+    18, -90, 260, -513, 695, -391, -1625, 28135, 9037, -4232, 2194, -1009,
+    373, -99, 15, 0, 18, -91, 262, -519, 711, -423, -1560, 28180,
+    8927, -4205, 2187, -1008, 374, -100, 15, 0, 18, -91, 264, -526,
+    726, -455, -1494, 28225, 8817, -4177, 2180, -1007, 375, -100, 15, 0,
+    18, -92, 266, -532, 741, -487, -1428, 28269, 8707, -4149, 2172, -1006,
+    375, -101, 15, 0, 18, -92, 268, -538, 756, -519, -1361, 28312,
+    8597, -4121, 2164, -1005, 376, -101, 15, -1, 19, -93, 270, -544,
+    771, -551, -1294, 28354, 8488, -4093, 2157, -1004, 377, -102, 16, -1,
+    19, -94, 272, -551, 787, -584, -1226, 28396, 8378, -4065, 2149, -1003,
+    377, -102, 16, -1, 19, -94, 274, -557, 802, -616, -1158, 28437,
+    8269, -4036, 2140, -1002, 378, -103, 16, -1, 19, -95, 276, -563,
+    817, -649, -1089, 28477, 8160, -4007, 2132, -1001, 378, -103, 16, -1,
+    19, -95, 278, -569, 832, -682, -1020, 28516, 8052, -3978, 2124, -999,
+    379, -104, 16, -1, 19, -96, 280, -576, 848, -714, -950, 28554,
+    7943, -3949, 2115, -998, 379, -104, 17, -1, 19, -96, 282, -582,
+    863, -747, -880, 28592, 7835, -3919, 2106, -996, 379, -105, 17, -1,
+    19, -97, 284, -588, 878, -780, -809, 28629, 7727, -3890, 2098, -995,
+    380, -105, 17, -1, 19, -97, 286, -594, 893, -813, -738, 28666,
+    7619, -3860, 2089, -993, 380, -106, 17, -1, 19, -97, 288, -600,
+    909, -847, -666, 28701, 7511, -3830, 2079, -991, 380, -106, 17, -1,
+    19, -98, 290, -606, 924, -880, -593, 28736, 7404, -3800, 2070, -989,
+    381, -106, 17, -1, 19, -98, 292, -612, 939, -913, -520, 28770,
+    7297, -3770, 2061, -987, 381, -107, 18, -1, 19, -99, 294, -619,
+    954, -947, -447, 28803, 7190, -3739, 2051, -985, 381, -107, 18, -1,
+    20, -99, 296, -625, 969, -980, -373, 28836, 7083, -3709, 2042, -983,
+    381, -107, 18, -1, 20, -100, 298, -631, 985, -1014, -299, 28867,
+    6977, -3678, 2032, -981, 381, -108, 18, -1, 20, -100, 300, -637,
+    1000, -1047, -224, 28898, 6871, -3647, 2022, -979, 381, -108, 18, -1,
+    20, -101, 302, -643, 1015, -1081, -148, 28928, 6765, -3616, 2012, -977,
+    381, -108, 18, -1, 20, -101, 304, -649, 1030, -1115, -72, 28958,
+    6660, -3585, 2002, -974, 381, -109, 18, -1, 20, -101, 306, -654,
+    1045, -1148, 4, 28986, 6554, -3553, 1992, -972, 381, -109, 18, -1,
+    20, -102, 308, -660, 1060, -1182, 81, 29014, 6449, -3522, 1981, -969,
+    381, -109, 19, -1, 20, -102, 309, -666, 1076, -1216, 159, 29041,
+    6345, -3490, 1971, -967, 381, -109, 19, -1, 20, -103, 311, -672,
+    1091, -1250, 237, 29068, 6240, -3458, 1960, -964, 381, -110, 19, -1,
+    20, -103, 313, -678, 1106, -1284, 315, 29093, 6136, -3426, 1949, -961,
+    381, -110, 19, -1, 20, -103, 315, -684, 1121, -1319, 394, 29118,
+    6032, -3394, 1939, -958, 380, -110, 19, -1, 20, -104, 316, -690,
+    1136, -1353, 473, 29142, 5929, -3362, 1928, -956, 380, -110, 19, -1,
+    20, -104, 318, -695, 1151, -1387, 553, 29165, 5825, -3330, 1917, -953,
+    380, -111, 19, -1, 20, -105, 320, -701, 1166, -1421, 634, 29187,
+    5722, -3297, 1905, -950, 380, -111, 19, -1, 20, -105, 322, -707,
+    1181, -1456, 715, 29209, 5620, -3265, 1894, -947, 379, -111, 19, -1,
+    20, -105, 323, -712, 1196, -1490, 796, 29229, 5517, -3232, 1883, -944,
+    379, -111, 20, -1, 20, -106, 325, -718, 1210, -1524, 878, 29249,
+    5415, -3200, 1871, -940, 378, -111, 20, -1, 21, -106, 327, -724,
+    1225, -1559, 960, 29269, 5314, -3167, 1860, -937, 378, -111, 20, -1,
+    21, -106, 328, -729, 1240, -1593, 1043, 29287, 5212, -3134, 1848, -934,
+    378, -112, 20, -1, 21, -107, 330, -735, 1255, -1628, 1126, 29305,
+    5111, -3101, 1836, -930, 377, -112, 20, -1, 21, -107, 331, -740,
+    1270, -1662, 1210, 29321, 5011, -3068, 1824, -927, 377, -112, 20, -1,
+    21, -107, 333, -746, 1284, -1697, 1294, 29337, 4910, -3034, 1812, -923,
+    376, -112, 20, -1, 21, -108, 335, -751, 1299, -1731, 1379, 29353,
+    4810, -3001, 1800, -920, 375, -112, 20, -1, 21, -108, 336, -756,
+    1314, -1766, 1464, 29367, 4710, -2968, 1788, -916, 375, -112, 20, -1,
+    21, -108, 338, -762, 1328, -1801, 1550, 29381, 4611, -2934, 1776, -913,
+    374, -112, 20, -1, 21, -108, 339, -767, 1343, -1835, 1636, 29394,
+    4512, -2901, 1764, -909, 373, -112, 20, -1, 21, -109, 341, -772,
+    1357, -1870, 1722, 29406, 4413, -2867, 1751, -905, 373, -112, 20, -1,
+    21, -109, 342, -777, 1372, -1905, 1809, 29417, 4315, -2833, 1739, -901,
+    372, -112, 20, -1, 21, -109, 343, -783, 1386, -1939, 1896, 29427,
+    4217, -2799, 1726, -897, 371, -112, 20, -1, 21, -109, 345, -788,
+    1400, -1974, 1984, 29437, 4120, -2765, 1713, -893, 370, -112, 21, -1,
+    21, -110, 346, -793, 1415, -2009, 2072, 29446, 4022, -2731, 1700, -889,
+    370, -112, 21, -1, 21, -110, 348, -798, 1429, -2043, 2161, 29454,
+    3926, -2697, 1688, -885, 369, -112, 21, -1, 21, -110, 349, -803,
+    1443, -2078, 2250, 29461, 3829, -2663, 1675, -881, 368, -112, 21, -1,
+    21, -110, 350, -808, 1457, -2112, 2340, 29467, 3733, -2629, 1662, -877,
+    367, -112, 21, -1, 21, -110, 352, -813, 1471, -2147, 2430, 29473,
+    3637, -2595, 1648, -873, 366, -112, 21, -1, 21, -111, 353, -818,
+    1485, -2182, 2520, 29478, 3542, -2561, 1635, -868, 365, -112, 21, -1,
+    21, -111, 354, -823, 1499, -2216, 2611, 29482, 3447, -2527, 1622, -864,
+    364, -112, 21, -1, 21, -111, 355, -827, 1513, -2251, 2702, 29485,
+    3353, -2492, 1609, -860, 363, -112, 21, -1, 21, -111, 356, -832,
+    1527, -2285, 2794, 29487, 3259, -2458, 1595, -855, 362, -112, 21, -1,
+    21, -111, 358, -837, 1541, -2320, 2886, 29489, 3165, -2423, 1582, -851,
+    361, -112, 21, -1, 21, -111, 359, -841, 1554, -2355, 2979, 29490,
+    3072, -2389, 1568, -846, 360, -111, 21, -1,
+};
+
+// L/M=320/441, 24 taps: 22050->16000
+const int16_t kBank320x441x24[7680] = {
+    -1, -5, 30, -30, -110, 322, -152, -740, 1545, -353, -3815, 9021,
+    21399, 8961, -3825, -335, 1539, -744, -148, 321, -110, -29, 30, -5,
+    -1, -5, 30, -30, -109, 323, -156, -737, 1551, -371, -3805, 9080,
+    21398, 8901, -3834, -318, 1533, -747, -144, 320, -111, -29, 30, -5,
+    -1, -5, 31, -31, -109, 324, -160, -734, 1557, -388, -3795, 9140,
+    21398, 8841, -3844, -300, 1527, -750, -140, 319, -112, -28, 30, -5,
+    -1, -5, 31, -31, -108, 326, -164, -731, 1563, -406, -3785, 9200,
+    21397, 8782, -3853, -282, 1521, -753, -136, 318, -112, -27, 30, -5,
+    -1, -5, 31, -32, -107, 327, -168, -727, 1569, -424, -3774, 9260,
+    21396, 8722, -3862, -265, 1515, -756, -132, 317, -113, -27, 30, -5,
+    -1, -5, 31, -32, -107, 328, -172, -724, 1575, -442, -3763, 9320,
+    21394, 8662, -3871, -248, 1509, -759, -129, 316, -113, -26, 30, -5,
+    -1, -5, 31, -33, -106, 329, -176, -721, 1580, -460, -3752, 9379,
+    21392, 8603, -3879, -230, 1503, -762, -125, 314, -114, -26, 29, -5,
+    -1, -5, 31, -33, -106, 330, -180, -717, 1586, -478, -3741, 9439,
+    21390, 8543, -3888, -213, 1496, -764, -121, 313, -114, -25, 29, -5,
+    -1, -5, 31, -34, -105, 331, -184, -714, 1592, -495, -3730, 9499,
+    21388, 8483, -3896, -196, 1490, -767, -117, 312, -115, -25, 29, -5,
+    -1, -5, 31, -35, -104, 332, -188, -710, 1597, -513, -3718, 9559,
+    21385, 8424, -3904, -178, 1483, -770, -113, 311, -115, -24, 29, -5,
+    -1, -5, 31, -35, -104, 333, -192, -707, 1603, -531, -3706, 9619,
+    21382, 8364, -3911, -161, 1477, -773, -109, 310, -116, -24, 29, -5,
+    -1, -4, 32, -36, -103, 334, -196, -703, 1608, -550, -3694, 9678,
+    21379, 8305, -3919, -144, 1470, -775, -105, 309, -116, -23, 29, -5,
+    -1, -4, 32, -36, -102, 335, -200, -699, 1613, -568, -3682, 9738,
+    21375, 8245, -3926, -127, 1464, -778, -102, 307, -117, -23, 29, -5,
+    -1, -4, 32, -37, -102, 336, -204, -696, 1619, -586, -3670, 9798,
+    21371, 8186, -3934, -110, 1457, -781, -98, 306, -117, -22, 29, -5,
+    -1, -4, 32, -37, -101, 336, -208, -692, 1624, -604, -3657, 9858,
+    21367, 8126, -3941, -93, 1451, -783, -94, 305, -118, -22, 28, -5,
+    -1, -4, 32, -38, -100, 337, -212, -688, 1629, -622, -3644, 9917,
+    21362, 8067, -3947, -76, 1444, -786, -90, 304, -118, -21, 28, -5,
+    -1, -4, 32, -38, -99, 338, -216, -684, 1634, -640, -3631, 9977,
+    21357, 8007, -3954, -59, 1437, -788, -86, 302, -119, -21, 28, -5,
+    -1, -4, 32, -39, -99, 339, -220, -680, 1639, -659, -3618, 10037,
+    21352, 7948, -3960, -42, 1431, -791, -83, 301, -119, -20, 28, -5,
+    -1, -4, 32, -40, -98, 340, -224, -677, 1644, -677, -3605, 10096,
+    21347, 7889, -3967, -25, 1424, -793, -79, 300, -120, -20, 28, -5,
+    -1, -4, 32, -40, -97, 341, -228, -673, 1649, -695, -3591, 10156,
+    21341, 7829, -3973, -8, 1417, -795, -75, 299, -120, -19, 28, -5,
+    -1, -4, 32, -41, -97, 342, -232, -669, 1654, -714, -3577, 10216,
+    21335, 7770, -3978, 8, 1410, -798, -71, 297, -120, -19, 28, -5,
+    -1, -4, 33, -41, -96, 343, -236, -665, 1659, -732, -3563, 10275,
+    21328, 7711, -3984, 25, 1403, -800, -67, 296, -121, -18, 27, -5,
+    -1, -4, 33, -42, -95, 344, -240, -660, 1664, -750, -3549, 10335,
+    21322, 7652, -3989, 42, 1396, -802, -64, 295, -121, -18, 27, -5,
+    -1, -4, 33, -42, -94, 344, -244, -656, 1669, -769, -3534, 10395,
+    21315, 7592, -3995, 58, 1389, -804, -60, 293, -122, -17, 27, -5,
+    -1, -4, 33, -43, -93, 345, -248, -652, 1674, -787, -3520, 10454,
+    21308, 7533, -4000, 75, 1382, -806, -56, 292, -122, -17, 27, -5,
+    -1, -4, 33, -44, -93, 346, -252, -648, 1678, -806, -3505, 10514,
+    21300, 7474, -4005, 91, 1375, -808, -53, 291, -123, -16, 27, -5,
+    -1, -4, 33, -44, -92, 347, -256, -644, 1683, -824, -3490, 10573,
+    21292, 7415, -4009, 107, 1368, -810, -49, 289, -123, -16, 27, -5,
+    -1, -4, 33, -45, -91, 348, -260, -639, 1687, -843, -3474, 10633,
+    21284, 7356, -4014, 124, 1361, -812, -45, 288, -123, -15, 27, -5,
+    -1, -4, 33, -45, -90, 348, -264, -635, 1692, -861, -3459, 10692,
+    21275, 7297, -4018, 140, 1354, -814, -41, 287, -124, -15, 27, -5,
+    -1, -4, 33, -46, -90, 349, -268, -631, 1696, -880, -3443, 10752,
+    21267, 7238, -4022, 156, 1346, -816, -38, 285, -124, -14, 26, -5,
+    -1, -4, 33, -46, -89, 350, -272, -626, 1701, -898, -3427, 10811,
+    21257, 7179, -4026, 172, 1339, -818, -34, 284, -124, -14, 26, -5,
+    -1, -4, 33, -47, -88, 351, -276, -622, 1705, -917, -3411, 10871,
+    21248, 7121, -4030, 189, 1332, -820, -31, 283, -125, -13, 26, -5,
+    -1, -4, 34, -48, -87, 351, -280, -617, 1709, -936, -3395, 10930,
+    21238, 7062, -4033, 205, 1324, -822, -27, 281, -125, -13, 26, -5,
+    -1, -4, 34, -48, -86, 352, -284, -613, 1713, -954, -3378, 10989,
+    21228, 7003, -4037, 221, 1317, -824, -23, 280, -125, -12, 26, -5,
+    -1, -4, 34, -49, -85, 353, -289, -608, 1717, -973, -3361, 11049,
+    21218, 6945, -4040, 237, 1310, -825, -20, 278, -126, -12, 26, -5,
+    -1, -4, 34, -49, -84, 353, -293, -604, 1721, -992, -3344, 11108,
+    21207, 6886, -4043, 252, 1302, -827, -16, 277, -126, -11, 26, -5,
+    -1, -3, 34, -50, -84, 354, -297, -599, 1725, -1010, -3327, 11167,
+    21196, 6828, -4046, 268, 1295, -829, -12, 276, -126, -11, 25, -5,
+    -1, -3, 34, -50, -83, 355, -301, -594, 1729, -1029, -3310, 11226,
+    21185, 6769, -4048, 284, 1287, -830, -9, 274, -127, -10, 25, -5,
+    -1, -3, 34, -51, -82, 355, -305, -590, 1733, -1048, -3292, 11285,
+    21174, 6711, -4051, 300, 1280, -832, -5, 273, -127, -10, 25, -5,
+    -1, -3, 34, -52, -81, 356, -309, -585, 1737, -1067, -3274, 11344,
+    21162, 6652, -4053, 315, 1272, -833, -2, 271, -127, -9, 25, -5,
+    -1, -3, 34, -52, -80, 357, -313, -580, 1741, -1085, -3256, 11403,
+    21150, 6594, -4055, 331, 1265, -835, 2, 270, -127, -9, 25, -5,
+    -1, -3, 34, -53, -79, 357, -317, -575, 1744, -1104, -3238, 11462,
+    21137, 6536, -4057, 346, 1257, -836, 5, 268, -128, -8, 25, -5,
+    -1, -3, 34, -53, -78, 358, -321, -570, 1748, -1123, -3219, 11521,
+    21125, 6478, -4059, 362, 1249, -837, 9, 267, -128, -8, 25, -5,
+    -1, -3, 34, -54, -77, 358, -325, -565, 1751, -1142, -3201, 11580,
+    21112, 6420, -4060, 377, 1242, -839, 12, 266, -128, -7, 24, -5,
+    -1, -3, 34, -55, -76, 359, -329, -560, 1755, -1161, -3182, 11639,
+    21098, 6362, -4061, 392, 1234, -840, 16, 264, -129, -7, 24, -5,
+    -1, -3, 35, -55, -75, 359, -333, -555, 1758, -1179, -3163, 11698,
+    21085, 6304, -4063, 408, 1226, -841, 19, 263, -129, -6, 24, -5,
+    -1, -3, 35, -56, -75, 360, -337, -550, 1762, -1198, -3143, 11756,
+    21071, 6246, -4064, 423, 1218, -842, 23, 261, -129, -6, 24, -5,
+    -1, -3, 35, -56, -74, 360, -341, -545, 1765, -1217, -3124, 11815,
+    21057, 6188, -4064, 438, 1210, -844, 26, 260, -129, -6, 24, -5,
+    -1, -3, 35, -57, -73, 361, -345, -540, 1768, -1236, -3104, 11874,
+    21042, 6130, -4065, 453, 1203, -845, 30, 258, -129, -5, 24, -5,
+    -1, -3, 35, -57, -72, 361, -349, -535, 1771, -1255, -3084, 11932,
+    21028, 6073, -4066, 468, 1195, -846, 33, 257, -130, -5, 24, -5,
+    -1, -3, 35, -58, -71, 362, -354, -530, 1774, -1274, -3064, 11991,
+    21012, 6015, -4066, 483, 1187, -847, 36, 255, -130, -4, 23, -5,
+    -1, -3, 35, -59, -70, 362, -358, -524, 1777, -1293, -3043, 12049,
+    20997, 5958, -4066, 498, 1179, -848, 40, 254, -130, -4, 23, -5,
+    -1, -3, 35, -59, -69, 363, -362, -519, 1780, -1311, -3023, 12107,
+    20981, 5900, -4066, 512, 1171, -849, 43, 252, -130, -3, 23, -5,
+    -1, -3, 35, -60, -68, 363, -366, -514, 1783, -1330, -3002, 12166,
+    20965, 5843, -4066, 527, 1163, -850, 47, 251, -130, -3, 23, -5,
+    -1, -3, 35, -60, -67, 363, -370, -508, 1786, -1349, -2981, 12224,
+    20949, 5786, -4065, 542, 1155, -851, 50, 249, -131, -2, 23, -5,
+    -1, -2, 35, -61, -66, 364, -374, -503, 1789, -1368, -2960, 12282,
+    20933, 5728, -4065, 556, 1147, -852, 53, 248, -131, -2, 23, -5,
+    -1, -2, 35, -62, -65, 364, -378, -497, 1791, -1387, -2938, 12340,
+    20916, 5671, -4064, 571, 1139, -852, 57, 246, -131, -2, 22, -5,
+    -1, -2, 35, -62, -64, 365, -382, -492, 1794, -1406, -2916, 12398,
+    20899, 5614, -4063, 585, 1131, -853, 60, 245, -131, -1, 22, -5,
+    -1, -2, 35, -63, -63, 365, -386, -486, 1796, -1425, -2895, 12456,
+    20881, 5557, -4062, 600, 1123, -854, 63, 243, -131, -1, 22, -5,
+    -2, -2, 35, -63, -62, 365, -390, -481, 1799, -1444, -2872, 12514,
+    20864, 5500, -4061, 614, 1114, -855, 67, 241, -131, 0, 22, -5,
+    -2, -2, 35, -64, -61, 366, -394, -475, 1801, -1463, -2850, 12572,
+    20846, 5444, -4059, 628, 1106, -855, 70, 240, -132, 0, 22, -5,
+    -2, -2, 35, -64, -60, 366, -398, -470, 1803, -1482, -2828, 12630,
+    20827, 5387, -4058, 642, 1098, -856, 73, 238, -132, 1, 22, -5,
+    -2, -2, 35, -65, -58, 366, -402, -464, 1806, -1500, -2805, 12687,
+    20809, 5330, -4056, 656, 1090, -856, 76, 237, -132, 1, 22, -5,
+    -2, -2, 35, -66, -57, 366, -406, -458, 1808, -1519, -2782, 12745,
+    20790, 5274, -4054, 670, 1082, -857, 79, 235, -132, 1, 21, -5,
+    -2, -2, 36, -66, -56, 367, -410, -452, 1810, -1538, -2759, 12802,
+    20771, 5218, -4052, 684, 1073, -857, 83, 234, -132, 2, 21, -5,
+    -2, -2, 36, -67, -55, 367, -414, -447, 1812, -1557, -2735, 12860,
+    20751, 5161, -4049, 698, 1065, -858, 86, 232, -132, 2, 21, -5,
+    -2, -2, 36, -67, -54, 367, -418, -441, 1814, -1576, -2712, 12917,
+    20732, 5105, -4047, 712, 1057, -858, 89, 230, -132, 3, 21, -5,
+    -2, -2, 36, -68, -53, 367, -422, -435, 1816, -1595, -2688, 12974,
+    20712, 5049, -4044, 726, 1049, -859, 92, 229, -132, 3, 21, -5,
+    -2, -2, 36, -68, -52, 368, -426, -429, 1817, -1614, -2664, 13031,
+    20691, 4993, -4042, 739, 1040, -859, 95, 227, -132, 4, 21, -5,
+    -2, -2, 36, -69, -51, 368, -430, -423, 1819, -1632, -2640, 13088,
+    20671, 4937, -4039, 753, 1032, -859, 99, 226, -133, 4, 21, -5,
+    -2, -1, 36, -70, -50, 368, -434, -417, 1821, -1651, -2615, 13145,
+    20650, 4881, -4036, 766, 1023, -859, 102, 224, -133, 4, 20, -5,
+    -2, -1, 36, -70, -49, 368, -438, -411, 1822, -1670, -2590, 13202,
+    20629, 4826, -4032, 780, 1015, -860, 105, 223, -133, 5, 20, -5,
+    -2, -1, 36, -71, -47, 368, -442, -405, 1824, -1689, -2565, 13259,
+    20607, 4770, -4029, 793, 1007, -860, 108, 221, -133, 5, 20, -5,
+    -2, -1, 36, -71, -46, 368, -446, -399, 1825, -1708, -2540, 13316,
+    20585, 4714, -4025, 806, 998, -860, 111, 219, -133, 6, 20, -5,
+    -2, -1, 36, -72, -45, 368, -450, -393, 1827, -1727, -2515, 13372,
+    20563, 4659, -4022, 819, 990, -860, 114, 218, -133, 6, 20, -5,
+    -2, -1, 36, -73, -44, 368, -454, -386, 1828, -1745, -2489, 13429,
+    20541, 4604, -4018, 833, 981, -860, 117, 216, -133, 6, 20, -5,
+    -2, -1, 36, -73, -43, 368, -458, -380, 1829, -1764, -2464, 13485,
+    20519, 4549, -4014, 846, 973, -860, 120, 214, -133, 7, 19, -5,
+    -2, -1, 36, -74, -42, 368, -462, -374, 1830, -1783, -2438, 13542,
+    20496, 4493, -4009, 859, 964, -860, 123, 213, -133, 7, 19, -5,
+    -2, -1, 36, -74, -40, 368, -466, -368, 1831, -1802, -2412, 13598,
+    20473, 4438, -4005, 871, 956, -860, 126, 211, -133, 7, 19, -5,
+    -2, -1, 36, -75, -39, 368, -470, -361, 1832, -1820, -2385, 13654,
+    20449, 4384, -4000, 884, 947, -860, 129, 210, -133, 8, 19, -5,
+    -2, -1, 36, -75, -38, 368, -474, -355, 1833, -1839, -2359, 13710,
+    20425, 4329, -3996, 897, 939, -860, 132, 208, -133, 8, 19, -5,
+    -2, -1, 36, -76, -37, 368, -477, -349, 1834, -1858, -2332, 13766,
+    20401, 4274, -3991, 910, 930, -860, 135, 206, -133, 9, 19, -5,
+    -2, -1, 36, -77, -36, 368, -481, -342, 1835, -1876, -2305, 13822,
+    20377, 4220, -3986, 922, 922, -860, 138, 205, -133, 9, 19, -5,
+    -2, -1, 36, -77, -34, 368, -485, -336, 1835, -1895, -2277, 13877,
+    20353, 4165, -3981, 935, 913, -859, 141, 203, -133, 9, 18, -5,
+    -2, 0, 36, -78, -33, 368, -489, -329, 1836, -1914, -2250, 13933,
+    20328, 4111, -3976, 947, 904, -859, 144, 201, -133, 10, 18, -5,
+    -2, 0, 36, -78, -32, 368, -493, -323, 1836, -1932, -2222, 13988,
+    20303, 4057, -3970, 959, 896, -859, 147, 200, -133, 10, 18, -5,
+    -2, 0, 36, -79, -31, 368, -497, -316, 1837, -1951, -2194, 14044,
+    20277, 4003, -3964, 972, 887, -858, 149, 198, -133, 10, 18, -5,
+    -2, 0, 36, -79, -30, 368, -501, -309, 1837, -1969, -2166, 14099,
+    20252, 3949, -3959, 984, 879, -858, 152, 196, -133, 11, 18, -5,
+    -2, 0, 36, -80, -28, 368, -505, -303, 1838, -1988, -2138, 14154,
+    20226, 3895, -3953, 996, 870, -858, 155, 195, -133, 11, 18, -5,
+    -2, 0, 36, -81, -27, 368, -508, -296, 1838, -2006, -2110, 14209,
+    20200, 3841, -3947, 1008, 861, -857, 158, 193, -133, 12, 18, -5,
+    -2, 0, 36, -81, -26, 367, -512, -289, 1838, -2025, -2081, 14264,
+    20173, 3788, -3941, 1020, 853, -857, 161, 191, -133, 12, 17, -5,
+    -2, 0, 36, -82, -25, 367, -516, -283, 1838, -2043, -2052, 14319,
+    20146, 3734, -3934, 1032, 844, -856, 163, 190, -133, 12, 17, -5,
+    -2, 0, 36, -82, -23, 367, -520, -276, 1838, -2062, -2023, 14373,
+    20119, 3681, -3928, 1043, 835, -855, 166, 188, -132, 13, 17, -5,
+    -2, 0, 36, -83, -22, 367, -524, -269, 1838, -2080, -1993, 14428,
+    20092, 3628, -3921, 1055, 827, -855, 169, 186, -132, 13, 17, -5,
+    -2, 0, 36, -83, -21, 367, -527, -262, 1837, -2099, -1964, 14482,
+    20065, 3574, -3914, 1067, 818, -854, 172, 185, -132, 13, 17, -5,
+    -2, 0, 36, -84, -19, 366, -531, -255, 1837, -2117, -1934, 14537,
+    20037, 3522, -3907, 1078, 809, -854, 174, 183, -132, 14, 17, -5,
+    -2, 1, 36, -84, -18, 366, -535, -249, 1837, -2135, -1904, 14591,
+    20009, 3469, -3900, 1090, 800, -853, 177, 181, -132, 14, 16, -5,
+    -2, 1, 36, -85, -17, 366, -539, -242, 1836, -2154, -1874, 14645,
+    19980, 3416, -3893, 1101, 792, -852, 180, 180, -132, 14, 16, -5,
+    -2, 1, 36, -86, -16, 365, -542, -235, 1836, -2172, -1843, 14699,
+    19952, 3363, -3886, 1112, 783, -851, 182, 178, -132, 15, 16, -5,
+    -2, 1, 36, -86, -14, 365, -546, -228, 1835, -2190, -1813, 14752,
+    19923, 3311, -3878, 1123, 774, -851, 185, 176, -132, 15, 16, -5,
+    -2, 1, 36, -87, -13, 365, -550, -221, 1835, -2208, -1782, 14806,
+    19894, 3259, -3871, 1135, 765, -850, 188, 175, -132, 15, 16, -5,
+    -2, 1, 36, -87, -12, 364, -554, -214, 1834, -2226, -1751, 14860,
+    19864, 3206, -3863, 1146, 757, -849, 190, 173, -132, 16, 16, -5,
+    -2, 1, 36, -88, -10, 364, -557, -206, 1833, -2244, -1720, 14913,
+    19835, 3154, -3855, 1157, 748, -848, 193, 171, -131, 16, 16, -5,
+    -2, 1, 36, -88, -9, 364, -561, -199, 1832, -2262, -1688, 14966,
+    19805, 3103, -3847, 1167, 739, -847, 195, 170, -131, 16, 15, -5,
+    -2, 1, 36, -89, -8, 363, -565, -192, 1831, -2280, -1656, 15019,
+    19775, 3051, -3839, 1178, 730, -846, 198, 168, -131, 17, 15, -5,
+    -3, 1, 36, -89, -6, 363, -568, -185, 1830, -2298, -1625, 15072,
+    19744, 2999, -3830, 1189, 721, -845, 200, 166, -131, 17, 15, -5,
+    -3, 1, 35, -90, -5, 362, -572, -178, 1829, -2316, -1592, 15125,
+    19713, 2948, -3822, 1199, 713, -844, 203, 165, -131, 17, 15, -5,
+    -3, 2, 35, -91, -3, 362, -576, -171, 1827, -2334, -1560, 15178,
+    19682, 2896, -3813, 1210, 704, -843, 205, 163, -131, 17, 15, -5,
+    -3, 2, 35, -91, -2, 361, -579, -163, 1826, -2352, -1528, 15230,
+    19651, 2845, -3805, 1220, 695, -842, 208, 161, -131, 18, 15, -5,
+    -3, 2, 35, -92, -1, 361, -583, -156, 1825, -2370, -1495, 15283,
+    19620, 2794, -3796, 1231, 686, -840, 210, 160, -130, 18, 14, -5,
+    -3, 2, 35, -92, 1, 360, -586, -149, 1823, -2388, -1462, 15335,
+    19588, 2743, -3787, 1241, 677, -839, 213, 158, -130, 18, 14, -5,
+    -3, 2, 35, -93, 2, 360, -590, -141, 1821, -2406, -1429, 15387,
+    19556, 2692, -3778, 1251, 669, -838, 215, 156, -130, 19, 14, -5,
+    -3, 2, 35, -93, 3, 359, -594, -134, 1820, -2423, -1396, 15439,
+    19524, 2642, -3768, 1261, 660, -837, 218, 155, -130, 19, 14, -5,
+    -3, 2, 35, -94, 5, 358, -597, -126, 1818, -2441, -1362, 15491,
+    19491, 2591, -3759, 1271, 651, -835, 220, 153, -130, 19, 14, -5,
+    -3, 2, 35, -94, 6, 358, -601, -119, 1816, -2459, -1328, 15543,
+    19458, 2541, -3750, 1281, 642, -834, 222, 151, -130, 20, 14, -5,
+    -3, 2, 35, -95, 8, 357, -604, -112, 1814, -2476, -1294, 15594,
+    19425, 2490, -3740, 1291, 633, -833, 225, 149, -129, 20, 14, -5,
+    -3, 2, 35, -95, 9, 357, -608, -104, 1812, -2494, -1260, 15645,
+    19392, 2440, -3730, 1301, 625, -831, 227, 148, -129, 20, 13, -5,
+    -3, 3, 35, -96, 11, 356, -611, -96, 1810, -2511, -1226, 15697,
+    19358, 2390, -3720, 1311, 616, -830, 229, 146, -129, 20, 13, -5,
+    -3, 3, 35, -96, 12, 355, -615, -89, 1808, -2528, -1191, 15748,
+    19325, 2341, -3710, 1320, 607, -829, 232, 144, -129, 21, 13, -5,
+    -3, 3, 35, -97, 13, 354, -618, -81, 1806, -2546, -1156, 15799,
+    19291, 2291, -3700, 1330, 598, -827, 234, 143, -128, 21, 13, -5,
+    -3, 3, 35, -97, 15, 354, -622, -74, 1803, -2563, -1121, 15849,
+    19256, 2242, -3690, 1339, 589, -826, 236, 141, -128, 21, 13, -5,
+    -3, 3, 35, -98, 16, 353, -625, -66, 1801, -2580, -1086, 15900,
+    19222, 2192, -3679, 1348, 580, -824, 238, 139, -128, 21, 13, -5,
+    -3, 3, 35, -98, 18, 352, -628, -58, 1798, -2598, -1051, 15950,
+    19187, 2143, -3669, 1358, 572, -822, 241, 138, -128, 22, 13, -5,
+    -3, 3, 34, -99, 19, 351, -632, -51, 1796, -2615, -1015, 16001,
+    19152, 2094, -3658, 1367, 563, -821, 243, 136, -128, 22, 12, -5,
+    -3, 3, 34, -99, 21, 351, -635, -43, 1793, -2632, -979, 16051,
+    19117, 2045, -3648, 1376, 554, -819, 245, 134, -127, 22, 12, -5,
+    -3, 3, 34, -100, 22, 350, -638, -35, 1790, -2649, -943, 16101,
+    19081, 1997, -3637, 1385, 545, -818, 247, 133, -127, 23, 12, -5,
+    -3, 4, 34, -100, 24, 349, -642, -27, 1787, -2666, -907, 16151,
+    19045, 1948, -3626, 1394, 536, -816, 249, 131, -127, 23, 12, -5,
+    -3, 4, 34, -101, 25, 348, -645, -20, 1784, -2683, -871, 16200,
+    19009, 1900, -3615, 1402, 528, -814, 251, 129, -127, 23, 12, -5,
+    -3, 4, 34, -101, 27, 347, -648, -12, 1781, -2700, -834, 16250,
+    18973, 1851, -3603, 1411, 519, -812, 254, 128, -126, 23, 12, -5,
+    -3, 4, 34, -102, 28, 346, -652, -4, 1778, -2716, -798, 16299,
+    18937, 1803, -3592, 1420, 510, -811, 256, 126, -126, 24, 12, -5,
+    -3, 4, 34, -102, 30, 345, -655, 4, 1775, -2733, -761, 16348,
+    18900, 1756, -3581, 1428, 501, -809, 258, 124, -126, 24, 11, -4,
+    -3, 4, 34, -103, 31, 345, -658, 12, 1772, -2750, -723, 16397,
+    18863, 1708, -3569, 1437, 493, -807, 260, 123, -125, 24, 11, -4,
+    -3, 4, 34, -103, 33, 344, -661, 20, 1768, -2766, -686, 16446,
+    18826, 1660, -3557, 1445, 484, -805, 262, 121, -125, 24, 11, -4,
+    -3, 4, 34, -104, 34, 343, -665, 28, 1765, -2783, -648, 16494,
+    18788, 1613, -3546, 1453, 475, -803, 264, 119, -125, 25, 11, -4,
+    -3, 4, 33, -104, 36, 342, -668, 36, 1761, -2799, -611, 16543,
+    18751, 1566, -3534, 1462, 466, -801, 266, 118, -125, 25, 11, -4,
+    -3, 5, 33, -105, 37, 341, -671, 44, 1757, -2816, -573, 16591,
+    18713, 1518, -3522, 1470, 457, -799, 268, 116, -124, 25, 11, -4,
+    -3, 5, 33, -105, 39, 340, -674, 52, 1754, -2832, -534, 16639,
+    18675, 1472, -3510, 1478, 449, -797, 270, 114, -124, 25, 11, -4,
+    -3, 5, 33, -106, 40, 339, -677, 60, 1750, -2849, -496, 16687,
+    18636, 1425, -3497, 1486, 440, -795, 272, 113, -124, 25, 10, -4,
+    -3, 5, 33, -106, 42, 338, -680, 68, 1746, -2865, -457, 16734,
+    18598, 1378, -3485, 1493, 431, -793, 274, 111, -123, 26, 10, -4,
+    -3, 5, 33, -107, 43, 336, -684, 76, 1742, -2881, -419, 16782,
+    18559, 1332, -3473, 1501, 422, -791, 275, 109, -123, 26, 10, -4,
+    -3, 5, 33, -107, 45, 335, -687, 84, 1738, -2897, -380, 16829,
+    18520, 1285, -3460, 1509, 414, -789, 277, 108, -123, 26, 10, -4,
+    -3, 5, 33, -108, 46, 334, -690, 92, 1734, -2913, -341, 16876,
+    18481, 1239, -3447, 1516, 405, -787, 279, 106, -122, 26, 10, -4,
+    -3, 5, 32, -108, 48, 333, -693, 100, 1729, -2929, -301, 16923,
+    18441, 1193, -3435, 1524, 396, -785, 281, 104, -122, 27, 10, -4,
+    -3, 5, 32, -109, 49, 332, -696, 108, 1725, -2945, -262, 16970,
+    18401, 1148, -3422, 1531, 388, -782, 283, 103, -122, 27, 10, -4,
+    -3, 6, 32, -109, 51, 331, -699, 117, 1721, -2961, -222, 17017,
+    18361, 1102, -3409, 1538, 379, -780, 285, 101, -121, 27, 10, -4,
+    -3, 6, 32, -109, 52, 330, -702, 125, 1716, -2976, -182, 17063,
+    18321, 1057, -3396, 1546, 370, -778, 286, 99, -121, 27, 9, -4,
+    -4, 6, 32, -110, 54, 328, -705, 133, 1711, -2992, -142, 17109,
+    18281, 1012, -3383, 1553, 362, -776, 288, 98, -121, 27, 9, -4,
+    -4, 6, 32, -110, 56, 327, -708, 141, 1707, -3007, -102, 17155,
+    18240, 966, -3369, 1560, 353, -773, 290, 96, -120, 28, 9, -4,
+    -4, 6, 32, -111, 57, 326, -711, 150, 1702, -3023, -61, 17201,
+    18199, 922, -3356, 1567, 344, -771, 292, 94, -120, 28, 9, -4,
+    -4, 6, 32, -111, 59, 325, -713, 158, 1697, -3038, -20, 17247,
+    18158, 877, -3342, 1574, 336, -769, 293, 93, -120, 28, 9, -4,
+    -4, 6, 31, -112, 60, 323, -716, 166, 1692, -3054, 20, 17292,
+    18117, 832, -3329, 1580, 327, -766, 295, 91, -119, 28, 9, -4,
+    -4, 6, 31, -112, 62, 322, -719, 175, 1687, -3069, 62, 17338,
+    18075, 788, -3315, 1587, 319, -764, 297, 89, -119, 28, 9, -4,
+    -4, 7, 31, -113, 63, 321, -722, 183, 1682, -3084, 103, 17383,
+    18034, 744, -3301, 1594, 310, -761, 298, 88, -119, 29, 8, -4,
+    -4, 7, 31, -113, 65, 319, -725, 191, 1676, -3099, 144, 17427,
+    17992, 700, -3288, 1600, 301, -759, 300, 86, -118, 29, 8, -4,
+    -4, 7, 31, -113, 67, 318, -728, 200, 1671, -3114, 186, 17472,
+    17950, 656, -3274, 1607, 293, -756, 302, 84, -118, 29, 8, -4,
+    -4, 7, 31, -114, 68, 317, -730, 208, 1666, -3129, 228, 17516,
+    17907, 612, -3260, 1613, 284, -754, 303, 83, -117, 29, 8, -4,
+    -4, 7, 30, -114, 70, 315, -733, 216, 1660, -3144, 270, 17561,
+    17865, 569, -3245, 1619, 276, -751, 305, 81, -117, 29, 8, -4,
+    -4, 7, 30, -115, 71, 314, -736, 225, 1655, -3159, 312, 17605,
+    17822, 526, -3231, 1625, 267, -749, 306, 80, -117, 29, 8, -4,
+    -4, 7, 30, -115, 73, 312, -738, 233, 1649, -3173, 354, 17649,
+    17779, 482, -3217, 1631, 259, -746, 308, 78, -116, 30, 8, -4,
+    -4, 7, 30, -115, 75, 311, -741, 242, 1643, -3188, 397, 17692,
+    17736, 440, -3202, 1637, 250, -744, 309, 76, -116, 30, 8, -4,
+    -4, 8, 30, -116, 76, 309, -744, 250, 1637, -3202, 440, 17736,
+    17692, 397, -3188, 1643, 242, -741, 311, 75, -115, 30, 7, -4,
+    -4, 8, 30, -116, 78, 308, -746, 259, 1631, -3217, 482, 17779,
+    17649, 354, -3173, 1649, 233, -738, 312, 73, -115, 30, 7, -4,
+    -4, 8, 29, -117, 80, 306, -749, 267, 1625, -3231, 526, 17822,
+    17605, 312, -3159, 1655, 225, -736, 314, 71, -115, 30, 7, -4,
+    -4, 8, 29, -117, 81, 305, -751, 276, 1619, -3245, 569, 17865,
+    17561, 270, -3144, 1660, 216, -733, 315, 70, -114, 30, 7, -4,
+    -4, 8, 29, -117, 83, 303, -754, 284, 1613, -3260, 612, 17907,
+    17516, 228, -3129, 1666, 208, -730, 317, 68, -114, 31, 7, -4,
+    -4, 8, 29, -118, 84, 302, -756, 293, 1607, -3274, 656, 17950,
+    17472, 186, -3114, 1671, 200, -728, 318, 67, -113, 31, 7, -4,
+    -4, 8, 29, -118, 86, 300, -759, 301, 1600, -3288, 700, 17992,
+    17427, 144, -3099, 1676, 191, -725, 319, 65, -113, 31, 7, -4,
+    -4, 8, 29, -119, 88, 298, -761, 310, 1594, -3301, 744, 18034,
+    17383, 103, -3084, 1682, 183, -722, 321, 63, -113, 31, 7, -4,
+    -4, 9, 28, -119, 89, 297, -764, 319, 1587, -3315, 788, 18075,
+    17338, 62, -3069, 1687, 175, -719, 322, 62, -112, 31, 6, -4,
+    -4, 9, 28, -119, 91, 295, -766, 327, 1580, -3329, 832, 18117,
+    17292, 20, -3054, 1692, 166, -716, 323, 60, -112, 31, 6, -4,
+    -4, 9, 28, -120, 93, 293, -769, 336, 1574, -3342, 877, 18158,
+    17247, -20, -3038, 1697, 158, -713, 325, 59, -111, 32, 6, -4,
+    -4, 9, 28, -120, 94, 292, -771, 344, 1567, -3356, 922, 18199,
+    17201, -61, -3023, 1702, 150, -711, 326, 57, -111, 32, 6, -4,
+    -4, 9, 28, -120, 96, 290, -773, 353, 1560, -3369, 966, 18240,
+    17155, -102, -3007, 1707, 141, -708, 327, 56, -110, 32, 6, -4,
+    -4, 9, 27, -121, 98, 288, -776, 362, 1553, -3383, 1012, 18281,
+    17109, -142, -2992, 1711, 133, -705, 328, 54, -110, 32, 6, -4,
+    -4, 9, 27, -121, 99, 286, -778, 370, 1546, -3396, 1057, 18321,
+    17063, -182, -2976, 1716, 125, -702, 330, 52, -109, 32, 6, -3,
+    -4, 10, 27, -121, 101, 285, -780, 379, 1538, -3409, 1102, 18361,
+    17017, -222, -2961, 1721, 117, -699, 331, 51, -109, 32, 6, -3,
+    -4, 10, 27, -122, 103, 283, -782, 388, 1531, -3422, 1148, 18401,
+    16970, -262, -2945, 1725, 108, -696, 332, 49, -109, 32, 5, -3,
+    -4, 10, 27, -122, 104, 281, -785, 396, 1524, -3435, 1193, 18441,
+    16923, -301, -2929, 1729, 100, -693, 333, 48, -108, 32, 5, -3,
+    -4, 10, 26, -122, 106, 279, -787, 405, 1516, -3447, 1239, 18481,
+    16876, -341, -2913, 1734, 92, -690, 334, 46, -108, 33, 5, -3,
+    -4, 10, 26, -123, 108, 277, -789, 414, 1509, -3460, 1285, 18520,
+    16829, -380, -2897, 1738, 84, -687, 335, 45, -107, 33, 5, -3,
+    -4, 10, 26, -123, 109, 275, -791, 422, 1501, -3473, 1332, 18559,
+    16782, -419, -2881, 1742, 76, -684, 336, 43, -107, 33, 5, -3,
+    -4, 10, 26, -123, 111, 274, -793, 431, 1493, -3485, 1378, 18598,
+    16734, -457, -2865, 1746, 68, -680, 338, 42, -106, 33, 5, -3,
+    -4, 10, 25, -124, 113, 272, -795, 440, 1486, -3497, 1425, 18636,
+    16687, -496, -2849, 1750, 60, -677, 339, 40, -106, 33, 5, -3,
+    -4, 11, 25, -124, 114, 270, -797, 449, 1478, -3510, 1472, 18675,
+    16639, -534, -2832, 1754, 52, -674, 340, 39, -105, 33, 5, -3,
+    -4, 11, 25, -124, 116, 268, -799, 457, 1470, -3522, 1518, 18713,
+    16591, -573, -2816, 1757, 44, -671, 341, 37, -105, 33, 5, -3,
+    -4, 11, 25, -125, 118, 266, -801, 466, 1462, -3534, 1566, 18751,
+    16543, -611, -2799, 1761, 36, -668, 342, 36, -104, 33, 4, -3,
+    -4, 11, 25, -125, 119, 264, -803, 475, 1453, -3546, 1613, 18788,
+    16494, -648, -2783, 1765, 28, -665, 343, 34, -104, 34, 4, -3,
+    -4, 11, 24, -125, 121, 262, -805, 484, 1445, -3557, 1660, 18826,
+    16446, -686, -2766, 1768, 20, -661, 344, 33, -103, 34, 4, -3,
+    -4, 11, 24, -125, 123, 260, -807, 493, 1437, -3569, 1708, 18863,
+    16397, -723, -2750, 1772, 12, -658, 345, 31, -103, 34, 4, -3,
+    -4, 11, 24, -126, 124, 258, -809, 501, 1428, -3581, 1756, 18900,
+    16348, -761, -2733, 1775, 4, -655, 345, 30, -102, 34, 4, -3,
+    -5, 12, 24, -126, 126, 256, -811, 510, 1420, -3592, 1803, 18937,
+    16299, -798, -2716, 1778, -4, -652, 346, 28, -102, 34, 4, -3,
+    -5, 12, 23, -126, 128, 254, -812, 519, 1411, -3603, 1851, 18973,
+    16250, -834, -2700, 1781, -12, -648, 347, 27, -101, 34, 4, -3,
+    -5, 12, 23, -127, 129, 251, -814, 528, 1402, -3615, 1900, 19009,
+    16200, -871, -2683, 1784, -20, -645, 348, 25, -101, 34, 4, -3,
+    -5, 12, 23, -127, 131, 249, -816, 536, 1394, -3626, 1948, 19045,
+    16151, -907, -2666, 1787, -27, -642, 349, 24, -100, 34, 4, -3,
+    -5, 12, 23, -127, 133, 247, -818, 545, 1385, -3637, 1997, 19081,
+    16101, -943, -2649, 1790, -35, -638, 350, 22, -100, 34, 3, -3,
+    -5, 12, 22, -127, 134, 245, -819, 554, 1376, -3648, 2045, 19117,
+    16051, -979, -2632, 1793, -43, -635, 351, 21, -99, 34, 3, -3,
+    -5, 12, 22, -128, 136, 243, -821, 563, 1367, -3658, 2094, 19152,
+    16001, -1015, -2615, 1796, -51, -632, 351, 19, -99, 34, 3, -3,
+    -5, 13, 22, -128, 138, 241, -822, 572, 1358, -3669, 2143, 19187,
+    15950, -1051, -2598, 1798, -58, -628, 352, 18, -98, 35, 3, -3,
+    -5, 13, 21, -128, 139, 238, -824, 580, 1348, -3679, 2192, 19222,
+    15900, -1086, -2580, 1801, -66, -625, 353, 16, -98, 35, 3, -3,
+    -5, 13, 21, -128, 141, 236, -826, 589, 1339, -3690, 2242, 19256,
+    15849, -1121, -2563, 1803, -74, -622, 354, 15, -97, 35, 3, -3,
+    -5, 13, 21, -128, 143, 234, -827, 598, 1330, -3700, 2291, 19291,
+    15799, -1156, -2546, 1806, -81, -618, 354, 13, -97, 35, 3, -3,
+    -5, 13, 21, -129, 144, 232, -829, 607, 1320, -3710, 2341, 19325,
+    15748, -1191, -2528, 1808, -89, -615, 355, 12, -96, 35, 3, -3,
+    -5, 13, 20, -129, 146, 229, -830, 616, 1311, -3720, 2390, 19358,
+    15697, -1226, -2511, 1810, -96, -611, 356, 11, -96, 35, 3, -3,
+    -5, 13, 20, -129, 148, 227, -831, 625, 1301, -3730, 2440, 19392,
+    15645, -1260, -2494, 1812, -104, -608, 357, 9, -95, 35, 2, -3,
+    -5, 14, 20, -129, 149, 225, -833, 633, 1291, -3740, 2490, 19425,
+    15594, -1294, -2476, 1814, -112, -604, 357, 8, -95, 35, 2, -3,
+    -5, 14, 20, -130, 151, 222, -834, 642, 1281, -3750, 2541, 19458,
+    15543, -1328, -2459, 1816, -119, -601, 358, 6, -94, 35, 2, -3,
+    -5, 14, 19, -130, 153, 220, -835, 651, 1271, -3759, 2591, 19491,
+    15491, -1362, -2441, 1818, -126, -597, 358, 5, -94, 35, 2, -3,
+    -5, 14, 19, -130, 155, 218, -837, 660, 1261, -3768, 2642, 19524,
+    15439, -1396, -2423, 1820, -134, -594, 359, 3, -93, 35, 2, -3,
+    -5, 14, 19, -130, 156, 215, -838, 669, 1251, -3778, 2692, 19556,
+    15387, -1429, -2406, 1821, -141, -590, 360, 2, -93, 35, 2, -3,
+    -5, 14, 18, -130, 158, 213, -839, 677, 1241, -3787, 2743, 19588,
+    15335, -1462, -2388, 1823, -149, -586, 360, 1, -92, 35, 2, -3,
+    -5, 14, 18, -130, 160, 210, -840, 686, 1231, -3796, 2794, 19620,
+    15283, -1495, -2370, 1825, -156, -583, 361, -1, -92, 35, 2, -3,
+    -5, 15, 18, -131, 161, 208, -842, 695, 1220, -3805, 2845, 19651,
+    15230, -1528, -2352, 1826, -163, -579, 361, -2, -91, 35, 2, -3,
+    -5, 15, 17, -131, 163, 205, -843, 704, 1210, -3813, 2896, 19682,
+    15178, -1560, -2334, 1827, -171, -576, 362, -3, -91, 35, 2, -3,
+    -5, 15, 17, -131, 165, 203, -844, 713, 1199, -3822, 2948, 19713,
+    15125, -1592, -2316, 1829, -178, -572, 362, -5, -90, 35, 1, -3,
+    -5, 15, 17, -131, 166, 200, -845, 721, 1189, -3830, 2999, 19744,
+    15072, -1625, -2298, 1830, -185, -568, 363, -6, -89, 36, 1, -3,
+    -5, 15, 17, -131, 168, 198, -846, 730, 1178, -3839, 3051, 19775,
+    15019, -1656, -2280, 1831, -192, -565, 363, -8, -89, 36, 1, -2,
+    -5, 15, 16, -131, 170, 195, -847, 739, 1167, -3847, 3103, 19805,
+    14966, -1688, -2262, 1832, -199, -561, 364, -9, -88, 36, 1, -2,
+    -5, 16, 16, -131, 171, 193, -848, 748, 1157, -3855, 3154, 19835,
+    14913, -1720, -2244, 1833, -206, -557, 364, -10, -88, 36, 1, -2,
+    -5, 16, 16, -132, 173, 190, -849, 757, 1146, -3863, 3206, 19864,
+    14860, -1751, -2226, 1834, -214, -554, 364, -12, -87, 36, 1, -2,
+    -5, 16, 15, -132, 175, 188, -850, 765, 1135, -3871, 3259, 19894,
+    14806, -1782, -2208, 1835, -221, -550, 365, -13, -87, 36, 1, -2,
+    -5, 16, 15, -132, 176, 185, -851, 774, 1123, -3878, 3311, 19923,
+    14752, -1813, -2190, 1835, -228, -546, 365, -14, -86, 36, 1, -2,
+    -5, 16, 15, -132, 178, 182, -851, 783, 1112, -3886, 3363, 19952,
+    14699, -1843, -2172, 1836, -235, -542, 365, -16, -86, 36, 1, -2,
+    -5, 16, 14, -132, 180, 180, -852, 792, 1101, -3893, 3416, 19980,
+    14645, -1874, -2154, 1836, -242, -539, 366, -17, -85, 36, 1, -2,
+    -5, 16, 14, -132, 181, 177, -853, 800, 1090, -3900, 3469, 20009,
+    14591, -1904, -2135, 1837, -249, -535, 366, -18, -84, 36, 1, -2,
+    -5, 17, 14, -132, 183, 174, -854, 809, 1078, -3907, 3522, 20037,
+    14537, -1934, -2117, 1837, -255, -531, 366, -19, -84, 36, 0, -2,
+    -5, 17, 13, -132, 185, 172, -854, 818, 1067, -3914, 3574, 20065,
+    14482, -1964, -2099, 1837, -262, -527, 367, -21, -83, 36, 0, -2,
+    -5, 17, 13, -132, 186, 169, -855, 827, 1055, -3921, 3628, 20092,
+    14428, -1993, -2080, 1838, -269, -524, 367, -22, -83, 36, 0, -2,
+    -5, 17, 13, -132, 188, 166, -855, 835, 1043, -3928, 3681, 20119,
+    14373, -2023, -2062, 1838, -276, -520, 367, -23, -82, 36, 0, -2,
+    -5, 17, 12, -133, 190, 163, -856, 844, 1032, -3934, 3734, 20146,
+    14319, -2052, -2043, 1838, -283, -516, 367, -25, -82, 36, 0, -2,
+    -5, 17, 12, -133, 191, 161, -857, 853, 1020, -3941, 3788, 20173,
+    14264, -2081, -2025, 1838, -289, -512, 367, -26, -81, 36, 0, -2,
+    -5, 18, 12, -133, 193, 158, -857, 861, 1008, -3947, 3841, 20200,
+    14209, -2110, -2006, 1838, -296, -508, 368, -27, -81, 36, 0, -2,
+    -5, 18, 11, -133, 195, 155, -858, 870, 996, -3953, 3895, 20226,
+    14154, -2138, -1988, 1838, -303, -505, 368, -28, -80, 36, 0, -2,
+    -5, 18, 11, -133, 196, 152, -858, 879, 984, -3959, 3949, 20252,
+    14099, -2166, -1969, 1837, -309, -501, 368, -30, -79, 36, 0, -2,
+    -5, 18, 10, -133, 198, 149, -858, 887, 972, -3964, 4003, 20277,
+    14044, -2194, -1951, 1837, -316, -497, 368, -31, -79, 36, 0, -2,
+    -5, 18, 10, -133, 200, 147, -859, 896, 959, -3970, 4057, 20303,
+    13988, -2222, -1932, 1836, -323, -493, 368, -32, -78, 36, 0, -2,
+    -5, 18, 10, -133, 201, 144, -859, 904, 947, -3976, 4111, 20328,
+    13933, -2250, -1914, 1836, -329, -489, 368, -33, -78, 36, 0, -2,
+    -5, 18, 9, -133, 203, 141, -859, 913, 935, -3981, 4165, 20353,
+    13877, -2277, -1895, 1835, -336, -485, 368, -34, -77, 36, -1, -2,
+    -5, 19, 9, -133, 205, 138, -860, 922, 922, -3986, 4220, 20377,
+    13822, -2305, -1876, 1835, -342, -481, 368, -36, -77, 36, -1, -2,
+    -5, 19, 9, -133, 206, 135, -860, 930, 910, -3991, 4274, 20401,
+    13766, -2332, -1858, 1834, -349, -477, 368, -37, -76, 36, -1, -2,
+    -5, 19, 8, -133, 208, 132, -860, 939, 897, -3996, 4329, 20425,
+    13710, -2359, -1839, 1833, -355, -474, 368, -38, -75, 36, -1, -2,
+    -5, 19, 8, -133, 210, 129, -860, 947, 884, -4000, 4384, 20449,
+    13654, -2385, -1820, 1832, -361, -470, 368, -39, -75, 36, -1, -2,
+    -5, 19, 7, -133, 211, 126, -860, 956, 871, -4005, 4438, 20473,
+    13598, -2412, -1802, 1831, -368, -466, 368, -40, -74, 36, -1, -2,
+    -5, 19, 7, -133, 213, 123, -860, 964, 859, -4009, 4493, 20496,
+    13542, -2438, -1783, 1830, -374, -462, 368, -42, -74, 36, -1, -2,
+    -5, 19, 7, -133, 214, 120, -860, 973, 846, -4014, 4549, 20519,
+    13485, -2464, -1764, 1829, -380, -458, 368, -43, -73, 36, -1, -2,
+    -5, 20, 6, -133, 216, 117, -860, 981, 833, -4018, 4604, 20541,
+    13429, -2489, -1745, 1828, -386, -454, 368, -44, -73, 36, -1, -2,
+    -5, 20, 6, -133, 218, 114, -860, 990, 819, -4022, 4659, 20563,
+    13372, -2515, -1727, 1827, -393, -450, 368, -45, -72, 36, -1, -2,
+    -5, 20, 6, -133, 219, 111, -860, 998, 806, -4025, 4714, 20585,
+    13316, -2540, -1708, 1825, -399, -446, 368, -46, -71, 36, -1, -2,
+    -5, 20, 5, -133, 221, 108, -860, 1007, 793, -4029, 4770, 20607,
+    13259, -2565, -1689, 1824, -405, -442, 368, -47, -71, 36, -1, -2,
+    -5, 20, 5, -133, 223, 105, -860, 1015, 780, -4032, 4826, 20629,
+    13202, -2590, -1670, 1822, -411, -438, 368, -49, -70, 36, -1, -2,
+    -5, 20, 4, -133, 224, 102, -859, 1023, 766, -4036, 4881, 20650,
+    13145, -2615, -1651, 1821, -417, -434, 368, -50, -70, 36, -1, -2,
+    -5, 21, 4, -133, 226, 99, -859, 1032, 753, -4039, 4937, 20671,
+    13088, -2640, -1632, 1819, -423, -430, 368, -51, -69, 36, -2, -2,
+    -5, 21, 4, -132, 227, 95, -859, 1040, 739, -4042, 4993, 20691,
+    13031, -2664, -1614, 1817, -429, -426, 368, -52, -68, 36, -2, -2,
+    -5, 21, 3, -132, 229, 92, -859, 1049, 726, -4044, 5049, 20712,
+    12974, -2688, -1595, 1816, -435, -422, 367, -53, -68, 36, -2, -2,
+    -5, 21, 3, -132, 230, 89, -858, 1057, 712, -4047, 5105, 20732,
+    12917, -2712, -1576, 1814, -441, -418, 367, -54, -67, 36, -2, -2,
+    -5, 21, 2, -132, 232, 86, -858, 1065, 698, -4049, 5161, 20751,
+    12860, -2735, -1557, 1812, -447, -414, 367, -55, -67, 36, -2, -2,
+    -5, 21, 2, -132, 234, 83, -857, 1073, 684, -4052, 5218, 20771,
+    12802, -2759, -1538, 1810, -452, -410, 367, -56, -66, 36, -2, -2,
+    -5, 21, 1, -132, 235, 79, -857, 1082, 670, -4054, 5274, 20790,
+    12745, -2782, -1519, 1808, -458, -406, 366, -57, -66, 35, -2, -2,
+    -5, 22, 1, -132, 237, 76, -856, 1090, 656, -4056, 5330, 20809,
+    12687, -2805, -1500, 1806, -464, -402, 366, -58, -65, 35, -2, -2,
+    -5, 22, 1, -132, 238, 73, -856, 1098, 642, -4058, 5387, 20827,
+    12630, -2828, -1482, 1803, -470, -398, 366, -60, -64, 35, -2, -2,
+    -5, 22, 0, -132, 240, 70, -855, 1106, 628, -4059, 5444, 20846,
+    12572, -2850, -1463, 1801, -475, -394, 366, -61, -64, 35, -2, -2,
+    -5, 22, 0, -131, 241, 67, -855, 1114, 614, -4061, 5500, 20864,
+    12514, -2872, -1444, 1799, -481, -390, 365, -62, -63, 35, -2, -2,
+    -5, 22, -1, -131, 243, 63, -854, 1123, 600, -4062, 5557, 20881,
+    12456, -2895, -1425, 1796, -486, -386, 365, -63, -63, 35, -2, -1,
+    -5, 22, -1, -131, 245, 60, -853, 1131, 585, -4063, 5614, 20899,
+    12398, -2916, -1406, 1794, -492, -382, 365, -64, -62, 35, -2, -1,
+    -5, 22, -2, -131, 246, 57, -852, 1139, 571, -4064, 5671, 20916,
+    12340, -2938, -1387, 1791, -497, -378, 364, -65, -62, 35, -2, -1,
+    -5, 23, -2, -131, 248, 53, -852, 1147, 556, -4065, 5728, 20933,
+    12282, -2960, -1368, 1789, -503, -374, 364, -66, -61, 35, -2, -1,
+    -5, 23, -2, -131, 249, 50, -851, 1155, 542, -4065, 5786, 20949,
+    12224, -2981, -1349, 1786, -508, -370, 363, -67, -60, 35, -3, -1,
+    -5, 23, -3, -130, 251, 47, -850, 1163, 527, -4066, 5843, 20965,
+    12166, -3002, -1330, 1783, -514, -366, 363, -68, -60, 35, -3, -1,
+    -5, 23, -3, -130, 252, 43, -849, 1171, 512, -4066, 5900, 20981,
+    12107, -3023, -1311, 1780, -519, -362, 363, -69, -59, 35, -3, -1,
+    -5, 23, -4, -130, 254, 40, -848, 1179, 498, -4066, 5958, 20997,
+    12049, -3043, -1293, 1777, -524, -358, 362, -70, -59, 35, -3, -1,
+    -5, 23, -4, -130, 255, 36, -847, 1187, 483, -4066, 6015, 21012,
+    11991, -3064, -1274, 1774, -530, -354, 362, -71, -58, 35, -3, -1,
+    -5, 24, -5, -130, 257, 33, -846, 1195, 468, -4066, 6073, 21028,
+    11932, -3084, -1255, 1771, -535, -349, 361, -72, -57, 35, -3, -1,
+    -5, 24, -5, -129, 258, 30, -845, 1203, 453, -4065, 6130, 21042,
+    11874, -3104, -1236, 1768, -540, -345, 361, -73, -57, 35, -3, -1,
+    -5, 24, -6, -129, 260, 26, -844, 1210, 438, -4064, 6188, 21057,
+    11815, -3124, -1217, 1765, -545, -341, 360, -74, -56, 35, -3, -1,
+    -5, 24, -6, -129, 261, 23, -842, 1218, 423, -4064, 6246, 21071,
+    11756, -3143, -1198, 1762, -550, -337, 360, -75, -56, 35, -3, -1,
+    -5, 24, -6, -129, 263, 19, -841, 1226, 408, -4063, 6304, 21085,
+    11698, -3163, -1179, 1758, -555, -333, 359, -75, -55, 35, -3, -1,
+    -5, 24, -7, -129, 264, 16, -840, 1234, 392, -4061, 6362, 21098,
+    11639, -3182, -1161, 1755, -560, -329, 359, -76, -55, 34, -3, -1,
+    -5, 24, -7, -128, 266, 12, -839, 1242, 377, -4060, 6420, 21112,
+    11580, -3201, -1142, 1751, -565, -325, 358, -77, -54, 34, -3, -1,
+    -5, 25, -8, -128, 267, 9, -837, 1249, 362, -4059, 6478, 21125,
+    11521, -3219, -1123, 1748, -570, -321, 358, -78, -53, 34, -3, -1,
+    -5, 25, -8, -128, 268, 5, -836, 1257, 346, -4057, 6536, 21137,
+    11462, -3238, -1104, 1744, -575, -317, 357, -79, -53, 34, -3, -1,
+    -5, 25, -9, -127, 270, 2, -835, 1265, 331, -4055, 6594, 21150,
+    11403, -3256, -1085, 1741, -580, -313, 357, -80, -52, 34, -3, -1,
+    -5, 25, -9, -127, 271, -2, -833, 1272, 315, -4053, 6652, 21162,
+    11344, -3274, -1067, 1737, -585, -309, 356, -81, -52, 34, -3, -1,
+    -5, 25, -10, -127, 273, -5, -832, 1280, 300, -4051, 6711, 21174,
+    11285, -3292, -1048, 1733, -590, -305, 355, -82, -51, 34, -3, -1,
+    -5, 25, -10, -127, 274, -9, -830, 1287, 284, -4048, 6769, 21185,
+    11226, -3310, -1029, 1729, -594, -301, 355, -83, -50, 34, -3, -1,
+    -5, 25, -11, -126, 276, -12, -829, 1295, 268, -4046, 6828, 21196,
+    11167, -3327, -1010, 1725, -599, -297, 354, -84, -50, 34, -3, -1,
+    -5, 26, -11, -126, 277, -16, -827, 1302, 252, -4043, 6886, 21207,
+    11108, -3344, -992, 1721, -604, -293, 353, -84, -49, 34, -4, -1,
+    -5, 26, -12, -126, 278, -20, -825, 1310, 237, -4040, 6945, 21218,
+    11049, -3361, -973, 1717, -608, -289, 353, -85, -49, 34, -4, -1,
+    -5, 26, -12, -125, 280, -23, -824, 1317, 221, -4037, 7003, 21228,
+    10989, -3378, -954, 1713, -613, -284, 352, -86, -48, 34, -4, -1,
+    -5, 26, -13, -125, 281, -27, -822, 1324, 205, -4033, 7062, 21238,
+    10930, -3395, -936, 1709, -617, -280, 351, -87, -48, 34, -4, -1,
+    -5, 26, -13, -125, 283, -31, -820, 1332, 189, -4030, 7121, 21248,
+    10871, -3411, -917, 1705, -622, -276, 351, -88, -47, 33, -4, -1,
+    -5, 26, -14, -124, 284, -34, -818, 1339, 172, -4026, 7179, 21257,
+    10811, -3427, -898, 1701, -626, -272, 350, -89, -46, 33, -4, -1,
+    -5, 26, -14, -124, 285, -38, -816, 1346, 156, -4022, 7238, 21267,
+    10752, -3443, -880, 1696, -631, -268, 349, -90, -46, 33, -4, -1,
+    -5, 27, -15, -124, 287, -41, -814, 1354, 140, -4018, 7297, 21275,
+    10692, -3459, -861, 1692, -635, -264, 348, -90, -45, 33, -4, -1,
+    -5, 27, -15, -123, 288, -45, -812, 1361, 124, -4014, 7356, 21284,
+    10633, -3474, -843, 1687, -639, -260, 348, -91, -45, 33, -4, -1,
+    -5, 27, -16, -123, 289, -49, -810, 1368, 107, -4009, 7415, 21292,
+    10573, -3490, -824, 1683, -644, -256, 347, -92, -44, 33, -4, -1,
+    -5, 27, -16, -123, 291, -53, -808, 1375, 91, -4005, 7474, 21300,
+    10514, -3505, -806, 1678, -648, -252, 346, -93, -44, 33, -4, -1,
+    -5, 27, -17, -122, 292, -56, -806, 1382, 75, -4000, 7533, 21308,
+    10454, -3520, -787, 1674, -652, -248, 345, -93, -43, 33, -4, -1,
+    -5, 27, -17, -122, 293, -60, -804, 1389, 58, -3995, 7592, 21315,
+    10395, -3534, -769, 1669, -656, -244, 344, -94, -42, 33, -4, -1,
+    -5, 27, -18, -121, 295, -64, -802, 1396, 42, -3989, 7652, 21322,
+    10335, -3549, -750, 1664, -660, -240, 344, -95, -42, 33, -4, -1,
+    -5, 27, -18, -121, 296, -67, -800, 1403, 25, -3984, 7711, 21328,
+    10275, -3563, -732, 1659, -665, -236, 343, -96, -41, 33, -4, -1,
+    -5, 28, -19, -120, 297, -71, -798, 1410, 8, -3978, 7770, 21335,
+    10216, -3577, -714, 1654, -669, -232, 342, -97, -41, 32, -4, -1,
+    -5, 28, -19, -120, 299, -75, -795, 1417, -8, -3973, 7829, 21341,
+    10156, -3591, -695, 1649, -673, -228, 341, -97, -40, 32, -4, -1,
+    -5, 28, -20, -120, 300, -79, -793, 1424, -25, -3967, 7889, 21347,
+    10096, -3605, -677, 1644, -677, -224, 340, -98, -40, 32, -4, -1,
+    -5, 28, -20, -119, 301, -83, -791, 1431, -42, -3960, 7948, 21352,
+    10037, -3618, -659, 1639, -680, -220, 339, -99, -39, 32, -4, -1,
+    -5, 28, -21, -119, 302, -86, -788, 1437, -59, -3954, 8007, 21357,
+    9977, -3631, -640, 1634, -684, -216, 338, -99, -38, 32, -4, -1,
+    -5, 28, -21, -118, 304, -90, -786, 1444, -76, -3947, 8067, 21362,
+    9917, -3644, -622, 1629, -688, -212, 337, -100, -38, 32, -4, -1,
+    -5, 28, -22, -118, 305, -94, -783, 1451, -93, -3941, 8126, 21367,
+    9858, -3657, -604, 1624, -692, -208, 336, -101, -37, 32, -4, -1,
+    -5, 29, -22, -117, 306, -98, -781, 1457, -110, -3934, 8186, 21371,
+    9798, -3670, -586, 1619, -696, -204, 336, -102, -37, 32, -4, -1,
+    -5, 29, -23, -117, 307, -102, -778, 1464, -127, -3926, 8245, 21375,
+    9738, -3682, -568, 1613, -699, -200, 335, -102, -36, 32, -4, -1,
+    -5, 29, -23, -116, 309, -105, -775, 1470, -144, -3919, 8305, 21379,
+    9678, -3694, -550, 1608, -703, -196, 334, -103, -36, 32, -4, -1,
+    -5, 29, -24, -116, 310, -109, -773, 1477, -161, -3911, 8364, 21382,
+    9619, -3706, -531, 1603, -707, -192, 333, -104, -35, 31, -5, -1,
+    -5, 29, -24, -115, 311, -113, -770, 1483, -178, -3904, 8424, 21385,
+    9559, -3718, -513, 1597, -710, -188, 332, -104, -35, 31, -5, -1,
+    -5, 29, -25, -115, 312, -117, -767, 1490, -196, -3896, 8483, 21388,
+    9499, -3730, -495, 1592, -714, -184, 331, -105, -34, 31, -5, -1,
+    -5, 29, -25, -114, 313, -121, -764, 1496, -213, -3888, 8543, 21390,
+    9439, -3741, -478, 1586, -717, -180, 330, -106, -33, 31, -5, -1,
+    -5, 29, -26, -114, 314, -125, -762, 1503, -230, -3879, 8603, 21392,
+    9379, -3752, -460, 1580, -721, -176, 329, -106, -33, 31, -5, -1,
+    -5, 30, -26, -113, 316, -129, -759, 1509, -248, -3871, 8662, 21394,
+    9320, -3763, -442, 1575, -724, -172, 328, -107, -32, 31, -5, -1,
+    -5, 30, -27, -113, 317, -132, -756, 1515, -265, -3862, 8722, 21396,
+    9260, -3774, -424, 1569, -727, -168, 327, -107, -32, 31, -5, -1,
+    -5, 30, -27, -112, 318, -136, -753, 1521, -282, -3853, 8782, 21397,
+    9200, -3785, -406, 1563, -731, -164, 326, -108, -31, 31, -5, -1,
+    -5, 30, -28, -112, 319, -140, -750, 1527, -300, -3844, 8841, 21398,
+    9140, -3795, -388, 1557, -734, -160, 324, -109, -31, 31, -5, -1,
+    -5, 30, -29, -111, 320, -144, -747, 1533, -318, -3834, 8901, 21398,
+    9080, -3805, -371, 1551, -737, -156, 323, -109, -30, 30, -5, -1,
+    -5, 30, -29, -110, 321, -148, -744, 1539, -335, -3825, 8961, 21399,
+    9021, -3815, -353, 1545, -740, -152, 322, -110, -30, 30, -5, -1,
+};
+
+// L/M=441/80, 16 taps: 8000->44100
+const int16_t kBank441x80x16[7056] = {
+    -1, 21, -111, 360, -846, 1566, -2384, 3059, 29490, 2991, -2359, 1556,
+    -842, 359, -111, 21, -1, 21, -112, 361, -849, 1576, -2409, 3126,
+    29489, 2924, -2334, 1547, -839, 358, -111, 21, -1, 21, -112, 361,
+    -852, 1586, -2434, 3194, 29489, 2857, -2309, 1537, -835, 357, -111, 21,
+    -1, 21, -112, 362, -855, 1596, -2459, 3262, 29487, 2790, -2284, 1527,
+    -832, 356, -111, 21, -1, 21, -112, 363, -859, 1606, -2484, 3331,
+    29486, 2724, -2259, 1517, -829, 356, -111, 21, -1, 21, -112, 364,
+    -862, 1615, -2509, 3399, 29483, 2657, -2234, 1506, -825, 355, -111, 21,
+    -1, 21, -112, 364, -865, 1625, -2534, 3468, 29481, 2591, -2209, 1496,
+    -822, 354, -111, 21, -1, 21, -112, 365, -868, 1635, -2559, 3537,
+    29478, 2525, -2184, 1486, -818, 353, -111, 21, -1, 21, -112, 366,
+    -871, 1644, -2584, 3606, 29475, 2460, -2159, 1476, -815, 352, -110, 21,
+    -1, 21, -112, 366, -874, 1654, -2609, 3675, 29471, 2394, -2134, 1466,
+    -811, 351, -110, 21, -1, 21, -112, 367, -877, 1663, -2633, 3745,
+    29467, 2329, -2108, 1456, -807, 350, -110, 21, -1, 21, -112, 368,
+    -881, 1673, -2658, 3814, 29462, 2264, -2083, 1445, -804, 349, -110, 21,
+    -1, 21, -112, 368, -884, 1682, -2683, 3884, 29457, 2199, -2058, 1435,
+    -800, 348, -110, 21, -1, 21, -112, 369, -887, 1691, -2708, 3954,
+    29451, 2135, -2033, 1425, -797, 347, -110, 21, -1, 21, -112, 370,
+    -889, 1701, -2732, 4025, 29445, 2070, -2008, 1414, -793, 346, -110, 21,
+    -1, 21, -112, 370, -892, 1710, -2757, 4095, 29439, 2006, -1983, 1404,
+    -789, 345, -109, 21, -1, 21, -112, 371, -895, 1719, -2782, 4166,
+    29432, 1943, -1958, 1394, -785, 344, -109, 21, -1, 20, -112, 371,
+    -898, 1729, -2806, 4237, 29425, 1879, -1932, 1383, -782, 343, -109, 21,
+    -1, 20, -112, 372, -901, 1738, -2831, 4308, 29418, 1816, -1907, 1373,
+    -778, 342, -109, 21, -1, 20, -112, 373, -904, 1747, -2855, 4379,
+    29410, 1752, -1882, 1362, -774, 341, -109, 21, -1, 20, -112, 373,
+    -907, 1756, -2880, 4450, 29401, 1690, -1857, 1352, -770, 340, -109, 21,
+    -1, 20, -112, 374, -909, 1765, -2904, 4522, 29392, 1627, -1832, 1341,
+    -766, 339, -108, 21, -1, 20, -112, 374, -912, 1774, -2928, 4594,
+    29383, 1564, -1807, 1331, -763, 338, -108, 21, -1, 20, -112, 375,
+    -915, 1783, -2953, 4666, 29373, 1502, -1782, 1320, -759, 337, -108, 21,
+    -1, 20, -112, 375, -917, 1792, -2977, 4738, 29363, 1440, -1756, 1310,
+    -755, 336, -108, 21, -1, 20, -112, 375, -920, 1801, -3001, 4810,
+    29353, 1379, -1731, 1299, -751, 335, -108, 21, -1, 20, -112, 376,
+    -923, 1809, -3025, 4883, 29342, 1317, -1706, 1288, -747, 334, -107, 21,
+    -1, 20, -112, 376, -925, 1818, -3050, 4956, 29330, 1256, -1681, 1278,
+    -743, 332, -107, 21, -1, 20, -112, 377, -928, 1827, -3074, 5029,
+    29318, 1195, -1656, 1267, -739, 331, -107, 21, -1, 20, -112, 377,
+    -930, 1835, -3098, 5102, 29306, 1134, -1631, 1256, -735, 330, -107, 21,
+    -1, 20, -112, 377, -933, 1844, -3122, 5175, 29294, 1074, -1606, 1246,
+    -731, 329, -106, 21, -1, 20, -112, 378, -935, 1852, -3146, 5248,
+    29281, 1013, -1581, 1235, -727, 328, -106, 21, -1, 20, -111, 378,
+    -937, 1861, -3170, 5322, 29267, 953, -1556, 1224, -723, 327, -106, 21,
+    -1, 20, -111, 378, -940, 1869, -3193, 5396, 29253, 894, -1531, 1213,
+    -719, 325, -106, 21, -1, 20, -111, 379, -942, 1878, -3217, 5470,
+    29239, 834, -1506, 1203, -715, 324, -105, 20, -1, 20, -111, 379,
+    -944, 1886, -3241, 5544, 29224, 775, -1481, 1192, -711, 323, -105, 20,
+    -1, 19, -111, 379, -947, 1894, -3265, 5618, 29209, 716, -1456, 1181,
+    -707, 322, -105, 20, -1, 19, -111, 380, -949, 1902, -3288, 5693,
+    29193, 657, -1431, 1170, -703, 321, -105, 20, -1, 19, -111, 380,
+    -951, 1911, -3312, 5767, 29177, 599, -1406, 1159, -699, 319, -104, 20,
+    -1, 19, -111, 380, -953, 1919, -3335, 5842, 29161, 540, -1381, 1148,
+    -694, 318, -104, 20, -1, 19, -110, 380, -955, 1927, -3359, 5917,
+    29144, 482, -1357, 1138, -690, 317, -104, 20, -1, 19, -110, 380,
+    -958, 1935, -3382, 5992, 29127, 425, -1332, 1127, -686, 315, -104, 20,
+    -1, 19, -110, 381, -960, 1942, -3405, 6067, 29109, 367, -1307, 1116,
+    -682, 314, -103, 20, -1, 19, -110, 381, -962, 1950, -3429, 6143,
+    29091, 310, -1282, 1105, -678, 313, -103, 20, -1, 19, -110, 381,
+    -964, 1958, -3452, 6218, 29073, 253, -1258, 1094, -673, 312, -103, 20,
+    -1, 19, -110, 381, -965, 1966, -3475, 6294, 29054, 196, -1233, 1083,
+    -669, 310, -103, 20, -1, 19, -109, 381, -967, 1973, -3498, 6370,
+    29035, 140, -1208, 1072, -665, 309, -102, 20, -1, 19, -109, 381,
+    -969, 1981, -3521, 6446, 29015, 84, -1184, 1061, -661, 308, -102, 20,
+    -1, 19, -109, 381, -971, 1989, -3544, 6522, 28995, 28, -1159, 1050,
+    -656, 306, -102, 20, -1, 18, -109, 381, -973, 1996, -3566, 6598,
+    28975, -28, -1134, 1039, -652, 305, -101, 20, -1, 18, -109, 381,
+    -975, 2003, -3589, 6675, 28954, -83, -1110, 1028, -648, 304, -101, 20,
+    -1, 18, -108, 381, -976, 2011, -3612, 6751, 28932, -138, -1085, 1017,
+    -643, 302, -101, 20, -1, 18, -108, 381, -978, 2018, -3634, 6828,
+    28911, -193, -1061, 1006, -639, 301, -100, 20, -1, 18, -108, 381,
+    -980, 2025, -3657, 6905, 28888, -248, -1036, 995, -635, 300, -100, 20,
+    -1, 18, -108, 381, -981, 2032, -3679, 6982, 28866, -302, -1012, 984,
+    -630, 298, -100, 20, -1, 18, -108, 381, -983, 2040, -3702, 7059,
+    28843, -356, -988, 973, -626, 297, -99, 20, -1, 18, -107, 381,
+    -984, 2047, -3724, 7136, 28820, -410, -963, 962, -622, 295, -99, 20,
+    -1, 18, -107, 381, -986, 2054, -3746, 7214, 28796, -463, -939, 951,
+    -617, 294, -99, 19, -1, 18, -107, 381, -987, 2060, -3768, 7291,
+    28772, -517, -915, 940, -613, 293, -98, 19, -1, 17, -106, 381,
+    -989, 2067, -3790, 7369, 28747, -570, -891, 929, -608, 291, -98, 19,
+    -1, 17, -106, 381, -990, 2074, -3812, 7447, 28722, -622, -866, 918,
+    -604, 290, -98, 19, -1, 17, -106, 380, -991, 2081, -3834, 7525,
+    28697, -675, -842, 907, -600, 288, -97, 19, -1, 17, -106, 380,
+    -993, 2087, -3856, 7603, 28671, -727, -818, 896, -595, 287, -97, 19,
+    -1, 17, -105, 380, -994, 2094, -3877, 7681, 28645, -779, -794, 885,
+    -591, 285, -97, 19, -1, 17, -105, 380, -995, 2100, -3899, 7759,
+    28618, -831, -770, 874, -586, 284, -96, 19, -1, 17, -105, 380,
+    -996, 2107, -3920, 7838, 28591, -882, -746, 862, -582, 282, -96, 19,
+    -1, 17, -104, 379, -998, 2113, -3942, 7916, 28564, -933, -723, 851,
+    -577, 281, -96, 19, -1, 17, -104, 379, -999, 2119, -3963, 7995,
+    28536, -984, -699, 840, -573, 280, -95, 19, -1, 16, -104, 379,
+    -1000, 2125, -3984, 8074, 28508, -1034, -675, 829, -568, 278, -95, 19,
+    -1, 16, -103, 378, -1001, 2132, -4005, 8153, 28479, -1085, -651, 818,
+    -564, 277, -95, 19, -1, 16, -103, 378, -1002, 2138, -4026, 8232,
+    28450, -1135, -628, 807, -559, 275, -94, 19, -1, 16, -103, 378,
+    -1003, 2144, -4047, 8311, 28421, -1184, -604, 796, -555, 274, -94, 19,
+    -1, 16, -102, 377, -1003, 2149, -4068, 8390, 28391, -1234, -580, 785,
+    -550, 272, -93, 19, -1, 16, -102, 377, -1004, 2155, -4088, 8469,
+    28361, -1283, -557, 774, -546, 271, -93, 19, -1, 16, -102, 376,
+    -1005, 2161, -4109, 8549, 28331, -1332, -533, 763, -541, 269, -93, 18,
+    0, 15, -101, 376, -1006, 2167, -4129, 8628, 28300, -1380, -510, 752,
+    -536, 267, -92, 18, 0, 15, -101, 376, -1007, 2172, -4150, 8708,
+    28268, -1429, -487, 741, -532, 266, -92, 18, 0, 15, -100, 375,
+    -1007, 2178, -4170, 8788, 28237, -1477, -463, 730, -527, 264, -92, 18,
+    0, 15, -100, 375, -1008, 2183, -4190, 8868, 28205, -1524, -440, 719,
+    -523, 263, -91, 18, 0, 15, -100, 374, -1008, 2189, -4210, 8948,
+    28172, -1572, -417, 708, -518, 261, -91, 18, 0, 15, -99, 373,
+    -1009, 2194, -4230, 9028, 28139, -1619, -394, 697, -514, 260, -90, 18,
+    0, 15, -99, 373, -1009, 2199, -4250, 9108, 28106, -1666, -371, 686,
+    -509, 258, -90, 18, 0, 14, -98, 372, -1010, 2204, -4270, 9188,
+    28072, -1712, -348, 675, -504, 257, -90, 18, 0, 14, -98, 372,
+    -1010, 2209, -4289, 9268, 28038, -1759, -325, 664, -500, 255, -89, 18,
+    0, 14, -97, 371, -1011, 2214, -4309, 9349, 28004, -1805, -302, 653,
+    -495, 254, -89, 18, 0, 14, -97, 371, -1011, 2219, -4328, 9429,
+    27969, -1851, -279, 642, -491, 252, -88, 18, 0, 14, -96, 370,
+    -1011, 2224, -4347, 9510, 27934, -1896, -257, 631, -486, 250, -88, 18,
+    0, 14, -96, 369, -1012, 2229, -4366, 9590, 27898, -1941, -234, 620,
+    -481, 249, -88, 18, 0, 13, -96, 368, -1012, 2233, -4385, 9671,
+    27862, -1986, -211, 609, -477, 247, -87, 17, 0, 13, -95, 368,
+    -1012, 2238, -4404, 9752, 27826, -2031, -189, 598, -472, 246, -87, 17,
+    0, 13, -95, 367, -1012, 2242, -4423, 9833, 27789, -2075, -166, 587,
+    -467, 244, -86, 17, 0, 13, -94, 366, -1012, 2247, -4441, 9914,
+    27752, -2119, -144, 576, -463, 242, -86, 17, 0, 13, -94, 365,
+    -1012, 2251, -4460, 9995, 27715, -2163, -122, 565, -458, 241, -86, 17,
+    0, 13, -93, 365, -1012, 2255, -4478, 10076, 27677, -2206, -99, 554,
+    -453, 239, -85, 17, 0, 12, -92, 364, -1012, 2259, -4496, 10157,
+    27639, -2250, -77, 543, -449, 238, -85, 17, 0, 12, -92, 363,
+    -1012, 2263, -4515, 10238, 27600, -2292, -55, 532, -444, 236, -84, 17,
+    0, 12, -91, 362, -1012, 2267, -4533, 10319, 27561, -2335, -33, 522,
+    -440, 234, -84, 17, 0, 12, -91, 361, -1011, 2271, -4550, 10401,
+    27522, -2377, -11, 511, -435, 233, -83, 17, 0, 12, -90, 360,
+    -1011, 2275, -4568, 10482, 27482, -2419, 11, 500, -430, 231, -83, 17,
+    0, 11, -90, 359, -1011, 2278, -4586, 10564, 27442, -2461, 33, 489,
+    -426, 229, -83, 17, 0, 11, -89, 358, -1010, 2282, -4603, 10645,
+    27402, -2503, 55, 478, -421, 228, -82, 17, 0, 11, -89, 358,
+    -1010, 2286, -4620, 10727, 27361, -2544, 76, 467, -416, 226, -82, 16,
+    0, 11, -88, 357, -1010, 2289, -4637, 10808, 27320, -2585, 98, 457,
+    -412, 225, -81, 16, 0, 11, -87, 356, -1009, 2292, -4654, 10890,
+    27278, -2625, 119, 446, -407, 223, -81, 16, 0, 10, -87, 355,
+    -1008, 2296, -4671, 10972, 27237, -2665, 141, 435, -402, 221, -80, 16,
+    0, 10, -86, 353, -1008, 2299, -4688, 11054, 27194, -2705, 162, 425,
+    -398, 220, -80, 16, 0, 10, -86, 352, -1007, 2302, -4705, 11136,
+    27152, -2745, 183, 414, -393, 218, -79, 16, 0, 10, -85, 351,
+    -1007, 2305, -4721, 11217, 27109, -2785, 205, 403, -388, 216, -79, 16,
+    0, 10, -84, 350, -1006, 2308, -4737, 11299, 27065, -2824, 226, 392,
+    -384, 215, -79, 16, 0, 9, -84, 349, -1005, 2310, -4754, 11381,
+    27022, -2862, 247, 382, -379, 213, -78, 16, 0, 9, -83, 348,
+    -1004, 2313, -4769, 11463, 26978, -2901, 268, 371, -374, 211, -78, 16,
+    0, 9, -82, 347, -1003, 2316, -4785, 11545, 26933, -2939, 289, 361,
+    -370, 210, -77, 16, 0, 9, -82, 346, -1002, 2318, -4801, 11628,
+    26889, -2977, 309, 350, -365, 208, -77, 16, 0, 9, -81, 344,
+    -1001, 2321, -4817, 11710, 26844, -3015, 330, 339, -360, 206, -76, 16,
+    0, 8, -80, 343, -1000, 2323, -4832, 11792, 26798, -3052, 351, 329,
+    -356, 205, -76, 15, 1, 8, -80, 342, -999, 2325, -4847, 11874,
+    26752, -3089, 371, 318, -351, 203, -75, 15, 1, 8, -79, 341,
+    -998, 2327, -4862, 11956, 26706, -3126, 392, 308, -346, 201, -75, 15,
+    1, 8, -78, 339, -997, 2329, -4877, 12038, 26660, -3163, 412, 297,
+    -342, 200, -75, 15, 1, 7, -78, 338, -996, 2331, -4892, 12121,
+    26613, -3199, 433, 287, -337, 198, -74, 15, 1, 7, -77, 337,
+    -994, 2333, -4907, 12203, 26566, -3235, 453, 276, -332, 196, -74, 15,
+    1, 7, -76, 335, -993, 2335, -4921, 12285, 26518, -3270, 473, 266,
+    -328, 195, -73, 15, 1, 7, -75, 334, -992, 2337, -4935, 12368,
+    26470, -3306, 493, 256, -323, 193, -73, 15, 1, 7, -75, 332,
+    -990, 2338, -4949, 12450, 26422, -3341, 513, 245, -318, 191, -72, 15,
+    1, 6, -74, 331, -989, 2340, -4963, 12532, 26373, -3375, 533, 235,
+    -314, 189, -72, 15, 1, 6, -73, 329, -987, 2341, -4977, 12615,
+    26325, -3410, 552, 225, -309, 188, -71, 15, 1, 6, -73, 328,
+    -986, 2342, -4991, 12697, 26275, -3444, 572, 214, -305, 186, -71, 14,
+    1, 6, -72, 326, -984, 2343, -5004, 12779, 26226, -3478, 592, 204,
+    -300, 184, -70, 14, 1, 5, -71, 325, -982, 2344, -5018, 12862,
+    26176, -3511, 611, 194, -295, 183, -70, 14, 1, 5, -70, 323,
+    -981, 2345, -5031, 12944, 26126, -3545, 631, 184, -291, 181, -69, 14,
+    1, 5, -69, 322, -979, 2346, -5044, 13027, 26075, -3577, 650, 173,
+    -286, 179, -69, 14, 1, 5, -69, 320, -977, 2347, -5056, 13109,
+    26024, -3610, 669, 163, -282, 178, -68, 14, 1, 4, -68, 319,
+    -975, 2348, -5069, 13191, 25973, -3643, 688, 153, -277, 176, -68, 14,
+    1, 4, -67, 317, -973, 2348, -5081, 13274, 25921, -3675, 707, 143,
+    -272, 174, -68, 14, 1, 4, -66, 315, -971, 2349, -5094, 13356,
+    25869, -3706, 726, 133, -268, 173, -67, 14, 1, 3, -65, 314,
+    -969, 2349, -5106, 13439, 25817, -3738, 745, 123, -263, 171, -67, 14,
+    1, 3, -64, 312, -967, 2349, -5118, 13521, 25765, -3769, 764, 113,
+    -259, 169, -66, 14, 1, 3, -64, 310, -965, 2349, -5129, 13603,
+    25712, -3800, 782, 103, -254, 168, -66, 14, 1, 3, -63, 309,
+    -963, 2350, -5141, 13686, 25659, -3831, 801, 93, -249, 166, -65, 13,
+    1, 2, -62, 307, -961, 2349, -5152, 13768, 25605, -3861, 819, 83,
+    -245, 164, -65, 13, 1, 2, -61, 305, -958, 2349, -5164, 13850,
+    25551, -3891, 838, 73, -240, 162, -64, 13, 1, 2, -60, 303,
+    -956, 2349, -5175, 13933, 25497, -3921, 856, 63, -236, 161, -64, 13,
+    2, 2, -59, 301, -954, 2349, -5185, 14015, 25443, -3950, 874, 54,
+    -231, 159, -63, 13, 2, 1, -58, 300, -951, 2348, -5196, 14097,
+    25388, -3979, 892, 44, -227, 157, -63, 13, 2, 1, -58, 298,
+    -949, 2348, -5206, 14180, 25333, -4008, 910, 34, -222, 156, -62, 13,
+    2, 1, -57, 296, -946, 2347, -5217, 14262, 25278, -4037, 928, 24,
+    -218, 154, -62, 13, 2, 0, -56, 294, -944, 2346, -5227, 14344,
+    25222, -4065, 946, 14, -213, 152, -61, 13, 2, 0, -55, 292,
+    -941, 2345, -5237, 14426, 25166, -4093, 964, 5, -209, 151, -61, 13,
+    2, 0, -54, 290, -938, 2344, -5246, 14508, 25110, -4120, 981, -5,
+    -204, 149, -60, 13, 2, 0, -53, 288, -936, 2343, -5256, 14590,
+    25053, -4148, 999, -14, -200, 147, -60, 12, 2, -1, -52, 286,
+    -933, 2342, -5265, 14672, 24996, -4175, 1016, -24, -195, 146, -59, 12,
+    2, -1, -51, 284, -930, 2341, -5274, 14754, 24939, -4202, 1033, -34,
+    -191, 144, -59, 12, 2, -1, -50, 282, -927, 2339, -5283, 14836,
+    24881, -4228, 1050, -43, -186, 142, -59, 12, 2, -2, -49, 280,
+    -924, 2338, -5292, 14918, 24824, -4254, 1067, -53, -182, 141, -58, 12,
+    2, -2, -48, 278, -921, 2336, -5300, 15000, 24765, -4280, 1084, -62,
+    -178, 139, -58, 12, 2, -2, -47, 276, -918, 2334, -5309, 15082,
+    24707, -4306, 1101, -71, -173, 137, -57, 12, 2, -3, -46, 274,
+    -915, 2332, -5317, 15164, 24648, -4331, 1118, -81, -169, 136, -57, 12,
+    2, -3, -45, 271, -912, 2330, -5325, 15246, 24589, -4356, 1135, -90,
+    -164, 134, -56, 12, 2, -3, -44, 269, -909, 2328, -5332, 15327,
+    24530, -4381, 1151, -99, -160, 132, -56, 12, 2, -3, -43, 267,
+    -905, 2326, -5340, 15409, 24471, -4405, 1168, -109, -156, 130, -55, 12,
+    2, -4, -42, 265, -902, 2324, -5347, 15490, 24411, -4430, 1184, -118,
+    -151, 129, -55, 11, 2, -4, -41, 263, -899, 2322, -5354, 15572,
+    24350, -4454, 1200, -127, -147, 127, -54, 11, 2, -4, -40, 260,
+    -895, 2319, -5361, 15653, 24290, -4477, 1216, -136, -142, 125, -54, 11,
+    3, -5, -39, 258, -892, 2316, -5368, 15735, 24229, -4500, 1232, -145,
+    -138, 124, -53, 11, 3, -5, -38, 256, -888, 2314, -5374, 15816,
+    24168, -4523, 1248, -154, -134, 122, -53, 11, 3, -5, -37, 253,
+    -885, 2311, -5381, 15897, 24107, -4546, 1264, -163, -129, 121, -52, 11,
+    3, -6, -36, 251, -881, 2308, -5387, 15979, 24045, -4569, 1280, -172,
+    -125, 119, -52, 11, 3, -6, -35, 249, -877, 2305, -5393, 16060,
+    23984, -4591, 1295, -181, -121, 117, -51, 11, 3, -6, -34, 246,
+    -874, 2302, -5398, 16141, 23922, -4612, 1311, -190, -117, 116, -51, 11,
+    3, -7, -33, 244, -870, 2298, -5404, 16222, 23859, -4634, 1326, -199,
+    -112, 114, -50, 11, 3, -7, -32, 242, -866, 2295, -5409, 16303,
+    23797, -4655, 1341, -208, -108, 112, -50, 11, 3, -7, -30, 239,
+    -862, 2291, -5414, 16383, 23734, -4676, 1356, -217, -104, 111, -49, 10,
+    3, -8, -29, 237, -858, 2288, -5419, 16464, 23670, -4697, 1371, -225,
+    -100, 109, -49, 10, 3, -8, -28, 234, -854, 2284, -5423, 16545,
+    23607, -4717, 1386, -234, -95, 107, -49, 10, 3, -8, -27, 232,
+    -850, 2280, -5428, 16625, 23543, -4738, 1401, -243, -91, 106, -48, 10,
+    3, -9, -26, 229, -846, 2276, -5432, 16706, 23479, -4757, 1416, -251,
+    -87, 104, -48, 10, 3, -9, -25, 226, -842, 2272, -5436, 16786,
+    23415, -4777, 1430, -260, -83, 102, -47, 10, 3, -10, -24, 224,
+    -837, 2268, -5439, 16867, 23350, -4796, 1445, -269, -79, 101, -47, 10,
+    3, -10, -23, 221, -833, 2264, -5443, 16947, 23286, -4815, 1459, -277,
+    -74, 99, -46, 10, 3, -10, -21, 219, -829, 2259, -5446, 17027,
+    23221, -4834, 1474, -286, -70, 98, -46, 10, 4, -11, -20, 216,
+    -825, 2255, -5449, 17107, 23155, -4852, 1488, -294, -66, 96, -45, 10,
+    4, -11, -19, 213, -820, 2250, -5452, 17187, 23090, -4870, 1502, -302,
+    -62, 94, -45, 10, 4, -11, -18, 211, -816, 2245, -5454, 17267,
+    23024, -4888, 1516, -311, -58, 93, -44, 10, 4, -12, -17, 208,
+    -811, 2240, -5457, 17347, 22958, -4906, 1529, -319, -54, 91, -44, 9,
+    4, -12, -15, 205, -807, 2235, -5459, 17426, 22892, -4923, 1543, -327,
+    -50, 90, -43, 9, 4, -12, -14, 203, -802, 2230, -5461, 17506,
+    22825, -4940, 1557, -336, -46, 88, -43, 9, 4, -13, -13, 200,
+    -797, 2225, -5462, 17585, 22758, -4957, 1570, -344, -42, 86, -42, 9,
+    4, -13, -12, 197, -792, 2220, -5464, 17664, 22691, -4973, 1584, -352,
+    -38, 85, -42, 9, 4, -13, -11, 194, -788, 2214, -5465, 17744,
+    22624, -4989, 1597, -360, -34, 83, -41, 9, 4, -14, -9, 191,
+    -783, 2209, -5466, 17823, 22557, -5005, 1610, -368, -30, 82, -41, 9,
+    4, -14, -8, 188, -778, 2203, -5467, 17902, 22489, -5021, 1623, -376,
+    -26, 80, -41, 9, 4, -15, -7, 186, -773, 2197, -5467, 17980,
+    22421, -5036, 1636, -384, -22, 78, -40, 9, 4, -15, -6, 183,
+    -768, 2191, -5467, 18059, 22353, -5051, 1649, -392, -18, 77, -40, 9,
+    4, -15, -4, 180, -763, 2185, -5467, 18138, 22284, -5066, 1661, -400,
+    -14, 75, -39, 9, 4, -16, -3, 177, -758, 2179, -5467, 18216,
+    22216, -5080, 1674, -407, -10, 74, -39, 9, 4, -16, -2, 174,
+    -753, 2173, -5467, 18295, 22147, -5095, 1686, -415, -6, 72, -38, 8,
+    5, -17, -1, 171, -748, 2167, -5466, 18373, 22078, -5109, 1699, -423,
+    -2, 71, -38, 8, 5, -17, 1, 168, -742, 2160, -5465, 18451,
+    22008, -5122, 1711, -431, 2, 69, -37, 8, 5, -17, 2, 165,
+    -737, 2153, -5464, 18529, 21939, -5136, 1723, -438, 6, 67, -37, 8,
+    5, -18, 3, 162, -732, 2147, -5463, 18607, 21869, -5149, 1735, -446,
+    10, 66, -36, 8, 5, -18, 5, 159, -726, 2140, -5461, 18684,
+    21799, -5161, 1747, -453, 14, 64, -36, 8, 5, -18, 6, 156,
+    -721, 2133, -5459, 18762, 21729, -5174, 1759, -461, 17, 63, -36, 8,
+    5, -19, 7, 153, -715, 2126, -5457, 18839, 21658, -5186, 1770, -468,
+    21, 61, -35, 8, 5, -19, 8, 150, -710, 2119, -5454, 18917,
+    21587, -5198, 1782, -476, 25, 60, -35, 8, 5, -20, 10, 146,
+    -704, 2111, -5452, 18994, 21517, -5210, 1793, -483, 29, 58, -34, 8,
+    5, -20, 11, 143, -698, 2104, -5449, 19071, 21445, -5221, 1804, -490,
+    32, 57, -34, 8, 5, -20, 12, 140, -693, 2096, -5446, 19148,
+    21374, -5233, 1816, -498, 36, 55, -33, 8, 5, -21, 14, 137,
+    -687, 2089, -5442, 19224, 21303, -5244, 1827, -505, 40, 54, -33, 7,
+    5, -21, 15, 134, -681, 2081, -5439, 19301, 21231, -5254, 1838, -512,
+    44, 52, -32, 7, 5, -22, 16, 130, -675, 2073, -5435, 19377,
+    21159, -5265, 1848, -519, 47, 51, -32, 7, 6, -22, 18, 127,
+    -669, 2065, -5431, 19453, 21087, -5275, 1859, -526, 51, 49, -32, 7,
+    6, -23, 19, 124, -663, 2057, -5426, 19529, 21015, -5285, 1870, -533,
+    55, 48, -31, 7, 6, -23, 21, 121, -657, 2049, -5422, 19605,
+    20942, -5294, 1880, -540, 58, 46, -31, 7, 6, -23, 22, 117,
+    -651, 2040, -5417, 19681, 20869, -5303, 1891, -547, 62, 45, -30, 7,
+    6, -24, 23, 114, -645, 2032, -5412, 19757, 20797, -5313, 1901, -554,
+    65, 43, -30, 7, 6, -24, 25, 111, -639, 2023, -5406, 19832,
+    20723, -5321, 1911, -561, 69, 42, -29, 7, 6, -25, 26, 107,
+    -633, 2015, -5401, 19907, 20650, -5330, 1921, -568, 73, 40, -29, 7,
+    6, -25, 28, 104, -626, 2006, -5395, 19982, 20577, -5338, 1931, -574,
+    76, 39, -28, 7, 6, -25, 29, 101, -620, 1997, -5389, 20057,
+    20503, -5346, 1941, -581, 80, 38, -28, 7, 6, -26, 30, 97,
+    -614, 1988, -5382, 20132, 20429, -5354, 1950, -588, 83, 36, -28, 6,
+    6, -26, 32, 94, -607, 1978, -5375, 20207, 20355, -5361, 1960, -594,
+    87, 35, -27, 6, 6, -27, 33, 90, -601, 1969, -5368, 20281,
+    20281, -5368, 1969, -601, 90, 33, -27, 6, 6, -27, 35, 87,
+    -594, 1960, -5361, 20355, 20207, -5375, 1978, -607, 94, 32, -26, 6,
+    6, -28, 36, 83, -588, 1950, -5354, 20429, 20132, -5382, 1988, -614,
+    97, 30, -26, 6, 7, -28, 38, 80, -581, 1941, -5346, 20503,
+    20057, -5389, 1997, -620, 101, 29, -25, 6, 7, -28, 39, 76,
+    -574, 1931, -5338, 20577, 19982, -5395, 2006, -626, 104, 28, -25, 6,
+    7, -29, 40, 73, -568, 1921, -5330, 20650, 19907, -5401, 2015, -633,
+    107, 26, -25, 6, 7, -29, 42, 69, -561, 1911, -5321, 20723,
+    19832, -5406, 2023, -639, 111, 25, -24, 6, 7, -30, 43, 65,
+    -554, 1901, -5313, 20797, 19757, -5412, 2032, -645, 114, 23, -24, 6,
+    7, -30, 45, 62, -547, 1891, -5303, 20869, 19681, -5417, 2040, -651,
+    117, 22, -23, 6, 7, -31, 46, 58, -540, 1880, -5294, 20942,
+    19605, -5422, 2049, -657, 121, 21, -23, 6, 7, -31, 48, 55,
+    -533, 1870, -5285, 21015, 19529, -5426, 2057, -663, 124, 19, -23, 6,
+    7, -32, 49, 51, -526, 1859, -5275, 21087, 19453, -5431, 2065, -669,
+    127, 18, -22, 6, 7, -32, 51, 47, -519, 1848, -5265, 21159,
+    19377, -5435, 2073, -675, 130, 16, -22, 5, 7, -32, 52, 44,
+    -512, 1838, -5254, 21231, 19301, -5439, 2081, -681, 134, 15, -21, 5,
+    7, -33, 54, 40, -505, 1827, -5244, 21303, 19224, -5442, 2089, -687,
+    137, 14, -21, 5, 8, -33, 55, 36, -498, 1816, -5233, 21374,
+    19148, -5446, 2096, -693, 140, 12, -20, 5, 8, -34, 57, 32,
+    -490, 1804, -5221, 21445, 19071, -5449, 2104, -698, 143, 11, -20, 5,
+    8, -34, 58, 29, -483, 1793, -5210, 21517, 18994, -5452, 2111, -704,
+    146, 10, -20, 5, 8, -35, 60, 25, -476, 1782, -5198, 21587,
+    18917, -5454, 2119, -710, 150, 8, -19, 5, 8, -35, 61, 21,
+    -468, 1770, -5186, 21658, 18839, -5457, 2126, -715, 153, 7, -19, 5,
+    8, -36, 63, 17, -461, 1759, -5174, 21729, 18762, -5459, 2133, -721,
+    156, 6, -18, 5, 8, -36, 64, 14, -453, 1747, -5161, 21799,
+    18684, -5461, 2140, -726, 159, 5, -18, 5, 8, -36, 66, 10,
+    -446, 1735, -5149, 21869, 18607, -5463, 2147, -732, 162, 3, -18, 5,
+    8, -37, 67, 6, -438, 1723, -5136, 21939, 18529, -5464, 2153, -737,
+    165, 2, -17, 5, 8, -37, 69, 2, -431, 1711, -5122, 22008,
+    18451, -5465, 2160, -742, 168, 1, -17, 5, 8, -38, 71, -2,
+    -423, 1699, -5109, 22078, 18373, -5466, 2167, -748, 171, -1, -17, 5,
+    8, -38, 72, -6, -415, 1686, -5095, 22147, 18295, -5467, 2173, -753,
+    174, -2, -16, 4, 9, -39, 74, -10, -407, 1674, -5080, 22216,
+    18216, -5467, 2179, -758, 177, -3, -16, 4, 9, -39, 75, -14,
+    -400, 1661, -5066, 22284, 18138, -5467, 2185, -763, 180, -4, -15, 4,
+    9, -40, 77, -18, -392, 1649, -5051, 22353, 18059, -5467, 2191, -768,
+    183, -6, -15, 4, 9, -40, 78, -22, -384, 1636, -5036, 22421,
+    17980, -5467, 2197, -773, 186, -7, -15, 4, 9, -41, 80, -26,
+    -376, 1623, -5021, 22489, 17902, -5467, 2203, -778, 188, -8, -14, 4,
+    9, -41, 82, -30, -368, 1610, -5005, 22557, 17823, -5466, 2209, -783,
+    191, -9, -14, 4, 9, -41, 83, -34, -360, 1597, -4989, 22624,
+    17744, -5465, 2214, -788, 194, -11, -13, 4, 9, -42, 85, -38,
+    -352, 1584, -4973, 22691, 17664, -5464, 2220, -792, 197, -12, -13, 4,
+    9, -42, 86, -42, -344, 1570, -4957, 22758, 17585, -5462, 2225, -797,
+    200, -13, -13, 4, 9, -43, 88, -46, -336, 1557, -4940, 22825,
+    17506, -5461, 2230, -802, 203, -14, -12, 4, 9, -43, 90, -50,
+    -327, 1543, -4923, 22892, 17426, -5459, 2235, -807, 205, -15, -12, 4,
+    9, -44, 91, -54, -319, 1529, -4906, 22958, 17347, -5457, 2240, -811,
+    208, -17, -12, 4, 10, -44, 93, -58, -311, 1516, -4888, 23024,
+    17267, -5454, 2245, -816, 211, -18, -11, 4, 10, -45, 94, -62,
+    -302, 1502, -4870, 23090, 17187, -5452, 2250, -820, 213, -19, -11, 4,
+    10, -45, 96, -66, -294, 1488, -4852, 23155, 17107, -5449, 2255, -825,
+    216, -20, -11, 4, 10, -46, 98, -70, -286, 1474, -4834, 23221,
+    17027, -5446, 2259, -829, 219, -21, -10, 3, 10, -46, 99, -74,
+    -277, 1459, -4815, 23286, 16947, -5443, 2264, -833, 221, -23, -10, 3,
+    10, -47, 101, -79, -269, 1445, -4796, 23350, 16867, -5439, 2268, -837,
+    224, -24, -10, 3, 10, -47, 102, -83, -260, 1430, -4777, 23415,
+    16786, -5436, 2272, -842, 226, -25, -9, 3, 10, -48, 104, -87,
+    -251, 1416, -4757, 23479, 16706, -5432, 2276, -846, 229, -26, -9, 3,
+    10, -48, 106, -91, -243, 1401, -4738, 23543, 16625, -5428, 2280, -850,
+    232, -27, -8, 3, 10, -49, 107, -95, -234, 1386, -4717, 23607,
+    16545, -5423, 2284, -854, 234, -28, -8, 3, 10, -49, 109, -100,
+    -225, 1371, -4697, 23670, 16464, -5419, 2288, -858, 237, -29, -8, 3,
+    10, -49, 111, -104, -217, 1356, -4676, 23734, 16383, -5414, 2291, -862,
+    239, -30, -7, 3, 11, -50, 112, -108, -208, 1341, -4655, 23797,
+    16303, -5409, 2295, -866, 242, -32, -7, 3, 11, -50, 114, -112,
+    -199, 1326, -4634, 23859, 16222, -5404, 2298, -870, 244, -33, -7, 3,
+    11, -51, 116, -117, -190, 1311, -4612, 23922, 16141, -5398, 2302, -874,
+    246, -34, -6, 3, 11, -51, 117, -121, -181, 1295, -4591, 23984,
+    16060, -5393, 2305, -877, 249, -35, -6, 3, 11, -52, 119, -125,
+    -172, 1280, -4569, 24045, 15979, -5387, 2308, -881, 251, -36, -6, 3,
+    11, -52, 121, -129, -163, 1264, -4546, 24107, 15897, -5381, 2311, -885,
+    253, -37, -5, 3, 11, -53, 122, -134, -154, 1248, -4523, 24168,
+    15816, -5374, 2314, -888, 256, -38, -5, 3, 11, -53, 124, -138,
+    -145, 1232, -4500, 24229, 15735, -5368, 2316, -892, 258, -39, -5, 3,
+    11, -54, 125, -142, -136, 1216, -4477, 24290, 15653, -5361, 2319, -895,
+    260, -40, -4, 2, 11, -54, 127, -147, -127, 1200, -4454, 24350,
+    15572, -5354, 2322, -899, 263, -41, -4, 2, 11, -55, 129, -151,
+    -118, 1184, -4430, 24411, 15490, -5347, 2324, -902, 265, -42, -4, 2,
+    12, -55, 130, -156, -109, 1168, -4405, 24471, 15409, -5340, 2326, -905,
+    267, -43, -3, 2, 12, -56, 132, -160, -99, 1151, -4381, 24530,
+    15327, -5332, 2328, -909, 269, -44, -3, 2, 12, -56, 134, -164,
+    -90, 1135, -4356, 24589, 15246, -5325, 2330, -912, 271, -45, -3, 2,
+    12, -57, 136, -169, -81, 1118, -4331, 24648, 15164, -5317, 2332, -915,
+    274, -46, -3, 2, 12, -57, 137, -173, -71, 1101, -4306, 24707,
+    15082, -5309, 2334, -918, 276, -47, -2, 2, 12, -58, 139, -178,
+    -62, 1084, -4280, 24765, 15000, -5300, 2336, -921, 278, -48, -2, 2,
+    12, -58, 141, -182, -53, 1067, -4254, 24824, 14918, -5292, 2338, -924,
+    280, -49, -2, 2, 12, -59, 142, -186, -43, 1050, -4228, 24881,
+    14836, -5283, 2339, -927, 282, -50, -1, 2, 12, -59, 144, -191,
+    -34, 1033, -4202, 24939, 14754, -5274, 2341, -930, 284, -51, -1, 2,
+    12, -59, 146, -195, -24, 1016, -4175, 24996, 14672, -5265, 2342, -933,
+    286, -52, -1, 2, 12, -60, 147, -200, -14, 999, -4148, 25053,
+    14590, -5256, 2343, -936, 288, -53, 0, 2, 13, -60, 149, -204,
+    -5, 981, -4120, 25110, 14508, -5246, 2344, -938, 290, -54, 0, 2,
+    13, -61, 151, -209, 5, 964, -4093, 25166, 14426, -5237, 2345, -941,
+    292, -55, 0, 2, 13, -61, 152, -213, 14, 946, -4065, 25222,
+    14344, -5227, 2346, -944, 294, -56, 0, 2, 13, -62, 154, -218,
+    24, 928, -4037, 25278, 14262, -5217, 2347, -946, 296, -57, 1, 2,
+    13, -62, 156, -222, 34, 910, -4008, 25333, 14180, -5206, 2348, -949,
+    298, -58, 1, 2, 13, -63, 157, -227, 44, 892, -3979, 25388,
+    14097, -5196, 2348, -951, 300, -58, 1, 2, 13, -63, 159, -231,
+    54, 874, -3950, 25443, 14015, -5185, 2349, -954, 301, -59, 2, 2,
+    13, -64, 161, -236, 63, 856, -3921, 25497, 13933, -5175, 2349, -956,
+    303, -60, 2, 1, 13, -64, 162, -240, 73, 838, -3891, 25551,
+    13850, -5164, 2349, -958, 305, -61, 2, 1, 13, -65, 164, -245,
+    83, 819, -3861, 25605, 13768, -5152, 2349, -961, 307, -62, 2, 1,
+    13, -65, 166, -249, 93, 801, -3831, 25659, 13686, -5141, 2350, -963,
+    309, -63, 3, 1, 14, -66, 168, -254, 103, 782, -3800, 25712,
+    13603, -5129, 2349, -965, 310, -64, 3, 1, 14, -66, 169, -259,
+    113, 764, -3769, 25765, 13521, -5118, 2349, -967, 312, -64, 3, 1,
+    14, -67, 171, -263, 123, 745, -3738, 25817, 13439, -5106, 2349, -969,
+    314, -65, 3, 1, 14, -67, 173, -268, 133, 726, -3706, 25869,
+    13356, -5094, 2349, -971, 315, -66, 4, 1, 14, -68, 174, -272,
+    143, 707, -3675, 25921, 13274, -5081, 2348, -973, 317, -67, 4, 1,
+    14, -68, 176, -277, 153, 688, -3643, 25973, 13191, -5069, 2348, -975,
+    319, -68, 4, 1, 14, -68, 178, -282, 163, 669, -3610, 26024,
+    13109, -5056, 2347, -977, 320, -69, 5, 1, 14, -69, 179, -286,
+    173, 650, -3577, 26075, 13027, -5044, 2346, -979, 322, -69, 5, 1,
+    14, -69, 181, -291, 184, 631, -3545, 26126, 12944, -5031, 2345, -981,
+    323, -70, 5, 1, 14, -70, 183, -295, 194, 611, -3511, 26176,
+    12862, -5018, 2344, -982, 325, -71, 5, 1, 14, -70, 184, -300,
+    204, 592, -3478, 26226, 12779, -5004, 2343, -984, 326, -72, 6, 1,
+    14, -71, 186, -305, 214, 572, -3444, 26275, 12697, -4991, 2342, -986,
+    328, -73, 6, 1, 15, -71, 188, -309, 225, 552, -3410, 26325,
+    12615, -4977, 2341, -987, 329, -73, 6, 1, 15, -72, 189, -314,
+    235, 533, -3375, 26373, 12532, -4963, 2340, -989, 331, -74, 6, 1,
+    15, -72, 191, -318, 245, 513, -3341, 26422, 12450, -4949, 2338, -990,
+    332, -75, 7, 1, 15, -73, 193, -323, 256, 493, -3306, 26470,
+    12368, -4935, 2337, -992, 334, -75, 7, 1, 15, -73, 195, -328,
+    266, 473, -3270, 26518, 12285, -4921, 2335, -993, 335, -76, 7, 1,
+    15, -74, 196, -332, 276, 453, -3235, 26566, 12203, -4907, 2333, -994,
+    337, -77, 7, 1, 15, -74, 198, -337, 287, 433, -3199, 26613,
+    12121, -4892, 2331, -996, 338, -78, 7, 1, 15, -75, 200, -342,
+    297, 412, -3163, 26660, 12038, -4877, 2329, -997, 339, -78, 8, 1,
+    15, -75, 201, -346, 308, 392, -3126, 26706, 11956, -4862, 2327, -998,
+    341, -79, 8, 1, 15, -75, 203, -351, 318, 371, -3089, 26752,
+    11874, -4847, 2325, -999, 342, -80, 8, 1, 15, -76, 205, -356,
+    329, 351, -3052, 26798, 11792, -4832, 2323, -1000, 343, -80, 8, 0,
+    16, -76, 206, -360, 339, 330, -3015, 26844, 11710, -4817, 2321, -1001,
+    344, -81, 9, 0, 16, -77, 208, -365, 350, 309, -2977, 26889,
+    11628, -4801, 2318, -1002, 346, -82, 9, 0, 16, -77, 210, -370,
+    361, 289, -2939, 26933, 11545, -4785, 2316, -1003, 347, -82, 9, 0,
+    16, -78, 211, -374, 371, 268, -2901, 26978, 11463, -4769, 2313, -1004,
+    348, -83, 9, 0, 16, -78, 213, -379, 382, 247, -2862, 27022,
+    11381, -4754, 2310, -1005, 349, -84, 9, 0, 16, -79, 215, -384,
+    392, 226, -2824, 27065, 11299, -4737, 2308, -1006, 350, -84, 10, 0,
+    16, -79, 216, -388, 403, 205, -2785, 27109, 11217, -4721, 2305, -1007,
+    351, -85, 10, 0, 16, -79, 218, -393, 414, 183, -2745, 27152,
+    11136, -4705, 2302, -1007, 352, -86, 10, 0, 16, -80, 220, -398,
+    425, 162, -2705, 27194, 11054, -4688, 2299, -1008, 353, -86, 10, 0,
+    16, -80, 221, -402, 435, 141, -2665, 27237, 10972, -4671, 2296, -1008,
+    355, -87, 10, 0, 16, -81, 223, -407, 446, 119, -2625, 27278,
+    10890, -4654, 2292, -1009, 356, -87, 11, 0, 16, -81, 225, -412,
+    457, 98, -2585, 27320, 10808, -4637, 2289, -1010, 357, -88, 11, 0,
+    16, -82, 226, -416, 467, 76, -2544, 27361, 10727, -4620, 2286, -1010,
+    358, -89, 11, 0, 17, -82, 228, -421, 478, 55, -2503, 27402,
+    10645, -4603, 2282, -1010, 358, -89, 11, 0, 17, -83, 229, -426,
+    489, 33, -2461, 27442, 10564, -4586, 2278, -1011, 359, -90, 11, 0,
+    17, -83, 231, -430, 500, 11, -2419, 27482, 10482, -4568, 2275, -1011,
+    360, -90, 12, 0, 17, -83, 233, -435, 511, -11, -2377, 27522,
+    10401, -4550, 2271, -1011, 361, -91, 12, 0, 17, -84, 234, -440,
+    522, -33, -2335, 27561, 10319, -4533, 2267, -1012, 362, -91, 12, 0,
+    17, -84, 236, -444, 532, -55, -2292, 27600, 10238, -4515, 2263, -1012,
+    363, -92, 12, 0, 17, -85, 238, -449, 543, -77, -2250, 27639,
+    10157, -4496, 2259, -1012, 364, -92, 12, 0, 17, -85, 239, -453,
+    554, -99, -2206, 27677, 10076, -4478, 2255, -1012, 365, -93, 13, 0,
+    17, -86, 241, -458, 565, -122, -2163, 27715, 9995, -4460, 2251, -1012,
+    365, -94, 13, 0, 17, -86, 242, -463, 576, -144, -2119, 27752,
+    9914, -4441, 2247, -1012, 366, -94, 13, 0, 17, -86, 244, -467,
+    587, -166, -2075, 27789, 9833, -4423, 2242, -1012, 367, -95, 13, 0,
+    17, -87, 246, -472, 598, -189, -2031, 27826, 9752, -4404, 2238, -1012,
+    368, -95, 13, 0, 17, -87, 247, -477, 609, -211, -1986, 27862,
+    9671, -4385, 2233, -1012, 368, -96, 13, 0, 18, -88, 249, -481,
+    620, -234, -1941, 27898, 9590, -4366, 2229, -1012, 369, -96, 14, 0,
+    18, -88, 250, -486, 631, -257, -1896, 27934, 9510, -4347, 2224, -1011,
+    370, -96, 14, 0, 18, -88, 252, -491, 642, -279, -1851, 27969,
+    9429, -4328, 2219, -1011, 371, -97, 14, 0, 18, -89, 254, -495,
+    653, -302, -1805, 28004, 9349, -4309, 2214, -1011, 371, -97, 14, 0,
+    18, -89, 255, -500, 664, -325, -1759, 28038, 9268, -4289, 2209, -1010,
+    372, -98, 14, 0, 18, -90, 257, -504, 675, -348, -1712, 28072,
+    9188, -4270, 2204, -1010, 372, -98, 14, 0, 18, -90, 258, -509,
+    686, -371, -1666, 28106, 9108, -4250, 2199, -1009, 373, -99, 15, 0,
+    18, -90, 260, -514, 697, -394, -1619, 28139, 9028, -4230, 2194, -1009,
+    373, -99, 15, 0, 18, -91, 261, -518, 708, -417, -1572, 28172,
+    8948, -4210, 2189, -1008, 374, -100, 15, 0, 18, -91, 263, -523,
+    719, -440, -1524, 28205, 8868, -4190, 2183, -1008, 375, -100, 15, 0,
+    18, -92, 264, -527, 730, -463, -1477, 28237, 8788, -4170, 2178, -1007,
+    375, -100, 15, 0, 18, -92, 266, -532, 741, -487, -1429, 28268,
+    8708, -4150, 2172, -1007, 376, -101, 15, 0, 18, -92, 267, -536,
+    752, -510, -1380, 28300, 8628, -4129, 2167, -1006, 376, -101, 15, 0,
+    18, -93, 269, -541, 763, -533, -1332, 28331, 8549, -4109, 2161, -1005,
+    376, -102, 16, -1, 19, -93, 271, -546, 774, -557, -1283, 28361,
+    8469, -4088, 2155, -1004, 377, -102, 16, -1, 19, -93, 272, -550,
+    785, -580, -1234, 28391, 8390, -4068, 2149, -1003, 377, -102, 16, -1,
+    19, -94, 274, -555, 796, -604, -1184, 28421, 8311, -4047, 2144, -1003,
+    378, -103, 16, -1, 19, -94, 275, -559, 807, -628, -1135, 28450,
+    8232, -4026, 2138, -1002, 378, -103, 16, -1, 19, -95, 277, -564,
+    818, -651, -1085, 28479, 8153, -4005, 2132, -1001, 378, -103, 16, -1,
+    19, -95, 278, -568, 829, -675, -1034, 28508, 8074, -3984, 2125, -1000,
+    379, -104, 16, -1, 19, -95, 280, -573, 840, -699, -984, 28536,
+    7995, -3963, 2119, -999, 379, -104, 17, -1, 19, -96, 281, -577,
+    851, -723, -933, 28564, 7916, -3942, 2113, -998, 379, -104, 17, -1,
+    19, -96, 282, -582, 862, -746, -882, 28591, 7838, -3920, 2107, -996,
+    380, -105, 17, -1, 19, -96, 284, -586, 874, -770, -831, 28618,
+    7759, -3899, 2100, -995, 380, -105, 17, -1, 19, -97, 285, -591,
+    885, -794, -779, 28645, 7681, -3877, 2094, -994, 380, -105, 17, -1,
+    19, -97, 287, -595, 896, -818, -727, 28671, 7603, -3856, 2087, -993,
+    380, -106, 17, -1, 19, -97, 288, -600, 907, -842, -675, 28697,
+    7525, -3834, 2081, -991, 380, -106, 17, -1, 19, -98, 290, -604,
+    918, -866, -622, 28722, 7447, -3812, 2074, -990, 381, -106, 17, -1,
+    19, -98, 291, -608, 929, -891, -570, 28747, 7369, -3790, 2067, -989,
+    381, -106, 17, -1, 19, -98, 293, -613, 940, -915, -517, 28772,
+    7291, -3768, 2060, -987, 381, -107, 18, -1, 19, -99, 294, -617,
+    951, -939, -463, 28796, 7214, -3746, 2054, -986, 381, -107, 18, -1,
+    20, -99, 295, -622, 962, -963, -410, 28820, 7136, -3724, 2047, -984,
+    381, -107, 18, -1, 20, -99, 297, -626, 973, -988, -356, 28843,
+    7059, -3702, 2040, -983, 381, -108, 18, -1, 20, -100, 298, -630,
+    984, -1012, -302, 28866, 6982, -3679, 2032, -981, 381, -108, 18, -1,
+    20, -100, 300, -635, 995, -1036, -248, 28888, 6905, -3657, 2025, -980,
+    381, -108, 18, -1, 20, -100, 301, -639, 1006, -1061, -193, 28911,
+    6828, -3634, 2018, -978, 381, -108, 18, -1, 20, -101, 302, -643,
+    1017, -1085, -138, 28932, 6751, -3612, 2011, -976, 381, -108, 18, -1,
+    20, -101, 304, -648, 1028, -1110, -83, 28954, 6675, -3589, 2003, -975,
+    381, -109, 18, -1, 20, -101, 305, -652, 1039, -1134, -28, 28975,
+    6598, -3566, 1996, -973, 381, -109, 18, -1, 20, -102, 306, -656,
+    1050, -1159, 28, 28995, 6522, -3544, 1989, -971, 381, -109, 19, -1,
+    20, -102, 308, -661, 1061, -1184, 84, 29015, 6446, -3521, 1981, -969,
+    381, -109, 19, -1, 20, -102, 309, -665, 1072, -1208, 140, 29035,
+    6370, -3498, 1973, -967, 381, -109, 19, -1, 20, -103, 310, -669,
+    1083, -1233, 196, 29054, 6294, -3475, 1966, -965, 381, -110, 19, -1,
+    20, -103, 312, -673, 1094, -1258, 253, 29073, 6218, -3452, 1958, -964,
+    381, -110, 19, -1, 20, -103, 313, -678, 1105, -1282, 310, 29091,
+    6143, -3429, 1950, -962, 381, -110, 19, -1, 20, -103, 314, -682,
+    1116, -1307, 367, 29109, 6067, -3405, 1942, -960, 381, -110, 19, -1,
+    20, -104, 315, -686, 1127, -1332, 425, 29127, 5992, -3382, 1935, -958,
+    380, -110, 19, -1, 20, -104, 317, -690, 1138, -1357, 482, 29144,
+    5917, -3359, 1927, -955, 380, -110, 19, -1, 20, -104, 318, -694,
+    1148, -1381, 540, 29161, 5842, -3335, 1919, -953, 380, -111, 19, -1,
+    20, -104, 319, -699, 1159, -1406, 599, 29177, 5767, -3312, 1911, -951,
+    380, -111, 19, -1, 20, -105, 321, -703, 1170, -1431, 657, 29193,
+    5693, -3288, 1902, -949, 380, -111, 19, -1, 20, -105, 322, -707,
+    1181, -1456, 716, 29209, 5618, -3265, 1894, -947, 379, -111, 19, -1,
+    20, -105, 323, -711, 1192, -1481, 775, 29224, 5544, -3241, 1886, -944,
+    379, -111, 20, -1, 20, -105, 324, -715, 1203, -1506, 834, 29239,
+    5470, -3217, 1878, -942, 379, -111, 20, -1, 21, -106, 325, -719,
+    1213, -1531, 894, 29253, 5396, -3193, 1869, -940, 378, -111, 20, -1,
+    21, -106, 327, -723, 1224, -1556, 953, 29267, 5322, -3170, 1861, -937,
+    378, -111, 20, -1, 21, -106, 328, -727, 1235, -1581, 1013, 29281,
+    5248, -3146, 1852, -935, 378, -112, 20, -1, 21, -106, 329, -731,
+    1246, -1606, 1074, 29294, 5175, -3122, 1844, -933, 377, -112, 20, -1,
+    21, -107, 330, -735, 1256, -1631, 1134, 29306, 5102, -3098, 1835, -930,
+    377, -112, 20, -1, 21, -107, 331, -739, 1267, -1656, 1195, 29318,
+    5029, -3074, 1827, -928, 377, -112, 20, -1, 21, -107, 332, -743,
+    1278, -1681, 1256, 29330, 4956, -3050, 1818, -925, 376, -112, 20, -1,
+    21, -107, 334, -747, 1288, -1706, 1317, 29342, 4883, -3025, 1809, -923,
+    376, -112, 20, -1, 21, -108, 335, -751, 1299, -1731, 1379, 29353,
+    4810, -3001, 1801, -920, 375, -112, 20, -1, 21, -108, 336, -755,
+    1310, -1756, 1440, 29363, 4738, -2977, 1792, -917, 375, -112, 20, -1,
+    21, -108, 337, -759, 1320, -1782, 1502, 29373, 4666, -2953, 1783, -915,
+    375, -112, 20, -1, 21, -108, 338, -763, 1331, -1807, 1564, 29383,
+    4594, -2928, 1774, -912, 374, -112, 20, -1, 21, -108, 339, -766,
+    1341, -1832, 1627, 29392, 4522, -2904, 1765, -909, 374, -112, 20, -1,
+    21, -109, 340, -770, 1352, -1857, 1690, 29401, 4450, -2880, 1756, -907,
+    373, -112, 20, -1, 21, -109, 341, -774, 1362, -1882, 1752, 29410,
+    4379, -2855, 1747, -904, 373, -112, 20, -1, 21, -109, 342, -778,
+    1373, -1907, 1816, 29418, 4308, -2831, 1738, -901, 372, -112, 20, -1,
+    21, -109, 343, -782, 1383, -1932, 1879, 29425, 4237, -2806, 1729, -898,
+    371, -112, 20, -1, 21, -109, 344, -785, 1394, -1958, 1943, 29432,
+    4166, -2782, 1719, -895, 371, -112, 21, -1, 21, -109, 345, -789,
+    1404, -1983, 2006, 29439, 4095, -2757, 1710, -892, 370, -112, 21, -1,
+    21, -110, 346, -793, 1414, -2008, 2070, 29445, 4025, -2732, 1701, -889,
+    370, -112, 21, -1, 21, -110, 347, -797, 1425, -2033, 2135, 29451,
+    3954, -2708, 1691, -887, 369, -112, 21, -1, 21, -110, 348, -800,
+    1435, -2058, 2199, 29457, 3884, -2683, 1682, -884, 368, -112, 21, -1,
+    21, -110, 349, -804, 1445, -2083, 2264, 29462, 3814, -2658, 1673, -881,
+    368, -112, 21, -1, 21, -110, 350, -807, 1456, -2108, 2329, 29467,
+    3745, -2633, 1663, -877, 367, -112, 21, -1, 21, -110, 351, -811,
+    1466, -2134, 2394, 29471, 3675, -2609, 1654, -874, 366, -112, 21, -1,
+    21, -110, 352, -815, 1476, -2159, 2460, 29475, 3606, -2584, 1644, -871,
+    366, -112, 21, -1, 21, -111, 353, -818, 1486, -2184, 2525, 29478,
+    3537, -2559, 1635, -868, 365, -112, 21, -1, 21, -111, 354, -822,
+    1496, -2209, 2591, 29481, 3468, -2534, 1625, -865, 364, -112, 21, -1,
+    21, -111, 355, -825, 1506, -2234, 2657, 29483, 3399, -2509, 1615, -862,
+    364, -112, 21, -1, 21, -111, 356, -829, 1517, -2259, 2724, 29486,
+    3331, -2484, 1606, -859, 363, -112, 21, -1, 21, -111, 356, -832,
+    1527, -2284, 2790, 29487, 3262, -2459, 1596, -855, 362, -112, 21, -1,
+    21, -111, 357, -835, 1537, -2309, 2857, 29489, 3194, -2434, 1586, -852,
+    361, -112, 21, -1, 21, -111, 358, -839, 1547, -2334, 2924, 29489,
+    3126, -2409, 1576, -849, 361, -112, 21, -1, 21, -111, 359, -842,
+    1556, -2359, 2991, 29490, 3059, -2384, 1566, -846, 360, -111, 21, -1,
+};
+
+// L/M=441/160, 16 taps: 8000->22050, 16000->44100
+const int16_t kBank441x160x16[7056] = {
+    -1, 21, -111, 360, -846, 1566, -2384, 3059, 29490, 2991, -2359, 1556,
+    -842, 359, -111, 21, -1, 21, -112, 361, -849, 1576, -2409, 3126,
+    29489, 2924, -2334, 1547, -839, 358, -111, 21, -1, 21, -112, 361,
+    -852, 1586, -2434, 3194, 29489, 2857, -2309, 1537, -835, 357, -111, 21,
+    -1, 21, -112, 362, -855, 1596, -2459, 3262, 29487, 2790, -2284, 1527,
+    -832, 356, -111, 21, -1, 21, -112, 363, -859, 1606, -2484, 3331,
+    29486, 2724, -2259, 1517, -829, 356, -111, 21, -1, 21, -112, 364,
+    -862, 1615, -2509, 3399, 29483, 2657, -2234, 1506, -825, 355, -111, 21,
+    -1, 21, -112, 364, -865, 1625, -2534, 3468, 29481, 2591, -2209, 1496,
+    -822, 354, -111, 21, -1, 21, -112, 365, -868, 1635, -2559, 3537,
+    29478, 2525, -2184, 1486, -818, 353, -111, 21, -1, 21, -112, 366,
+    -871, 1644, -2584, 3606, 29475, 2460, -2159, 1476, -815, 352, -110, 21,
+    -1, 21, -112, 366, -874, 1654, -2609, 3675, 29471, 2394, -2134, 1466,
+    -811, 351, -110, 21, -1, 21, -112, 367, -877, 1663, -2633, 3745,
+    29467, 2329, -2108, 1456, -807, 350, -110, 21, -1, 21, -112, 368,
+    -881, 1673, -2658, 3814, 29462, 2264, -2083, 1445, -804, 349, -110, 21,
+    -1, 21, -112, 368, -884, 1682, -2683, 3884, 29457, 2199, -2058, 1435,
+    -800, 348, -110, 21, -1, 21, -112, 369, -887, 1691, -2708, 3954,
+    29451, 2135, -2033, 1425, -797, 347, -110, 21, -1, 21, -112, 370,
+    -889, 1701, -2732, 4025, 29445, 2070, -2008, 1414, -793, 346, -110, 21,
+    -1, 21, -112, 370, -892, 1710, -2757, 4095, 29439, 2006, -1983, 1404,
+    -789, 345, -109, 21, -1, 21, -112, 371, -895, 1719, -2782, 4166,
+    29432, 1943, -1958, 1394, -785, 344, -109, 21, -1, 20, -112, 371,
+    -898, 1729, -2806, 4237, 29425, 1879, -1932, 1383, -782, 343, -109, 21,
+    -1, 20, -112, 372, -901, 1738, -2831, 4308, 29418, 1816, -1907, 1373,
+    -778, 342, -109, 21, -1, 20, -112, 373, -904, 1747, -2855, 4379,
+    29410, 1752, -1882, 1362, -774, 341, -109, 21, -1, 20, -112, 373,
+    -907, 1756, -2880, 4450, 29401, 1690, -1857, 1352, -770, 340, -109, 21,
+    -1, 20, -112, 374, -909, 1765, -2904, 4522, 29392, 1627, -1832, 1341,
+    -766, 339, -108, 21, -1, 20, -112, 374, -912, 1774, -2928, 4594,
+    29383, 1564, -1807, 1331, -763, 338, -108, 21, -1, 20, -112, 375,
+    -915, 1783, -2953, 4666, 29373, 1502, -1782, 1320, -759, 337, -108, 21,
+    -1, 20, -112, 375, -917, 1792, -2977, 4738, 29363, 1440, -1756, 1310,
+    -755, 336, -108, 21, -1, 20, -112, 375, -920, 1801, -3001, 4810,
+    29353, 1379, -1731, 1299, -751, 335, -108, 21, -1, 20, -112, 376,
+    -923, 1809, -3025, 4883, 29342, 1317, -1706, 1288, -747, 334, -107, 21,
+    -1, 20, -112, 376, -925, 1818, -3050, 4956, 29330, 1256, -1681, 1278,
+    -743, 332, -107, 21, -1, 20, -112, 377, -928, 1827, -3074, 5029,
+    29318, 1195, -1656, 1267, -739, 331, -107, 21, -1, 20, -112, 377,
+    -930, 1835, -3098, 5102, 29306, 1134, -1631, 1256, -735, 330, -107, 21,
+    -1, 20, -112, 377, -933, 1844, -3122, 5175, 29294, 1074, -1606, 1246,
+    -731, 329, -106, 21, -1, 20, -112, 378, -935, 1852, -3146, 5248,
+    29281, 1013, -1581, 1235, -727, 328, -106, 21, -1, 20, -111, 378,
+    -937, 1861, -3170, 5322, 29267, 953, -1556, 1224, -723, 327, -106, 21,
+    -1, 20, -111, 378, -940, 1869, -3193, 5396, 29253, 894, -1531, 1213,
+    -719, 325, -106, 21, -1, 20, -111, 379, -942, 1878, -3217, 5470,
+    29239, 834, -1506, 1203, -715, 324, -105, 20, -1, 20, -111, 379,
+    -944, 1886, -3241, 5544, 29224, 775, -1481, 1192, -711, 323, -105, 20,
+    -1, 19, -111, 379, -947, 1894, -3265, 5618, 29209, 716, -1456, 1181,
+    -707, 322, -105, 20, -1, 19, -111, 380, -949, 1902, -3288, 5693,
+    29193, 657, -1431, 1170, -703, 321, -105, 20, -1, 19, -111, 380,
+    -951, 1911, -3312, 5767, 29177, 599, -1406, 1159, -699, 319, -104, 20,
+    -1, 19, -111, 380, -953, 1919, -3335, 5842, 29161, 540, -1381, 1148,
+    -694, 318, -104, 20, -1, 19, -110, 380, -955, 1927, -3359, 5917,
+    29144, 482, -1357, 1138, -690, 317, -104, 20, -1, 19, -110, 380,
+    -958, 1935, -3382, 5992, 29127, 425, -1332, 1127, -686, 315, -104, 20,
+    -1, 19, -110, 381, -960, 1942, -3405, 6067, 29109, 367, -1307, 1116,
+    -682, 314, -103, 20, -1, 19, -110, 381, -962, 1950, -3429, 6143,
+    29091, 310, -1282, 1105, -678, 313, -103, 20, -1, 19, -110, 381,
+    -964, 1958, -3452, 6218, 29073, 253, -1258, 1094, -673, 312, -103, 20,
+    -1, 19, -110, 381, -965, 1966, -3475, 6294, 29054, 196, -1233, 1083,
+    -669, 310, -103, 20, -1, 19, -109, 381, -967, 1973, -3498, 6370,
+    29035, 140, -1208, 1072, -665, 309, -102, 20, -1, 19, -109, 381,
+    -969, 1981, -3521, 6446, 29015, 84, -1184, 1061, -661, 308, -102, 20,
+    -1, 19, -109, 381, -971, 1989, -3544, 6522, 28995, 28, -1159, 1050,
+    -656, 306, -102, 20, -1, 18, -109, 381, -973, 1996, -3566, 6598,
+    28975, -28, -1134, 1039, -652, 305, -101, 20, -1, 18, -109, 381,
+    -975, 2003, -3589, 6675, 28954, -83, -1110, 1028, -648, 304, -101, 20,
+    -1, 18, -108, 381, -976, 2011, -3612, 6751, 28932, -138, -1085, 1017,
+    -643, 302, -101, 20, -1, 18, -108, 381, -978, 2018, -3634, 6828,
+    28911, -193, -1061, 1006, -639, 301, -100, 20, -1, 18, -108, 381,
+    -980, 2025, -3657, 6905, 28888, -248, -1036, 995, -635, 300, -100, 20,
+    -1, 18, -108, 381, -981, 2032, -3679, 6982, 28866, -302, -1012, 984,
+    -630, 298, -100, 20, -1, 18, -108, 381, -983, 2040, -3702, 7059,
+    28843, -356, -988, 973, -626, 297, -99, 20, -1, 18, -107, 381,
+    -984, 2047, -3724, 7136, 28820, -410, -963, 962, -622, 295, -99, 20,
+    -1, 18, -107, 381, -986, 2054, -3746, 7214, 28796, -463, -939, 951,
+    -617, 294, -99, 19, -1, 18, -107, 381, -987, 2060, -3768, 7291,
+    28772, -517, -915, 940, -613, 293, -98, 19, -1, 17, -106, 381,
+    -989, 2067, -3790, 7369, 28747, -570, -891, 929, -608, 291, -98, 19,
+    -1, 17, -106, 381, -990, 2074, -3812, 7447, 28722, -622, -866, 918,
+    -604, 290, -98, 19, -1, 17, -106, 380, -991, 2081, -3834, 7525,
+    28697, -675, -842, 907, -600, 288, -97, 19, -1, 17, -106, 380,
+    -993, 2087, -3856, 7603, 28671, -727, -818, 896, -595, 287, -97, 19,
+    -1, 17, -105, 380, -994, 2094, -3877, 7681, 28645, -779, -794, 885,
+    -591, 285, -97, 19, -1, 17, -105, 380, -995, 2100, -3899, 7759,
+    28618, -831, -770, 874, -586, 284, -96, 19, -1, 17, -105, 380,
+    -996, 2107, -3920, 7838, 28591, -882, -746, 862, -582, 282, -96, 19,
+    -1, 17, -104, 379, -998, 2113, -3942, 7916, 28564, -933, -723, 851,
+    -577, 281, -96, 19, -1, 17, -104, 379, -999, 2119, -3963, 7995,
+    28536, -984, -699, 840, -573, 280, -95, 19, -1, 16, -104, 379,
+    -1000, 2125, -3984, 8074, 28508, -1034, -675, 829, -568, 278, -95, 19,
+    -1, 16, -103, 378, -1001, 2132, -4005, 8153, 28479, -1085, -651, 818,
+    -564, 277, -95, 19, -1, 16, -103, 378, -1002, 2138, -4026, 8232,
+    28450, -1135, -628, 807, -559, 275, -94, 19, -1, 16, -103, 378,
+    -1003, 2144, -4047, 8311, 28421, -1184, -604, 796, -555, 274, -94, 19,
+    -1, 16, -102, 377, -1003, 2149, -4068, 8390, 28391, -1234, -580, 785,
+    -550, 272, -93, 19, -1, 16, -102, 377, -1004, 2155, -4088, 8469,
+    28361, -1283, -557, 774, -546, 271, -93, 19, -1, 16, -102, 376,
+    -1005, 2161, -4109, 8549, 28331, -1332, -533, 763, -541, 269, -93, 18,
+    0, 15, -101, 376, -1006, 2167, -4129, 8628, 28300, -1380, -510, 752,
+    -536, 267, -92, 18, 0, 15, -101, 376, -1007, 2172, -4150, 8708,
+    28268, -1429, -487, 741, -532, 266, -92, 18, 0, 15, -100, 375,
+    -1007, 2178, -4170, 8788, 28237, -1477, -463, 730, -527, 264, -92, 18,
+    0, 15, -100, 375, -1008, 2183, -4190, 8868, 28205, -1524, -440, 719,
+    -523, 263, -91, 18, 0, 15, -100, 374, -1008, 2189, -4210, 8948,
+    28172, -1572, -417, 708, -518, 261, -91, 18, 0, 15, -99, 373,
+    -1009, 2194, -4230, 9028, 28139, -1619, -394, 697, -514, 260, -90, 18,
+    0, 15, -99, 373, -1009, 2199, -4250, 9108, 28106, -1666, -371, 686,
+    -509, 258, -90, 18, 0, 14, -98, 372, -1010, 2204, -4270, 9188,
+    28072, -1712, -348, 675, -504, 257, -90, 18, 0, 14, -98, 372,
+    -1010, 2209, -4289, 9268, 28038, -1759, -325, 664, -500, 255, -89, 18,
+    0, 14, -97, 371, -1011, 2214, -4309, 9349, 28004, -1805, -302, 653,
+    -495, 254, -89, 18, 0, 14, -97, 371, -1011, 2219, -4328, 9429,
+    27969, -1851, -279, 642, -491, 252, -88, 18, 0, 14, -96, 370,
+    -1011, 2224, -4347, 9510, 27934, -1896, -257, 631, -486, 250, -88, 18,
+    0, 14, -96, 369, -1012, 2229, -4366, 9590, 27898, -1941, -234, 620,
+    -481, 249, -88, 18, 0, 13, -96, 368, -1012, 2233, -4385, 9671,
+    27862, -1986, -211, 609, -477, 247, -87, 17, 0, 13, -95, 368,
+    -1012, 2238, -4404, 9752, 27826, -2031, -189, 598, -472, 246, -87, 17,
+    0, 13, -95, 367, -1012, 2242, -4423, 9833, 27789, -2075, -166, 587,
+    -467, 244, -86, 17, 0, 13, -94, 366, -1012, 2247, -4441, 9914,
+    27752, -2119, -144, 576, -463, 242, -86, 17, 0, 13, -94, 365,
+    -1012, 2251, -4460, 9995, 27715, -2163, -122, 565, -458, 241, -86, 17,
+    0, 13, -93, 365, -1012, 2255, -4478, 10076, 27677, -2206, -99, 554,
+    -453, 239, -85, 17, 0, 12, -92, 364, -1012, 2259, -4496, 10157,
+    27639, -2250, -77, 543, -449, 238, -85, 17, 0, 12, -92, 363,
+    -1012, 2263, -4515, 10238, 27600, -2292, -55, 532, -444, 236, -84, 17,
+    0, 12, -91, 362, -1012, 2267, -4533, 10319, 27561, -2335, -33, 522,
+    -440, 234, -84, 17, 0, 12, -91, 361, -1011, 2271, -4550, 10401,
+    27522, -2377, -11, 511, -435, 233, -83, 17, 0, 12, -90, 360,
+    -1011, 2275, -4568, 10482, 27482, -2419, 11, 500, -430, 231, -83, 17,
+    0, 11, -90, 359, -1011, 2278, -4586, 10564, 27442, -2461, 33, 489,
+    -426, 229, -83, 17, 0, 11, -89, 358, -1010, 2282, -4603, 10645,
+    27402, -2503, 55, 478, -421, 228, -82, 17, 0, 11, -89, 358,
+    -1010, 2286, -4620, 10727, 27361, -2544, 76, 467, -416, 226, -82, 16,
+    0, 11, -88, 357, -1010, 2289, -4637, 10808, 27320, -2585, 98, 457,
+    -412, 225, -81, 16, 0, 11, -87, 356, -1009, 2292, -4654, 10890,
+    27278, -2625, 119, 446, -407, 223, -81, 16, 0, 10, -87, 355,
+    -1008, 2296, -4671, 10972, 27237, -2665, 141, 435, -402, 221, -80, 16,
+    0, 10, -86, 353, -1008, 2299, -4688, 11054, 27194, -2705, 162, 425,
+    -398, 220, -80, 16, 0, 10, -86, 352, -1007, 2302, -4705, 11136,
+    27152, -2745, 183, 414, -393, 218, -79, 16, 0, 10, -85, 351,
+    -1007, 2305, -4721, 11217, 27109, -2785, 205, 403, -388, 216, -79, 16,
+    0, 10, -84, 350, -1006, 2308, -4737, 11299, 27065, -2824, 226, 392,
+    -384, 215, -79, 16, 0, 9, -84, 349, -1005, 2310, -4754, 11381,
+    27022, -2862, 247, 382, -379, 213, -78, 16, 0, 9, -83, 348,
+    -1004, 2313, -4769, 11463, 26978, -2901, 268, 371, -374, 211, -78, 16,
+    0, 9, -82, 347, -1003, 2316, -4785, 11545, 26933, -2939, 289, 361,
+    -370, 210, -77, 16, 0, 9, -82, 346, -1002, 2318, -4801, 11628,
+    26889, -2977, 309, 350, -365, 208, -77, 16, 0, 9, -81, 344,
+    -1001, 2321, -4817, 11710, 26844, -3015, 330, 339, -360, 206, -76, 16,
+    0, 8, -80, 343, -1000, 2323, -4832, 11792, 26798, -3052, 351, 329,
+    -356, 205, -76, 15, 1, 8, -80, 342, -999, 2325, -4847, 11874,
+    26752, -3089, 371, 318, -351, 203, -75, 15, 1, 8, -79, 341,
+    -998, 2327, -4862, 11956, 26706, -3126, 392, 308, -346, 201, -75, 15,
+    1, 8, -78, 339, -997, 2329, -4877, 12038, 26660, -3163, 412, 297,
+    -342, 200, -75, 15, 1, 7, -78, 338, -996, 2331, -4892, 12121,
+    26613, -3199, 433, 287, -337, 198, -74, 15, 1, 7, -77, 337,
+    -994, 2333, -4907, 12203, 26566, -3235, 453, 276, -332, 196, -74, 15,
+    1, 7, -76, 335, -993, 2335, -4921, 12285, 26518, -3270, 473, 266,
+    -328, 195, -73, 15, 1, 7, -75, 334, -992, 2337, -4935, 12368,
+    26470, -3306, 493, 256, -323, 193, -73, 15, 1, 7, -75, 332,
+    -990, 2338, -4949, 12450, 26422, -3341, 513, 245, -318, 191, -72, 15,
+    1, 6, -74, 331, -989, 2340, -4963, 12532, 26373, -3375, 533, 235,
+    -314, 189, -72, 15, 1, 6, -73, 329, -987, 2341, -4977, 12615,
+    26325, -3410, 552, 225, -309, 188, -71, 15, 1, 6, -73, 328,
+    -986, 2342, -4991, 12697, 26275, -3444, 572, 214, -305, 186, -71, 14,
+    1, 6, -72, 326, -984, 2343, -5004, 12779, 26226, -3478, 592, 204,
+    -300, 184, -70, 14, 1, 5, -71, 325, -982, 2344, -5018, 12862,
+    26176, -3511, 611, 194, -295, 183, -70, 14, 1, 5, -70, 323,
+    -981, 2345, -5031, 12944, 26126, -3545, 631, 184, -291, 181, -69, 14,
+    1, 5, -69, 322, -979, 2346, -5044, 13027, 26075, -3577, 650, 173,
+    -286, 179, -69, 14, 1, 5, -69, 320, -977, 2347, -5056, 13109,
+    26024, -3610, 669, 163, -282, 178, -68, 14, 1, 4, -68, 319,
+    -975, 2348, -5069, 13191, 25973, -3643, 688, 153, -277, 176, -68, 14,
+    1, 4, -67, 317, -973, 2348, -5081, 13274, 25921, -3675, 707, 143,
+    -272, 174, -68, 14, 1, 4, -66, 315, -971, 2349, -5094, 13356,
+    25869, -3706, 726, 133, -268, 173, -67, 14, 1, 3, -65, 314,
+    -969, 2349, -5106, 13439, 25817, -3738, 745, 123, -263, 171, -67, 14,
+    1, 3, -64, 312, -967, 2349, -5118, 13521, 25765, -3769, 764, 113,
+    -259, 169, -66, 14, 1, 3, -64, 310, -965, 2349, -5129, 13603,
+    25712, -3800, 782, 103, -254, 168, -66, 14, 1, 3, -63, 309,
+    -963, 2350, -5141, 13686, 25659, -3831, 801, 93, -249, 166, -65, 13,
+    1, 2, -62, 307, -961, 2349, -5152, 13768, 25605, -3861, 819, 83,
+    -245, 164, -65, 13, 1, 2, -61, 305, -958, 2349, -5164, 13850,
+    25551, -3891, 838, 73, -240, 162, -64, 13, 1, 2, -60, 303,
+    -956, 2349, -5175, 13933, 25497, -3921, 856, 63, -236, 161, -64, 13,
+    2, 2, -59, 301, -954, 2349, -5185, 14015, 25443, -3950, 874, 54,
+    -231, 159, -63, 13, 2, 1, -58, 300, -951, 2348, -5196, 14097,
+    25388, -3979, 892, 44, -227, 157, -63, 13, 2, 1, -58, 298,
+    -949, 2348, -5206, 14180, 25333, -4008, 910, 34, -222, 156, -62, 13,
+    2, 1, -57, 296, -946, 2347, -5217, 14262, 25278, -4037, 928, 24,
+    -218, 154, -62, 13, 2, 0, -56, 294, -944, 2346, -5227, 14344,
+    25222, -4065, 946, 14, -213, 152, -61, 13, 2, 0, -55, 292,
+    -941, 2345, -5237, 14426, 25166, -4093, 964, 5, -209, 151, -61, 13,
+    2, 0, -54, 290, -938, 2344, -5246, 14508, 25110, -4120, 981, -5,
+    -204, 149, -60, 13, 2, 0, -53, 288, -936, 2343, -5256, 14590,
+    25053, -4148, 999, -14, -200, 147, -60, 12, 2, -1, -52, 286,
+    -933, 2342, -5265, 14672, 24996, -4175, 1016, -24, -195, 146, -59, 12,
+    2, -1, -51, 284, -930, 2341, -5274, 14754, 24939, -4202, 1033, -34,
+    -191, 144, -59, 12, 2, -1, -50, 282, -927, 2339, -5283, 14836,
+    24881, -4228, 1050, -43, -186, 142, -59, 12, 2, -2, -49, 280,
+    -924, 2338, -5292, 14918, 24824, -4254, 1067, -53, -182, 141, -58, 12,
+    2, -2, -48, 278, -921, 2336, -5300, 15000, 24765, -4280, 1084, -62,
+    -178, 139, -58, 12, 2, -2, -47, 276, -918, 2334, -5309, 15082,
+    24707, -4306, 1101, -71, -173, 137, -57, 12, 2, -3, -46, 274,
+    -915, 2332, -5317, 15164, 24648, -4331, 1118, -81, -169, 136, -57, 12,
+    2, -3, -45, 271, -912, 2330, -5325, 15246, 24589, -4356, 1135, -90,
+    -164, 134, -56, 12, 2, -3, -44, 269, -909, 2328, -5332, 15327,
+    24530, -4381, 1151, -99, -160, 132, -56, 12, 2, -3, -43, 267,
+    -905, 2326, -5340, 15409, 24471, -4405, 1168, -109, -156, 130, -55, 12,
+    2, -4, -42, 265, -902, 2324, -5347, 15490, 24411, -4430, 1184, -118,
+    -151, 129, -55, 11, 2, -4, -41, 263, -899, 2322, -5354, 15572,
+    24350, -4454, 1200, -127, -147, 127, -54, 11, 2, -4, -40, 260,
+    -895, 2319, -5361, 15653, 24290, -4477, 1216, -136, -142, 125, -54, 11,
+    3, -5, -39, 258, -892, 2316, -5368, 15735, 24229, -4500, 1232, -145,
+    -138, 124, -53, 11, 3, -5, -38, 256, -888, 2314, -5374, 15816,
+    24168, -4523, 1248, -154, -134, 122, -53, 11, 3, -5, -37, 253,
+    -885, 2311, -5381, 15897, 24107, -4546, 1264, -163, -129, 121, -52, 11,
+    3, -6, -36, 251, -881, 2308, -5387, 15979, 24045, -4569, 1280, -172,
+    -125, 119, -52, 11, 3, -6, -35, 249, -877, 2305, -5393, 16060,
+    23984, -4591, 1295, -181, -121, 117, -51, 11, 3, -6, -34, 246,
+    -874, 2302, -5398, 16141, 23922, -4612, 1311, -190, -117, 116, -51, 11,
+    3, -7, -33, 244, -870, 2298, -5404, 16222, 23859, -4634, 1326, -199,
+    -112, 114, -50, 11, 3, -7, -32, 242, -866, 2295, -5409, 16303,
+    23797, -4655, 1341, -208, -108, 112, -50, 11, 3, -7, -30, 239,
+    -862, 2291, -5414, 16383, 23734, -4676, 1356, -217, -104, 111, -49, 10,
+    3, -8, -29, 237, -858, 2288, -5419, 16464, 23670, -4697, 1371, -225,
+    -100, 109, -49, 10, 3, -8, -28, 234, -854, 2284, -5423, 16545,
+    23607, -4717, 1386, -234, -95, 107, -49, 10, 3, -8, -27, 232,
+    -850, 2280, -5428, 16625, 23543, -4738, 1401, -243, -91, 106, -48, 10,
+    3, -9, -26, 229, -846, 2276, -5432, 16706, 23479, -4757, 1416, -251,
+    -87, 104, -48, 10, 3, -9, -25, 226, -842, 2272, -5436, 16786,
+    23415, -4777, 1430, -260, -83, 102, -47, 10, 3, -10, -24, 224,
+    -837, 2268, -5439, 16867, 23350, -4796, 1445, -269, -79, 101, -47, 10,
+    3, -10, -23, 221, -833, 2264, -5443, 16947, 23286, -4815, 1459, -277,
+    -74, 99, -46, 10, 3, -10, -21, 219, -829, 2259, -5446, 17027,
+    23221, -4834, 1474, -286, -70, 98, -46, 10, 4, -11, -20, 216,
+    -825, 2255, -5449, 17107, 23155, -4852, 1488, -294, -66, 96, -45, 10,
+    4, -11, -19, 213, -820, 2250, -5452, 17187, 23090, -4870, 1502, -302,
+    -62, 94, -45, 10, 4, -11, -18, 211, -816, 2245, -5454, 17267,
+    23024, -4888, 1516, -311, -58, 93, -44, 10, 4, -12, -17, 208,
+    -811, 2240, -5457, 17347, 22958, -4906, 1529, -319, -54, 91, -44, 9,
+    4, -12, -15, 205, -807, 2235, -5459, 17426, 22892, -4923, 1543, -327,
+    -50, 90, -43, 9, 4, -12, -14, 203, -802, 2230, -5461, 17506,
+    22825, -4940, 1557, -336, -46, 88, -43, 9, 4, -13, -13, 200,
+    -797, 2225, -5462, 17585, 22758, -4957, 1570, -344, -42, 86, -42, 9,
+    4, -13, -12, 197, -792, 2220, -5464, 17664, 22691, -4973, 1584, -352,
+    -38, 85, -42, 9, 4, -13, -11, 194, -788, 2214, -5465, 17744,
+    22624, -4989, 1597, -360, -34, 83, -41, 9, 4, -14, -9, 191,
+    -783, 2209, -5466, 17823, 22557, -5005, 1610, -368, -30, 82, -41, 9,
+    4, -14, -8, 188, -778, 2203, -5467, 17902, 22489, -5021, 1623, -376,
+    -26, 80, -41, 9, 4, -15, -7, 186, -773, 2197, -5467, 17980,
+    22421, -5036, 1636, -384, -22, 78, -40, 9, 4, -15, -6, 183,
+    -768, 2191, -5467, 18059, 22353, -5051, 1649, -392, -18, 77, -40, 9,
+    4, -15, -4, 180, -763, 2185, -5467, 18138, 22284, -5066, 1661, -400,
+    -14, 75, -39, 9, 4, -16, -3, 177, -758, 2179, -5467, 18216,
+    22216, -5080, 1674, -407, -10, 74, -39, 9, 4, -16, -2, 174,
+    -753, 2173, -5467, 18295, 22147, -5095, 1686, -415, -6, 72, -38, 8,
+    5, -17, -1, 171, -748, 2167, -5466, 18373, 22078, -5109, 1699, -423,
+    -2, 71, -38, 8, 5, -17, 1, 168, -742, 2160, -5465, 18451,
+    22008, -5122, 1711, -431, 2, 69, -37, 8, 5, -17, 2, 165,
+    -737, 2153, -5464, 18529, 21939, -5136, 1723, -438, 6, 67, -37, 8,
+    5, -18, 3, 162, -732, 2147, -5463, 18607, 21869, -5149, 1735, -446,
+    10, 66, -36, 8, 5, -18, 5, 159, -726, 2140, -5461, 18684,
+    21799, -5161, 1747, -453, 14, 64, -36, 8, 5, -18, 6, 156,
+    -721, 2133, -5459, 18762, 21729, -5174, 1759, -461, 17, 63, -36, 8,
+    5, -19, 7, 153, -715, 2126, -5457, 18839, 21658, -5186, 1770, -468,
+    21, 61, -35, 8, 5, -19, 8, 150, -710, 2119, -5454, 18917,
+    21587, -5198, 1782, -476, 25, 60, -35, 8, 5, -20, 10, 146,
+    -704, 2111, -5452, 18994, 21517, -5210, 1793, -483, 29, 58, -34, 8,
+    5, -20, 11, 143, -698, 2104, -5449, 19071, 21445, -5221, 1804, -490,
+    32, 57, -34, 8, 5, -20, 12, 140, -693, 2096, -5446, 19148,
+    21374, -5233, 1816, -498, 36, 55, -33, 8, 5, -21, 14, 137,
+    -687, 2089, -5442, 19224, 21303, -5244, 1827, -505, 40, 54, -33, 7,
+    5, -21, 15, 134, -681, 2081, -5439, 19301, 21231, -5254, 1838, -512,
+    44, 52, -32, 7, 5, -22, 16, 130, -675, 2073, -5435, 19377,
+    21159, -5265, 1848, -519, 47, 51, -32, 7, 6, -22, 18, 127,
+    -669, 2065, -5431, 19453, 21087, -5275, 1859, -526, 51, 49, -32, 7,
+    6, -23, 19, 124, -663, 2057, -5426, 19529, 21015, -5285, 1870, -533,
+    55, 48, -31, 7, 6, -23, 21, 121, -657, 2049, -5422, 19605,
+    20942, -5294, 1880, -540, 58, 46, -31, 7, 6, -23, 22, 117,
+    -651, 2040, -5417, 19681, 20869, -5303, 1891, -547, 62, 45, -30, 7,
+    6, -24, 23, 114, -645, 2032, -5412, 19757, 20797, -5313, 1901, -554,
+    65, 43, -30, 7, 6, -24, 25, 111, -639, 2023, -5406, 19832,
+    20723, -5321, 1911, -561, 69, 42, -29, 7, 6, -25, 26, 107,
+    -633, 2015, -5401, 19907, 20650, -5330, 1921, -568, 73, 40, -29, 7,
+    6, -25, 28, 104, -626, 2006, -5395, 19982, 20577, -5338, 1931, -574,
+    76, 39, -28, 7, 6, -25, 29, 101, -620, 1997, -5389, 20057,
+    20503, -5346, 1941, -581, 80, 38, -28, 7, 6, -26, 30, 97,
+    -614, 1988, -5382, 20132, 20429, -5354, 1950, -588, 83, 36, -28, 6,
+    6, -26, 32, 94, -607, 1978, -5375, 20207, 20355, -5361, 1960, -594,
+    87, 35, -27, 6, 6, -27, 33, 90, -601, 1969, -5368, 20281,
+    20281, -5368, 1969, -601, 90, 33, -27, 6, 6, -27, 35, 87,
+    -594, 1960, -5361, 20355, 20207, -5375, 1978, -607, 94, 32, -26, 6,
+    6, -28, 36, 83, -588, 1950, -5354, 20429, 20132, -5382, 1988, -614,
+    97, 30, -26, 6, 7, -28, 38, 80, -581, 1941, -5346, 20503,
+    20057, -5389, 1997, -620, 101, 29, -25, 6, 7, -28, 39, 76,
+    -574, 1931, -5338, 20577, 19982, -5395, 2006, -626, 104, 28, -25, 6,
+    7, -29, 40, 73, -568, 1921, -5330, 20650, 19907, -5401, 2015, -633,
+    107, 26, -25, 6, 7, -29, 42, 69, -561, 1911, -5321, 20723,
+    19832, -5406, 2023, -639, 111, 25, -24, 6, 7, -30, 43, 65,
+    -554, 1901, -5313, 20797, 19757, -5412, 2032, -645, 114, 23, -24, 6,
+    7, -30, 45, 62, -547, 1891, -5303, 20869, 19681, -5417, 2040, -651,
+    117, 22, -23, 6, 7, -31, 46, 58, -540, 1880, -5294, 20942,
+    19605, -5422, 2049, -657, 121, 21, -23, 6, 7, -31, 48, 55,
+    -533, 1870, -5285, 21015, 19529, -5426, 2057, -663, 124, 19, -23, 6,
+    7, -32, 49, 51, -526, 1859, -5275, 21087, 19453, -5431, 2065, -669,
+    127, 18, -22, 6, 7, -32, 51, 47, -519, 1848, -5265, 21159,
+    19377, -5435, 2073, -675, 130, 16, -22, 5, 7, -32, 52, 44,
+    -512, 1838, -5254, 21231, 19301, -5439, 2081, -681, 134, 15, -21, 5,
+    7, -33, 54, 40, -505, 1827, -5244, 21303, 19224, -5442, 2089, -687,
+    137, 14, -21, 5, 8, -33, 55, 36, -498, 1816, -5233, 21374,
+    19148, -5446, 2096, -693, 140, 12, -20, 5, 8, -34, 57, 32,
+    -490, 1804, -5221, 21445, 19071, -5449, 2104, -698, 143, 11, -20, 5,
+    8, -34, 58, 29, -483, 1793, -5210, 21517, 18994, -5452, 2111, -704,
+    146, 10, -20, 5, 8, -35, 60, 25, -476, 1782, -5198, 21587,
+    18917, -5454, 2119, -710, 150, 8, -19, 5, 8, -35, 61, 21,
+    -468, 1770, -5186, 21658, 18839, -5457, 2126, -715, 153, 7, -19, 5,
+    8, -36, 63, 17, -461, 1759, -5174, 21729, 18762, -5459, 2133, -721,
+    156, 6, -18, 5, 8, -36, 64, 14, -453, 1747, -5161, 21799,
+    18684, -5461, 2140, -726, 159, 5, -18, 5, 8, -36, 66, 10,
+    -446, 1735, -5149, 21869, 18607, -5463, 2147, -732, 162, 3, -18, 5,
+    8, -37, 67, 6, -438, 1723, -5136, 21939, 18529, -5464, 2153, -737,
+    165, 2, -17, 5, 8, -37, 69, 2, -431, 1711, -5122, 22008,
+    18451, -5465, 2160, -742, 168, 1, -17, 5, 8, -38, 71, -2,
+    -423, 1699, -5109, 22078, 18373, -5466, 2167, -748, 171, -1, -17, 5,
+    8, -38, 72, -6, -415, 1686, -5095, 22147, 18295, -5467, 2173, -753,
+    174, -2, -16, 4, 9, -39, 74, -10, -407, 1674, -5080, 22216,
+    18216, -5467, 2179, -758, 177, -3, -16, 4, 9, -39, 75, -14,
+    -400, 1661, -5066, 22284, 18138, -5467, 2185, -763, 180, -4, -15, 4,
+    9, -40, 77, -18, -392, 1649, -5051, 22353, 18059, -5467, 2191, -768,
+    183, -6, -15, 4, 9, -40, 78, -22, -384, 1636, -5036, 22421,
+    17980, -5467, 2197, -773, 186, -7, -15, 4, 9, -41, 80, -26,
+    -376, 1623, -5021, 22489, 17902, -5467, 2203, -778, 188, -8, -14, 4,
+    9, -41, 82, -30, -368, 1610, -5005, 22557, 17823, -5466, 2209, -783,
+    191, -9, -14, 4, 9, -41, 83, -34, -360, 1597, -4989, 22624,
+    17744, -5465, 2214, -788, 194, -11, -13, 4, 9, -42, 85, -38,
+    -352, 1584, -4973, 22691, 17664, -5464, 2220, -792, 197, -12, -13, 4,
+    9, -42, 86, -42, -344, 1570, -4957, 22758, 17585, -5462, 2225, -797,
+    200, -13, -13, 4, 9, -43, 88, -46, -336, 1557, -4940, 22825,
+    17506, -5461, 2230, -802, 203, -14, -12, 4, 9, -43, 90, -50,
+    -327, 1543, -4923, 22892, 17426, -5459, 2235, -807, 205, -15, -12, 4,
+    9, -44, 91, -54, -319, 1529, -4906, 22958, 17347, -5457, 2240, -811,
+    208, -17, -12, 4, 10, -44, 93, -58, -311, 1516, -4888, 23024,
+    17267, -5454, 2245, -816, 211, -18, -11, 4, 10, -45, 94, -62,
+    -302, 1502, -4870, 23090, 17187, -5452, 2250, -820, 213, -19, -11, 4,
+    10, -45, 96, -66, -294, 1488, -4852, 23155, 17107, -5449, 2255, -825,
+    216, -20, -11, 4, 10, -46, 98, -70, -286, 1474, -4834, 23221,
+    17027, -5446, 2259, -829, 219, -21, -10, 3, 10, -46, 99, -74,
+    -277, 1459, -4815, 23286, 16947, -5443, 2264, -833, 221, -23, -10, 3,
+    10, -47, 101, -79, -269, 1445, -4796, 23350, 16867, -5439, 2268, -837,
+    224, -24, -10, 3, 10, -47, 102, -83, -260, 1430, -4777, 23415,
+    16786, -5436, 2272, -842, 226, -25, -9, 3, 10, -48, 104, -87,
+    -251, 1416, -4757, 23479, 16706, -5432, 2276, -846, 229, -26, -9, 3,
+    10, -48, 106, -91, -243, 1401, -4738, 23543, 16625, -5428, 2280, -850,
+    232, -27, -8, 3, 10, -49, 107, -95, -234, 1386, -4717, 23607,
+    16545, -5423, 2284, -854, 234, -28, -8, 3, 10, -49, 109, -100,
+    -225, 1371, -4697, 23670, 16464, -5419, 2288, -858, 237, -29, -8, 3,
+    10, -49, 111, -104, -217, 1356, -4676, 23734, 16383, -5414, 2291, -862,
+    239, -30, -7, 3, 11, -50, 112, -108, -208, 1341, -4655, 23797,
+    16303, -5409, 2295, -866, 242, -32, -7, 3, 11, -50, 114, -112,
+    -199, 1326, -4634, 23859, 16222, -5404, 2298, -870, 244, -33, -7, 3,
+    11, -51, 116, -117, -190, 1311, -4612, 23922, 16141, -5398, 2302, -874,
+    246, -34, -6, 3, 11, -51, 117, -121, -181, 1295, -4591, 23984,
+    16060, -5393, 2305, -877, 249, -35, -6, 3, 11, -52, 119, -125,
+    -172, 1280, -4569, 24045, 15979, -5387, 2308, -881, 251, -36, -6, 3,
+    11, -52, 121, -129, -163, 1264, -4546, 24107, 15897, -5381, 2311, -885,
+    253, -37, -5, 3, 11, -53, 122, -134, -154, 1248, -4523, 24168,
+    15816, -5374, 2314, -888, 256, -38, -5, 3, 11, -53, 124, -138,
+    -145, 1232, -4500, 24229, 15735, -5368, 2316, -892, 258, -39, -5, 3,
+    11, -54, 125, -142, -136, 1216, -4477, 24290, 15653, -5361, 2319, -895,
+    260, -40, -4, 2, 11, -54, 127, -147, -127, 1200, -4454, 24350,
+    15572, -5354, 2322, -899, 263, -41, -4, 2, 11, -55, 129, -151,
+    -118, 1184, -4430, 24411, 15490, -5347, 2324, -902, 265, -42, -4, 2,
+    12, -55, 130, -156, -109, 1168, -4405, 24471, 15409, -5340, 2326, -905,
+    267, -43, -3, 2, 12, -56, 132, -160, -99, 1151, -4381, 24530,
+    15327, -5332, 2328, -909, 269, -44, -3, 2, 12, -56, 134, -164,
+    -90, 1135, -4356, 24589, 15246, -5325, 2330, -912, 271, -45, -3, 2,
+    12, -57, 136, -169, -81, 1118, -4331, 24648, 15164, -5317, 2332, -915,
+    274, -46, -3, 2, 12, -57, 137, -173, -71, 1101, -4306, 24707,
+    15082, -5309, 2334, -918, 276, -47, -2, 2, 12, -58, 139, -178,
+    -62, 1084, -4280, 24765, 15000, -5300, 2336, -921, 278, -48, -2, 2,
+    12, -58, 141, -182, -53, 1067, -4254, 24824, 14918, -5292, 2338, -924,
+    280, -49, -2, 2, 12, -59, 142, -186, -43, 1050, -4228, 24881,
+    14836, -5283, 2339, -927, 282, -50, -1, 2, 12, -59, 144, -191,
+    -34, 1033, -4202, 24939, 14754, -5274, 2341, -930, 284, -51, -1, 2,
+    12, -59, 146, -195, -24, 1016, -4175, 24996, 14672, -5265, 2342, -933,
+    286, -52, -1, 2, 12, -60, 147, -200, -14, 999, -4148, 25053,
+    14590, -5256, 2343, -936, 288, -53, 0, 2, 13, -60, 149, -204,
+    -5, 981, -4120, 25110, 14508, -5246, 2344, -938, 290, -54, 0, 2,
+    13, -61, 151, -209, 5, 964, -4093, 25166, 14426, -5237, 2345, -941,
+    292, -55, 0, 2, 13, -61, 152, -213, 14, 946, -4065, 25222,
+    14344, -5227, 2346, -944, 294, -56, 0, 2, 13, -62, 154, -218,
+    24, 928, -4037, 25278, 14262, -5217, 2347, -946, 296, -57, 1, 2,
+    13, -62, 156, -222, 34, 910, -4008, 25333, 14180, -5206, 2348, -949,
+    298, -58, 1, 2, 13, -63, 157, -227, 44, 892, -3979, 25388,
+    14097, -5196, 2348, -951, 300, -58, 1, 2, 13, -63, 159, -231,
+    54, 874, -3950, 25443, 14015, -5185, 2349, -954, 301, -59, 2, 2,
+    13, -64, 161, -236, 63, 856, -3921, 25497, 13933, -5175, 2349, -956,
+    303, -60, 2, 1, 13, -64, 162, -240, 73, 838, -3891, 25551,
+    13850, -5164, 2349, -958, 305, -61, 2, 1, 13, -65, 164, -245,
+    83, 819, -3861, 25605, 13768, -5152, 2349, -961, 307, -62, 2, 1,
+    13, -65, 166, -249, 93, 801, -3831, 25659, 13686, -5141, 2350, -963,
+    309, -63, 3, 1, 14, -66, 168, -254, 103, 782, -3800, 25712,
+    13603, -5129, 2349, -965, 310, -64, 3, 1, 14, -66, 169, -259,
+    113, 764, -3769, 25765, 13521, -5118, 2349, -967, 312, -64, 3, 1,
+    14, -67, 171, -263, 123, 745, -3738, 25817, 13439, -5106, 2349, -969,
+    314, -65, 3, 1, 14, -67, 173, -268, 133, 726, -3706, 25869,
+    13356, -5094, 2349, -971, 315, -66, 4, 1, 14, -68, 174, -272,
+    143, 707, -3675, 25921, 13274, -5081, 2348, -973, 317, -67, 4, 1,
+    14, -68, 176, -277, 153, 688, -3643, 25973, 13191, -5069, 2348, -975,
+    319, -68, 4, 1, 14, -68, 178, -282, 163, 669, -3610, 26024,
+    13109, -5056, 2347, -977, 320, -69, 5, 1, 14, -69, 179, -286,
+    173, 650, -3577, 26075, 13027, -5044, 2346, -979, 322, -69, 5, 1,
+    14, -69, 181, -291, 184, 631, -3545, 26126, 12944, -5031, 2345, -981,
+    323, -70, 5, 1, 14, -70, 183, -295, 194, 611, -3511, 26176,
+    12862, -5018, 2344, -982, 325, -71, 5, 1, 14, -70, 184, -300,
+    204, 592, -3478, 26226, 12779, -5004, 2343, -984, 326, -72, 6, 1,
+    14, -71, 186, -305, 214, 572, -3444, 26275, 12697, -4991, 2342, -986,
+    328, -73, 6, 1, 15, -71, 188, -309, 225, 552, -3410, 26325,
+    12615, -4977, 2341, -987, 329, -73, 6, 1, 15, -72, 189, -314,
+    235, 533, -3375, 26373, 12532, -4963, 2340, -989, 331, -74, 6, 1,
+    15, -72, 191, -318, 245, 513, -3341, 26422, 12450, -4949, 2338, -990,
+    332, -75, 7, 1, 15, -73, 193, -323, 256, 493, -3306, 26470,
+    12368, -4935, 2337, -992, 334, -75, 7, 1, 15, -73, 195, -328,
+    266, 473, -3270, 26518, 12285, -4921, 2335, -993, 335, -76, 7, 1,
+    15, -74, 196, -332, 276, 453, -3235, 26566, 12203, -4907, 2333, -994,
+    337, -77, 7, 1, 15, -74, 198, -337, 287, 433, -3199, 26613,
+    12121, -4892, 2331, -996, 338, -78, 7, 1, 15, -75, 200, -342,
+    297, 412, -3163, 26660, 12038, -4877, 2329, -997, 339, -78, 8, 1,
+    15, -75, 201, -346, 308, 392, -3126, 26706, 11956, -4862, 2327, -998,
+    341, -79, 8, 1, 15, -75, 203, -351, 318, 371, -3089, 26752,
+    11874, -4847, 2325, -999, 342, -80, 8, 1, 15, -76, 205, -356,
+    329, 351, -3052, 26798, 11792, -4832, 2323, -1000, 343, -80, 8, 0,
+    16, -76, 206, -360, 339, 330, -3015, 26844, 11710, -4817, 2321, -1001,
+    344, -81, 9, 0, 16, -77, 208, -365, 350, 309, -2977, 26889,
+    11628, -4801, 2318, -1002, 346, -82, 9, 0, 16, -77, 210, -370,
+    361, 289, -2939, 26933, 11545, -4785, 2316, -1003, 347, -82, 9, 0,
+    16, -78, 211, -374, 371, 268, -2901, 26978, 11463, -4769, 2313, -1004,
+    348, -83, 9, 0, 16, -78, 213, -379, 382, 247, -2862, 27022,
+    11381, -4754, 2310, -1005, 349, -84, 9, 0, 16, -79, 215, -384,
+    392, 226, -2824, 27065, 11299, -4737, 2308, -1006, 350, -84, 10, 0,
+    16, -79, 216, -388, 403, 205, -2785, 27109, 11217, -4721, 2305, -1007,
+    351, -85, 10, 0, 16, -79, 218, -393, 414, 183, -2745, 27152,
+    11136, -4705, 2302, -1007, 352, -86, 10, 0, 16, -80, 220, -398,
+    425, 162, -2705, 27194, 11054, -4688, 2299, -1008, 353, -86, 10, 0,
+    16, -80, 221, -402, 435, 141, -2665, 27237, 10972, -4671, 2296, -1008,
+    355, -87, 10, 0, 16, -81, 223, -407, 446, 119, -2625, 27278,
+    10890, -4654, 2292, -1009, 356, -87, 11, 0, 16, -81, 225, -412,
+    457, 98, -2585, 27320, 10808, -4637, 2289, -1010, 357, -88, 11, 0,
+    16, -82, 226, -416, 467, 76, -2544, 27361, 10727, -4620, 2286, -1010,
+    358, -89, 11, 0, 17, -82, 228, -421, 478, 55, -2503, 27402,
+    10645, -4603, 2282, -1010, 358, -89, 11, 0, 17, -83, 229, -426,
+    489, 33, -2461, 27442, 10564, -4586, 2278, -1011, 359, -90, 11, 0,
+    17, -83, 231, -430, 500, 11, -2419, 27482, 10482, -4568, 2275, -1011,
+    360, -90, 12, 0, 17, -83, 233, -435, 511, -11, -2377, 27522,
+    10401, -4550, 2271, -1011, 361, -91, 12, 0, 17, -84, 234, -440,
+    522, -33, -2335, 27561, 10319, -4533, 2267, -1012, 362, -91, 12, 0,
+    17, -84, 236, -444, 532, -55, -2292, 27600, 10238, -4515, 2263, -1012,
+    363, -92, 12, 0, 17, -85, 238, -449, 543, -77, -2250, 27639,
+    10157, -4496, 2259, -1012, 364, -92, 12, 0, 17, -85, 239, -453,
+    554, -99, -2206, 27677, 10076, -4478, 2255, -1012, 365, -93, 13, 0,
+    17, -86, 241, -458, 565, -122, -2163, 27715, 9995, -4460, 2251, -1012,
+    365, -94, 13, 0, 17, -86, 242, -463, 576, -144, -2119, 27752,
+    9914, -4441, 2247, -1012, 366, -94, 13, 0, 17, -86, 244, -467,
+    587, -166, -2075, 27789, 9833, -4423, 2242, -1012, 367, -95, 13, 0,
+    17, -87, 246, -472, 598, -189, -2031, 27826, 9752, -4404, 2238, -1012,
+    368, -95, 13, 0, 17, -87, 247, -477, 609, -211, -1986, 27862,
+    9671, -4385, 2233, -1012, 368, -96, 13, 0, 18, -88, 249, -481,
+    620, -234, -1941, 27898, 9590, -4366, 2229, -1012, 369, -96, 14, 0,
+    18, -88, 250, -486, 631, -257, -1896, 27934, 9510, -4347, 2224, -1011,
+    370, -96, 14, 0, 18, -88, 252, -491, 642, -279, -1851, 27969,
+    9429, -4328, 2219, -1011, 371, -97, 14, 0, 18, -89, 254, -495,
+    653, -302, -1805, 28004, 9349, -4309, 2214, -1011, 371, -97, 14, 0,
+    18, -89, 255, -500, 664, -325, -1759, 28038, 9268, -4289, 2209, -1010,
+    372, -98, 14, 0, 18, -90, 257, -504, 675, -348, -1712, 28072,
+    9188, -4270, 2204, -1010, 372, -98, 14, 0, 18, -90, 258, -509,
+    686, -371, -1666, 28106, 9108, -4250, 2199, -1009, 373, -99, 15, 0,
+    18, -90, 260, -514, 697, -394, -1619, 28139, 9028, -4230, 2194, -1009,
+    373, -99, 15, 0, 18, -91, 261, -518, 708, -417, -1572, 28172,
+    8948, -4210, 2189, -1008, 374, -100, 15, 0, 18, -91, 263, -523,
+    719, -440, -1524, 28205, 8868, -4190, 2183, -1008, 375, -100, 15, 0,
+    18, -92, 264, -527, 730, -463, -1477, 28237, 8788, -4170, 2178, -1007,
+    375, -100, 15, 0, 18, -92, 266, -532, 741, -487, -1429, 28268,
+    8708, -4150, 2172, -1007, 376, -101, 15, 0, 18, -92, 267, -536,
+    752, -510, -1380, 28300, 8628, -4129, 2167, -1006, 376, -101, 15, 0,
+    18, -93, 269, -541, 763, -533, -1332, 28331, 8549, -4109, 2161, -1005,
+    376, -102, 16, -1, 19, -93, 271, -546, 774, -557, -1283, 28361,
+    8469, -4088, 2155, -1004, 377, -102, 16, -1, 19, -93, 272, -550,
+    785, -580, -1234, 28391, 8390, -4068, 2149, -1003, 377, -102, 16, -1,
+    19, -94, 274, -555, 796, -604, -1184, 28421, 8311, -4047, 2144, -1003,
+    378, -103, 16, -1, 19, -94, 275, -559, 807, -628, -1135, 28450,
+    8232, -4026, 2138, -1002, 378, -103, 16, -1, 19, -95, 277, -564,
+    818, -651, -1085, 28479, 8153, -4005, 2132, -1001, 378, -103, 16, -1,
+    19, -95, 278, -568, 829, -675, -1034, 28508, 8074, -3984, 2125, -1000,
+    379, -104, 16, -1, 19, -95, 280, -573, 840, -699, -984, 28536,
+    7995, -3963, 2119, -999, 379, -104, 17, -1, 19, -96, 281, -577,
+    851, -723, -933, 28564, 7916, -3942, 2113, -998, 379, -104, 17, -1,
+    19, -96, 282, -582, 862, -746, -882, 28591, 7838, -3920, 2107, -996,
+    380, -105, 17, -1, 19, -96, 284, -586, 874, -770, -831, 28618,
+    7759, -3899, 2100, -995, 380, -105, 17, -1, 19, -97, 285, -591,
+    885, -794, -779, 28645, 7681, -3877, 2094, -994, 380, -105, 17, -1,
+    19, -97, 287, -595, 896, -818, -727, 28671, 7603, -3856, 2087, -993,
+    380, -106, 17, -1, 19, -97, 288, -600, 907, -842, -675, 28697,
+    7525, -3834, 2081, -991, 380, -106, 17, -1, 19, -98, 290, -604,
+    918, -866, -622, 28722, 7447, -3812, 2074, -990, 381, -106, 17, -1,
+    19, -98, 291, -608, 929, -891, -570, 28747, 7369, -3790, 2067, -989,
+    381, -106, 17, -1, 19, -98, 293, -613, 940, -915, -517, 28772,
+    7291, -3768, 2060, -987, 381, -107, 18, -1, 19, -99, 294, -617,
+    951, -939, -463, 28796, 7214, -3746, 2054, -986, 381, -107, 18, -1,
+    20, -99, 295, -622, 962, -963, -410, 28820, 7136, -3724, 2047, -984,
+    381, -107, 18, -1, 20, -99, 297, -626, 973, -988, -356, 28843,
+    7059, -3702, 2040, -983, 381, -108, 18, -1, 20, -100, 298, -630,
+    984, -1012, -302, 28866, 6982, -3679, 2032, -981, 381, -108, 18, -1,
+    20, -100, 300, -635, 995, -1036, -248, 28888, 6905, -3657, 2025, -980,
+    381, -108, 18, -1, 20, -100, 301, -639, 1006, -1061, -193, 28911,
+    6828, -3634, 2018, -978, 381, -108, 18, -1, 20, -101, 302, -643,
+    1017, -1085, -138, 28932, 6751, -3612, 2011, -976, 381, -108, 18, -1,
+    20, -101, 304, -648, 1028, -1110, -83, 28954, 6675, -3589, 2003, -975,
+    381, -109, 18, -1, 20, -101, 305, -652, 1039, -1134, -28, 28975,
+    6598, -3566, 1996, -973, 381, -109, 18, -1, 20, -102, 306, -656,
+    1050, -1159, 28, 28995, 6522, -3544, 1989, -971, 381, -109, 19, -1,
+    20, -102, 308, -661, 1061, -1184, 84, 29015, 6446, -3521, 1981, -969,
+    381, -109, 19, -1, 20, -102, 309, -665, 1072, -1208, 140, 29035,
+    6370, -3498, 1973, -967, 381, -109, 19, -1, 20, -103, 310, -669,
+    1083, -1233, 196, 29054, 6294, -3475, 1966, -965, 381, -110, 19, -1,
+    20, -103, 312, -673, 1094, -1258, 253, 29073, 6218, -3452, 1958, -964,
+    381, -110, 19, -1, 20, -103, 313, -678, 1105, -1282, 310, 29091,
+    6143, -3429, 1950, -962, 381, -110, 19, -1, 20, -103, 314, -682,
+    1116, -1307, 367, 29109, 6067, -3405, 1942, -960, 381, -110, 19, -1,
+    20, -104, 315, -686, 1127, -1332, 425, 29127, 5992, -3382, 1935, -958,
+    380, -110, 19, -1, 20, -104, 317, -690, 1138, -1357, 482, 29144,
+    5917, -3359, 1927, -955, 380, -110, 19, -1, 20, -104, 318, -694,
+    1148, -1381, 540, 29161, 5842, -3335, 1919, -953, 380, -111, 19, -1,
+    20, -104, 319, -699, 1159, -1406, 599, 29177, 5767, -3312, 1911, -951,
+    380, -111, 19, -1, 20, -105, 321, -703, 1170, -1431, 657, 29193,
+    5693, -3288, 1902, -949, 380, -111, 19, -1, 20, -105, 322, -707,
+    1181, -1456, 716, 29209, 5618, -3265, 1894, -947, 379, -111, 19, -1,
+    20, -105, 323, -711, 1192, -1481, 775, 29224, 5544, -3241, 1886, -944,
+    379, -111, 20, -1, 20, -105, 324, -715, 1203, -1506, 834, 29239,
+    5470, -3217, 1878, -942, 379, -111, 20, -1, 21, -106, 325, -719,
+    1213, -1531, 894, 29253, 5396, -3193, 1869, -940, 378, -111, 20, -1,
+    21, -106, 327, -723, 1224, -1556, 953, 29267, 5322, -3170, 1861, -937,
+    378, -111, 20, -1, 21, -106, 328, -727, 1235, -1581, 1013, 29281,
+    5248, -3146, 1852, -935, 378, -112, 20, -1, 21, -106, 329, -731,
+    1246, -1606, 1074, 29294, 5175, -3122, 1844, -933, 377, -112, 20, -1,
+    21, -107, 330, -735, 1256, -1631, 1134, 29306, 5102, -3098, 1835, -930,
+    377, -112, 20, -1, 21, -107, 331, -739, 1267, -1656, 1195, 29318,
+    5029, -3074, 1827, -928, 377, -112, 20, -1, 21, -107, 332, -743,
+    1278, -1681, 1256, 29330, 4956, -3050, 1818, -925, 376, -112, 20, -1,
+    21, -107, 334, -747, 1288, -1706, 1317, 29342, 4883, -3025, 1809, -923,
+    376, -112, 20, -1, 21, -108, 335, -751, 1299, -1731, 1379, 29353,
+    4810, -3001, 1801, -920, 375, -112, 20, -1, 21, -108, 336, -755,
+    1310, -1756, 1440, 29363, 4738, -2977, 1792, -917, 375, -112, 20, -1,
+    21, -108, 337, -759, 1320, -1782, 1502, 29373, 4666, -2953, 1783, -915,
+    375, -112, 20, -1, 21, -108, 338, -763, 1331, -1807, 1564, 29383,
+    4594, -2928, 1774, -912, 374, -112, 20, -1, 21, -108, 339, -766,
+    1341, -1832, 1627, 29392, 4522, -2904, 1765, -909, 374, -112, 20, -1,
+    21, -109, 340, -770, 1352, -1857, 1690, 29401, 4450, -2880, 1756, -907,
+    373, -112, 20, -1, 21, -109, 341, -774, 1362, -1882, 1752, 29410,
+    4379, -2855, 1747, -904, 373, -112, 20, -1, 21, -109, 342, -778,
+    1373, -1907, 1816, 29418, 4308, -2831, 1738, -901, 372, -112, 20, -1,
+    21, -109, 343, -782, 1383, -1932, 1879, 29425, 4237, -2806, 1729, -898,
+    371, -112, 20, -1, 21, -109, 344, -785, 1394, -1958, 1943, 29432,
+    4166, -2782, 1719, -895, 371, -112, 21, -1, 21, -109, 345, -789,
+    1404, -1983, 2006, 29439, 4095, -2757, 1710, -892, 370, -112, 21, -1,
+    21, -110, 346, -793, 1414, -2008, 2070, 29445, 4025, -2732, 1701, -889,
+    370, -112, 21, -1, 21, -110, 347, -797, 1425, -2033, 2135, 29451,
+    3954, -2708, 1691, -887, 369, -112, 21, -1, 21, -110, 348, -800,
+    1435, -2058, 2199, 29457, 3884, -2683, 1682, -884, 368, -112, 21, -1,
+    21, -110, 349, -804, 1445, -2083, 2264, 29462, 3814, -2658, 1673, -881,
+    368, -112, 21, -1, 21, -110, 350, -807, 1456, -2108, 2329, 29467,
+    3745, -2633, 1663, -877, 367, -112, 21, -1, 21, -110, 351, -811,
+    1466, -2134, 2394, 29471, 3675, -2609, 1654, -874, 366, -112, 21, -1,
+    21, -110, 352, -815, 1476, -2159, 2460, 29475, 3606, -2584, 1644, -871,
+    366, -112, 21, -1, 21, -111, 353, -818, 1486, -2184, 2525, 29478,
+    3537, -2559, 1635, -868, 365, -112, 21, -1, 21, -111, 354, -822,
+    1496, -2209, 2591, 29481, 3468, -2534, 1625, -865, 364, -112, 21, -1,
+    21, -111, 355, -825, 1506, -2234, 2657, 29483, 3399, -2509, 1615, -862,
+    364, -112, 21, -1, 21, -111, 356, -829, 1517, -2259, 2724, 29486,
+    3331, -2484, 1606, -859, 363, -112, 21, -1, 21, -111, 356, -832,
+    1527, -2284, 2790, 29487, 3262, -2459, 1596, -855, 362, -112, 21, -1,
+    21, -111, 357, -835, 1537, -2309, 2857, 29489, 3194, -2434, 1586, -852,
+    361, -112, 21, -1, 21, -111, 358, -839, 1547, -2334, 2924, 29489,
+    3126, -2409, 1576, -849, 361, -112, 21, -1, 21, -111, 359, -842,
+    1556, -2359, 2991, 29490, 3059, -2384, 1566, -846, 360, -111, 21, -1,
+};
+
+// L/M=441/320, 16 taps: 16000->22050
+const int16_t kBank441x320x16[7056] = {
+    -1, 21, -111, 360, -846, 1566, -2384, 3059, 29490, 2991, -2359, 1556,
+    -842, 359, -111, 21, -1, 21, -112, 361, -849, 1576, -2409, 3126,
+    29489, 2924, -2334, 1547, -839, 358, -111, 21, -1, 21, -112, 361,
+    -852, 1586, -2434, 3194, 29489, 2857, -2309, 1537, -835, 357, -111, 21,
+    -1, 21, -112, 362, -855, 1596, -2459, 3262, 29487, 2790, -2284, 1527,
+    -832, 356, -111, 21, -1, 21, -112, 363, -859, 1606, -2484, 3331,
+    29486, 2724, -2259, 1517, -829, 356, -111, 21, -1, 21, -112, 364,
+    -862, 1615, -2509, 3399, 29483, 2657, -2234, 1506, -825, 355, -111, 21,
+    -1, 21, -112, 364, -865, 1625, -2534, 3468, 29481, 2591, -2209, 1496,
+    -822, 354, -111, 21, -1, 21, -112, 365, -868, 1635, -2559, 3537,
+    29478, 2525, -2184, 1486, -818, 353, -111, 21, -1, 21, -112, 366,
+    -871, 1644, -2584, 3606, 29475, 2460, -2159, 1476, -815, 352, -110, 21,
+    -1, 21, -112, 366, -874, 1654, -2609, 3675, 29471, 2394, -2134, 1466,
+    -811, 351, -110, 21, -1, 21, -112, 367, -877, 1663, -2633, 3745,
+    29467, 2329, -2108, 1456, -807, 350, -110, 21, -1, 21, -112, 368,
+    -881, 1673, -2658, 3814, 29462, 2264, -2083, 1445, -804, 349, -110, 21,
+    -1, 21, -112, 368, -884, 1682, -2683, 3884, 29457, 2199, -2058, 1435,
+    -800, 348, -110, 21, -1, 21, -112, 369, -887, 1691, -2708, 3954,
+    29451, 2135, -2033, 1425, -797, 347, -110, 21, -1, 21, -112, 370,
+    -889, 1701, -2732, 4025, 29445, 2070, -2008, 1414, -793, 346, -110, 21,
+    -1, 21, -112, 370, -892, 1710, -2757, 4095, 29439, 2006, -1983, 1404,
+    -789, 345, -109, 21, -1, 21, -112, 371, -895, 1719, -2782, 4166,
+    29432, 1943, -1958, 1394, -785, 344, -109, 21, -1, 20, -112, 371,
+    -898, 1729, -2806, 4237, 29425, 1879, -1932, 1383, -782, 343, -109, 21,
+    -1, 20, -112, 372, -901, 1738, -2831, 4308, 29418, 1816, -1907, 1373,
+    -778, 342, -109, 21, -1, 20, -112, 373, -904, 1747, -2855, 4379,
+    29410, 1752, -1882, 1362, -774, 341, -109, 21, -1, 20, -112, 373,
+    -907, 1756, -2880, 4450, 29401, 1690, -1857, 1352, -770, 340, -109, 21,
+    -1, 20, -112, 374, -909, 1765, -2904, 4522, 29392, 1627, -1832, 1341,
+    -766, 339, -108, 21, -1, 20, -112, 374, -912, 1774, -2928, 4594,
+    29383, 1564, -1807, 1331, -763, 338, -108, 21, -1, 20, -112, 375,
+    -915, 1783, -2953, 4666, 29373, 1502, -1782, 1320, -759, 337, -108, 21,
+    -1, 20, -112, 375, -917, 1792, -2977, 4738, 29363, 1440, -1756, 1310,
+    -755, 336, -108, 21, -1, 20, -112, 375, -920, 1801, -3001, 4810,
+    29353, 1379, -1731, 1299, -751, 335, -108, 21, -1, 20, -112, 376,
+    -923, 1809, -3025, 4883, 29342, 1317, -1706, 1288, -747, 334, -107, 21,
+    -1, 20, -112, 376, -925, 1818, -3050, 4956, 29330, 1256, -1681, 1278,
+    -743, 332, -107, 21, -1, 20, -112, 377, -928, 1827, -3074, 5029,
+    29318, 1195, -1656, 1267, -739, 331, -107, 21, -1, 20, -112, 377,
+    -930, 1835, -3098, 5102, 29306, 1134, -1631, 1256, -735, 330, -107, 21,
+    -1, 20, -112, 377, -933, 1844, -3122, 5175, 29294, 1074, -1606, 1246,
+    -731, 329, -106, 21, -1, 20, -112, 378, -935, 1852, -3146, 5248,
+    29281, 1013, -1581, 1235, -727, 328, -106, 21, -1, 20, -111, 378,
+    -937, 1861, -3170, 5322, 29267, 953, -1556, 1224, -723, 327, -106, 21,
+    -1, 20, -111, 378, -940, 1869, -3193, 5396, 29253, 894, -1531, 1213,
+    -719, 325, -106, 21, -1, 20, -111, 379, -942, 1878, -3217, 5470,
+    29239, 834, -1506, 1203, -715, 324, -105, 20, -1, 20, -111, 379,
+    -944, 1886, -3241, 5544, 29224, 775, -1481, 1192, -711, 323, -105, 20,
+    -1, 19, -111, 379, -947, 1894, -3265, 5618, 29209, 716, -1456, 1181,
+    -707, 322, -105, 20, -1, 19, -111, 380, -949, 1902, -3288, 5693,
+    29193, 657, -1431, 1170, -703, 321, -105, 20, -1, 19, -111, 380,
+    -951, 1911, -3312, 5767, 29177, 599, -1406, 1159, -699, 319, -104, 20,
+    -1, 19, -111, 380, -953, 1919, -3335, 5842, 29161, 540, -1381, 1148,
+    -694, 318, -104, 20, -1, 19, -110, 380, -955, 1927, -3359, 5917,
+    29144, 482, -1357, 1138, -690, 317, -104, 20, -1, 19, -110, 380,
+    -958, 1935, -3382, 5992, 29127, 425, -1332, 1127, -686, 315, -104, 20,
+    -1, 19, -110, 381, -960, 1942, -3405, 6067, 29109, 367, -1307, 1116,
+    -682, 314, -103, 20, -1, 19, -110, 381, -962, 1950, -3429, 6143,
+    29091, 310, -1282, 1105, -678, 313, -103, 20, -1, 19, -110, 381,
+    -964, 1958, -3452, 6218, 29073, 253, -1258, 1094, -673, 312, -103, 20,
+    -1, 19, -110, 381, -965, 1966, -3475, 6294, 29054, 196, -1233, 1083,
+    -669, 310, -103, 20, -1, 19, -109, 381, -967, 1973, -3498, 6370,
+    29035, 140, -1208, 1072, -665, 309, -102, 20, -1, 19, -109, 381,
+    -969, 1981, -3521, 6446, 29015, 84, -1184, 1061, -661, 308, -102, 20,
+    -1, 19, -109, 381, -971, 1989, -3544, 6522, 28995, 28, -1159, 1050,
+    -656, 306, -102, 20, -1, 18, -109, 381, -973, 1996, -3566, 6598,
+    28975, -28, -1134, 1039, -652, 305, -101, 20, -1, 18, -109, 381,
+    -975, 2003, -3589, 6675, 28954, -83, -1110, 1028, -648, 304, -101, 20,
+    -1, 18, -108, 381, -976, 2011, -3612, 6751, 28932, -138, -1085, 1017,
+    -643, 302, -101, 20, -1, 18, -108, 381, -978, 2018, -3634, 6828,
+    28911, -193, -1061, 1006, -639, 301, -100, 20, -1, 18, -108, 381,
+    -980, 2025, -3657, 6905, 28888, -248, -1036, 995, -635, 300, -100, 20,
+    -1, 18, -108, 381, -981, 2032, -3679, 6982, 28866, -302, -1012, 984,
+    -630, 298, -100, 20, -1, 18, -108, 381, -983, 2040, -3702, 7059,
+    28843, -356, -988, 973, -626, 297, -99, 20, -1, 18, -107, 381,
+    -984, 2047, -3724, 7136, 28820, -410, -963, 962, -622, 295, -99, 20,
+    -1, 18, -107, 381, -986, 2054, -3746, 7214, 28796, -463, -939, 951,
+    -617, 294, -99, 19, -1, 18, -107, 381, -987, 2060, -3768, 7291,
+    28772, -517, -915, 940, -613, 293, -98, 19, -1, 17, -106, 381,
+    -989, 2067, -3790, 7369, 28747, -570, -891, 929, -608, 291, -98, 19,
+    -1, 17, -106, 381, -990, 2074, -3812, 7447, 28722, -622, -866, 918,
+    -604, 290, -98, 19, -1, 17, -106, 380, -991, 2081, -3834, 7525,
+    28697, -675, -842, 907, -600, 288, -97, 19, -1, 17, -106, 380,
+    -993, 2087, -3856, 7603, 28671, -727, -818, 896, -595, 287, -97, 19,
+    -1, 17, -105, 380, -994, 2094, -3877, 7681, 28645, -779, -794, 885,
+    -591, 285, -97, 19, -1, 17, -105, 380, -995, 2100, -3899, 7759,
+    28618, -831, -770, 874, -586, 284, -96, 19, -1, 17, -105, 380,
+    -996, 2107, -3920, 7838, 28591, -882, -746, 862, -582, 282, -96, 19,
+    -1, 17, -104, 379, -998, 2113, -3942, 7916, 28564, -933, -723, 851,
+    -577, 281, -96, 19, -1, 17, -104, 379, -999, 2119, -3963, 7995,
+    28536, -984, -699, 840, -573, 280, -95, 19, -1, 16, -104, 379,
+    -1000, 2125, -3984, 8074, 28508, -1034, -675, 829, -568, 278, -95, 19,
+    -1, 16, -103, 378, -1001, 2132, -4005, 8153, 28479, -1085, -651, 818,
+    -564, 277, -95, 19, -1, 16, -103, 378, -1002, 2138, -4026, 8232,
+    28450, -1135, -628, 807, -559, 275, -94, 19, -1, 16, -103, 378,
+    -1003, 2144, -4047, 8311, 28421, -1184, -604, 796, -555, 274, -94, 19,
+    -1, 16, -102, 377, -1003, 2149, -4068, 8390, 28391, -1234, -580, 785,
+    -550, 272, -93, 19, -1, 16, -102, 377, -1004, 2155, -4088, 8469,
+    28361, -1283, -557, 774, -546, 271, -93, 19, -1, 16, -102, 376,
+    -1005, 2161, -4109, 8549, 28331, -1332, -533, 763, -541, 269, -93, 18,
+    0, 15, -101, 376, -1006, 2167, -4129, 8628, 28300, -1380, -510, 752,
+    -536, 267, -92, 18, 0, 15, -101, 376, -1007, 2172, -4150, 8708,
+    28268, -1429, -487, 741, -532, 266, -92, 18, 0, 15, -100, 375,
+    -1007, 2178, -4170, 8788, 28237, -1477, -463, 730, -527, 264, -92, 18,
+    0, 15, -100, 375, -1008, 2183, -4190, 8868, 28205, -1524, -440, 719,
+    -523, 263, -91, 18, 0, 15, -100, 374, -1008, 2189, -4210, 8948,
+    28172, -1572, -417, 708, -518, 261, -91, 18, 0, 15, -99, 373,
+    -1009, 2194, -4230, 9028, 28139, -1619, -394, 697, -514, 260, -90, 18,
+    0, 15, -99, 373, -1009, 2199, -4250, 9108, 28106, -1666, -371, 686,
+    -509, 258, -90, 18, 0, 14, -98, 372, -1010, 2204, -4270, 9188,
+    28072, -1712, -348, 675, -504, 257, -90, 18, 0, 14, -98, 372,
+    -1010, 2209, -4289, 9268, 28038, -1759, -325, 664, -500, 255, -89, 18,
+    0, 14, -97, 371, -1011, 2214, -4309, 9349, 28004, -1805, -302, 653,
+    -495, 254, -89, 18, 0, 14, -97, 371, -1011, 2219, -4328, 9429,
+    27969, -1851, -279, 642, -491, 252, -88, 18, 0, 14, -96, 370,
+    -1011, 2224, -4347, 9510, 27934, -1896, -257, 631, -486, 250, -88, 18,
+    0, 14, -96, 369, -1012, 2229, -4366, 9590, 27898, -1941, -234, 620,
+    -481, 249, -88, 18, 0, 13, -96, 368, -1012, 2233, -4385, 9671,
+    27862, -1986, -211, 609, -477, 247, -87, 17, 0, 13, -95, 368,
+    -1012, 2238, -4404, 9752, 27826, -2031, -189, 598, -472, 246, -87, 17,
+    0, 13, -95, 367, -1012, 2242, -4423, 9833, 27789, -2075, -166, 587,
+    -467, 244, -86, 17, 0, 13, -94, 366, -1012, 2247, -4441, 9914,
+    27752, -2119, -144, 576, -463, 242, -86, 17, 0, 13, -94, 365,
+    -1012, 2251, -4460, 9995, 27715, -2163, -122, 565, -458, 241, -86, 17,
+    0, 13, -93, 365, -1012, 2255, -4478, 10076, 27677, -2206, -99, 554,
+    -453, 239, -85, 17, 0, 12, -92, 364, -1012, 2259, -4496, 10157,
+    27639, -2250, -77, 543, -449, 238, -85, 17, 0, 12, -92, 363,
+    -1012, 2263, -4515, 10238, 27600, -2292, -55, 532, -444, 236, -84, 17,
+    0, 12, -91, 362, -1012, 2267, -4533, 10319, 27561, -2335, -33, 522,
+    -440, 234, -84, 17, 0, 12, -91, 361, -1011, 2271, -4550, 10401,
+    27522, -2377, -11, 511, -435, 233, -83, 17, 0, 12, -90, 360,
+    -1011, 2275, -4568, 10482, 27482, -2419, 11, 500, -430, 231, -83, 17,
+    0, 11, -90, 359, -1011, 2278, -4586, 10564, 27442, -2461, 33, 489,
+    -426, 229, -83, 17, 0, 11, -89, 358, -1010, 2282, -4603, 10645,
+    27402, -2503, 55, 478, -421, 228, -82, 17, 0, 11, -89, 358,
+    -1010, 2286, -4620, 10727, 27361, -2544, 76, 467, -416, 226, -82, 16,
+    0, 11, -88, 357, -1010, 2289, -4637, 10808, 27320, -2585, 98, 457,
+    -412, 225, -81, 16, 0, 11, -87, 356, -1009, 2292, -4654, 10890,
+    27278, -2625, 119, 446, -407, 223, -81, 16, 0, 10, -87, 355,
+    -1008, 2296, -4671, 10972, 27237, -2665, 141, 435, -402, 221, -80, 16,
+    0, 10, -86, 353, -1008, 2299, -4688, 11054, 27194, -2705, 162, 425,
+    -398, 220, -80, 16, 0, 10, -86, 352, -1007, 2302, -4705, 11136,
+    27152, -2745, 183, 414, -393, 218, -79, 16, 0, 10, -85, 351,
+    -1007, 2305, -4721, 11217, 27109, -2785, 205, 403, -388, 216, -79, 16,
+    0, 10, -84, 350, -1006, 2308, -4737, 11299, 27065, -2824, 226, 392,
+    -384, 215, -79, 16, 0, 9, -84, 349, -1005, 2310, -4754, 11381,
+    27022, -2862, 247, 382, -379, 213, -78, 16, 0, 9, -83, 348,
+    -1004, 2313, -4769, 11463, 26978, -2901, 268, 371, -374, 211, -78, 16,
+    0, 9, -82, 347, -1003, 2316, -4785, 11545, 26933, -2939, 289, 361,
+    -370, 210, -77, 16, 0, 9, -82, 346, -1002, 2318, -4801, 11628,
+    26889, -2977, 309, 350, -365, 208, -77, 16, 0, 9, -81, 344,
+    -1001, 2321, -4817, 11710, 26844, -3015, 330, 339, -360, 206, -76, 16,
+    0, 8, -80, 343, -1000, 2323, -4832, 11792, 26798, -3052, 351, 329,
+    -356, 205, -76, 15, 1, 8, -80, 342, -999, 2325, -4847, 11874,
+    26752, -3089, 371, 318, -351, 203, -75, 15, 1, 8, -79, 341,
+    -998, 2327, -4862, 11956, 26706, -3126, 392, 308, -346, 201, -75, 15,
+    1, 8, -78, 339, -997, 2329, -4877, 12038, 26660, -3163, 412, 297,
+    -342, 200, -75, 15, 1, 7, -78, 338, -996, 2331, -4892, 12121,
+    26613, -3199, 433, 287, -337, 198, -74, 15, 1, 7, -77, 337,
+    -994, 2333, -4907, 12203, 26566, -3235, 453, 276, -332, 196, -74, 15,
+    1, 7, -76, 335, -993, 2335, -4921, 12285, 26518, -3270, 473, 266,
+    -328, 195, -73, 15, 1, 7, -75, 334, -992, 2337, -4935, 12368,
+    26470, -3306, 493, 256, -323, 193, -73, 15, 1, 7, -75, 332,
+    -990, 2338, -4949, 12450, 26422, -3341, 513, 245, -318, 191, -72, 15,
+    1, 6, -74, 331, -989, 2340, -4963, 12532, 26373, -3375, 533, 235,
+    -314, 189, -72, 15, 1, 6, -73, 329, -987, 2341, -4977, 12615,
+    26325, -3410, 552, 225, -309, 188, -71, 15, 1, 6, -73, 328,
+    -986, 2342, -4991, 12697, 26275, -3444, 572, 214, -305, 186, -71, 14,
+    1, 6, -72, 326, -984, 2343, -5004, 12779, 26226, -3478, 592, 204,
+    -300, 184, -70, 14, 1, 5, -71, 325, -982, 2344, -5018, 12862,
+    26176, -3511, 611, 194, -295, 183, -70, 14, 1, 5, -70, 323,
+    -981, 2345, -5031, 12944, 26126, -3545, 631, 184, -291, 181, -69, 14,
+    1, 5, -69, 322, -979, 2346, -5044, 13027, 26075, -3577, 650, 173,
+    -286, 179, -69, 14, 1, 5, -69, 320, -977, 2347, -5056, 13109,
+    26024, -3610, 669, 163, -282, 178, -68, 14, 1, 4, -68, 319,
+    -975, 2348, -5069, 13191, 25973, -3643, 688, 153, -277, 176, -68, 14,
+    1, 4, -67, 317, -973, 2348, -5081, 13274, 25921, -3675, 707, 143,
+    -272, 174, -68, 14, 1, 4, -66, 315, -971, 2349, -5094, 13356,
+    25869, -3706, 726, 133, -268, 173, -67, 14, 1, 3, -65, 314,
+    -969, 2349, -5106, 13439, 25817, -3738, 745, 123, -263, 171, -67, 14,
+    1, 3, -64, 312, -967, 2349, -5118, 13521, 25765, -3769, 764, 113,
+    -259, 169, -66, 14, 1, 3, -64, 310, -965, 2349, -5129, 13603,
+    25712, -3800, 782, 103, -254, 168, -66, 14, 1, 3, -63, 309,
+    -963, 2350, -5141, 13686, 25659, -3831, 801, 93, -249, 166, -65, 13,
+    1, 2, -62, 307, -961, 2349, -5152, 13768, 25605, -3861, 819, 83,
+    -245, 164, -65, 13, 1, 2, -61, 305, -958, 2349, -5164, 13850,
+    25551, -3891, 838, 73, -240, 162, -64, 13, 1, 2, -60, 303,
+    -956, 2349, -5175, 13933, 25497, -3921, 856, 63, -236, 161, -64, 13,
+    2, 2, -59, 301, -954, 2349, -5185, 14015, 25443, -3950, 874, 54,
+    -231, 159, -63, 13, 2, 1, -58, 300, -951, 2348, -5196, 14097,
+    25388, -3979, 892, 44, -227, 157, -63, 13, 2, 1, -58, 298,
+    -949, 2348, -5206, 14180, 25333, -4008, 910, 34, -222, 156, -62, 13,
+    2, 1, -57, 296, -946, 2347, -5217, 14262, 25278, -4037, 928, 24,
+    -218, 154, -62, 13, 2, 0, -56, 294, -944, 2346, -5227, 14344,
+    25222, -4065, 946, 14, -213, 152, -61, 13, 2, 0, -55, 292,
+    -941, 2345, -5237, 14426, 25166, -4093, 964, 5, -209, 151, -61, 13,
+    2, 0, -54, 290, -938, 2344, -5246, 14508, 25110, -4120, 981, -5,
+    -204, 149, -60, 13, 2, 0, -53, 288, -936, 2343, -5256, 14590,
+    25053, -4148, 999, -14, -200, 147, -60, 12, 2, -1, -52, 286,
+    -933, 2342, -5265, 14672, 24996, -4175, 1016, -24, -195, 146, -59, 12,
+    2, -1, -51, 284, -930, 2341, -5274, 14754, 24939, -4202, 1033, -34,
+    -191, 144, -59, 12, 2, -1, -50, 282, -927, 2339, -5283, 14836,
+    24881, -4228, 1050, -43, -186, 142, -59, 12, 2, -2, -49, 280,
+    -924, 2338, -5292, 14918, 24824, -4254, 1067, -53, -182, 141, -58, 12,
+    2, -2, -48, 278, -921, 2336, -5300, 15000, 24765, -4280, 1084, -62,
+    -178, 139, -58, 12, 2, -2, -47, 276, -918, 2334, -5309, 15082,
+    24707, -4306, 1101, -71, -173, 137, -57, 12, 2, -3, -46, 274,
+    -915, 2332, -5317, 15164, 24648, -4331, 1118, -81, -169, 136, -57, 12,
+    2, -3, -45, 271, -912, 2330, -5325, 15246, 24589, -4356, 1135, -90,
+    -164, 134, -56, 12, 2, -3, -44, 269, -909, 2328, -5332, 15327,
+    24530, -4381, 1151, -99, -160, 132, -56, 12, 2, -3, -43, 267,
+    -905, 2326, -5340, 15409, 24471, -4405, 1168, -109, -156, 130, -55, 12,
+    2, -4, -42, 265, -902, 2324, -5347, 15490, 24411, -4430, 1184, -118,
+    -151, 129, -55, 11, 2, -4, -41, 263, -899, 2322, -5354, 15572,
+    24350, -4454, 1200, -127, -147, 127, -54, 11, 2, -4, -40, 260,
+    -895, 2319, -5361, 15653, 24290, -4477, 1216, -136, -142, 125, -54, 11,
+    3, -5, -39, 258, -892, 2316, -5368, 15735, 24229, -4500, 1232, -145,
+    -138, 124, -53, 11, 3, -5, -38, 256, -888, 2314, -5374, 15816,
+    24168, -4523, 1248, -154, -134, 122, -53, 11, 3, -5, -37, 253,
+    -885, 2311, -5381, 15897, 24107, -4546, 1264, -163, -129, 121, -52, 11,
+    3, -6, -36, 251, -881, 2308, -5387, 15979, 24045, -4569, 1280, -172,
+    -125, 119, -52, 11, 3, -6, -35, 249, -877, 2305, -5393, 16060,
+    23984, -4591, 1295, -181, -121, 117, -51, 11, 3, -6, -34, 246,
+    -874, 2302, -5398, 16141, 23922, -4612, 1311, -190, -117, 116, -51, 11,
+    3, -7, -33, 244, -870, 2298, -5404, 16222, 23859, -4634, 1326, -199,
+    -112, 114, -50, 11, 3, -7, -32, 242, -866, 2295, -5409, 16303,
+    23797, -4655, 1341, -208, -108, 112, -50, 11, 3, -7, -30, 239,
+    -862, 2291, -5414, 16383, 23734, -4676, 1356, -217, -104, 111, -49, 10,
+    3, -8, -29, 237, -858, 2288, -5419, 16464, 23670, -4697, 1371, -225,
+    -100, 109, -49, 10, 3, -8, -28, 234, -854, 2284, -5423, 16545,
+    23607, -4717, 1386, -234, -95, 107, -49, 10, 3, -8, -27, 232,
+    -850, 2280, -5428, 16625, 23543, -4738, 1401, -243, -91, 106, -48, 10,
+    3, -9, -26, 229, -846, 2276, -5432, 16706, 23479, -4757, 1416, -251,
+    -87, 104, -48, 10, 3, -9, -25, 226, -842, 2272, -5436, 16786,
+    23415, -4777, 1430, -260, -83, 102, -47, 10, 3, -10, -24, 224,
+    -837, 2268, -5439, 16867, 23350, -4796, 1445, -269, -79, 101, -47, 10,
+    3, -10, -23, 221, -833, 2264, -5443, 16947, 23286, -4815, 1459, -277,
+    -74, 99, -46, 10, 3, -10, -21, 219, -829, 2259, -5446, 17027,
+    23221, -4834, 1474, -286, -70, 98, -46, 10, 4, -11, -20, 216,
+    -825, 2255, -5449, 17107, 23155, -4852, 1488, -294, -66, 96, -45, 10,
+    4, -11, -19, 213, -820, 2250, -5452, 17187, 23090, -4870, 1502, -302,
+    -62, 94, -45, 10, 4, -11, -18, 211, -816, 2245, -5454, 17267,
+    23024, -4888, 1516, -311, -58, 93, -44, 10, 4, -12, -17, 208,
+    -811, 2240, -5457, 17347, 22958, -4906, 1529, -319, -54, 91, -44, 9,
+    4, -12, -15, 205, -807, 2235, -5459, 17426, 22892, -4923, 1543, -327,
+    -50, 90, -43, 9, 4, -12, -14, 203, -802, 2230, -5461, 17506,
+    22825, -4940, 1557, -336, -46, 88, -43, 9, 4, -13, -13, 200,
+    -797, 2225, -5462, 17585, 22758, -4957, 1570, -344, -42, 86, -42, 9,
+    4, -13, -12, 197, -792, 2220, -5464, 17664, 22691, -4973, 1584, -352,
+    -38, 85, -42, 9, 4, -13, -11, 194, -788, 2214, -5465, 17744,
+    22624, -4989, 1597, -360, -34, 83, -41, 9, 4, -14, -9, 191,
+    -783, 2209, -5466, 17823, 22557, -5005, 1610, -368, -30, 82, -41, 9,
+    4, -14, -8, 188, -778, 2203, -5467, 17902, 22489, -5021, 1623, -376,
+    -26, 80, -41, 9, 4, -15, -7, 186, -773, 2197, -5467, 17980,
+    22421, -5036, 1636, -384, -22, 78, -40, 9, 4, -15, -6, 183,
+    -768, 2191, -5467, 18059, 22353, -5051, 1649, -392, -18, 77, -40, 9,
+    4, -15, -4, 180, -763, 2185, -5467, 18138, 22284, -5066, 1661, -400,
+    -14, 75, -39, 9, 4, -16, -3, 177, -758, 2179, -5467, 18216,
+    22216, -5080, 1674, -407, -10, 74, -39, 9, 4, -16, -2, 174,
+    -753, 2173, -5467, 18295, 22147, -5095, 1686, -415, -6, 72, -38, 8,
+    5, -17, -1, 171, -748, 2167, -5466, 18373, 22078, -5109, 1699, -423,
+    -2, 71, -38, 8, 5, -17, 1, 168, -742, 2160, -5465, 18451,
+    22008, -5122, 1711, -431, 2, 69, -37, 8, 5, -17, 2, 165,
+    -737, 2153, -5464, 18529, 21939, -5136, 1723, -438, 6, 67, -37, 8,
+    5, -18, 3, 162, -732, 2147, -5463, 18607, 21869, -5149, 1735, -446,
+    10, 66, -36, 8, 5, -18, 5, 159, -726, 2140, -5461, 18684,
+    21799, -5161, 1747, -453, 14, 64, -36, 8, 5, -18, 6, 156,
+    -721, 2133, -5459, 18762, 21729, -5174, 1759, -461, 17, 63, -36, 8,
+    5, -19, 7, 153, -715, 2126, -5457, 18839, 21658, -5186, 1770, -468,
+    21, 61, -35, 8, 5, -19, 8, 150, -710, 2119, -5454, 18917,
+    21587, -5198, 1782, -476, 25, 60, -35, 8, 5, -20, 10, 146,
+    -704, 2111, -5452, 18994, 21517, -5210, 1793, -483, 29, 58, -34, 8,
+    5, -20, 11, 143, -698, 2104, -5449, 19071, 21445, -5221, 1804, -490,
+    32, 57, -34, 8, 5, -20, 12, 140, -693, 2096, -5446, 19148,
+    21374, -5233, 1816, -498, 36, 55, -33, 8, 5, -21, 14, 137,
+    -687, 2089, -5442, 19224, 21303, -5244, 1827, -505, 40, 54, -33, 7,
+    5, -21, 15, 134, -681, 2081, -5439, 19301, 21231, -5254, 1838, -512,
+    44, 52, -32, 7, 5, -22, 16, 130, -675, 2073, -5435, 19377,
+    21159, -5265, 1848, -519, 47, 51, -32, 7, 6, -22, 18, 127,
+    -669, 2065, -5431, 19453, 21087, -5275, 1859, -526, 51, 49, -32, 7,
+    6, -23, 19, 124, -663, 2057, -5426, 19529, 21015, -5285, 1870, -533,
+    55, 48, -31, 7, 6, -23, 21, 121, -657, 2049, -5422, 19605,
+    20942, -5294, 1880, -540, 58, 46, -31, 7, 6, -23, 22, 117,
+    -651, 2040, -5417, 19681, 20869, -5303, 1891, -547, 62, 45, -30, 7,
+    6, -24, 23, 114, -645, 2032, -5412, 19757, 20797, -5313, 1901, -554,
+    65, 43, -30, 7, 6, -24, 25, 111, -639, 2023, -5406, 19832,
+    20723, -5321, 1911, -561, 69, 42, -29, 7, 6, -25, 26, 107,
+    -633, 2015, -5401, 19907, 20650, -5330, 1921, -568, 73, 40, -29, 7,
+    6, -25, 28, 104, -626, 2006, -5395, 19982, 20577, -5338, 1931, -574,
+    76, 39, -28, 7, 6, -25, 29, 101, -620, 1997, -5389, 20057,
+    20503, -5346, 1941, -581, 80, 38, -28, 7, 6, -26, 30, 97,
+    -614, 1988, -5382, 20132, 20429, -5354, 1950, -588, 83, 36, -28, 6,
+    6, -26, 32, 94, -607, 1978, -5375, 20207, 20355, -5361, 1960, -594,
+    87, 35, -27, 6, 6, -27, 33, 90, -601, 1969, -5368, 20281,
+    20281, -5368, 1969, -601, 90, 33, -27, 6, 6, -27, 35, 87,
+    -594, 1960, -5361, 20355, 20207, -5375, 1978, -607, 94, 32, -26, 6,
+    6, -28, 36, 83, -588, 1950, -5354, 20429, 20132, -5382, 1988, -614,
+    97, 30, -26, 6, 7, -28, 38, 80, -581, 1941, -5346, 20503,
+    20057, -5389, 1997, -620, 101, 29, -25, 6, 7, -28, 39, 76,
+    -574, 1931, -5338, 20577, 19982, -5395, 2006, -626, 104, 28, -25, 6,
+    7, -29, 40, 73, -568, 1921, -5330, 20650, 19907, -5401, 2015, -633,
+    107, 26, -25, 6, 7, -29, 42, 69, -561, 1911, -5321, 20723,
+    19832, -5406, 2023, -639, 111, 25, -24, 6, 7, -30, 43, 65,
+    -554, 1901, -5313, 20797, 19757, -5412, 2032, -645, 114, 23, -24, 6,
+    7, -30, 45, 62, -547, 1891, -5303, 20869, 19681, -5417, 2040, -651,
+    117, 22, -23, 6, 7, -31, 46, 58, -540, 1880, -5294, 20942,
+    19605, -5422, 2049, -657, 121, 21, -23, 6, 7, -31, 48, 55,
+    -533, 1870, -5285, 21015, 19529, -5426, 2057, -663, 124, 19, -23, 6,
+    7, -32, 49, 51, -526, 1859, -5275, 21087, 19453, -5431, 2065, -669,
+    127, 18, -22, 6, 7, -32, 51, 47, -519, 1848, -5265, 21159,
+    19377, -5435, 2073, -675, 130, 16, -22, 5, 7, -32, 52, 44,
+    -512, 1838, -5254, 21231, 19301, -5439, 2081, -681, 134, 15, -21, 5,
+    7, -33, 54, 40, -505, 1827, -5244, 21303, 19224, -5442, 2089, -687,
+    137, 14, -21, 5, 8, -33, 55, 36, -498, 1816, -5233, 21374,
+    19148, -5446, 2096, -693, 140, 12, -20, 5, 8, -34, 57, 32,
+    -490, 1804, -5221, 21445, 19071, -5449, 2104, -698, 143, 11, -20, 5,
+    8, -34, 58, 29, -483, 1793, -5210, 21517, 18994, -5452, 2111, -704,
+    146, 10, -20, 5, 8, -35, 60, 25, -476, 1782, -5198, 21587,
+    18917, -5454, 2119, -710, 150, 8, -19, 5, 8, -35, 61, 21,
+    -468, 1770, -5186, 21658, 18839, -5457, 2126, -715, 153, 7, -19, 5,
+    8, -36, 63, 17, -461, 1759, -5174, 21729, 18762, -5459, 2133, -721,
+    156, 6, -18, 5, 8, -36, 64, 14, -453, 1747, -5161, 21799,
+    18684, -5461, 2140, -726, 159, 5, -18, 5, 8, -36, 66, 10,
+    -446, 1735, -5149, 21869, 18607, -5463, 2147, -732, 162, 3, -18, 5,
+    8, -37, 67, 6, -438, 1723, -5136, 21939, 18529, -5464, 2153, -737,
+    165, 2, -17, 5, 8, -37, 69, 2, -431, 1711, -5122, 22008,
+    18451, -5465, 2160, -742, 168, 1, -17, 5, 8, -38, 71, -2,
+    -423, 1699, -5109, 22078, 18373, -5466, 2167, -748, 171, -1, -17, 5,
+    8, -38, 72, -6, -415, 1686, -5095, 22147, 18295, -5467, 2173, -753,
+    174, -2, -16, 4, 9, -39, 74, -10, -407, 1674, -5080, 22216,
+    18216, -5467, 2179, -758, 177, -3, -16, 4, 9, -39, 75, -14,
+    -400, 1661, -5066, 22284, 18138, -5467, 2185, -763, 180, -4, -15, 4,
+    9, -40, 77, -18, -392, 1649, -5051, 22353, 18059, -5467, 2191, -768,
+    183, -6, -15, 4, 9, -40, 78, -22, -384, 1636, -5036, 22421,
+    17980, -5467, 2197, -773, 186, -7, -15, 4, 9, -41, 80, -26,
+    -376, 1623, -5021, 22489, 17902, -5467, 2203, -778, 188, -8, -14, 4,
+    9, -41, 82, -30, -368, 1610, -5005, 22557, 17823, -5466, 2209, -783,
+    191, -9, -14, 4, 9, -41, 83, -34, -360, 1597, -4989, 22624,
+    17744, -5465, 2214, -788, 194, -11, -13, 4, 9, -42, 85, -38,
+    -352, 1584, -4973, 22691, 17664, -5464, 2220, -792, 197, -12, -13, 4,
+    9, -42, 86, -42, -344, 1570, -4957, 22758, 17585, -5462, 2225, -797,
+    200, -13, -13, 4, 9, -43, 88, -46, -336, 1557, -4940, 22825,
+    17506, -5461, 2230, -802, 203, -14, -12, 4, 9, -43, 90, -50,
+    -327, 1543, -4923, 22892, 17426, -5459, 2235, -807, 205, -15, -12, 4,
+    9, -44, 91, -54, -319, 1529, -4906, 22958, 17347, -5457, 2240, -811,
+    208, -17, -12, 4, 10, -44, 93, -58, -311, 1516, -4888, 23024,
+    17267, -5454, 2245, -816, 211, -18, -11, 4, 10, -45, 94, -62,
+    -302, 1502, -4870, 23090, 17187, -5452, 2250, -820, 213, -19, -11, 4,
+    10, -45, 96, -66, -294, 1488, -4852, 23155, 17107, -5449, 2255, -825,
+    216, -20, -11, 4, 10, -46, 98, -70, -286, 1474, -4834, 23221,
+    17027, -5446, 2259, -829, 219, -21, -10, 3, 10, -46, 99, -74,
+    -277, 1459, -4815, 23286, 16947, -5443, 2264, -833, 221, -23, -10, 3,
+    10, -47, 101, -79, -269, 1445, -4796, 23350, 16867, -5439, 2268, -837,
+    224, -24, -10, 3, 10, -47, 102, -83, -260, 1430, -4777, 23415,
+    16786, -5436, 2272, -842, 226, -25, -9, 3, 10, -48, 104, -87,
+    -251, 1416, -4757, 23479, 16706, -5432, 2276, -846, 229, -26, -9, 3,
+    10, -48, 106, -91, -243, 1401, -4738, 23543, 16625, -5428, 2280, -850,
+    232, -27, -8, 3, 10, -49, 107, -95, -234, 1386, -4717, 23607,
+    16545, -5423, 2284, -854, 234, -28, -8, 3, 10, -49, 109, -100,
+    -225, 1371, -4697, 23670, 16464, -5419, 2288, -858, 237, -29, -8, 3,
+    10, -49, 111, -104, -217, 1356, -4676, 23734, 16383, -5414, 2291, -862,
+    239, -30, -7, 3, 11, -50, 112, -108, -208, 1341, -4655, 23797,
+    16303, -5409, 2295, -866, 242, -32, -7, 3, 11, -50, 114, -112,
+    -199, 1326, -4634, 23859, 16222, -5404, 2298, -870, 244, -33, -7, 3,
+    11, -51, 116, -117, -190, 1311, -4612, 23922, 16141, -5398, 2302, -874,
+    246, -34, -6, 3, 11, -51, 117, -121, -181, 1295, -4591, 23984,
+    16060, -5393, 2305, -877, 249, -35, -6, 3, 11, -52, 119, -125,
+    -172, 1280, -4569, 24045, 15979, -5387, 2308, -881, 251, -36, -6, 3,
+    11, -52, 121, -129, -163, 1264, -4546, 24107, 15897, -5381, 2311, -885,
+    253, -37, -5, 3, 11, -53, 122, -134, -154, 1248, -4523, 24168,
+    15816, -5374, 2314, -888, 256, -38, -5, 3, 11, -53, 124, -138,
+    -145, 1232, -4500, 24229, 15735, -5368, 2316, -892, 258, -39, -5, 3,
+    11, -54, 125, -142, -136, 1216, -4477, 24290, 15653, -5361, 2319, -895,
+    260, -40, -4, 2, 11, -54, 127, -147, -127, 1200, -4454, 24350,
+    15572, -5354, 2322, -899, 263, -41, -4, 2, 11, -55, 129, -151,
+    -118, 1184, -4430, 24411, 15490, -5347, 2324, -902, 265, -42, -4, 2,
+    12, -55, 130, -156, -109, 1168, -4405, 24471, 15409, -5340, 2326, -905,
+    267, -43, -3, 2, 12, -56, 132, -160, -99, 1151, -4381, 24530,
+    15327, -5332, 2328, -909, 269, -44, -3, 2, 12, -56, 134, -164,
+    -90, 1135, -4356, 24589, 15246, -5325, 2330, -912, 271, -45, -3, 2,
+    12, -57, 136, -169, -81, 1118, -4331, 24648, 15164, -5317, 2332, -915,
+    274, -46, -3, 2, 12, -57, 137, -173, -71, 1101, -4306, 24707,
+    15082, -5309, 2334, -918, 276, -47, -2, 2, 12, -58, 139, -178,
+    -62, 1084, -4280, 24765, 15000, -5300, 2336, -921, 278, -48, -2, 2,
+    12, -58, 141, -182, -53, 1067, -4254, 24824, 14918, -5292, 2338, -924,
+    280, -49, -2, 2, 12, -59, 142, -186, -43, 1050, -4228, 24881,
+    14836, -5283, 2339, -927, 282, -50, -1, 2, 12, -59, 144, -191,
+    -34, 1033, -4202, 24939, 14754, -5274, 2341, -930, 284, -51, -1, 2,
+    12, -59, 146, -195, -24, 1016, -4175, 24996, 14672, -5265, 2342, -933,
+    286, -52, -1, 2, 12, -60, 147, -200, -14, 999, -4148, 25053,
+    14590, -5256, 2343, -936, 288, -53, 0, 2, 13, -60, 149, -204,
+    -5, 981, -4120, 25110, 14508, -5246, 2344, -938, 290, -54, 0, 2,
+    13, -61, 151, -209, 5, 964, -4093, 25166, 14426, -5237, 2345, -941,
+    292, -55, 0, 2, 13, -61, 152, -213, 14, 946, -4065, 25222,
+    14344, -5227, 2346, -944, 294, -56, 0, 2, 13, -62, 154, -218,
+    24, 928, -4037, 25278, 14262, -5217, 2347, -946, 296, -57, 1, 2,
+    13, -62, 156, -222, 34, 910, -4008, 25333, 14180, -5206, 2348, -949,
+    298, -58, 1, 2, 13, -63, 157, -227, 44, 892, -3979, 25388,
+    14097, -5196, 2348, -951, 300, -58, 1, 2, 13, -63, 159, -231,
+    54, 874, -3950, 25443, 14015, -5185, 2349, -954, 301, -59, 2, 2,
+    13, -64, 161, -236, 63, 856, -3921, 25497, 13933, -5175, 2349, -956,
+    303, -60, 2, 1, 13, -64, 162, -240, 73, 838, -3891, 25551,
+    13850, -5164, 2349, -958, 305, -61, 2, 1, 13, -65, 164, -245,
+    83, 819, -3861, 25605, 13768, -5152, 2349, -961, 307, -62, 2, 1,
+    13, -65, 166, -249, 93, 801, -3831, 25659, 13686, -5141, 2350, -963,
+    309, -63, 3, 1, 14, -66, 168, -254, 103, 782, -3800, 25712,
+    13603, -5129, 2349, -965, 310, -64, 3, 1, 14, -66, 169, -259,
+    113, 764, -3769, 25765, 13521, -5118, 2349, -967, 312, -64, 3, 1,
+    14, -67, 171, -263, 123, 745, -3738, 25817, 13439, -5106, 2349, -969,
+    314, -65, 3, 1, 14, -67, 173, -268, 133, 726, -3706, 25869,
+    13356, -5094, 2349, -971, 315, -66, 4, 1, 14, -68, 174, -272,
+    143, 707, -3675, 25921, 13274, -5081, 2348, -973, 317, -67, 4, 1,
+    14, -68, 176, -277, 153, 688, -3643, 25973, 13191, -5069, 2348, -975,
+    319, -68, 4, 1, 14, -68, 178, -282, 163, 669, -3610, 26024,
+    13109, -5056, 2347, -977, 320, -69, 5, 1, 14, -69, 179, -286,
+    173, 650, -3577, 26075, 13027, -5044, 2346, -979, 322, -69, 5, 1,
+    14, -69, 181, -291, 184, 631, -3545, 26126, 12944, -5031, 2345, -981,
+    323, -70, 5, 1, 14, -70, 183, -295, 194, 611, -3511, 26176,
+    12862, -5018, 2344, -982, 325, -71, 5, 1, 14, -70, 184, -300,
+    204, 592, -3478, 26226, 12779, -5004, 2343, -984, 326, -72, 6, 1,
+    14, -71, 186, -305, 214, 572, -3444, 26275, 12697, -4991, 2342, -986,
+    328, -73, 6, 1, 15, -71, 188, -309, 225, 552, -3410, 26325,
+    12615, -4977, 2341, -987, 329, -73, 6, 1, 15, -72, 189, -314,
+    235, 533, -3375, 26373, 12532, -4963, 2340, -989, 331, -74, 6, 1,
+    15, -72, 191, -318, 245, 513, -3341, 26422, 12450, -4949, 2338, -990,
+    332, -75, 7, 1, 15, -73, 193, -323, 256, 493, -3306, 26470,
+    12368, -4935, 2337, -992, 334, -75, 7, 1, 15, -73, 195, -328,
+    266, 473, -3270, 26518, 12285, -4921, 2335, -993, 335, -76, 7, 1,
+    15, -74, 196, -332, 276, 453, -3235, 26566, 12203, -4907, 2333, -994,
+    337, -77, 7, 1, 15, -74, 198, -337, 287, 433, -3199, 26613,
+    12121, -4892, 2331, -996, 338, -78, 7, 1, 15, -75, 200, -342,
+    297, 412, -3163, 26660, 12038, -4877, 2329, -997, 339, -78, 8, 1,
+    15, -75, 201, -346, 308, 392, -3126, 26706, 11956, -4862, 2327, -998,
+    341, -79, 8, 1, 15, -75, 203, -351, 318, 371, -3089, 26752,
+    11874, -4847, 2325, -999, 342, -80, 8, 1, 15, -76, 205, -356,
+    329, 351, -3052, 26798, 11792, -4832, 2323, -1000, 343, -80, 8, 0,
+    16, -76, 206, -360, 339, 330, -3015, 26844, 11710, -4817, 2321, -1001,
+    344, -81, 9, 0, 16, -77, 208, -365, 350, 309, -2977, 26889,
+    11628, -4801, 2318, -1002, 346, -82, 9, 0, 16, -77, 210, -370,
+    361, 289, -2939, 26933, 11545, -4785, 2316, -1003, 347, -82, 9, 0,
+    16, -78, 211, -374, 371, 268, -2901, 26978, 11463, -4769, 2313, -1004,
+    348, -83, 9, 0, 16, -78, 213, -379, 382, 247, -2862, 27022,
+    11381, -4754, 2310, -1005, 349, -84, 9, 0, 16, -79, 215, -384,
+    392, 226, -2824, 27065, 11299, -4737, 2308, -1006, 350, -84, 10, 0,
+    16, -79, 216, -388, 403, 205, -2785, 27109, 11217, -4721, 2305, -1007,
+    351, -85, 10, 0, 16, -79, 218, -393, 414, 183, -2745, 27152,
+    11136, -4705, 2302, -1007, 352, -86, 10, 0, 16, -80, 220, -398,
+    425, 162, -2705, 27194, 11054, -4688, 2299, -1008, 353, -86, 10, 0,
+    16, -80, 221, -402, 435, 141, -2665, 27237, 10972, -4671, 2296, -1008,
+    355, -87, 10, 0, 16, -81, 223, -407, 446, 119, -2625, 27278,
+    10890, -4654, 2292, -1009, 356, -87, 11, 0, 16, -81, 225, -412,
+    457, 98, -2585, 27320, 10808, -4637, 2289, -1010, 357, -88, 11, 0,
+    16, -82, 226, -416, 467, 76, -2544, 27361, 10727, -4620, 2286, -1010,
+    358, -89, 11, 0, 17, -82, 228, -421, 478, 55, -2503, 27402,
+    10645, -4603, 2282, -1010, 358, -89, 11, 0, 17, -83, 229, -426,
+    489, 33, -2461, 27442, 10564, -4586, 2278, -1011, 359, -90, 11, 0,
+    17, -83, 231, -430, 500, 11, -2419, 27482, 10482, -4568, 2275, -1011,
+    360, -90, 12, 0, 17, -83, 233, -435, 511, -11, -2377, 27522,
+    10401, -4550, 2271, -1011, 361, -91, 12, 0, 17, -84, 234, -440,
+    522, -33, -2335, 27561, 10319, -4533, 2267, -1012, 362, -91, 12, 0,
+    17, -84, 236, -444, 532, -55, -2292, 27600, 10238, -4515, 2263, -1012,
+    363, -92, 12, 0, 17, -85, 238, -449, 543, -77, -2250, 27639,
+    10157, -4496, 2259, -1012, 364, -92, 12, 0, 17, -85, 239, -453,
+    554, -99, -2206, 27677, 10076, -4478, 2255, -1012, 365, -93, 13, 0,
+    17, -86, 241, -458, 565, -122, -2163, 27715, 9995, -4460, 2251, -1012,
+    365, -94, 13, 0, 17, -86, 242, -463, 576, -144, -2119, 27752,
+    9914, -4441, 2247, -1012, 366, -94, 13, 0, 17, -86, 244, -467,
+    587, -166, -2075, 27789, 9833, -4423, 2242, -1012, 367, -95, 13, 0,
+    17, -87, 246, -472, 598, -189, -2031, 27826, 9752, -4404, 2238, -1012,
+    368, -95, 13, 0, 17, -87, 247, -477, 609, -211, -1986, 27862,
+    9671, -4385, 2233, -1012, 368, -96, 13, 0, 18, -88, 249, -481,
+    620, -234, -1941, 27898, 9590, -4366, 2229, -1012, 369, -96, 14, 0,
+    18, -88, 250, -486, 631, -257, -1896, 27934, 9510, -4347, 2224, -1011,
+    370, -96, 14, 0, 18, -88, 252, -491, 642, -279, -1851, 27969,
+    9429, -4328, 2219, -1011, 371, -97, 14, 0, 18, -89, 254, -495,
+    653, -302, -1805, 28004, 9349, -4309, 2214, -1011, 371, -97, 14, 0,
+    18, -89, 255, -500, 664, -325, -1759, 28038, 9268, -4289, 2209, -1010,
+    372, -98, 14, 0, 18, -90, 257, -504, 675, -348, -1712, 28072,
+    9188, -4270, 2204, -1010, 372, -98, 14, 0, 18, -90, 258, -509,
+    686, -371, -1666, 28106, 9108, -4250, 2199, -1009, 373, -99, 15, 0,
+    18, -90, 260, -514, 697, -394, -1619, 28139, 9028, -4230, 2194, -1009,
+    373, -99, 15, 0, 18, -91, 261, -518, 708, -417, -1572, 28172,
+    8948, -4210, 2189, -1008, 374, -100, 15, 0, 18, -91, 263, -523,
+    719, -440, -1524, 28205, 8868, -4190, 2183, -1008, 375, -100, 15, 0,
+    18, -92, 264, -527, 730, -463, -1477, 28237, 8788, -4170, 2178, -1007,
+    375, -100, 15, 0, 18, -92, 266, -532, 741, -487, -1429, 28268,
+    8708, -4150, 2172, -1007, 376, -101, 15, 0, 18, -92, 267, -536,
+    752, -510, -1380, 28300, 8628, -4129, 2167, -1006, 376, -101, 15, 0,
+    18, -93, 269, -541, 763, -533, -1332, 28331, 8549, -4109, 2161, -1005,
+    376, -102, 16, -1, 19, -93, 271, -546, 774, -557, -1283, 28361,
+    8469, -4088, 2155, -1004, 377, -102, 16, -1, 19, -93, 272, -550,
+    785, -580, -1234, 28391, 8390, -4068, 2149, -1003, 377, -102, 16, -1,
+    19, -94, 274, -555, 796, -604, -1184, 28421, 8311, -4047, 2144, -1003,
+    378, -103, 16, -1, 19, -94, 275, -559, 807, -628, -1135, 28450,
+    8232, -4026, 2138, -1002, 378, -103, 16, -1, 19, -95, 277, -564,
+    818, -651, -1085, 28479, 8153, -4005, 2132, -1001, 378, -103, 16, -1,
+    19, -95, 278, -568, 829, -675, -1034, 28508, 8074, -3984, 2125, -1000,
+    379, -104, 16, -1, 19, -95, 280, -573, 840, -699, -984, 28536,
+    7995, -3963, 2119, -999, 379, -104, 17, -1, 19, -96, 281, -577,
+    851, -723, -933, 28564, 7916, -3942, 2113, -998, 379, -104, 17, -1,
+    19, -96, 282, -582, 862, -746, -882, 28591, 7838, -3920, 2107, -996,
+    380, -105, 17, -1, 19, -96, 284, -586, 874, -770, -831, 28618,
+    7759, -3899, 2100, -995, 380, -105, 17, -1, 19, -97, 285, -591,
+    885, -794, -779, 28645, 7681, -3877, 2094, -994, 380, -105, 17, -1,
+    19, -97, 287, -595, 896, -818, -727, 28671, 7603, -3856, 2087, -993,
+    380, -106, 17, -1, 19, -97, 288, -600, 907, -842, -675, 28697,
+    7525, -3834, 2081, -991, 380, -106, 17, -1, 19, -98, 290, -604,
+    918, -866, -622, 28722, 7447, -3812, 2074, -990, 381, -106, 17, -1,
+    19, -98, 291, -608, 929, -891, -570, 28747, 7369, -3790, 2067, -989,
+    381, -106, 17, -1, 19, -98, 293, -613, 940, -915, -517, 28772,
+    7291, -3768, 2060, -987, 381, -107, 18, -1, 19, -99, 294, -617,
+    951, -939, -463, 28796, 7214, -3746, 2054, -986, 381, -107, 18, -1,
+    20, -99, 295, -622, 962, -963, -410, 28820, 7136, -3724, 2047, -984,
+    381, -107, 18, -1, 20, -99, 297, -626, 973, -988, -356, 28843,
+    7059, -3702, 2040, -983, 381, -108, 18, -1, 20, -100, 298, -630,
+    984, -1012, -302, 28866, 6982, -3679, 2032, -981, 381, -108, 18, -1,
+    20, -100, 300, -635, 995, -1036, -248, 28888, 6905, -3657, 2025, -980,
+    381, -108, 18, -1, 20, -100, 301, -639, 1006, -1061, -193, 28911,
+    6828, -3634, 2018, -978, 381, -108, 18, -1, 20, -101, 302, -643,
+    1017, -1085, -138, 28932, 6751, -3612, 2011, -976, 381, -108, 18, -1,
+    20, -101, 304, -648, 1028, -1110, -83, 28954, 6675, -3589, 2003, -975,
+    381, -109, 18, -1, 20, -101, 305, -652, 1039, -1134, -28, 28975,
+    6598, -3566, 1996, -973, 381, -109, 18, -1, 20, -102, 306, -656,
+    1050, -1159, 28, 28995, 6522, -3544, 1989, -971, 381, -109, 19, -1,
+    20, -102, 308, -661, 1061, -1184, 84, 29015, 6446, -3521, 1981, -969,
+    381, -109, 19, -1, 20, -102, 309, -665, 1072, -1208, 140, 29035,
+    6370, -3498, 1973, -967, 381, -109, 19, -1, 20, -103, 310, -669,
+    1083, -1233, 196, 29054, 6294, -3475, 1966, -965, 381, -110, 19, -1,
+    20, -103, 312, -673, 1094, -1258, 253, 29073, 6218, -3452, 1958, -964,
+    381, -110, 19, -1, 20, -103, 313, -678, 1105, -1282, 310, 29091,
+    6143, -3429, 1950, -962, 381, -110, 19, -1, 20, -103, 314, -682,
+    1116, -1307, 367, 29109, 6067, -3405, 1942, -960, 381, -110, 19, -1,
+    20, -104, 315, -686, 1127, -1332, 425, 29127, 5992, -3382, 1935, -958,
+    380, -110, 19, -1, 20, -104, 317, -690, 1138, -1357, 482, 29144,
+    5917, -3359, 1927, -955, 380, -110, 19, -1, 20, -104, 318, -694,
+    1148, -1381, 540, 29161, 5842, -3335, 1919, -953, 380, -111, 19, -1,
+    20, -104, 319, -699, 1159, -1406, 599, 29177, 5767, -3312, 1911, -951,
+    380, -111, 19, -1, 20, -105, 321, -703, 1170, -1431, 657, 29193,
+    5693, -3288, 1902, -949, 380, -111, 19, -1, 20, -105, 322, -707,
+    1181, -1456, 716, 29209, 5618, -3265, 1894, -947, 379, -111, 19, -1,
+    20, -105, 323, -711, 1192, -1481, 775, 29224, 5544, -3241, 1886, -944,
+    379, -111, 20, -1, 20, -105, 324, -715, 1203, -1506, 834, 29239,
+    5470, -3217, 1878, -942, 379, -111, 20, -1, 21, -106, 325, -719,
+    1213, -1531, 894, 29253, 5396, -3193, 1869, -940, 378, -111, 20, -1,
+    21, -106, 327, -723, 1224, -1556, 953, 29267, 5322, -3170, 1861, -937,
+    378, -111, 20, -1, 21, -106, 328, -727, 1235, -1581, 1013, 29281,
+    5248, -3146, 1852, -935, 378, -112, 20, -1, 21, -106, 329, -731,
+    1246, -1606, 1074, 29294, 5175, -3122, 1844, -933, 377, -112, 20, -1,
+    21, -107, 330, -735, 1256, -1631, 1134, 29306, 5102, -3098, 1835, -930,
+    377, -112, 20, -1, 21, -107, 331, -739, 1267, -1656, 1195, 29318,
+    5029, -3074, 1827, -928, 377, -112, 20, -1, 21, -107, 332, -743,
+    1278, -1681, 1256, 29330, 4956, -3050, 1818, -925, 376, -112, 20, -1,
+    21, -107, 334, -747, 1288, -1706, 1317, 29342, 4883, -3025, 1809, -923,
+    376, -112, 20, -1, 21, -108, 335, -751, 1299, -1731, 1379, 29353,
+    4810, -3001, 1801, -920, 375, -112, 20, -1, 21, -108, 336, -755,
+    1310, -1756, 1440, 29363, 4738, -2977, 1792, -917, 375, -112, 20, -1,
+    21, -108, 337, -759, 1320, -1782, 1502, 29373, 4666, -2953, 1783, -915,
+    375, -112, 20, -1, 21, -108, 338, -763, 1331, -1807, 1564, 29383,
+    4594, -2928, 1774, -912, 374, -112, 20, -1, 21, -108, 339, -766,
+    1341, -1832, 1627, 29392, 4522, -2904, 1765, -909, 374, -112, 20, -1,
+    21, -109, 340, -770, 1352, -1857, 1690, 29401, 4450, -2880, 1756, -907,
+    373, -112, 20, -1, 21, -109, 341, -774, 1362, -1882, 1752, 29410,
+    4379, -2855, 1747, -904, 373, -112, 20, -1, 21, -109, 342, -778,
+    1373, -1907, 1816, 29418, 4308, -2831, 1738, -901, 372, -112, 20, -1,
+    21, -109, 343, -782, 1383, -1932, 1879, 29425, 4237, -2806, 1729, -898,
+    371, -112, 20, -1, 21, -109, 344, -785, 1394, -1958, 1943, 29432,
+    4166, -2782, 1719, -895, 371, -112, 21, -1, 21, -109, 345, -789,
+    1404, -1983, 2006, 29439, 4095, -2757, 1710, -892, 370, -112, 21, -1,
+    21, -110, 346, -793, 1414, -2008, 2070, 29445, 4025, -2732, 1701, -889,
+    370, -112, 21, -1, 21, -110, 347, -797, 1425, -2033, 2135, 29451,
+    3954, -2708, 1691, -887, 369, -112, 21, -1, 21, -110, 348, -800,
+    1435, -2058, 2199, 29457, 3884, -2683, 1682, -884, 368, -112, 21, -1,
+    21, -110, 349, -804, 1445, -2083, 2264, 29462, 3814, -2658, 1673, -881,
+    368, -112, 21, -1, 21, -110, 350, -807, 1456, -2108, 2329, 29467,
+    3745, -2633, 1663, -877, 367, -112, 21, -1, 21, -110, 351, -811,
+    1466, -2134, 2394, 29471, 3675, -2609, 1654, -874, 366, -112, 21, -1,
+    21, -110, 352, -815, 1476, -2159, 2460, 29475, 3606, -2584, 1644, -871,
+    366, -112, 21, -1, 21, -111, 353, -818, 1486, -2184, 2525, 29478,
+    3537, -2559, 1635, -868, 365, -112, 21, -1, 21, -111, 354, -822,
+    1496, -2209, 2591, 29481, 3468, -2534, 1625, -865, 364, -112, 21, -1,
+    21, -111, 355, -825, 1506, -2234, 2657, 29483, 3399, -2509, 1615, -862,
+    364, -112, 21, -1, 21, -111, 356, -829, 1517, -2259, 2724, 29486,
+    3331, -2484, 1606, -859, 363, -112, 21, -1, 21, -111, 356, -832,
+    1527, -2284, 2790, 29487, 3262, -2459, 1596, -855, 362, -112, 21, -1,
+    21, -111, 357, -835, 1537, -2309, 2857, 29489, 3194, -2434, 1586, -852,
+    361, -112, 21, -1, 21, -111, 358, -839, 1547, -2334, 2924, 29489,
+    3126, -2409, 1576, -849, 361, -112, 21, -1, 21, -111, 359, -842,
+    1556, -2359, 2991, 29490, 3059, -2384, 1566, -846, 360, -111, 21, -1,
+};
+
+}  // namespace
+
+// 21 banks, 125808 bytes.
+const PolyphaseBankTable kPolyphaseBankTables[] = {
+    {1U, 1U, 16U, kBank1x1x16},
+    {1U, 2U, 32U, kBank1x2x32},
+    {1U, 3U, 48U, kBank1x3x48},
+    {1U, 6U, 64U, kBank1x6x64},
+    {2U, 1U, 16U, kBank2x1x16},
+    {2U, 3U, 24U, kBank2x3x24},
+    {3U, 1U, 16U, kBank3x1x16},
+    {3U, 2U, 16U, kBank3x2x16},
+    {6U, 1U, 16U, kBank6x1x16},
+    {80U, 147U, 32U, kBank80x147x32},
+    {80U, 441U, 64U, kBank80x441x64},
+    {147U, 80U, 16U, kBank147x80x16},
+    {147U, 160U, 20U, kBank147x160x20},
+    {147U, 320U, 36U, kBank147x320x36},
+    {160U, 147U, 16U, kBank160x147x16},
+    {160U, 441U, 48U, kBank160x441x48},
+    {320U, 147U, 16U, kBank320x147x16},
+    {320U, 441U, 24U, kBank320x441x24},
+    {441U, 80U, 16U, kBank441x80x16},
+    {441U, 160U, 16U, kBank441x160x16},
+    {441U, 320U, 16U, kBank441x320x16},
+};
+
+const size_t kPolyphaseBankTableCount = sizeof(kPolyphaseBankTables) / sizeof(kPolyphaseBankTables[0]);
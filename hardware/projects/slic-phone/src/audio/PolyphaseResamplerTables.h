@@ -0,0 +1,19 @@
+#ifndef POLYPHASE_RESAMPLER_TABLES_H
+#define POLYPHASE_RESAMPLER_TABLES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Q15 banks designed offline (scripts/gen_resampler_tables.py) for the common
+// media/codec rate pairs; coefficients are phase-major, `taps` per phase.
+struct PolyphaseBankTable {
+    uint16_t up;
+    uint16_t down;
+    uint16_t taps;
+    const int16_t* coeffs;
+};
+
+extern const PolyphaseBankTable kPolyphaseBankTables[];
+extern const size_t kPolyphaseBankTableCount;
+
+#endif  // POLYPHASE_RESAMPLER_TABLES_H
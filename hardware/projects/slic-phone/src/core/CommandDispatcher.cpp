@@ -1,6 +1,259 @@
 #include "core/CommandDispatcher.h"
 
 #include <algorithm>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+
+constexpr size_t kCompatBodyCapacity = 512U;
+
+char upperAscii(char c) {
+    return (c >= 'a' && c <= 'z') ? static_cast<char>(c - ('a' - 'A')) : c;
+}
+
+bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// <0, 0, >0 like strcmp, with `text` folded to upper case.
+int compareName(const char* text, size_t len, const char* name) {
+    for (size_t i = 0; i < len; ++i) {
+        const unsigned char lhs = static_cast<unsigned char>(upperAscii(text[i]));
+        const unsigned char rhs = static_cast<unsigned char>(name[i]);
+        if (rhs == '\0' || lhs != rhs) {
+            return static_cast<int>(lhs) - static_cast<int>(rhs);
+        }
+    }
+    return (name[len] == '\0') ? 0 : -1;
+}
+
+CommandArgView trimView(const char* data, size_t len) {
+    while (len > 0U && isBlank(*data)) {
+        ++data;
+        --len;
+    }
+    while (len > 0U && isBlank(data[len - 1U])) {
+        --len;
+    }
+    CommandArgView view;
+    view.data = data;
+    view.size = len;
+    return view;
+}
+
+void copyToResponse(const DispatchWriter& writer, DispatchResponse& res) {
+    res.ok = writer.ok();
+    res.code = writer.code();
+    if (writer.length() == 0U) {
+        return;
+    }
+    if (writer.isJson()) {
+        res.json = writer.body();
+    } else {
+        res.raw = writer.body();
+    }
+}
+
+}  // namespace
+
+bool CommandArgView::equalsIgnoreCase(const char* text) const {
+    if (text == nullptr) {
+        return size == 0U;
+    }
+    for (size_t i = 0; i < size; ++i) {
+        if (text[i] == '\0' || upperAscii(data[i]) != upperAscii(text[i])) {
+            return false;
+        }
+    }
+    return text[size] == '\0';
+}
+
+bool CommandArgView::nextToken(CommandArgView& token) {
+    while (size > 0U && isBlank(*data)) {
+        ++data;
+        --size;
+    }
+    if (size == 0U) {
+        token = CommandArgView();
+        return false;
+    }
+
+    size_t end = 0U;
+    size_t skip = 0U;
+    if (*data == '"') {
+        end = 1U;
+        bool escaped = false;
+        while (end < size && (escaped || data[end] != '"')) {
+            escaped = !escaped && data[end] == '\\';
+            ++end;
+        }
+        token.data = data + 1U;
+        token.size = end - 1U;
+        skip = (end < size) ? end + 1U : end;
+    } else {
+        while (end < size && !isBlank(data[end])) {
+            ++end;
+        }
+        token.data = data;
+        token.size = end;
+        skip = end;
+    }
+    data += skip;
+    size -= skip;
+    return true;
+}
+
+bool CommandArgView::toInt32(int32_t& out) const {
+    size_t i = 0U;
+    bool negative = false;
+    if (i < size && (data[i] == '-' || data[i] == '+')) {
+        negative = data[i] == '-';
+        ++i;
+    }
+    if (i == size) {
+        return false;
+    }
+    int64_t value = 0;
+    for (; i < size; ++i) {
+        if (data[i] < '0' || data[i] > '9') {
+            return false;
+        }
+        value = value * 10 + (data[i] - '0');
+        if (value > 2147483648LL) {
+            return false;
+        }
+    }
+    value = negative ? -value : value;
+    if (value > 2147483647LL) {
+        return false;
+    }
+    out = static_cast<int32_t>(value);
+    return true;
+}
+
+DispatchWriter::DispatchWriter(char* buffer, size_t capacity) : buffer_(buffer), capacity_(capacity) {
+    reset();
+}
+
+void DispatchWriter::reset() {
+    len_ = 0U;
+    ok_ = true;
+    json_ = false;
+    truncated_ = false;
+    code_[0] = '\0';
+    if (buffer_ != nullptr && capacity_ > 0U) {
+        buffer_[0] = '\0';
+    }
+}
+
+void DispatchWriter::setCode(const char* code) {
+    setCode(code, nullptr, 0U);
+}
+
+void DispatchWriter::setCode(const char* code, const char* detail, size_t detail_len) {
+    size_t len = 0U;
+    if (code != nullptr) {
+        while (code[len] != '\0' && len + 1U < kCodeCapacity) {
+            code_[len] = code[len];
+            ++len;
+        }
+    }
+    if (detail != nullptr && detail_len > 0U && len + 2U < kCodeCapacity) {
+        code_[len++] = ' ';
+        for (size_t i = 0U; i < detail_len && len + 1U < kCodeCapacity; ++i) {
+            code_[len++] = upperAscii(detail[i]);
+        }
+    }
+    code_[len] = '\0';
+}
+
+bool DispatchWriter::print(const char* text) {
+    return print(text, (text != nullptr) ? strlen(text) : 0U);
+}
+
+bool DispatchWriter::print(const char* text, size_t len) {
+    if (buffer_ == nullptr || capacity_ == 0U) {
+        truncated_ = truncated_ || len > 0U;
+        return len == 0U;
+    }
+    const size_t room = capacity_ - 1U - len_;
+    const size_t copy = std::min(room, len);
+    memcpy(buffer_ + len_, text, copy);
+    len_ += copy;
+    buffer_[len_] = '\0';
+    if (copy < len) {
+        truncated_ = true;
+        return false;
+    }
+    return true;
+}
+
+bool DispatchWriter::printf(const char* format, ...) {
+    if (buffer_ == nullptr || capacity_ == 0U) {
+        truncated_ = true;
+        return false;
+    }
+    const size_t room = capacity_ - len_;
+    va_list args;
+    va_start(args, format);
+    const int written = vsnprintf(buffer_ + len_, room, format, args);
+    va_end(args);
+    if (written < 0) {
+        buffer_[len_] = '\0';
+        return false;
+    }
+    if (static_cast<size_t>(written) >= room) {
+        len_ = capacity_ - 1U;
+        truncated_ = true;
+        return false;
+    }
+    len_ += static_cast<size_t>(written);
+    return true;
+}
+
+bool DispatchWriter::printJsonString(const char* text) {
+    bool ok = print("\"", 1U);
+    for (const char* p = (text != nullptr) ? text : ""; *p != '\0'; ++p) {
+        const char c = *p;
+        if (c == '"' || c == '\\') {
+            const char escaped[2] = {'\\', c};
+            ok = print(escaped, 2U) && ok;
+        } else if (c == '\n') {
+            ok = print("\\n", 2U) && ok;
+        } else if (c == '\r') {
+            ok = print("\\r", 2U) && ok;
+        } else if (c == '\t') {
+            ok = print("\\t", 2U) && ok;
+        } else if (static_cast<unsigned char>(c) < 0x20U) {
+            ok = printf("\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(c))) && ok;
+        } else {
+            ok = print(&c, 1U) && ok;
+        }
+    }
+    return print("\"", 1U) && ok;
+}
+
+bool CommandDispatcher::setStaticCommands(const StaticCommand* table, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const char* name = table[i].name;
+        if (name == nullptr || name[0] == '\0' || table[i].handler == nullptr) {
+            return false;
+        }
+        for (const char* p = name; *p != '\0'; ++p) {
+            if (*p != upperAscii(*p) || isBlank(*p)) {
+                return false;
+            }
+        }
+        if (i > 0U && strcmp(table[i - 1U].name, name) >= 0) {
+            return false;
+        }
+    }
+    static_commands_ = table;
+    static_count_ = count;
+    return true;
+}
 
 void CommandDispatcher::registerCommand(const String& name, Handler handler) {
     const String key = normalizeCommand(name);
@@ -14,6 +267,54 @@ void CommandDispatcher::registerCommand(const String& name, Handler handler) {
     handlers_[key] = std::move(handler);
 }
 
+bool CommandDispatcher::dispatch(const char* line, size_t len, DispatchWriter& out) const {
+    out.reset();
+    CommandArgView args = trimView((line != nullptr) ? line : "", (line != nullptr) ? len : 0U);
+    if (args.empty()) {
+        out.setOk(false);
+        out.setCode("EMPTY_COMMAND");
+        return false;
+    }
+
+    size_t cmd_len = 0U;
+    while (cmd_len < args.size && args.data[cmd_len] != ' ') {
+        ++cmd_len;
+    }
+    const char* cmd = args.data;
+    args = trimView(args.data + cmd_len, args.size - cmd_len);
+
+    const StaticCommand* entry = findStatic(cmd, cmd_len);
+    if (entry != nullptr) {
+        out.setOk(entry->handler(args, out));
+        return out.ok();
+    }
+
+    if (!handlers_.empty()) {
+        String key;
+        key.concat(cmd, cmd_len);
+        key.toUpperCase();
+        const auto it = handlers_.find(key);
+        if (it != handlers_.end()) {
+            String arg_text;
+            arg_text.concat(args.data, args.size);
+            const DispatchResponse res = it->second(arg_text);
+            out.setOk(res.ok);
+            out.setCode(res.code.c_str());
+            if (!res.raw.isEmpty()) {
+                out.print(res.raw.c_str(), res.raw.length());
+            } else if (!res.json.isEmpty()) {
+                out.setJson(true);
+                out.print(res.json.c_str(), res.json.length());
+            }
+            return out.ok();
+        }
+    }
+
+    out.setOk(false);
+    out.setCode("unsupported_command", cmd, cmd_len);
+    return false;
+}
+
 DispatchResponse CommandDispatcher::dispatch(const String& line) const {
     String input = line;
     input.trim();
@@ -25,6 +326,16 @@ DispatchResponse CommandDispatcher::dispatch(const String& line) const {
     }
 
     const int sep = input.indexOf(' ');
+    const size_t cmd_len = (sep > 0) ? static_cast<size_t>(sep) : input.length();
+    if (findStatic(input.c_str(), cmd_len) != nullptr) {
+        char body[kCompatBodyCapacity];
+        DispatchWriter writer(body, sizeof(body));
+        dispatch(input.c_str(), input.length(), writer);
+        DispatchResponse resp;
+        copyToResponse(writer, resp);
+        return resp;
+    }
+
     const String cmd = normalizeCommand(sep > 0 ? input.substring(0, sep) : input);
     const String args = sep > 0 ? input.substring(sep + 1) : "";
 
@@ -44,15 +355,20 @@ DispatchResponse CommandDispatcher::dispatch(const String& line) const {
 }
 
 bool CommandDispatcher::hasCommand(const String& name) const {
+    const CommandArgView view = trimView(name.c_str(), name.length());
+    if (findStatic(view.data, view.size) != nullptr) {
+        return true;
+    }
     return handlers_.find(normalizeCommand(name)) != handlers_.end();
 }
 
 String CommandDispatcher::helpText() const {
+    const std::vector<String> names = commands();
     String out;
-    out.reserve(order_.size() * 24);
-    for (size_t i = 0; i < order_.size(); ++i) {
-        out += order_[i];
-        if (i + 1 < order_.size()) {
+    out.reserve(names.size() * 24);
+    for (size_t i = 0; i < names.size(); ++i) {
+        out += names[i];
+        if (i + 1 < names.size()) {
             out += '\n';
         }
     }
@@ -60,7 +376,38 @@ String CommandDispatcher::helpText() const {
 }
 
 std::vector<String> CommandDispatcher::commands() const {
-    return order_;
+    std::vector<String> out;
+    out.reserve(static_count_ + order_.size());
+    for (size_t i = 0; i < static_count_; ++i) {
+        out.push_back(static_commands_[i].name);
+    }
+    for (const String& name : order_) {
+        if (findStatic(name.c_str(), name.length()) == nullptr) {
+            out.push_back(name);
+        }
+    }
+    return out;
+}
+
+const CommandDispatcher::StaticCommand* CommandDispatcher::findStatic(const char* name, size_t len) const {
+    if (name == nullptr || len == 0U) {
+        return nullptr;
+    }
+    size_t lo = 0U;
+    size_t hi = static_count_;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2U;
+        const int cmp = compareName(name, len, static_commands_[mid].name);
+        if (cmp == 0) {
+            return &static_commands_[mid];
+        }
+        if (cmp < 0) {
+            hi = mid;
+        } else {
+            lo = mid + 1U;
+        }
+    }
+    return nullptr;
 }
 
 String CommandDispatcher::normalizeCommand(const String& name) {
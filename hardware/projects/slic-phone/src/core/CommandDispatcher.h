@@ -14,12 +14,81 @@ struct DispatchResponse {
     String raw;
 };
 
+// Non-owning slice of a command line. Not NUL-terminated; valid only while the
+// line it points into is alive.
+struct CommandArgView {
+    const char* data = nullptr;
+    size_t size = 0U;
+
+    bool empty() const { return size == 0U; }
+    bool equalsIgnoreCase(const char* text) const;
+    // Splits off the next space-separated token (a "quoted" token keeps its
+    // spaces, without the quotes). Returns false when nothing is left.
+    bool nextToken(CommandArgView& token);
+    bool toInt32(int32_t& out) const;
+};
+
+// Response written into caller-owned storage: a short code plus a text or JSON
+// body. Writes past the buffer are dropped and flagged as truncated.
+class DispatchWriter {
+public:
+    static constexpr size_t kCodeCapacity = 48U;
+
+    DispatchWriter(char* buffer, size_t capacity);
+
+    void reset();
+    void setOk(bool ok) { ok_ = ok; }
+    void setCode(const char* code);
+    void setCode(const char* code, const char* detail, size_t detail_len);
+    void setJson(bool json) { json_ = json; }
+
+    bool print(const char* text);
+    bool print(const char* text, size_t len);
+    bool printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    // Appends text as a quoted, escaped JSON string.
+    bool printJsonString(const char* text);
+
+    bool ok() const { return ok_; }
+    const char* code() const { return code_; }
+    const char* body() const { return buffer_; }
+    size_t length() const { return len_; }
+    bool isJson() const { return json_; }
+    bool truncated() const { return truncated_; }
+
+private:
+    char* buffer_ = nullptr;
+    size_t capacity_ = 0U;
+    size_t len_ = 0U;
+    bool ok_ = true;
+    bool json_ = false;
+    bool truncated_ = false;
+    char code_[kCodeCapacity] = {};
+};
+
 class CommandDispatcher {
 public:
     using Handler = std::function<DispatchResponse(const String& args)>;
+    // Allocation-free handler: returns ok, writes code/body into `out`.
+    using StaticHandler = bool (*)(CommandArgView args, DispatchWriter& out);
 
+    struct StaticCommand {
+        const char* name;  // upper case; the table is sorted by name
+        StaticHandler handler;
+    };
+
+    // Binds a constant table searched before the registered handlers. The
+    // table must be sorted and outlive the dispatcher; unsorted tables are
+    // rejected.
+    bool setStaticCommands(const StaticCommand* table, size_t count);
+
+    // Compatibility layer: heap-backed handlers, looked up after the table.
     void registerCommand(const String& name, Handler handler);
+
+    // Static commands run without touching the heap; registered handlers
+    // are converted into `out`.
+    bool dispatch(const char* line, size_t len, DispatchWriter& out) const;
     DispatchResponse dispatch(const String& line) const;
+
     bool hasCommand(const String& name) const;
     String helpText() const;
     std::vector<String> commands() const;
@@ -27,7 +96,10 @@ public:
 private:
     std::map<String, Handler> handlers_;
     std::vector<String> order_;
+    const StaticCommand* static_commands_ = nullptr;
+    size_t static_count_ = 0U;
 
+    const StaticCommand* findStatic(const char* name, size_t len) const;
     static String normalizeCommand(const String& name);
 };
 
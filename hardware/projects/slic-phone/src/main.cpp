@@ -30,6 +30,8 @@
 namespace {
 
 constexpr uint32_t kSerialBaud = 115200;
+constexpr size_t kSerialLineCapacity = 1024U;
+constexpr size_t kSerialResponseCapacity = 2048U;
 constexpr int kAudioAmpEnablePin = A1S_PA_ENABLE;
 constexpr bool kAudioAmpActiveHigh = true;
 constexpr char kBootLogTag[] = "RTC_BOOT";
@@ -105,7 +107,11 @@ TelephonyService g_telephony;
 EspNowBridge g_espnow;
 CommandDispatcher g_dispatcher;
 ScopeDisplay g_scope_display;
-String g_serial_line;
+// Serial console buffers: one line in, one response out, no heap per command.
+char g_serial_line[kSerialLineCapacity] = {};
+size_t g_serial_line_len = 0U;
+bool g_serial_line_overflow = false;
+char g_serial_response[kSerialResponseCapacity] = {};
 WebServerManager g_web_server;
 
 struct HardwareInitStatus {
@@ -5012,17 +5018,203 @@ bool dialMediaMapHasLegacyToneWav(const DialMediaMap& map) {
     return false;
 }
 
+// Allocation-free commands, searched before the registered handlers. Keep
+// kStaticCommands sorted by name.
+bool staticResult(DispatchWriter& out, bool ok, const char* code) {
+    out.setCode(code);
+    return ok;
+}
+
+bool cmdAmpOff(CommandArgView, DispatchWriter& out) {
+    setAmpEnabled(false);
+    return staticResult(out, true, "AMP_OFF");
+}
+
+bool cmdAmpOn(CommandArgView, DispatchWriter& out) {
+    setAmpEnabled(true);
+    return staticResult(out, true, "AMP_ON");
+}
+
+bool cmdCall(CommandArgView, DispatchWriter& out) {
+    g_telephony.triggerIncomingRing();
+    return staticResult(out, true, "CALL");
+}
+
+bool cmdCaptureStart(CommandArgView, DispatchWriter& out) {
+    return staticResult(out, g_audio.startCapture(), "CAPTURE_START");
+}
+
+bool cmdCaptureStop(CommandArgView, DispatchWriter& out) {
+    g_audio.stopCapture();
+    return staticResult(out, true, "CAPTURE_STOP");
+}
+
+bool cmdEspNowOff(CommandArgView, DispatchWriter& out) {
+    return staticResult(out, g_espnow.stop(), "ESPNOW_OFF");
+}
+
+bool cmdEspNowOn(CommandArgView, DispatchWriter& out) {
+    return staticResult(out, g_espnow.begin(g_peer_store), "ESPNOW_ON");
+}
+
+bool cmdOscStatus(CommandArgView, DispatchWriter& out) {
+    out.setJson(true);
+    out.printf("{\"supported\":%s,\"enabled\":%s,\"frequency\":%u,\"amplitude\":%u}",
+               g_scope_display.supported() ? "true" : "false",
+               g_scope_display.enabled() ? "true" : "false",
+               static_cast<unsigned>(g_scope_display.frequency()),
+               static_cast<unsigned>(g_scope_display.amplitude()));
+    return true;
+}
+
+bool cmdOscStop(CommandArgView, DispatchWriter& out) {
+    g_scope_display.enable(false);
+    return staticResult(out, true, "OSC_STOP");
+}
+
+bool cmdPing(CommandArgView, DispatchWriter& out) {
+    out.print("PONG");
+    return true;
+}
+
+bool cmdResetMetrics(CommandArgView, DispatchWriter& out) {
+    g_audio.resetMetrics();
+    return staticResult(out, true, "RESET_METRICS");
+}
+
+bool cmdRing(CommandArgView, DispatchWriter& out) {
+    g_telephony.triggerIncomingRing();
+    return staticResult(out, true, "RING");
+}
+
+bool cmdScEvent(CommandArgView, DispatchWriter& out) {
+    return staticResult(out, true, "SC_EVENT");
+}
+
+bool cmdSlicPdOff(CommandArgView, DispatchWriter& out) {
+    g_telephony.forceTelephonyPower(true);
+    return staticResult(out, true, "SLIC_PD_OFF");
+}
+
+bool cmdSlicPdOn(CommandArgView, DispatchWriter& out) {
+    if (g_telephony.state() != TelephonyState::IDLE) {
+        return staticResult(out, false, "SLIC_PD_ON telephony_active");
+    }
+    g_telephony.forceTelephonyPower(false);
+    return staticResult(out, true, "SLIC_PD_ON");
+}
+
+bool cmdSlicPdStatus(CommandArgView, DispatchWriter& out) {
+    out.setJson(true);
+    out.printf("{\"power_down\":%s,\"telephony_powered\":%s,\"power_probe_active\":%s}",
+               g_slic.isPowerDownEnabled() ? "true" : "false",
+               g_telephony.isTelephonyPowered() ? "true" : "false",
+               g_telephony.isPowerProbeActive() ? "true" : "false");
+    return true;
+}
+
+bool cmdStoryRefreshSd(CommandArgView, DispatchWriter& out) {
+    return staticResult(out, g_audio.isSdReady(), "STORY_REFRESH_SD");
+}
+
+bool cmdToneOff(CommandArgView, DispatchWriter& out) {
+    g_telephony.suppressDialToneForMs(kToneOffSuppressionMs);
+    g_audio.stopTone();
+    return staticResult(out, true, "TONE_OFF");
+}
+
+bool cmdToneOn(CommandArgView, DispatchWriter& out) {
+    if (!g_audio.isReady()) {
+        return staticResult(out, false, "TONE_ON audio_not_ready");
+    }
+    g_telephony.clearDialToneSuppression();
+    const bool ok = g_audio.playTone(ToneProfile::FR_FR, ToneEvent::DIAL);
+    return staticResult(out, ok, ok ? "TONE_ON" : "TONE_ON failed");
+}
+
+bool cmdToneStop(CommandArgView, DispatchWriter& out) {
+    g_audio.stopTone();
+    return staticResult(out, true, "TONE_STOP");
+}
+
+bool cmdUnlock(CommandArgView, DispatchWriter& out) {
+    g_slic.setLineEnabled(true);
+    return staticResult(out, true, "UNLOCK");
+}
+
+bool cmdVolumeGet(CommandArgView, DispatchWriter& out) {
+    out.setJson(true);
+    out.printf("{\"volume\":%u}", static_cast<unsigned>(g_audio_cfg.volume));
+    return true;
+}
+
+bool cmdVolumeSet(CommandArgView args, DispatchWriter& out) {
+    CommandArgView value_token;
+    CommandArgView trailing;
+    if (!args.nextToken(value_token) || value_token.empty() || args.nextToken(trailing)) {
+        return staticResult(out, false, "VOLUME_SET invalid_args");
+    }
+
+    int32_t value = 0;
+    if (!value_token.toInt32(value) || value < 0 || value > 100) {
+        return staticResult(out, false, "VOLUME_SET invalid_value");
+    }
+
+    A252AudioConfig next = g_audio_cfg;
+    int32_t applied_value = value;
+    if (g_profile == BoardProfile::ESP32_A252) {
+        if (value != static_cast<int32_t>(kA252CodecMaxVolumePercent)) {
+            Serial.printf("[RTC_BL_PHONE] forcing ES8388 volume to 100 (requested=%ld)\n",
+                          static_cast<long>(value));
+        }
+        applied_value = static_cast<int32_t>(kA252CodecMaxVolumePercent);
+    }
+    next.volume = static_cast<uint8_t>(applied_value);
+
+    if (!persistA252AudioConfigIfNeeded(next, "VOLUME_SET")) {
+        return staticResult(out, false, "VOLUME_SET persist_failed");
+    }
+
+    if (g_profile == BoardProfile::ESP32_A252) {
+        g_codec.setVolume(g_audio_cfg.volume);
+    }
+    return staticResult(out, true, "VOLUME_SET");
+}
+
+const CommandDispatcher::StaticCommand kStaticCommands[] = {
+    {"AMP_OFF", cmdAmpOff},
+    {"AMP_ON", cmdAmpOn},
+    {"CALL", cmdCall},
+    {"CAPTURE_START", cmdCaptureStart},
+    {"CAPTURE_STOP", cmdCaptureStop},
+    {"ESPNOW_OFF", cmdEspNowOff},
+    {"ESPNOW_ON", cmdEspNowOn},
+    {"OSC_STATUS", cmdOscStatus},
+    {"OSC_STOP", cmdOscStop},
+    {"PING", cmdPing},
+    {"RESET_METRICS", cmdResetMetrics},
+    {"RING", cmdRing},
+    {"SC_EVENT", cmdScEvent},
+    {"SLIC_PD_OFF", cmdSlicPdOff},
+    {"SLIC_PD_ON", cmdSlicPdOn},
+    {"SLIC_PD_STATUS", cmdSlicPdStatus},
+    {"STORY_REFRESH_SD", cmdStoryRefreshSd},
+    {"TONE_OFF", cmdToneOff},
+    {"TONE_ON", cmdToneOn},
+    {"TONE_STOP", cmdToneStop},
+    {"UNLOCK", cmdUnlock},
+    {"VOLUME_GET", cmdVolumeGet},
+    {"VOLUME_SET", cmdVolumeSet},
+};
+
 DispatchResponse executeCommandLine(const String& line) {
     return g_dispatcher.dispatch(line);
 }
 
 void registerCommands() {
-    g_dispatcher.registerCommand("PING", [](const String&) {
-        DispatchResponse res;
-        res.ok = true;
-        res.raw = "PONG";
-        return res;
-    });
+    if (!g_dispatcher.setStaticCommands(kStaticCommands, sizeof(kStaticCommands) / sizeof(kStaticCommands[0]))) {
+        Serial.println("[RTC_BL_PHONE] static command table rejected (unsorted)");
+    }
 
     g_dispatcher.registerCommand("HELP", [](const String&) {
         DispatchResponse res;
@@ -5037,16 +5229,6 @@ void registerCommands() {
         return jsonResponse(doc);
     });
 
-    g_dispatcher.registerCommand("CALL", [](const String&) {
-        g_telephony.triggerIncomingRing();
-        return makeResponse(true, "CALL");
-    });
-
-    g_dispatcher.registerCommand("RING", [](const String&) {
-        g_telephony.triggerIncomingRing();
-        return makeResponse(true, "RING");
-    });
-
     g_dispatcher.registerCommand("WIFI_STATUS", [](const String&) {
         JsonDocument doc;
         JsonObject root = doc.to<JsonObject>();
@@ -5113,33 +5295,6 @@ void registerCommands() {
         return makeResponse(ok, ok ? "WIFI_RECONNECT" : "WIFI_RECONNECT no_credentials");
     });
 
-    g_dispatcher.registerCommand("UNLOCK", [](const String&) {
-        g_slic.setLineEnabled(true);
-        return makeResponse(true, "UNLOCK");
-    });
-
-    g_dispatcher.registerCommand("SLIC_PD_ON", [](const String&) {
-        if (g_telephony.state() != TelephonyState::IDLE) {
-            return makeResponse(false, "SLIC_PD_ON telephony_active");
-        }
-        g_telephony.forceTelephonyPower(false);
-        return makeResponse(true, "SLIC_PD_ON");
-    });
-
-    g_dispatcher.registerCommand("SLIC_PD_OFF", [](const String&) {
-        g_telephony.forceTelephonyPower(true);
-        return makeResponse(true, "SLIC_PD_OFF");
-    });
-
-    g_dispatcher.registerCommand("SLIC_PD_STATUS", [](const String&) {
-        JsonDocument doc;
-        JsonObject root = doc.to<JsonObject>();
-        root["power_down"] = g_slic.isPowerDownEnabled();
-        root["telephony_powered"] = g_telephony.isTelephonyPowered();
-        root["power_probe_active"] = g_telephony.isPowerProbeActive();
-        return jsonResponse(doc);
-    });
-
     g_dispatcher.registerCommand("NEXT", [](const String&) {
         if (g_active_scene_id.isEmpty()) {
             return makeResponse(false, "scene_not_found");
@@ -5150,14 +5305,6 @@ void registerCommands() {
         return makeResponse(true, "NEXT");
     });
 
-    g_dispatcher.registerCommand("STORY_REFRESH_SD", [](const String&) {
-        return makeResponse(g_audio.isSdReady(), "STORY_REFRESH_SD");
-    });
-
-    g_dispatcher.registerCommand("SC_EVENT", [](const String&) {
-        return makeResponse(true, "SC_EVENT");
-    });
-
     g_dispatcher.registerCommand("SCENE", [](const String& args) {
         String scene_id;
         String step_id;
@@ -5213,15 +5360,6 @@ void registerCommands() {
         return jsonResponse(out);
     });
 
-    g_dispatcher.registerCommand("CAPTURE_START", [](const String&) {
-        return makeResponse(g_audio.startCapture(), "CAPTURE_START");
-    });
-
-    g_dispatcher.registerCommand("CAPTURE_STOP", [](const String&) {
-        g_audio.stopCapture();
-        return makeResponse(true, "CAPTURE_STOP");
-    });
-
     g_dispatcher.registerCommand("OSC_START", [](const String& args) {
         String first;
         String rest;
@@ -5254,21 +5392,6 @@ void registerCommands() {
         return makeResponse(true, "OSC_START");
     });
 
-    g_dispatcher.registerCommand("OSC_STOP", [](const String&) {
-        g_scope_display.enable(false);
-        return makeResponse(true, "OSC_STOP");
-    });
-
-    g_dispatcher.registerCommand("OSC_STATUS", [](const String&) {
-        JsonDocument out;
-        JsonObject scope = out.to<JsonObject>();
-        scope["supported"] = g_scope_display.supported();
-        scope["enabled"] = g_scope_display.enabled();
-        scope["frequency"] = g_scope_display.frequency();
-        scope["amplitude"] = g_scope_display.amplitude();
-        return jsonResponse(out);
-    });
-
     g_dispatcher.registerCommand("PLAY", [](const String& args) {
         if (args.isEmpty()) {
             return makeResponse(false, "PLAY missing_args");
@@ -5385,89 +5508,6 @@ void registerCommands() {
         return makeResponse(ok, ok ? "TONE_PLAY" : "TONE_PLAY failed");
     });
 
-    g_dispatcher.registerCommand("TONE_STOP", [](const String&) {
-        g_audio.stopTone();
-        return makeResponse(true, "TONE_STOP");
-    });
-
-    g_dispatcher.registerCommand("VOLUME_SET", [](const String& args) {
-        String value_token;
-        String trailing;
-        if (!splitFirstToken(args, value_token, trailing) || value_token.isEmpty() || !trailing.isEmpty()) {
-            return makeResponse(false, "VOLUME_SET invalid_args");
-        }
-
-        char* end = nullptr;
-        const long value = strtol(value_token.c_str(), &end, 10);
-        if (end == nullptr || end == value_token.c_str() || *end != '\0' || value < 0 || value > 100) {
-            return makeResponse(false, "VOLUME_SET invalid_value");
-        }
-
-        A252AudioConfig next = g_audio_cfg;
-        long applied_value = value;
-        if (g_profile == BoardProfile::ESP32_A252) {
-            if (value != static_cast<long>(kA252CodecMaxVolumePercent)) {
-                Serial.printf("[RTC_BL_PHONE] forcing ES8388 volume to 100 (requested=%ld)\n",
-                              value);
-            }
-            applied_value = static_cast<long>(kA252CodecMaxVolumePercent);
-        }
-        next.volume = static_cast<uint8_t>(applied_value);
-
-        if (!persistA252AudioConfigIfNeeded(next, "VOLUME_SET")) {
-            return makeResponse(false, "VOLUME_SET persist_failed");
-        }
-
-        if (g_profile == BoardProfile::ESP32_A252) {
-            g_codec.setVolume(g_audio_cfg.volume);
-        }
-        return makeResponse(true, "VOLUME_SET");
-    });
-
-    g_dispatcher.registerCommand("VOLUME_GET", [](const String&) {
-        JsonDocument doc;
-        doc["volume"] = g_audio_cfg.volume;
-        return jsonResponse(doc);
-    });
-
-    g_dispatcher.registerCommand("RESET_METRICS", [](const String&) {
-        g_audio.resetMetrics();
-        return makeResponse(true, "RESET_METRICS");
-    });
-
-    g_dispatcher.registerCommand("TONE_ON", [](const String&) {
-        if (!g_audio.isReady()) {
-            return makeResponse(false, "TONE_ON audio_not_ready");
-        }
-        g_telephony.clearDialToneSuppression();
-        const bool ok = g_audio.playTone(ToneProfile::FR_FR, ToneEvent::DIAL);
-        return makeResponse(ok, ok ? "TONE_ON" : "TONE_ON failed");
-    });
-
-    g_dispatcher.registerCommand("TONE_OFF", [](const String&) {
-        g_telephony.suppressDialToneForMs(kToneOffSuppressionMs);
-        g_audio.stopTone();
-        return makeResponse(true, "TONE_OFF");
-    });
-
-    g_dispatcher.registerCommand("AMP_ON", [](const String&) {
-        setAmpEnabled(true);
-        return makeResponse(true, "AMP_ON");
-    });
-
-    g_dispatcher.registerCommand("AMP_OFF", [](const String&) {
-        setAmpEnabled(false);
-        return makeResponse(true, "AMP_OFF");
-    });
-
-    g_dispatcher.registerCommand("ESPNOW_ON", [](const String&) {
-        return makeResponse(g_espnow.begin(g_peer_store), "ESPNOW_ON");
-    });
-
-    g_dispatcher.registerCommand("ESPNOW_OFF", [](const String&) {
-        return makeResponse(g_espnow.stop(), "ESPNOW_OFF");
-    });
-
     g_dispatcher.registerCommand("ESPNOW_PEER_ADD", [](const String& args) {
         if (args.isEmpty()) {
             return makeResponse(false, "ESPNOW_PEER_ADD invalid_mac");
@@ -5892,6 +5932,22 @@ void processInboundBridgeCommand(const String& source, const JsonVariantConst& p
     maybeTrackEspNowPeerDiscoveryAck(source, payload);
     maybeTrackEspNowSceneSyncAck(source, payload);
 
+    if (payload["proto"] == "espnow_frame/1") {
+        // Binary COMMAND record: the link acks the frame, the RESULT record
+        // carries the answer.
+        const String cmd = payload["cmd"] | "";
+        DispatchResponse result;
+        if (!handleIncomingEspNowCallCommand(cmd, result)) {
+            result = executeCommandLine(cmd);
+        }
+        if (!g_espnow.sendResult(source, payload["id"] | 0U, result.ok, result.code, result.json)) {
+            Serial.printf("[RTC_BL_PHONE] espnow result queue failed peer=%s code=%s\n",
+                          source.c_str(),
+                          result.code.c_str());
+        }
+        return;
+    }
+
     String cmd;
     String request_id;
     uint32_t request_seq = 0;
@@ -6069,32 +6125,35 @@ void printHelp() {
     }
 }
 
-void handleSerialCommand(const String& line) {
-    const DispatchResponse res = executeCommandLine(line);
-
-    if (!res.raw.isEmpty()) {
-        Serial.println(res.raw);
-        return;
-    }
+void handleSerialCommand(const char* line, size_t len) {
+    DispatchWriter out(g_serial_response, sizeof(g_serial_response));
+    g_dispatcher.dispatch(line, len, out);
 
-    if (!res.json.isEmpty()) {
-        Serial.println(res.json);
+    if (out.length() > 0U) {
+        Serial.write(reinterpret_cast<const uint8_t*>(out.body()), out.length());
+        Serial.println();
         return;
     }
 
-    Serial.printf("%s %s\n", res.ok ? "OK" : "ERR", res.code.c_str());
+    Serial.printf("%s %s\n", out.ok() ? "OK" : "ERR", out.code());
 }
 
 void pollSerial() {
     while (Serial.available() > 0) {
         const char c = static_cast<char>(Serial.read());
         if (c == '\r' || c == '\n') {
-            if (!g_serial_line.isEmpty()) {
-                handleSerialCommand(g_serial_line);
-                g_serial_line = "";
+            if (g_serial_line_len > 0U && !g_serial_line_overflow) {
+                g_serial_line[g_serial_line_len] = '\0';
+                handleSerialCommand(g_serial_line, g_serial_line_len);
+            } else if (g_serial_line_overflow) {
+                Serial.println("ERR line_too_long");
             }
+            g_serial_line_len = 0U;
+            g_serial_line_overflow = false;
+        } else if (g_serial_line_len + 1U < sizeof(g_serial_line)) {
+            g_serial_line[g_serial_line_len++] = c;
         } else {
-            g_serial_line += c;
+            g_serial_line_overflow = true;
         }
     }
 }
@@ -58,10 +58,21 @@ bool ensurePeerRegistered(const uint8_t mac[6]) {
     const esp_err_t err = esp_now_add_peer(&peer_info);
     return err == ESP_OK || err == ESP_ERR_ESPNOW_EXIST;
 }
+
+const uint8_t kBroadcastMac[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+bool isBroadcastMac(const uint8_t mac[6]) {
+    return memcmp(mac, kBroadcastMac, sizeof(kBroadcastMac)) == 0;
+}
+
+void formatMac(const uint8_t mac[6], char* out, size_t out_size) {
+    snprintf(out, out_size, "%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+}
 }
 
 EspNowBridge::EspNowBridge() {
     instance_ = this;
+    espNowLinkInit(&broadcast_link_, 1);
 }
 
 bool EspNowBridge::begin(const EspNowPeerStore& initial_peers) {
@@ -90,6 +101,15 @@ bool EspNowBridge::begin(const EspNowPeerStore& initial_peers) {
     esp_now_register_recv_cb(onDataRecv);
     esp_now_register_send_cb(onDataSent);
 
+    // A fresh epoch per start tells peers to restart their receive window.
+    espNowLinkInit(&broadcast_link_, static_cast<uint8_t>(esp_random()));
+    for (PeerLink& entry : links_) {
+        entry.used = false;
+    }
+    portENTER_CRITICAL(&rx_lock_);
+    rx_head_ = 0;
+    rx_count_frames_ = 0;
+    portEXIT_CRITICAL(&rx_lock_);
     ready_ = true;
 
     std::vector<String> peers_copy = store_.peers;
@@ -111,7 +131,24 @@ bool EspNowBridge::stop() {
 }
 
 void EspNowBridge::tick() {
-    // ESP-NOW uses callbacks, no polling required.
+    if (!ready_) {
+        return;
+    }
+    const uint32_t now_ms = millis();
+    for (;;) {
+        RxFrame frame;
+        portENTER_CRITICAL(&rx_lock_);
+        if (rx_count_frames_ == 0) {
+            portEXIT_CRITICAL(&rx_lock_);
+            break;
+        }
+        frame = rx_frames_[rx_head_];
+        rx_head_ = static_cast<uint8_t>((rx_head_ + 1U) % kRxFrameSlots);
+        --rx_count_frames_;
+        portEXIT_CRITICAL(&rx_lock_);
+        handleFrame(frame, now_ms);
+    }
+    pumpLinks(now_ms);
 }
 
 bool EspNowBridge::addPeer(const String& mac) {
@@ -189,6 +226,59 @@ bool EspNowBridge::sendJson(const String& target, const String& json_payload) {
     return sendToMac(target_mac, json_payload);
 }
 
+bool EspNowBridge::sendRecord(const String& target, uint8_t type, const char* data, size_t len) {
+    if (!ready_ || data == nullptr || len == 0U) {
+        tx_fail_++;
+        return false;
+    }
+    String normalized_target = target;
+    normalized_target.trim();
+    bool is_broadcast = false;
+    uint8_t mac[6] = {0};
+    if (!parseTargetMac(normalized_target, mac, is_broadcast)) {
+        tx_fail_++;
+        return false;
+    }
+    if (is_broadcast) {
+        memcpy(mac, kBroadcastMac, sizeof(mac));
+    }
+    const uint32_t now_ms = millis();
+    if (!espNowLinkQueue(linkFor(mac, now_ms),
+                         type,
+                         reinterpret_cast<const uint8_t*>(data),
+                         len,
+                         !is_broadcast,
+                         now_ms)) {
+        // Window full or record too large: the caller keeps the record.
+        tx_fail_++;
+        return false;
+    }
+    return true;
+}
+
+bool EspNowBridge::sendResult(const String& target,
+                              uint16_t request_id,
+                              bool ok,
+                              const String& code,
+                              const String& data_json) {
+    uint8_t mac[6] = {0};
+    if (!ready_ || !A252ConfigStore::parseMac(A252ConfigStore::normalizeMac(target), mac)) {
+        tx_fail_++;
+        return false;
+    }
+    const uint32_t now_ms = millis();
+    EspNowLink* link = linkFor(mac, now_ms);
+    if (espNowLinkQueueResult(link, request_id, ok, code.c_str(), data_json.c_str(), data_json.length(), now_ms, true)) {
+        return true;
+    }
+    // Data larger than one record: the code alone beats no answer.
+    if (espNowLinkQueueResult(link, request_id, ok, code.c_str(), nullptr, 0U, now_ms, true)) {
+        return true;
+    }
+    tx_fail_++;
+    return false;
+}
+
 bool EspNowBridge::isReady() const {
     return ready_;
 }
@@ -207,6 +297,30 @@ void EspNowBridge::statusToJson(JsonObject obj) const {
     obj["last_rx_mac"] = last_rx_mac_;
     obj["last_rx_payload"] = last_rx_payload_;
 
+    EspNowLinkStats totals = broadcast_link_.stats;
+    uint32_t rtt_samples = broadcast_link_.stats.rtt_samples;
+    uint32_t rtt_total_ms = broadcast_link_.stats.rtt_total_ms;
+    for (const PeerLink& entry : links_) {
+        if (!entry.used) {
+            continue;
+        }
+        totals.tx_frames += entry.link.stats.tx_frames;
+        totals.tx_retransmits += entry.link.stats.tx_retransmits;
+        totals.tx_expired_frames += entry.link.stats.tx_expired_frames;
+        totals.rx_frames += entry.link.stats.rx_frames;
+        totals.rx_duplicates += entry.link.stats.rx_duplicates;
+        rtt_samples += entry.link.stats.rtt_samples;
+        rtt_total_ms += entry.link.stats.rtt_total_ms;
+    }
+    JsonObject link = obj["link"].to<JsonObject>();
+    link["frames"] = totals.tx_frames;
+    link["retransmits"] = totals.tx_retransmits;
+    link["expired"] = totals.tx_expired_frames;
+    link["rx_frames"] = totals.rx_frames;
+    link["duplicates"] = totals.rx_duplicates;
+    link["rx_dropped"] = rx_frames_dropped_;
+    link["rtt_avg_ms"] = (rtt_samples > 0U) ? (rtt_total_ms / rtt_samples) : 0U;
+
     JsonArray peers = obj["peers"].to<JsonArray>();
     for (const String& peer : store_.peers) {
         peers.add(peer);
@@ -302,21 +416,147 @@ bool EspNowBridge::sendToMac(const uint8_t mac[6], const String& payload) {
     return true;
 }
 
+bool EspNowBridge::sendBytes(const uint8_t mac[6], const uint8_t* data, size_t len) {
+    if (!ready_ || len == 0U || len > ESPNOW_FRAME_MAX) {
+        return false;
+    }
+    if (!ensurePeerRegistered(mac)) {
+        tx_fail_++;
+        return false;
+    }
+    if (esp_now_send(mac, data, len) != ESP_OK) {
+        tx_fail_++;
+        return false;
+    }
+    return true;
+}
+
+EspNowLink* EspNowBridge::linkFor(const uint8_t mac[6], uint32_t now_ms) {
+    if (isBroadcastMac(mac)) {
+        return &broadcast_link_;
+    }
+    PeerLink* victim = nullptr;
+    for (PeerLink& entry : links_) {
+        if (entry.used && memcmp(entry.mac, mac, sizeof(entry.mac)) == 0) {
+            entry.last_used_ms = now_ms;
+            return &entry.link;
+        }
+        if (!entry.used) {
+            if (victim == nullptr || victim->used) {
+                victim = &entry;
+            }
+        } else if (victim == nullptr ||
+                   (victim->used && static_cast<int32_t>(entry.last_used_ms - victim->last_used_ms) < 0)) {
+            victim = &entry;
+        }
+    }
+    // Least recently used peer loses its link; its new epoch restarts the window.
+    victim->used = true;
+    memcpy(victim->mac, mac, sizeof(victim->mac));
+    victim->last_used_ms = now_ms;
+    espNowLinkInit(&victim->link, static_cast<uint8_t>(esp_random()));
+    return &victim->link;
+}
+
+void EspNowBridge::pumpLinks(uint32_t now_ms) {
+    uint8_t frame[ESPNOW_FRAME_MAX] = {0};
+    for (size_t index = 0; index <= kMaxFrameLinks; ++index) {
+        const bool broadcast = index == kMaxFrameLinks;
+        if (!broadcast && !links_[index].used) {
+            continue;
+        }
+        EspNowLink* link = broadcast ? &broadcast_link_ : &links_[index].link;
+        const uint8_t* mac = broadcast ? kBroadcastMac : links_[index].mac;
+        // At most a window plus an ack per pass keeps loop() short.
+        for (size_t sent = 0; sent <= ESPNOW_FRAME_MAX_WINDOW; ++sent) {
+            const size_t len = espNowLinkPoll(link, now_ms, frame, sizeof(frame));
+            if (len == 0U || !sendBytes(mac, frame, len)) {
+                // A failed reliable frame stays in flight; its RTO resends it.
+                break;
+            }
+        }
+    }
+}
+
+void EspNowBridge::handleFrame(const RxFrame& frame, uint32_t now_ms) {
+    current_frame_ = &frame;
+    if (!espNowLinkReceive(linkFor(frame.mac, now_ms), frame.data, frame.len, now_ms, onFrameRecord, this)) {
+        Serial.printf("[EspNowBridge] rx dropped: malformed frame len=%u\n", static_cast<unsigned>(frame.len));
+    }
+    current_frame_ = nullptr;
+}
+
+void EspNowBridge::onFrameRecord(void* ctx, uint8_t type, const uint8_t* data, uint8_t len) {
+    EspNowBridge* self = static_cast<EspNowBridge*>(ctx);
+    if (self == nullptr || self->current_frame_ == nullptr || !self->command_callback_) {
+        return;
+    }
+    char mac_buf[18] = {0};
+    formatMac(self->current_frame_->mac, mac_buf, sizeof(mac_buf));
+
+    JsonDocument doc;
+    switch (type) {
+        case ESPNOW_REC_COMMAND: {
+            uint16_t request_id = 0;
+            const char* line = nullptr;
+            uint8_t line_len = 0;
+            if (!espNowRecordParseCommand(data, len, &request_id, &line, &line_len)) {
+                return;
+            }
+            String cmd;
+            cmd.concat(line, line_len);
+            doc["proto"] = "espnow_frame/1";
+            doc["id"] = request_id;
+            doc["cmd"] = cmd;
+            break;
+        }
+        case ESPNOW_REC_EVENT:
+        case ESPNOW_REC_TEXT: {
+            String text;
+            text.concat(reinterpret_cast<const char*>(data), len);
+            doc["raw"] = text;
+            break;
+        }
+        case ESPNOW_REC_JSON:
+            if (deserializeJson(doc, reinterpret_cast<const char*>(data), len) != DeserializationError::Ok) {
+                return;
+            }
+            break;
+        default:
+            // RESULT records answer commands we send; nothing waits on them yet.
+            return;
+    }
+    self->rx_count_++;
+    self->last_rx_mac_ = mac_buf;
+    self->command_callback_(String(mac_buf), doc.as<JsonVariantConst>());
+}
+
 void EspNowBridge::onDataRecv(const uint8_t* mac_addr, const uint8_t* data, int len) {
     if (!instance_) {
         return;
     }
 
+    if (len > 0 && espNowFrameIsBinary(data, static_cast<size_t>(len))) {
+        if (len > ESPNOW_FRAME_MAX) {
+            return;
+        }
+        portENTER_CRITICAL(&instance_->rx_lock_);
+        if (instance_->rx_count_frames_ >= kRxFrameSlots) {
+            instance_->rx_frames_dropped_++;
+        } else {
+            const size_t tail = (instance_->rx_head_ + instance_->rx_count_frames_) % kRxFrameSlots;
+            RxFrame& slot = instance_->rx_frames_[tail];
+            memcpy(slot.mac, mac_addr, sizeof(slot.mac));
+            memcpy(slot.data, data, static_cast<size_t>(len));
+            slot.len = static_cast<uint8_t>(len);
+            instance_->rx_count_frames_++;
+        }
+        portEXIT_CRITICAL(&instance_->rx_lock_);
+        return;
+    }
+
     char mac_buf[18] = {0};
-    snprintf(mac_buf,
-             sizeof(mac_buf),
-             "%02X:%02X:%02X:%02X:%02X:%02X",
-             mac_addr[0],
-             mac_addr[1],
-             mac_addr[2],
-             mac_addr[3],
-             mac_addr[4],
-             mac_addr[5]);
+    formatMac(mac_addr, mac_buf, sizeof(mac_buf));
 
     if (len <= 0 || len > static_cast<int>(kEspNowMaxPayloadBytes)) {
         Serial.printf("[EspNowBridge] rx dropped: invalid len=%d (max=%u)\n",
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "config/A252ConfigStore.h"
+#include "espnow_frame_v1.h"
 
 class EspNowBridge {
 public:
@@ -26,15 +27,40 @@ public:
     bool setDeviceName(const String& name, bool persist = true);
 
     bool sendJson(const String& target, const String& json_payload);
+    // Binary v1 frames (espnow_frame_v1.md): records are batched per peer and
+    // sent from tick(). Unicast records are acked and retransmitted.
+    bool sendRecord(const String& target, uint8_t type, const char* data, size_t len);
+    bool sendResult(const String& target, uint16_t request_id, bool ok, const String& code, const String& data_json);
     bool isReady() const;
 
     void setCommandCallback(std::function<void(const String&, const JsonVariantConst&)> cb);
     void statusToJson(JsonObject obj) const;
 
 private:
+    static constexpr size_t kMaxFrameLinks = 4;
+    static constexpr size_t kRxFrameSlots = 6;
+
+    struct RxFrame {
+        uint8_t mac[6] = {0};
+        uint8_t len = 0;
+        uint8_t data[ESPNOW_FRAME_MAX] = {0};
+    };
+
+    struct PeerLink {
+        bool used = false;
+        uint8_t mac[6] = {0};
+        uint32_t last_used_ms = 0;
+        EspNowLink link;
+    };
+
     bool addPeerInternal(const String& normalized_mac, bool persist);
     bool deletePeerInternal(const String& normalized_mac, bool persist);
     bool sendToMac(const uint8_t mac[6], const String& payload);
+    bool sendBytes(const uint8_t mac[6], const uint8_t* data, size_t len);
+    EspNowLink* linkFor(const uint8_t mac[6], uint32_t now_ms);
+    void pumpLinks(uint32_t now_ms);
+    void handleFrame(const RxFrame& frame, uint32_t now_ms);
+    static void onFrameRecord(void* ctx, uint8_t type, const uint8_t* data, uint8_t len);
 
     static void onDataRecv(const uint8_t* mac_addr, const uint8_t* data, int len);
     static void onDataSent(const uint8_t* mac_addr, esp_now_send_status_t status);
@@ -50,6 +76,16 @@ private:
     uint32_t rx_count_ = 0;
     String last_rx_mac_;
     String last_rx_payload_;
+
+    PeerLink links_[kMaxFrameLinks];
+    EspNowLink broadcast_link_;
+    // Binary frames are copied here by the receive callback and handled in tick().
+    RxFrame rx_frames_[kRxFrameSlots];
+    uint8_t rx_head_ = 0;
+    uint8_t rx_count_frames_ = 0;
+    uint32_t rx_frames_dropped_ = 0;
+    portMUX_TYPE rx_lock_ = portMUX_INITIALIZER_UNLOCKED;
+    const RxFrame* current_frame_ = nullptr;
 };
 
 #endif  // PROPS_ESPNOW_BRIDGE_H
@@ -0,0 +1,79 @@
+// Minimal Arduino shim for host tests: a std::string-backed String with the
+// members the tested sources use.
+#ifndef HOST_SHIM_ARDUINO_H
+#define HOST_SHIM_ARDUINO_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+class String {
+public:
+    String() = default;
+    String(const char* text) : value_(text != nullptr ? text : "") {}
+    String(char c) : value_(1U, c) {}
+
+    const char* c_str() const { return value_.c_str(); }
+    unsigned int length() const { return static_cast<unsigned int>(value_.size()); }
+    bool isEmpty() const { return value_.empty(); }
+    bool reserve(unsigned int size) {
+        value_.reserve(size);
+        return true;
+    }
+
+    bool concat(const char* text, unsigned int len) {
+        value_.append(text, len);
+        return true;
+    }
+    String& operator+=(const String& other) {
+        value_ += other.value_;
+        return *this;
+    }
+    String& operator+=(const char* text) {
+        value_ += text;
+        return *this;
+    }
+    String& operator+=(char c) {
+        value_ += c;
+        return *this;
+    }
+
+    int indexOf(char c) const {
+        const size_t pos = value_.find(c);
+        return pos == std::string::npos ? -1 : static_cast<int>(pos);
+    }
+    String substring(unsigned int from) const { return String(value_.substr(std::min<size_t>(from, value_.size()))); }
+    String substring(unsigned int from, unsigned int to) const {
+        from = std::min<unsigned int>(from, length());
+        to = std::min<unsigned int>(std::max(from, to), length());
+        return String(value_.substr(from, to - from));
+    }
+
+    void trim() {
+        const size_t first = value_.find_first_not_of(" \t\r\n");
+        if (first == std::string::npos) {
+            value_.clear();
+            return;
+        }
+        value_ = value_.substr(first, value_.find_last_not_of(" \t\r\n") - first + 1U);
+    }
+    void toUpperCase() {
+        for (char& c : value_) {
+            c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        }
+    }
+
+    bool operator==(const char* text) const { return value_ == text; }
+    bool operator==(const String& other) const { return value_ == other.value_; }
+    bool operator<(const String& other) const { return value_ < other.value_; }
+
+private:
+    explicit String(std::string value) : value_(std::move(value)) {}
+
+    std::string value_;
+};
+
+#endif  // HOST_SHIM_ARDUINO_H
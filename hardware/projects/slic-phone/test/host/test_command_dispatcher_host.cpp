@@ -0,0 +1,192 @@
+// Host test: CommandDispatcher static table (lookup, arg slices, writer) and
+// heap allocations per dispatch, static vs registered handlers.
+// Build/run: scripts/branch_gate.sh (tests host)
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "core/CommandDispatcher.h"
+
+namespace {
+
+size_t g_allocations = 0U;
+uint32_t g_failures = 0U;
+
+void check(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("[FAIL] %s\n", what);
+        ++g_failures;
+    }
+}
+
+bool cmdPing(CommandArgView, DispatchWriter& out) {
+    out.print("PONG");
+    return true;
+}
+
+bool cmdVolumeSet(CommandArgView args, DispatchWriter& out) {
+    CommandArgView value_token;
+    CommandArgView trailing;
+    int32_t value = 0;
+    if (!args.nextToken(value_token) || args.nextToken(trailing)) {
+        out.setCode("VOLUME_SET invalid_args");
+        return false;
+    }
+    if (!value_token.toInt32(value) || value < 0 || value > 100) {
+        out.setCode("VOLUME_SET invalid_value");
+        return false;
+    }
+    out.setCode("VOLUME_SET");
+    return true;
+}
+
+bool cmdEcho(CommandArgView args, DispatchWriter& out) {
+    out.setJson(true);
+    out.print("{\"tokens\":[");
+    CommandArgView token;
+    bool first = true;
+    while (args.nextToken(token)) {
+        char text[64];
+        const size_t len = token.size < sizeof(text) - 1U ? token.size : sizeof(text) - 1U;
+        std::memcpy(text, token.data, len);
+        text[len] = '\0';
+        if (!first) {
+            out.print(",");
+        }
+        out.printJsonString(text);
+        first = false;
+    }
+    out.print("]}");
+    return true;
+}
+
+const CommandDispatcher::StaticCommand kCommands[] = {
+    {"ECHO", cmdEcho},
+    {"PING", cmdPing},
+    {"VOLUME_SET", cmdVolumeSet},
+};
+
+const CommandDispatcher::StaticCommand kUnsorted[] = {
+    {"PING", cmdPing},
+    {"ECHO", cmdEcho},
+};
+
+bool dispatchLine(const CommandDispatcher& dispatcher, const char* line, DispatchWriter& out) {
+    return dispatcher.dispatch(line, std::strlen(line), out);
+}
+
+}  // namespace
+
+void* operator new(size_t size) {
+    ++g_allocations;
+    void* ptr = std::malloc(size != 0U ? size : 1U);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+int main() {
+    CommandDispatcher dispatcher;
+    check(!dispatcher.setStaticCommands(kUnsorted, 2U), "unsorted table rejected");
+    check(dispatcher.setStaticCommands(kCommands, 3U), "sorted table accepted");
+    dispatcher.registerCommand("LEGACY", [](const String& args) {
+        DispatchResponse res;
+        res.code = "LEGACY";
+        res.raw = args;
+        return res;
+    });
+
+    char body[256];
+    DispatchWriter out(body, sizeof(body));
+
+    check(dispatchLine(dispatcher, "  ping \r\n", out) && std::strcmp(out.body(), "PONG") == 0, "PING body");
+    check(dispatchLine(dispatcher, "VOLUME_SET 42", out) && std::strcmp(out.code(), "VOLUME_SET") == 0, "VOLUME_SET ok");
+    check(dispatchLine(dispatcher, "volume_set \"7\"", out), "VOLUME_SET quoted");
+    check(!dispatchLine(dispatcher, "VOLUME_SET 101", out) && std::strcmp(out.code(), "VOLUME_SET invalid_value") == 0,
+          "VOLUME_SET range");
+    check(!dispatchLine(dispatcher, "VOLUME_SET 1 2", out) && std::strcmp(out.code(), "VOLUME_SET invalid_args") == 0,
+          "VOLUME_SET trailing");
+    check(!dispatchLine(dispatcher, "VOLUME_SET", out), "VOLUME_SET missing");
+    check(!dispatchLine(dispatcher, "   ", out) && std::strcmp(out.code(), "EMPTY_COMMAND") == 0, "empty line");
+    check(!dispatchLine(dispatcher, "volume_sets 1", out) &&
+              std::strcmp(out.code(), "unsupported_command VOLUME_SETS") == 0,
+          "unknown command");
+    check(!dispatchLine(dispatcher, "PIN", out), "prefix does not match");
+    check(dispatchLine(dispatcher, "ECHO a \"b c\" \"q\\\"\"", out) && out.isJson() &&
+              std::strcmp(out.body(), "{\"tokens\":[\"a\",\"b c\",\"q\\\\\\\"\"]}") == 0,
+          "ECHO tokens");
+    check(dispatchLine(dispatcher, "legacy  hello world", out) && std::strcmp(out.body(), "hello world") == 0 &&
+              std::strcmp(out.code(), "LEGACY") == 0,
+          "compat handler through writer");
+
+    const DispatchResponse res = dispatcher.dispatch(String("ping"));
+    check(res.ok && res.raw == "PONG", "String dispatch of a static command");
+    const DispatchResponse unknown = dispatcher.dispatch(String("nope x"));
+    check(!unknown.ok && unknown.code == "unsupported_command NOPE", "String dispatch unknown");
+    check(dispatcher.hasCommand(" Ping ") && dispatcher.hasCommand("legacy") && !dispatcher.hasCommand("PINGX"),
+          "hasCommand");
+    check(dispatcher.helpText() == "ECHO\nPING\nVOLUME_SET\nLEGACY", "helpText order");
+
+    char tiny[8];
+    DispatchWriter small(tiny, sizeof(tiny));
+    dispatchLine(dispatcher, "ECHO abcdefgh", small);
+    check(small.truncated() && small.length() == sizeof(tiny) - 1U && tiny[sizeof(tiny) - 1U] == '\0', "truncation");
+
+    const char* const kLines[] = {
+        "PING", "ping", "VOLUME_SET 55", "VOLUME_SET nope", "ECHO one \"two three\"", "UNKNOWN_CMD arg", "   ",
+    };
+    constexpr size_t kLineCount = sizeof(kLines) / sizeof(kLines[0]);
+    size_t lengths[kLineCount];
+    for (size_t i = 0U; i < kLineCount; ++i) {
+        lengths[i] = std::strlen(kLines[i]);
+    }
+
+    constexpr uint32_t kRounds = 200000U;
+    uint32_t ok_count = 0U;
+    g_allocations = 0U;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0U; round < kRounds; ++round) {
+        const size_t index = round % kLineCount;
+        ok_count += dispatcher.dispatch(kLines[index], lengths[index], out) ? 1U : 0U;
+    }
+    const double static_ns =
+        std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kRounds;
+    const size_t static_allocations = g_allocations;
+
+    g_allocations = 0U;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0U; round < kRounds; ++round) {
+        ok_count += dispatchLine(dispatcher, "LEGACY hello from a registered handler", out) ? 1U : 0U;
+    }
+    const double compat_ns =
+        std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kRounds;
+    const size_t compat_allocations = g_allocations;
+
+    std::printf("static table: %.3f allocs/dispatch, %.0f ns/dispatch\n",
+                static_cast<double>(static_allocations) / kRounds,
+                static_ns);
+    std::printf("registered  : %.3f allocs/dispatch, %.0f ns/dispatch (ok=%u)\n",
+                static_cast<double>(compat_allocations) / kRounds,
+                compat_ns,
+                ok_count);
+    check(static_allocations == 0U, "static dispatch is allocation-free");
+
+    if (g_failures != 0U) {
+        std::printf("[FAIL] %u checks\n", g_failures);
+        return 1;
+    }
+    std::printf("[OK] command dispatcher\n");
+    return 0;
+}
@@ -0,0 +1,222 @@
+// Host test: PolyphaseResampler THD+N and throughput, on generated banks and
+// on banks designed at runtime, plus generated tables vs the runtime design.
+// Build/run: scripts/branch_gate.sh (tests host)
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+
+#include "audio/PolyphaseResampler.h"
+#include "audio/PolyphaseResamplerTables.h"
+
+namespace {
+
+constexpr double kTwoPi = 6.283185307179586;
+constexpr double kToneHz = 1000.0;
+constexpr double kToneAmplitude = 0.5 * 32767.0;
+constexpr double kMaxThdNDb = -60.0;
+constexpr uint32_t kSeconds = 2U;
+constexpr size_t kChunkFrames = 256U;
+
+struct RateCase {
+    uint32_t in_hz;
+    uint32_t out_hz;
+    uint8_t in_channels;
+    uint8_t out_channels;
+};
+
+// Least-squares fit of a*sin + b*cos + c at kToneHz; returns residual/signal in dB.
+double thdNDb(const std::vector<int16_t>& pcm, uint8_t channels, uint8_t channel, uint32_t rate_hz, size_t skip) {
+    const size_t frames = pcm.size() / channels;
+    double ss = 0.0, sc = 0.0, cc = 0.0, s1 = 0.0, c1 = 0.0, n = 0.0;
+    double ys = 0.0, yc = 0.0, y1 = 0.0;
+    for (size_t i = skip; i < frames; ++i) {
+        const double w = kTwoPi * kToneHz * static_cast<double>(i) / static_cast<double>(rate_hz);
+        const double s = std::sin(w);
+        const double c = std::cos(w);
+        const double y = pcm[i * channels + channel];
+        ss += s * s; sc += s * c; cc += c * c; s1 += s; c1 += c; n += 1.0;
+        ys += y * s; yc += y * c; y1 += y;
+    }
+    // Solve the 3x3 normal equations with Cramer's rule.
+    const double m[3][3] = {{ss, sc, s1}, {sc, cc, c1}, {s1, c1, n}};
+    const double r[3] = {ys, yc, y1};
+    auto det3 = [](const double a[3][3]) {
+        return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+               a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+               a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+    };
+    const double d = det3(m);
+    double coef[3];
+    for (int col = 0; col < 3; ++col) {
+        double t[3][3];
+        for (int row = 0; row < 3; ++row) {
+            for (int k = 0; k < 3; ++k) {
+                t[row][k] = (k == col) ? r[row] : m[row][k];
+            }
+        }
+        coef[col] = det3(t) / d;
+    }
+
+    double signal = 0.0;
+    double noise = 0.0;
+    for (size_t i = skip; i < frames; ++i) {
+        const double w = kTwoPi * kToneHz * static_cast<double>(i) / static_cast<double>(rate_hz);
+        const double fit = coef[0] * std::sin(w) + coef[1] * std::cos(w) + coef[2];
+        const double e = pcm[i * channels + channel] - fit;
+        signal += fit * fit;
+        noise += e * e;
+    }
+    return 10.0 * std::log10((noise + 1.0e-9) / (signal + 1.0e-9));
+}
+
+bool runCase(const RateCase& rc) {
+    PolyphaseResampler resampler;
+    if (!resampler.configure(rc.in_hz, rc.out_hz, rc.in_channels, rc.out_channels)) {
+        std::printf("FAIL %u->%u configure\n", static_cast<unsigned>(rc.in_hz), static_cast<unsigned>(rc.out_hz));
+        return false;
+    }
+
+    const size_t in_frames = static_cast<size_t>(rc.in_hz) * kSeconds;
+    std::vector<int16_t> input(in_frames * rc.in_channels);
+    for (size_t i = 0U; i < in_frames; ++i) {
+        const double v = kToneAmplitude * std::sin(kTwoPi * kToneHz * static_cast<double>(i) / rc.in_hz);
+        for (uint8_t ch = 0U; ch < rc.in_channels; ++ch) {
+            input[i * rc.in_channels + ch] = static_cast<int16_t>(std::lround(v));
+        }
+    }
+
+    std::vector<int16_t> output;
+    output.reserve(resampler.maxOutputFrames(in_frames) * rc.out_channels);
+    // Deliberately small output buffer so the resume path is exercised.
+    std::vector<int16_t> scratch(97U * rc.out_channels);
+    const auto t0 = std::chrono::steady_clock::now();
+    size_t pos = 0U;
+    while (pos < in_frames) {
+        const size_t chunk = (in_frames - pos < kChunkFrames) ? (in_frames - pos) : kChunkFrames;
+        size_t offset = 0U;
+        while (offset < chunk) {
+            size_t consumed = 0U;
+            const size_t produced = resampler.process(&input[(pos + offset) * rc.in_channels],
+                                                      chunk - offset,
+                                                      &consumed,
+                                                      scratch.data(),
+                                                      97U);
+            output.insert(output.end(), scratch.begin(), scratch.begin() + produced * rc.out_channels);
+            offset += consumed;
+            if (consumed == 0U && produced == 0U) {
+                std::printf("FAIL %u->%u stalled\n", static_cast<unsigned>(rc.in_hz), static_cast<unsigned>(rc.out_hz));
+                return false;
+            }
+        }
+        pos += chunk;
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    const size_t out_frames = output.size() / rc.out_channels;
+    const double expected = static_cast<double>(in_frames) * rc.out_hz / rc.in_hz;
+    const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+    const double ns_per_sample = ns / static_cast<double>(output.size() > 0U ? output.size() : 1U);
+    double worst = -200.0;
+    for (uint8_t ch = 0U; ch < rc.out_channels; ++ch) {
+        const double db = thdNDb(output, rc.out_channels, ch, rc.out_hz, rc.out_hz / 20U);
+        if (db > worst) {
+            worst = db;
+        }
+    }
+
+    const bool length_ok = std::fabs(static_cast<double>(out_frames) - expected) <= 2.0;
+    const bool ok = length_ok && worst <= kMaxThdNDb;
+    std::printf("%s %5u/%u -> %5u/%u  L/M=%u/%u taps=%2u  frames=%zu  THD+N=%6.1f dB  %.1f ns/sample\n",
+                ok ? "ok  " : "FAIL",
+                static_cast<unsigned>(rc.in_hz),
+                static_cast<unsigned>(rc.in_channels),
+                static_cast<unsigned>(rc.out_hz),
+                static_cast<unsigned>(rc.out_channels),
+                static_cast<unsigned>(resampler.interpolation()),
+                static_cast<unsigned>(resampler.decimation()),
+                static_cast<unsigned>(resampler.tapsPerPhase()),
+                out_frames,
+                worst,
+                ns_per_sample);
+    return ok;
+}
+
+}  // namespace
+
+int main() {
+    const RateCase cases[] = {
+        {8000U, 16000U, 1U, 2U},
+        {8000U, 48000U, 1U, 1U},
+        {16000U, 8000U, 1U, 1U},
+        {16000U, 44100U, 1U, 2U},
+        {22050U, 16000U, 2U, 1U},
+        {22050U, 48000U, 2U, 2U},
+        {24000U, 16000U, 1U, 1U},
+        {44100U, 8000U, 2U, 1U},
+        {44100U, 16000U, 2U, 2U},
+        {44100U, 48000U, 2U, 2U},
+        {48000U, 8000U, 2U, 1U},
+        {48000U, 22050U, 2U, 2U},
+        {48000U, 44100U, 2U, 2U},
+        // No generated table for these ratios: designed at configure().
+        {12000U, 16000U, 1U, 1U},
+        {12000U, 44100U, 1U, 2U},
+        {32000U, 8000U, 2U, 1U},
+    };
+
+    int failures = 0;
+    for (const RateCase& rc : cases) {
+        if (!runCase(rc)) {
+            ++failures;
+        }
+    }
+
+    // The runtime design (float) must reproduce the offline tables (double).
+    for (size_t i = 0U; i < kPolyphaseBankTableCount; ++i) {
+        const PolyphaseBankTable& table = kPolyphaseBankTables[i];
+        const size_t total = static_cast<size_t>(table.up) * table.taps;
+        std::vector<int16_t> designed(total);
+        PolyphaseResampler::designBank(table.up, table.down, table.taps, designed.data());
+        int max_diff = 0;
+        for (size_t k = 0U; k < total; ++k) {
+            const int diff = std::abs(static_cast<int>(designed[k]) - table.coeffs[k]);
+            max_diff = (diff > max_diff) ? diff : max_diff;
+        }
+        if (max_diff > 1) {
+            std::printf("FAIL table L/M=%u/%u taps=%u differs from the runtime design by %d\n",
+                        static_cast<unsigned>(table.up),
+                        static_cast<unsigned>(table.down),
+                        static_cast<unsigned>(table.taps),
+                        max_diff);
+            ++failures;
+        }
+    }
+
+    PolyphaseResampler source;
+    if (!source.configure(44100U, 48000U, 2U, 2U) || !source.bankFromTable()) {
+        std::printf("FAIL 44100->48000 should use a generated table\n");
+        ++failures;
+    }
+    if (!source.configure(12000U, 16000U, 1U, 1U) || source.bankFromTable()) {
+        std::printf("FAIL 12000->16000 should be designed at runtime\n");
+        ++failures;
+    }
+
+    PolyphaseResampler cached;
+    cached.configure(44100U, 16000U, 2U, 2U);
+    const uint16_t taps = cached.tapsPerPhase();
+    if (!cached.configure(44100U, 16000U, 2U, 1U) || cached.tapsPerPhase() != taps) {
+        std::printf("FAIL reconfigure with same ratio\n");
+        ++failures;
+    }
+    if (cached.configure(44100U, 47999U, 2U, 2U)) {
+        std::printf("FAIL ratio with too many phases was accepted\n");
+        ++failures;
+    }
+
+    std::printf("%s (%d failure(s))\n", failures == 0 ? "PASS" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
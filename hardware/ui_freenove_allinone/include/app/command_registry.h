@@ -0,0 +1,185 @@
+// command_registry.h - one command table for serial, /api/control and ESP-NOW.
+#pragma once
+
+#include <Arduino.h>
+
+#include <cstddef>
+#include <cstdint>
+
+enum class CommandArgs : uint8_t {
+  kNone = 0,
+  kOptional,
+  kRequired,
+};
+
+enum class CommandTransport : uint8_t {
+  kSerial = 0,
+  kControl,
+  kEspNow,
+  kCount,
+};
+
+constexpr uint8_t kCommandSerial = 1U << static_cast<uint8_t>(CommandTransport::kSerial);
+constexpr uint8_t kCommandControl = 1U << static_cast<uint8_t>(CommandTransport::kControl);
+constexpr uint8_t kCommandEspNow = 1U << static_cast<uint8_t>(CommandTransport::kEspNow);
+
+// X(id, name, transports, args, usage). Serial HELP lists serial commands in
+// table order. Names are matched case-insensitively.
+#define FREENOVE_COMMAND_TABLE(X) \
+  X(kPing,                   "PING",                     kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kHelp,                   "HELP",                     kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kStatus,                 "STATUS",                   kCommandSerial | kCommandEspNow,                   CommandArgs::kNone,     "") \
+  X(kBtnRead,                "BTN_READ",                 kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kNext,                   "NEXT",                     kCommandSerial | kCommandControl | kCommandEspNow, CommandArgs::kNone,     "") \
+  X(kUnlock,                 "UNLOCK",                   kCommandSerial | kCommandControl | kCommandEspNow, CommandArgs::kNone,     "") \
+  X(kReset,                  "RESET",                    kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kScList,                 "SC_LIST",                  kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kScLoad,                 "SC_LOAD",                  kCommandSerial,                                    CommandArgs::kRequired, "<id>") \
+  X(kSceneGoto,              "SCENE_GOTO",               kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<scene_id>") \
+  X(kScCoverage,             "SC_COVERAGE",              kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kScRevalidate,           "SC_REVALIDATE",            kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kScRevalidateAll,        "SC_REVALIDATE_ALL",        kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kScEvent,                "SC_EVENT",                 kCommandSerial | kCommandControl | kCommandEspNow, CommandArgs::kRequired, "<type> [name]") \
+  X(kScEventRaw,             "SC_EVENT_RAW",             kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<name>") \
+  X(kStoryDebugBypass,       "STORY_DEBUG_BYPASS",       kCommandSerial,                                    CommandArgs::kRequired, "<ON|OFF>") \
+  X(kStoryRefreshSd,         "STORY_REFRESH_SD",         kCommandSerial | kCommandControl | kCommandEspNow, CommandArgs::kNone,     "") \
+  X(kStorySdStatus,          "STORY_SD_STATUS",          kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kUiGfxStatus,            "UI_GFX_STATUS",            kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kUiMemStatus,            "UI_MEM_STATUS",            kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kUiSceneStatus,          "UI_SCENE_STATUS",          kCommandSerial | kCommandEspNow,                   CommandArgs::kNone,     "") \
+  X(kPerfStatus,             "PERF_STATUS",              kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kPerfReset,              "PERF_RESET",               kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kCmdStatus,              "CMD_STATUS",               kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kCmdReset,               "CMD_RESET",                kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kResourceStatus,         "RESOURCE_STATUS",          kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kResourceProfile,        "RESOURCE_PROFILE",         kCommandSerial | kCommandControl,                  CommandArgs::kOptional, "[gfx_focus|gfx_plus_mic|gfx_plus_cam_snapshot]") \
+  X(kResourceProfileAuto,    "RESOURCE_PROFILE_AUTO",    kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<on|off>") \
+  X(kSimdStatus,             "SIMD_STATUS",              kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kSimdSelftest,           "SIMD_SELFTEST",            kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kSimdBench,              "SIMD_BENCH",               kCommandSerial | kCommandControl,                  CommandArgs::kOptional, "[loops] [pixels]") \
+  X(kHwStatus,               "HW_STATUS",                kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kHwStatusJson,           "HW_STATUS_JSON",           kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kHwLedSet,               "HW_LED_SET",               kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<r> <g> <b> [brightness] [pulse]") \
+  X(kHwLedAuto,              "HW_LED_AUTO",              kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<ON|OFF>") \
+  X(kHwMicStatus,            "HW_MIC_STATUS",            kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kHwBatStatus,            "HW_BAT_STATUS",            kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kLcdBacklight,           "LCD_BACKLIGHT",            kCommandSerial | kCommandControl,                  CommandArgs::kOptional, "[0..255]") \
+  X(kMicTunerStatus,         "MIC_TUNER_STATUS",         kCommandSerial,                                    CommandArgs::kOptional, "[ON|OFF|<period_ms>]") \
+  X(kCamStatus,              "CAM_STATUS",               kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kCamOn,                  "CAM_ON",                   kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kCamOff,                 "CAM_OFF",                  kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kCamSnapshot,            "CAM_SNAPSHOT",             kCommandSerial | kCommandControl,                  CommandArgs::kOptional, "[filename]") \
+  X(kCamUiShow,              "CAM_UI_SHOW",              kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kCamUiHide,              "CAM_UI_HIDE",              kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kCamUiToggle,            "CAM_UI_TOGGLE",            kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kCamRecSnap,             "CAM_REC_SNAP",             kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kCamRecSave,             "CAM_REC_SAVE",             kCommandSerial | kCommandControl,                  CommandArgs::kOptional, "[auto|bmp|jpg|raw]") \
+  X(kCamRecGallery,          "CAM_REC_GALLERY",          kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kCamRecNext,             "CAM_REC_NEXT",             kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kCamRecDelete,           "CAM_REC_DELETE",           kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kCamRecStatus,           "CAM_REC_STATUS",           kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kQrSim,                  "QR_SIM",                   kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<payload>") \
+  X(kMediaList,              "MEDIA_LIST",               kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<picture|music|recorder>") \
+  X(kMediaPlay,              "MEDIA_PLAY",               kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<path>") \
+  X(kMediaStop,              "MEDIA_STOP",               kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kRecStart,               "REC_START",                kCommandSerial | kCommandControl,                  CommandArgs::kOptional, "[seconds] [filename]") \
+  X(kRecStop,                "REC_STOP",                 kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kRecStatus,              "REC_STATUS",               kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kBootModeStatus,         "BOOT_MODE_STATUS",         kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kBootModeSet,            "BOOT_MODE_SET",            kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<STORY|MEDIA_MANAGER>") \
+  X(kBootModeClear,          "BOOT_MODE_CLEAR",          kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kNetStatus,              "NET_STATUS",               kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kWifiStatus,             "WIFI_STATUS",              kCommandSerial | kCommandEspNow,                   CommandArgs::kNone,     "") \
+  X(kWifiTest,               "WIFI_TEST",                kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kWifiSta,                "WIFI_STA",                 kCommandSerial,                                    CommandArgs::kRequired, "<ssid> <pass>") \
+  X(kWifiConnect,            "WIFI_CONNECT",             kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<ssid> <pass>") \
+  X(kWifiProvision,          "WIFI_PROVISION",           kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<ssid> <pass>") \
+  X(kWifiForget,             "WIFI_FORGET",              kCommandSerial | kCommandControl,                  CommandArgs::kNone,     "") \
+  X(kWifiDisconnect,         "WIFI_DISCONNECT",          kCommandSerial | kCommandControl | kCommandEspNow, CommandArgs::kNone,     "") \
+  X(kAuthStatus,             "AUTH_STATUS",              kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kAuthTokenRotate,        "AUTH_TOKEN_ROTATE",        kCommandSerial,                                    CommandArgs::kOptional, "[token]") \
+  X(kWifiApOn,               "WIFI_AP_ON",               kCommandSerial,                                    CommandArgs::kOptional, "[ssid] [pass]") \
+  X(kWifiApOff,              "WIFI_AP_OFF",              kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kEspnowOn,               "ESPNOW_ON",                kCommandSerial | kCommandControl | kCommandEspNow, CommandArgs::kNone,     "") \
+  X(kEspnowOff,              "ESPNOW_OFF",               kCommandSerial | kCommandControl | kCommandEspNow, CommandArgs::kNone,     "") \
+  X(kEspnowStatus,           "ESPNOW_STATUS",            kCommandSerial | kCommandEspNow,                   CommandArgs::kNone,     "") \
+  X(kEspnowStatusJson,       "ESPNOW_STATUS_JSON",       kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kEspnowDiscovery,        "ESPNOW_DISCOVERY",         kCommandSerial | kCommandEspNow,                   CommandArgs::kNone,     "") \
+  X(kEspnowDiscoveryRuntime, "ESPNOW_DISCOVERY_RUNTIME", kCommandSerial | kCommandEspNow,                   CommandArgs::kOptional, "[on|off]") \
+  X(kEspnowDeviceNameGet,    "ESPNOW_DEVICE_NAME_GET",   kCommandSerial | kCommandEspNow,                   CommandArgs::kNone,     "") \
+  X(kEspnowDeviceNameSet,    "ESPNOW_DEVICE_NAME_SET",   kCommandSerial | kCommandEspNow,                   CommandArgs::kRequired, "<name>") \
+  X(kEspnowPeerAdd,          "ESPNOW_PEER_ADD",          kCommandSerial,                                    CommandArgs::kRequired, "<mac>") \
+  X(kEspnowPeerDel,          "ESPNOW_PEER_DEL",          kCommandSerial,                                    CommandArgs::kRequired, "<mac>") \
+  X(kEspnowPeerList,         "ESPNOW_PEER_LIST",         kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kEspnowSend,             "ESPNOW_SEND",              kCommandSerial | kCommandControl,                  CommandArgs::kRequired, "<text|json>") \
+  X(kAmpShow,                "AMP_SHOW",                 kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kAmpHide,                "AMP_HIDE",                 kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kAmpToggle,              "AMP_TOGGLE",               kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kAmpScan,                "AMP_SCAN",                 kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kAmpPlay,                "AMP_PLAY",                 kCommandSerial,                                    CommandArgs::kRequired, "<idx|path>") \
+  X(kAmpNext,                "AMP_NEXT",                 kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kAmpPrev,                "AMP_PREV",                 kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kAmpStop,                "AMP_STOP",                 kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kAmpStatus,              "AMP_STATUS",               kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kAudioTest,              "AUDIO_TEST",               kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kAudioTestFs,            "AUDIO_TEST_FS",            kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kAudioProfile,           "AUDIO_PROFILE",            kCommandSerial,                                    CommandArgs::kRequired, "<idx>") \
+  X(kAudioFx,                "AUDIO_FX",                 kCommandSerial,                                    CommandArgs::kRequired, "<idx>") \
+  X(kAudioStatus,            "AUDIO_STATUS",             kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kVol,                    "VOL",                      kCommandSerial,                                    CommandArgs::kRequired, "<0..21>") \
+  X(kAudioStop,              "AUDIO_STOP",               kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kStop,                   "STOP",                     kCommandSerial,                                    CommandArgs::kNone,     "") \
+  X(kWifiReconnect,          "WIFI_RECONNECT",           kCommandControl | kCommandEspNow,                  CommandArgs::kNone,     "") \
+  X(kRing,                   "RING",                     kCommandEspNow,                                    CommandArgs::kNone,     "") \
+  X(kScene,                  "SCENE",                    kCommandEspNow,                                    CommandArgs::kRequired, "<scene_id>")
+
+enum class CommandId : uint8_t {
+  kUnknown = 0,
+#define FREENOVE_COMMAND_ID(id, name, transports, args, usage) id,
+  FREENOVE_COMMAND_TABLE(FREENOVE_COMMAND_ID)
+#undef FREENOVE_COMMAND_ID
+  kCount,
+};
+
+struct CommandSpec {
+  const char* name;
+  uint8_t transports;
+  CommandArgs args;
+  const char* usage;
+};
+
+struct CommandStats {
+  uint32_t calls = 0U;
+  uint32_t errors = 0U;
+  uint64_t total_us = 0ULL;
+  uint32_t max_us = 0U;
+};
+
+class CommandRegistry {
+ public:
+  // O(1): one perfect-hash probe and one name compare. Returns kUnknown when
+  // the name is not registered or not available on `transport`.
+  static CommandId find(const char* name, size_t len, CommandTransport transport);
+  // Splits "NAME args": returns the id and points `out_args` at the first
+  // non-space byte after the name (nullptr when there is none).
+  static CommandId parse(const char* text, CommandTransport transport, const char** out_args);
+  static const CommandSpec& spec(CommandId id);
+  static const char* name(CommandId id);
+  static bool acceptsArgs(CommandId id, bool has_args);
+
+  // Calls nest (serial -> control action); only the outermost one is counted.
+  uint32_t beginCall();
+  void endCall(CommandId id, CommandTransport transport, uint32_t started_us, bool ok);
+  const CommandStats& stats(CommandId id) const;
+  uint32_t transportCalls(CommandTransport transport) const;
+  void resetStats();
+  void printHelp() const;
+  void dumpStatus() const;
+
+ private:
+  CommandStats stats_[static_cast<uint8_t>(CommandId::kCount)] = {};
+  uint32_t transport_calls_[static_cast<uint8_t>(CommandTransport::kCount)] = {};
+  uint8_t depth_ = 0U;
+};
+
+CommandRegistry& commandRegistry();
@@ -5,6 +5,8 @@
 #include <ArduinoJson.h>
 
 #include "core/scenario_def.h"
+#include "core/scenario_graph.h"
+#include "core/story_deadlines.h"
 
 struct ScenarioSnapshot {
   const ScenarioDef* scenario = nullptr;
@@ -35,6 +37,8 @@ struct Runtime3ArtifactInfo {
 
 class ScenarioManager {
  public:
+  ScenarioManager();
+
   static const char* readScenarioField(JsonVariantConst root,
                                        const char* const* candidates,
                                        size_t candidate_count);
@@ -63,6 +67,10 @@ class ScenarioManager {
   uint32_t transitionEventMask() const;
   void setDebugTransitionBypassEnabled(bool enabled, const char* source);
   bool debugTransitionBypassEnabled() const;
+  // Registers the after_ms / ETAPE2_DUE / WIN_DUE timers in a shared queue
+  // (defaults to an internal one). nullptr reverts to the internal queue.
+  void setDeadlineQueue(StoryDeadlineQueue* deadlines);
+  bool nextDueAtMs(uint32_t* out_due_at_ms) const;
 
  private:
   struct StepResourceOverride {
@@ -77,6 +85,7 @@ class ScenarioManager {
 
   static constexpr uint8_t kMaxStepResourceOverrides = 24U;
 
+  bool compileScenario();
   void clearStepResourceOverrides();
   void clearRuntime3ArtifactInfo();
   void loadRuntime3ArtifactInfo(const char* scenario_file_path, const char* scenario_id);
@@ -89,25 +98,27 @@ class ScenarioManager {
                                  uint8_t* out_action_count = nullptr) const;
 
   bool dispatchEvent(StoryEventType type, const char* event_name, uint32_t now_ms, const char* source);
-  bool applyTransition(const TransitionDef& transition, uint32_t now_ms, const char* source, const char* event_name);
+  bool applyTransition(uint8_t transition_index, uint32_t now_ms, const char* source, const char* event_name);
   bool runImmediateTransitions(uint32_t now_ms, const char* source, const char* parent_event_name);
   void evaluateAfterMsTransitions(uint32_t now_ms);
+  void acquireTimers();
+  void armAfterMsTimer(uint32_t min_after_ms);
+  void armEtape2Timer(uint32_t now_ms);
   void enterStep(int8_t step_index, uint32_t now_ms, const char* source, const char* event_name = nullptr);
   const StepDef* currentStep() const;
-  bool transitionMatches(const TransitionDef& transition, StoryEventType type, const char* event_name) const;
   bool isTransitionAllowed(const TransitionDef& transition, const char* context, const char* event_name) const;
 
   const ScenarioDef* scenario_ = nullptr;
+  StoryScenarioGraph graph_;
   int8_t current_step_index_ = -1;
   uint32_t step_entered_at_ms_ = 0U;
   bool scene_changed_ = false;
   bool test_mode_ = false;
-  bool timer_armed_ = false;
-  bool timer_fired_ = false;
-  uint32_t etape2_due_at_ms_ = 0U;
-  bool win_due_armed_ = false;
-  bool win_due_fired_ = false;
-  uint32_t win_due_at_ms_ = 0U;
+  StoryDeadlineQueue own_deadlines_;
+  StoryDeadlineQueue* deadlines_ = &own_deadlines_;
+  int8_t after_ms_timer_ = StoryDeadlineQueue::kInvalidTimer;
+  int8_t etape2_timer_ = StoryDeadlineQueue::kInvalidTimer;
+  int8_t win_due_timer_ = StoryDeadlineQueue::kInvalidTimer;
   bool debug_transition_bypass_enabled_ = false;
   String pending_audio_pack_;
   String forced_screen_scene_id_;
@@ -0,0 +1,25 @@
+// step_action_gate.h - when a scenario step's actions run, and when the step
+// really changed (the recorder's auto-stop hangs off the latter).
+#pragma once
+
+#include <cstddef>
+
+class StepActionGate {
+ public:
+  static constexpr size_t kKeyCapacity = 72U;
+
+  struct Decision {
+    // The "<scenario>:<step>" key differs from the previous pass.
+    bool step_changed = false;
+    // Actions run on entry and again on any pass that re-renders the step.
+    bool run_actions = false;
+  };
+
+  Decision enter(const char* step_key, bool has_actions);
+  // Makes the next enter() a step change (goto, reload, reset).
+  void invalidate();
+  const char* lastKey() const;
+
+ private:
+  char last_key_[kKeyCapacity] = {0};
+};
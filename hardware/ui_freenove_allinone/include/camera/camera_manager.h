@@ -2,10 +2,21 @@
 #pragma once
 
 #include <Arduino.h>
-#include <vector>
+
+#include <atomic>
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+#include "camera/camera_pipeline.h"
+#include "runtime/simd/simd_downscale.h"
 
 class CameraManager {
  public:
+  // kAuto/kJpeg keep sensor JPEG frames as-is and encode RGB565 frames in
+  // software (camera/jpeg_stream_encoder.h).
   enum class RecorderSaveFormat : uint8_t {
     kAuto = 0,
     kBmp24,
@@ -44,8 +55,17 @@ class CameraManager {
     uint16_t recorder_preview_width = 0U;
     uint16_t recorder_preview_height = 0U;
     char recorder_selected_file[96] = "";
+    bool luma_stream_active = false;
+    bool luma_stream_paced = false;
+    uint32_t luma_frame_count = 0U;
+    uint32_t luma_drop_count = 0U;
+    uint32_t luma_stall_count = 0U;
   };
 
+  // Admission check for camera work started from inside the manager (the
+  // luma stream); wired to ResourceCoordinator::approveCameraOperation.
+  using OperationGate = bool (*)(const char* operation);
+
   CameraManager();
   ~CameraManager() = default;
   CameraManager(const CameraManager&) = delete;
@@ -69,36 +89,82 @@ class CameraManager {
   int recorderListPhotos(String* out, int max_items, bool newest_first = true) const;
   bool recorderRemoveFile(const char* path);
   bool recorderSelectNextPhoto(String* in_out_path) const;
+  // Grayscale QVGA stream for the QR scanner: a capture task publishes each
+  // driver frame into pipeline() as the latest frame, without copying.
+  // Refused while a recorder session owns the sensor or when the operation
+  // gate says no; stopping restores the default mode if the camera was
+  // running before.
+  bool startLumaStream();
+  void stopLumaStream();
+  bool lumaStreamActive() const;
+  // Under graphics pressure the stream drops to a few frames per second.
+  void setStreamPaced(bool paced);
+  void setOperationGate(OperationGate gate) { operation_gate_ = gate; }
+  camera::CameraPipeline& pipeline() { return pipeline_; }
   Snapshot snapshot() const;
 
  private:
+  enum class CaptureMode : uint8_t {
+    kDefault = 0,  // JPEG at the configured frame size (snapshots)
+    kRecorder,     // RGB565 QVGA, single buffer (photo recorder preview)
+    kLumaScan,     // grayscale QVGA, double buffer (QR scan)
+  };
+
+
   void setLastError(const char* message);
   void clearLastError();
   bool ensureSnapshotDir();
   String buildSnapshotPath(const char* filename_hint) const;
-  bool initCameraForMode(bool recorder_mode);
+  bool initCameraForMode(CaptureMode mode);
+  bool captureFrame(camera::FrameRef* out);
+  void stopLumaTask();
+  static const char* modeName(CaptureMode mode);
   bool saveRgb565AsBmp24(const char* path, const uint16_t* rgb565, int w, int h, int stride_px);
+  bool saveRgb565AsJpeg(const char* path, const uint16_t* rgb565, int w, int h, int stride_px);
   bool saveRgb565Raw(const char* path, const uint16_t* rgb565, int w, int h, int stride_px);
-  bool downscaleToRgb565(const uint16_t* src,
+  bool downscaleToRgb565(const void* src,
+                         runtime::simd::DownscaleSource format,
                          int src_w,
                          int src_h,
                          int src_stride_px,
                          uint16_t* dst,
                          int dst_w,
                          int dst_h) const;
-  void ensurePreviewMap(int src_w, int src_h, int dst_w, int dst_h) const;
   static bool isPhotoExtension(const String& name);
   static RecorderSaveFormat parseSaveFormatToken(const char* token);
 
+#if defined(ARDUINO_ARCH_ESP32)
+  static void lumaTaskEntry(void* arg);
+  void lumaTaskMain();
+  // Waits up to kFrameDrainTimeoutMs for consumers to let go of their frames,
+  // then deinits the driver now or on the last release.
+  void releaseDriver();
+
+  static constexpr uint16_t kLumaTaskStackWords = 3072U;
+  static constexpr uint8_t kLumaTaskPriority = 2U;
+  static constexpr int8_t kLumaTaskCore = 0;
+  static constexpr uint16_t kLumaStopTimeoutMs = 300U;
+  static constexpr uint16_t kFrameDrainTimeoutMs = 300U;
+  static constexpr uint16_t kLumaPacedIntervalMs = 200U;
+  static constexpr uint16_t kStreamFrameWaitMs = 250U;
+
+  TaskHandle_t luma_task_ = nullptr;
+#endif
+
   Config config_;
   Snapshot snapshot_;
-  bool recorder_mode_ = false;
+  CaptureMode mode_ = CaptureMode::kDefault;
+  bool luma_resume_default_ = false;
+  uint8_t luma_max_in_flight_ = 1U;
+  std::atomic<bool> luma_stop_requested_{false};
+  std::atomic<bool> luma_task_exited_{true};
+  std::atomic<bool> luma_paced_{false};
+  std::atomic<uint32_t> luma_frames_{0U};
+  std::atomic<uint32_t> luma_drops_{0U};
+  std::atomic<uint32_t> luma_stalls_{0U};
+  OperationGate operation_gate_ = nullptr;
+  camera::CameraPipeline pipeline_;
   bool recorder_frozen_ = false;
-  void* recorder_frozen_fb_ = nullptr;
-  mutable int preview_map_src_w_ = 0;
-  mutable int preview_map_src_h_ = 0;
-  mutable int preview_map_dst_w_ = 0;
-  mutable int preview_map_dst_h_ = 0;
-  mutable std::vector<uint16_t> preview_x_map_ = {};
-  mutable std::vector<uint16_t> preview_y_map_ = {};
+  camera::FrameRef recorder_frozen_frame_;
+  mutable runtime::simd::BoxDownscaler preview_scaler_;
 };
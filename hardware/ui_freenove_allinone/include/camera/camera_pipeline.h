@@ -1,51 +1,152 @@
+// camera_pipeline.h - refcounted frame pool shared by camera consumers.
 #pragma once
 
 #include <cstddef>
 #include <cstdint>
 
+#if defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#else
+#include <mutex>
+#endif
+
 namespace camera {
 
-struct CameraFrameMeta {
-  uint32_t timestamp_ms = 0U;
+enum class FrameFormat : uint8_t {
+  kUnknown = 0,
+  kGray8,
+  kRgb565,
+  kYuv422,
+  kJpeg,
+};
+
+// Gives a buffer back to whoever produced it (esp_camera_fb_return, slab
+// free, ...). Called exactly once per published frame, by the thread that
+// drops the last reference, outside the pipeline lock.
+using FrameReleaseFn = void (*)(void* owner, void* handle);
+// Deferred teardown, see CameraPipeline::runWhenIdle().
+using PipelineIdleFn = void (*)(void* owner);
+
+struct FrameDesc {
+  const uint8_t* data = nullptr;
+  size_t bytes = 0U;
   uint16_t width = 0U;
   uint16_t height = 0U;
-  size_t bytes = 0U;
-  bool jpeg = false;
+  uint16_t stride = 0U;  // bytes per row; 0 for JPEG
+  FrameFormat format = FrameFormat::kUnknown;
+  uint32_t timestamp_ms = 0U;
+  uint32_t sequence = 0U;  // assigned by CameraPipeline::publish()
+  FrameReleaseFn release = nullptr;
+  void* owner = nullptr;
+  void* handle = nullptr;
+};
+
+class CameraPipeline;
+
+// Shared reference to a pooled frame: copies retain, destruction or reset()
+// releases. A FrameRef object itself is not thread-safe; each thread keeps
+// its own.
+class FrameRef {
+ public:
+  FrameRef() = default;
+  FrameRef(const FrameRef& other);
+  FrameRef(FrameRef&& other) noexcept;
+  FrameRef& operator=(const FrameRef& other);
+  FrameRef& operator=(FrameRef&& other) noexcept;
+  ~FrameRef() { reset(); }
+
+  void reset();
+  bool valid() const { return pipeline_ != nullptr; }
+  explicit operator bool() const { return valid(); }
+  const FrameDesc& desc() const;
+  const FrameDesc* operator->() const { return &desc(); }
+
+ private:
+  friend class CameraPipeline;
+  FrameRef(CameraPipeline* pipeline, uint8_t slot) : pipeline_(pipeline), slot_(slot) {}
+
+  CameraPipeline* pipeline_ = nullptr;
+  uint8_t slot_ = 0U;
+};
+
+struct CameraPipelineStats {
+  uint32_t published = 0U;
+  uint32_t rejected = 0U;    // publish() while every slot was referenced
+  uint32_t superseded = 0U;  // kept frames replaced before anyone took them
+  uint32_t acquired = 0U;
+  uint8_t in_flight = 0U;
+  uint8_t peak_in_flight = 0U;
 };
 
+// Fixed pool of frame slots between one producer (capture) and any number of
+// consumers (QR worker, preview, snapshot/save). Buffers are never copied: a
+// slot records where the producer's buffer lives and how to give it back, and
+// the buffer returns to its owner when the last FrameRef lets go.
+// A full pool is the back-pressure signal: publish() refuses the frame and
+// the producer keeps (and returns) its buffer.
 class CameraPipeline {
  public:
-  static constexpr uint8_t kFrameQueueDepth = 4U;
-
-  bool pushFrame(const CameraFrameMeta& frame) {
-    if (count_ >= kFrameQueueDepth) {
-      return false;
-    }
-    frames_[write_] = frame;
-    write_ = static_cast<uint8_t>((write_ + 1U) % kFrameQueueDepth);
-    ++count_;
-    return true;
-  }
-
-  bool popFrame(CameraFrameMeta* out_frame) {
-    if (out_frame == nullptr || count_ == 0U) {
-      return false;
-    }
-    *out_frame = frames_[read_];
-    read_ = static_cast<uint8_t>((read_ + 1U) % kFrameQueueDepth);
-    --count_;
-    return true;
-  }
-
-  uint8_t pendingFrames() const {
-    return count_;
-  }
+  static constexpr uint8_t kPoolSlots = 4U;
+
+  CameraPipeline() = default;
+  ~CameraPipeline();
+  CameraPipeline(const CameraPipeline&) = delete;
+  CameraPipeline& operator=(const CameraPipeline&) = delete;
+
+  // With `keep_latest` the pipeline holds the frame for acquireLatest() until
+  // the next kept publish (streaming producers); otherwise only `out`
+  // references it. False when no slot is free or `desc` has no release hook.
+  bool publish(const FrameDesc& desc, bool keep_latest, FrameRef* out = nullptr);
+  // Newest kept frame with a sequence above `after_sequence`.
+  bool acquireLatest(FrameRef* out, uint32_t after_sequence = 0U);
+  void dropLatest();
+
+  uint8_t framesInFlight() const;
+  // Runs `fn(owner)` once no frame is referenced and every release hook has
+  // returned: right away (true), or later from the thread that releases the
+  // last frame (false). Used to free the buffers the slots point at without
+  // pulling them from under a live FrameRef. A later call replaces a pending
+  // one.
+  bool runWhenIdle(PipelineIdleFn fn, void* owner);
+  // True from a deferred runWhenIdle() until its callback has returned.
+  bool idleCallPending() const;
+  CameraPipelineStats stats() const;
+  void resetStats();
 
  private:
-  CameraFrameMeta frames_[kFrameQueueDepth] = {};
-  uint8_t read_ = 0U;
-  uint8_t write_ = 0U;
-  uint8_t count_ = 0U;
+  friend class FrameRef;
+
+  struct Slot {
+    FrameDesc desc;
+    uint16_t refs = 0U;
+    bool taken = false;  // acquired at least once through acquireLatest()
+  };
+
+  void retain(uint8_t slot);
+  void release(uint8_t slot);
+  // Drops one reference under the lock; true when the caller must run the
+  // release hook saved in `out`.
+  bool unrefLocked(uint8_t slot, FrameDesc* out);
+  // Runs the release hook of a frame unrefLocked() freed, then the idle
+  // callback if that was the last outstanding buffer.
+  void returnFrame(const FrameDesc& released);
+  void runIdleCall(PipelineIdleFn fn, void* owner);
+  void lock() const;
+  void unlock() const;
+
+  Slot slots_[kPoolSlots] = {};
+  int8_t latest_ = -1;
+  uint32_t sequence_ = 0U;
+  CameraPipelineStats stats_ = {};
+  uint8_t returning_ = 0U;  // release hooks running outside the lock
+  PipelineIdleFn idle_fn_ = nullptr;
+  void* idle_owner_ = nullptr;
+  bool idle_running_ = false;
+#if defined(ARDUINO_ARCH_ESP32)
+  mutable portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+#else
+  mutable std::mutex lock_;
+#endif
 };
 
 }  // namespace camera
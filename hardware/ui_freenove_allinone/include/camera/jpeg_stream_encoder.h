@@ -0,0 +1,82 @@
+// jpeg_stream_encoder.h - strip-based baseline JPEG encoder for RGB565 frames.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace camera {
+
+// Baseline (SOF0) JPEG encoder fed one MCU row of RGB565 pixels at a time.
+// Compressed bytes go through a small internal buffer to a write callback, so
+// saving a frame never needs a full-size intermediate. Pixels are read as
+// native uint16 values (R in bits 15..11), like the BMP/raw save paths.
+class JpegStreamEncoder {
+ public:
+  // Returns false to abort the encode (write error).
+  typedef bool (*WriteFn)(void* ctx, const uint8_t* data, size_t len);
+
+  enum class Subsampling : uint8_t {
+    k444 = 0,
+    k420,
+  };
+
+  struct Options {
+    uint8_t quality = 80U;  // IJG scale, 1..100
+    Subsampling subsampling = Subsampling::k420;
+  };
+
+  static constexpr size_t kOutBufferBytes = 1024U;
+
+  // Maps the esp32-camera jpeg_quality knob (4..63, lower is better) to 1..100.
+  static uint8_t qualityFromCameraScale(uint8_t camera_quality);
+
+  // Writes the headers. Width/height up to 65535.
+  bool begin(int width, int height, const Options& options, WriteFn write, void* ctx);
+  // Encodes the next `rows` source rows (stripRows(), fewer only for the last
+  // strip). Missing edge pixels replicate the last column/row.
+  bool encodeStrip(const uint16_t* rgb565, int stride_px, int rows);
+  // Pads the entropy stream and writes EOI. False if any write failed or
+  // not every row was supplied.
+  bool finish();
+
+  int stripRows() const;
+  size_t bytesWritten() const;
+
+  // Whole-frame helper: begin() + one encodeStrip() per MCU row + finish().
+  bool encodeRgb565(const uint16_t* pixels,
+                    int width,
+                    int height,
+                    int stride_px,
+                    const Options& options,
+                    WriteFn write,
+                    void* ctx);
+
+ private:
+  void encodeMcu420(const uint16_t* strip, int stride_px, int rows, int x0);
+  void encodeMcu444(const uint16_t* strip, int stride_px, int rows, int x0);
+  void encodeBlock(float* block, const float* fdtbl, int* last_dc, bool chroma);
+  void putBits(uint32_t bits, uint32_t len);
+  void putByte(uint8_t value);
+  void putMarkerBytes(const uint8_t* data, size_t len);
+  void flushBuffer();
+
+  WriteFn write_ = nullptr;
+  void* ctx_ = nullptr;
+  int width_ = 0;
+  int height_ = 0;
+  int rows_done_ = 0;
+  bool subsample_ = true;
+  bool ok_ = false;
+  float fdtbl_y_[64] = {};
+  float fdtbl_c_[64] = {};
+  int dc_y_ = 0;
+  int dc_cb_ = 0;
+  int dc_cr_ = 0;
+  uint32_t bit_buffer_ = 0U;
+  uint32_t bit_count_ = 0U;
+  size_t out_len_ = 0U;
+  size_t bytes_written_ = 0U;
+  uint8_t out_[kOutBufferBytes] = {};
+};
+
+}  // namespace camera
@@ -80,6 +80,10 @@ class HardwareManager {
   const Snapshot& snapshotRef() const;
   void setMicRuntimeEnabled(bool enabled);
   bool micRuntimeEnabled() const;
+  // I2S RX driver installed by begin(); MediaManager reads it while recording.
+  bool micDriverReady() const;
+  int micPort() const;
+  uint32_t micSampleRate() const;
   void setSceneSingleRandomBlink(bool enabled,
                                  uint8_t r,
                                  uint8_t g,
@@ -11,7 +11,6 @@ class LaTriggerService {
  public:
   struct UpdateResult {
     bool gate_active = false;
-    bool timed_out = false;
     bool lock_ready = false;
   };
 
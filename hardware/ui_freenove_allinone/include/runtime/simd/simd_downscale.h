@@ -0,0 +1,83 @@
+// simd_downscale.h - fused color conversion + box-filter downscale to RGB565.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace runtime::simd {
+
+enum class DownscaleSource : uint8_t {
+  kRgb565 = 0,  // native uint16 pixels
+  kYuv422,      // YUYV bytes, U/V shared by each pixel pair; even width and
+                // stride, 4-byte aligned buffer
+};
+
+// Area-averaging downscaler that converts and filters in one pass, one
+// destination row at a time, straight into the caller's buffer (LVGL image,
+// canvas or DMA line buffer). RGB565 channels are accumulated SWAR-style in
+// one 32-bit word per column (R/G/B spread with headroom), YUV422 one pixel
+// pair per 32-bit load into packed Y and U|V lanes; each destination pixel is
+// converted to RGB565 once.
+// Boxes up to kPackedMaxArea source pixels take the packed path; larger ones
+// fall back to per-channel sums. Column/row spans and accumulators are kept
+// between frames and rebuilt only when the geometry changes.
+class BoxDownscaler {
+ public:
+  static constexpr int kPackedMaxArea = 32;
+
+  // False on invalid sizes (max 65535 per side). Cheap when the geometry is
+  // unchanged. Upscaling degrades to one source pixel per destination pixel.
+  bool configure(int src_w, int src_h, int dst_w, int dst_h);
+  void reset();
+  bool configured() const;
+
+  // `src_stride_px` in pixels (not bytes); `dst_stride_px` lets the caller
+  // target a sub-rectangle. `swap_bytes` writes byte-swapped RGB565 for
+  // SPI/DMA targets (LV_COLOR_16_SWAP).
+  bool run(const void* src,
+           DownscaleSource format,
+           int src_stride_px,
+           uint16_t* dst,
+           int dst_stride_px,
+           bool swap_bytes = false);
+
+  int maxBoxArea() const;
+
+ private:
+  void runPackedRgb565(const uint16_t* src, int src_stride_px, uint16_t* dst, int dst_stride_px, bool swap_bytes);
+  void runPackedYuv422(const uint8_t* src, int src_stride_px, uint16_t* dst, int dst_stride_px, bool swap_bytes);
+  void runWide(const void* src,
+               DownscaleSource format,
+               int src_stride_px,
+               uint16_t* dst,
+               int dst_stride_px,
+               bool swap_bytes);
+
+  int src_w_ = 0;
+  int src_h_ = 0;
+  int dst_w_ = 0;
+  int dst_h_ = 0;
+  int max_area_ = 0;
+  std::vector<uint16_t> x0_ = {};  // per destination column: first source column
+  std::vector<uint16_t> x1_ = {};  // one past the last
+  std::vector<uint16_t> y0_ = {};
+  std::vector<uint16_t> y1_ = {};
+  std::vector<uint32_t> acc_a_ = {};  // packed RGB or Y; R on the wide RGB path
+  std::vector<uint32_t> acc_b_ = {};  // packed U|V; G or U on the wide path
+  std::vector<uint32_t> acc_c_ = {};  // B or V on the wide path
+};
+
+// One-shot helper for occasional scaling (thumbnails): configures a
+// temporary downscaler and runs it.
+bool simd_box_downscale_to_rgb565(const void* src,
+                                  DownscaleSource format,
+                                  int src_w,
+                                  int src_h,
+                                  int src_stride_px,
+                                  uint16_t* dst,
+                                  int dst_w,
+                                  int dst_h,
+                                  int dst_stride_px);
+
+}  // namespace runtime::simd
@@ -2,6 +2,11 @@
 #pragma once
 
 #include <Arduino.h>
+#include <FS.h>
+
+#include "fs/story_content_cache.h"
+#include "fs/story_sync_journal.h"
+#include "fs/story_verify_cache.h"
 
 class StorageManager {
  public:
@@ -10,8 +15,42 @@ class StorageManager {
     String source_kind;
   };
 
+  struct VerifyStats {
+    uint32_t files = 0U;
+    uint32_t hashed = 0U;
+    uint32_t cached = 0U;
+    uint32_t failed = 0U;
+    uint32_t unlisted = 0U;  // no manifest entry or sidecar: digest cached only
+    uint32_t hashed_bytes = 0U;
+    uint32_t last_sweep_ms = 0U;
+    bool sweep_active = false;
+    uint8_t pending = 0U;
+  };
+
+  struct SyncStats {
+    uint16_t planned = 0U;  // files found on SD
+    uint16_t copied = 0U;
+    uint16_t skipped = 0U;  // unchanged
+    uint16_t failed = 0U;
+    uint32_t bytes_copied = 0U;
+    uint32_t elapsed_ms = 0U;
+    uint32_t kbps = 0U;              // KB/s over elapsed_ms
+    uint32_t blocked_max_us = 0U;    // longest single updateStorySync()
+    uint32_t blocked_total_ms = 0U;  // time spent inside updateStorySync()
+    bool active = false;
+    bool resumed = false;
+  };
+
+  struct ContentCacheStats {
+    StoryContentCache::KindStats kinds[static_cast<size_t>(StoryContentKind::kCount)];
+    uint32_t hit_rate_permille[static_cast<size_t>(StoryContentKind::kCount)] = {};
+    uint32_t bytes_held = 0U;
+    uint32_t capacity = 0U;
+    bool psram = false;
+  };
+
   StorageManager() = default;
-  ~StorageManager() = default;
+  ~StorageManager();
   StorageManager(const StorageManager&) = delete;
   StorageManager& operator=(const StorageManager&) = delete;
   StorageManager(StorageManager&&) = delete;
@@ -22,20 +61,45 @@ class StorageManager {
   bool fileExists(const char* path) const;
   String loadTextFile(const char* path) const;
   String loadScenePayloadById(const char* scene_id) const;
+  // Same lookups without copying: the view shares the cached bytes and keeps
+  // them alive until released. Empty when the file is missing.
+  StoryContentView loadTextView(const char* path) const;
+  StoryContentView loadScenePayloadView(const char* scene_id) const;
   String resolveAudioPathByPackId(const char* pack_id) const;
   bool hasSdCard() const;
+  // True when LittleFS now matches SD (copied or already identical).
   bool syncStoryFileFromSd(const char* story_path);
+  // Blocking run of the sync below; true when the tree matches SD afterwards.
   bool syncStoryTreeFromSd();
+  // Background SD -> LittleFS sync of the story tree: only changed files are
+  // copied, a bounded chunk per updateStorySync(). resumeStorySync() picks up
+  // an interrupted run from its journal. updateStorySync() returns true once,
+  // when a run that changed files completes.
+  bool beginStorySync(uint32_t now_ms);
+  bool resumeStorySync(uint32_t now_ms);
+  bool updateStorySync(uint32_t now_ms);
+  SyncStats syncStats() const;
   bool ensureDefaultStoryBundle();
   bool ensureDefaultScenarioFile(const char* path);
+  // FNV-1a of the file; LittleFS results are cached by (path, size, mtime).
   uint32_t checksum(const char* path) const;
+  // checksum() of the copy loadTextFile() reads: LittleFS unless missing or
+  // empty, then SD. out_origin gets that path ("/sd/..." for SD), or stays
+  // empty with a 0 result when neither has the file.
+  uint32_t loadedChecksum(const char* path, String* out_origin) const;
   ScenePayloadMeta lastScenePayloadMeta() const;
+  // Background integrity check, one slice per call from the loop: files
+  // synced from SD first, then a sweep of /story/integrity.sha256.
+  void updateVerification(uint32_t now_ms);
+  bool scheduleBundleVerification(uint32_t now_ms);
+  VerifyStats verifyStats() const;
+  ContentCacheStats contentCacheStats() const;
 
  private:
   bool mountSdCard();
-  bool readTextFileWithOrigin(const char* path, String* out_payload, String* out_origin) const;
   bool readTextFromLittleFs(const char* path, String* out_payload) const;
-  bool readTextFromSdCard(const char* path, String* out_payload) const;
+  StoryContentCache* contentCache() const;
+  StoryContentView readContentView(StoryContentKind kind, const char* key, const char* path, String* out_origin) const;
   String normalizeAbsolutePath(const char* path) const;
   String stripSdPrefix(const char* path) const;
   bool pathExistsOnLittleFs(const char* path) const;
@@ -44,25 +108,51 @@ class StorageManager {
   bool writeTextToLittleFs(const char* path, const char* payload) const;
   bool provisionEmbeddedAsset(const char* path, const char* payload, bool* out_written = nullptr) const;
   bool copyFileFromSdToLittleFs(const char* src_path, const char* dst_path) const;
-  bool copyStoryDirectoryFromSd(const char* relative_dir);
   String resolveReadableAssetPath(const String& absolute_path) const;
   void invalidateStoryCaches() const;
   bool isStoryScreenPayloadPresent() const;
   void noteSdAccessFailure(const char* operation, const char* path, int error_code) const;
   void noteSdAccessSuccess() const;
+  struct VerifyJob;
+  bool ensureVerifyState() const;
+  uint32_t checksumFile(File& file, const char* cache_path) const;
+  void enqueueVerification(const char* path);
+  bool startVerifyJob(const String& path);
+  bool stepVerifyJob();
+  void finishVerifyJob(const uint8_t* digest);
+  bool nextSweepPath(String* out_path);
+  bool expectedDigestFor(const char* path, uint8_t* out_digest) const;
+  void flushVerifyCache() const;
+  bool reloadIntegrityManifest() const;
+  struct SyncJob;
+  bool ensureSyncJob();
+  void releaseSyncJob();
+  bool planSyncStep();
+  bool copySyncStep();
+  bool finishSyncEntry(bool ok);
+  void finishStorySync(uint32_t now_ms);
+  bool persistSyncJournal();
+  bool probeSdFile(const String& path, StorySyncProbe* out) const;
+  bool probeLittleFsFile(const String& path, StoryDigestKind kind, StorySyncProbe* out) const;
 
   mutable bool sd_ready_ = false;
   mutable uint8_t sd_failure_streak_ = 0U;
-  static constexpr uint8_t kSceneCacheSlots = 3U;
-  static constexpr uint8_t kAudioCacheSlots = 3U;
-  mutable String scene_cache_ids_[kSceneCacheSlots];
-  mutable String scene_cache_payloads_[kSceneCacheSlots];
-  mutable String scene_cache_origins_[kSceneCacheSlots];
-  mutable String scene_cache_source_kinds_[kSceneCacheSlots];
-  mutable uint8_t scene_cache_next_slot_ = 0U;
   mutable String last_scene_payload_origin_;
   mutable String last_scene_payload_source_kind_;
-  mutable String audio_cache_pack_ids_[kAudioCacheSlots];
-  mutable String audio_cache_paths_[kAudioCacheSlots];
-  mutable uint8_t audio_cache_next_slot_ = 0U;
+  mutable StoryContentCache* content_cache_ = nullptr;
+  mutable uint8_t* content_arena_ = nullptr;
+  mutable bool content_arena_psram_ = false;
+  static constexpr uint8_t kVerifyQueueSlots = 8U;
+  mutable StoryVerifyCache* verify_cache_ = nullptr;
+  mutable StoryManifest* manifest_ = nullptr;
+  VerifyJob* verify_job_ = nullptr;
+  String verify_queue_[kVerifyQueueSlots];
+  uint8_t verify_queue_head_ = 0U;
+  uint8_t verify_queue_count_ = 0U;
+  bool sweep_active_ = false;
+  uint32_t sweep_offset_ = 0U;
+  uint32_t sweep_started_ms_ = 0U;
+  mutable VerifyStats verify_stats_;
+  SyncJob* sync_job_ = nullptr;
+  SyncStats sync_stats_;
 };
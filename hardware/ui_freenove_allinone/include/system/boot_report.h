@@ -13,7 +13,33 @@ struct BootHeapSnapshot {
   bool psram_found = false;
 };
 
+// Boot milestones in ms since reset. Zero until reached.
+struct BootTimings {
+  static constexpr uint8_t kMaxJobs = 12U;
+
+  struct Job {
+    const char* name = nullptr;
+    uint32_t started_ms = 0U;
+    uint32_t duration_us = 0U;
+    bool ok = false;
+  };
+
+  uint32_t first_frame_ms = 0U;   // time to first frame (TTFF)
+  uint32_t interactive_ms = 0U;   // first scene shown, input live (TTI)
+  uint32_t deferred_done_ms = 0U; // last deferred boot job finished
+  bool snapshot_used = false;
+  uint8_t job_count = 0U;
+  Job jobs[kMaxJobs];
+};
+
 const char* bootResetReasonLabel(uint32_t reset_reason_code);
 uint32_t bootResetReasonCode();
 BootHeapSnapshot bootCaptureHeapSnapshot();
 void bootPrintReport(const char* firmware_name, const char* firmware_version);
+void bootMarkFirstFrame(uint32_t now_ms);
+void bootMarkInteractive(uint32_t now_ms);
+void bootMarkDeferredDone(uint32_t now_ms);
+void bootNoteSnapshotUsed(bool used);
+void bootNoteJob(const char* name, uint32_t started_ms, uint32_t duration_us, bool ok);
+const BootTimings& bootTimings();
+void bootPrintTimings();
@@ -0,0 +1,43 @@
+// boot_scheduler.h - deferred boot jobs run one per loop iteration.
+#pragma once
+
+#include <Arduino.h>
+
+#include <cstdint>
+
+enum class BootPhase : uint8_t {
+  kAfterFirstFrame = 0,  // as soon as the loop runs
+  kAfterInteractive,     // once the first scene is up and input is live
+};
+
+class BootScheduler {
+ public:
+  using JobFn = bool (*)(uint32_t now_ms);
+
+  static constexpr uint8_t kMaxJobs = 10U;
+
+  // Lower priority runs first within a phase; equal priorities keep add order.
+  bool add(const char* name, BootPhase phase, uint8_t priority, JobFn fn);
+  void markFirstFrame(uint32_t now_ms);
+  void markInteractive(uint32_t now_ms);
+  // Runs at most one ready job; each is timed into boot_report. Returns true
+  // when a job ran.
+  bool update(uint32_t now_ms);
+  bool done() const;
+  uint8_t pending() const;
+
+ private:
+  struct Job {
+    const char* name = nullptr;
+    JobFn fn = nullptr;
+    BootPhase phase = BootPhase::kAfterFirstFrame;
+    uint8_t priority = 0U;
+    bool done = false;
+  };
+
+  Job jobs_[kMaxJobs];
+  uint8_t count_ = 0U;
+  uint8_t pending_ = 0U;
+  bool first_frame_ = false;
+  bool interactive_ = false;
+};
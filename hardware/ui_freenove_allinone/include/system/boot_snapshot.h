@@ -0,0 +1,34 @@
+// boot_snapshot.h - "last good boot" snapshot: parsed APP_* configs and ESP-NOW peers.
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "camera_manager.h"
+#include "media_manager.h"
+#include "runtime/runtime_config_types.h"
+#include "storage_manager.h"
+
+struct BootSnapshot {
+  static constexpr uint8_t kMaxPeers = 8U;
+
+  // bootConfigFingerprint() of the files the configs were parsed from.
+  uint32_t config_fingerprint = 0U;
+  RuntimeNetworkConfig network;
+  RuntimeHardwareConfig hardware;
+  CameraManager::Config camera;
+  MediaManager::Config media;
+  uint8_t peer_count = 0U;
+  char peers[kMaxPeers][18] = {};
+};
+
+// FNV-1a over path, origin and content checksum of each file as the config
+// loader resolves it (LittleFS, else SD; missing files included), so an edit
+// on either side, or a file moving between them, invalidates the snapshot.
+uint32_t bootConfigFingerprint(const StorageManager& storage, const char* const* paths, size_t count);
+// Image is tagged with the struct size and the app image's ELF SHA-256; a new
+// firmware or a torn write reads as no snapshot.
+bool bootSnapshotLoad(fs::FS& fs, const char* path, BootSnapshot* out);
+bool bootSnapshotSave(fs::FS& fs, const char* path, const BootSnapshot& snapshot);
+// A boot after a crash, watchdog or brownout must not trust the snapshot.
+bool bootResetAllowsSnapshot(uint32_t reset_reason_code);
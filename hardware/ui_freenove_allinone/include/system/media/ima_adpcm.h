@@ -0,0 +1,37 @@
+// ima_adpcm.h - IMA/DVI ADPCM block codec (WAV format 0x11, mono).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace media {
+
+struct ImaAdpcmState {
+  int16_t predictor = 0;
+  uint8_t step_index = 0U;
+};
+
+// WAV IMA ADPCM block layout (mono): 4-byte header {int16 first sample,
+// uint8 step index, uint8 reserved} followed by 4-bit codes, low nibble
+// first. A block of `block_bytes` holds (block_bytes - 4) * 2 + 1 samples.
+class ImaAdpcm {
+ public:
+  static constexpr size_t kHeaderBytes = 4U;
+
+  static constexpr uint16_t samplesPerBlock(uint16_t block_bytes) {
+    return static_cast<uint16_t>((block_bytes - kHeaderBytes) * 2U + 1U);
+  }
+
+  // Encodes one full block from `pcm` (samplesPerBlock(block_bytes) samples).
+  // The header seeds the predictor with pcm[0]; the step index carries over
+  // from the previous block through `state`.
+  static void encodeBlock(const int16_t* pcm, uint16_t block_bytes, ImaAdpcmState* state, uint8_t* out);
+  // Decodes one full block into samplesPerBlock(block_bytes) samples.
+  static bool decodeBlock(const uint8_t* block, uint16_t block_bytes, int16_t* out);
+
+  // Single-sample steps of the reference DVI algorithm.
+  static uint8_t encodeSample(int16_t sample, ImaAdpcmState* state);
+  static int16_t decodeSample(uint8_t code, ImaAdpcmState* state);
+};
+
+}  // namespace media
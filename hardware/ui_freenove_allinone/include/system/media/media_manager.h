@@ -3,6 +3,13 @@
 
 #include <Arduino.h>
 
+#include <atomic>
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 class AudioManager;
 
 class MediaManager {
@@ -20,17 +27,27 @@ class MediaManager {
     char record_dir[32] = "/recorder";
     uint16_t record_max_seconds = 30U;
     bool auto_stop_record_on_step_change = true;
+    bool record_adpcm = true;          // IMA ADPCM (4 bits/sample) instead of PCM16
+    uint16_t record_gain_q8 = 2048U;   // applied to the mic's 16 MSBs, 256 = unity
   };
 
   struct Snapshot {
     bool ready = false;
     bool playing = false;
     bool recording = false;
+    bool record_finalizing = false;  // stopped, writer still flushing; the mic stays claimed
     bool last_ok = true;
     bool record_simulated = true;
+    bool record_adpcm = false;
     uint16_t record_limit_seconds = 30U;
     uint16_t record_elapsed_seconds = 0U;
     uint32_t record_started_ms = 0U;
+    uint32_t record_samples = 0U;
+    uint32_t record_bytes = 0U;
+    uint32_t record_dropped_samples = 0U;  // ring overflow: storage fell behind the mic
+    uint32_t record_write_avg_us = 0U;
+    uint32_t record_write_max_us = 0U;
+    uint16_t record_ring_peak_pct = 0U;
     char playing_path[128] = "";
     char record_file[128] = "";
     char last_error[64] = "";
@@ -39,17 +56,36 @@ class MediaManager {
     char record_dir[32] = "/recorder";
   };
 
+  // Called with true before the recorder starts reading the mic and with
+  // false once it let go, so the owner can pause its own sampling.
+  using MicClaimFn = void (*)(bool claimed);
+
   bool begin(const Config& config);
+  // I2S RX port already installed by HardwareManager; without it recordings
+  // stay simulated (empty WAV).
+  void attachMic(int i2s_port, uint32_t sample_rate, MicClaimFn on_claim);
   void update(uint32_t now_ms, AudioManager* audio);
   void noteStepChange();
   bool listFiles(const char* kind, String* out_json) const;
   bool play(const char* path, AudioManager* audio);
   bool stop(AudioManager* audio);
   bool startRecording(uint16_t seconds, const char* filename_hint);
+  // Asynchronous for mic takes: capture stops at once, update() closes the
+  // file and releases the mic when the writer is done (record_finalizing).
   bool stopRecording();
+  bool recordingFromMic() const { return mic_claimed_; }
   Snapshot snapshot() const;
 
  private:
+  struct Recorder;
+
+  enum class WriterState : uint8_t {
+    kIdle = 0,
+    kRunning,
+    kDraining,
+    kFinished,
+  };
+
   void setLastError(const char* message);
   void clearLastError();
   String normalizeDir(const char* path) const;
@@ -57,7 +93,47 @@ class MediaManager {
   String sanitizeFilename(const char* hint, const char* default_prefix, const char* extension) const;
   bool ensureDir(const char* path) const;
   bool writeEmptyWav(const char* path) const;
+  bool startMicRecording(const char* path, uint16_t seconds);
+  void pollMicFinalize();
+  void refreshRecordStats();
+
+#if defined(ARDUINO_ARCH_ESP32)
+  bool ensureRecorder();
+  static void captureTaskEntry(void* arg);
+  void captureTaskMain();
+  static void writerTaskEntry(void* arg);
+  void writerTaskMain();
+
+  static constexpr uint16_t kCaptureStackWords = 3072U;
+  static constexpr uint8_t kCapturePriority = 4U;
+  static constexpr uint16_t kWriterStackWords = 4096U;
+  static constexpr uint8_t kWriterPriority = 2U;
+  static constexpr int8_t kRecorderCore = 0;
+  static constexpr uint16_t kIdleDelayMs = 20U;
+  static constexpr uint16_t kWriterPollMs = 10U;
+  static constexpr uint16_t kFinalizeSlowMs = 3000U;
+
+  TaskHandle_t capture_task_ = nullptr;
+  TaskHandle_t writer_task_ = nullptr;
+#endif
 
   Config config_;
   Snapshot snapshot_;
+
+  int mic_port_ = -1;
+  uint32_t mic_sample_rate_ = 16000U;
+  MicClaimFn on_mic_claim_ = nullptr;
+  bool mic_claimed_ = false;
+  uint32_t finalize_started_ms_ = 0U;
+  bool finalize_slow_logged_ = false;
+  Recorder* recorder_ = nullptr;
+  std::atomic<bool> capture_on_{false};
+  std::atomic<bool> capture_busy_{false};
+  std::atomic<uint8_t> writer_state_{static_cast<uint8_t>(WriterState::kIdle)};
+  std::atomic<bool> writer_failed_{false};
+  // Published by the writer task while a take is running.
+  std::atomic<uint32_t> live_samples_{0U};
+  std::atomic<uint32_t> live_bytes_{0U};
+  std::atomic<uint32_t> live_write_avg_us_{0U};
+  std::atomic<uint32_t> live_write_max_us_{0U};
 };
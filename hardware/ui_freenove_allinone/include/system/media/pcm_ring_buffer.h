@@ -0,0 +1,42 @@
+// pcm_ring_buffer.h - lock-free single-producer/single-consumer PCM16 ring.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace media {
+
+// Sits between the I2S capture task (producer) and the storage writer task
+// (consumer). The producer never waits: samples that do not fit are dropped
+// and counted, so a slow flash write shows up as dropped samples instead of
+// an I2S DMA overrun.
+class PcmRingBuffer {
+ public:
+  PcmRingBuffer() = default;
+  PcmRingBuffer(const PcmRingBuffer&) = delete;
+  PcmRingBuffer& operator=(const PcmRingBuffer&) = delete;
+
+  // `capacity` must be a power of two; storage stays owned by the caller.
+  bool begin(int16_t* storage, uint32_t capacity);
+  // Only while neither side is running.
+  void reset();
+
+  uint32_t push(const int16_t* samples, uint32_t count);
+  uint32_t pop(int16_t* out, uint32_t max_count);
+
+  uint32_t available() const;
+  uint32_t capacity() const { return capacity_; }
+  uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+  uint32_t peakFill() const { return peak_fill_.load(std::memory_order_relaxed); }
+
+ private:
+  int16_t* storage_ = nullptr;
+  uint32_t capacity_ = 0U;
+  uint32_t mask_ = 0U;
+  std::atomic<uint32_t> head_{0U};  // total pushed, written by the producer
+  std::atomic<uint32_t> tail_{0U};  // total popped, written by the consumer
+  std::atomic<uint32_t> dropped_{0U};
+  std::atomic<uint32_t> peak_fill_{0U};
+};
+
+}  // namespace media
@@ -0,0 +1,96 @@
+// wav_stream_writer.h - streaming mono WAV writer (PCM16 or IMA ADPCM).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "system/media/ima_adpcm.h"
+
+namespace media {
+
+enum class WavEncoding : uint8_t {
+  kPcm16 = 0,
+  kImaAdpcm,
+};
+
+// Where the encoded bytes go (LittleFS file on target, memory in host tests).
+// append() extends the stream; writeAt() rewrites bytes already appended
+// (header patches) and leaves the append position alone.
+class WavSink {
+ public:
+  virtual ~WavSink() = default;
+  // Called once before the first byte with the final size the writer may
+  // reach. False aborts the recording up front instead of failing mid-take.
+  virtual bool reserve(uint32_t bytes) = 0;
+  virtual bool append(const uint8_t* data, size_t bytes) = 0;
+  virtual bool writeAt(uint32_t offset, const uint8_t* data, size_t bytes) = 0;
+  virtual bool flush() = 0;
+};
+
+struct WavStreamConfig {
+  uint32_t sample_rate = 16000U;
+  WavEncoding encoding = WavEncoding::kImaAdpcm;
+  uint16_t adpcm_block_bytes = 256U;
+  uint32_t max_samples = 0U;            // 0 = unbounded (nothing reserved)
+  uint32_t patch_every_bytes = 32768U;  // header refresh cadence; 0 = at finish only
+  uint32_t (*clock_us)() = nullptr;     // optional, times sink I/O
+};
+
+struct WavStreamStats {
+  uint32_t samples = 0U;            // PCM samples accepted
+  uint32_t data_bytes = 0U;         // data chunk bytes handed to the sink
+  uint32_t truncated_samples = 0U;  // refused once max_samples was reached
+  uint32_t sink_writes = 0U;
+  uint32_t header_patches = 0U;
+  uint32_t write_us_total = 0U;
+  uint32_t write_us_max = 0U;
+  bool sink_error = false;
+};
+
+// Encodes PCM16 into fixed-size chunks so the sink only sees large writes,
+// and rewrites the RIFF/fact/data sizes every `patch_every_bytes` so a take
+// cut short by a reset or power loss is still a playable file.
+class WavStreamWriter {
+ public:
+  static constexpr size_t kMaxHeaderBytes = 60U;
+  static constexpr size_t kChunkBytes = 4096U;
+  static constexpr uint16_t kMaxAdpcmBlockBytes = 512U;
+
+  // Header for `samples` samples stored in `data_bytes` bytes; returns its
+  // size (44 for PCM16, 60 for ADPCM), 0 for an invalid config.
+  static size_t buildHeader(const WavStreamConfig& config, uint32_t data_bytes, uint32_t samples, uint8_t* out);
+  // Data chunk size for `samples` samples (ADPCM rounds up to whole blocks).
+  static uint32_t dataBytesFor(const WavStreamConfig& config, uint32_t samples);
+
+  bool begin(WavSink* sink, const WavStreamConfig& config);
+  // Returns the number of samples accepted (less than `count` once full).
+  size_t write(const int16_t* pcm, size_t count);
+  // Pads and encodes the last ADPCM block, flushes, patches the header.
+  bool finish();
+
+  bool active() const { return sink_ != nullptr; }
+  bool full() const;
+  const WavStreamStats& stats() const { return stats_; }
+
+ private:
+  bool encodePendingBlock();
+  bool flushChunk();
+  bool patchHeader();
+  bool timedAppend(const uint8_t* data, size_t bytes);
+  void noteLatency(uint32_t started_us);
+
+  WavSink* sink_ = nullptr;
+  WavStreamConfig config_;
+  WavStreamStats stats_;
+  ImaAdpcmState adpcm_;
+  uint16_t block_samples_ = 0U;
+  uint16_t block_fill_ = 0U;
+  size_t chunk_fill_ = 0U;
+  uint32_t header_bytes_ = 0U;
+  uint32_t flushed_samples_ = 0U;  // samples whose encoded bytes reached the sink
+  uint32_t bytes_since_patch_ = 0U;
+  int16_t block_pcm_[ImaAdpcm::samplesPerBlock(kMaxAdpcmBlockBytes)] = {};
+  uint8_t chunk_[kChunkBytes] = {};
+};
+
+}  // namespace media
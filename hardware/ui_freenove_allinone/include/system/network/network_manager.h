@@ -6,6 +6,11 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/portmacro.h>
 
+#include <atomic>
+
+#include "core/mpsc_ring.h"
+#include "espnow_frame_v1.h"
+
 class NetworkManager {
  public:
   NetworkManager() = default;
@@ -45,6 +50,30 @@ class NetworkManager {
     char last_msg_id[32] = {0};
     char last_type[24] = {0};
     char last_payload[192] = {0};
+    uint32_t espnow_link_frames = 0U;
+    uint32_t espnow_link_retransmits = 0U;
+    uint32_t espnow_link_expired = 0U;
+    uint32_t espnow_link_duplicates = 0U;
+    uint32_t espnow_link_rtt_avg_ms = 0U;
+    uint32_t espnow_rx_overflow = 0U;
+    uint32_t espnow_rx_invalid = 0U;
+    uint32_t espnow_rx_high_water = 0U;
+    uint32_t espnow_rx_batches = 0U;
+    uint32_t espnow_rx_latency_max_ms = 0U;
+  };
+
+  // One received message: a legacy JSON/text frame, or one record of a binary
+  // frame (espnow_frame_v1.h). `request_id` is set for binary commands, which
+  // are answered with sendEspNowResult instead of a JSON ack.
+  struct EspNowInbound {
+    char payload[192] = {0};
+    char peer[18] = {0};
+    char msg_id[32] = {0};
+    char type[24] = {0};
+    uint32_t seq = 0U;
+    bool ack_requested = false;
+    bool binary = false;
+    uint16_t request_id = 0U;
   };
 
   bool begin(const char* hostname);
@@ -70,18 +99,13 @@ class NetworkManager {
   bool espNowPeerAt(uint8_t index, char* out_mac, size_t out_capacity) const;
   bool sendEspNowText(const uint8_t mac[6], const char* text);
   bool sendEspNowTarget(const char* target, const char* text);
+  // Binary records are batched per peer and flushed from update(); unicast
+  // records are acked and retransmitted, broadcast ones are best effort.
+  bool sendEspNowRecord(const char* target, uint8_t type, const char* text);
+  bool sendEspNowResult(const char* peer, uint16_t request_id, bool ok, const char* code, const char* data_json);
 
   Snapshot snapshot() const;
-  bool consumeEspNowMessage(char* out_payload,
-                            size_t payload_capacity,
-                            char* out_peer,
-                            size_t peer_capacity,
-                            char* out_msg_id = nullptr,
-                            size_t msg_id_capacity = 0U,
-                            uint32_t* out_seq = nullptr,
-                            char* out_type = nullptr,
-                            size_t type_capacity = 0U,
-                            bool* out_ack_requested = nullptr);
+  bool consumeEspNowMessage(EspNowInbound* out);
 
  private:
   static void onEspNowRecv(const uint8_t* mac_addr, const uint8_t* data, int data_len);
@@ -107,23 +131,26 @@ class NetworkManager {
   bool removeEspNowPeerInternal(const uint8_t mac[6]);
   void cachePeer(const uint8_t mac[6], bool from_isr = false);
   void forgetPeer(const uint8_t mac[6]);
-  bool queueEspNowMessage(const char* payload,
-                          const char* peer,
-                          const char* msg_id,
-                          uint32_t seq,
-                          const char* type,
-                          bool ack_requested,
-                          bool from_isr = false);
+  bool beginEspNowRxBatch(uint32_t now_ms);
+  void releaseEspNowRxFrame();
+  bool sendEspNowBytes(const uint8_t mac[6], const uint8_t* data, size_t len);
+  EspNowLink* espNowLinkFor(const uint8_t mac[6], uint32_t now_ms);
+  void pumpEspNowLinks(uint32_t now_ms);
+  bool nextEspNowRecord(EspNowInbound* out);
+  bool decodeEspNowText(const char* text, EspNowInbound* out) const;
   void refreshSnapshot();
   void handleEspNowRecv(const uint8_t* mac_addr, const uint8_t* data, int data_len);
   void handleEspNowSend(const uint8_t* mac_addr, esp_now_send_status_t status);
 
   static constexpr uint8_t kMaxPeerCache = 16U;
-  static constexpr uint8_t kRxQueueSize = 6U;
+  // 16 x 260 bytes: absorbs a burst from several props between two loop passes.
+  static constexpr size_t kRxRingSize = 16U;
+  static constexpr size_t kRxBatchMax = 8U;
   static constexpr size_t kPayloadCapacity = 192U;
   static constexpr size_t kEspNowFrameCapacity = 240U;
   static constexpr uint32_t kStaConnectTimeoutMs = 12000U;
   static constexpr uint32_t kEspNowRefreshPeriodMs = 1000U;
+  static constexpr uint8_t kMaxEspNowLinks = 4U;
 
   bool started_ = false;
   bool espnow_enabled_ = false;
@@ -138,10 +165,8 @@ class NetworkManager {
   uint32_t next_local_retry_at_ms_ = 0U;
   uint32_t last_espnow_refresh_ms_ = 0U;
   uint32_t last_espnow_recovery_ms_ = 0U;
-  uint32_t espnow_rx_packets_ = 0U;
   uint32_t espnow_tx_ok_ = 0U;
   uint32_t espnow_tx_fail_ = 0U;
-  uint32_t espnow_drop_packets_ = 0U;
   uint32_t espnow_tx_seq_ = 0U;
   uint32_t local_retry_ms_ = 15000U;
   bool espnow_refresh_fault_ = false;
@@ -154,19 +179,44 @@ class NetworkManager {
   char peer_cache_[kMaxPeerCache][18] = {};
   uint8_t peer_cache_count_ = 0U;
 
+  enum EspNowRxKind : uint8_t {
+    kEspNowRxText = 0U,  // legacy JSON envelope or plain text
+    kEspNowRxBinary,  // header already validated by the receive callback
+  };
+
+  // Frame as received, classified by the receive callback; text and records
+  // are decoded by consumeEspNowMessage, in the loop.
   struct EspNowMessage {
-    char payload[kPayloadCapacity] = {0};
-    char peer[18] = {0};
-    char msg_id[32] = {0};
-    char type[24] = {0};
-    uint32_t seq = 0U;
-    bool ack_requested = false;
+    uint32_t rx_ms = 0U;
+    uint8_t mac[6] = {0};
+    uint8_t kind = kEspNowRxText;
+    uint8_t len = 0U;
+    uint8_t data[ESPNOW_FRAME_MAX] = {0};
+  };
+  // Fed by the WiFi task without locks; drained by the loop in batches.
+  MpscRing<EspNowMessage, kRxRingSize> rx_ring_;
+  std::atomic<uint32_t> espnow_rx_invalid_{0U};
+  size_t rx_batch_left_ = 0U;
+  uint32_t espnow_rx_high_water_ = 0U;
+  uint32_t espnow_rx_batches_ = 0U;
+  uint32_t espnow_rx_latency_max_ms_ = 0U;
+  // Guards the peer cache, counters and snapshot_ (not the receive ring).
+  mutable portMUX_TYPE state_mux_ = portMUX_INITIALIZER_UNLOCKED;
+
+  // Binary links, touched from the loop only (consume + update).
+  struct PeerLink {
+    bool used = false;
+    uint8_t mac[6] = {0};
+    uint32_t last_used_ms = 0U;
+    EspNowLink link = {};
   };
-  EspNowMessage rx_queue_[kRxQueueSize];
-  uint8_t rx_queue_head_ = 0U;
-  uint8_t rx_queue_tail_ = 0U;
-  uint8_t rx_queue_count_ = 0U;
-  mutable portMUX_TYPE rx_queue_mux_ = portMUX_INITIALIZER_UNLOCKED;
+  PeerLink links_[kMaxEspNowLinks];
+  EspNowLink broadcast_link_ = {};
+  // Head cell of rx_ring_ being handed out (one record per consume call);
+  // released once its records are exhausted.
+  const EspNowMessage* rx_frame_ = nullptr;
+  size_t rx_frame_pos_ = 0U;
+  uint16_t rx_frame_seq_ = 0U;
 
   Snapshot snapshot_;
 };
@@ -41,14 +41,14 @@ class CameraCaptureService {
 
   const Config& config() const { return cfg_; }
 
-  static void downscale_rgb565_nearest(const uint16_t* src,
-                                        int src_w,
-                                        int src_h,
-                                        int src_stride_px,
-                                        uint16_t* dst,
-                                        int dst_w,
-                                        int dst_h,
-                                        bool aligned16_hint);
+  // Area-averaged (box filter) RGB565 downscale, see runtime/simd/simd_downscale.h.
+  static bool downscale_rgb565_box(const uint16_t* src,
+                                   int src_w,
+                                   int src_h,
+                                   int src_stride_px,
+                                   uint16_t* dst,
+                                   int dst_w,
+                                   int dst_h);
 
  private:
   static CameraManager::RecorderSaveFormat toRecorderFormat(CaptureFormat format);
@@ -0,0 +1,143 @@
+// qr_decoder.h - grayscale QR decoder (finder search, perspective grid, RS).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ui {
+
+struct QrPoint {
+  float x = 0.0f;
+  float y = 0.0f;
+};
+
+// Region of interest in frame pixels; w/h <= 0 means the whole frame.
+struct QrRoi {
+  int x = 0;
+  int y = 0;
+  int w = 0;
+  int h = 0;
+};
+
+enum class QrDecodeStatus : uint8_t {
+  kOk = 0,
+  kInvalidArgument,
+  kNoFinder,     // fewer than three usable finder patterns
+  kNoGrid,       // finders found but no version/grid fits
+  kFormat,       // format information unreadable
+  kEcc,          // too many codeword errors
+  kData,         // malformed bit stream
+  kOverflow,     // payload longer than kMaxPayload
+};
+
+struct QrDecodeResult {
+  static constexpr size_t kMaxPayload = 191U;
+
+  uint8_t version = 0U;
+  char ecc_level = '?';  // 'L', 'M', 'Q' or 'H'
+  uint8_t mask = 0U;
+  uint16_t corrected_codewords = 0U;
+  // Symbol corners in frame pixels: top-left, top-right, bottom-right,
+  // bottom-left (quiet zone excluded).
+  QrPoint corners[4] = {};
+  uint16_t payload_len = 0U;
+  char payload[kMaxPayload + 1U] = {0};  // NUL-terminated, may embed bytes >= 0x80
+};
+
+// Single-symbol QR decoder for 8-bit luma frames, modelled on quirc:
+// adaptive row threshold, 1:1:3:1:1 finder search with cross checks,
+// homography from the three finders plus the alignment pattern (or the
+// extrapolated fourth corner on version 1), format/version BCH recovery,
+// Reed-Solomon correction per block and numeric/alphanumeric/byte/kanji
+// segment decoding. Versions 1..40, all masks and ECC levels.
+// Work buffers grow to the largest ROI seen and are reused; no allocation
+// once warm. Not thread-safe: one instance per worker.
+class QrDecoder {
+ public:
+  static constexpr int kMinSide = 21;
+
+  // `stride` in bytes. Only the ROI (clamped to the frame) is read;
+  // `out->corners` are reported in frame coordinates.
+  QrDecodeStatus decode(const uint8_t* luma,
+                        int width,
+                        int height,
+                        int stride,
+                        const QrRoi& roi,
+                        QrDecodeResult* out);
+
+  static const char* statusName(QrDecodeStatus status);
+
+ private:
+  struct Finder {
+    float x;
+    float y;
+    float module;
+    uint16_t hits;
+  };
+
+  void binarize(const uint8_t* luma, int stride);
+  void findFinders();
+  bool crossCheck(float cx, float cy, bool vertical, float module_hint, float* out_center, float* out_module) const;
+  void addFinder(float x, float y, float module);
+  bool floodComponent(int sx, int sy, size_t max_area, QrPoint* centroid, size_t* area);
+  void restoreFill();
+  void refineFinder(Finder* finder);
+  QrDecodeStatus decodeTriple(const Finder& tl, const Finder& tr, const Finder& bl, QrDecodeResult* out);
+  bool ringEdge(const Finder& finder, const QrPoint& normal, QrPoint* point, QrPoint* direction);
+  bool outerCorner(const Finder& tl, const Finder& tr, const Finder& bl, QrPoint* out);
+  bool findAlignment(float ex, float ey, const QrPoint& axis_u, const QrPoint& axis_v, QrPoint* out);
+  bool setupTransform(const QrPoint src[4], const QrPoint dst[4]);
+  QrPoint project(float u, float v) const;
+  int fitness(int version) const;
+  void jiggle(const QrPoint src[4], QrPoint dst[4], int version, float module);
+  bool readGrid(int dim);
+  bool gridBit(int row, int col) const { return grid_[static_cast<size_t>(row) * grid_dim_ + col] != 0U; }
+  bool isDark(int x, int y) const;
+  float timingScore(int dim) const;
+  int readVersionInfo(int dim) const;
+  QrDecodeStatus decodeGrid(int version, QrDecodeResult* out);
+
+  int roi_x_ = 0;
+  int roi_y_ = 0;
+  int roi_w_ = 0;
+  int roi_h_ = 0;
+  int threshold_window_ = 8;  // moving-average length, from the frame width
+  double h_[8] = {};  // module space -> ROI pixel homography
+  int grid_dim_ = 0;
+  std::vector<uint8_t> bin_ = {};      // 1 = dark, ROI sized
+  std::vector<int32_t> row_avg_ = {};  // threshold scratch, one ROI row
+  std::vector<Finder> finders_ = {};
+  std::vector<uint32_t> stack_ = {};  // flood-fill scratch
+  std::vector<uint32_t> fill_ = {};
+  std::vector<uint8_t> grid_ = {};     // sampled modules, dim * dim
+  std::vector<uint8_t> reserved_ = {};  // function-pattern map, dim * dim
+  std::vector<uint8_t> raw_ = {};      // interleaved codewords
+  std::vector<uint8_t> data_ = {};     // corrected data codewords
+};
+
+// Adaptive ROI for a stream of frames: after a hit the next search window is
+// the symbol bounding box plus a margin (codes move little between frames,
+// and a smaller window cuts threshold + finder search time roughly by area);
+// each miss grows the window until it falls back to the full frame.
+class QrRoiTracker {
+ public:
+  static constexpr int kMinWindow = 64;
+  static constexpr uint8_t kMissesBeforeFullFrame = 4U;
+
+  void reset(int frame_w, int frame_h);
+  QrRoi next() const { return roi_; }
+  bool fullFrame() const;
+  void onDecoded(const QrPoint corners[4]);
+  void onMiss();
+
+ private:
+  void setCentered(float cx, float cy, float w, float h);
+
+  int frame_w_ = 0;
+  int frame_h_ = 0;
+  uint8_t misses_ = 0U;
+  QrRoi roi_ = {};
+};
+
+}  // namespace ui
@@ -1,8 +1,20 @@
-// qr_scan_controller.h - QR code scan helper for Freenove camera scene.
+// qr_scan_controller.h - QR code scan worker for Freenove camera scene.
 #pragma once
 
 #include <Arduino.h>
 
+#include <atomic>
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#endif
+
+#include "ui/qr/qr_decoder.h"
+
+class CameraManager;
+
 namespace ui {
 
 struct QrScanResult {
@@ -12,6 +24,10 @@ struct QrScanResult {
   char payload[192] = {0};
 };
 
+// Takes a reference to the newest luma frame in CameraManager's pipeline on a
+// worker task, decodes it in place inside an adaptive ROI (QrRoiTracker) and
+// hands the latest payload to the UI thread through a one-slot queue.
+// Payload validation (QrValidationRules) stays with the caller.
 class QrScanController {
  public:
   QrScanController() = default;
@@ -20,16 +36,52 @@ class QrScanController {
   QrScanController(const QrScanController&) = delete;
   QrScanController& operator=(const QrScanController&) = delete;
 
+  void attachCamera(CameraManager* camera) { camera_ = camera; }
   bool begin();
   bool ready() const { return ready_; }
-  void setEnabled(bool enabled) { enabled_ = enabled; }
-  bool enabled() const { return enabled_; }
+  // Starts/stops the camera luma stream. A start refused by the resource
+  // gate is retried from poll(); false only when the camera is unsupported.
+  bool setEnabled(bool enabled);
+  bool enabled() const { return want_enabled_; }
   bool poll(QrScanResult* out, uint32_t timeout_ms = 0U);
 
  private:
+#if defined(ARDUINO_ARCH_ESP32)
+  static void workerEntry(void* arg);
+  void workerMain();
+  bool scanLatestFrame();
+  bool startStream();
+
+  static constexpr uint16_t kWorkerStackWords = 6144U;
+  static constexpr uint8_t kWorkerPriority = 1U;
+  static constexpr int8_t kWorkerCore = 0;
+  static constexpr uint16_t kIdleDelayMs = 20U;
+  static constexpr uint16_t kNoFrameDelayMs = 5U;
+  static constexpr uint16_t kDisableTimeoutMs = 250U;
+  static constexpr uint16_t kStatsEveryFrames = 150U;
+  static constexpr uint16_t kStreamRetryMs = 1000U;
+
+  TaskHandle_t worker_task_ = nullptr;
+  QueueHandle_t result_queue_ = nullptr;
+#endif
+
+  CameraManager* camera_ = nullptr;
   bool ready_ = false;
-  bool enabled_ = false;
-  void* reader_ = nullptr;
+  bool want_enabled_ = false;
+  uint32_t last_stream_attempt_ms_ = 0U;
+  std::atomic<bool> enabled_{false};
+  std::atomic<bool> worker_busy_{false};
+  std::atomic<bool> tracker_reset_{false};
+
+  // Worker-owned.
+  QrDecoder decoder_;
+  QrRoiTracker tracker_;
+  uint32_t last_sequence_ = 0U;
+  uint32_t stat_frames_ = 0U;
+  uint32_t stat_decoded_ = 0U;
+  uint32_t stat_roi_frames_ = 0U;
+  uint32_t stat_decode_us_ = 0U;
+  uint32_t stat_decode_max_us_ = 0U;
 };
 
 }  // namespace ui
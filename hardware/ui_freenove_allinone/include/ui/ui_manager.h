@@ -136,6 +136,10 @@ class UiManager {
   bool begin();
   void tick(uint32_t now_ms);
   void setHardwareController(HardwareManager* hardware);
+  void attachQrCamera(CameraManager* camera);
+  // Stops the QR scan and its luma stream before the camera is turned off
+  // (CAM_OFF); the scan resumes on the next QR scene entry.
+  void stopQrScan();
   void setHardwareSnapshot(const HardwareManager::Snapshot& snapshot);
   void setHardwareSnapshotRef(const HardwareManager::Snapshot* snapshot);
   void setLaMetrics(const UiLaMetrics& metrics);
@@ -0,0 +1,298 @@
+#include "app/command_registry.h"
+
+namespace {
+
+constexpr uint8_t kCommandCount = static_cast<uint8_t>(CommandId::kCount);
+
+constexpr CommandSpec kCommandSpecs[kCommandCount] = {
+    {"", 0U, CommandArgs::kNone, ""},
+#define FREENOVE_COMMAND_SPEC(id, name, transports, args, usage) {name, transports, args, usage},
+    FREENOVE_COMMAND_TABLE(FREENOVE_COMMAND_SPEC)
+#undef FREENOVE_COMMAND_SPEC
+};
+
+// Hash-and-displace perfect hash, built at compile time: the name hash picks a
+// bucket, and the bucket's displacement seeds a second hash that lands every
+// name in its own slot.
+constexpr size_t kSlotCount = 256U;
+constexpr size_t kBucketCount = 64U;
+
+static_assert(kCommandCount < kSlotCount, "command table larger than the hash table");
+
+constexpr char upperAscii(char c) {
+  return (c >= 'a' && c <= 'z') ? static_cast<char>(c - ('a' - 'A')) : c;
+}
+
+constexpr size_t nameLength(const char* text) {
+  size_t len = 0U;
+  while (text[len] != '\0') {
+    ++len;
+  }
+  return len;
+}
+
+constexpr uint32_t hashName(const char* text, size_t len) {
+  uint32_t hash = 2166136261UL;
+  for (size_t index = 0U; index < len; ++index) {
+    hash ^= static_cast<uint8_t>(upperAscii(text[index]));
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+// Second-level hash derived from the name hash, so a lookup reads the name once.
+constexpr uint32_t displaceHash(uint32_t hash, uint32_t seed) {
+  hash ^= seed * 0x9E3779B9UL;
+  hash ^= hash >> 16U;
+  hash *= 0x7FEB352DUL;
+  hash ^= hash >> 15U;
+  hash *= 0x846CA68BUL;
+  hash ^= hash >> 16U;
+  return hash;
+}
+
+struct CommandHashTable {
+  uint16_t displacement[kBucketCount] = {};
+  uint8_t slots[kSlotCount] = {};  // CommandId, 0 when empty
+  bool complete = false;
+};
+
+constexpr CommandHashTable buildHashTable() {
+  CommandHashTable table = {};
+  uint32_t name_hash[kCommandCount] = {};
+  uint8_t bucket_of[kCommandCount] = {};
+  uint8_t bucket_size[kBucketCount] = {};
+  for (uint8_t id = 1U; id < kCommandCount; ++id) {
+    const char* name = kCommandSpecs[id].name;
+    name_hash[id] = hashName(name, nameLength(name));
+    bucket_of[id] = static_cast<uint8_t>(name_hash[id] & (kBucketCount - 1U));
+    ++bucket_size[bucket_of[id]];
+  }
+
+  // Largest buckets first, while the table is still mostly empty.
+  for (uint8_t size = kCommandCount; size > 0U; --size) {
+    for (size_t bucket = 0U; bucket < kBucketCount; ++bucket) {
+      if (bucket_size[bucket] != size) {
+        continue;
+      }
+      bool placed = false;
+      for (uint16_t seed = 1U; seed != 0U && !placed; ++seed) {
+        uint8_t taken[kCommandCount] = {};
+        uint8_t taken_count = 0U;
+        bool fits = true;
+        for (uint8_t id = 1U; id < kCommandCount && fits; ++id) {
+          if (bucket_of[id] != bucket) {
+            continue;
+          }
+          const uint8_t slot = static_cast<uint8_t>(displaceHash(name_hash[id], seed) & (kSlotCount - 1U));
+          if (table.slots[slot] != 0U) {
+            fits = false;
+          }
+          for (uint8_t index = 0U; index < taken_count && fits; ++index) {
+            if (taken[index] == slot) {
+              fits = false;
+            }
+          }
+          taken[taken_count++] = slot;
+        }
+        if (!fits) {
+          continue;
+        }
+        for (uint8_t id = 1U; id < kCommandCount; ++id) {
+          if (bucket_of[id] == bucket) {
+            table.slots[displaceHash(name_hash[id], seed) & (kSlotCount - 1U)] = id;
+          }
+        }
+        table.displacement[bucket] = seed;
+        placed = true;
+      }
+      if (!placed) {
+        return table;
+      }
+    }
+  }
+  table.complete = true;
+  return table;
+}
+
+constexpr CommandHashTable kCommandHashTable = buildHashTable();
+static_assert(kCommandHashTable.complete, "no perfect hash for the command table");
+
+bool sameNameIgnoreCase(const char* name, const char* text, size_t len) {
+  for (size_t index = 0U; index < len; ++index) {
+    if (name[index] == '\0' || name[index] != upperAscii(text[index])) {
+      return false;
+    }
+  }
+  return name[len] == '\0';
+}
+
+const char* transportLabel(CommandTransport transport) {
+  switch (transport) {
+    case CommandTransport::kSerial:
+      return "serial";
+    case CommandTransport::kControl:
+      return "control";
+    case CommandTransport::kEspNow:
+      return "espnow";
+    case CommandTransport::kCount:
+      break;
+  }
+  return "unknown";
+}
+
+CommandRegistry g_command_registry;
+
+}  // namespace
+
+CommandId CommandRegistry::find(const char* name, size_t len, CommandTransport transport) {
+  if (name == nullptr || len == 0U) {
+    return CommandId::kUnknown;
+  }
+  const uint32_t hash = hashName(name, len);
+  const uint32_t bucket = hash & (kBucketCount - 1U);
+  const uint32_t slot = displaceHash(hash, kCommandHashTable.displacement[bucket]) & (kSlotCount - 1U);
+  const uint8_t id = kCommandHashTable.slots[slot];
+  if (id == 0U || !sameNameIgnoreCase(kCommandSpecs[id].name, name, len)) {
+    return CommandId::kUnknown;
+  }
+  if ((kCommandSpecs[id].transports & (1U << static_cast<uint8_t>(transport))) == 0U) {
+    return CommandId::kUnknown;
+  }
+  return static_cast<CommandId>(id);
+}
+
+CommandId CommandRegistry::parse(const char* text, CommandTransport transport, const char** out_args) {
+  if (out_args != nullptr) {
+    *out_args = nullptr;
+  }
+  if (text == nullptr) {
+    return CommandId::kUnknown;
+  }
+  while (*text == ' ') {
+    ++text;
+  }
+  size_t len = 0U;
+  while (text[len] != '\0' && text[len] != ' ') {
+    ++len;
+  }
+  const char* args = text + len;
+  while (*args == ' ') {
+    ++args;
+  }
+  if (out_args != nullptr && *args != '\0') {
+    *out_args = args;
+  }
+  return find(text, len, transport);
+}
+
+const CommandSpec& CommandRegistry::spec(CommandId id) {
+  const uint8_t index = static_cast<uint8_t>(id);
+  return kCommandSpecs[(index < kCommandCount) ? index : 0U];
+}
+
+const char* CommandRegistry::name(CommandId id) {
+  return spec(id).name;
+}
+
+bool CommandRegistry::acceptsArgs(CommandId id, bool has_args) {
+  switch (spec(id).args) {
+    case CommandArgs::kNone:
+      return !has_args;
+    case CommandArgs::kRequired:
+      return has_args;
+    case CommandArgs::kOptional:
+      break;
+  }
+  return true;
+}
+
+uint32_t CommandRegistry::beginCall() {
+  ++depth_;
+  return micros();
+}
+
+void CommandRegistry::endCall(CommandId id, CommandTransport transport, uint32_t started_us, bool ok) {
+  const uint32_t elapsed_us = micros() - started_us;
+  if (depth_ > 0U) {
+    --depth_;
+  }
+  if (depth_ != 0U) {
+    return;
+  }
+  const uint8_t index = static_cast<uint8_t>(id);
+  const uint8_t transport_index = static_cast<uint8_t>(transport);
+  if (index >= kCommandCount || transport_index >= static_cast<uint8_t>(CommandTransport::kCount)) {
+    return;
+  }
+  CommandStats& stats = stats_[index];
+  ++stats.calls;
+  if (!ok) {
+    ++stats.errors;
+  }
+  stats.total_us += static_cast<uint64_t>(elapsed_us);
+  if (elapsed_us > stats.max_us) {
+    stats.max_us = elapsed_us;
+  }
+  ++transport_calls_[transport_index];
+}
+
+const CommandStats& CommandRegistry::stats(CommandId id) const {
+  const uint8_t index = static_cast<uint8_t>(id);
+  return stats_[(index < kCommandCount) ? index : 0U];
+}
+
+uint32_t CommandRegistry::transportCalls(CommandTransport transport) const {
+  const uint8_t index = static_cast<uint8_t>(transport);
+  return (index < static_cast<uint8_t>(CommandTransport::kCount)) ? transport_calls_[index] : 0U;
+}
+
+void CommandRegistry::resetStats() {
+  for (uint8_t index = 0U; index < kCommandCount; ++index) {
+    stats_[index] = {};
+  }
+  for (uint8_t index = 0U; index < static_cast<uint8_t>(CommandTransport::kCount); ++index) {
+    transport_calls_[index] = 0U;
+  }
+}
+
+void CommandRegistry::printHelp() const {
+  Serial.print("CMDS");
+  for (uint8_t index = 1U; index < kCommandCount; ++index) {
+    const CommandSpec& command = kCommandSpecs[index];
+    if ((command.transports & kCommandSerial) == 0U || index == static_cast<uint8_t>(CommandId::kHelp)) {
+      continue;
+    }
+    Serial.print(' ');
+    Serial.print(command.name);
+    if (command.usage[0] != '\0') {
+      Serial.print(' ');
+      Serial.print(command.usage);
+    }
+  }
+  Serial.println();
+}
+
+void CommandRegistry::dumpStatus() const {
+  for (uint8_t index = 0U; index < static_cast<uint8_t>(CommandTransport::kCount); ++index) {
+    Serial.printf("[CMD] transport=%s calls=%lu\n",
+                  transportLabel(static_cast<CommandTransport>(index)),
+                  static_cast<unsigned long>(transport_calls_[index]));
+  }
+  for (uint8_t index = 0U; index < kCommandCount; ++index) {
+    const CommandStats& stats = stats_[index];
+    if (stats.calls == 0U) {
+      continue;
+    }
+    Serial.printf("[CMD] %s calls=%lu errors=%lu avg_us=%lu max_us=%lu\n",
+                  (index == 0U) ? "UNKNOWN" : kCommandSpecs[index].name,
+                  static_cast<unsigned long>(stats.calls),
+                  static_cast<unsigned long>(stats.errors),
+                  static_cast<unsigned long>(stats.total_us / stats.calls),
+                  static_cast<unsigned long>(stats.max_us));
+  }
+}
+
+CommandRegistry& commandRegistry() {
+  return g_command_registry;
+}
@@ -33,9 +33,11 @@
 #include "media_manager.h"
 #include "ui_freenove_config.h"
 #include "network_manager.h"
+#include "app/command_registry.h"
 #include "app/runtime_scene_service.h"
 #include "app/runtime_serial_service.h"
 #include "app/runtime_web_service.h"
+#include "app/step_action_gate.h"
 #include "runtime/app_coordinator.h"
 #include "runtime/la_trigger_service.h"
 #include "runtime/perf/perf_monitor.h"
@@ -52,6 +54,8 @@
 #include "scenarios/default_scenario_v2.h"
 #include "storage_manager.h"
 #include "system/boot_report.h"
+#include "system/boot_scheduler.h"
+#include "system/boot_snapshot.h"
 #include "system/rate_limited_log.h"
 #include "system/runtime_metrics.h"
 #include "touch_manager.h"
@@ -96,6 +100,19 @@ constexpr const char* kEspNowDeviceNameDefault = "U_SON";
 constexpr const char* kCredentialsNvsNamespace = "zacus_net";
 constexpr const char* kEspNowDeviceNameNvsKey = "esp_name";
 constexpr uint32_t kEspNowDiscoveryIntervalMs = 1000U;  // 1s refresh (was 15s)
+constexpr const char* kBootSnapshotPath = "/data/.boot_snapshot";
+constexpr const char* const kBootConfigFiles[] = {
+    "/story/apps/APP_WIFI.json",
+    "/story/apps/APP_ESPNOW.json",
+    "/story/apps/APP_HARDWARE.json",
+    "/story/apps/APP_CAMERA.json",
+    "/story/apps/APP_LA.json",
+    "/story/apps/APP_MEDIA.json",
+};
+// A boot counts as good once it has stayed up this long after TTI.
+constexpr uint32_t kBootSnapshotStableMs = 10000U;
+// Peers restored from the snapshot are usable at once; first discovery waits.
+constexpr uint32_t kBootSnapshotDiscoveryDelayMs = 10000U;
 constexpr size_t kHotlineSceneSyncPayloadCapacity = 224U;
 #if defined(USE_AUDIO) && (USE_AUDIO != 0)
 constexpr const char* kAmpMusicPathPrimary = "/music";
@@ -165,6 +182,10 @@ struct SceneWarningSirenFxState {
 };
 
 AudioManager g_audio;
+// Shared by the scenario timers (after_ms, ETAPE2_DUE, WIN_DUE) and the LA
+// gate timeout; each owner polls its own timer with isDue() every pass.
+StoryDeadlineQueue g_deadlines;
+int8_t g_la_timeout_timer = StoryDeadlineQueue::kInvalidTimer;
 ScenarioManager g_scenario;
 UiManager g_ui;
 StorageManager g_storage;
@@ -205,7 +226,11 @@ char g_web_auth_token[kWebAuthTokenCapacity] = {0};
 char g_espnow_device_name[kEspNowDeviceNameCapacity] = "U_SON";
 bool g_espnow_discovery_runtime_enabled = true;
 uint32_t g_next_espnow_discovery_ms = 0U;
-char g_last_action_step_key[72] = {0};
+BootScheduler g_boot_scheduler;
+BootSnapshot g_boot_snapshot;
+bool g_boot_snapshot_loaded = false;
+bool g_boot_snapshot_saved = false;
+StepActionGate g_step_action_gate;
 char g_serial_line[kSerialLineCapacity] = {0};
 size_t g_serial_line_len = 0U;
 RuntimeServices g_runtime_services;
@@ -924,7 +949,7 @@ void applyLcdBacklight(uint8_t level) {
   applyLcdBacklightEffective(level);
 }
 
-void configureSceneVisualHardwareHints(const char* scene_id, const String& payload_json) {
+void configureSceneVisualHardwareHints(const char* scene_id, const StoryContentView& payload_json) {
   const bool is_u_son_proto = (scene_id != nullptr) && (std::strcmp(scene_id, "SCENE_U_SON_PROTO") == 0);
   const bool is_warning_scene = (scene_id != nullptr) && (std::strcmp(scene_id, "SCENE_WARNING") == 0);
   const bool is_lefou_scene = (scene_id != nullptr) && (std::strcmp(scene_id, "SCENE_LEFOU_DETECTOR") == 0);
@@ -979,9 +1004,9 @@ void configureSceneVisualHardwareHints(const char* scene_id, const String& paylo
   uint32_t accent_rgb = 0x6FD8FFUL;
   bool ws_use_theme_accent = ws.single_random_blink;
 
-  if (!payload_json.isEmpty()) {
+  if (!payload_json.empty()) {
     DynamicJsonDocument document(4096);
-    const DeserializationError error = deserializeJson(document, payload_json);
+    const DeserializationError error = deserializeJson(document, payload_json.c_str(), payload_json.length());
     if (!error) {
       parseHexRgbColor(document["theme"]["accent"] | document["visual"]["theme"]["accent"] | "", &accent_rgb);
 
@@ -1753,7 +1778,7 @@ void applyMicRuntimePolicy() {
     return;
   }
   const bool should_run =
-      g_hardware_cfg.mic_enabled &&
+      g_hardware_cfg.mic_enabled && !g_media.recordingFromMic() &&
       (g_resource_coordinator.shouldRunMic() || g_la_trigger.gate_active || g_la_trigger.timeout_pending);
   g_hardware.setMicRuntimeEnabled(should_run);
 }
@@ -1822,6 +1847,7 @@ bool parseBoolToken(const char* text, bool* out_value) {
 
 void resetLaTriggerState(bool keep_cooldown = true) {
   LaTriggerService::resetState(&g_la_trigger, keep_cooldown);
+  g_deadlines.cancel(g_la_timeout_timer);
 }
 
 bool shouldEnforceLaMatchOnly(const ScenarioSnapshot& snapshot) {
@@ -1865,13 +1891,14 @@ void startLaTimeoutRecovery(const ScenarioSnapshot& snapshot, uint32_t now_ms) {
   (void)snapshot;
   g_la_trigger.timeout_pending = false;
   g_la_trigger.timeout_deadline_ms = 0U;
+  g_deadlines.cancel(g_la_timeout_timer);
   g_la_trigger.dispatched = false;
   g_la_trigger.locked = false;
   g_la_trigger.sample_match = false;
   g_la_dispatch_in_progress = false;
 
   g_audio.stop();
-  g_last_action_step_key[0] = '\0';
+  g_step_action_gate.invalidate();
   g_win_etape_ui_refresh_pending = false;
   if (g_hardware_started) {
     g_hardware.clearManualLed();
@@ -1888,7 +1915,20 @@ void startLaTimeoutRecovery(const ScenarioSnapshot& snapshot, uint32_t now_ms) {
 void updateLaGameplayTrigger(const ScenarioSnapshot& snapshot, const HardwareManager::Snapshot& hw, uint32_t now_ms) {
   const LaTriggerService::UpdateResult update =
       LaTriggerService::update(g_hardware_cfg, &g_la_trigger, snapshot, hw, now_ms);
-  if (update.timed_out) {
+  // The gate timeout is decided by the shared deadline queue, not by the
+  // service: it only publishes the deadline. The timer is armed when that
+  // deadline appears or moves (gate entry, reset key) and cancelled when it
+  // goes away, so steady passes never touch the heap.
+  uint32_t armed_due_ms = 0U;
+  const bool timeout_armed = g_deadlines.dueAtMs(g_la_timeout_timer, &armed_due_ms);
+  if (g_la_trigger.timeout_deadline_ms == 0U) {
+    if (timeout_armed) {
+      g_deadlines.cancel(g_la_timeout_timer);
+    }
+  } else if (!timeout_armed || armed_due_ms != g_la_trigger.timeout_deadline_ms) {
+    g_deadlines.arm(g_la_timeout_timer, g_la_trigger.timeout_deadline_ms);
+  }
+  if (g_deadlines.isDue(g_la_timeout_timer, now_ms)) {
     Serial.printf(
         "[LA_TRIGGER] timeout after %lu ms (freq=%u cents=%d conf=%u level=%u)\n",
         static_cast<unsigned long>(now_ms - g_la_trigger.gate_entered_ms),
@@ -2306,6 +2346,7 @@ void webFillCameraStatus(JsonObject out);
 void webFillMediaStatus(JsonObject out, uint32_t now_ms);
 void webSendHardwareStatus();
 void webSendCameraStatus();
+void webSendCommandStats();
 void webSendMediaFiles();
 void webSendMediaRecordStatus();
 void webSendAuthStatus();
@@ -2375,6 +2416,295 @@ void appendCompactRuntimeStatus(JsonObject out) {
   out["media_recording"] = media.recording;
 }
 
+bool runEspNowCommand(CommandId id,
+                       const String& trailing_arg,
+                       JsonVariantConst args,
+                       uint32_t now_ms,
+                       EspNowCommandResult* out_result) {
+  switch (id) {
+    case CommandId::kStatus: {
+      StaticJsonDocument<512> response;
+      appendCompactRuntimeStatus(response.to<JsonObject>());
+      serializeJson(response, out_result->data_json);
+      out_result->ok = true;
+      return true;
+    }
+    case CommandId::kUiSceneStatus: {
+      const UiSceneStatusSnapshot ui = g_ui.sceneStatusSnapshot();
+      String scene_id = ui.scene_id;
+      String step_id = ui.step_id;
+      String scene_upper = scene_id;
+      String step_upper = step_id;
+      scene_upper.toUpperCase();
+      step_upper.toUpperCase();
+
+      const char* validation_state = "none";
+      if (step_upper.indexOf("RTC_ESP_ETAPE") >= 0 ||
+          step_upper.indexOf("WAITING") >= 0 ||
+          step_upper.indexOf("PENDING") >= 0 ||
+          scene_upper == "SCENE_WIN_ETAPE" ||
+          scene_upper == "SCENE_WIN_ETAPE2") {
+        validation_state = "waiting";
+      } else if (step_upper.indexOf("WARNING") >= 0 ||
+                 step_upper.indexOf("REFUS") >= 0 ||
+                 step_upper.indexOf("BROKEN") >= 0 ||
+                 scene_upper == "SCENE_WARNING" ||
+                 scene_upper == "SCENE_BROKEN") {
+        validation_state = "refused";
+      } else if (step_upper.indexOf("WIN") >= 0 ||
+                 step_upper.indexOf("FINAL") >= 0 ||
+                 step_upper.indexOf("REWARD") >= 0 ||
+                 scene_upper == "SCENE_WIN_ETAPE1" ||
+                 scene_upper == "SCENE_WIN" ||
+                 scene_upper == "SCENE_REWARD") {
+        validation_state = "granted";
+      }
+
+      StaticJsonDocument<320> response;
+      response["valid"] = ui.valid;
+      response["scenario_id"] = ui.scenario_id;
+      response["scene_id"] = ui.scene_id;
+      response["step_id"] = ui.step_id;
+      response["validation_state"] = validation_state;
+      serializeJson(response, out_result->data_json);
+      out_result->ok = true;
+      return true;
+    }
+    case CommandId::kWifiStatus: {
+      StaticJsonDocument<384> response;
+      webFillWifiStatus(response.to<JsonObject>(), g_network.snapshot());
+      serializeJson(response, out_result->data_json);
+      out_result->ok = true;
+      return true;
+    }
+    case CommandId::kEspnowStatus: {
+      StaticJsonDocument<512> response;
+      webFillEspNowStatus(response.to<JsonObject>(), g_network.snapshot());
+      serializeJson(response, out_result->data_json);
+      out_result->ok = true;
+      return true;
+    }
+    case CommandId::kUnlock: {
+      out_result->ok = dispatchScenarioEventByName("UNLOCK", now_ms);
+      return true;
+    }
+    case CommandId::kNext: {
+      bool ok = dispatchScenarioEventByName("SERIAL:BTN_NEXT", now_ms);
+      if (!ok) {
+        ok = notifyScenarioButtonGuarded(5U, false, now_ms, "espnow_command");
+      }
+      out_result->ok = ok;
+      if (!out_result->ok) {
+        out_result->error = "scene_not_found";
+      }
+      return true;
+    }
+    case CommandId::kWifiDisconnect: {
+      g_network.disconnectSta();
+      out_result->ok = true;
+      return true;
+    }
+    case CommandId::kWifiReconnect: {
+      if (g_network_cfg.local_ssid[0] == '\0') {
+        out_result->ok = false;
+        out_result->error = "no_credentials";
+        return true;
+      }
+      out_result->ok = webReconnectLocalWifi();
+      if (!out_result->ok) {
+        out_result->error = "wifi_reconnect_failed";
+      }
+      return true;
+    }
+    case CommandId::kEspnowOn: {
+      out_result->ok = g_network.enableEspNow();
+      if (!out_result->ok) {
+        out_result->error = "espnow_enable_failed";
+      }
+      return true;
+    }
+    case CommandId::kEspnowOff: {
+      g_network.disableEspNow();
+      out_result->ok = true;
+      return true;
+    }
+    case CommandId::kEspnowDiscovery: {
+      const uint8_t discovered = runEspNowDiscoverySweep();
+      out_result->ok = discovered > 0U;
+      if (!out_result->ok) {
+        out_result->error = "peer_not_found";
+        return true;
+      }
+      StaticJsonDocument<384> response;
+      response["target"] = "broadcast";
+      response["mode"] = "broadcast+discovery";
+      response["device_name"] = g_espnow_device_name;
+      response["peer_count"] = discovered;
+      JsonArray peers = response["peers"].to<JsonArray>();
+      for (uint8_t index = 0U; index < discovered; ++index) {
+        char peer[18] = {0};
+        if (!g_network.espNowPeerAt(index, peer, sizeof(peer))) {
+          continue;
+        }
+        peers.add(peer);
+      }
+      serializeJson(response, out_result->data_json);
+      return true;
+    }
+    case CommandId::kEspnowDiscoveryRuntime: {
+      if (!trailing_arg.isEmpty()) {
+        bool enabled = false;
+        if (!parseBoolToken(trailing_arg.c_str(), &enabled)) {
+          out_result->ok = false;
+          out_result->error = "invalid_discovery_runtime";
+          return true;
+        }
+        g_espnow_discovery_runtime_enabled = enabled;
+        g_next_espnow_discovery_ms = millis() + 50U;
+      }
+      StaticJsonDocument<160> response;
+      response["enabled"] = g_espnow_discovery_runtime_enabled;
+      response["interval_ms"] = kEspNowDiscoveryIntervalMs;
+      response["device_name"] = g_espnow_device_name;
+      serializeJson(response, out_result->data_json);
+      out_result->ok = true;
+      return true;
+    }
+    case CommandId::kEspnowDeviceNameGet: {
+      StaticJsonDocument<128> response;
+      response["device_name"] = g_espnow_device_name;
+      serializeJson(response, out_result->data_json);
+      out_result->ok = true;
+      return true;
+    }
+    case CommandId::kEspnowDeviceNameSet: {
+      String next_name = trailing_arg;
+      next_name.trim();
+      if (next_name.isEmpty() && !args.isNull()) {
+        if (args.is<const char*>()) {
+          next_name = args.as<const char*>();
+        } else if (args.is<JsonObjectConst>()) {
+          JsonObjectConst name_args = args.as<JsonObjectConst>();
+          const char* requested = name_args["device_name"] | name_args["name"] | name_args["value"] | "";
+          if (requested != nullptr && requested[0] != '\0') {
+            next_name = requested;
+          }
+        }
+      }
+      next_name.trim();
+      if (next_name.isEmpty()) {
+        out_result->ok = false;
+        out_result->error = "missing_device_name";
+        return true;
+      }
+      out_result->ok = saveEspNowDeviceNameToNvs(next_name.c_str());
+      if (!out_result->ok) {
+        out_result->error = "device_name_store_failed";
+        return true;
+      }
+      StaticJsonDocument<128> response;
+      response["device_name"] = g_espnow_device_name;
+      serializeJson(response, out_result->data_json);
+      return true;
+    }
+    case CommandId::kStoryRefreshSd: {
+      out_result->ok = refreshStoryFromSd();
+      if (!out_result->ok) {
+        out_result->error = "story_refresh_sd_failed";
+      }
+      return true;
+    }
+    case CommandId::kScEvent: {
+      bool dispatched = false;
+      if (!args.isNull() && args.is<JsonObjectConst>()) {
+        JsonVariantConst args_obj = args;
+        const char* type_text = args_obj["event_type"] | args_obj["type"] | "";
+        const char* name_text = args_obj["event_name"] | args_obj["name"] | "";
+        StoryEventType event_type = StoryEventType::kNone;
+        if (type_text[0] != '\0' && parseEventType(type_text, &event_type)) {
+          dispatched = dispatchScenarioEventByType(event_type, name_text, now_ms);
+        } else {
+          char event_token[kSerialLineCapacity] = {0};
+          if (extractEventTokenFromJsonObject(args_obj, event_token, sizeof(event_token))) {
+            dispatched = dispatchScenarioEventByName(event_token, now_ms);
+          }
+        }
+      }
+      if (!dispatched && !trailing_arg.isEmpty()) {
+        char event_token[kSerialLineCapacity] = {0};
+        if (normalizeEventTokenFromText(trailing_arg.c_str(), event_token, sizeof(event_token))) {
+          dispatched = dispatchScenarioEventByName(event_token, now_ms);
+        }
+      }
+      out_result->ok = dispatched;
+      if (!dispatched) {
+        out_result->error = "invalid_sc_event";
+      }
+      return true;
+    }
+    case CommandId::kRing: {
+      out_result->ok = dispatchScenarioEventByName("RING", now_ms);
+      if (!out_result->ok) {
+        out_result->error = "invalid_ring_event";
+      }
+      return true;
+    }
+    case CommandId::kScene: {
+      String scene_id = trailing_arg;
+      scene_id.trim();
+      if (scene_id.isEmpty() && !args.isNull()) {
+        if (args.is<const char*>()) {
+          scene_id = args.as<const char*>();
+        } else if (args.is<JsonObjectConst>()) {
+          JsonObjectConst scene_args = args.as<JsonObjectConst>();
+          const char* requested = scene_args["id"] | scene_args["scenario"] | scene_args["scenario_id"] | scene_args["scene_id"] | "";
+          if (requested != nullptr && requested[0] != '\0') {
+            scene_id = requested;
+          } else if (scene_args["name"].is<const char*>()) {
+            scene_id = scene_args["name"].as<const char*>();
+          }
+        } else if (args.is<int>()) {
+          scene_id = String(args.as<int>());
+        } else if (args.is<unsigned int>()) {
+          scene_id = String(args.as<unsigned int>());
+        } else if (args.is<long>()) {
+          scene_id = String(args.as<long>());
+        } else if (args.is<unsigned long>()) {
+          scene_id = String(args.as<unsigned long>());
+        }
+      }
+
+      scene_id.trim();
+      if (scene_id.isEmpty()) {
+        out_result->ok = false;
+        out_result->error = "missing_scene_id";
+        return true;
+      }
+      scene_id.toUpperCase();
+
+      String load_source;
+      String load_path;
+      out_result->ok = loadScenarioByIdPreferStoryFile(scene_id.c_str(), &load_source, &load_path);
+      if (!out_result->ok) {
+        out_result->error = "scene_not_found";
+        return true;
+      }
+      if (!load_path.isEmpty()) {
+        Serial.printf("[SCENARIO] SCENE source=%s path=%s\n", load_source.c_str(), load_path.c_str());
+      } else {
+        Serial.printf("[SCENARIO] SCENE source=%s id=%s\n", load_source.c_str(), scene_id.c_str());
+      }
+      g_step_action_gate.invalidate();
+      refreshSceneIfNeeded(true);
+      startPendingAudioIfAny();
+      return true;
+    }
+    default:
+      break;
+  }
+  return false;
+}
+
 bool executeEspNowCommandPayload(const char* payload_text, uint32_t now_ms, EspNowCommandResult* out_result) {
   if (payload_text == nullptr || out_result == nullptr) {
     return false;
@@ -2439,282 +2769,16 @@ bool executeEspNowCommandPayload(const char* payload_text, uint32_t now_ms, EspN
   out_result->handled = true;
   out_result->code = command;
 
-  if (command == "STATUS") {
-    StaticJsonDocument<512> response;
-    appendCompactRuntimeStatus(response.to<JsonObject>());
-    serializeJson(response, out_result->data_json);
-    out_result->ok = true;
-    return true;
-  }
-  if (command == "UI_SCENE_STATUS") {
-    const UiSceneStatusSnapshot ui = g_ui.sceneStatusSnapshot();
-    String scene_id = ui.scene_id;
-    String step_id = ui.step_id;
-    String scene_upper = scene_id;
-    String step_upper = step_id;
-    scene_upper.toUpperCase();
-    step_upper.toUpperCase();
-
-    const char* validation_state = "none";
-    if (step_upper.indexOf("RTC_ESP_ETAPE") >= 0 ||
-        step_upper.indexOf("WAITING") >= 0 ||
-        step_upper.indexOf("PENDING") >= 0 ||
-        scene_upper == "SCENE_WIN_ETAPE" ||
-        scene_upper == "SCENE_WIN_ETAPE2") {
-      validation_state = "waiting";
-    } else if (step_upper.indexOf("WARNING") >= 0 ||
-               step_upper.indexOf("REFUS") >= 0 ||
-               step_upper.indexOf("BROKEN") >= 0 ||
-               scene_upper == "SCENE_WARNING" ||
-               scene_upper == "SCENE_BROKEN") {
-      validation_state = "refused";
-    } else if (step_upper.indexOf("WIN") >= 0 ||
-               step_upper.indexOf("FINAL") >= 0 ||
-               step_upper.indexOf("REWARD") >= 0 ||
-               scene_upper == "SCENE_WIN_ETAPE1" ||
-               scene_upper == "SCENE_WIN" ||
-               scene_upper == "SCENE_REWARD") {
-      validation_state = "granted";
-    }
-
-    StaticJsonDocument<320> response;
-    response["valid"] = ui.valid;
-    response["scenario_id"] = ui.scenario_id;
-    response["scene_id"] = ui.scene_id;
-    response["step_id"] = ui.step_id;
-    response["validation_state"] = validation_state;
-    serializeJson(response, out_result->data_json);
-    out_result->ok = true;
-    return true;
-  }
-  if (command == "WIFI_STATUS") {
-    StaticJsonDocument<384> response;
-    webFillWifiStatus(response.to<JsonObject>(), g_network.snapshot());
-    serializeJson(response, out_result->data_json);
-    out_result->ok = true;
-    return true;
-  }
-  if (command == "ESPNOW_STATUS") {
-    StaticJsonDocument<512> response;
-    webFillEspNowStatus(response.to<JsonObject>(), g_network.snapshot());
-    serializeJson(response, out_result->data_json);
-    out_result->ok = true;
-    return true;
-  }
-  if (command == "UNLOCK") {
-    out_result->ok = dispatchScenarioEventByName("UNLOCK", now_ms);
-    return true;
-  }
-  if (command == "NEXT") {
-    bool ok = dispatchScenarioEventByName("SERIAL:BTN_NEXT", now_ms);
-    if (!ok) {
-      ok = notifyScenarioButtonGuarded(5U, false, now_ms, "espnow_command");
-    }
-    out_result->ok = ok;
-    if (!out_result->ok) {
-      out_result->error = "scene_not_found";
-    }
-    return true;
-  }
-  if (command == "WIFI_DISCONNECT") {
-    g_network.disconnectSta();
-    out_result->ok = true;
-    return true;
-  }
-  if (command == "WIFI_RECONNECT") {
-    if (g_network_cfg.local_ssid[0] == '\0') {
-      out_result->ok = false;
-      out_result->error = "no_credentials";
-      return true;
-    }
-    out_result->ok = webReconnectLocalWifi();
-    if (!out_result->ok) {
-      out_result->error = "wifi_reconnect_failed";
-    }
-    return true;
-  }
-  if (command == "ESPNOW_ON") {
-    out_result->ok = g_network.enableEspNow();
-    if (!out_result->ok) {
-      out_result->error = "espnow_enable_failed";
-    }
-    return true;
-  }
-  if (command == "ESPNOW_OFF") {
-    g_network.disableEspNow();
-    out_result->ok = true;
-    return true;
-  }
-  if (command == "ESPNOW_DISCOVERY") {
-    const uint8_t discovered = runEspNowDiscoverySweep();
-    out_result->ok = discovered > 0U;
-    if (!out_result->ok) {
-      out_result->error = "peer_not_found";
-      return true;
-    }
-    StaticJsonDocument<384> response;
-    response["target"] = "broadcast";
-    response["mode"] = "broadcast+discovery";
-    response["device_name"] = g_espnow_device_name;
-    response["peer_count"] = discovered;
-    JsonArray peers = response["peers"].to<JsonArray>();
-    for (uint8_t index = 0U; index < discovered; ++index) {
-      char peer[18] = {0};
-      if (!g_network.espNowPeerAt(index, peer, sizeof(peer))) {
-        continue;
-      }
-      peers.add(peer);
-    }
-    serializeJson(response, out_result->data_json);
-    return true;
-  }
-  if (command == "ESPNOW_DISCOVERY_RUNTIME") {
-    if (!trailing_arg.isEmpty()) {
-      bool enabled = false;
-      if (!parseBoolToken(trailing_arg.c_str(), &enabled)) {
-        out_result->ok = false;
-        out_result->error = "invalid_discovery_runtime";
-        return true;
-      }
-      g_espnow_discovery_runtime_enabled = enabled;
-      g_next_espnow_discovery_ms = millis() + 50U;
-    }
-    StaticJsonDocument<160> response;
-    response["enabled"] = g_espnow_discovery_runtime_enabled;
-    response["interval_ms"] = kEspNowDiscoveryIntervalMs;
-    response["device_name"] = g_espnow_device_name;
-    serializeJson(response, out_result->data_json);
-    out_result->ok = true;
-    return true;
-  }
-  if (command == "ESPNOW_DEVICE_NAME_GET") {
-    StaticJsonDocument<128> response;
-    response["device_name"] = g_espnow_device_name;
-    serializeJson(response, out_result->data_json);
-    out_result->ok = true;
-    return true;
-  }
-  if (command == "ESPNOW_DEVICE_NAME_SET") {
-    String next_name = trailing_arg;
-    next_name.trim();
-    if (next_name.isEmpty() && !args.isNull()) {
-      if (args.is<const char*>()) {
-        next_name = args.as<const char*>();
-      } else if (args.is<JsonObjectConst>()) {
-        JsonObjectConst name_args = args.as<JsonObjectConst>();
-        const char* requested = name_args["device_name"] | name_args["name"] | name_args["value"] | "";
-        if (requested != nullptr && requested[0] != '\0') {
-          next_name = requested;
-        }
-      }
-    }
-    next_name.trim();
-    if (next_name.isEmpty()) {
-      out_result->ok = false;
-      out_result->error = "missing_device_name";
-      return true;
-    }
-    out_result->ok = saveEspNowDeviceNameToNvs(next_name.c_str());
-    if (!out_result->ok) {
-      out_result->error = "device_name_store_failed";
-      return true;
-    }
-    StaticJsonDocument<128> response;
-    response["device_name"] = g_espnow_device_name;
-    serializeJson(response, out_result->data_json);
-    return true;
-  }
-  if (command == "STORY_REFRESH_SD") {
-    out_result->ok = refreshStoryFromSd();
-    if (!out_result->ok) {
-      out_result->error = "story_refresh_sd_failed";
-    }
-    return true;
-  }
-  if (command == "SC_EVENT") {
-    bool dispatched = false;
-    if (!args.isNull() && args.is<JsonObjectConst>()) {
-      JsonVariantConst args_obj = args;
-      const char* type_text = args_obj["event_type"] | args_obj["type"] | "";
-      const char* name_text = args_obj["event_name"] | args_obj["name"] | "";
-      StoryEventType event_type = StoryEventType::kNone;
-      if (type_text[0] != '\0' && parseEventType(type_text, &event_type)) {
-        dispatched = dispatchScenarioEventByType(event_type, name_text, now_ms);
-      } else {
-        char event_token[kSerialLineCapacity] = {0};
-        if (extractEventTokenFromJsonObject(args_obj, event_token, sizeof(event_token))) {
-          dispatched = dispatchScenarioEventByName(event_token, now_ms);
-        }
-      }
-    }
-    if (!dispatched && !trailing_arg.isEmpty()) {
-      char event_token[kSerialLineCapacity] = {0};
-      if (normalizeEventTokenFromText(trailing_arg.c_str(), event_token, sizeof(event_token))) {
-        dispatched = dispatchScenarioEventByName(event_token, now_ms);
-      }
-    }
-    out_result->ok = dispatched;
-    if (!dispatched) {
-      out_result->error = "invalid_sc_event";
-    }
-    return true;
-  }
-  if (command == "RING") {
-    out_result->ok = dispatchScenarioEventByName("RING", now_ms);
-    if (!out_result->ok) {
-      out_result->error = "invalid_ring_event";
-    }
-    return true;
-  }
-  if (command == "SCENE") {
-    String scene_id = trailing_arg;
-    scene_id.trim();
-    if (scene_id.isEmpty() && !args.isNull()) {
-      if (args.is<const char*>()) {
-        scene_id = args.as<const char*>();
-      } else if (args.is<JsonObjectConst>()) {
-        JsonObjectConst scene_args = args.as<JsonObjectConst>();
-        const char* id = scene_args["id"] | scene_args["scenario"] | scene_args["scenario_id"] | scene_args["scene_id"] | "";
-        if (id != nullptr && id[0] != '\0') {
-          scene_id = id;
-        } else if (scene_args["name"].is<const char*>()) {
-          scene_id = scene_args["name"].as<const char*>();
-        }
-      } else if (args.is<int>()) {
-        scene_id = String(args.as<int>());
-      } else if (args.is<unsigned int>()) {
-        scene_id = String(args.as<unsigned int>());
-      } else if (args.is<long>()) {
-        scene_id = String(args.as<long>());
-      } else if (args.is<unsigned long>()) {
-        scene_id = String(args.as<unsigned long>());
-      }
-    }
-
-    scene_id.trim();
-    if (scene_id.isEmpty()) {
-      out_result->ok = false;
-      out_result->error = "missing_scene_id";
-      return true;
-    }
-    scene_id.toUpperCase();
-
-    String load_source;
-    String load_path;
-    out_result->ok = loadScenarioByIdPreferStoryFile(scene_id.c_str(), &load_source, &load_path);
-    if (!out_result->ok) {
-      out_result->error = "scene_not_found";
+  // Native ESP-NOW commands first; anything else is relayed to the control dispatcher below.
+  const CommandId id = CommandRegistry::find(command.c_str(), command.length(), CommandTransport::kEspNow);
+  CommandRegistry& registry = commandRegistry();
+  if (id != CommandId::kUnknown) {
+    const uint32_t started_us = registry.beginCall();
+    const bool handled = runEspNowCommand(id, trailing_arg, args, now_ms, out_result);
+    registry.endCall(id, CommandTransport::kEspNow, started_us, handled && out_result->ok);
+    if (handled) {
       return true;
     }
-    if (!load_path.isEmpty()) {
-      Serial.printf("[SCENARIO] SCENE source=%s path=%s\n", load_source.c_str(), load_path.c_str());
-    } else {
-      Serial.printf("[SCENARIO] SCENE source=%s id=%s\n", load_source.c_str(), scene_id.c_str());
-    }
-    g_last_action_step_key[0] = '\0';
-    refreshSceneIfNeeded(true);
-    startPendingAudioIfAny();
-    return true;
   }
 
   String control_action = command;
@@ -2779,6 +2843,24 @@ void sendEspNowAck(const char* peer,
   }
 }
 
+// Binary counterpart of sendEspNowAck: one RESULT record, batched and acked
+// by the link. Failures carry the error as {"error":...} data.
+void sendEspNowResult(const char* peer, uint16_t request_id, const EspNowCommandResult& result) {
+  String data = result.data_json;
+  if (!result.ok && !result.error.isEmpty()) {
+    StaticJsonDocument<192> error_doc;
+    error_doc["error"] = result.error;
+    data = "";
+    serializeJson(error_doc, data);
+  }
+  if (!g_network.sendEspNowResult(peer, request_id, result.ok, result.code.c_str(), data.c_str())) {
+    Serial.printf("[NET] ESPNOW RESULT queue failed peer=%s request=%u code=%s\n",
+                  peer,
+                  static_cast<unsigned int>(request_id),
+                  result.code.c_str());
+  }
+}
+
 void printScenarioList() {
   const char* default_id = storyScenarioV2IdAt(0U);
   Serial.printf("SC_LIST count=%u default=%s\n",
@@ -2987,7 +3069,7 @@ void printNetworkStatus() {
 
 void printEspNowStatusJson() {
   const NetworkManager::Snapshot net = g_network.snapshot();
-  StaticJsonDocument<768> document;
+  StaticJsonDocument<1536> document;
   document["ready"] = net.espnow_enabled;
   document["peer_count"] = net.espnow_peer_count;
   document["tx_ok"] = net.espnow_tx_ok;
@@ -2999,6 +3081,18 @@ void printEspNowStatusJson() {
   document["last_type"] = net.last_type;
   document["last_ack"] = net.espnow_last_ack;
   document["last_payload"] = net.last_payload;
+  JsonObject link = document.createNestedObject("link");
+  link["frames"] = net.espnow_link_frames;
+  link["retransmits"] = net.espnow_link_retransmits;
+  link["expired"] = net.espnow_link_expired;
+  link["duplicates"] = net.espnow_link_duplicates;
+  link["rtt_avg_ms"] = net.espnow_link_rtt_avg_ms;
+  JsonObject rx = document.createNestedObject("rx");
+  rx["overflow"] = net.espnow_rx_overflow;
+  rx["invalid"] = net.espnow_rx_invalid;
+  rx["high_water"] = net.espnow_rx_high_water;
+  rx["batches"] = net.espnow_rx_batches;
+  rx["latency_max_ms"] = net.espnow_rx_latency_max_ms;
   document["device_name"] = g_espnow_device_name;
   document["send_mode"] = "broadcast";
   document["discovery"] = true;
@@ -3534,12 +3628,21 @@ void printSimdStatus() {
 
 void printMediaStatus() {
   const MediaManager::Snapshot media = g_media.snapshot();
-  Serial.printf("REC_STATUS playing=%u recording=%u elapsed=%u/%u file=%s music_dir=%s picture_dir=%s record_dir=%s last_ok=%u err=%s\n",
+  Serial.printf("REC_STATUS playing=%u recording=%u finalizing=%u elapsed=%u/%u file=%s simulated=%u adpcm=%u samples=%lu bytes=%lu "
+                "dropped=%lu write_avg_us=%lu write_max_us=%lu music_dir=%s picture_dir=%s record_dir=%s last_ok=%u err=%s\n",
                 media.playing ? 1U : 0U,
                 media.recording ? 1U : 0U,
+                media.record_finalizing ? 1U : 0U,
                 static_cast<unsigned int>(media.record_elapsed_seconds),
                 static_cast<unsigned int>(media.record_limit_seconds),
                 media.record_file[0] != '\0' ? media.record_file : "n/a",
+                media.record_simulated ? 1U : 0U,
+                media.record_adpcm ? 1U : 0U,
+                static_cast<unsigned long>(media.record_samples),
+                static_cast<unsigned long>(media.record_bytes),
+                static_cast<unsigned long>(media.record_dropped_samples),
+                static_cast<unsigned long>(media.record_write_avg_us),
+                static_cast<unsigned long>(media.record_write_max_us),
                 media.music_dir,
                 media.picture_dir,
                 media.record_dir,
@@ -3947,6 +4050,18 @@ void webFillEspNowStatus(JsonObject out, const NetworkManager::Snapshot& net) {
   out["last_type"] = String(net.last_type);
   out["last_ack"] = net.espnow_last_ack;
   out["last_payload"] = String(net.last_payload);
+  JsonObject link = out.createNestedObject("link");
+  link["frames"] = net.espnow_link_frames;
+  link["retransmits"] = net.espnow_link_retransmits;
+  link["expired"] = net.espnow_link_expired;
+  link["duplicates"] = net.espnow_link_duplicates;
+  link["rtt_avg_ms"] = net.espnow_link_rtt_avg_ms;
+  JsonObject rx = out.createNestedObject("rx");
+  rx["overflow"] = net.espnow_rx_overflow;
+  rx["invalid"] = net.espnow_rx_invalid;
+  rx["high_water"] = net.espnow_rx_high_water;
+  rx["batches"] = net.espnow_rx_batches;
+  rx["latency_max_ms"] = net.espnow_rx_latency_max_ms;
   out["device_name"] = g_espnow_device_name;
   out["send_mode"] = "broadcast";
   out["discovery"] = true;
@@ -4070,6 +4185,16 @@ void webFillCameraStatus(JsonObject out) {
   out["recorder_preview_width"] = camera.recorder_preview_width;
   out["recorder_preview_height"] = camera.recorder_preview_height;
   out["recorder_selected_file"] = camera.recorder_selected_file;
+  out["luma_stream_active"] = camera.luma_stream_active;
+  out["luma_stream_paced"] = camera.luma_stream_paced;
+  out["luma_frame_count"] = camera.luma_frame_count;
+  out["luma_drop_count"] = camera.luma_drop_count;
+  out["luma_stall_count"] = camera.luma_stall_count;
+  const camera::CameraPipelineStats pipeline = g_camera.pipeline().stats();
+  out["pipeline_in_flight"] = pipeline.in_flight;
+  out["pipeline_peak_in_flight"] = pipeline.peak_in_flight;
+  out["pipeline_rejected"] = pipeline.rejected;
+  out["pipeline_unseen"] = pipeline.superseded;
 }
 
 void webFillMediaStatus(JsonObject out, uint32_t now_ms) {
@@ -4078,6 +4203,7 @@ void webFillMediaStatus(JsonObject out, uint32_t now_ms) {
   out["playing"] = media.playing;
   out["playing_path"] = media.playing_path;
   out["recording"] = media.recording;
+  out["record_finalizing"] = media.record_finalizing;
   out["record_limit_seconds"] = media.record_limit_seconds;
   uint16_t elapsed = media.record_elapsed_seconds;
   if (media.recording && media.record_started_ms > 0U) {
@@ -4086,6 +4212,13 @@ void webFillMediaStatus(JsonObject out, uint32_t now_ms) {
   out["record_elapsed_seconds"] = elapsed;
   out["record_file"] = media.record_file;
   out["record_simulated"] = media.record_simulated;
+  out["record_adpcm"] = media.record_adpcm;
+  out["record_samples"] = media.record_samples;
+  out["record_bytes"] = media.record_bytes;
+  out["record_dropped_samples"] = media.record_dropped_samples;
+  out["record_write_avg_us"] = media.record_write_avg_us;
+  out["record_write_max_us"] = media.record_write_max_us;
+  out["record_ring_peak_pct"] = media.record_ring_peak_pct;
   out["music_dir"] = media.music_dir;
   out["picture_dir"] = media.picture_dir;
   out["record_dir"] = media.record_dir;
@@ -4119,6 +4252,30 @@ void webSendCameraStatus() {
   webSendJsonDocument(document);
 }
 
+void webSendCommandStats() {
+  const CommandRegistry& registry = commandRegistry();
+  DynamicJsonDocument document(4096);
+  JsonObject transports = document["transports"].to<JsonObject>();
+  transports["serial"] = registry.transportCalls(CommandTransport::kSerial);
+  transports["control"] = registry.transportCalls(CommandTransport::kControl);
+  transports["espnow"] = registry.transportCalls(CommandTransport::kEspNow);
+  JsonArray commands = document["commands"].to<JsonArray>();
+  for (uint8_t index = 0U; index < static_cast<uint8_t>(CommandId::kCount); ++index) {
+    const CommandId id = static_cast<CommandId>(index);
+    const CommandStats& stats = registry.stats(id);
+    if (stats.calls == 0U) {
+      continue;
+    }
+    JsonObject entry = commands.createNestedObject();
+    entry["name"] = (id == CommandId::kUnknown) ? "UNKNOWN" : CommandRegistry::name(id);
+    entry["calls"] = stats.calls;
+    entry["errors"] = stats.errors;
+    entry["avg_us"] = static_cast<uint32_t>(stats.total_us / stats.calls);
+    entry["max_us"] = stats.max_us;
+  }
+  webSendJsonDocument(document);
+}
+
 void webSendMediaFiles() {
   String kind = g_web_server.arg("kind");
   if (kind.isEmpty()) {
@@ -4200,6 +4357,17 @@ void webScheduleStaDisconnect() {
   g_web_disconnect_sta_at_ms = millis() + 250U;
 }
 
+bool reloadScenarioAfterStorySync() {
+  const bool reloaded = g_scenario.begin(kDefaultScenarioFile);
+  if (reloaded) {
+    g_step_action_gate.invalidate();
+    resetLaTriggerState(false);
+    refreshSceneIfNeeded(true);
+    startPendingAudioIfAny();
+  }
+  return reloaded;
+}
+
 bool refreshStoryFromSd() {
   const bool synced_tree = g_storage.syncStoryTreeFromSd();
   const bool synced_default = g_storage.syncStoryFileFromSd(kDefaultScenarioFile);
@@ -4207,13 +4375,7 @@ bool refreshStoryFromSd() {
   if (!synced) {
     return false;
   }
-  const bool reloaded = g_scenario.begin(kDefaultScenarioFile);
-  if (reloaded) {
-    g_last_action_step_key[0] = '\0';
-    resetLaTriggerState(false);
-    refreshSceneIfNeeded(true);
-    startPendingAudioIfAny();
-  }
+  const bool reloaded = reloadScenarioAfterStorySync();
   Serial.printf("[SCENARIO] refresh from sd synced=%u reload=%u\n", synced ? 1U : 0U, reloaded ? 1U : 0U);
   return reloaded;
 }
@@ -4342,8 +4504,8 @@ bool executeStoryAction(const char* action_id, const ScenarioSnapshot& snapshot,
   }
 
   const String action_path = String("/story/actions/") + action_id + ".json";
-  String payload = g_storage.loadTextFile(action_path.c_str());
-  if (payload.isEmpty()) {
+  StoryContentView payload = g_storage.loadTextView(action_path.c_str());
+  if (payload.empty()) {
     const char* alias_id = nullptr;
     if (std::strcmp(action_id, "ACTION_QR_CODE_SCANNER_START") == 0) {
       alias_id = "ACTION_QR_SCAN_START";
@@ -4352,15 +4514,15 @@ bool executeStoryAction(const char* action_id, const ScenarioSnapshot& snapshot,
     }
     if (alias_id != nullptr) {
       const String alias_path = String("/story/actions/") + alias_id + ".json";
-      payload = g_storage.loadTextFile(alias_path.c_str());
-      if (!payload.isEmpty()) {
+      payload = g_storage.loadTextView(alias_path.c_str());
+      if (!payload.empty()) {
         Serial.printf("[ACTION] payload alias id=%s file=%s\n", action_id, alias_id);
       }
     }
   }
   g_story_action_doc.clear();
-  if (!payload.isEmpty()) {
-    deserializeJson(g_story_action_doc, payload);
+  if (!payload.empty()) {
+    deserializeJson(g_story_action_doc, payload.c_str(), payload.length());
   }
   const char* action_type = g_story_action_doc["type"] | "";
 
@@ -4540,26 +4702,25 @@ void executeStoryActionsForStep(const ScenarioSnapshot& snapshot, uint32_t now_m
     return;
   }
 
-  char step_key[sizeof(g_last_action_step_key)] = {0};
+  char step_key[StepActionGate::kKeyCapacity] = {0};
   snprintf(step_key,
            sizeof(step_key),
            "%s:%s",
            scenarioIdFromSnapshot(snapshot),
            stepIdFromSnapshot(snapshot));
-  if (std::strcmp(step_key, g_last_action_step_key) == 0) {
-    if (snapshot.action_ids == nullptr || snapshot.action_count == 0U) {
-      return;
-    }
-  } else {
-    copyText(g_last_action_step_key, sizeof(g_last_action_step_key), step_key);
+  const StepActionGate::Decision decision =
+      g_step_action_gate.enter(step_key, snapshot.action_ids != nullptr && snapshot.action_count > 0U);
+  if (decision.step_changed) {
     g_has_ring_sent_for_win_etape = std::strcmp(stepIdFromSnapshot(snapshot), kStepWinEtape) != 0;
     g_win_etape_ui_refresh_pending = false;
-    if (snapshot.action_ids == nullptr || snapshot.action_count == 0U) {
-      return;
-    }
+    // Only a real step change stops a take: a re-render of the same step
+    // must not stop what its own REC_START started.
+    g_media.noteStepChange();
+  }
+  if (!decision.run_actions) {
+    return;
   }
 
-  g_media.noteStepChange();
   for (uint8_t index = 0U; index < snapshot.action_count; ++index) {
     const char* action_id = snapshot.action_ids[index];
     if (action_id == nullptr || action_id[0] == '\0') {
@@ -4570,19 +4731,7 @@ void executeStoryActionsForStep(const ScenarioSnapshot& snapshot, uint32_t now_m
   }
 }
 
-bool dispatchControlActionImpl(const String& action_raw, uint32_t now_ms, String* out_error) {
-  if (out_error != nullptr) {
-    out_error->remove(0);
-  }
-  String action = action_raw;
-  action.trim();
-  if (action.isEmpty()) {
-    if (out_error != nullptr) {
-      *out_error = "empty_action";
-    }
-    return false;
-  }
-
+bool runControlAction(CommandId id, const String& arg, uint32_t now_ms, String* out_error) {
   auto parseRecorderFormat = [](const String& value,
                                 ui::camera::CameraCaptureService::CaptureFormat* out_format) -> bool {
     if (out_format == nullptr) {
@@ -4610,570 +4759,572 @@ bool dispatchControlActionImpl(const String& action_raw, uint32_t now_ms, String
     return false;
   };
 
-  if (action.equalsIgnoreCase("UNLOCK")) {
-    return dispatchScenarioEventByName("UNLOCK", now_ms);
-  }
-  if (action.equalsIgnoreCase("NEXT")) {
-    return notifyScenarioButtonGuarded(5U, false, now_ms, "api_control");
-  }
-  if (action.equalsIgnoreCase("STORY_REFRESH_SD")) {
-    return refreshStoryFromSd();
-  }
-  if (action.equalsIgnoreCase("WIFI_DISCONNECT")) {
-    webScheduleStaDisconnect();
-    return true;
-  }
-  if (action.equalsIgnoreCase("WIFI_FORGET")) {
-    const bool ok = forgetWifiCredentials();
-    if (!ok && out_error != nullptr) {
-      *out_error = "wifi_forget_failed";
+  switch (id) {
+    case CommandId::kUnlock: {
+      return dispatchScenarioEventByName("UNLOCK", now_ms);
     }
-    return ok;
-  }
-  if (action.equalsIgnoreCase("WIFI_RECONNECT")) {
-    return webReconnectLocalWifi();
-  }
-  if (action.equalsIgnoreCase("ESPNOW_ON")) {
-    return g_network.enableEspNow();
-  }
-  if (action.equalsIgnoreCase("ESPNOW_OFF")) {
-    g_network.disableEspNow();
-    return true;
-  }
-  if (action.equalsIgnoreCase("HW_STATUS")) {
-    printHardwareStatus();
-    return true;
-  }
-  if (action.equalsIgnoreCase("HW_STATUS_JSON")) {
-    printHardwareStatusJson();
-    return true;
-  }
-  if (action.equalsIgnoreCase("HW_MIC_STATUS")) {
-    printHardwareStatus();
-    return true;
-  }
-  if (action.equalsIgnoreCase("HW_BAT_STATUS")) {
-    printHardwareStatus();
-    return true;
-  }
-  if (action.equalsIgnoreCase("CAM_STATUS")) {
-    printCameraStatus();
-    return true;
-  }
-  if (action.equalsIgnoreCase("CAM_REC_STATUS")) {
-    printCameraRecorderStatus();
-    return true;
-  }
-  if (action.equalsIgnoreCase("CAM_UI_SHOW")) {
-    if (!g_camera_scene_active) {
-      if (out_error != nullptr) {
-        *out_error = "camera_scene_inactive";
-      }
-      return false;
+    case CommandId::kNext: {
+      return notifyScenarioButtonGuarded(5U, false, now_ms, "api_control");
     }
-    if (!ensureCameraUiInitialized()) {
-      if (out_error != nullptr) {
-        *out_error = "camera_ui_not_ready";
-      }
-      return false;
+    case CommandId::kStoryRefreshSd: {
+      return refreshStoryFromSd();
     }
-    g_camera_player.show();
-    return true;
-  }
-  if (action.equalsIgnoreCase("CAM_UI_HIDE")) {
-    if (!g_camera_scene_active || !g_camera_scene_ready) {
-      if (out_error != nullptr) {
-        *out_error = "camera_scene_inactive";
-      }
-      return false;
+    case CommandId::kWifiDisconnect: {
+      webScheduleStaDisconnect();
+      return true;
     }
-    g_camera_player.hide();
-    return true;
-  }
-  if (action.equalsIgnoreCase("CAM_UI_TOGGLE")) {
-    if (!g_camera_scene_active || !g_camera_scene_ready) {
-      if (out_error != nullptr) {
-        *out_error = "camera_scene_inactive";
+    case CommandId::kWifiForget: {
+      const bool ok = forgetWifiCredentials();
+      if (!ok && out_error != nullptr) {
+        *out_error = "wifi_forget_failed";
       }
-      return false;
+      return ok;
     }
-    g_camera_player.toggle();
-    return true;
-  }
-  if (action.equalsIgnoreCase("CAM_REC_SNAP")) {
-    if (!g_camera_scene_active || !g_camera_scene_ready) {
-      if (out_error != nullptr) {
-        *out_error = "camera_scene_inactive";
-      }
-      return false;
+    case CommandId::kWifiReconnect: {
+      return webReconnectLocalWifi();
     }
-    const bool was_frozen = g_camera_player.service().has_frozen();
-    if (!g_camera_player.handleInputAction(ui::camera::Win311CameraUI::InputAction::kSnapToggle)) {
-      if (out_error != nullptr) {
-        *out_error = "camera_snap_failed";
-      }
-      return false;
+    case CommandId::kEspnowOn: {
+      return g_network.enableEspNow();
     }
-    const bool now_frozen = g_camera_player.service().has_frozen();
-    if (!was_frozen && !now_frozen) {
-      if (out_error != nullptr) {
-        *out_error = "camera_snap_failed";
-      }
-      return false;
+    case CommandId::kEspnowOff: {
+      g_network.disableEspNow();
+      return true;
     }
-    return true;
-  }
-  if (startsWithIgnoreCase(action.c_str(), "CAM_REC_SAVE")) {
-    if (!g_camera_scene_active || !g_camera_scene_ready) {
-      if (out_error != nullptr) {
-        *out_error = "camera_scene_inactive";
+    case CommandId::kHwStatus:
+    case CommandId::kHwMicStatus:
+    case CommandId::kHwBatStatus: {
+      printHardwareStatus();
+      return true;
+    }
+    case CommandId::kHwStatusJson: {
+      printHardwareStatusJson();
+      return true;
+    }
+    case CommandId::kCamStatus: {
+      printCameraStatus();
+      return true;
+    }
+    case CommandId::kCamRecStatus: {
+      printCameraRecorderStatus();
+      return true;
+    }
+    case CommandId::kCamUiShow: {
+      if (!g_camera_scene_active) {
+        if (out_error != nullptr) {
+          *out_error = "camera_scene_inactive";
+        }
+        return false;
       }
-      return false;
+      if (!ensureCameraUiInitialized()) {
+        if (out_error != nullptr) {
+          *out_error = "camera_ui_not_ready";
+        }
+        return false;
+      }
+      g_camera_player.show();
+      return true;
     }
-    const size_t prefix_len = std::strlen("CAM_REC_SAVE");
-    String format_arg = action.substring(static_cast<unsigned int>(prefix_len));
-    ui::camera::CameraCaptureService::CaptureFormat format = ui::camera::CameraCaptureService::CaptureFormat::Auto;
-    if (!parseRecorderFormat(format_arg, &format)) {
-      if (out_error != nullptr) {
-        *out_error = "cam_rec_save_arg";
+    case CommandId::kCamUiHide: {
+      if (!g_camera_scene_active || !g_camera_scene_ready) {
+        if (out_error != nullptr) {
+          *out_error = "camera_scene_inactive";
+        }
+        return false;
       }
-      return false;
+      g_camera_player.hide();
+      return true;
     }
-    if (!g_camera_player.service().has_frozen()) {
-      if (out_error != nullptr) {
-        *out_error = "camera_not_frozen";
+    case CommandId::kCamUiToggle: {
+      if (!g_camera_scene_active || !g_camera_scene_ready) {
+        if (out_error != nullptr) {
+          *out_error = "camera_scene_inactive";
+        }
+        return false;
       }
-      return false;
+      g_camera_player.toggle();
+      return true;
     }
-    String out_path;
-    const bool ok = g_camera_player.service().save_frozen(out_path, format);
-    if (!ok && out_error != nullptr) {
-      *out_error = "camera_save_failed";
+    case CommandId::kCamRecSnap: {
+      if (!g_camera_scene_active || !g_camera_scene_ready) {
+        if (out_error != nullptr) {
+          *out_error = "camera_scene_inactive";
+        }
+        return false;
+      }
+      const bool was_frozen = g_camera_player.service().has_frozen();
+      if (!g_camera_player.handleInputAction(ui::camera::Win311CameraUI::InputAction::kSnapToggle)) {
+        if (out_error != nullptr) {
+          *out_error = "camera_snap_failed";
+        }
+        return false;
+      }
+      const bool now_frozen = g_camera_player.service().has_frozen();
+      if (!was_frozen && !now_frozen) {
+        if (out_error != nullptr) {
+          *out_error = "camera_snap_failed";
+        }
+        return false;
+      }
+      return true;
     }
-    return ok;
-  }
-  if (action.equalsIgnoreCase("CAM_REC_GALLERY")) {
-    if (!g_camera_scene_active || !g_camera_scene_ready) {
-      if (out_error != nullptr) {
-        *out_error = "camera_scene_inactive";
+    case CommandId::kCamRecSave: {
+      if (!g_camera_scene_active || !g_camera_scene_ready) {
+        if (out_error != nullptr) {
+          *out_error = "camera_scene_inactive";
+        }
+        return false;
       }
-      return false;
+      String format_arg = arg;
+      ui::camera::CameraCaptureService::CaptureFormat format = ui::camera::CameraCaptureService::CaptureFormat::Auto;
+      if (!parseRecorderFormat(format_arg, &format)) {
+        if (out_error != nullptr) {
+          *out_error = "cam_rec_save_arg";
+        }
+        return false;
+      }
+      if (!g_camera_player.service().has_frozen()) {
+        if (out_error != nullptr) {
+          *out_error = "camera_not_frozen";
+        }
+        return false;
+      }
+      String out_path;
+      const bool ok = g_camera_player.service().save_frozen(out_path, format);
+      if (!ok && out_error != nullptr) {
+        *out_error = "camera_save_failed";
+      }
+      return ok;
     }
-    return g_camera_player.handleInputAction(ui::camera::Win311CameraUI::InputAction::kGalleryToggle);
-  }
-  if (action.equalsIgnoreCase("CAM_REC_NEXT")) {
-    if (!g_camera_scene_active || !g_camera_scene_ready) {
-      if (out_error != nullptr) {
-        *out_error = "camera_scene_inactive";
+    case CommandId::kCamRecGallery: {
+      if (!g_camera_scene_active || !g_camera_scene_ready) {
+        if (out_error != nullptr) {
+          *out_error = "camera_scene_inactive";
+        }
+        return false;
       }
-      return false;
+      return g_camera_player.handleInputAction(ui::camera::Win311CameraUI::InputAction::kGalleryToggle);
     }
-    return g_camera_player.handleInputAction(ui::camera::Win311CameraUI::InputAction::kGalleryNext);
-  }
-  if (action.equalsIgnoreCase("CAM_REC_DELETE")) {
-    if (!g_camera_scene_active || !g_camera_scene_ready) {
-      if (out_error != nullptr) {
-        *out_error = "camera_scene_inactive";
+    case CommandId::kCamRecNext: {
+      if (!g_camera_scene_active || !g_camera_scene_ready) {
+        if (out_error != nullptr) {
+          *out_error = "camera_scene_inactive";
+        }
+        return false;
       }
-      return false;
+      return g_camera_player.handleInputAction(ui::camera::Win311CameraUI::InputAction::kGalleryNext);
     }
-    return g_camera_player.handleInputAction(ui::camera::Win311CameraUI::InputAction::kDeleteSelected);
-  }
-  if (action.equalsIgnoreCase("RESOURCE_STATUS")) {
-    printResourceStatus();
-    return true;
-  }
-  if (action.equalsIgnoreCase("SIMD_STATUS")) {
-    printSimdStatus();
-    return true;
-  }
-  if (action.equalsIgnoreCase("SIMD_SELFTEST")) {
-    return runtime::simd::runSelfTestCommand();
-  }
-  if (startsWithIgnoreCase(action.c_str(), "SIMD_BENCH")) {
-    uint32_t loops = 200U;
-    uint32_t pixels = 7680U;
-    const size_t prefix_len = std::strlen("SIMD_BENCH");
-    String args = action.substring(static_cast<unsigned int>(prefix_len));
-    args.trim();
-    if (!args.isEmpty()) {
-      const int sep = args.indexOf(' ');
-      String loops_text = (sep < 0) ? args : args.substring(0, static_cast<unsigned int>(sep));
-      String pixels_text = (sep < 0) ? String("") : args.substring(static_cast<unsigned int>(sep + 1));
-      loops_text.trim();
-      pixels_text.trim();
-      if (!loops_text.isEmpty()) {
-        loops = static_cast<uint32_t>(std::strtoul(loops_text.c_str(), nullptr, 10));
-      }
-      if (!pixels_text.isEmpty()) {
-        pixels = static_cast<uint32_t>(std::strtoul(pixels_text.c_str(), nullptr, 10));
-      }
-    }
-    const runtime::simd::SimdBenchResult result = runtime::simd::runBenchCommand(loops, pixels);
-    Serial.printf("SIMD_BENCH loops=%lu pixels=%lu l8_us=%lu idx_us=%lu rgb888_us=%lu gain_us=%lu\n",
-                  static_cast<unsigned long>(result.loops),
-                  static_cast<unsigned long>(result.pixels),
-                  static_cast<unsigned long>(result.l8_to_rgb565_us),
-                  static_cast<unsigned long>(result.idx8_to_rgb565_us),
-                  static_cast<unsigned long>(result.rgb888_to_rgb565_us),
-                  static_cast<unsigned long>(result.s16_gain_q15_us));
-    return true;
-  }
-  if (startsWithIgnoreCase(action.c_str(), "RESOURCE_PROFILE_AUTO")) {
-    const size_t prefix_len = std::strlen("RESOURCE_PROFILE_AUTO");
-    String profile_auto = action.substring(static_cast<unsigned int>(prefix_len));
-    profile_auto.trim();
-    bool parse_ok = false;
-    applyResourceProfileAutoCommand(profile_auto.c_str(), &parse_ok);
-    if (!parse_ok) {
-      if (out_error != nullptr) {
-        *out_error = "resource_profile_auto_arg";
+    case CommandId::kCamRecDelete: {
+      if (!g_camera_scene_active || !g_camera_scene_ready) {
+        if (out_error != nullptr) {
+          *out_error = "camera_scene_inactive";
+        }
+        return false;
       }
-      return false;
+      return g_camera_player.handleInputAction(ui::camera::Win311CameraUI::InputAction::kDeleteSelected);
     }
-    return true;
-  }
-  if (startsWithIgnoreCase(action.c_str(), "RESOURCE_PROFILE")) {
-    const size_t prefix_len = std::strlen("RESOURCE_PROFILE");
-    String profile = action.substring(static_cast<unsigned int>(prefix_len));
-    profile.trim();
-    if (profile.isEmpty()) {
+    case CommandId::kResourceStatus: {
       printResourceStatus();
       return true;
     }
-    if (!g_resource_coordinator.parseAndSetProfile(profile.c_str())) {
-      if (out_error != nullptr) {
-        *out_error = "resource_profile_arg";
-      }
-      return false;
+    case CommandId::kSimdStatus: {
+      printSimdStatus();
+      return true;
     }
-    g_resource_profile_auto = false;
-    return true;
-  }
-  if (action.equalsIgnoreCase("CAM_ON")) {
-    if (g_camera_scene_active) {
-      if (out_error != nullptr) {
-        *out_error = "camera_busy_recorder_owner";
+    case CommandId::kSimdSelftest: {
+      return runtime::simd::runSelfTestCommand();
+    }
+    case CommandId::kSimdBench: {
+      uint32_t loops = 200U;
+      uint32_t pixels = 7680U;
+      String args = arg;
+      args.trim();
+      if (!args.isEmpty()) {
+        const int sep = args.indexOf(' ');
+        String loops_text = (sep < 0) ? args : args.substring(0, static_cast<unsigned int>(sep));
+        String pixels_text = (sep < 0) ? String("") : args.substring(static_cast<unsigned int>(sep + 1));
+        loops_text.trim();
+        pixels_text.trim();
+        if (!loops_text.isEmpty()) {
+          loops = static_cast<uint32_t>(std::strtoul(loops_text.c_str(), nullptr, 10));
+        }
+        if (!pixels_text.isEmpty()) {
+          pixels = static_cast<uint32_t>(std::strtoul(pixels_text.c_str(), nullptr, 10));
+        }
       }
-      return false;
-    }
-    if (!approveCameraOperation("cam_on", out_error)) {
-      return false;
+      const runtime::simd::SimdBenchResult result = runtime::simd::runBenchCommand(loops, pixels);
+      Serial.printf("SIMD_BENCH loops=%lu pixels=%lu l8_us=%lu idx_us=%lu rgb888_us=%lu gain_us=%lu\n",
+                    static_cast<unsigned long>(result.loops),
+                    static_cast<unsigned long>(result.pixels),
+                    static_cast<unsigned long>(result.l8_to_rgb565_us),
+                    static_cast<unsigned long>(result.idx8_to_rgb565_us),
+                    static_cast<unsigned long>(result.rgb888_to_rgb565_us),
+                    static_cast<unsigned long>(result.s16_gain_q15_us));
+      return true;
     }
-    return g_camera.start();
-  }
-  if (action.equalsIgnoreCase("CAM_OFF")) {
-    if (g_camera_scene_active) {
-      if (out_error != nullptr) {
-        *out_error = "camera_busy_recorder_owner";
+    case CommandId::kResourceProfileAuto: {
+      String profile_auto = arg;
+      profile_auto.trim();
+      bool parse_ok = false;
+      applyResourceProfileAutoCommand(profile_auto.c_str(), &parse_ok);
+      if (!parse_ok) {
+        if (out_error != nullptr) {
+          *out_error = "resource_profile_auto_arg";
+        }
+        return false;
       }
-      return false;
+      return true;
     }
-    g_camera.stop();
-    return true;
-  }
-  if (action.equalsIgnoreCase("MEDIA_STOP")) {
-    return g_media.stop(&g_audio);
-  }
-  if (action.equalsIgnoreCase("REC_STOP")) {
-    return g_media.stopRecording();
-  }
-  if (action.equalsIgnoreCase("REC_STATUS")) {
-    printMediaStatus();
-    return true;
-  }
-  if (action.equalsIgnoreCase("BOOT_MODE_STATUS")) {
-    printBootModeStatus();
-    return true;
-  }
-  if (action.equalsIgnoreCase("BOOT_MODE_CLEAR")) {
-    const bool ok = g_boot_mode_store.clearMode();
-    applyStartupMode(BootModeStore::StartupMode::kStory);
-    if (!ok && out_error != nullptr) {
-      *out_error = "boot_mode_clear_failed";
+    case CommandId::kResourceProfile: {
+      String profile = arg;
+      profile.trim();
+      if (profile.isEmpty()) {
+        printResourceStatus();
+        return true;
+      }
+      if (!g_resource_coordinator.parseAndSetProfile(profile.c_str())) {
+        if (out_error != nullptr) {
+          *out_error = "resource_profile_arg";
+        }
+        return false;
+      }
+      g_resource_profile_auto = false;
+      return true;
     }
-    return ok;
-  }
-  if (startsWithIgnoreCase(action.c_str(), "BOOT_MODE_SET ")) {
-    String mode_text = action.substring(static_cast<unsigned int>(std::strlen("BOOT_MODE_SET ")));
-    mode_text.trim();
-    mode_text.toUpperCase();
-    BootModeStore::StartupMode mode = BootModeStore::StartupMode::kStory;
-    if (!parseBootModeToken(mode_text.c_str(), &mode)) {
-      if (out_error != nullptr) {
-        *out_error = "boot_mode_set_arg";
+    case CommandId::kCamOn: {
+      if (g_camera_scene_active) {
+        if (out_error != nullptr) {
+          *out_error = "camera_busy_recorder_owner";
+        }
+        return false;
       }
-      return false;
+      if (!approveCameraOperation("cam_on", out_error)) {
+        return false;
+      }
+      return g_camera.start();
     }
-    const bool ok = g_boot_mode_store.saveMode(mode);
-    if (!ok) {
-      if (out_error != nullptr) {
-        *out_error = "boot_mode_set_failed";
+    case CommandId::kCamOff: {
+      if (g_camera_scene_active) {
+        if (out_error != nullptr) {
+          *out_error = "camera_busy_recorder_owner";
+        }
+        return false;
       }
-      return false;
+      g_ui.stopQrScan();
+      g_camera.stop();
+      return true;
     }
-    applyStartupMode(mode);
-    (void)g_boot_mode_store.setMediaValidated(mode == BootModeStore::StartupMode::kMediaManager);
-    return true;
-  }
-  if (startsWithIgnoreCase(action.c_str(), "QR_SIM ")) {
-    String payload = action.substring(static_cast<unsigned int>(std::strlen("QR_SIM ")));
-    payload.trim();
-    const bool ok = !payload.isEmpty() && g_ui.simulateQrPayload(payload.c_str());
-    if (!ok && out_error != nullptr) {
-      *out_error = "qr_sim_arg";
+    case CommandId::kMediaStop: {
+      return g_media.stop(&g_audio);
     }
-    return ok;
-  }
-
-  if (startsWithIgnoreCase(action.c_str(), "WIFI_CONNECT ")) {
-    String ssid;
-    String password;
-    if (!splitSsidPass(action.c_str() + std::strlen("WIFI_CONNECT "), &ssid, &password)) {
-      return false;
+    case CommandId::kRecStop: {
+      return g_media.stopRecording();
     }
-    return g_network.connectSta(ssid.c_str(), password.c_str());
-  }
-
-  if (startsWithIgnoreCase(action.c_str(), "WIFI_PROVISION ")) {
-    String ssid;
-    String password;
-    if (!splitSsidPass(action.c_str() + std::strlen("WIFI_PROVISION "), &ssid, &password)) {
-      if (out_error != nullptr) {
-        *out_error = "wifi_provision_args";
+    case CommandId::kRecStatus: {
+      printMediaStatus();
+      return true;
+    }
+    case CommandId::kBootModeStatus: {
+      printBootModeStatus();
+      return true;
+    }
+    case CommandId::kBootModeClear: {
+      const bool ok = g_boot_mode_store.clearMode();
+      applyStartupMode(BootModeStore::StartupMode::kStory);
+      if (!ok && out_error != nullptr) {
+        *out_error = "boot_mode_clear_failed";
       }
-      return false;
+      return ok;
     }
-    bool connect_started = false;
-    bool persisted = false;
-    const bool ok = provisionWifiCredentials(ssid.c_str(), password.c_str(), true, &connect_started, &persisted, nullptr);
-    if (!ok && out_error != nullptr) {
-      *out_error = persisted ? "wifi_connect_failed" : "wifi_persist_failed";
+    case CommandId::kBootModeSet: {
+      String mode_text = arg;
+      mode_text.trim();
+      mode_text.toUpperCase();
+      BootModeStore::StartupMode mode = BootModeStore::StartupMode::kStory;
+      if (!parseBootModeToken(mode_text.c_str(), &mode)) {
+        if (out_error != nullptr) {
+          *out_error = "boot_mode_set_arg";
+        }
+        return false;
+      }
+      const bool ok = g_boot_mode_store.saveMode(mode);
+      if (!ok) {
+        if (out_error != nullptr) {
+          *out_error = "boot_mode_set_failed";
+        }
+        return false;
+      }
+      applyStartupMode(mode);
+      (void)g_boot_mode_store.setMediaValidated(mode == BootModeStore::StartupMode::kMediaManager);
+      return true;
     }
-    return ok;
-  }
-
-  if (startsWithIgnoreCase(action.c_str(), "ESPNOW_SEND ")) {
-    String args = action.substring(static_cast<unsigned int>(std::strlen("ESPNOW_SEND ")));
-    String payload;
-    if (!parseEspNowSendPayload(args.c_str(), payload, nullptr)) {
-      return false;
+    case CommandId::kQrSim: {
+      String payload = arg;
+      payload.trim();
+      const bool ok = !payload.isEmpty() && g_ui.simulateQrPayload(payload.c_str());
+      if (!ok && out_error != nullptr) {
+        *out_error = "qr_sim_arg";
+      }
+      return ok;
     }
-    return g_network.sendEspNowTarget(kEspNowBroadcastTarget, payload.c_str());
-  }
-
-  if (startsWithIgnoreCase(action.c_str(), "SC_EVENT_RAW ")) {
-    char event_name[kSerialLineCapacity] = {0};
-    copyText(event_name, sizeof(event_name), action.c_str() + std::strlen("SC_EVENT_RAW "));
-    trimAsciiInPlace(event_name);
-    if (event_name[0] == '\0') {
-      return false;
+    case CommandId::kWifiConnect: {
+      String ssid;
+      String password;
+      if (!splitSsidPass(arg.c_str(), &ssid, &password)) {
+        return false;
+      }
+      return g_network.connectSta(ssid.c_str(), password.c_str());
     }
-    return dispatchScenarioEventByName(event_name, now_ms);
-  }
-
-  if (startsWithIgnoreCase(action.c_str(), "SC_EVENT ")) {
-    char args[kSerialLineCapacity] = {0};
-    copyText(args, sizeof(args), action.c_str() + std::strlen("SC_EVENT "));
-    trimAsciiInPlace(args);
-    if (args[0] == '\0') {
-      return false;
+    case CommandId::kWifiProvision: {
+      String ssid;
+      String password;
+      if (!splitSsidPass(arg.c_str(), &ssid, &password)) {
+        if (out_error != nullptr) {
+          *out_error = "wifi_provision_args";
+        }
+        return false;
+      }
+      bool connect_started = false;
+      bool persisted = false;
+      const bool ok = provisionWifiCredentials(ssid.c_str(), password.c_str(), true, &connect_started, &persisted, nullptr);
+      if (!ok && out_error != nullptr) {
+        *out_error = persisted ? "wifi_connect_failed" : "wifi_persist_failed";
+      }
+      return ok;
     }
-    char* type_text = args;
-    char* event_name = nullptr;
-    for (size_t index = 0U; args[index] != '\0'; ++index) {
-      if (args[index] != ' ') {
-        continue;
+    case CommandId::kEspnowSend: {
+      String args = arg;
+      String payload;
+      if (!parseEspNowSendPayload(args.c_str(), payload, nullptr)) {
+        return false;
       }
-      args[index] = '\0';
-      event_name = &args[index + 1U];
-      break;
+      return g_network.sendEspNowTarget(kEspNowBroadcastTarget, payload.c_str());
     }
-    if (event_name != nullptr) {
+    case CommandId::kScEventRaw: {
+      char event_name[kSerialLineCapacity] = {0};
+      copyText(event_name, sizeof(event_name), arg.c_str());
       trimAsciiInPlace(event_name);
       if (event_name[0] == '\0') {
-        event_name = nullptr;
+        return false;
       }
+      return dispatchScenarioEventByName(event_name, now_ms);
     }
-    StoryEventType event_type = StoryEventType::kNone;
-    if (!parseEventType(type_text, &event_type)) {
-      return false;
-    }
-    return dispatchScenarioEventByType(event_type, event_name, now_ms);
-  }
-
-  if (startsWithIgnoreCase(action.c_str(), "SCENE_GOTO ")) {
-    String scene_id = action.substring(static_cast<unsigned int>(std::strlen("SCENE_GOTO ")));
-    scene_id.trim();
-    scene_id.toUpperCase();
-    if (scene_id.isEmpty()) {
-      if (out_error != nullptr) {
-        *out_error = "scene_goto_arg";
+    case CommandId::kScEvent: {
+      char args[kSerialLineCapacity] = {0};
+      copyText(args, sizeof(args), arg.c_str());
+      trimAsciiInPlace(args);
+      if (args[0] == '\0') {
+        return false;
       }
-      return false;
+      char* type_text = args;
+      char* event_name = nullptr;
+      for (size_t index = 0U; args[index] != '\0'; ++index) {
+        if (args[index] != ' ') {
+          continue;
+        }
+        args[index] = '\0';
+        event_name = &args[index + 1U];
+        break;
+      }
+      if (event_name != nullptr) {
+        trimAsciiInPlace(event_name);
+        if (event_name[0] == '\0') {
+          event_name = nullptr;
+        }
+      }
+      StoryEventType event_type = StoryEventType::kNone;
+      if (!parseEventType(type_text, &event_type)) {
+        return false;
+      }
+      return dispatchScenarioEventByType(event_type, event_name, now_ms);
     }
-    if (scene_id == "SCENE_LOCK") {
-      scene_id = "SCENE_LOCKED";
-    } else if (scene_id == "LOCKED" || scene_id == "LOCK") {
-      scene_id = "SCENE_LOCKED";
+    case CommandId::kSceneGoto: {
+      String scene_id = arg;
+      scene_id.trim();
+      scene_id.toUpperCase();
+      if (scene_id.isEmpty()) {
+        if (out_error != nullptr) {
+          *out_error = "scene_goto_arg";
+        }
+        return false;
+      }
+      if (scene_id == "SCENE_LOCK") {
+        scene_id = "SCENE_LOCKED";
+      } else if (scene_id == "LOCKED" || scene_id == "LOCK") {
+        scene_id = "SCENE_LOCKED";
+      }
+      const bool ok = g_scenario.gotoScene(scene_id.c_str(), now_ms, "scene_goto_control");
+      if (!ok) {
+        if (out_error != nullptr) {
+          *out_error = "scene_not_found";
+        }
+        return false;
+      }
+      g_step_action_gate.invalidate();
+      refreshSceneIfNeeded(true);
+      startPendingAudioIfAny();
+      return true;
     }
-    const bool ok = g_scenario.gotoScene(scene_id.c_str(), now_ms, "scene_goto_control");
-    if (!ok) {
-      if (out_error != nullptr) {
-        *out_error = "scene_not_found";
+    case CommandId::kHwLedSet: {
+      String args = arg;
+      args.trim();
+      uint8_t red = 0U;
+      uint8_t green = 0U;
+      uint8_t blue = 0U;
+      uint8_t brightness = static_cast<uint8_t>(FREENOVE_WS2812_BRIGHTNESS);
+      bool pulse = true;
+      if (!parseHwLedSetArgs(args.c_str(), &red, &green, &blue, &brightness, &pulse)) {
+        if (out_error != nullptr) {
+          *out_error = "hw_led_set_args";
+        }
+        return false;
       }
-      return false;
+      return g_hardware.setManualLed(red, green, blue, brightness, pulse);
     }
-    g_last_action_step_key[0] = '\0';
-    refreshSceneIfNeeded(true);
-    startPendingAudioIfAny();
-    return true;
-  }
-  if (action.equalsIgnoreCase("SCENE_GOTO")) {
-    if (out_error != nullptr) {
-      *out_error = "scene_goto_arg";
+    case CommandId::kHwLedAuto: {
+      String value = arg;
+      value.trim();
+      bool enabled = false;
+      if (!parseBoolToken(value.c_str(), &enabled)) {
+        if (out_error != nullptr) {
+          *out_error = "hw_led_auto_args";
+        }
+        return false;
+      }
+      g_hardware_cfg.led_auto_from_scene = enabled;
+      if (enabled) {
+        g_hardware.clearManualLed();
+        const ScenarioSnapshot snapshot = g_scenario.snapshot();
+        if (snapshot.screen_scene_id != nullptr) {
+          g_hardware.setSceneHint(snapshot.screen_scene_id);
+        }
+      }
+      return true;
     }
-    return false;
-  }
-
-  if (startsWithIgnoreCase(action.c_str(), "HW_LED_SET ")) {
-    String args = action.substring(static_cast<unsigned int>(std::strlen("HW_LED_SET ")));
-    args.trim();
-    uint8_t red = 0U;
-    uint8_t green = 0U;
-    uint8_t blue = 0U;
-    uint8_t brightness = static_cast<uint8_t>(FREENOVE_WS2812_BRIGHTNESS);
-    bool pulse = true;
-    if (!parseHwLedSetArgs(args.c_str(), &red, &green, &blue, &brightness, &pulse)) {
-      if (out_error != nullptr) {
-        *out_error = "hw_led_set_args";
+    case CommandId::kLcdBacklight: {
+      String value = arg;
+      value.trim();
+      if (value.isEmpty()) {
+        Serial.printf("LCD_BACKLIGHT level=%u\n", static_cast<unsigned int>(g_lcd_backlight_level));
+        return true;
       }
-      return false;
+      const int parsed = value.toInt();
+      if (parsed < 0 || parsed > 255) {
+        if (out_error != nullptr) {
+          *out_error = "lcd_backlight_range";
+        }
+        return false;
+      }
+      applyLcdBacklight(static_cast<uint8_t>(parsed));
+      Serial.printf("LCD_BACKLIGHT level=%u\n", static_cast<unsigned int>(g_lcd_backlight_level));
+      return true;
     }
-    return g_hardware.setManualLed(red, green, blue, brightness, pulse);
-  }
-
-  if (startsWithIgnoreCase(action.c_str(), "HW_LED_AUTO ")) {
-    String value = action.substring(static_cast<unsigned int>(std::strlen("HW_LED_AUTO ")));
-    value.trim();
-    bool enabled = false;
-    if (!parseBoolToken(value.c_str(), &enabled)) {
-      if (out_error != nullptr) {
-        *out_error = "hw_led_auto_args";
+    case CommandId::kCamSnapshot: {
+      if (g_camera_scene_active) {
+        if (out_error != nullptr) {
+          *out_error = "camera_busy_recorder_owner";
+        }
+        return false;
       }
-      return false;
+      if (!approveCameraOperation("cam_snapshot", out_error)) {
+        return false;
+      }
+      String filename = arg;
+      filename.trim();
+      String out_path;
+      const bool ok = g_camera.snapshotToFile(filename.isEmpty() ? nullptr : filename.c_str(), &out_path);
+      if (ok) {
+        dispatchScenarioEventByName("SERIAL:CAMERA_CAPTURED", now_ms);
+      } else if (out_error != nullptr) {
+        *out_error = "camera_snapshot_failed";
+      }
+      return ok;
     }
-    g_hardware_cfg.led_auto_from_scene = enabled;
-    if (enabled) {
-      g_hardware.clearManualLed();
-      const ScenarioSnapshot snapshot = g_scenario.snapshot();
-      if (snapshot.screen_scene_id != nullptr) {
-        g_hardware.setSceneHint(snapshot.screen_scene_id);
+    case CommandId::kMediaPlay: {
+      String media_path = arg;
+      media_path.trim();
+      const bool ok = !media_path.isEmpty() && g_media.play(media_path.c_str(), &g_audio);
+      if (!ok && out_error != nullptr) {
+        *out_error = "media_play_failed";
       }
+      return ok;
     }
-    return true;
-  }
-
-  if (startsWithIgnoreCase(action.c_str(), "LCD_BACKLIGHT ")) {
-    String value = action.substring(static_cast<unsigned int>(std::strlen("LCD_BACKLIGHT ")));
-    value.trim();
-    if (value.isEmpty()) {
-      if (out_error != nullptr) {
-        *out_error = "lcd_backlight_arg";
+    case CommandId::kRecStart: {
+      String args = arg;
+      args.trim();
+      uint16_t seconds = g_media_cfg.record_max_seconds;
+      String filename;
+      if (!args.isEmpty()) {
+        const int sep = args.indexOf(' ');
+        String seconds_text = (sep < 0) ? args : args.substring(0, static_cast<unsigned int>(sep));
+        filename = (sep < 0) ? String("") : args.substring(static_cast<unsigned int>(sep + 1));
+        seconds_text.trim();
+        filename.trim();
+        if (!seconds_text.isEmpty()) {
+          char* end = nullptr;
+          const unsigned long parsed = std::strtoul(seconds_text.c_str(), &end, 10);
+          if (end != seconds_text.c_str() && (end == nullptr || *end == '\0')) {
+            seconds = static_cast<uint16_t>(parsed);
+          }
+        }
       }
-      return false;
+      return g_media.startRecording(seconds, filename.isEmpty() ? nullptr : filename.c_str());
     }
-    const int parsed = value.toInt();
-    if (parsed < 0 || parsed > 255) {
-      if (out_error != nullptr) {
-        *out_error = "lcd_backlight_range";
+    case CommandId::kMediaList: {
+      String kind = arg;
+      kind.trim();
+      if (kind.isEmpty()) {
+        kind = "music";
       }
-      return false;
+      String files_json;
+      const bool ok = g_media.listFiles(kind.c_str(), &files_json);
+      if (ok) {
+        Serial.printf("MEDIA_LIST kind=%s files=%s\n", kind.c_str(), files_json.c_str());
+      }
+      return ok;
     }
-    applyLcdBacklight(static_cast<uint8_t>(parsed));
-    Serial.printf("LCD_BACKLIGHT level=%u\n", static_cast<unsigned int>(g_lcd_backlight_level));
-    return true;
+    default:
+      break;
   }
-
-  if (action.equalsIgnoreCase("LCD_BACKLIGHT")) {
-    Serial.printf("LCD_BACKLIGHT level=%u\n", static_cast<unsigned int>(g_lcd_backlight_level));
-    return true;
+  if (out_error != nullptr) {
+    *out_error = "unsupported_action";
   }
+  return false;
+}
 
-  if (startsWithIgnoreCase(action.c_str(), "CAM_SNAPSHOT")) {
-    if (g_camera_scene_active) {
-      if (out_error != nullptr) {
-        *out_error = "camera_busy_recorder_owner";
-      }
-      return false;
-    }
-    if (!approveCameraOperation("cam_snapshot", out_error)) {
-      return false;
-    }
-    const size_t prefix_len = std::strlen("CAM_SNAPSHOT");
-    String filename = action.substring(static_cast<unsigned int>(prefix_len));
-    filename.trim();
-    String out_path;
-    const bool ok = g_camera.snapshotToFile(filename.isEmpty() ? nullptr : filename.c_str(), &out_path);
-    if (ok) {
-      dispatchScenarioEventByName("SERIAL:CAMERA_CAPTURED", now_ms);
-    } else if (out_error != nullptr) {
-      *out_error = "camera_snapshot_failed";
-    }
-    return ok;
+bool dispatchControlActionImpl(const String& action_raw, uint32_t now_ms, String* out_error) {
+  if (out_error != nullptr) {
+    out_error->remove(0);
   }
-
-  if (startsWithIgnoreCase(action.c_str(), "MEDIA_PLAY ")) {
-    String media_path = action.substring(static_cast<unsigned int>(std::strlen("MEDIA_PLAY ")));
-    media_path.trim();
-    const bool ok = !media_path.isEmpty() && g_media.play(media_path.c_str(), &g_audio);
-    if (!ok && out_error != nullptr) {
-      *out_error = "media_play_failed";
+  String action = action_raw;
+  action.trim();
+  if (action.isEmpty()) {
+    if (out_error != nullptr) {
+      *out_error = "empty_action";
     }
-    return ok;
+    return false;
   }
 
-  if (startsWithIgnoreCase(action.c_str(), "REC_START")) {
-    const size_t prefix_len = std::strlen("REC_START");
-    String args = action.substring(static_cast<unsigned int>(prefix_len));
-    args.trim();
-    uint16_t seconds = g_media_cfg.record_max_seconds;
-    String filename;
-    if (!args.isEmpty()) {
-      const int sep = args.indexOf(' ');
-      String seconds_text = (sep < 0) ? args : args.substring(0, static_cast<unsigned int>(sep));
-      filename = (sep < 0) ? String("") : args.substring(static_cast<unsigned int>(sep + 1));
-      seconds_text.trim();
-      filename.trim();
-      if (!seconds_text.isEmpty()) {
-        char* end = nullptr;
-        const unsigned long parsed = std::strtoul(seconds_text.c_str(), &end, 10);
-        if (end != seconds_text.c_str() && (end == nullptr || *end == '\0')) {
-          seconds = static_cast<uint16_t>(parsed);
-        }
+  const char* args_text = nullptr;
+  const CommandId id = CommandRegistry::parse(action.c_str(), CommandTransport::kControl, &args_text);
+  const String arg = (args_text != nullptr) ? String(args_text) : String();
+  CommandRegistry& registry = commandRegistry();
+  const uint32_t started_us = registry.beginCall();
+  bool ok = false;
+  if (id != CommandId::kUnknown && !CommandRegistry::acceptsArgs(id, !arg.isEmpty())) {
+    if (out_error != nullptr) {
+      if (arg.isEmpty()) {
+        *out_error = CommandRegistry::name(id);
+        out_error->toLowerCase();
+        *out_error += "_arg";
+      } else {
+        *out_error = "unsupported_action";
       }
     }
-    return g_media.startRecording(seconds, filename.isEmpty() ? nullptr : filename.c_str());
-  }
-
-  if (startsWithIgnoreCase(action.c_str(), "MEDIA_LIST ")) {
-    String kind = action.substring(static_cast<unsigned int>(std::strlen("MEDIA_LIST ")));
-    kind.trim();
-    if (kind.isEmpty()) {
-      kind = "music";
-    }
-    String files_json;
-    const bool ok = g_media.listFiles(kind.c_str(), &files_json);
-    if (ok) {
-      Serial.printf("MEDIA_LIST kind=%s files=%s\n", kind.c_str(), files_json.c_str());
-    }
-    return ok;
-  }
-
-  if (out_error != nullptr) {
-    *out_error = "unsupported_action";
+  } else {
+    ok = runControlAction(id, arg, now_ms, out_error);
   }
-  return false;
+  registry.endCall(id, CommandTransport::kControl, started_us, ok);
+  return ok;
 }
 
 bool webDispatchAction(const String& action_raw) {
@@ -5367,6 +5518,10 @@ void setupWebUiImpl() {
     webSendHardwareStatus();
   });
 
+  webOnApi("/api/commands", HTTP_GET, []() {
+    webSendCommandStats();
+  });
+
   webOnApi("/api/hardware/led", HTTP_POST, []() {
     int red = g_web_server.arg("r").toInt();
     int green = g_web_server.arg("g").toInt();
@@ -5463,6 +5618,7 @@ void setupWebUiImpl() {
       g_web_server.send(409, "application/json", "{\"ok\":false,\"error\":\"camera_busy_recorder_owner\"}");
       return;
     }
+    g_ui.stopQrScan();
     g_camera.stop();
     webSendResult("CAM_OFF", true);
   });
@@ -6131,7 +6287,7 @@ void refreshSceneIfNeededImpl(bool force_render) {
   }
 
   const char* step_id = (snapshot.step != nullptr && snapshot.step->id != nullptr) ? snapshot.step->id : "n/a";
-  String screen_payload = g_storage.loadScenePayloadById(snapshot.screen_scene_id);
+  StoryContentView screen_payload = g_storage.loadScenePayloadView(snapshot.screen_scene_id);
   if (warning_scene_transition) {
     logLoopStackWatermark("after_load_payload", snapshot.screen_scene_id);
   }
@@ -6140,12 +6296,12 @@ void refreshSceneIfNeededImpl(bool force_render) {
   if (kForceTestLabSceneLock) {
     render_scene_id = kTestLabSceneId;
     render_step_id = kTestLabLockStepId;
-    const String test_lab_payload = g_storage.loadScenePayloadById(kTestLabSceneId);
-    if (!test_lab_payload.isEmpty()) {
+    const StoryContentView test_lab_payload = g_storage.loadScenePayloadView(kTestLabSceneId);
+    if (!test_lab_payload.empty()) {
       screen_payload = test_lab_payload;
     }
   }
-  if ((render_scene_id != nullptr) && render_scene_id[0] != '\0' && screen_payload.isEmpty()) {
+  if ((render_scene_id != nullptr) && render_scene_id[0] != '\0' && screen_payload.empty()) {
     ZACUS_RL_LOG_MS(6000U,
                     "[UI] missing scene payload scenario=%s step=%s screen=%s\n",
                     scenarioIdFromSnapshot(snapshot),
@@ -6169,7 +6325,7 @@ void refreshSceneIfNeededImpl(bool force_render) {
   frame.step_id = render_step_id;
   frame.audio_pack_id = snapshot.audio_pack_id;
   frame.audio_playing = g_audio.isPlaying();
-  frame.screen_payload_json = screen_payload.isEmpty() ? nullptr : screen_payload.c_str();
+  frame.screen_payload_json = screen_payload.empty() ? nullptr : screen_payload.c_str();
   g_ui.submitSceneFrame(frame);
   if (warning_scene_transition) {
     logLoopStackWatermark("after_submit_scene", snapshot.screen_scene_id);
@@ -6292,844 +6448,893 @@ void startPendingAudioIfAny() {
   g_scenario.notifyAudioDone(millis());
 }
 
-void handleSerialCommandImpl(const char* command_line, uint32_t now_ms) {
-  if (command_line == nullptr || command_line[0] == '\0') {
-    return;
-  }
-
-  char command[kSerialLineCapacity] = {0};
-  std::strncpy(command, command_line, kSerialLineCapacity - 1U);
-  char* argument = nullptr;
-  for (size_t index = 0; index < kSerialLineCapacity && command[index] != '\0'; ++index) {
-    if (command[index] == ' ') {
-      command[index] = '\0';
-      argument = &command[index + 1U];
-      break;
+void runSerialCommand(CommandId id, char* argument, const char* command_line, uint32_t now_ms) {
+  switch (id) {
+    case CommandId::kPing: {
+      Serial.println("PONG");
+      return;
+    }
+    case CommandId::kHelp: {
+      commandRegistry().printHelp();
+      return;
+    }
+    case CommandId::kStatus: {
+      printRuntimeStatus();
+      return;
+    }
+    case CommandId::kUiGfxStatus: {
+      g_ui.dumpStatus(UiStatusTopic::kGraphics);
+      return;
+    }
+    case CommandId::kUiMemStatus: {
+      g_ui.dumpStatus(UiStatusTopic::kMemory);
+      return;
+    }
+    case CommandId::kUiSceneStatus: {
+      printUiSceneStatus();
+      return;
     }
-  }
-  while (argument != nullptr && *argument == ' ') {
-    ++argument;
-  }
-  if (argument != nullptr && *argument == '\0') {
-    argument = nullptr;
-  }
-
-  if (std::strcmp(command, "PING") == 0) {
-    Serial.println("PONG");
-    return;
-  }
-  if (std::strcmp(command, "HELP") == 0) {
-    Serial.println(
-        "CMDS PING STATUS BTN_READ NEXT UNLOCK RESET "
-        "SC_LIST SC_LOAD <id> SCENE_GOTO <scene_id> SC_COVERAGE SC_REVALIDATE SC_REVALIDATE_ALL SC_EVENT <type> [name] "
-        "SC_EVENT_RAW <name> "
-        "STORY_DEBUG_BYPASS <ON|OFF> "
-        "STORY_REFRESH_SD STORY_SD_STATUS "
-        "UI_GFX_STATUS UI_MEM_STATUS UI_SCENE_STATUS PERF_STATUS PERF_RESET RESOURCE_STATUS RESOURCE_PROFILE <gfx_focus|gfx_plus_mic|gfx_plus_cam_snapshot> RESOURCE_PROFILE_AUTO <on|off> "
-        "SIMD_STATUS SIMD_SELFTEST SIMD_BENCH [loops] [pixels] "
-        "HW_STATUS HW_STATUS_JSON HW_LED_SET <r> <g> <b> [brightness] [pulse] HW_LED_AUTO <ON|OFF> HW_MIC_STATUS HW_BAT_STATUS "
-        "LCD_BACKLIGHT [0..255] "
-        "MIC_TUNER_STATUS [ON|OFF|<period_ms>] "
-        "CAM_STATUS CAM_ON CAM_OFF CAM_SNAPSHOT [filename] "
-        "CAM_UI_SHOW CAM_UI_HIDE CAM_UI_TOGGLE CAM_REC_SNAP CAM_REC_SAVE [auto|bmp|jpg|raw] CAM_REC_GALLERY CAM_REC_NEXT CAM_REC_DELETE CAM_REC_STATUS "
-        "QR_SIM <payload> "
-        "MEDIA_LIST <picture|music|recorder> MEDIA_PLAY <path> MEDIA_STOP REC_START [seconds] [filename] REC_STOP REC_STATUS "
-        "BOOT_MODE_STATUS BOOT_MODE_SET <STORY|MEDIA_MANAGER> BOOT_MODE_CLEAR "
-        "NET_STATUS WIFI_STATUS WIFI_TEST WIFI_STA <ssid> <pass> WIFI_CONNECT <ssid> <pass> WIFI_PROVISION <ssid> <pass> WIFI_FORGET WIFI_DISCONNECT "
-        "AUTH_STATUS AUTH_TOKEN_ROTATE [token] "
-        "WIFI_AP_ON [ssid] [pass] WIFI_AP_OFF "
-        "ESPNOW_ON ESPNOW_OFF ESPNOW_STATUS ESPNOW_STATUS_JSON ESPNOW_DISCOVERY ESPNOW_DISCOVERY_RUNTIME [on|off] "
-        "ESPNOW_DEVICE_NAME_GET ESPNOW_DEVICE_NAME_SET <name> "
-        "ESPNOW_PEER_ADD <mac> ESPNOW_PEER_DEL <mac> ESPNOW_PEER_LIST "
-        "ESPNOW_SEND <text|json> "
-        "AMP_SHOW AMP_HIDE AMP_TOGGLE AMP_SCAN AMP_PLAY <idx|path> AMP_NEXT AMP_PREV AMP_STOP AMP_STATUS "
-        "AUDIO_TEST AUDIO_TEST_FS AUDIO_PROFILE <idx> AUDIO_FX <idx> AUDIO_STATUS VOL <0..21> AUDIO_STOP STOP");
-    return;
-  }
-  if (std::strcmp(command, "STATUS") == 0) {
-    printRuntimeStatus();
-    return;
-  }
-  if (std::strcmp(command, "UI_GFX_STATUS") == 0) {
-    g_ui.dumpStatus(UiStatusTopic::kGraphics);
-    return;
-  }
-  if (std::strcmp(command, "UI_MEM_STATUS") == 0) {
-    g_ui.dumpStatus(UiStatusTopic::kMemory);
-    return;
-  }
-  if (std::strcmp(command, "UI_SCENE_STATUS") == 0) {
-    printUiSceneStatus();
-    return;
-  }
 #if defined(USE_AUDIO) && (USE_AUDIO != 0)
-  if (std::strcmp(command, "AMP_STATUS") == 0) {
-    printAmpStatus();
-    return;
-  }
-  if (std::strcmp(command, "AMP_SHOW") == 0) {
-    const bool ok = ensureAmpInitialized();
-    if (ok) {
-      g_amp_player.show();
+    case CommandId::kAmpStatus: {
+      printAmpStatus();
+      return;
     }
-    Serial.printf("ACK AMP_SHOW ok=%u\n", ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "AMP_HIDE") == 0) {
-    const bool ok = ensureAmpInitialized();
-    if (ok) {
-      g_amp_player.hide();
+    case CommandId::kAmpShow: {
+      const bool ok = ensureAmpInitialized();
+      if (ok) {
+        g_amp_player.show();
+      }
+      Serial.printf("ACK AMP_SHOW ok=%u\n", ok ? 1U : 0U);
+      return;
     }
-    Serial.printf("ACK AMP_HIDE ok=%u\n", ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "AMP_TOGGLE") == 0) {
-    const bool ok = ensureAmpInitialized();
-    if (ok) {
-      g_amp_player.toggle();
+    case CommandId::kAmpHide: {
+      const bool ok = ensureAmpInitialized();
+      if (ok) {
+        g_amp_player.hide();
+      }
+      Serial.printf("ACK AMP_HIDE ok=%u\n", ok ? 1U : 0U);
+      return;
     }
-    Serial.printf("ACK AMP_TOGGLE ok=%u\n", ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "AMP_SCAN") == 0) {
-    const size_t count = scanAmpPlaylistWithFallback();
-    Serial.printf("ACK AMP_SCAN tracks=%u base=%s\n",
-                  static_cast<unsigned int>(count),
-                  g_amp_base_dir);
-    return;
-  }
-  if (std::strcmp(command, "AMP_PLAY") == 0) {
-    if (!ensureAmpInitialized()) {
-      Serial.println("ERR AMP_NOT_READY");
+    case CommandId::kAmpToggle: {
+      const bool ok = ensureAmpInitialized();
+      if (ok) {
+        g_amp_player.toggle();
+      }
+      Serial.printf("ACK AMP_TOGGLE ok=%u\n", ok ? 1U : 0U);
       return;
     }
-    if (argument == nullptr || argument[0] == '\0') {
-      g_amp_player.service().playIndex(g_amp_player.service().currentIndex());
-      Serial.println("ACK AMP_PLAY current");
+    case CommandId::kAmpScan: {
+      const size_t count = scanAmpPlaylistWithFallback();
+      Serial.printf("ACK AMP_SCAN tracks=%u base=%s\n",
+                    static_cast<unsigned int>(count),
+                    g_amp_base_dir);
       return;
     }
-    char arg_text[kSerialLineCapacity] = {0};
-    copyText(arg_text, sizeof(arg_text), argument);
-    trimAsciiInPlace(arg_text);
-    if (arg_text[0] == '\0') {
-      g_amp_player.service().playIndex(g_amp_player.service().currentIndex());
-      Serial.println("ACK AMP_PLAY current");
+    case CommandId::kAmpPlay: {
+      if (!ensureAmpInitialized()) {
+        Serial.println("ERR AMP_NOT_READY");
+        return;
+      }
+      if (argument == nullptr || argument[0] == '\0') {
+        g_amp_player.service().playIndex(g_amp_player.service().currentIndex());
+        Serial.println("ACK AMP_PLAY current");
+        return;
+      }
+      char arg_text[kSerialLineCapacity] = {0};
+      copyText(arg_text, sizeof(arg_text), argument);
+      trimAsciiInPlace(arg_text);
+      if (arg_text[0] == '\0') {
+        g_amp_player.service().playIndex(g_amp_player.service().currentIndex());
+        Serial.println("ACK AMP_PLAY current");
+        return;
+      }
+      bool numeric = true;
+      for (size_t i = 0U; arg_text[i] != '\0'; ++i) {
+        if (!std::isdigit(static_cast<unsigned char>(arg_text[i]))) {
+          numeric = false;
+          break;
+        }
+      }
+      if (numeric) {
+        const unsigned long index = std::strtoul(arg_text, nullptr, 10);
+        g_amp_player.service().playIndex(static_cast<size_t>(index));
+        Serial.printf("ACK AMP_PLAY idx=%lu\n", index);
+      } else {
+        g_amp_player.service().playPath(arg_text);
+        Serial.printf("ACK AMP_PLAY path=%s\n", arg_text);
+      }
+      return;
+    }
+    case CommandId::kAmpNext: {
+      if (!ensureAmpInitialized()) {
+        Serial.println("ERR AMP_NOT_READY");
+        return;
+      }
+      g_amp_player.service().next();
+      Serial.println("ACK AMP_NEXT");
+      return;
+    }
+    case CommandId::kAmpPrev: {
+      if (!ensureAmpInitialized()) {
+        Serial.println("ERR AMP_NOT_READY");
+        return;
+      }
+      g_amp_player.service().prev();
+      Serial.println("ACK AMP_PREV");
+      return;
+    }
+    case CommandId::kAmpStop: {
+      if (!ensureAmpInitialized()) {
+        Serial.println("ERR AMP_NOT_READY");
+        return;
+      }
+      g_amp_player.service().stop();
+      Serial.println("ACK AMP_STOP");
+      return;
+    }
+#endif
+    case CommandId::kPerfStatus: {
+      perfMonitor().dumpStatus();
+      return;
+    }
+    case CommandId::kPerfReset: {
+      perfMonitor().reset();
+      Serial.println("ACK PERF_RESET");
+      return;
+    }
+    case CommandId::kCmdStatus: {
+      commandRegistry().dumpStatus();
+      return;
+    }
+    case CommandId::kCmdReset: {
+      commandRegistry().resetStats();
+      Serial.println("ACK CMD_RESET");
+      return;
+    }
+    case CommandId::kResourceStatus: {
+      printResourceStatus();
+      return;
+    }
+    case CommandId::kResourceProfile: {
+      if (argument == nullptr || argument[0] == '\0') {
+        printResourceStatus();
+        return;
+      }
+      char profile_arg[48] = {0};
+      copyText(profile_arg, sizeof(profile_arg), argument);
+      trimAsciiInPlace(profile_arg);
+      if (!g_resource_coordinator.parseAndSetProfile(profile_arg)) {
+        Serial.println("ERR RESOURCE_PROFILE_ARG");
+        return;
+      }
+      g_resource_profile_auto = false;
+      Serial.printf("ACK RESOURCE_PROFILE profile=%s\n", g_resource_coordinator.profileName());
+      printResourceStatus();
+      return;
+    }
+    case CommandId::kResourceProfileAuto: {
+      if (argument == nullptr || argument[0] == '\0') {
+        Serial.printf("ERR RESOURCE_PROFILE_AUTO_ARG arg=%s\n", argument == nullptr ? "missing" : "empty");
+        return;
+      }
+      char profile_auto_arg[24] = {0};
+      copyText(profile_auto_arg, sizeof(profile_auto_arg), argument);
+      trimAsciiInPlace(profile_auto_arg);
+      bool parse_ok = false;
+      applyResourceProfileAutoCommand(profile_auto_arg, &parse_ok);
+      if (!parse_ok) {
+        Serial.println("ERR RESOURCE_PROFILE_AUTO_ARG");
+        return;
+      }
+      Serial.printf("ACK RESOURCE_PROFILE_AUTO profile=%s auto=%u\n",
+                    g_resource_coordinator.profileName(),
+                    g_resource_profile_auto ? 1U : 0U);
+      printResourceStatus();
+      return;
+    }
+    case CommandId::kSimdStatus: {
+      printSimdStatus();
+      return;
+    }
+    case CommandId::kSimdSelftest: {
+      const bool ok = runtime::simd::runSelfTestCommand();
+      Serial.printf("ACK SIMD_SELFTEST ok=%u\n", ok ? 1U : 0U);
+      printSimdStatus();
+      return;
+    }
+    case CommandId::kSimdBench: {
+      uint32_t loops = 200U;
+      uint32_t pixels = 7680U;
+      if (argument != nullptr && argument[0] != '\0') {
+        char args[40] = {0};
+        copyText(args, sizeof(args), argument);
+        trimAsciiInPlace(args);
+        char* second = std::strchr(args, ' ');
+        if (second != nullptr) {
+          *second = '\0';
+          ++second;
+          while (*second == ' ') {
+            ++second;
+          }
+        }
+        if (args[0] != '\0') {
+          loops = static_cast<uint32_t>(std::strtoul(args, nullptr, 10));
+        }
+        if (second != nullptr && second[0] != '\0') {
+          pixels = static_cast<uint32_t>(std::strtoul(second, nullptr, 10));
+        }
+      }
+      const runtime::simd::SimdBenchResult result = runtime::simd::runBenchCommand(loops, pixels);
+      Serial.printf("SIMD_BENCH loops=%lu pixels=%lu l8_us=%lu idx_us=%lu rgb888_us=%lu gain_us=%lu\n",
+                    static_cast<unsigned long>(result.loops),
+                    static_cast<unsigned long>(result.pixels),
+                    static_cast<unsigned long>(result.l8_to_rgb565_us),
+                    static_cast<unsigned long>(result.idx8_to_rgb565_us),
+                    static_cast<unsigned long>(result.rgb888_to_rgb565_us),
+                    static_cast<unsigned long>(result.s16_gain_q15_us));
+      printSimdStatus();
+      return;
+    }
+    case CommandId::kBtnRead: {
+      printButtonRead();
+      return;
+    }
+    case CommandId::kNext: {
+      const bool ok = notifyScenarioButtonGuarded(5U, false, now_ms, "serial_next");
+      Serial.printf("ACK NEXT ok=%u\n", ok ? 1U : 0U);
+      return;
+    }
+    case CommandId::kUnlock: {
+      const bool ok = dispatchScenarioEventByName("UNLOCK", now_ms);
+      Serial.printf("ACK UNLOCK ok=%u\n", ok ? 1U : 0U);
+      return;
+    }
+    case CommandId::kReset: {
+      g_audio.stop();
+#if defined(USE_AUDIO) && (USE_AUDIO != 0)
+      if (g_amp_ready) {
+        g_amp_player.service().stop();
+      }
+#endif
+      (void)g_media.stop(&g_audio);
+      g_scenario.reset();
+      if (g_boot_media_manager_mode) {
+        (void)g_scenario.gotoScene(kMediaManagerSceneId, now_ms, "boot_mode_media_manager_reset");
+      }
+      g_step_action_gate.invalidate();
+      refreshSceneIfNeeded(true);
+      startPendingAudioIfAny();
+      Serial.println("ACK RESET");
       return;
     }
-    bool numeric = true;
-    for (size_t i = 0U; arg_text[i] != '\0'; ++i) {
-      if (!std::isdigit(static_cast<unsigned char>(arg_text[i]))) {
-        numeric = false;
-        break;
+    case CommandId::kStoryDebugBypass: {
+      if (argument == nullptr || argument[0] == '\0') {
+        Serial.printf("ACK STORY_DEBUG_BYPASS enabled=%u\n", g_scenario.debugTransitionBypassEnabled() ? 1U : 0U);
+        return;
       }
-    }
-    if (numeric) {
-      const unsigned long index = std::strtoul(arg_text, nullptr, 10);
-      g_amp_player.service().playIndex(static_cast<size_t>(index));
-      Serial.printf("ACK AMP_PLAY idx=%lu\n", index);
-    } else {
-      g_amp_player.service().playPath(arg_text);
-      Serial.printf("ACK AMP_PLAY path=%s\n", arg_text);
-    }
-    return;
-  }
-  if (std::strcmp(command, "AMP_NEXT") == 0) {
-    if (!ensureAmpInitialized()) {
-      Serial.println("ERR AMP_NOT_READY");
+      bool enabled = false;
+      if (!parseBoolToken(argument, &enabled)) {
+        Serial.println("ERR STORY_DEBUG_BYPASS_ARG");
+        return;
+      }
+      g_scenario.setDebugTransitionBypassEnabled(enabled, "serial");
+      Serial.printf("ACK STORY_DEBUG_BYPASS enabled=%u\n", enabled ? 1U : 0U);
       return;
     }
-    g_amp_player.service().next();
-    Serial.println("ACK AMP_NEXT");
-    return;
-  }
-  if (std::strcmp(command, "AMP_PREV") == 0) {
-    if (!ensureAmpInitialized()) {
-      Serial.println("ERR AMP_NOT_READY");
+    case CommandId::kScList: {
+      printScenarioList();
       return;
     }
-    g_amp_player.service().prev();
-    Serial.println("ACK AMP_PREV");
-    return;
-  }
-  if (std::strcmp(command, "AMP_STOP") == 0) {
-    if (!ensureAmpInitialized()) {
-      Serial.println("ERR AMP_NOT_READY");
+    case CommandId::kScLoad: {
+      if (argument == nullptr) {
+        Serial.println("ERR SC_LOAD_ARG");
+        return;
+      }
+      char scenario_id[kSerialLineCapacity] = {0};
+      std::strncpy(scenario_id, argument, sizeof(scenario_id) - 1U);
+      toUpperAsciiInPlace(scenario_id);
+      String load_source;
+      String load_path;
+      const bool ok = loadScenarioByIdPreferStoryFile(scenario_id, &load_source, &load_path);
+      Serial.printf("ACK SC_LOAD id=%s ok=%u\n", scenario_id, ok ? 1U : 0U);
+      if (ok) {
+        if (!load_path.isEmpty()) {
+          Serial.printf("[SCENARIO] load source=%s path=%s\n", load_source.c_str(), load_path.c_str());
+        } else {
+          Serial.printf("[SCENARIO] load source=%s id=%s\n", load_source.c_str(), scenario_id);
+        }
+      }
+      if (ok) {
+        g_step_action_gate.invalidate();
+        refreshSceneIfNeeded(true);
+        startPendingAudioIfAny();
+      }
       return;
     }
-    g_amp_player.service().stop();
-    Serial.println("ACK AMP_STOP");
-    return;
-  }
-#endif
-  if (std::strcmp(command, "PERF_STATUS") == 0) {
-    perfMonitor().dumpStatus();
-    return;
-  }
-  if (std::strcmp(command, "PERF_RESET") == 0) {
-    perfMonitor().reset();
-    Serial.println("ACK PERF_RESET");
-    return;
-  }
-  if (std::strcmp(command, "RESOURCE_STATUS") == 0) {
-    printResourceStatus();
-    return;
-  }
-  if (std::strcmp(command, "RESOURCE_PROFILE") == 0) {
-    if (argument == nullptr || argument[0] == '\0') {
-      printResourceStatus();
+    case CommandId::kStoryRefreshSd: {
+      const bool ok = refreshStoryFromSd();
+      Serial.printf("ACK STORY_REFRESH_SD ok=%u\n", ok ? 1U : 0U);
       return;
     }
-    char profile_arg[48] = {0};
-    copyText(profile_arg, sizeof(profile_arg), argument);
-    trimAsciiInPlace(profile_arg);
-    if (!g_resource_coordinator.parseAndSetProfile(profile_arg)) {
-      Serial.println("ERR RESOURCE_PROFILE_ARG");
+    case CommandId::kStorySdStatus: {
+      const StorageManager::VerifyStats verify = g_storage.verifyStats();
+      Serial.printf("STORY_SD_STATUS ready=%u verify_files=%lu hashed=%lu cached=%lu failed=%lu pending=%u sweep=%u sweep_ms=%lu\n",
+                    g_storage.hasSdCard() ? 1U : 0U,
+                    static_cast<unsigned long>(verify.files),
+                    static_cast<unsigned long>(verify.hashed),
+                    static_cast<unsigned long>(verify.cached),
+                    static_cast<unsigned long>(verify.failed),
+                    static_cast<unsigned int>(verify.pending),
+                    verify.sweep_active ? 1U : 0U,
+                    static_cast<unsigned long>(verify.last_sweep_ms));
+      const StorageManager::SyncStats sync = g_storage.syncStats();
+      Serial.printf("STORY_SD_SYNC active=%u resumed=%u planned=%u copied=%u skipped=%u failed=%u bytes=%lu kbps=%lu ms=%lu blocked_max_us=%lu blocked_ms=%lu\n",
+                    sync.active ? 1U : 0U,
+                    sync.resumed ? 1U : 0U,
+                    static_cast<unsigned int>(sync.planned),
+                    static_cast<unsigned int>(sync.copied),
+                    static_cast<unsigned int>(sync.skipped),
+                    static_cast<unsigned int>(sync.failed),
+                    static_cast<unsigned long>(sync.bytes_copied),
+                    static_cast<unsigned long>(sync.kbps),
+                    static_cast<unsigned long>(sync.elapsed_ms),
+                    static_cast<unsigned long>(sync.blocked_max_us),
+                    static_cast<unsigned long>(sync.blocked_total_ms));
+      const StorageManager::ContentCacheStats cache = g_storage.contentCacheStats();
+      const StoryContentCache::KindStats& scene = cache.kinds[static_cast<size_t>(StoryContentKind::kScene)];
+      const StoryContentCache::KindStats& audio = cache.kinds[static_cast<size_t>(StoryContentKind::kAudioMap)];
+      const StoryContentCache::KindStats& json = cache.kinds[static_cast<size_t>(StoryContentKind::kStoryJson)];
+      Serial.printf("STORY_CACHE held=%lu/%lu psram=%u scene_hit=%lu/1000 scene_bytes=%lu scene_evict=%lu audio_hit=%lu/1000 audio_bytes=%lu json_hit=%lu/1000 json_bytes=%lu json_evict=%lu\n",
+                    static_cast<unsigned long>(cache.bytes_held),
+                    static_cast<unsigned long>(cache.capacity),
+                    cache.psram ? 1U : 0U,
+                    static_cast<unsigned long>(cache.hit_rate_permille[static_cast<size_t>(StoryContentKind::kScene)]),
+                    static_cast<unsigned long>(scene.bytes),
+                    static_cast<unsigned long>(scene.evictions),
+                    static_cast<unsigned long>(cache.hit_rate_permille[static_cast<size_t>(StoryContentKind::kAudioMap)]),
+                    static_cast<unsigned long>(audio.bytes),
+                    static_cast<unsigned long>(cache.hit_rate_permille[static_cast<size_t>(StoryContentKind::kStoryJson)]),
+                    static_cast<unsigned long>(json.bytes),
+                    static_cast<unsigned long>(json.evictions));
       return;
     }
-    g_resource_profile_auto = false;
-    Serial.printf("ACK RESOURCE_PROFILE profile=%s\n", g_resource_coordinator.profileName());
-    printResourceStatus();
-    return;
-  }
-  if (std::strcmp(command, "RESOURCE_PROFILE_AUTO") == 0) {
-    if (argument == nullptr || argument[0] == '\0') {
-      Serial.printf("ERR RESOURCE_PROFILE_AUTO_ARG arg=%s\n", argument == nullptr ? "missing" : "empty");
+    case CommandId::kHwStatus:
+    case CommandId::kHwMicStatus:
+    case CommandId::kHwBatStatus: {
+      printHardwareStatus();
       return;
     }
-    char profile_auto_arg[24] = {0};
-    copyText(profile_auto_arg, sizeof(profile_auto_arg), argument);
-    trimAsciiInPlace(profile_auto_arg);
-    bool parse_ok = false;
-    applyResourceProfileAutoCommand(profile_auto_arg, &parse_ok);
-    if (!parse_ok) {
-      Serial.println("ERR RESOURCE_PROFILE_AUTO_ARG");
+    case CommandId::kHwStatusJson: {
+      printHardwareStatusJson();
       return;
     }
-    Serial.printf("ACK RESOURCE_PROFILE_AUTO profile=%s auto=%u\n",
-                  g_resource_coordinator.profileName(),
-                  g_resource_profile_auto ? 1U : 0U);
-    printResourceStatus();
-    return;
-  }
-  if (std::strcmp(command, "SIMD_STATUS") == 0) {
-    printSimdStatus();
-    return;
-  }
-  if (std::strcmp(command, "SIMD_SELFTEST") == 0) {
-    const bool ok = runtime::simd::runSelfTestCommand();
-    Serial.printf("ACK SIMD_SELFTEST ok=%u\n", ok ? 1U : 0U);
-    printSimdStatus();
-    return;
-  }
-  if (std::strcmp(command, "SIMD_BENCH") == 0) {
-    uint32_t loops = 200U;
-    uint32_t pixels = 7680U;
-    if (argument != nullptr && argument[0] != '\0') {
-      char args[40] = {0};
-      copyText(args, sizeof(args), argument);
-      trimAsciiInPlace(args);
-      char* second = std::strchr(args, ' ');
-      if (second != nullptr) {
-        *second = '\0';
-        ++second;
-        while (*second == ' ') {
-          ++second;
+    case CommandId::kMicTunerStatus: {
+      if (argument == nullptr) {
+        printMicTunerStatus();
+        return;
+      }
+
+      char arg_copy[40] = {0};
+      copyText(arg_copy, sizeof(arg_copy), argument);
+      trimAsciiInPlace(arg_copy);
+      if (arg_copy[0] == '\0') {
+        printMicTunerStatus();
+        return;
+      }
+
+      char* extra = std::strchr(arg_copy, ' ');
+      if (extra != nullptr) {
+        *extra = '\0';
+        ++extra;
+        while (*extra == ' ') {
+          ++extra;
         }
       }
-      if (args[0] != '\0') {
-        loops = static_cast<uint32_t>(std::strtoul(args, nullptr, 10));
+
+      bool stream_value = false;
+      if (parseBoolToken(arg_copy, &stream_value)) {
+        g_mic_tuner_stream_enabled = stream_value;
+        if (extra != nullptr && extra[0] != '\0') {
+          const long period_ms = std::strtol(extra, nullptr, 10);
+          if (period_ms >= 50L && period_ms <= 5000L) {
+            g_mic_tuner_stream_period_ms = static_cast<uint16_t>(period_ms);
+          }
+        }
+        g_next_mic_tuner_stream_ms = now_ms + 20U;
+        Serial.printf("ACK MIC_TUNER_STATUS stream=%u period_ms=%u\n",
+                      g_mic_tuner_stream_enabled ? 1U : 0U,
+                      static_cast<unsigned int>(g_mic_tuner_stream_period_ms));
+        if (!g_mic_tuner_stream_enabled) {
+          printMicTunerStatus();
+        }
+        return;
       }
-      if (second != nullptr && second[0] != '\0') {
-        pixels = static_cast<uint32_t>(std::strtoul(second, nullptr, 10));
+
+      const long period_ms = std::strtol(arg_copy, nullptr, 10);
+      if (period_ms >= 50L && period_ms <= 5000L) {
+        g_mic_tuner_stream_enabled = true;
+        g_mic_tuner_stream_period_ms = static_cast<uint16_t>(period_ms);
+        g_next_mic_tuner_stream_ms = now_ms + 20U;
+        Serial.printf("ACK MIC_TUNER_STATUS stream=1 period_ms=%u\n", static_cast<unsigned int>(g_mic_tuner_stream_period_ms));
+        return;
       }
+
+      Serial.println("ERR MIC_TUNER_STATUS_ARG");
+      return;
     }
-    const runtime::simd::SimdBenchResult result = runtime::simd::runBenchCommand(loops, pixels);
-    Serial.printf("SIMD_BENCH loops=%lu pixels=%lu l8_us=%lu idx_us=%lu rgb888_us=%lu gain_us=%lu\n",
-                  static_cast<unsigned long>(result.loops),
-                  static_cast<unsigned long>(result.pixels),
-                  static_cast<unsigned long>(result.l8_to_rgb565_us),
-                  static_cast<unsigned long>(result.idx8_to_rgb565_us),
-                  static_cast<unsigned long>(result.rgb888_to_rgb565_us),
-                  static_cast<unsigned long>(result.s16_gain_q15_us));
-    printSimdStatus();
-    return;
-  }
-  if (std::strcmp(command, "BTN_READ") == 0) {
-    printButtonRead();
-    return;
-  }
-  if (std::strcmp(command, "NEXT") == 0) {
-    const bool ok = notifyScenarioButtonGuarded(5U, false, now_ms, "serial_next");
-    Serial.printf("ACK NEXT ok=%u\n", ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "UNLOCK") == 0) {
-    const bool ok = dispatchScenarioEventByName("UNLOCK", now_ms);
-    Serial.printf("ACK UNLOCK ok=%u\n", ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "RESET") == 0) {
-    g_audio.stop();
-#if defined(USE_AUDIO) && (USE_AUDIO != 0)
-    if (g_amp_ready) {
-      g_amp_player.service().stop();
-    }
-#endif
-    (void)g_media.stop(&g_audio);
-    g_scenario.reset();
-    if (g_boot_media_manager_mode) {
-      (void)g_scenario.gotoScene(kMediaManagerSceneId, now_ms, "boot_mode_media_manager_reset");
-    }
-    g_last_action_step_key[0] = '\0';
-    refreshSceneIfNeeded(true);
-    startPendingAudioIfAny();
-    Serial.println("ACK RESET");
-    return;
-  }
-  if (std::strcmp(command, "STORY_DEBUG_BYPASS") == 0) {
-    if (argument == nullptr || argument[0] == '\0') {
-      Serial.printf("ACK STORY_DEBUG_BYPASS enabled=%u\n", g_scenario.debugTransitionBypassEnabled() ? 1U : 0U);
+    case CommandId::kCamStatus: {
+      printCameraStatus();
       return;
     }
-    bool enabled = false;
-    if (!parseBoolToken(argument, &enabled)) {
-      Serial.println("ERR STORY_DEBUG_BYPASS_ARG");
+    case CommandId::kCamRecStatus: {
+      printCameraRecorderStatus();
       return;
     }
-    g_scenario.setDebugTransitionBypassEnabled(enabled, "serial");
-    Serial.printf("ACK STORY_DEBUG_BYPASS enabled=%u\n", enabled ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "SC_LIST") == 0) {
-    printScenarioList();
-    return;
-  }
-  if (std::strcmp(command, "SC_LOAD") == 0) {
-    if (argument == nullptr) {
-      Serial.println("ERR SC_LOAD_ARG");
+    case CommandId::kRecStatus: {
+      printMediaStatus();
       return;
     }
-    char scenario_id[kSerialLineCapacity] = {0};
-    std::strncpy(scenario_id, argument, sizeof(scenario_id) - 1U);
-    toUpperAsciiInPlace(scenario_id);
-    String load_source;
-    String load_path;
-    const bool ok = loadScenarioByIdPreferStoryFile(scenario_id, &load_source, &load_path);
-    Serial.printf("ACK SC_LOAD id=%s ok=%u\n", scenario_id, ok ? 1U : 0U);
-    if (ok) {
-      if (!load_path.isEmpty()) {
-        Serial.printf("[SCENARIO] load source=%s path=%s\n", load_source.c_str(), load_path.c_str());
-      } else {
-        Serial.printf("[SCENARIO] load source=%s id=%s\n", load_source.c_str(), scenario_id);
-      }
+    case CommandId::kHwLedSet:
+    case CommandId::kHwLedAuto:
+    case CommandId::kLcdBacklight:
+    case CommandId::kCamOn:
+    case CommandId::kCamOff:
+    case CommandId::kCamSnapshot:
+    case CommandId::kCamUiShow:
+    case CommandId::kCamUiHide:
+    case CommandId::kCamUiToggle:
+    case CommandId::kCamRecSnap:
+    case CommandId::kCamRecSave:
+    case CommandId::kCamRecGallery:
+    case CommandId::kCamRecNext:
+    case CommandId::kCamRecDelete:
+    case CommandId::kMediaList:
+    case CommandId::kMediaPlay:
+    case CommandId::kMediaStop:
+    case CommandId::kRecStart:
+    case CommandId::kRecStop:
+    case CommandId::kSceneGoto:
+    case CommandId::kQrSim:
+    case CommandId::kBootModeStatus:
+    case CommandId::kBootModeSet:
+    case CommandId::kBootModeClear: {
+      String action = CommandRegistry::name(id);
+      if (argument != nullptr && argument[0] != '\0') {
+        action += " ";
+        action += argument;
+      }
+      String error;
+      const bool ok = dispatchControlAction(action, now_ms, &error);
+      Serial.printf("ACK %s ok=%u%s%s\n",
+                    CommandRegistry::name(id),
+                    ok ? 1U : 0U,
+                    error.isEmpty() ? "" : " err=",
+                    error.isEmpty() ? "" : error.c_str());
+      return;
     }
-    if (ok) {
-      g_last_action_step_key[0] = '\0';
-      refreshSceneIfNeeded(true);
-      startPendingAudioIfAny();
+    case CommandId::kScCoverage: {
+      printScenarioCoverage();
+      return;
     }
-    return;
-  }
-  if (std::strcmp(command, "STORY_REFRESH_SD") == 0) {
-    const bool ok = refreshStoryFromSd();
-    Serial.printf("ACK STORY_REFRESH_SD ok=%u\n", ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "STORY_SD_STATUS") == 0) {
-    Serial.printf("STORY_SD_STATUS ready=%u\n", g_storage.hasSdCard() ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "HW_STATUS") == 0 || std::strcmp(command, "HW_MIC_STATUS") == 0 ||
-      std::strcmp(command, "HW_BAT_STATUS") == 0) {
-    printHardwareStatus();
-    return;
-  }
-  if (std::strcmp(command, "HW_STATUS_JSON") == 0) {
-    printHardwareStatusJson();
-    return;
-  }
-  if (std::strcmp(command, "MIC_TUNER_STATUS") == 0) {
-    if (argument == nullptr) {
-      printMicTunerStatus();
+    case CommandId::kScRevalidate: {
+      runScenarioRevalidate(now_ms);
       return;
     }
-
-    char arg_copy[40] = {0};
-    copyText(arg_copy, sizeof(arg_copy), argument);
-    trimAsciiInPlace(arg_copy);
-    if (arg_copy[0] == '\0') {
-      printMicTunerStatus();
+    case CommandId::kScRevalidateAll: {
+      runScenarioRevalidateAll(now_ms);
       return;
     }
-
-    char* extra = std::strchr(arg_copy, ' ');
-    if (extra != nullptr) {
-      *extra = '\0';
-      ++extra;
-      while (*extra == ' ') {
-        ++extra;
+    case CommandId::kScEvent: {
+      if (argument == nullptr) {
+        Serial.println("ERR SC_EVENT_USAGE");
+        return;
       }
-    }
-
-    bool stream_value = false;
-    if (parseBoolToken(arg_copy, &stream_value)) {
-      g_mic_tuner_stream_enabled = stream_value;
-      if (extra != nullptr && extra[0] != '\0') {
-        const long period_ms = std::strtol(extra, nullptr, 10);
-        if (period_ms >= 50L && period_ms <= 5000L) {
-          g_mic_tuner_stream_period_ms = static_cast<uint16_t>(period_ms);
+      char event_args[kSerialLineCapacity] = {0};
+      std::strncpy(event_args, argument, kSerialLineCapacity - 1U);
+      char* event_type_text = event_args;
+      char* event_name_raw = nullptr;
+      for (size_t index = 0; index < kSerialLineCapacity && event_args[index] != '\0'; ++index) {
+        if (event_args[index] == ' ') {
+          event_args[index] = '\0';
+          event_name_raw = &event_args[index + 1U];
+          break;
         }
       }
-      g_next_mic_tuner_stream_ms = now_ms + 20U;
-      Serial.printf("ACK MIC_TUNER_STATUS stream=%u period_ms=%u\n",
-                    g_mic_tuner_stream_enabled ? 1U : 0U,
-                    static_cast<unsigned int>(g_mic_tuner_stream_period_ms));
-      if (!g_mic_tuner_stream_enabled) {
-        printMicTunerStatus();
+      while (event_name_raw != nullptr && *event_name_raw == ' ') {
+        ++event_name_raw;
+      }
+      StoryEventType event_type = StoryEventType::kNone;
+      if (!parseEventType(event_type_text, &event_type)) {
+        Serial.println("ERR SC_EVENT_TYPE");
+        return;
       }
+      const char* event_name = event_name_raw;
+      if (event_name == nullptr || event_name[0] == '\0') {
+        event_name = defaultEventNameForType(event_type);
+      }
+      const ScenarioSnapshot before = g_scenario.snapshot();
+      const bool dispatched = dispatchScenarioEventByType(event_type, event_name, now_ms);
+      const ScenarioSnapshot after = g_scenario.snapshot();
+      const bool changed = std::strcmp(stepIdFromSnapshot(before), stepIdFromSnapshot(after)) != 0;
+      if (dispatched && changed) {
+        g_step_action_gate.invalidate();
+        refreshSceneIfNeeded(true);
+        startPendingAudioIfAny();
+      }
+      Serial.printf("ACK SC_EVENT type=%s name=%s dispatched=%u changed=%u step=%s\n",
+                    eventTypeName(event_type),
+                    event_name,
+                    dispatched ? 1U : 0U,
+                    changed ? 1U : 0U,
+                    stepIdFromSnapshot(after));
       return;
     }
-
-    const long period_ms = std::strtol(arg_copy, nullptr, 10);
-    if (period_ms >= 50L && period_ms <= 5000L) {
-      g_mic_tuner_stream_enabled = true;
-      g_mic_tuner_stream_period_ms = static_cast<uint16_t>(period_ms);
-      g_next_mic_tuner_stream_ms = now_ms + 20U;
-      Serial.printf("ACK MIC_TUNER_STATUS stream=1 period_ms=%u\n", static_cast<unsigned int>(g_mic_tuner_stream_period_ms));
+    case CommandId::kScEventRaw: {
+      if (argument == nullptr || argument[0] == '\0') {
+        Serial.println("ERR SC_EVENT_RAW_ARG");
+        return;
+      }
+      const ScenarioSnapshot before = g_scenario.snapshot();
+      const bool dispatched = dispatchScenarioEventByName(argument, now_ms);
+      const ScenarioSnapshot after = g_scenario.snapshot();
+      const bool changed = std::strcmp(stepIdFromSnapshot(before), stepIdFromSnapshot(after)) != 0;
+      if (dispatched && changed) {
+        g_step_action_gate.invalidate();
+        refreshSceneIfNeeded(true);
+        startPendingAudioIfAny();
+      }
+      Serial.printf("ACK SC_EVENT_RAW name=%s dispatched=%u changed=%u step=%s\n",
+                    argument,
+                    dispatched ? 1U : 0U,
+                    changed ? 1U : 0U,
+                    stepIdFromSnapshot(after));
       return;
     }
-
-    Serial.println("ERR MIC_TUNER_STATUS_ARG");
-    return;
-  }
-  if (std::strcmp(command, "CAM_STATUS") == 0) {
-    printCameraStatus();
-    return;
-  }
-  if (std::strcmp(command, "CAM_REC_STATUS") == 0) {
-    printCameraRecorderStatus();
-    return;
-  }
-  if (std::strcmp(command, "REC_STATUS") == 0) {
-    printMediaStatus();
-    return;
-  }
-  if (std::strcmp(command, "HW_LED_SET") == 0 || std::strcmp(command, "HW_LED_AUTO") == 0 ||
-      std::strcmp(command, "LCD_BACKLIGHT") == 0 ||
-      std::strcmp(command, "CAM_ON") == 0 || std::strcmp(command, "CAM_OFF") == 0 ||
-      std::strcmp(command, "CAM_SNAPSHOT") == 0 || std::strcmp(command, "CAM_UI_SHOW") == 0 ||
-      std::strcmp(command, "CAM_UI_HIDE") == 0 || std::strcmp(command, "CAM_UI_TOGGLE") == 0 ||
-      std::strcmp(command, "CAM_REC_SNAP") == 0 || std::strcmp(command, "CAM_REC_SAVE") == 0 ||
-      std::strcmp(command, "CAM_REC_GALLERY") == 0 || std::strcmp(command, "CAM_REC_NEXT") == 0 ||
-      std::strcmp(command, "CAM_REC_DELETE") == 0 || std::strcmp(command, "MEDIA_LIST") == 0 ||
-      std::strcmp(command, "MEDIA_PLAY") == 0 || std::strcmp(command, "MEDIA_STOP") == 0 ||
-      std::strcmp(command, "REC_START") == 0 || std::strcmp(command, "REC_STOP") == 0 ||
-      std::strcmp(command, "SCENE_GOTO") == 0 || std::strcmp(command, "QR_SIM") == 0 ||
-      std::strcmp(command, "BOOT_MODE_STATUS") == 0 || std::strcmp(command, "BOOT_MODE_SET") == 0 ||
-      std::strcmp(command, "BOOT_MODE_CLEAR") == 0) {
-    String action = command;
-    if (argument != nullptr && argument[0] != '\0') {
-      action += " ";
-      action += argument;
+    case CommandId::kNetStatus:
+    case CommandId::kWifiStatus:
+    case CommandId::kEspnowStatus: {
+      printNetworkStatus();
+      return;
     }
-    String error;
-    const bool ok = dispatchControlAction(action, now_ms, &error);
-    Serial.printf("ACK %s ok=%u%s%s\n",
-                  command,
-                  ok ? 1U : 0U,
-                  error.isEmpty() ? "" : " err=",
-                  error.isEmpty() ? "" : error.c_str());
-    return;
-  }
-  if (std::strcmp(command, "SC_COVERAGE") == 0) {
-    printScenarioCoverage();
-    return;
-  }
-  if (std::strcmp(command, "SC_REVALIDATE") == 0) {
-    runScenarioRevalidate(now_ms);
-    return;
-  }
-  if (std::strcmp(command, "SC_REVALIDATE_ALL") == 0) {
-    runScenarioRevalidateAll(now_ms);
-    return;
-  }
-  if (std::strcmp(command, "SC_EVENT") == 0) {
-    if (argument == nullptr) {
-      Serial.println("ERR SC_EVENT_USAGE");
+    case CommandId::kAuthStatus: {
+      Serial.printf("AUTH_STATUS setup_mode=%u auth_required=%u token_set=%u provisioned=%u\n",
+                    g_setup_mode ? 1U : 0U,
+                    g_web_auth_required ? 1U : 0U,
+                    g_web_auth_token[0] != '\0' ? 1U : 0U,
+                    g_credential_store.isProvisioned() ? 1U : 0U);
       return;
     }
-    char event_args[kSerialLineCapacity] = {0};
-    std::strncpy(event_args, argument, kSerialLineCapacity - 1U);
-    char* event_type_text = event_args;
-    char* event_name_raw = nullptr;
-    for (size_t index = 0; index < kSerialLineCapacity && event_args[index] != '\0'; ++index) {
-      if (event_args[index] == ' ') {
-        event_args[index] = '\0';
-        event_name_raw = &event_args[index + 1U];
-        break;
+    case CommandId::kAuthTokenRotate: {
+      bool ok = false;
+      if (argument != nullptr && argument[0] != '\0') {
+        char token[kWebAuthTokenCapacity] = {0};
+        copyText(token, sizeof(token), argument);
+        trimAsciiInPlace(token);
+        ok = token[0] != '\0' && g_credential_store.saveWebToken(token);
+        if (ok) {
+          copyText(g_web_auth_token, sizeof(g_web_auth_token), token);
+        }
+      } else {
+        ok = ensureWebToken(true, false, nullptr);
       }
-    }
-    while (event_name_raw != nullptr && *event_name_raw == ' ') {
-      ++event_name_raw;
-    }
-    StoryEventType event_type = StoryEventType::kNone;
-    if (!parseEventType(event_type_text, &event_type)) {
-      Serial.println("ERR SC_EVENT_TYPE");
+      Serial.printf("ACK AUTH_TOKEN_ROTATE ok=%u%s%s\n",
+                    ok ? 1U : 0U,
+                    ok ? " token=" : "",
+                    ok ? g_web_auth_token : "");
       return;
     }
-    const char* event_name = event_name_raw;
-    if (event_name == nullptr || event_name[0] == '\0') {
-      event_name = defaultEventNameForType(event_type);
-    }
-    const ScenarioSnapshot before = g_scenario.snapshot();
-    const bool dispatched = dispatchScenarioEventByType(event_type, event_name, now_ms);
-    const ScenarioSnapshot after = g_scenario.snapshot();
-    const bool changed = std::strcmp(stepIdFromSnapshot(before), stepIdFromSnapshot(after)) != 0;
-    if (dispatched && changed) {
-      g_last_action_step_key[0] = '\0';
-      refreshSceneIfNeeded(true);
-      startPendingAudioIfAny();
+    case CommandId::kEspnowStatusJson: {
+      printEspNowStatusJson();
+      return;
     }
-    Serial.printf("ACK SC_EVENT type=%s name=%s dispatched=%u changed=%u step=%s\n",
-                  eventTypeName(event_type),
-                  event_name,
-                  dispatched ? 1U : 0U,
-                  changed ? 1U : 0U,
-                  stepIdFromSnapshot(after));
-    return;
-  }
-  if (std::strcmp(command, "SC_EVENT_RAW") == 0) {
-    if (argument == nullptr || argument[0] == '\0') {
-      Serial.println("ERR SC_EVENT_RAW_ARG");
+    case CommandId::kWifiTest: {
+      if (g_network_cfg.wifi_test_ssid[0] == '\0') {
+        Serial.println("ERR WIFI_TEST_NO_CREDENTIALS");
+        return;
+      }
+      const bool ok = g_network.connectSta(g_network_cfg.wifi_test_ssid, g_network_cfg.wifi_test_password);
+      Serial.printf("ACK WIFI_TEST ssid=%s ok=%u\n", g_network_cfg.wifi_test_ssid, ok ? 1U : 0U);
       return;
     }
-    const ScenarioSnapshot before = g_scenario.snapshot();
-    const bool dispatched = dispatchScenarioEventByName(argument, now_ms);
-    const ScenarioSnapshot after = g_scenario.snapshot();
-    const bool changed = std::strcmp(stepIdFromSnapshot(before), stepIdFromSnapshot(after)) != 0;
-    if (dispatched && changed) {
-      g_last_action_step_key[0] = '\0';
-      refreshSceneIfNeeded(true);
-      startPendingAudioIfAny();
+    case CommandId::kWifiProvision: {
+      if (argument == nullptr) {
+        Serial.println("ERR WIFI_PROVISION_ARG");
+        return;
+      }
+      String ssid;
+      String pass;
+      if (!splitSsidPass(argument, &ssid, &pass) || ssid.isEmpty()) {
+        Serial.println("ERR WIFI_PROVISION_ARG");
+        return;
+      }
+      bool connect_started = false;
+      bool persisted = false;
+      bool token_generated = false;
+      const bool ok = provisionWifiCredentials(
+          ssid.c_str(), pass.c_str(), true, &connect_started, &persisted, &token_generated);
+      Serial.printf("ACK WIFI_PROVISION ssid=%s ok=%u persisted=%u connect_started=%u setup_mode=%u token_set=%u\n",
+                    ssid.c_str(),
+                    ok ? 1U : 0U,
+                    persisted ? 1U : 0U,
+                    connect_started ? 1U : 0U,
+                    g_setup_mode ? 1U : 0U,
+                    g_web_auth_token[0] != '\0' ? 1U : 0U);
+      if (token_generated && g_web_auth_token[0] != '\0') {
+        Serial.printf("AUTH_TOKEN %s\n", g_web_auth_token);
+      }
+      return;
     }
-    Serial.printf("ACK SC_EVENT_RAW name=%s dispatched=%u changed=%u step=%s\n",
-                  argument,
-                  dispatched ? 1U : 0U,
-                  changed ? 1U : 0U,
-                  stepIdFromSnapshot(after));
-    return;
-  }
-  if (std::strcmp(command, "NET_STATUS") == 0 || std::strcmp(command, "WIFI_STATUS") == 0 ||
-      std::strcmp(command, "ESPNOW_STATUS") == 0) {
-    printNetworkStatus();
-    return;
-  }
-  if (std::strcmp(command, "AUTH_STATUS") == 0) {
-    Serial.printf("AUTH_STATUS setup_mode=%u auth_required=%u token_set=%u provisioned=%u\n",
-                  g_setup_mode ? 1U : 0U,
-                  g_web_auth_required ? 1U : 0U,
-                  g_web_auth_token[0] != '\0' ? 1U : 0U,
-                  g_credential_store.isProvisioned() ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "AUTH_TOKEN_ROTATE") == 0) {
-    bool ok = false;
-    if (argument != nullptr && argument[0] != '\0') {
-      char token[kWebAuthTokenCapacity] = {0};
-      copyText(token, sizeof(token), argument);
-      trimAsciiInPlace(token);
-      ok = token[0] != '\0' && g_credential_store.saveWebToken(token);
-      if (ok) {
-        copyText(g_web_auth_token, sizeof(g_web_auth_token), token);
+    case CommandId::kWifiSta:
+    case CommandId::kWifiConnect: {
+      if (argument == nullptr) {
+        Serial.println("ERR WIFI_STA_ARG");
+        return;
       }
-    } else {
-      ok = ensureWebToken(true, false, nullptr);
+      String ssid;
+      String pass;
+      if (!splitSsidPass(argument, &ssid, &pass) || ssid.isEmpty()) {
+        Serial.println("ERR WIFI_STA_ARG");
+        return;
+      }
+      const bool ok = g_network.connectSta(ssid.c_str(), pass.c_str());
+      Serial.printf("ACK WIFI_STA ssid=%s ok=%u\n", ssid.c_str(), ok ? 1U : 0U);
+      return;
     }
-    Serial.printf("ACK AUTH_TOKEN_ROTATE ok=%u%s%s\n",
-                  ok ? 1U : 0U,
-                  ok ? " token=" : "",
-                  ok ? g_web_auth_token : "");
-    return;
-  }
-  if (std::strcmp(command, "ESPNOW_STATUS_JSON") == 0) {
-    printEspNowStatusJson();
-    return;
-  }
-  if (std::strcmp(command, "WIFI_TEST") == 0) {
-    if (g_network_cfg.wifi_test_ssid[0] == '\0') {
-      Serial.println("ERR WIFI_TEST_NO_CREDENTIALS");
+    case CommandId::kWifiForget: {
+      const bool ok = forgetWifiCredentials();
+      Serial.printf("ACK WIFI_FORGET ok=%u setup_mode=%u\n", ok ? 1U : 0U, g_setup_mode ? 1U : 0U);
       return;
     }
-    const bool ok = g_network.connectSta(g_network_cfg.wifi_test_ssid, g_network_cfg.wifi_test_password);
-    Serial.printf("ACK WIFI_TEST ssid=%s ok=%u\n", g_network_cfg.wifi_test_ssid, ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "WIFI_PROVISION") == 0) {
-    if (argument == nullptr) {
-      Serial.println("ERR WIFI_PROVISION_ARG");
+    case CommandId::kWifiDisconnect: {
+      g_network.disconnectSta();
+      Serial.println("ACK WIFI_DISCONNECT");
       return;
     }
-    String ssid;
-    String pass;
-    if (!splitSsidPass(argument, &ssid, &pass) || ssid.isEmpty()) {
-      Serial.println("ERR WIFI_PROVISION_ARG");
+    case CommandId::kWifiApOn: {
+      String ssid = g_network_cfg.ap_default_ssid;
+      String pass = g_network_cfg.ap_default_password;
+      if (argument != nullptr) {
+        String parsed_ssid;
+        String parsed_pass;
+        if (splitSsidPass(argument, &parsed_ssid, &parsed_pass) && !parsed_ssid.isEmpty()) {
+          ssid = parsed_ssid;
+          if (!parsed_pass.isEmpty()) {
+            pass = parsed_pass;
+          }
+        } else if (std::strlen(argument) > 0U) {
+          ssid = argument;
+        }
+      }
+      const bool ok = g_network.startAp(ssid.c_str(), pass.c_str());
+      Serial.printf("ACK WIFI_AP_ON ssid=%s ok=%u\n", ssid.c_str(), ok ? 1U : 0U);
       return;
     }
-    bool connect_started = false;
-    bool persisted = false;
-    bool token_generated = false;
-    const bool ok = provisionWifiCredentials(
-        ssid.c_str(), pass.c_str(), true, &connect_started, &persisted, &token_generated);
-    Serial.printf("ACK WIFI_PROVISION ssid=%s ok=%u persisted=%u connect_started=%u setup_mode=%u token_set=%u\n",
-                  ssid.c_str(),
-                  ok ? 1U : 0U,
-                  persisted ? 1U : 0U,
-                  connect_started ? 1U : 0U,
-                  g_setup_mode ? 1U : 0U,
-                  g_web_auth_token[0] != '\0' ? 1U : 0U);
-    if (token_generated && g_web_auth_token[0] != '\0') {
-      Serial.printf("AUTH_TOKEN %s\n", g_web_auth_token);
+    case CommandId::kWifiApOff: {
+      g_network.stopAp();
+      Serial.println("ACK WIFI_AP_OFF");
+      return;
     }
-    return;
-  }
-  if (std::strcmp(command, "WIFI_STA") == 0 || std::strcmp(command, "WIFI_CONNECT") == 0) {
-    if (argument == nullptr) {
-      Serial.println("ERR WIFI_STA_ARG");
+    case CommandId::kEspnowOn: {
+      const bool ok = g_network.enableEspNow();
+      Serial.printf("ACK ESPNOW_ON %u\n", ok ? 1U : 0U);
       return;
     }
-    String ssid;
-    String pass;
-    if (!splitSsidPass(argument, &ssid, &pass) || ssid.isEmpty()) {
-      Serial.println("ERR WIFI_STA_ARG");
+    case CommandId::kEspnowOff: {
+      g_network.disableEspNow();
+      Serial.println("ACK ESPNOW_OFF");
       return;
     }
-    const bool ok = g_network.connectSta(ssid.c_str(), pass.c_str());
-    Serial.printf("ACK WIFI_STA ssid=%s ok=%u\n", ssid.c_str(), ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "WIFI_FORGET") == 0) {
-    const bool ok = forgetWifiCredentials();
-    Serial.printf("ACK WIFI_FORGET ok=%u setup_mode=%u\n", ok ? 1U : 0U, g_setup_mode ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "WIFI_DISCONNECT") == 0) {
-    g_network.disconnectSta();
-    Serial.println("ACK WIFI_DISCONNECT");
-    return;
-  }
-  if (std::strcmp(command, "WIFI_AP_ON") == 0) {
-    String ssid = g_network_cfg.ap_default_ssid;
-    String pass = g_network_cfg.ap_default_password;
-    if (argument != nullptr) {
-      String parsed_ssid;
-      String parsed_pass;
-      if (splitSsidPass(argument, &parsed_ssid, &parsed_pass) && !parsed_ssid.isEmpty()) {
-        ssid = parsed_ssid;
-        if (!parsed_pass.isEmpty()) {
-          pass = parsed_pass;
+    case CommandId::kEspnowDiscovery: {
+      const uint8_t discovered = runEspNowDiscoverySweep();
+      Serial.printf("ACK ESPNOW_DISCOVERY mode=broadcast+discovery peers=%u\n", discovered);
+      for (uint8_t index = 0U; index < discovered; ++index) {
+        char peer[18] = {0};
+        if (!g_network.espNowPeerAt(index, peer, sizeof(peer))) {
+          continue;
         }
-      } else if (std::strlen(argument) > 0U) {
-        ssid = argument;
+        Serial.printf("ESPNOW_PEER idx=%u mac=%s\n", index, peer);
       }
+      return;
     }
-    const bool ok = g_network.startAp(ssid.c_str(), pass.c_str());
-    Serial.printf("ACK WIFI_AP_ON ssid=%s ok=%u\n", ssid.c_str(), ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "WIFI_AP_OFF") == 0) {
-    g_network.stopAp();
-    Serial.println("ACK WIFI_AP_OFF");
-    return;
-  }
-  if (std::strcmp(command, "ESPNOW_ON") == 0) {
-    const bool ok = g_network.enableEspNow();
-    Serial.printf("ACK ESPNOW_ON %u\n", ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "ESPNOW_OFF") == 0) {
-    g_network.disableEspNow();
-    Serial.println("ACK ESPNOW_OFF");
-    return;
-  }
-  if (std::strcmp(command, "ESPNOW_DISCOVERY") == 0) {
-    const uint8_t discovered = runEspNowDiscoverySweep();
-    Serial.printf("ACK ESPNOW_DISCOVERY mode=broadcast+discovery peers=%u\n", discovered);
-    for (uint8_t index = 0U; index < discovered; ++index) {
-      char peer[18] = {0};
-      if (!g_network.espNowPeerAt(index, peer, sizeof(peer))) {
-        continue;
+    case CommandId::kEspnowDiscoveryRuntime: {
+      if (argument != nullptr && argument[0] != '\0') {
+        bool enabled = false;
+        if (!parseBoolToken(argument, &enabled)) {
+          Serial.println("ERR ESPNOW_DISCOVERY_RUNTIME_ARG");
+          return;
+        }
+        g_espnow_discovery_runtime_enabled = enabled;
+        g_next_espnow_discovery_ms = now_ms + 50U;
       }
-      Serial.printf("ESPNOW_PEER idx=%u mac=%s\n", index, peer);
+      Serial.printf("ACK ESPNOW_DISCOVERY_RUNTIME enabled=%u interval_ms=%lu\n",
+                    g_espnow_discovery_runtime_enabled ? 1U : 0U,
+                    static_cast<unsigned long>(kEspNowDiscoveryIntervalMs));
+      return;
     }
-    return;
-  }
-  if (std::strcmp(command, "ESPNOW_DISCOVERY_RUNTIME") == 0) {
-    if (argument != nullptr && argument[0] != '\0') {
-      bool enabled = false;
-      if (!parseBoolToken(argument, &enabled)) {
-        Serial.println("ERR ESPNOW_DISCOVERY_RUNTIME_ARG");
+    case CommandId::kEspnowDeviceNameGet: {
+      Serial.printf("ACK ESPNOW_DEVICE_NAME_GET name=%s\n", g_espnow_device_name);
+      return;
+    }
+    case CommandId::kEspnowDeviceNameSet: {
+      if (argument == nullptr || argument[0] == '\0') {
+        Serial.println("ERR ESPNOW_DEVICE_NAME_SET_ARG");
         return;
       }
-      g_espnow_discovery_runtime_enabled = enabled;
-      g_next_espnow_discovery_ms = now_ms + 50U;
-    }
-    Serial.printf("ACK ESPNOW_DISCOVERY_RUNTIME enabled=%u interval_ms=%lu\n",
-                  g_espnow_discovery_runtime_enabled ? 1U : 0U,
-                  static_cast<unsigned long>(kEspNowDiscoveryIntervalMs));
-    return;
-  }
-  if (std::strcmp(command, "ESPNOW_DEVICE_NAME_GET") == 0) {
-    Serial.printf("ACK ESPNOW_DEVICE_NAME_GET name=%s\n", g_espnow_device_name);
-    return;
-  }
-  if (std::strcmp(command, "ESPNOW_DEVICE_NAME_SET") == 0) {
-    if (argument == nullptr || argument[0] == '\0') {
-      Serial.println("ERR ESPNOW_DEVICE_NAME_SET_ARG");
+      const bool ok = saveEspNowDeviceNameToNvs(argument);
+      Serial.printf("ACK ESPNOW_DEVICE_NAME_SET ok=%u name=%s\n", ok ? 1U : 0U, g_espnow_device_name);
       return;
     }
-    const bool ok = saveEspNowDeviceNameToNvs(argument);
-    Serial.printf("ACK ESPNOW_DEVICE_NAME_SET ok=%u name=%s\n", ok ? 1U : 0U, g_espnow_device_name);
-    return;
-  }
-  if (std::strcmp(command, "ESPNOW_PEER_ADD") == 0) {
-    if (argument == nullptr || argument[0] == '\0') {
-      Serial.println("ERR ESPNOW_PEER_ADD_ARG");
+    case CommandId::kEspnowPeerAdd: {
+      if (argument == nullptr || argument[0] == '\0') {
+        Serial.println("ERR ESPNOW_PEER_ADD_ARG");
+        return;
+      }
+      const bool ok = g_network.addEspNowPeer(argument);
+      Serial.printf("ACK ESPNOW_PEER_ADD mac=%s ok=%u\n", argument, ok ? 1U : 0U);
       return;
     }
-    const bool ok = g_network.addEspNowPeer(argument);
-    Serial.printf("ACK ESPNOW_PEER_ADD mac=%s ok=%u\n", argument, ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "ESPNOW_PEER_DEL") == 0) {
-    if (argument == nullptr || argument[0] == '\0') {
-      Serial.println("ERR ESPNOW_PEER_DEL_ARG");
+    case CommandId::kEspnowPeerDel: {
+      if (argument == nullptr || argument[0] == '\0') {
+        Serial.println("ERR ESPNOW_PEER_DEL_ARG");
+        return;
+      }
+      const bool ok = g_network.removeEspNowPeer(argument);
+      Serial.printf("ACK ESPNOW_PEER_DEL mac=%s ok=%u\n", argument, ok ? 1U : 0U);
       return;
     }
-    const bool ok = g_network.removeEspNowPeer(argument);
-    Serial.printf("ACK ESPNOW_PEER_DEL mac=%s ok=%u\n", argument, ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "ESPNOW_PEER_LIST") == 0) {
-    const uint8_t count = g_network.espNowPeerCount();
-    Serial.printf("ESPNOW_PEER_LIST count=%u\n", count);
-    for (uint8_t index = 0U; index < count; ++index) {
-      char peer[18] = {0};
-      if (!g_network.espNowPeerAt(index, peer, sizeof(peer))) {
-        continue;
+    case CommandId::kEspnowPeerList: {
+      const uint8_t count = g_network.espNowPeerCount();
+      Serial.printf("ESPNOW_PEER_LIST count=%u\n", count);
+      for (uint8_t index = 0U; index < count; ++index) {
+        char peer[18] = {0};
+        if (!g_network.espNowPeerAt(index, peer, sizeof(peer))) {
+          continue;
+        }
+        Serial.printf("ESPNOW_PEER idx=%u mac=%s\n", index, peer);
       }
-      Serial.printf("ESPNOW_PEER idx=%u mac=%s\n", index, peer);
+      return;
     }
-    return;
-  }
-  if (std::strcmp(command, "ESPNOW_SEND") == 0) {
-    if (argument == nullptr) {
-      Serial.println("ERR ESPNOW_SEND_ARG");
+    case CommandId::kEspnowSend: {
+      if (argument == nullptr) {
+        Serial.println("ERR ESPNOW_SEND_ARG");
+        return;
+      }
+      String payload;
+      if (!parseEspNowSendPayload(argument, payload, nullptr)) {
+        Serial.println("ERR ESPNOW_SEND_ARG");
+        return;
+      }
+      const bool ok = g_network.sendEspNowTarget(kEspNowBroadcastTarget, payload.c_str());
+      Serial.printf("ACK ESPNOW_SEND target=%s ok=%u\n", kEspNowBroadcastTarget, ok ? 1U : 0U);
       return;
     }
-    String payload;
-    if (!parseEspNowSendPayload(argument, payload, nullptr)) {
-      Serial.println("ERR ESPNOW_SEND_ARG");
+    case CommandId::kAudioTest: {
+      g_audio.stop();
+      const bool ok = g_audio.playDiagnosticTone();
+      Serial.printf("ACK AUDIO_TEST %u\n", ok ? 1 : 0);
       return;
     }
-    const bool ok = g_network.sendEspNowTarget(kEspNowBroadcastTarget, payload.c_str());
-    Serial.printf("ACK ESPNOW_SEND target=%s ok=%u\n", kEspNowBroadcastTarget, ok ? 1U : 0U);
-    return;
-  }
-  if (std::strcmp(command, "AUDIO_TEST") == 0) {
-    g_audio.stop();
-    const bool ok = g_audio.playDiagnosticTone();
-    Serial.printf("ACK AUDIO_TEST %u\n", ok ? 1 : 0);
-    return;
-  }
-  if (std::strcmp(command, "AUDIO_TEST_FS") == 0) {
-    g_audio.stop();
-    const bool ok = g_audio.play(kDiagAudioFile);
-    Serial.printf("ACK AUDIO_TEST_FS %u\n", ok ? 1 : 0);
-    return;
-  }
-  if (std::strcmp(command, "AUDIO_PROFILE") == 0) {
-    if (argument == nullptr) {
-      Serial.printf("AUDIO_PROFILE current=%u label=%s count=%u\n",
-                    g_audio.outputProfile(),
-                    g_audio.outputProfileLabel(g_audio.outputProfile()),
-                    g_audio.outputProfileCount());
+    case CommandId::kAudioTestFs: {
+      g_audio.stop();
+      const bool ok = g_audio.play(kDiagAudioFile);
+      Serial.printf("ACK AUDIO_TEST_FS %u\n", ok ? 1 : 0);
       return;
     }
-    char* end = nullptr;
-    const unsigned long parsed = std::strtoul(argument, &end, 10);
-    if (end == argument || (end != nullptr && *end != '\0') || parsed > 255UL) {
-      Serial.println("ERR AUDIO_PROFILE_ARG");
+    case CommandId::kAudioProfile: {
+      if (argument == nullptr) {
+        Serial.printf("AUDIO_PROFILE current=%u label=%s count=%u\n",
+                      g_audio.outputProfile(),
+                      g_audio.outputProfileLabel(g_audio.outputProfile()),
+                      g_audio.outputProfileCount());
+        return;
+      }
+      char* end = nullptr;
+      const unsigned long parsed = std::strtoul(argument, &end, 10);
+      if (end == argument || (end != nullptr && *end != '\0') || parsed > 255UL) {
+        Serial.println("ERR AUDIO_PROFILE_ARG");
+        return;
+      }
+      const uint8_t profile = static_cast<uint8_t>(parsed);
+      const bool ok = g_audio.setOutputProfile(profile);
+      Serial.printf("ACK AUDIO_PROFILE %u %u %s\n",
+                    profile,
+                    ok ? 1U : 0U,
+                    ok ? g_audio.outputProfileLabel(profile) : "invalid");
       return;
     }
-    const uint8_t profile = static_cast<uint8_t>(parsed);
-    const bool ok = g_audio.setOutputProfile(profile);
-    Serial.printf("ACK AUDIO_PROFILE %u %u %s\n",
-                  profile,
-                  ok ? 1U : 0U,
-                  ok ? g_audio.outputProfileLabel(profile) : "invalid");
-    return;
-  }
-  if (std::strcmp(command, "AUDIO_STATUS") == 0) {
-    Serial.printf("AUDIO_STATUS playing=%u track=%s codec=%s bitrate=%u profile=%u:%s fx=%u:%s vol=%u\n",
-                  g_audio.isPlaying() ? 1U : 0U,
-                  g_audio.currentTrack(),
-                  g_audio.activeCodec(),
-                  g_audio.activeBitrateKbps(),
-                  g_audio.outputProfile(),
-                  g_audio.outputProfileLabel(g_audio.outputProfile()),
-                  g_audio.fxProfile(),
-                  g_audio.fxProfileLabel(g_audio.fxProfile()),
-                  g_audio.volume());
-    return;
-  }
-  if (std::strcmp(command, "AUDIO_FX") == 0) {
-    if (argument == nullptr) {
-      Serial.printf("AUDIO_FX current=%u label=%s count=%u\n",
+    case CommandId::kAudioStatus: {
+      Serial.printf("AUDIO_STATUS playing=%u track=%s codec=%s bitrate=%u profile=%u:%s fx=%u:%s vol=%u\n",
+                    g_audio.isPlaying() ? 1U : 0U,
+                    g_audio.currentTrack(),
+                    g_audio.activeCodec(),
+                    g_audio.activeBitrateKbps(),
+                    g_audio.outputProfile(),
+                    g_audio.outputProfileLabel(g_audio.outputProfile()),
                     g_audio.fxProfile(),
                     g_audio.fxProfileLabel(g_audio.fxProfile()),
-                    g_audio.fxProfileCount());
+                    g_audio.volume());
+      return;
+    }
+    case CommandId::kAudioFx: {
+      if (argument == nullptr) {
+        Serial.printf("AUDIO_FX current=%u label=%s count=%u\n",
+                      g_audio.fxProfile(),
+                      g_audio.fxProfileLabel(g_audio.fxProfile()),
+                      g_audio.fxProfileCount());
+        return;
+      }
+      char* end = nullptr;
+      const unsigned long parsed = std::strtoul(argument, &end, 10);
+      if (end == argument || (end != nullptr && *end != '\0') || parsed >= g_audio.fxProfileCount() || parsed > 255UL) {
+        Serial.println("ERR AUDIO_FX_ARG");
+        return;
+      }
+      const uint8_t fx = static_cast<uint8_t>(parsed);
+      const bool ok = g_audio.setFxProfile(fx);
+      Serial.printf("ACK AUDIO_FX %u %u %s\n",
+                    fx,
+                    ok ? 1U : 0U,
+                    ok ? g_audio.fxProfileLabel(fx) : "invalid");
       return;
     }
-    char* end = nullptr;
-    const unsigned long parsed = std::strtoul(argument, &end, 10);
-    if (end == argument || (end != nullptr && *end != '\0') || parsed >= g_audio.fxProfileCount() || parsed > 255UL) {
-      Serial.println("ERR AUDIO_FX_ARG");
+    case CommandId::kVol: {
+      if (argument == nullptr) {
+        Serial.printf("VOL %u\n", g_audio.volume());
+        return;
+      }
+      char* end = nullptr;
+      const unsigned long parsed = std::strtoul(argument, &end, 10);
+      if (end == argument || (end != nullptr && *end != '\0') || parsed > static_cast<unsigned long>(FREENOVE_AUDIO_MAX_VOLUME)) {
+        Serial.println("ERR VOL_ARG");
+        return;
+      }
+      g_audio.setVolume(static_cast<uint8_t>(parsed));
+      Serial.printf("ACK VOL %u\n", g_audio.volume());
       return;
     }
-    const uint8_t fx = static_cast<uint8_t>(parsed);
-    const bool ok = g_audio.setFxProfile(fx);
-    Serial.printf("ACK AUDIO_FX %u %u %s\n",
-                  fx,
-                  ok ? 1U : 0U,
-                  ok ? g_audio.fxProfileLabel(fx) : "invalid");
-    return;
-  }
-  if (std::strcmp(command, "VOL") == 0) {
-    if (argument == nullptr) {
-      Serial.printf("VOL %u\n", g_audio.volume());
+    case CommandId::kAudioStop: {
+      g_audio.stop();
+      Serial.println("ACK AUDIO_STOP");
       return;
     }
-    char* end = nullptr;
-    const unsigned long parsed = std::strtoul(argument, &end, 10);
-    if (end == argument || (end != nullptr && *end != '\0') || parsed > static_cast<unsigned long>(FREENOVE_AUDIO_MAX_VOLUME)) {
-      Serial.println("ERR VOL_ARG");
+    case CommandId::kStop: {
+      g_audio.stop();
+      Serial.println("ACK STOP");
       return;
     }
-    g_audio.setVolume(static_cast<uint8_t>(parsed));
-    Serial.printf("ACK VOL %u\n", g_audio.volume());
-    return;
+    default:
+      break;
   }
-  if (std::strcmp(command, "AUDIO_STOP") == 0) {
-    g_audio.stop();
-    Serial.println("ACK AUDIO_STOP");
+  Serial.printf("UNKNOWN %s\n", command_line);
+}
+
+void handleSerialCommandImpl(const char* command_line, uint32_t now_ms) {
+  if (command_line == nullptr || command_line[0] == '\0') {
     return;
   }
-  if (std::strcmp(command, "STOP") == 0) {
-    g_audio.stop();
-    Serial.println("ACK STOP");
-    return;
+
+  char command[kSerialLineCapacity] = {0};
+  std::strncpy(command, command_line, kSerialLineCapacity - 1U);
+  char* argument = nullptr;
+  for (size_t index = 0; index < kSerialLineCapacity && command[index] != '\0'; ++index) {
+    if (command[index] == ' ') {
+      command[index] = '\0';
+      argument = &command[index + 1U];
+      break;
+    }
   }
-  Serial.printf("UNKNOWN %s\n", command_line);
+  while (argument != nullptr && *argument == ' ') {
+    ++argument;
+  }
+  if (argument != nullptr && *argument == '\0') {
+    argument = nullptr;
+  }
+
+  const CommandId id = CommandRegistry::find(command, std::strlen(command), CommandTransport::kSerial);
+  CommandRegistry& registry = commandRegistry();
+  const uint32_t started_us = registry.beginCall();
+  runSerialCommand(id, argument, command_line, now_ms);
+  registry.endCall(id, CommandTransport::kSerial, started_us, id != CommandId::kUnknown);
 }
 
 void pollSerialCommands(uint32_t now_ms) {
@@ -7157,6 +7362,192 @@ void pollSerialCommands(uint32_t now_ms) {
   }
 }
 
+void loadRuntimeConfigForBoot() {
+  const size_t file_count = sizeof(kBootConfigFiles) / sizeof(kBootConfigFiles[0]);
+  const uint32_t fingerprint = bootConfigFingerprint(g_storage, kBootConfigFiles, file_count);
+  const bool reset_ok = bootResetAllowsSnapshot(bootResetReasonCode());
+  BootSnapshot snapshot;
+  if (reset_ok && bootSnapshotLoad(LittleFS, kBootSnapshotPath, &snapshot) &&
+      snapshot.config_fingerprint == fingerprint) {
+    g_network_cfg = snapshot.network;
+    g_hardware_cfg = snapshot.hardware;
+    g_camera_cfg = snapshot.camera;
+    g_media_cfg = snapshot.media;
+    g_boot_snapshot = snapshot;
+    g_boot_snapshot_loaded = true;
+    Serial.printf("[BOOT] snapshot hit peers=%u (config parse skipped)\n",
+                  static_cast<unsigned int>(snapshot.peer_count));
+  } else {
+    RuntimeConfigService::load(g_storage, &g_network_cfg, &g_hardware_cfg, &g_camera_cfg, &g_media_cfg);
+    g_boot_snapshot = BootSnapshot();
+    g_boot_snapshot.config_fingerprint = fingerprint;
+    g_boot_snapshot.network = g_network_cfg;
+    g_boot_snapshot.hardware = g_hardware_cfg;
+    g_boot_snapshot.camera = g_camera_cfg;
+    g_boot_snapshot.media = g_media_cfg;
+    g_boot_snapshot_loaded = false;
+    Serial.printf("[BOOT] snapshot miss reset_ok=%u\n", reset_ok ? 1U : 0U);
+  }
+  bootNoteSnapshotUsed(g_boot_snapshot_loaded);
+}
+
+// Saved once per boot, after the deferred jobs and a stable run, and only when
+// the configs were reparsed or the peer list changed.
+void maybeSaveBootSnapshot(uint32_t now_ms) {
+  const uint32_t interactive_ms = bootTimings().interactive_ms;
+  if (g_boot_snapshot_saved || !g_boot_scheduler.done() || interactive_ms == 0U ||
+      (now_ms - interactive_ms) < kBootSnapshotStableMs) {
+    return;
+  }
+  g_boot_snapshot_saved = true;
+  BootSnapshot next = g_boot_snapshot;
+  next.peer_count = 0U;
+  std::memset(next.peers, 0, sizeof(next.peers));
+  const uint8_t peer_count = g_network.espNowPeerCount();
+  for (uint8_t index = 0U; index < peer_count && next.peer_count < BootSnapshot::kMaxPeers; ++index) {
+    if (g_network.espNowPeerAt(index, next.peers[next.peer_count], sizeof(next.peers[0]))) {
+      ++next.peer_count;
+    }
+  }
+  bool changed = !g_boot_snapshot_loaded || next.peer_count != g_boot_snapshot.peer_count;
+  for (uint8_t index = 0U; !changed && index < next.peer_count; ++index) {
+    changed = std::strcmp(next.peers[index], g_boot_snapshot.peers[index]) != 0;
+  }
+  if (!changed) {
+    return;
+  }
+  const bool ok = bootSnapshotSave(LittleFS, kBootSnapshotPath, next);
+  if (ok) {
+    g_boot_snapshot = next;
+  }
+  Serial.printf("[BOOT] snapshot saved=%u peers=%u\n", ok ? 1U : 0U, static_cast<unsigned int>(next.peer_count));
+}
+
+bool bootJobHardware(uint32_t now_ms) {
+  if (!g_hardware_cfg.enabled_on_boot) {
+    g_hardware_started = false;
+    Serial.println("[HW] disabled by APP_HARDWARE config");
+    return true;
+  }
+  g_hardware_started = g_hardware.begin();
+  g_next_hw_telemetry_ms = now_ms + g_hardware_cfg.telemetry_period_ms;
+  g_mic_event_armed = true;
+  g_battery_low_latched = false;
+  resetLaTriggerState(false);
+  if (g_hardware_started && g_hardware.micDriverReady()) {
+    // Recording takes over the I2S mic; the LA/level sampling pauses meanwhile.
+    g_media.attachMic(g_hardware.micPort(), g_hardware.micSampleRate(), [](bool) { applyMicRuntimePolicy(); });
+  }
+  return g_hardware_started;
+}
+
+bool bootJobNetwork(uint32_t now_ms) {
+  g_network.begin(g_network_cfg.hostname);
+  if (kBootEspNowOnlyMode) {
+    g_network.configureFallbackAp("", "");
+    g_network.configureLocalPolicy("", "", false, g_network_cfg.local_retry_ms, false);
+    Serial.println("[NET] wifi+web disabled (espnow_only_mode=1)");
+  } else {
+    g_network.configureFallbackAp(g_network_cfg.ap_default_ssid, g_network_cfg.ap_default_password);
+    g_network.configureLocalPolicy(g_network_cfg.local_ssid,
+                                   g_network_cfg.local_password,
+                                   g_network_cfg.force_ap_if_not_local,
+                                   g_network_cfg.local_retry_ms,
+                                   g_network_cfg.pause_local_retry_when_ap_client);
+    if (g_setup_mode && g_network_cfg.ap_default_ssid[0] != '\0') {
+      g_network.startAp(g_network_cfg.ap_default_ssid, g_network_cfg.ap_default_password);
+    }
+    if (g_network_cfg.local_ssid[0] != '\0') {
+      const bool connect_started = g_network.connectSta(g_network_cfg.local_ssid, g_network_cfg.local_password);
+      Serial.printf("[NET] boot wifi target=%s started=%u\n",
+                    g_network_cfg.local_ssid,
+                    connect_started ? 1U : 0U);
+    }
+  }
+  uint8_t restored_peers = 0U;
+  if (g_network_cfg.espnow_enabled_on_boot) {
+    if (g_network.enableEspNow()) {
+      for (uint8_t index = 0U; index < g_network_cfg.espnow_boot_peer_count; ++index) {
+        const char* peer = g_network_cfg.espnow_boot_peers[index];
+        if (peer == nullptr || peer[0] == '\0') {
+          continue;
+        }
+        const bool ok = g_network.addEspNowPeer(peer);
+        Serial.printf("[NET] boot peer add mac=%s ok=%u\n", peer, ok ? 1U : 0U);
+      }
+      for (uint8_t index = 0U; g_boot_snapshot_loaded && index < g_boot_snapshot.peer_count; ++index) {
+        if (g_network.addEspNowPeer(g_boot_snapshot.peers[index])) {
+          ++restored_peers;
+        }
+      }
+      if (restored_peers > 0U) {
+        Serial.printf("[NET] boot snapshot peers restored=%u\n", static_cast<unsigned int>(restored_peers));
+      }
+    }
+  } else {
+    Serial.println("[NET] ESP-NOW boot disabled by APP_ESPNOW config");
+  }
+  g_next_espnow_discovery_ms = now_ms + ((restored_peers > 0U) ? kBootSnapshotDiscoveryDelayMs : 2000U);
+  return true;
+}
+
+bool bootJobCamera(uint32_t now_ms) {
+  (void)now_ms;
+  if (!g_camera_cfg.enabled_on_boot) {
+    return true;
+  }
+  String cam_error;
+  if (!approveCameraOperation("boot_cam_on", &cam_error)) {
+    Serial.printf("[CAM] boot start blocked profile=%s\n", g_resource_coordinator.profileName());
+    return false;
+  }
+  const bool cam_ok = g_camera.start();
+  Serial.printf("[CAM] boot start=%u\n", cam_ok ? 1U : 0U);
+  return cam_ok;
+}
+
+bool bootJobWebUi(uint32_t now_ms) {
+  (void)now_ms;
+  if (kBootEspNowOnlyMode) {
+    Serial.println("[WEB] disabled (espnow_only_mode=1)");
+    return true;
+  }
+  setupWebUi();
+  return g_web_started;
+}
+
+bool bootJobStorySync(uint32_t now_ms) {
+  // Tree sync runs from the loop; an interrupted one resumes from its journal.
+  // A run that changes the scenario reloads it when it finishes.
+  if (g_storage.resumeStorySync(now_ms)) {
+    return true;
+  }
+  if (kAutoSyncStoryFromSdOnBoot && g_storage.hasSdCard()) {
+    return g_storage.beginStorySync(now_ms);
+  }
+  if (g_storage.hasSdCard()) {
+    Serial.println("[MAIN] SD story sync disabled on boot (LittleFS is primary)");
+  }
+  return true;
+}
+
+bool bootJobVerify(uint32_t now_ms) {
+  g_storage.scheduleBundleVerification(now_ms);
+  Serial.printf("[MAIN] default scenario checksum=%lu\n",
+                static_cast<unsigned long>(g_storage.checksum(kDefaultScenarioFile)));
+  Serial.printf("[MAIN] story storage sd=%u\n", g_storage.hasSdCard() ? 1U : 0U);
+  return true;
+}
+
+void registerDeferredBootJobs() {
+  g_boot_scheduler.add("hardware", BootPhase::kAfterFirstFrame, 0U, bootJobHardware);
+  g_boot_scheduler.add("network", BootPhase::kAfterFirstFrame, 1U, bootJobNetwork);
+  g_boot_scheduler.add("story_sync", BootPhase::kAfterInteractive, 0U, bootJobStorySync);
+  g_boot_scheduler.add("camera", BootPhase::kAfterInteractive, 1U, bootJobCamera);
+  g_boot_scheduler.add("web_ui", BootPhase::kAfterInteractive, 2U, bootJobWebUi);
+  g_boot_scheduler.add("verify", BootPhase::kAfterInteractive, 3U, bootJobVerify);
+}
+
 }  // namespace
 
 void setup() {
@@ -7170,7 +7561,12 @@ void setup() {
   g_runtime_serial_service.configure(handleSerialCommandImpl, dispatchControlActionImpl);
   g_runtime_scene_service.configure(refreshSceneIfNeededImpl, startPendingAudioIfAny);
   g_runtime_web_service.configure(setupWebUiImpl);
+  g_scenario.setDeadlineQueue(&g_deadlines);
+  g_la_timeout_timer = g_deadlines.acquire("la_gate_timeout");
 
+  // Staged boot: only what the first scene needs runs here. Hardware and
+  // network start from the loop right after; SD sync, camera, web UI and
+  // checksum work wait until the first scene is interactive (boot_scheduler).
   if (!g_storage.begin()) {
     Serial.println("[MAIN] storage init failed");
   }
@@ -7189,16 +7585,8 @@ void setup() {
   g_storage.ensurePath("/audio");
   g_storage.ensurePath("/recorder");
   g_storage.ensureDefaultStoryBundle();
-  if (kAutoSyncStoryFromSdOnBoot && g_storage.hasSdCard()) {
-    g_storage.syncStoryTreeFromSd();
-  }
   g_storage.ensureDefaultScenarioFile(kDefaultScenarioFile);
-  if (kAutoSyncStoryFromSdOnBoot && g_storage.hasSdCard()) {
-    g_storage.syncStoryFileFromSd(kDefaultScenarioFile);
-  } else if (g_storage.hasSdCard()) {
-    Serial.println("[MAIN] SD story sync disabled on boot (LittleFS is primary)");
-  }
-  RuntimeConfigService::load(g_storage, &g_network_cfg, &g_hardware_cfg, &g_camera_cfg, &g_media_cfg);
+  loadRuntimeConfigForBoot();
   loadBootProvisioningState();
   loadEspNowDeviceNameFromNvs();
   {
@@ -7213,9 +7601,6 @@ void setup() {
                   g_boot_mode_store.isMediaValidated() ? 1U : 0U);
   }
   g_resource_coordinator.begin();
-  Serial.printf("[MAIN] default scenario checksum=%lu\n",
-                static_cast<unsigned long>(g_storage.checksum(kDefaultScenarioFile)));
-  Serial.printf("[MAIN] story storage sd=%u\n", g_storage.hasSdCard() ? 1U : 0U);
   Serial.printf("[AUTH] setup_mode=%u auth_required=%u token_set=%u\n",
                 g_setup_mode ? 1U : 0U,
                 g_web_auth_required ? 1U : 0U,
@@ -7232,72 +7617,28 @@ void setup() {
     g_audio.playDiagnosticTone();
   }
 
+  g_ui.begin();
+  applyLcdBacklight(g_lcd_backlight_level);
+  g_ui.setHardwareController(&g_hardware);
+  UiLaMetrics boot_la_metrics = {};
+  boot_la_metrics.locked = false;
+  boot_la_metrics.stability_pct = 0U;
+  boot_la_metrics.stable_ms = 0U;
+  boot_la_metrics.stable_target_ms = g_hardware_cfg.mic_la_stable_ms;
+  boot_la_metrics.gate_elapsed_ms = 0U;
+  boot_la_metrics.gate_timeout_ms = g_hardware_cfg.mic_la_timeout_ms;
+  g_ui.setLaMetrics(boot_la_metrics);
+  g_ui.setHardwareSnapshotRef(&g_hardware.snapshotRef());
+  g_ui.tick(millis());
+  g_boot_scheduler.markFirstFrame(millis());
+
+  // Config only; the camera sensor itself starts as a deferred job.
   g_media.begin(g_media_cfg);
   g_camera.begin(g_camera_cfg);
-  if (g_camera_cfg.enabled_on_boot) {
-    String cam_error;
-    if (approveCameraOperation("boot_cam_on", &cam_error)) {
-      const bool cam_ok = g_camera.start();
-      Serial.printf("[CAM] boot start=%u\n", cam_ok ? 1U : 0U);
-    } else {
-      Serial.printf("[CAM] boot start blocked profile=%s\n", g_resource_coordinator.profileName());
-    }
-  }
-  if (g_hardware_cfg.enabled_on_boot) {
-    g_hardware_started = g_hardware.begin();
-    g_next_hw_telemetry_ms = millis() + g_hardware_cfg.telemetry_period_ms;
-    g_mic_event_armed = true;
-    g_battery_low_latched = false;
-    resetLaTriggerState(false);
-  } else {
-    g_hardware_started = false;
-    Serial.println("[HW] disabled by APP_HARDWARE config");
-  }
-
+  g_camera.setOperationGate([](const char* operation) { return approveCameraOperation(operation, nullptr); });
+  g_ui.attachQrCamera(&g_camera);
   g_buttons.begin();
   g_touch.begin();
-  g_network.begin(g_network_cfg.hostname);
-  if (kBootEspNowOnlyMode) {
-    g_network.configureFallbackAp("", "");
-    g_network.configureLocalPolicy("", "", false, g_network_cfg.local_retry_ms, false);
-    Serial.println("[NET] wifi+web disabled (espnow_only_mode=1)");
-  } else {
-    g_network.configureFallbackAp(g_network_cfg.ap_default_ssid, g_network_cfg.ap_default_password);
-    g_network.configureLocalPolicy(g_network_cfg.local_ssid,
-                                   g_network_cfg.local_password,
-                                   g_network_cfg.force_ap_if_not_local,
-                                   g_network_cfg.local_retry_ms,
-                                   g_network_cfg.pause_local_retry_when_ap_client);
-    if (g_setup_mode && g_network_cfg.ap_default_ssid[0] != '\0') {
-      g_network.startAp(g_network_cfg.ap_default_ssid, g_network_cfg.ap_default_password);
-    }
-    if (g_network_cfg.local_ssid[0] != '\0') {
-      const bool connect_started = g_network.connectSta(g_network_cfg.local_ssid, g_network_cfg.local_password);
-      Serial.printf("[NET] boot wifi target=%s started=%u\n",
-                    g_network_cfg.local_ssid,
-                    connect_started ? 1U : 0U);
-    }
-  }
-  if (g_network_cfg.espnow_enabled_on_boot) {
-    if (g_network.enableEspNow()) {
-      for (uint8_t index = 0U; index < g_network_cfg.espnow_boot_peer_count; ++index) {
-        const char* peer = g_network_cfg.espnow_boot_peers[index];
-        if (peer == nullptr || peer[0] == '\0') {
-          continue;
-        }
-        const bool ok = g_network.addEspNowPeer(peer);
-        Serial.printf("[NET] boot peer add mac=%s ok=%u\n", peer, ok ? 1U : 0U);
-      }
-    }
-  } else {
-    Serial.println("[NET] ESP-NOW boot disabled by APP_ESPNOW config");
-  }
-  g_next_espnow_discovery_ms = millis() + 2000U;
-  if (!kBootEspNowOnlyMode) {
-    setupWebUi();
-  } else {
-    Serial.println("[WEB] disabled (espnow_only_mode=1)");
-  }
   if (!g_scenario.begin(kDefaultScenarioFile)) {
     Serial.println("[MAIN] scenario init failed");
   }
@@ -7311,20 +7652,8 @@ void setup() {
     const bool routed = g_scenario.gotoScene(kDefaultBootSceneId, millis(), "boot_story_default");
     Serial.printf("[BOOT] route default scene=%s ok=%u\n", kDefaultBootSceneId, routed ? 1U : 0U);
   }
-  g_last_action_step_key[0] = '\0';
+  g_step_action_gate.invalidate();
 
-  g_ui.begin();
-  applyLcdBacklight(g_lcd_backlight_level);
-  g_ui.setHardwareController(&g_hardware);
-  UiLaMetrics boot_la_metrics = {};
-  boot_la_metrics.locked = false;
-  boot_la_metrics.stability_pct = 0U;
-  boot_la_metrics.stable_ms = 0U;
-  boot_la_metrics.stable_target_ms = g_hardware_cfg.mic_la_stable_ms;
-  boot_la_metrics.gate_elapsed_ms = 0U;
-  boot_la_metrics.gate_timeout_ms = g_hardware_cfg.mic_la_timeout_ms;
-  g_ui.setLaMetrics(boot_la_metrics);
-  g_ui.setHardwareSnapshotRef(&g_hardware.snapshotRef());
 #if defined(USE_AUDIO) && (USE_AUDIO != 0)
   g_amp_ready = false;
   g_amp_scene_active = false;
@@ -7354,6 +7683,7 @@ void setup() {
   g_runtime_services.tick_runtime = runtimeTickBridge;
   g_runtime_services.dispatch_serial = serialDispatchBridge;
   g_app_coordinator.begin(&g_runtime_services);
+  registerDeferredBootJobs();
 }
 
 void runRuntimeIteration(uint32_t now_ms) {
@@ -7404,6 +7734,12 @@ void runRuntimeIteration(uint32_t now_ms) {
     g_ui.submitInputEvent(ui_event);
   }
 
+  g_storage.updateVerification(now_ms);
+  if (g_storage.updateStorySync(now_ms)) {
+    const bool reloaded = reloadScenarioAfterStorySync();
+    Serial.printf("[SCENARIO] reload after background sd sync=%u\n", reloaded ? 1U : 0U);
+  }
+
   const uint32_t network_started_us = perfMonitor().beginSample();
   g_network.update(now_ms);
   maybeRunEspNowDiscoveryRuntime(now_ms);
@@ -7416,22 +7752,11 @@ void runRuntimeIteration(uint32_t now_ms) {
     maybeLogHardwareTelemetry(now_ms);
     maybeStreamMicTunerStatus(now_ms);
   }
-  char net_payload[192] = {0};
-  char net_peer[18] = {0};
-  char net_msg_id[32] = {0};
-  char net_type[24] = {0};
-  uint32_t net_seq = 0U;
-  bool net_ack_requested = false;
-  while (g_network.consumeEspNowMessage(net_payload,
-                                        sizeof(net_payload),
-                                        net_peer,
-                                        sizeof(net_peer),
-                                        net_msg_id,
-                                        sizeof(net_msg_id),
-                                        &net_seq,
-                                        net_type,
-                                        sizeof(net_type),
-                                        &net_ack_requested)) {
+  NetworkManager::EspNowInbound net_message;
+  while (g_network.consumeEspNowMessage(&net_message)) {
+    const char* net_payload = net_message.payload;
+    const char* net_peer = net_message.peer;
+    const char* net_type = net_message.type;
     EspNowCommandResult command_result;
     bool handled_as_command = false;
     if (net_type[0] != '\0' && std::strcmp(net_type, "command") == 0) {
@@ -7442,11 +7767,15 @@ void runRuntimeIteration(uint32_t now_ms) {
         command_result.code = "command";
         command_result.error = "unsupported_command";
       }
-      sendEspNowAck(net_peer, net_msg_id, net_seq, command_result, net_ack_requested);
+      if (net_message.binary) {
+        sendEspNowResult(net_peer, net_message.request_id, command_result);
+      } else {
+        sendEspNowAck(net_peer, net_message.msg_id, net_message.seq, command_result, net_message.ack_requested);
+      }
       Serial.printf("[NET] ESPNOW command peer=%s msg_id=%s seq=%lu ok=%u code=%s err=%s\n",
                     net_peer[0] != '\0' ? net_peer : "n/a",
-                    net_msg_id[0] != '\0' ? net_msg_id : "n/a",
-                    static_cast<unsigned long>(net_seq),
+                    net_message.msg_id[0] != '\0' ? net_message.msg_id : "n/a",
+                    static_cast<unsigned long>(net_message.seq),
                     command_result.ok ? 1U : 0U,
                     command_result.code.c_str(),
                     command_result.error.c_str());
@@ -7555,6 +7884,7 @@ void runRuntimeIteration(uint32_t now_ms) {
   }
 #endif
   g_resource_coordinator.update(g_ui.memorySnapshot(), now_ms);
+  g_camera.setStreamPaced(g_resource_coordinator.snapshot().graphics_pressure);
   applyMicRuntimePolicy();
   RuntimeMetrics::instance().noteUiFrame(now_ms);
   perfMonitor().endSample(PerfSection::kUiTick, ui_started_us);
@@ -7567,6 +7897,17 @@ void runRuntimeIteration(uint32_t now_ms) {
       g_network.disconnectSta();
     }
   }
+  if (!g_boot_scheduler.done()) {
+    // The first pass through here has shown the first scene with input live.
+    if (bootTimings().interactive_ms == 0U) {
+      g_boot_scheduler.markInteractive(millis());
+    }
+    if (g_boot_scheduler.update(now_ms) && g_boot_scheduler.done()) {
+      bootPrintTimings();
+    }
+  } else {
+    maybeSaveBootSnapshot(now_ms);
+  }
   yield();
 }
 
@@ -3,6 +3,7 @@
 
 #include <ArduinoJson.h>
 #include <LittleFS.h>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 
@@ -15,19 +16,6 @@ constexpr uint32_t kEtape2DelayMs = 15UL * 60UL * 1000UL;
 constexpr uint32_t kEtape2TestDelayMs = 5000U;
 constexpr uint32_t kWinDueDelayMs = 10UL * 60UL * 1000UL;
 
-bool eventNameMatches(const char* expected, const char* actual, StoryEventType type) {
-  if (expected == nullptr || expected[0] == '\0') {
-    return true;
-  }
-  if (actual == nullptr) {
-    return false;
-  }
-  if (type == StoryEventType::kButton && std::strcmp(expected, "ANY") == 0) {
-    return actual[0] != '\0';
-  }
-  return std::strcmp(expected, actual) == 0;
-}
-
 const char* stringOrNull(JsonVariantConst value) {
   if (!value.is<const char*>()) {
     return nullptr;
@@ -133,6 +121,10 @@ bool loadRuntime3PathFromFile(const char* scenario_file_path, String* out_runtim
 
 }  // namespace
 
+ScenarioManager::ScenarioManager() {
+  acquireTimers();
+}
+
 const char* ScenarioManager::readScenarioField(JsonVariantConst root,
                                                const char* const* candidates,
                                                size_t candidate_count) {
@@ -190,6 +182,9 @@ bool ScenarioManager::begin(const char* scenario_file_path) {
     return false;
   }
 
+  if (!compileScenario()) {
+    return false;
+  }
   if (storyValidateScenarioDef(*scenario_, nullptr)) {
     Serial.printf("[SCENARIO] loaded built-in scenario: %s v%u (%u steps)\n",
                   scenario_->id,
@@ -205,6 +200,16 @@ bool ScenarioManager::begin(const char* scenario_file_path) {
   return true;
 }
 
+bool ScenarioManager::compileScenario() {
+  if (scenario_ != nullptr && graph_.compile(*scenario_)) {
+    return true;
+  }
+  Serial.printf("[SCENARIO] scenario compile failed: %s\n",
+                (scenario_ != nullptr && scenario_->id != nullptr) ? scenario_->id : "null");
+  scenario_ = nullptr;
+  return false;
+}
+
 bool ScenarioManager::beginById(const char* scenario_id) {
   scenario_ = nullptr;
   debug_transition_bypass_enabled_ = false;
@@ -220,6 +225,9 @@ bool ScenarioManager::beginById(const char* scenario_id) {
     return false;
   }
 
+  if (!compileScenario()) {
+    return false;
+  }
   if (storyValidateScenarioDef(*scenario_, nullptr)) {
     Serial.printf("[SCENARIO] loaded built-in scenario by id: %s v%u (%u steps)\n",
                   scenario_->id,
@@ -241,7 +249,7 @@ void ScenarioManager::reset() {
   if (!initial_step_override_.isEmpty()) {
     initial_step_id = initial_step_override_.c_str();
   }
-  current_step_index_ = storyFindStepIndex(*scenario_, initial_step_id);
+  current_step_index_ = static_cast<int8_t>(graph_.stepIndex(initial_step_id));
   if (current_step_index_ < 0 && scenario_->stepCount > 0U) {
     current_step_index_ = 0;
   }
@@ -249,12 +257,9 @@ void ScenarioManager::reset() {
   pending_audio_pack_.remove(0);
   forced_screen_scene_id_.remove(0);
   scene_changed_ = true;
-  timer_armed_ = false;
-  timer_fired_ = false;
-  etape2_due_at_ms_ = 0U;
-  win_due_armed_ = false;
-  win_due_fired_ = false;
-  win_due_at_ms_ = 0U;
+  deadlines_->cancel(etape2_timer_);
+  deadlines_->cancel(win_due_timer_);
+  armAfterMsTimer(0U);
 
   const ScenarioSnapshot state = snapshot();
   if (state.audio_pack_id != nullptr && state.audio_pack_id[0] != '\0') {
@@ -266,13 +271,15 @@ void ScenarioManager::tick(uint32_t now_ms) {
   if (scenario_ == nullptr || current_step_index_ < 0) {
     return;
   }
-  evaluateAfterMsTransitions(now_ms);
-  if (timer_armed_ && !timer_fired_ && etape2_due_at_ms_ > 0U && now_ms >= etape2_due_at_ms_) {
-    timer_fired_ = true;
+  if (deadlines_->isDue(after_ms_timer_, now_ms)) {
+    evaluateAfterMsTransitions(now_ms);
+  }
+  if (deadlines_->isDue(etape2_timer_, now_ms)) {
+    deadlines_->cancel(etape2_timer_);
     dispatchEvent(StoryEventType::kTimer, "ETAPE2_DUE", now_ms, "timer_due");
   }
-  if (win_due_armed_ && !win_due_fired_ && win_due_at_ms_ > 0U && now_ms >= win_due_at_ms_) {
-    win_due_fired_ = true;
+  if (deadlines_->isDue(win_due_timer_, now_ms)) {
+    deadlines_->cancel(win_due_timer_);
     dispatchEvent(StoryEventType::kTimer, "WIN_DUE", now_ms, "timer_win_due");
   }
 }
@@ -282,9 +289,7 @@ void ScenarioManager::notifyUnlock(uint32_t now_ms) {
 }
 
 bool ScenarioManager::notifyUnlockEvent(const char* event_name, uint32_t now_ms) {
-  timer_armed_ = true;
-  timer_fired_ = false;
-  etape2_due_at_ms_ = now_ms + (test_mode_ ? kEtape2TestDelayMs : kEtape2DelayMs);
+  armEtape2Timer(now_ms);
   const char* name = (event_name != nullptr && event_name[0] != '\0') ? event_name : "UNLOCK";
   return dispatchEvent(StoryEventType::kUnlock, name, now_ms, "unlock_event");
 }
@@ -308,17 +313,13 @@ void ScenarioManager::notifyButton(uint8_t key, bool long_press, uint32_t now_ms
   if (step != nullptr && key >= 1U && key <= 5U && step->id != nullptr) {
     const char* screen_scene_id = step->resources.screenSceneId;
     if (std::strcmp(step->id, "STEP_WAIT_ETAPE2") == 0) {
-      timer_armed_ = true;
-      timer_fired_ = false;
-      etape2_due_at_ms_ = now_ms + (test_mode_ ? kEtape2TestDelayMs : kEtape2DelayMs);
+      armEtape2Timer(now_ms);
       return;
     }
     if (screen_scene_id != nullptr &&
         (std::strcmp(screen_scene_id, "SCENE_LA_DETECTOR") == 0 ||
          std::strcmp(screen_scene_id, "SCENE_LA_DETECT") == 0)) {
-      timer_armed_ = true;
-      timer_fired_ = false;
-      etape2_due_at_ms_ = now_ms + (test_mode_ ? kEtape2TestDelayMs : kEtape2DelayMs);
+      armEtape2Timer(now_ms);
       return;
     }
     if (std::strcmp(step->id, "STEP_WAIT_UNLOCK") == 0) {
@@ -453,6 +454,8 @@ bool ScenarioManager::consumeAudioRequest(String* out_audio_pack_id) {
 
 void ScenarioManager::setDebugTransitionBypassEnabled(bool enabled, const char* source) {
   debug_transition_bypass_enabled_ = enabled;
+  // Debug-only after_ms transitions skipped earlier become eligible again.
+  armAfterMsTimer(0U);
   Serial.printf("[SCENARIO] debug bypass %s source=%s\n",
                 debug_transition_bypass_enabled_ ? "ON" : "OFF",
                 (source != nullptr && source[0] != '\0') ? source : "-");
@@ -462,6 +465,33 @@ bool ScenarioManager::debugTransitionBypassEnabled() const {
   return debug_transition_bypass_enabled_;
 }
 
+void ScenarioManager::setDeadlineQueue(StoryDeadlineQueue* deadlines) {
+  StoryDeadlineQueue* next = (deadlines != nullptr) ? deadlines : &own_deadlines_;
+  if (next == deadlines_) {
+    return;
+  }
+  uint32_t etape2_due_at_ms = 0U;
+  uint32_t win_due_at_ms = 0U;
+  const bool etape2_armed = deadlines_->dueAtMs(etape2_timer_, &etape2_due_at_ms);
+  const bool win_due_armed = deadlines_->dueAtMs(win_due_timer_, &win_due_at_ms);
+  deadlines_->cancel(after_ms_timer_);
+  deadlines_->cancel(etape2_timer_);
+  deadlines_->cancel(win_due_timer_);
+  deadlines_ = next;
+  acquireTimers();
+  armAfterMsTimer(0U);
+  if (etape2_armed) {
+    deadlines_->arm(etape2_timer_, etape2_due_at_ms);
+  }
+  if (win_due_armed) {
+    deadlines_->arm(win_due_timer_, win_due_at_ms);
+  }
+}
+
+bool ScenarioManager::nextDueAtMs(uint32_t* out_due_at_ms) const {
+  return deadlines_->nextDueAtMs(out_due_at_ms);
+}
+
 uint32_t ScenarioManager::transitionEventMask() const {
   if (scenario_ == nullptr || scenario_->steps == nullptr) {
     return 0U;
@@ -500,34 +530,42 @@ bool ScenarioManager::dispatchEvent(StoryEventType type,
     return false;
   }
 
-  const TransitionDef* selected = nullptr;
-  for (uint8_t i = 0; i < step->transitionCount; ++i) {
-    const TransitionDef& transition = step->transitions[i];
-    if (!transitionMatches(transition, type, event_name)) {
-      continue;
-    }
-    if (!isTransitionAllowed(transition, "dispatch", event_name)) {
-      continue;
-    }
-    if (selected == nullptr || transition.priority > selected->priority) {
-      selected = &transition;
+  // Candidates come back best first from the compiled graph; the first one
+  // that passes the debug gate wins. transitionCount is a uint8_t, so the
+  // buffer holds every match and a gated prefix never hides a valid edge.
+  uint8_t candidates[UINT8_MAX];
+  const uint8_t candidate_count = graph_.selectEvent(static_cast<uint8_t>(current_step_index_),
+                                                     type,
+                                                     graph_.eventId(event_name),
+                                                     candidates,
+                                                     step->transitionCount);
+  int16_t selected = -1;
+  for (uint8_t i = 0; i < candidate_count; ++i) {
+    if (isTransitionAllowed(step->transitions[candidates[i]], "dispatch", event_name)) {
+      selected = candidates[i];
+      break;
     }
   }
-  if (selected == nullptr) {
+  if (selected < 0) {
     return false;
   }
-  if (!applyTransition(*selected, now_ms, source, event_name)) {
+  if (!applyTransition(static_cast<uint8_t>(selected), now_ms, source, event_name)) {
     return false;
   }
   runImmediateTransitions(now_ms, source, event_name);
   return true;
 }
 
-bool ScenarioManager::applyTransition(const TransitionDef& transition,
+bool ScenarioManager::applyTransition(uint8_t transition_index,
                                       uint32_t now_ms,
                                       const char* source,
                                       const char* event_name) {
-  if (scenario_ == nullptr || transition.targetStepId == nullptr) {
+  const StepDef* step = currentStep();
+  if (step == nullptr || transition_index >= step->transitionCount) {
+    return false;
+  }
+  const TransitionDef& transition = step->transitions[transition_index];
+  if (transition.targetStepId == nullptr) {
     return false;
   }
   if (!isTransitionAllowed(transition, source, event_name)) {
@@ -540,12 +578,13 @@ bool ScenarioManager::applyTransition(const TransitionDef& transition,
                   (event_name != nullptr && event_name[0] != '\0') ? event_name : "-",
                   (source != nullptr && source[0] != '\0') ? source : "-");
   }
-  const int8_t target = storyFindStepIndex(*scenario_, transition.targetStepId);
+  const int16_t target =
+      graph_.targetStepIndex(static_cast<uint8_t>(current_step_index_), transition_index);
   if (target < 0) {
     Serial.printf("[SCENARIO] invalid transition target: %s\n", transition.targetStepId);
     return false;
   }
-  enterStep(target, now_ms, source, event_name);
+  enterStep(static_cast<int8_t>(target), now_ms, source, event_name);
   return true;
 }
 
@@ -557,24 +596,26 @@ bool ScenarioManager::runImmediateTransitions(uint32_t now_ms, const char* sourc
     if (step == nullptr || step->transitionCount == 0U) {
       break;
     }
-    const TransitionDef* selected = nullptr;
-    for (uint8_t i = 0; i < step->transitionCount; ++i) {
-      const TransitionDef& transition = step->transitions[i];
+    const uint8_t step_index = static_cast<uint8_t>(current_step_index_);
+    const uint8_t implicit_count = graph_.implicitCount(step_index);
+    int16_t selected = -1;
+    for (uint8_t rank = 0; rank < implicit_count; ++rank) {
+      const uint8_t index = graph_.implicitTransition(step_index, rank);
+      const TransitionDef& transition = step->transitions[index];
       if (transition.trigger != StoryTransitionTrigger::kImmediate) {
         continue;
       }
       if (!isTransitionAllowed(transition, "immediate", parent_event_name)) {
         continue;
       }
-      if (selected == nullptr || transition.priority > selected->priority) {
-        selected = &transition;
-      }
+      selected = index;
+      break;
     }
-    if (selected == nullptr) {
+    if (selected < 0) {
       break;
     }
     ++hop_count;
-    if (!applyTransition(*selected, now_ms, source, parent_event_name != nullptr ? parent_event_name : "immediate")) {
+    if (!applyTransition(static_cast<uint8_t>(selected), now_ms, source, parent_event_name != nullptr ? parent_event_name : "immediate")) {
       break;
     }
     moved = true;
@@ -594,27 +635,70 @@ void ScenarioManager::evaluateAfterMsTransitions(uint32_t now_ms) {
     return;
   }
 
-  const TransitionDef* selected = nullptr;
-  for (uint8_t i = 0; i < step->transitionCount; ++i) {
-    const TransitionDef& transition = step->transitions[i];
+  const uint8_t step_index = static_cast<uint8_t>(current_step_index_);
+  const uint8_t implicit_count = graph_.implicitCount(step_index);
+  const uint32_t elapsed_ms = now_ms - step_entered_at_ms_;
+  int16_t selected = -1;
+  for (uint8_t rank = 0; rank < implicit_count; ++rank) {
+    const uint8_t index = graph_.implicitTransition(step_index, rank);
+    const TransitionDef& transition = step->transitions[index];
     if (transition.trigger != StoryTransitionTrigger::kAfterMs) {
       continue;
     }
-    if (!isTransitionAllowed(transition, "after_ms", "after_ms")) {
+    if (elapsed_ms < transition.afterMs) {
       continue;
     }
-    if (now_ms - step_entered_at_ms_ < transition.afterMs) {
+    if (!isTransitionAllowed(transition, "after_ms", "after_ms")) {
       continue;
     }
-    if (selected == nullptr || transition.priority > selected->priority) {
-      selected = &transition;
-    }
+    selected = index;
+    break;
+  }
+  if (selected < 0) {
+    // Everything due was blocked: wait for the next later after_ms (or a
+    // bypass change, which re-arms from step entry).
+    armAfterMsTimer(elapsed_ms + 1U);
+    return;
+  }
+  if (applyTransition(static_cast<uint8_t>(selected), now_ms, "after_ms", "after_ms")) {
+    runImmediateTransitions(now_ms, "after_ms", "after_ms");
   }
-  if (selected != nullptr) {
-    if (applyTransition(*selected, now_ms, "after_ms", "after_ms")) {
-      runImmediateTransitions(now_ms, "after_ms", "after_ms");
+}
+
+void ScenarioManager::acquireTimers() {
+  after_ms_timer_ = deadlines_->acquire("scenario_after_ms");
+  etape2_timer_ = deadlines_->acquire("scenario_etape2");
+  win_due_timer_ = deadlines_->acquire("scenario_win_due");
+}
+
+void ScenarioManager::armAfterMsTimer(uint32_t min_after_ms) {
+  // Next after_ms threshold of the current step at or beyond min_after_ms.
+  const StepDef* step = currentStep();
+  bool found = false;
+  uint32_t next_after_ms = 0U;
+  if (step != nullptr) {
+    const uint8_t step_index = static_cast<uint8_t>(current_step_index_);
+    const uint8_t implicit_count = graph_.implicitCount(step_index);
+    for (uint8_t rank = 0; rank < implicit_count; ++rank) {
+      const TransitionDef& transition = step->transitions[graph_.implicitTransition(step_index, rank)];
+      if (transition.trigger != StoryTransitionTrigger::kAfterMs || transition.afterMs < min_after_ms) {
+        continue;
+      }
+      if (!found || transition.afterMs < next_after_ms) {
+        next_after_ms = transition.afterMs;
+        found = true;
+      }
     }
   }
+  if (!found) {
+    deadlines_->cancel(after_ms_timer_);
+    return;
+  }
+  deadlines_->arm(after_ms_timer_, step_entered_at_ms_ + next_after_ms);
+}
+
+void ScenarioManager::armEtape2Timer(uint32_t now_ms) {
+  deadlines_->arm(etape2_timer_, now_ms + (test_mode_ ? kEtape2TestDelayMs : kEtape2DelayMs));
 }
 
 void ScenarioManager::enterStep(int8_t step_index, uint32_t now_ms, const char* source, const char* event_name) {
@@ -650,13 +734,10 @@ void ScenarioManager::enterStep(int8_t step_index, uint32_t now_ms, const char*
   if (audio_pack_id != nullptr && audio_pack_id[0] != '\0') {
     pending_audio_pack_ = audio_pack_id;
   }
-  win_due_armed_ = false;
-  win_due_fired_ = false;
-  win_due_at_ms_ = 0U;
+  armAfterMsTimer(0U);
+  deadlines_->cancel(win_due_timer_);
   if (screen_scene_id != nullptr && std::strcmp(screen_scene_id, "SCENE_FINAL_WIN") == 0) {
-    win_due_armed_ = true;
-    win_due_fired_ = false;
-    win_due_at_ms_ = now_ms + kWinDueDelayMs;
+    deadlines_->arm(win_due_timer_, now_ms + kWinDueDelayMs);
   }
   Serial.printf("[SCENARIO] transition from_step=%s to_step=%s from_scene=%s to_scene=%s event=%s source=%s audio_pack=%s\n",
                 from_step,
@@ -675,18 +756,6 @@ const StepDef* ScenarioManager::currentStep() const {
   return &scenario_->steps[current_step_index_];
 }
 
-bool ScenarioManager::transitionMatches(const TransitionDef& transition,
-                                        StoryEventType type,
-                                        const char* event_name) const {
-  if (transition.trigger != StoryTransitionTrigger::kOnEvent) {
-    return false;
-  }
-  if (transition.eventType != type) {
-    return false;
-  }
-  return eventNameMatches(transition.eventName, event_name, type);
-}
-
 bool ScenarioManager::isTransitionAllowed(const TransitionDef& transition,
                                           const char* context,
                                           const char* event_name) const {
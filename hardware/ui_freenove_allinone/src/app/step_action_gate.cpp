@@ -0,0 +1,27 @@
+// step_action_gate.cpp - when a scenario step's actions run.
+#include "app/step_action_gate.h"
+
+#include <cstring>
+
+StepActionGate::Decision StepActionGate::enter(const char* step_key, bool has_actions) {
+  Decision decision;
+  if (step_key == nullptr) {
+    step_key = "";
+  }
+  // Keys longer than the buffer compare on the part that was kept.
+  if (std::strncmp(step_key, last_key_, kKeyCapacity - 1U) != 0) {
+    std::strncpy(last_key_, step_key, kKeyCapacity - 1U);
+    last_key_[kKeyCapacity - 1U] = '\0';
+    decision.step_changed = true;
+  }
+  decision.run_actions = has_actions;
+  return decision;
+}
+
+void StepActionGate::invalidate() {
+  last_key_[0] = '\0';
+}
+
+const char* StepActionGate::lastKey() const {
+  return last_key_;
+}
@@ -7,7 +7,11 @@
 #include <algorithm>
 #include <cctype>
 #include <cstring>
+#include <memory>
+#include <new>
+#include <vector>
 
+#include "camera/jpeg_stream_encoder.h"
 #include "ui_freenove_config.h"
 
 #if defined(ARDUINO_ARCH_ESP32) && __has_include(<esp_camera.h>) && FREENOVE_CAM_ENABLE
@@ -93,7 +97,68 @@ void writeLe32(File& file, uint32_t value) {
   file.write(bytes, sizeof(bytes));
 }
 
+bool writeJpegChunk(void* ctx, const uint8_t* data, size_t len) {
+  return static_cast<File*>(ctx)->write(data, len) == len;
+}
+
+bool previewSourceOf(const camera::FrameDesc& frame, runtime::simd::DownscaleSource* out) {
+  if (frame.format == camera::FrameFormat::kRgb565) {
+    *out = runtime::simd::DownscaleSource::kRgb565;
+    return true;
+  }
+  if (frame.format == camera::FrameFormat::kYuv422) {
+    *out = runtime::simd::DownscaleSource::kYuv422;
+    return true;
+  }
+  return false;
+}
+
 #if ZACUS_HAS_CAMERA
+void returnDriverFrame(void* owner, void* handle) {
+  (void)owner;
+  esp_camera_fb_return(static_cast<camera_fb_t*>(handle));
+}
+
+// Pipeline idle callback: runs once no FrameRef points into driver buffers.
+void deinitDriver(void* owner) {
+  (void)owner;
+  esp_camera_deinit();
+}
+
+// Zero-copy view of a driver frame; the pipeline hands it back to the driver
+// once the last consumer releases it.
+camera::FrameDesc describeDriverFrame(camera_fb_t* frame) {
+  camera::FrameDesc desc;
+  desc.data = frame->buf;
+  desc.bytes = frame->len;
+  desc.width = static_cast<uint16_t>(frame->width);
+  desc.height = static_cast<uint16_t>(frame->height);
+  desc.timestamp_ms = millis();
+  desc.release = returnDriverFrame;
+  desc.handle = frame;
+  switch (frame->format) {
+    case PIXFORMAT_GRAYSCALE:
+      desc.format = camera::FrameFormat::kGray8;
+      desc.stride = desc.width;
+      break;
+    case PIXFORMAT_RGB565:
+      desc.format = camera::FrameFormat::kRgb565;
+      desc.stride = static_cast<uint16_t>(desc.width * 2U);
+      break;
+    case PIXFORMAT_YUV422:
+      desc.format = camera::FrameFormat::kYuv422;
+      desc.stride = static_cast<uint16_t>(desc.width * 2U);
+      break;
+    case PIXFORMAT_JPEG:
+      desc.format = camera::FrameFormat::kJpeg;
+      break;
+    default:
+      desc.format = camera::FrameFormat::kUnknown;
+      break;
+  }
+  return desc;
+}
+
 framesize_t frameSizeFromText(const char* text) {
   if (text == nullptr || text[0] == '\0') {
     return FRAMESIZE_VGA;
@@ -259,15 +324,10 @@ bool CameraManager::begin(const Config& config) {
   snapshot_.xclk_hz = config_.xclk_hz;
   copyText(snapshot_.frame_size, sizeof(snapshot_.frame_size), config_.frame_size);
   copyText(snapshot_.snapshot_dir, sizeof(snapshot_.snapshot_dir), config_.snapshot_dir);
-  recorder_mode_ = false;
+  mode_ = CaptureMode::kDefault;
   recorder_frozen_ = false;
-  recorder_frozen_fb_ = nullptr;
-  preview_map_src_w_ = 0;
-  preview_map_src_h_ = 0;
-  preview_map_dst_w_ = 0;
-  preview_map_dst_h_ = 0;
-  preview_x_map_.clear();
-  preview_y_map_.clear();
+  recorder_frozen_frame_.reset();
+  preview_scaler_.reset();
   return true;
 }
 
@@ -294,23 +354,45 @@ String CameraManager::buildSnapshotPath(const char* filename_hint) const {
   return file;
 }
 
-bool CameraManager::initCameraForMode(bool recorder_mode) {
+const char* CameraManager::modeName(CaptureMode mode) {
+  switch (mode) {
+    case CaptureMode::kRecorder:
+      return "recorder";
+    case CaptureMode::kLumaScan:
+      return "luma_scan";
+    case CaptureMode::kDefault:
+    default:
+      return "default";
+  }
+}
+
+bool CameraManager::initCameraForMode(CaptureMode mode) {
 #if !ZACUS_HAS_CAMERA
-  (void)recorder_mode;
+  (void)mode;
   setLastError("camera_not_supported");
   return false;
 #else
-  if (snapshot_.initialized && recorder_mode_ == recorder_mode) {
+  const bool recorder_mode = (mode == CaptureMode::kRecorder);
+  if (snapshot_.initialized && mode_ == mode) {
     snapshot_.enabled = true;
     snapshot_.recorder_session_active = recorder_mode;
     return true;
   }
 
+  stopLumaTask();
   recorderDiscardFrozen();
   if (snapshot_.initialized) {
-    esp_camera_deinit();
+    releaseDriver();
     snapshot_.initialized = false;
   }
+  if (pipeline_.idleCallPending()) {
+    // The previous driver goes away when its last frame is released.
+    snapshot_.enabled = false;
+    snapshot_.recorder_session_active = false;
+    mode_ = CaptureMode::kDefault;
+    setLastError("camera_frames_in_use");
+    return false;
+  }
 
   camera_config_t cfg = {};
   cfg.ledc_channel = LEDC_CHANNEL_0;
@@ -333,6 +415,11 @@ bool CameraManager::initCameraForMode(bool recorder_mode) {
   cfg.pin_reset = FREENOVE_CAM_RESET;
   cfg.xclk_freq_hz = config_.xclk_hz;
   cfg.fb_count = recorder_mode ? 1U : config_.fb_count;
+  if (mode == CaptureMode::kLumaScan) {
+    // The latest frame and the one being decoded stay referenced in the
+    // pipeline while the driver fills the third.
+    cfg.fb_count = 3U;
+  }
 #if defined(CAMERA_GRAB_LATEST)
   cfg.grab_mode = CAMERA_GRAB_LATEST;
 #endif
@@ -344,6 +431,10 @@ bool CameraManager::initCameraForMode(bool recorder_mode) {
     cfg.pixel_format = PIXFORMAT_RGB565;
     cfg.frame_size = FRAMESIZE_QVGA;
     cfg.jpeg_quality = 12U;
+  } else if (mode == CaptureMode::kLumaScan) {
+    cfg.pixel_format = PIXFORMAT_GRAYSCALE;
+    cfg.frame_size = FRAMESIZE_QVGA;
+    cfg.jpeg_quality = 12U;
   } else {
     cfg.pixel_format = PIXFORMAT_JPEG;
     cfg.frame_size = frameSizeFromText(config_.frame_size);
@@ -352,11 +443,11 @@ bool CameraManager::initCameraForMode(bool recorder_mode) {
 
   esp_err_t status = esp_camera_init(&cfg);
   if (status != ESP_OK) {
-    Serial.printf("[CAM] init failed mode=%s err=0x%x\n", recorder_mode ? "recorder" : "default", static_cast<unsigned int>(status));
+    Serial.printf("[CAM] init failed mode=%s err=0x%x\n", modeName(mode), static_cast<unsigned int>(status));
     camera_config_t fallback = cfg;
-    if (recorder_mode) {
+    if (mode != CaptureMode::kDefault) {
       fallback.frame_size = FRAMESIZE_QQVGA;
-      fallback.fb_count = 1U;
+      fallback.fb_count = (mode == CaptureMode::kLumaScan) ? 2U : 1U;
     } else {
       fallback.frame_size = FRAMESIZE_QVGA;
       fallback.jpeg_quality = (fallback.jpeg_quality < 20U) ? 20U : fallback.jpeg_quality;
@@ -375,7 +466,7 @@ bool CameraManager::initCameraForMode(bool recorder_mode) {
     snapshot_.enabled = false;
     snapshot_.initialized = false;
     snapshot_.recorder_session_active = false;
-    recorder_mode_ = false;
+    mode_ = CaptureMode::kDefault;
     setLastError("camera_init_failed");
     return false;
   }
@@ -387,14 +478,14 @@ bool CameraManager::initCameraForMode(bool recorder_mode) {
   copyText(snapshot_.frame_size, sizeof(snapshot_.frame_size), frameSizeToText(cfg.frame_size));
   snapshot_.width = frameSizeWidth(cfg.frame_size);
   snapshot_.height = frameSizeHeight(cfg.frame_size);
-  recorder_mode_ = recorder_mode;
+  mode_ = mode;
   snapshot_.recorder_session_active = recorder_mode;
   snapshot_.recorder_frozen = false;
   snapshot_.recorder_preview_width = recorder_mode ? snapshot_.width : 0U;
   snapshot_.recorder_preview_height = recorder_mode ? snapshot_.height : 0U;
   clearLastError();
   Serial.printf("[CAM] ready mode=%s frame=%s quality=%u fb=%u xclk=%lu\n",
-                recorder_mode ? "recorder" : "default",
+                modeName(mode),
                 snapshot_.frame_size,
                 static_cast<unsigned int>(snapshot_.jpeg_quality),
                 static_cast<unsigned int>(snapshot_.fb_count),
@@ -404,11 +495,15 @@ bool CameraManager::initCameraForMode(bool recorder_mode) {
 }
 
 bool CameraManager::start() {
-  return initCameraForMode(false);
+  return initCameraForMode(CaptureMode::kDefault);
 }
 
 bool CameraManager::startRecorderSession() {
-  return initCameraForMode(true);
+  if (mode_ == CaptureMode::kLumaScan && snapshot_.initialized) {
+    setLastError("camera_busy_luma_stream");
+    return false;
+  }
+  return initCameraForMode(CaptureMode::kRecorder);
 }
 
 void CameraManager::stopRecorderSession() {
@@ -416,7 +511,7 @@ void CameraManager::stopRecorderSession() {
   if (!snapshot_.supported) {
     return;
   }
-  if (recorder_mode_) {
+  if (mode_ == CaptureMode::kRecorder) {
     stop();
     (void)start();
   } else {
@@ -426,10 +521,13 @@ void CameraManager::stopRecorderSession() {
 }
 
 void CameraManager::stop() {
+  // Consumers first: the luma task stops publishing and its latest frame is
+  // dropped, the frozen recorder frame is released.
+  stopLumaTask();
   recorderDiscardFrozen();
 #if ZACUS_HAS_CAMERA
   if (snapshot_.initialized) {
-    esp_camera_deinit();
+    releaseDriver();
   }
 #endif
   snapshot_.initialized = false;
@@ -438,7 +536,7 @@ void CameraManager::stop() {
   snapshot_.recorder_frozen = false;
   snapshot_.recorder_preview_width = 0U;
   snapshot_.recorder_preview_height = 0U;
-  recorder_mode_ = false;
+  mode_ = CaptureMode::kDefault;
 }
 
 bool CameraManager::isEnabled() const {
@@ -446,7 +544,7 @@ bool CameraManager::isEnabled() const {
 }
 
 bool CameraManager::recorderSessionActive() const {
-  return recorder_mode_ && snapshot_.enabled;
+  return mode_ == CaptureMode::kRecorder && snapshot_.enabled;
 }
 
 bool CameraManager::saveRgb565AsBmp24(const char* path,
@@ -504,6 +602,41 @@ bool CameraManager::saveRgb565AsBmp24(const char* path,
   return true;
 }
 
+bool CameraManager::saveRgb565AsJpeg(const char* path,
+                                     const uint16_t* rgb565,
+                                     int w,
+                                     int h,
+                                     int stride_px) {
+  if (path == nullptr || rgb565 == nullptr || w <= 0 || h <= 0 || stride_px < w) {
+    return false;
+  }
+  // ~1.6 KB of encoder state: keep it off the loop task stack.
+  std::unique_ptr<camera::JpegStreamEncoder> encoder(new (std::nothrow) camera::JpegStreamEncoder());
+  if (!encoder) {
+    return false;
+  }
+  File file = LittleFS.open(path, "w");
+  if (!file) {
+    return false;
+  }
+  camera::JpegStreamEncoder::Options options;
+  options.quality = camera::JpegStreamEncoder::qualityFromCameraScale(config_.jpeg_quality);
+  const uint32_t started_ms = millis();
+  const bool ok = encoder->encodeRgb565(rgb565, w, h, stride_px, options, writeJpegChunk, &file);
+  file.close();
+  if (!ok) {
+    LittleFS.remove(path);
+    return false;
+  }
+  Serial.printf("[CAM] jpeg %dx%d q=%u bytes=%u in %lu ms\n",
+                w,
+                h,
+                static_cast<unsigned int>(options.quality),
+                static_cast<unsigned int>(encoder->bytesWritten()),
+                static_cast<unsigned long>(millis() - started_ms));
+  return true;
+}
+
 bool CameraManager::saveRgb565Raw(const char* path,
                                   const uint16_t* rgb565,
                                   int w,
@@ -527,53 +660,8 @@ bool CameraManager::saveRgb565Raw(const char* path,
   return true;
 }
 
-void CameraManager::ensurePreviewMap(int src_w, int src_h, int dst_w, int dst_h) const {
-  if (src_w == preview_map_src_w_ && src_h == preview_map_src_h_ && dst_w == preview_map_dst_w_ &&
-      dst_h == preview_map_dst_h_ && static_cast<int>(preview_x_map_.size()) == dst_w &&
-      static_cast<int>(preview_y_map_.size()) == dst_h) {
-    return;
-  }
-  preview_map_src_w_ = src_w;
-  preview_map_src_h_ = src_h;
-  preview_map_dst_w_ = dst_w;
-  preview_map_dst_h_ = dst_h;
-  preview_x_map_.assign(static_cast<size_t>(dst_w), 0U);
-  preview_y_map_.assign(static_cast<size_t>(dst_h), 0U);
-
-  if (dst_w <= 0 || dst_h <= 0 || src_w <= 0 || src_h <= 0) {
-    return;
-  }
-
-  if (dst_w == 1) {
-    preview_x_map_[0] = static_cast<uint16_t>(src_w / 2);
-  } else {
-    const uint32_t denom = static_cast<uint32_t>(dst_w - 1);
-    const uint32_t num_max = static_cast<uint32_t>(src_w - 1);
-    for (int x = 0; x < dst_w; ++x) {
-      uint32_t sx = static_cast<uint32_t>(x) * num_max / denom;
-      if (sx >= static_cast<uint32_t>(src_w)) {
-        sx = static_cast<uint32_t>(src_w - 1);
-      }
-      preview_x_map_[static_cast<size_t>(x)] = static_cast<uint16_t>(sx);
-    }
-  }
-
-  if (dst_h == 1) {
-    preview_y_map_[0] = static_cast<uint16_t>(src_h / 2);
-  } else {
-    const uint32_t denom = static_cast<uint32_t>(dst_h - 1);
-    const uint32_t num_max = static_cast<uint32_t>(src_h - 1);
-    for (int y = 0; y < dst_h; ++y) {
-      uint32_t sy = static_cast<uint32_t>(y) * num_max / denom;
-      if (sy >= static_cast<uint32_t>(src_h)) {
-        sy = static_cast<uint32_t>(src_h - 1);
-      }
-      preview_y_map_[static_cast<size_t>(y)] = static_cast<uint16_t>(sy);
-    }
-  }
-}
-
-bool CameraManager::downscaleToRgb565(const uint16_t* src,
+bool CameraManager::downscaleToRgb565(const void* src,
+                                      runtime::simd::DownscaleSource format,
                                       int src_w,
                                       int src_h,
                                       int src_stride_px,
@@ -586,30 +674,26 @@ bool CameraManager::downscaleToRgb565(const uint16_t* src,
   if (src_stride_px < src_w) {
     src_stride_px = src_w;
   }
-  ensurePreviewMap(src_w, src_h, dst_w, dst_h);
-  if (static_cast<int>(preview_x_map_.size()) != dst_w || static_cast<int>(preview_y_map_.size()) != dst_h) {
+  if (!preview_scaler_.configure(src_w, src_h, dst_w, dst_h)) {
     return false;
   }
-  for (int y = 0; y < dst_h; ++y) {
-    const uint16_t* src_row = src + static_cast<size_t>(preview_y_map_[static_cast<size_t>(y)]) *
-                                        static_cast<size_t>(src_stride_px);
-    uint16_t* dst_row = dst + static_cast<size_t>(y) * static_cast<size_t>(dst_w);
-    for (int x = 0; x < dst_w; ++x) {
-      dst_row[x] = src_row[preview_x_map_[static_cast<size_t>(x)]];
-    }
-  }
-  return true;
+  return preview_scaler_.run(src, format, src_stride_px, dst, dst_w);
 }
 
 bool CameraManager::snapshotToFile(const char* filename_hint, String* out_path) {
   if (out_path != nullptr) {
     out_path->remove(0);
   }
-  if (recorder_mode_) {
+  if (mode_ == CaptureMode::kRecorder) {
     ++snapshot_.fail_count;
     setLastError("camera_busy_recorder_owner");
     return false;
   }
+  if (mode_ == CaptureMode::kLumaScan && snapshot_.initialized) {
+    ++snapshot_.fail_count;
+    setLastError("camera_busy_luma_stream");
+    return false;
+  }
   if (!start()) {
     ++snapshot_.fail_count;
     return false;
@@ -620,12 +704,12 @@ bool CameraManager::snapshotToFile(const char* filename_hint, String* out_path)
   }
 
 #if ZACUS_HAS_CAMERA
-  camera_fb_t* frame = esp_camera_fb_get();
-  if (frame == nullptr) {
+  camera::FrameRef ref;
+  if (!captureFrame(&ref)) {
     ++snapshot_.fail_count;
-    setLastError("camera_capture_failed");
     return false;
   }
+  const camera::FrameDesc& frame = ref.desc();
 
   String path = buildSnapshotPath(filename_hint);
   if (!hasSuffix(path.c_str(), ".jpg") && !hasSuffix(path.c_str(), ".jpeg") && !hasSuffix(path.c_str(), ".bmp") &&
@@ -634,41 +718,39 @@ bool CameraManager::snapshotToFile(const char* filename_hint, String* out_path)
   }
 
   bool ok = false;
-  if (frame->format == PIXFORMAT_JPEG) {
+  const uint16_t* pixels = reinterpret_cast<const uint16_t*>(frame.data);
+  if (frame.format == camera::FrameFormat::kJpeg) {
     File file = LittleFS.open(path.c_str(), "w");
     if (file) {
-      ok = (file.write(frame->buf, frame->len) == frame->len);
+      ok = (file.write(frame.data, frame.bytes) == frame.bytes);
       file.close();
     }
-  } else if (frame->format == PIXFORMAT_RGB565) {
+  } else if (frame.format == camera::FrameFormat::kRgb565) {
     if (hasSuffix(path.c_str(), ".rgb565")) {
-      ok = saveRgb565Raw(path.c_str(), reinterpret_cast<const uint16_t*>(frame->buf), frame->width, frame->height, frame->width);
+      ok = saveRgb565Raw(path.c_str(), pixels, frame.width, frame.height, frame.width);
+    } else if (hasSuffix(path.c_str(), ".bmp")) {
+      ok = saveRgb565AsBmp24(path.c_str(), pixels, frame.width, frame.height, frame.width);
     } else {
-      if (!hasSuffix(path.c_str(), ".bmp")) {
-        path = buildSnapshotPath((sanitizeFileBasename(filename_hint) + ".bmp").c_str());
-      }
-      ok = saveRgb565AsBmp24(path.c_str(), reinterpret_cast<const uint16_t*>(frame->buf), frame->width, frame->height, frame->width);
+      ok = saveRgb565AsJpeg(path.c_str(), pixels, frame.width, frame.height, frame.width);
     }
   }
 
   if (!ok) {
     ++snapshot_.fail_count;
     setLastError("snapshot_write_failed");
-    esp_camera_fb_return(frame);
     return false;
   }
 
   snapshot_.last_snapshot_ok = true;
   snapshot_.last_capture_ms = millis();
   ++snapshot_.capture_count;
-  snapshot_.width = frame->width;
-  snapshot_.height = frame->height;
+  snapshot_.width = frame.width;
+  snapshot_.height = frame.height;
   copyText(snapshot_.last_file, sizeof(snapshot_.last_file), path.c_str());
   clearLastError();
   if (out_path != nullptr) {
     *out_path = path;
   }
-  esp_camera_fb_return(frame);
   return true;
 #else
   (void)filename_hint;
@@ -688,42 +770,31 @@ bool CameraManager::recorderUpdatePreviewRgb565(uint16_t* dst, int dst_w, int ds
 
 #if ZACUS_HAS_CAMERA
   if (recorder_frozen_) {
-    camera_fb_t* frame = reinterpret_cast<camera_fb_t*>(recorder_frozen_fb_);
-    if (frame == nullptr || frame->format != PIXFORMAT_RGB565) {
+    const camera::FrameDesc& frame = recorder_frozen_frame_.desc();
+    runtime::simd::DownscaleSource source = runtime::simd::DownscaleSource::kRgb565;
+    if (!previewSourceOf(frame, &source)) {
       return false;
     }
-    snapshot_.recorder_preview_width = static_cast<uint16_t>(frame->width);
-    snapshot_.recorder_preview_height = static_cast<uint16_t>(frame->height);
-    return downscaleToRgb565(reinterpret_cast<const uint16_t*>(frame->buf),
-                             frame->width,
-                             frame->height,
-                             frame->width,
-                             dst,
-                             dst_w,
-                             dst_h);
+    snapshot_.recorder_preview_width = frame.width;
+    snapshot_.recorder_preview_height = frame.height;
+    return downscaleToRgb565(frame.data, source, frame.width, frame.height, frame.width, dst, dst_w, dst_h);
   }
 
-  camera_fb_t* frame = esp_camera_fb_get();
-  if (frame == nullptr) {
-    setLastError("camera_capture_failed");
+  camera::FrameRef ref;
+  if (!captureFrame(&ref)) {
     return false;
   }
+  const camera::FrameDesc& frame = ref.desc();
 
   bool ok = false;
-  if (frame->format == PIXFORMAT_RGB565) {
-    snapshot_.recorder_preview_width = static_cast<uint16_t>(frame->width);
-    snapshot_.recorder_preview_height = static_cast<uint16_t>(frame->height);
-    snapshot_.width = static_cast<uint16_t>(frame->width);
-    snapshot_.height = static_cast<uint16_t>(frame->height);
-    ok = downscaleToRgb565(reinterpret_cast<const uint16_t*>(frame->buf),
-                           frame->width,
-                           frame->height,
-                           frame->width,
-                           dst,
-                           dst_w,
-                           dst_h);
-  }
-  esp_camera_fb_return(frame);
+  runtime::simd::DownscaleSource source = runtime::simd::DownscaleSource::kRgb565;
+  if (previewSourceOf(frame, &source)) {
+    snapshot_.recorder_preview_width = frame.width;
+    snapshot_.recorder_preview_height = frame.height;
+    snapshot_.width = frame.width;
+    snapshot_.height = frame.height;
+    ok = downscaleToRgb565(frame.data, source, frame.width, frame.height, frame.width, dst, dst_w, dst_h);
+  }
   if (!ok) {
     setLastError("camera_preview_unavailable");
   }
@@ -749,27 +820,22 @@ bool CameraManager::recorderSnapFreeze(uint16_t* preview_dst, int preview_w, int
     return true;
   }
 
-  camera_fb_t* frame = esp_camera_fb_get();
-  if (frame == nullptr) {
+  // The frozen frame stays referenced (and out of the driver) until it is
+  // saved or discarded; preview and save both read it in place.
+  if (!captureFrame(&recorder_frozen_frame_)) {
     ++snapshot_.fail_count;
-    setLastError("camera_capture_failed");
     return false;
   }
-  recorder_frozen_fb_ = frame;
+  const camera::FrameDesc& frame = recorder_frozen_frame_.desc();
   recorder_frozen_ = true;
   snapshot_.recorder_frozen = true;
-  snapshot_.width = static_cast<uint16_t>(frame->width);
-  snapshot_.height = static_cast<uint16_t>(frame->height);
-  snapshot_.recorder_preview_width = static_cast<uint16_t>(frame->width);
-  snapshot_.recorder_preview_height = static_cast<uint16_t>(frame->height);
-  if (preview_dst != nullptr && preview_w > 0 && preview_h > 0 && frame->format == PIXFORMAT_RGB565) {
-    (void)downscaleToRgb565(reinterpret_cast<const uint16_t*>(frame->buf),
-                            frame->width,
-                            frame->height,
-                            frame->width,
-                            preview_dst,
-                            preview_w,
-                            preview_h);
+  snapshot_.width = frame.width;
+  snapshot_.height = frame.height;
+  snapshot_.recorder_preview_width = frame.width;
+  snapshot_.recorder_preview_height = frame.height;
+  runtime::simd::DownscaleSource source = runtime::simd::DownscaleSource::kRgb565;
+  if (preview_dst != nullptr && preview_w > 0 && preview_h > 0 && previewSourceOf(frame, &source)) {
+    (void)downscaleToRgb565(frame.data, source, frame.width, frame.height, frame.width, preview_dst, preview_w, preview_h);
   }
   clearLastError();
   return true;
@@ -787,12 +853,7 @@ bool CameraManager::recorderHasFrozen() const {
 }
 
 void CameraManager::recorderDiscardFrozen() {
-#if ZACUS_HAS_CAMERA
-  if (recorder_frozen_fb_ != nullptr) {
-    esp_camera_fb_return(reinterpret_cast<camera_fb_t*>(recorder_frozen_fb_));
-  }
-#endif
-  recorder_frozen_fb_ = nullptr;
+  recorder_frozen_frame_.reset();
   recorder_frozen_ = false;
   snapshot_.recorder_frozen = false;
 }
@@ -825,7 +886,7 @@ bool CameraManager::recorderSaveFrozen(String* out_path, RecorderSaveFormat form
   setLastError("camera_not_supported");
   return false;
 #else
-  if (!recorder_frozen_ || recorder_frozen_fb_ == nullptr) {
+  if (!recorder_frozen_ || !recorder_frozen_frame_.valid()) {
     setLastError("camera_not_frozen");
     return false;
   }
@@ -833,14 +894,12 @@ bool CameraManager::recorderSaveFrozen(String* out_path, RecorderSaveFormat form
     return false;
   }
 
-  camera_fb_t* frame = reinterpret_cast<camera_fb_t*>(recorder_frozen_fb_);
+  const camera::FrameDesc& frame = recorder_frozen_frame_.desc();
+  const uint16_t* pixels = reinterpret_cast<const uint16_t*>(frame.data);
   RecorderSaveFormat actual = format;
-  if (frame->format == PIXFORMAT_JPEG) {
+  const bool native_jpeg = (frame.format == camera::FrameFormat::kJpeg);
+  if (native_jpeg || actual == RecorderSaveFormat::kAuto) {
     actual = RecorderSaveFormat::kJpeg;
-  } else if (frame->format == PIXFORMAT_RGB565) {
-    if (actual == RecorderSaveFormat::kAuto || actual == RecorderSaveFormat::kJpeg) {
-      actual = RecorderSaveFormat::kBmp24;
-    }
   }
 
   const char* ext = ".bmp";
@@ -858,24 +917,20 @@ bool CameraManager::recorderSaveFrozen(String* out_path, RecorderSaveFormat form
   }
 
   bool ok = false;
-  if (actual == RecorderSaveFormat::kJpeg) {
+  if (native_jpeg) {
     File file = LittleFS.open(path.c_str(), "w");
     if (file) {
-      ok = (file.write(frame->buf, frame->len) == frame->len);
+      ok = (file.write(frame.data, frame.bytes) == frame.bytes);
       file.close();
     }
+  } else if (frame.format != camera::FrameFormat::kRgb565) {
+    ok = false;
+  } else if (actual == RecorderSaveFormat::kJpeg) {
+    ok = saveRgb565AsJpeg(path.c_str(), pixels, frame.width, frame.height, frame.width);
   } else if (actual == RecorderSaveFormat::kBmp24) {
-    ok = saveRgb565AsBmp24(path.c_str(),
-                           reinterpret_cast<const uint16_t*>(frame->buf),
-                           frame->width,
-                           frame->height,
-                           frame->width);
+    ok = saveRgb565AsBmp24(path.c_str(), pixels, frame.width, frame.height, frame.width);
   } else if (actual == RecorderSaveFormat::kRawRgb565) {
-    ok = saveRgb565Raw(path.c_str(),
-                       reinterpret_cast<const uint16_t*>(frame->buf),
-                       frame->width,
-                       frame->height,
-                       frame->width);
+    ok = saveRgb565Raw(path.c_str(), pixels, frame.width, frame.height, frame.width);
   }
 
   if (!ok) {
@@ -978,8 +1033,187 @@ bool CameraManager::recorderSelectNextPhoto(String* in_out_path) const {
   return true;
 }
 
+bool CameraManager::captureFrame(camera::FrameRef* out) {
+#if !ZACUS_HAS_CAMERA
+  (void)out;
+  setLastError("camera_not_supported");
+  return false;
+#else
+  camera_fb_t* frame = esp_camera_fb_get();
+  if (frame == nullptr) {
+    setLastError("camera_capture_failed");
+    return false;
+  }
+  if (!pipeline_.publish(describeDriverFrame(frame), false, out)) {
+    esp_camera_fb_return(frame);
+    setLastError("camera_pipeline_full");
+    return false;
+  }
+  return true;
+#endif
+}
+
+bool CameraManager::startLumaStream() {
+#if !ZACUS_HAS_CAMERA
+  setLastError("camera_not_supported");
+  return false;
+#else
+  if (luma_task_ != nullptr) {
+    return true;
+  }
+  if (mode_ == CaptureMode::kRecorder && snapshot_.initialized) {
+    setLastError("camera_busy_recorder_owner");
+    return false;
+  }
+  if (operation_gate_ != nullptr && !operation_gate_("qr_luma_stream")) {
+    setLastError("camera_blocked_by_resource_profile");
+    return false;
+  }
+  const bool resume_default = snapshot_.initialized;
+  if (!initCameraForMode(CaptureMode::kLumaScan)) {
+    return false;
+  }
+  luma_max_in_flight_ = snapshot_.fb_count;
+  luma_stop_requested_.store(false);
+  luma_task_exited_.store(false);
+  luma_frames_.store(0U);
+  luma_drops_.store(0U);
+  luma_stalls_.store(0U);
+  pipeline_.resetStats();
+  const BaseType_t created =
+      xTaskCreatePinnedToCore(lumaTaskEntry, "cam_luma", kLumaTaskStackWords, this, kLumaTaskPriority, &luma_task_, kLumaTaskCore);
+  if (created != pdPASS) {
+    luma_task_ = nullptr;
+    luma_task_exited_.store(true);
+    setLastError("luma_task_failed");
+    stop();
+    if (resume_default) {
+      (void)start();
+    }
+    return false;
+  }
+  luma_resume_default_ = resume_default;
+  snapshot_.luma_stream_active = true;
+  Serial.printf("[CAM] luma stream on %ux%u fb=%u\n",
+                static_cast<unsigned int>(snapshot_.width),
+                static_cast<unsigned int>(snapshot_.height),
+                static_cast<unsigned int>(snapshot_.fb_count));
+  return true;
+#endif
+}
+
+void CameraManager::stopLumaStream() {
+  if (mode_ != CaptureMode::kLumaScan) {
+    return;
+  }
+  const bool resume_default = luma_resume_default_;
+  stop();
+  if (resume_default) {
+    (void)start();
+  }
+}
+
+bool CameraManager::lumaStreamActive() const {
+  return snapshot_.luma_stream_active;
+}
+
+void CameraManager::setStreamPaced(bool paced) {
+  luma_paced_.store(paced);
+}
+
+#if ZACUS_HAS_CAMERA
+void CameraManager::releaseDriver() {
+  // A consumer still holding a frame (QR worker mid-decode, a save) gets a
+  // short grace period; after it, the deinit runs from whichever thread
+  // releases the last frame, never under a live FrameRef.
+  const uint32_t started_ms = millis();
+  while (pipeline_.framesInFlight() != 0U && (millis() - started_ms) < kFrameDrainTimeoutMs) {
+    vTaskDelay(pdMS_TO_TICKS(2));
+  }
+  const uint8_t in_flight = pipeline_.framesInFlight();
+  if (!pipeline_.runWhenIdle(deinitDriver, this)) {
+    Serial.printf("[CAM] deinit deferred, %u frame(s) still referenced\n", static_cast<unsigned int>(in_flight));
+  }
+}
+#endif
+
+void CameraManager::stopLumaTask() {
+#if ZACUS_HAS_CAMERA
+  if (luma_task_ != nullptr) {
+    luma_stop_requested_.store(true);
+    const uint32_t started_ms = millis();
+    while (!luma_task_exited_.load() && (millis() - started_ms) < kLumaStopTimeoutMs) {
+      vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    if (!luma_task_exited_.load()) {
+      // Stuck in esp_camera_fb_get(); the driver is torn down right after.
+      vTaskDelete(luma_task_);
+      luma_task_exited_.store(true);
+    }
+    luma_task_ = nullptr;
+    const camera::CameraPipelineStats stats = pipeline_.stats();
+    Serial.printf("[CAM] luma stream off frames=%lu drops=%lu stalls=%lu unseen=%lu peak_refs=%u\n",
+                  static_cast<unsigned long>(luma_frames_.load()),
+                  static_cast<unsigned long>(luma_drops_.load()),
+                  static_cast<unsigned long>(luma_stalls_.load()),
+                  static_cast<unsigned long>(stats.superseded),
+                  static_cast<unsigned int>(stats.peak_in_flight));
+  }
+#endif
+  pipeline_.dropLatest();
+  luma_resume_default_ = false;
+  snapshot_.luma_stream_active = false;
+}
+
+#if ZACUS_HAS_CAMERA
+void CameraManager::lumaTaskEntry(void* arg) {
+  auto* self = static_cast<CameraManager*>(arg);
+  if (self != nullptr) {
+    self->lumaTaskMain();
+    self->luma_task_exited_.store(true);
+  }
+  vTaskDelete(nullptr);
+}
+
+void CameraManager::lumaTaskMain() {
+  uint32_t last_publish_ms = 0U;
+  while (!luma_stop_requested_.load()) {
+    // Back-pressure: never ask the driver for a frame while every buffer it
+    // owns is still referenced by consumers, and slow down while the
+    // resource coordinator reports graphics pressure.
+    if (pipeline_.framesInFlight() >= luma_max_in_flight_) {
+      luma_stalls_.fetch_add(1U);
+      vTaskDelay(pdMS_TO_TICKS(2));
+      continue;
+    }
+    if (luma_paced_.load() && (millis() - last_publish_ms) < kLumaPacedIntervalMs) {
+      vTaskDelay(pdMS_TO_TICKS(10));
+      continue;
+    }
+    camera_fb_t* frame = esp_camera_fb_get();
+    if (frame == nullptr) {
+      luma_drops_.fetch_add(1U);
+      vTaskDelay(pdMS_TO_TICKS(10));
+      continue;
+    }
+    if (frame->format != PIXFORMAT_GRAYSCALE || !pipeline_.publish(describeDriverFrame(frame), true)) {
+      esp_camera_fb_return(frame);
+      luma_drops_.fetch_add(1U);
+      continue;
+    }
+    last_publish_ms = millis();
+    luma_frames_.fetch_add(1U);
+  }
+}
+#endif
+
 CameraManager::Snapshot CameraManager::snapshot() const {
-  return snapshot_;
+  Snapshot out = snapshot_;
+  out.luma_frame_count = luma_frames_.load();
+  out.luma_drop_count = luma_drops_.load();
+  out.luma_stall_count = luma_stalls_.load();
+  out.luma_stream_paced = luma_paced_.load();
+  return out;
 }
 
 void CameraManager::setLastError(const char* message) {
@@ -0,0 +1,266 @@
+// camera_pipeline.cpp - refcounted frame pool shared by camera consumers.
+#include "camera/camera_pipeline.h"
+
+namespace camera {
+
+FrameRef::FrameRef(const FrameRef& other) : pipeline_(other.pipeline_), slot_(other.slot_) {
+  if (pipeline_ != nullptr) {
+    pipeline_->retain(slot_);
+  }
+}
+
+FrameRef::FrameRef(FrameRef&& other) noexcept : pipeline_(other.pipeline_), slot_(other.slot_) {
+  other.pipeline_ = nullptr;
+}
+
+FrameRef& FrameRef::operator=(const FrameRef& other) {
+  if (this != &other) {
+    if (other.pipeline_ != nullptr) {
+      other.pipeline_->retain(other.slot_);
+    }
+    reset();
+    pipeline_ = other.pipeline_;
+    slot_ = other.slot_;
+  }
+  return *this;
+}
+
+FrameRef& FrameRef::operator=(FrameRef&& other) noexcept {
+  if (this != &other) {
+    reset();
+    pipeline_ = other.pipeline_;
+    slot_ = other.slot_;
+    other.pipeline_ = nullptr;
+  }
+  return *this;
+}
+
+void FrameRef::reset() {
+  if (pipeline_ != nullptr) {
+    CameraPipeline* pipeline = pipeline_;
+    pipeline_ = nullptr;
+    pipeline->release(slot_);
+  }
+}
+
+const FrameDesc& FrameRef::desc() const {
+  static const FrameDesc kEmpty = {};
+  return (pipeline_ != nullptr) ? pipeline_->slots_[slot_].desc : kEmpty;
+}
+
+CameraPipeline::~CameraPipeline() {
+  dropLatest();
+}
+
+bool CameraPipeline::publish(const FrameDesc& desc, bool keep_latest, FrameRef* out) {
+  if (desc.release == nullptr || (!keep_latest && out == nullptr)) {
+    return false;
+  }
+  if (out != nullptr) {
+    out->reset();
+  }
+  FrameDesc superseded = {};
+  bool release_superseded = false;
+  lock();
+  int8_t free_slot = -1;
+  for (uint8_t index = 0U; index < kPoolSlots; ++index) {
+    if (slots_[index].refs == 0U) {
+      free_slot = static_cast<int8_t>(index);
+      break;
+    }
+  }
+  if (free_slot < 0) {
+    ++stats_.rejected;
+    unlock();
+    return false;
+  }
+  Slot& slot = slots_[free_slot];
+  slot.desc = desc;
+  slot.desc.sequence = ++sequence_;
+  slot.refs = static_cast<uint16_t>((keep_latest ? 1U : 0U) + (out != nullptr ? 1U : 0U));
+  slot.taken = (out != nullptr);
+  ++stats_.published;
+  ++stats_.in_flight;
+  if (stats_.in_flight > stats_.peak_in_flight) {
+    stats_.peak_in_flight = stats_.in_flight;
+  }
+  if (keep_latest) {
+    if (latest_ >= 0) {
+      const uint8_t previous = static_cast<uint8_t>(latest_);
+      if (!slots_[previous].taken) {
+        ++stats_.superseded;
+      }
+      release_superseded = unrefLocked(previous, &superseded);
+    }
+    latest_ = free_slot;
+  }
+  unlock();
+  if (release_superseded) {
+    returnFrame(superseded);
+  }
+  if (out != nullptr) {
+    out->pipeline_ = this;
+    out->slot_ = static_cast<uint8_t>(free_slot);
+  }
+  return true;
+}
+
+bool CameraPipeline::acquireLatest(FrameRef* out, uint32_t after_sequence) {
+  if (out == nullptr) {
+    return false;
+  }
+  out->reset();
+  lock();
+  if (latest_ < 0 || slots_[latest_].desc.sequence <= after_sequence) {
+    unlock();
+    return false;
+  }
+  const uint8_t slot = static_cast<uint8_t>(latest_);
+  ++slots_[slot].refs;
+  slots_[slot].taken = true;
+  ++stats_.acquired;
+  unlock();
+  out->pipeline_ = this;
+  out->slot_ = slot;
+  return true;
+}
+
+void CameraPipeline::dropLatest() {
+  FrameDesc dropped = {};
+  bool release_dropped = false;
+  lock();
+  if (latest_ >= 0) {
+    release_dropped = unrefLocked(static_cast<uint8_t>(latest_), &dropped);
+    latest_ = -1;
+  }
+  unlock();
+  if (release_dropped) {
+    returnFrame(dropped);
+  }
+}
+
+uint8_t CameraPipeline::framesInFlight() const {
+  lock();
+  const uint8_t in_flight = stats_.in_flight;
+  unlock();
+  return in_flight;
+}
+
+bool CameraPipeline::runWhenIdle(PipelineIdleFn fn, void* owner) {
+  if (fn == nullptr) {
+    return false;
+  }
+  lock();
+  if (stats_.in_flight != 0U || returning_ != 0U) {
+    idle_fn_ = fn;
+    idle_owner_ = owner;
+    unlock();
+    return false;
+  }
+  idle_fn_ = nullptr;
+  idle_owner_ = nullptr;
+  idle_running_ = true;
+  unlock();
+  runIdleCall(fn, owner);
+  return true;
+}
+
+bool CameraPipeline::idleCallPending() const {
+  lock();
+  const bool pending = idle_fn_ != nullptr || idle_running_;
+  unlock();
+  return pending;
+}
+
+CameraPipelineStats CameraPipeline::stats() const {
+  lock();
+  const CameraPipelineStats stats = stats_;
+  unlock();
+  return stats;
+}
+
+void CameraPipeline::resetStats() {
+  lock();
+  const uint8_t in_flight = stats_.in_flight;
+  stats_ = {};
+  stats_.in_flight = in_flight;
+  stats_.peak_in_flight = in_flight;
+  unlock();
+}
+
+void CameraPipeline::retain(uint8_t slot) {
+  lock();
+  ++slots_[slot].refs;
+  unlock();
+}
+
+void CameraPipeline::release(uint8_t slot) {
+  FrameDesc released = {};
+  lock();
+  const bool last = unrefLocked(slot, &released);
+  unlock();
+  if (last) {
+    returnFrame(released);
+  }
+}
+
+bool CameraPipeline::unrefLocked(uint8_t slot, FrameDesc* out) {
+  Slot& entry = slots_[slot];
+  if (entry.refs == 0U) {
+    return false;
+  }
+  --entry.refs;
+  if (entry.refs != 0U) {
+    return false;
+  }
+  *out = entry.desc;
+  entry.desc = {};
+  entry.taken = false;
+  --stats_.in_flight;
+  ++returning_;
+  return true;
+}
+
+void CameraPipeline::returnFrame(const FrameDesc& released) {
+  released.release(released.owner, released.handle);
+  lock();
+  --returning_;
+  PipelineIdleFn fn = nullptr;
+  void* owner = nullptr;
+  if (idle_fn_ != nullptr && stats_.in_flight == 0U && returning_ == 0U) {
+    fn = idle_fn_;
+    owner = idle_owner_;
+    idle_fn_ = nullptr;
+    idle_owner_ = nullptr;
+    idle_running_ = true;
+  }
+  unlock();
+  if (fn != nullptr) {
+    runIdleCall(fn, owner);
+  }
+}
+
+void CameraPipeline::runIdleCall(PipelineIdleFn fn, void* owner) {
+  fn(owner);
+  lock();
+  idle_running_ = false;
+  unlock();
+}
+
+void CameraPipeline::lock() const {
+#if defined(ARDUINO_ARCH_ESP32)
+  portENTER_CRITICAL(&lock_);
+#else
+  lock_.lock();
+#endif
+}
+
+void CameraPipeline::unlock() const {
+#if defined(ARDUINO_ARCH_ESP32)
+  portEXIT_CRITICAL(&lock_);
+#else
+  lock_.unlock();
+#endif
+}
+
+}  // namespace camera
@@ -0,0 +1,488 @@
+// jpeg_stream_encoder.cpp - strip-based baseline JPEG encoder for RGB565 frames.
+#include "camera/jpeg_stream_encoder.h"
+
+namespace camera {
+
+namespace {
+
+// Zigzag position -> natural (row-major) coefficient index.
+constexpr uint8_t kZigzag[64] = {
+    0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,  12, 19, 26, 33, 40, 48,
+    41, 34, 27, 20, 13, 6,  7,  14, 21, 28, 35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23,
+    30, 37, 44, 51, 58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+// ITU T.81 Annex K.1 tables, natural order.
+constexpr uint8_t kLumaQuant[64] = {
+    16, 11, 10, 16, 24,  40,  51,  61,  12, 12, 14, 19, 26,  58,  60,  55,
+    14, 13, 16, 24, 40,  57,  69,  56,  14, 17, 22, 29, 51,  87,  80,  62,
+    18, 22, 37, 56, 68,  109, 103, 77,  24, 35, 55, 64, 81,  104, 113, 92,
+    49, 64, 78, 87, 103, 121, 120, 101, 72, 92, 95, 98, 112, 100, 103, 99,
+};
+
+constexpr uint8_t kChromaQuant[64] = {
+    17, 18, 24, 47, 99, 99, 99, 99, 18, 21, 26, 66, 99, 99, 99, 99, 24, 26, 56, 99, 99, 99,
+    99, 99, 47, 66, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+};
+
+// Annex K.3 standard Huffman tables.
+constexpr uint8_t kDcLumaBits[16] = {0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0};
+constexpr uint8_t kDcChromaBits[16] = {0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0};
+constexpr uint8_t kDcValues[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+constexpr uint8_t kAcLumaBits[16] = {0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7D};
+constexpr uint8_t kAcLumaValues[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71,
+    0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24, 0x33, 0x62, 0x72,
+    0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3,
+    0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3,
+    0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2,
+    0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA,
+};
+
+constexpr uint8_t kAcChromaBits[16] = {0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77};
+constexpr uint8_t kAcChromaValues[162] = {
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22,
+    0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0, 0x15, 0x62, 0x72, 0xD1,
+    0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A,
+    0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA,
+    0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA,
+    0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA,
+};
+
+// AAN scale factors: cos(k*pi/16) * sqrt(2), k>0.
+constexpr float kAanScale[8] = {1.0f, 1.387039845f, 1.306562965f, 1.175875602f,
+                                1.0f, 0.785694958f, 0.541196100f, 0.275899379f};
+
+struct HuffCode {
+  uint16_t code;
+  uint8_t length;
+};
+
+struct Tables {
+  bool ready = false;
+  HuffCode dc_luma[12];
+  HuffCode dc_chroma[12];
+  HuffCode ac_luma[256];
+  HuffCode ac_chroma[256];
+  float r[32];  // RGB565 channel -> 0..255
+  float g[64];
+  float b[32];
+};
+
+Tables g_tables;
+
+void buildCodes(const uint8_t* bits, const uint8_t* values, HuffCode* out) {
+  uint16_t code = 0U;
+  size_t k = 0U;
+  for (uint8_t length = 1U; length <= 16U; ++length) {
+    for (uint8_t i = 0U; i < bits[length - 1U]; ++i) {
+      out[values[k]].code = code++;
+      out[values[k]].length = length;
+      ++k;
+    }
+    code = static_cast<uint16_t>(code << 1U);
+  }
+}
+
+const Tables& tables() {
+  if (!g_tables.ready) {
+    buildCodes(kDcLumaBits, kDcValues, g_tables.dc_luma);
+    buildCodes(kDcChromaBits, kDcValues, g_tables.dc_chroma);
+    buildCodes(kAcLumaBits, kAcLumaValues, g_tables.ac_luma);
+    buildCodes(kAcChromaBits, kAcChromaValues, g_tables.ac_chroma);
+    for (int i = 0; i < 32; ++i) {
+      g_tables.r[i] = static_cast<float>(i * 255 / 31);
+      g_tables.b[i] = g_tables.r[i];
+    }
+    for (int i = 0; i < 64; ++i) {
+      g_tables.g[i] = static_cast<float>(i * 255 / 63);
+    }
+    g_tables.ready = true;
+  }
+  return g_tables;
+}
+
+void scaleQuant(const uint8_t* base, uint8_t quality, uint8_t* out) {
+  const int scale = (quality < 50U) ? (5000 / quality) : (200 - 2 * quality);
+  for (int i = 0; i < 64; ++i) {
+    int value = (base[i] * scale + 50) / 100;
+    if (value < 1) {
+      value = 1;
+    } else if (value > 255) {
+      value = 255;
+    }
+    out[i] = static_cast<uint8_t>(value);
+  }
+}
+
+void buildDivisors(const uint8_t* quant, float* out) {
+  for (int row = 0; row < 8; ++row) {
+    for (int col = 0; col < 8; ++col) {
+      const int i = row * 8 + col;
+      out[i] = 1.0f / (static_cast<float>(quant[i]) * kAanScale[row] * kAanScale[col] * 8.0f);
+    }
+  }
+}
+
+// Float AAN forward DCT (IJG jfdctflt), in place; output scaled by
+// 8 * kAanScale[u] * kAanScale[v], folded into the divisors.
+void forwardDct(float* data) {
+  for (int pass = 0; pass < 2; ++pass) {
+    const int step = (pass == 0) ? 1 : 8;
+    const int next = (pass == 0) ? 8 : 1;
+    for (int line = 0; line < 8; ++line) {
+      float* d = data + line * next;
+      const float tmp0 = d[0] + d[7 * step];
+      const float tmp7 = d[0] - d[7 * step];
+      const float tmp1 = d[1 * step] + d[6 * step];
+      const float tmp6 = d[1 * step] - d[6 * step];
+      const float tmp2 = d[2 * step] + d[5 * step];
+      const float tmp5 = d[2 * step] - d[5 * step];
+      const float tmp3 = d[3 * step] + d[4 * step];
+      const float tmp4 = d[3 * step] - d[4 * step];
+
+      float tmp10 = tmp0 + tmp3;
+      const float tmp13 = tmp0 - tmp3;
+      float tmp11 = tmp1 + tmp2;
+      float tmp12 = tmp1 - tmp2;
+      d[0] = tmp10 + tmp11;
+      d[4 * step] = tmp10 - tmp11;
+      const float z1 = (tmp12 + tmp13) * 0.707106781f;
+      d[2 * step] = tmp13 + z1;
+      d[6 * step] = tmp13 - z1;
+
+      tmp10 = tmp4 + tmp5;
+      tmp11 = tmp5 + tmp6;
+      tmp12 = tmp6 + tmp7;
+      const float z5 = (tmp10 - tmp12) * 0.382683433f;
+      const float z2 = 0.541196100f * tmp10 + z5;
+      const float z4 = 1.306562965f * tmp12 + z5;
+      const float z3 = tmp11 * 0.707106781f;
+      const float z11 = tmp7 + z3;
+      const float z13 = tmp7 - z3;
+      d[5 * step] = z13 + z2;
+      d[3 * step] = z13 - z2;
+      d[1 * step] = z11 + z4;
+      d[7 * step] = z11 - z4;
+    }
+  }
+}
+
+uint32_t bitLength(int value) {
+  uint32_t magnitude = static_cast<uint32_t>(value < 0 ? -value : value);
+  uint32_t length = 0U;
+  while (magnitude != 0U) {
+    ++length;
+    magnitude >>= 1U;
+  }
+  return length;
+}
+
+int clampIndex(int value, int limit) {
+  return (value < limit) ? value : (limit - 1);
+}
+
+}  // namespace
+
+uint8_t JpegStreamEncoder::qualityFromCameraScale(uint8_t camera_quality) {
+  int q = camera_quality;
+  if (q < 4) {
+    q = 4;
+  } else if (q > 63) {
+    q = 63;
+  }
+  return static_cast<uint8_t>(100 - (q * 80) / 63);
+}
+
+bool JpegStreamEncoder::begin(int width, int height, const Options& options, WriteFn write, void* ctx) {
+  ok_ = false;
+  if (width <= 0 || height <= 0 || width > 0xFFFF || height > 0xFFFF || write == nullptr) {
+    return false;
+  }
+  tables();
+  write_ = write;
+  ctx_ = ctx;
+  width_ = width;
+  height_ = height;
+  rows_done_ = 0;
+  subsample_ = (options.subsampling == Subsampling::k420);
+  dc_y_ = 0;
+  dc_cb_ = 0;
+  dc_cr_ = 0;
+  bit_buffer_ = 0U;
+  bit_count_ = 0U;
+  out_len_ = 0U;
+  bytes_written_ = 0U;
+  ok_ = true;
+
+  uint8_t quality = options.quality;
+  if (quality < 1U) {
+    quality = 1U;
+  } else if (quality > 100U) {
+    quality = 100U;
+  }
+  uint8_t quant_y[64];
+  uint8_t quant_c[64];
+  scaleQuant(kLumaQuant, quality, quant_y);
+  scaleQuant(kChromaQuant, quality, quant_c);
+  buildDivisors(quant_y, fdtbl_y_);
+  buildDivisors(quant_c, fdtbl_c_);
+
+  static const uint8_t kHead[] = {
+      0xFF, 0xD8,                                                  // SOI
+      0xFF, 0xE0, 0x00, 0x10, 'J', 'F', 'I', 'F', 0x00, 0x01, 0x01,  // APP0 JFIF 1.1
+      0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+      0xFF, 0xDB, 0x00, 0x84,                                      // DQT, two tables
+  };
+  putMarkerBytes(kHead, sizeof(kHead));
+  putByte(0x00U);
+  for (int k = 0; k < 64; ++k) {
+    putByte(quant_y[kZigzag[k]]);
+  }
+  putByte(0x01U);
+  for (int k = 0; k < 64; ++k) {
+    putByte(quant_c[kZigzag[k]]);
+  }
+
+  const uint8_t luma_sampling = subsample_ ? 0x22U : 0x11U;
+  const uint8_t sof[] = {
+      0xFF, 0xC0, 0x00, 0x11, 0x08,
+      static_cast<uint8_t>(height >> 8), static_cast<uint8_t>(height & 0xFF),
+      static_cast<uint8_t>(width >> 8), static_cast<uint8_t>(width & 0xFF),
+      0x03, 0x01, luma_sampling, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01,
+  };
+  putMarkerBytes(sof, sizeof(sof));
+
+  static const uint8_t kDhtHead[] = {0xFF, 0xC4, 0x01, 0xA2};
+  putMarkerBytes(kDhtHead, sizeof(kDhtHead));
+  putByte(0x00U);
+  putMarkerBytes(kDcLumaBits, sizeof(kDcLumaBits));
+  putMarkerBytes(kDcValues, sizeof(kDcValues));
+  putByte(0x10U);
+  putMarkerBytes(kAcLumaBits, sizeof(kAcLumaBits));
+  putMarkerBytes(kAcLumaValues, sizeof(kAcLumaValues));
+  putByte(0x01U);
+  putMarkerBytes(kDcChromaBits, sizeof(kDcChromaBits));
+  putMarkerBytes(kDcValues, sizeof(kDcValues));
+  putByte(0x11U);
+  putMarkerBytes(kAcChromaBits, sizeof(kAcChromaBits));
+  putMarkerBytes(kAcChromaValues, sizeof(kAcChromaValues));
+
+  static const uint8_t kSos[] = {0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02,
+                                 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00};
+  putMarkerBytes(kSos, sizeof(kSos));
+  return ok_;
+}
+
+int JpegStreamEncoder::stripRows() const {
+  return subsample_ ? 16 : 8;
+}
+
+size_t JpegStreamEncoder::bytesWritten() const {
+  return bytes_written_ + out_len_;
+}
+
+bool JpegStreamEncoder::encodeStrip(const uint16_t* rgb565, int stride_px, int rows) {
+  const int mcu = stripRows();
+  if (!ok_ || rgb565 == nullptr || stride_px < width_ || rows <= 0 || rows > mcu ||
+      rows_done_ >= height_ || rows > height_ - rows_done_ || (rows < mcu && rows != height_ - rows_done_)) {
+    ok_ = false;
+    return false;
+  }
+  for (int x0 = 0; x0 < width_ && ok_; x0 += mcu) {
+    if (subsample_) {
+      encodeMcu420(rgb565, stride_px, rows, x0);
+    } else {
+      encodeMcu444(rgb565, stride_px, rows, x0);
+    }
+  }
+  rows_done_ += rows;
+  return ok_;
+}
+
+bool JpegStreamEncoder::finish() {
+  if (!ok_) {
+    return false;
+  }
+  if (rows_done_ != height_) {
+    ok_ = false;
+    return false;
+  }
+  putBits(0x7FU, 7U);  // pad the last byte with 1-bits
+  putByte(0xFFU);
+  putByte(0xD9U);
+  flushBuffer();
+  const bool ok = ok_;
+  ok_ = false;
+  return ok;
+}
+
+void JpegStreamEncoder::encodeMcu420(const uint16_t* strip, int stride_px, int rows, int x0) {
+  const Tables& t = tables();
+  float luma[4][64];
+  float cb[64] = {};
+  float cr[64] = {};
+  for (int j = 0; j < 16; ++j) {
+    const uint16_t* row = strip + static_cast<size_t>(clampIndex(j, rows)) * static_cast<size_t>(stride_px);
+    float* y_row = luma[(j >> 3) * 2] + (j & 7) * 8;
+    float* cb_row = cb + (j >> 1) * 8;
+    float* cr_row = cr + (j >> 1) * 8;
+    for (int i = 0; i < 16; ++i) {
+      const uint16_t c = row[clampIndex(x0 + i, width_)];
+      const float r = t.r[(c >> 11U) & 0x1FU];
+      const float g = t.g[(c >> 5U) & 0x3FU];
+      const float b = t.b[c & 0x1FU];
+      y_row[(i >> 3) * 64 + (i & 7)] = 0.299f * r + 0.587f * g + 0.114f * b - 128.0f;
+      cb_row[i >> 1] += -0.168736f * r - 0.331264f * g + 0.5f * b;
+      cr_row[i >> 1] += 0.5f * r - 0.418688f * g - 0.081312f * b;
+    }
+  }
+  for (int i = 0; i < 64; ++i) {
+    cb[i] *= 0.25f;
+    cr[i] *= 0.25f;
+  }
+  for (int k = 0; k < 4; ++k) {
+    encodeBlock(luma[k], fdtbl_y_, &dc_y_, false);
+  }
+  encodeBlock(cb, fdtbl_c_, &dc_cb_, true);
+  encodeBlock(cr, fdtbl_c_, &dc_cr_, true);
+}
+
+void JpegStreamEncoder::encodeMcu444(const uint16_t* strip, int stride_px, int rows, int x0) {
+  const Tables& t = tables();
+  float luma[64];
+  float cb[64];
+  float cr[64];
+  for (int j = 0; j < 8; ++j) {
+    const uint16_t* row = strip + static_cast<size_t>(clampIndex(j, rows)) * static_cast<size_t>(stride_px);
+    for (int i = 0; i < 8; ++i) {
+      const uint16_t c = row[clampIndex(x0 + i, width_)];
+      const float r = t.r[(c >> 11U) & 0x1FU];
+      const float g = t.g[(c >> 5U) & 0x3FU];
+      const float b = t.b[c & 0x1FU];
+      luma[j * 8 + i] = 0.299f * r + 0.587f * g + 0.114f * b - 128.0f;
+      cb[j * 8 + i] = -0.168736f * r - 0.331264f * g + 0.5f * b;
+      cr[j * 8 + i] = 0.5f * r - 0.418688f * g - 0.081312f * b;
+    }
+  }
+  encodeBlock(luma, fdtbl_y_, &dc_y_, false);
+  encodeBlock(cb, fdtbl_c_, &dc_cb_, true);
+  encodeBlock(cr, fdtbl_c_, &dc_cr_, true);
+}
+
+void JpegStreamEncoder::encodeBlock(float* block, const float* fdtbl, int* last_dc, bool chroma) {
+  const Tables& t = tables();
+  const HuffCode* dc_codes = chroma ? t.dc_chroma : t.dc_luma;
+  const HuffCode* ac_codes = chroma ? t.ac_chroma : t.ac_luma;
+
+  forwardDct(block);
+  int coeffs[64];
+  for (int k = 0; k < 64; ++k) {
+    const int i = kZigzag[k];
+    const float v = block[i] * fdtbl[i];
+    coeffs[k] = static_cast<int>(v < 0.0f ? v - 0.5f : v + 0.5f);
+  }
+
+  const int diff = coeffs[0] - *last_dc;
+  *last_dc = coeffs[0];
+  uint32_t size = bitLength(diff);
+  putBits(dc_codes[size].code, dc_codes[size].length);
+  if (size != 0U) {
+    const int bits = (diff < 0) ? diff - 1 : diff;
+    putBits(static_cast<uint32_t>(bits) & ((1U << size) - 1U), size);
+  }
+
+  int last_nonzero = 63;
+  while (last_nonzero > 0 && coeffs[last_nonzero] == 0) {
+    --last_nonzero;
+  }
+  int run = 0;
+  for (int k = 1; k <= last_nonzero; ++k) {
+    const int v = coeffs[k];
+    if (v == 0) {
+      ++run;
+      continue;
+    }
+    while (run >= 16) {
+      putBits(ac_codes[0xF0].code, ac_codes[0xF0].length);
+      run -= 16;
+    }
+    size = bitLength(v);
+    const uint8_t symbol = static_cast<uint8_t>((run << 4) | static_cast<int>(size));
+    putBits(ac_codes[symbol].code, ac_codes[symbol].length);
+    const int bits = (v < 0) ? v - 1 : v;
+    putBits(static_cast<uint32_t>(bits) & ((1U << size) - 1U), size);
+    run = 0;
+  }
+  if (last_nonzero < 63) {
+    putBits(ac_codes[0x00].code, ac_codes[0x00].length);
+  }
+}
+
+void JpegStreamEncoder::putBits(uint32_t bits, uint32_t len) {
+  bit_count_ += len;
+  bit_buffer_ |= bits << (24U - bit_count_);
+  while (bit_count_ >= 8U) {
+    const uint8_t byte = static_cast<uint8_t>((bit_buffer_ >> 16U) & 0xFFU);
+    putByte(byte);
+    if (byte == 0xFFU) {
+      putByte(0x00U);  // byte stuffing
+    }
+    bit_buffer_ <<= 8U;
+    bit_count_ -= 8U;
+  }
+}
+
+void JpegStreamEncoder::putByte(uint8_t value) {
+  out_[out_len_++] = value;
+  if (out_len_ == sizeof(out_)) {
+    flushBuffer();
+  }
+}
+
+void JpegStreamEncoder::putMarkerBytes(const uint8_t* data, size_t len) {
+  for (size_t i = 0U; i < len; ++i) {
+    putByte(data[i]);
+  }
+}
+
+void JpegStreamEncoder::flushBuffer() {
+  if (out_len_ == 0U) {
+    return;
+  }
+  if (ok_ && !write_(ctx_, out_, out_len_)) {
+    ok_ = false;
+  }
+  bytes_written_ += out_len_;
+  out_len_ = 0U;
+}
+
+bool JpegStreamEncoder::encodeRgb565(const uint16_t* pixels,
+                                     int width,
+                                     int height,
+                                     int stride_px,
+                                     const Options& options,
+                                     WriteFn write,
+                                     void* ctx) {
+  if (pixels == nullptr || !begin(width, height, options, write, ctx)) {
+    return false;
+  }
+  const int strip = stripRows();
+  for (int y = 0; y < height; y += strip) {
+    const int rows = (height - y < strip) ? (height - y) : strip;
+    if (!encodeStrip(pixels + static_cast<size_t>(y) * static_cast<size_t>(stride_px), stride_px, rows)) {
+      return false;
+    }
+  }
+  return finish();
+}
+
+}  // namespace camera
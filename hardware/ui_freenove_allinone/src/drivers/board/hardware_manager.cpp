@@ -301,6 +301,18 @@ bool HardwareManager::micRuntimeEnabled() const {
   return mic_enabled_runtime_;
 }
 
+bool HardwareManager::micDriverReady() const {
+  return mic_driver_ready_;
+}
+
+int HardwareManager::micPort() const {
+  return static_cast<int>(kMicPort);
+}
+
+uint32_t HardwareManager::micSampleRate() const {
+  return kMicSampleRate;
+}
+
 void HardwareManager::setSceneSingleRandomBlink(bool enabled,
                                                 uint8_t r,
                                                 uint8_t g,
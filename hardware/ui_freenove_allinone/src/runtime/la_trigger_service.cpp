@@ -97,6 +97,19 @@ uint8_t dynamicConfidenceFloor(uint8_t base_confidence,
                                                 : static_cast<uint8_t>(raw_floor);
 }
 
+// Keeps timeout_deadline_ms current (0 = no pending timeout). The main loop
+// arms it in the shared deadline queue, which decides when it has passed.
+void refreshTimeoutDeadline(const RuntimeHardwareConfig& config, LaTriggerRuntimeState* state) {
+  if (state->locked || config.mic_la_timeout_ms == 0U || state->gate_entered_ms == 0U) {
+    state->timeout_deadline_ms = 0U;
+    return;
+  }
+  state->timeout_deadline_ms = state->gate_entered_ms + config.mic_la_timeout_ms;
+  if (state->timeout_deadline_ms == 0U) {
+    state->timeout_deadline_ms = 1U;
+  }
+}
+
 }  // namespace
 
 bool LaTriggerService::isTriggerStep(const ScenarioSnapshot& snapshot) {
@@ -320,11 +333,7 @@ LaTriggerService::UpdateResult LaTriggerService::update(const RuntimeHardwareCon
       }
     }
 
-    if (!state->locked && config.mic_la_timeout_ms > 0U && state->gate_entered_ms > 0U &&
-        (now_ms - state->gate_entered_ms) >= config.mic_la_timeout_ms) {
-      result.timed_out = true;
-      return result;
-    }
+    refreshTimeoutDeadline(config, state);
     if (!state->locked || state->dispatched) {
       return result;
     }
@@ -384,11 +393,7 @@ LaTriggerService::UpdateResult LaTriggerService::update(const RuntimeHardwareCon
   }
 
   state->locked = state->stable_ms >= config.mic_la_stable_ms;
-  if (!state->locked && config.mic_la_timeout_ms > 0U && state->gate_entered_ms > 0U &&
-      (now_ms - state->gate_entered_ms) >= config.mic_la_timeout_ms) {
-    result.timed_out = true;
-    return result;
-  }
+  refreshTimeoutDeadline(config, state);
   if (!state->locked || state->dispatched) {
     return result;
   }
@@ -420,6 +420,12 @@ void RuntimeConfigService::load(StorageManager& storage,
       if (config["auto_stop_record_on_step_change"].is<bool>()) {
         media_cfg->auto_stop_record_on_step_change = config["auto_stop_record_on_step_change"].as<bool>();
       }
+      if (config["record_adpcm"].is<bool>()) {
+        media_cfg->record_adpcm = config["record_adpcm"].as<bool>();
+      }
+      if (config["record_gain_q8"].is<unsigned int>()) {
+        media_cfg->record_gain_q8 = static_cast<uint16_t>(config["record_gain_q8"].as<unsigned int>());
+      }
     } else {
       Serial.printf("[MEDIA] APP_MEDIA invalid json (%s)\n", error.c_str());
     }
@@ -463,10 +469,12 @@ void RuntimeConfigService::load(StorageManager& storage,
                 static_cast<unsigned int>(camera_cfg->fb_count),
                 static_cast<unsigned long>(camera_cfg->xclk_hz),
                 camera_cfg->snapshot_dir);
-  Serial.printf("[MEDIA] cfg music=%s picture=%s record=%s max_sec=%u auto_stop=%u\n",
+  Serial.printf("[MEDIA] cfg music=%s picture=%s record=%s max_sec=%u auto_stop=%u adpcm=%u gain_q8=%u\n",
                 media_cfg->music_dir,
                 media_cfg->picture_dir,
                 media_cfg->record_dir,
                 static_cast<unsigned int>(media_cfg->record_max_seconds),
-                media_cfg->auto_stop_record_on_step_change ? 1U : 0U);
+                media_cfg->auto_stop_record_on_step_change ? 1U : 0U,
+                media_cfg->record_adpcm ? 1U : 0U,
+                static_cast<unsigned int>(media_cfg->record_gain_q8));
 }
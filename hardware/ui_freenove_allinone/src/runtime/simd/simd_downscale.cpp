@@ -0,0 +1,328 @@
+// simd_downscale.cpp - fused color conversion + box-filter downscale to RGB565.
+#include "runtime/simd/simd_downscale.h"
+
+namespace runtime::simd {
+
+namespace {
+
+// RGB565 spread over 32 bits as 00000GGGGGG00000RRRRR000000BBBBB: each field
+// gets >= 5 bits of headroom, so 32 pixels can be summed with plain adds.
+constexpr uint32_t kSpreadMask = 0x07E0F81FUL;
+constexpr int kRecipShift = 20;
+constexpr uint32_t kMaxWideArea = 1UL << 22;  // 255 * area must fit 32 bits
+
+struct RecipTable {
+  uint32_t value[BoxDownscaler::kPackedMaxArea + 1] = {};
+  RecipTable() {
+    for (int area = 1; area <= BoxDownscaler::kPackedMaxArea; ++area) {
+      value[area] = ((1UL << kRecipShift) + static_cast<uint32_t>(area) - 1U) / static_cast<uint32_t>(area);
+    }
+  }
+};
+
+const RecipTable kRecip;
+
+inline uint32_t spread565(uint16_t c) {
+  return (static_cast<uint32_t>(c) | (static_cast<uint32_t>(c) << 16U)) & kSpreadMask;
+}
+
+// Rounded sum / area, exact for sums up to 255 * kPackedMaxArea.
+inline uint32_t averagePacked(uint32_t sum, uint32_t area) {
+  return ((sum + (area >> 1U)) * kRecip.value[area]) >> kRecipShift;
+}
+
+inline uint32_t averageWide(uint32_t sum, uint32_t area) {
+  return (sum + (area >> 1U)) / area;
+}
+
+inline uint8_t clampU8(int32_t value) {
+  if (value < 0) {
+    return 0U;
+  }
+  if (value > 255) {
+    return 255U;
+  }
+  return static_cast<uint8_t>(value);
+}
+
+inline uint16_t swap16(uint16_t value) {
+  return static_cast<uint16_t>((value << 8U) | (value >> 8U));
+}
+
+// Same integer BT.601 conversion as simd_yuv422_to_rgb565().
+inline uint16_t yuvToRgb565(uint32_t y, uint32_t u, uint32_t v) {
+  const int32_t c = static_cast<int32_t>(y) - 16;
+  const int32_t d = static_cast<int32_t>(u) - 128;
+  const int32_t e = static_cast<int32_t>(v) - 128;
+  const uint8_t r = clampU8((298 * c + 409 * e + 128) >> 8);
+  const uint8_t g = clampU8((298 * c - 100 * d - 208 * e + 128) >> 8);
+  const uint8_t b = clampU8((298 * c + 516 * d + 128) >> 8);
+  return static_cast<uint16_t>(((r & 0xF8U) << 8U) | ((g & 0xFCU) << 3U) | (b >> 3U));
+}
+
+void buildSpans(int src, int dst, std::vector<uint16_t>* first, std::vector<uint16_t>* last) {
+  first->resize(static_cast<size_t>(dst));
+  last->resize(static_cast<size_t>(dst));
+  for (int i = 0; i < dst; ++i) {
+    int a = static_cast<int>((static_cast<int64_t>(i) * src) / dst);
+    int b = static_cast<int>((static_cast<int64_t>(i + 1) * src) / dst);
+    if (b <= a) {
+      b = a + 1;
+    }
+    (*first)[static_cast<size_t>(i)] = static_cast<uint16_t>(a);
+    (*last)[static_cast<size_t>(i)] = static_cast<uint16_t>(b);
+  }
+}
+
+}  // namespace
+
+bool BoxDownscaler::configure(int src_w, int src_h, int dst_w, int dst_h) {
+  if (src_w <= 0 || src_h <= 0 || dst_w <= 0 || dst_h <= 0 || src_w > 0xFFFF || src_h > 0xFFFF ||
+      dst_w > 0xFFFF || dst_h > 0xFFFF) {
+    reset();
+    return false;
+  }
+  if (src_w == src_w_ && src_h == src_h_ && dst_w == dst_w_ && dst_h == dst_h_) {
+    return true;
+  }
+  buildSpans(src_w, dst_w, &x0_, &x1_);
+  buildSpans(src_h, dst_h, &y0_, &y1_);
+  int max_w = 0;
+  int max_h = 0;
+  for (int i = 0; i < dst_w; ++i) {
+    const int w = x1_[static_cast<size_t>(i)] - x0_[static_cast<size_t>(i)];
+    max_w = (w > max_w) ? w : max_w;
+  }
+  for (int i = 0; i < dst_h; ++i) {
+    const int h = y1_[static_cast<size_t>(i)] - y0_[static_cast<size_t>(i)];
+    max_h = (h > max_h) ? h : max_h;
+  }
+  if (static_cast<uint32_t>(max_w) * static_cast<uint32_t>(max_h) > kMaxWideArea) {
+    reset();
+    return false;
+  }
+  max_area_ = max_w * max_h;
+  acc_a_.assign(static_cast<size_t>(dst_w), 0U);
+  acc_b_.assign(static_cast<size_t>(dst_w), 0U);
+  acc_c_.assign(static_cast<size_t>(dst_w), 0U);
+  src_w_ = src_w;
+  src_h_ = src_h;
+  dst_w_ = dst_w;
+  dst_h_ = dst_h;
+  return true;
+}
+
+void BoxDownscaler::reset() {
+  src_w_ = 0;
+  src_h_ = 0;
+  dst_w_ = 0;
+  dst_h_ = 0;
+  max_area_ = 0;
+  x0_.clear();
+  x1_.clear();
+  y0_.clear();
+  y1_.clear();
+  acc_a_.clear();
+  acc_b_.clear();
+  acc_c_.clear();
+}
+
+bool BoxDownscaler::configured() const {
+  return dst_w_ > 0;
+}
+
+int BoxDownscaler::maxBoxArea() const {
+  return max_area_;
+}
+
+bool BoxDownscaler::run(const void* src,
+                        DownscaleSource format,
+                        int src_stride_px,
+                        uint16_t* dst,
+                        int dst_stride_px,
+                        bool swap_bytes) {
+  if (!configured() || src == nullptr || dst == nullptr || src_stride_px < src_w_ || dst_stride_px < dst_w_) {
+    return false;
+  }
+  if (format == DownscaleSource::kYuv422 &&
+      ((src_w_ & 1) != 0 || (src_stride_px & 1) != 0 || (reinterpret_cast<uintptr_t>(src) & 0x3U) != 0U)) {
+    return false;  // YUYV rows are read one aligned pixel pair at a time
+  }
+  if (max_area_ > kPackedMaxArea) {
+    runWide(src, format, src_stride_px, dst, dst_stride_px, swap_bytes);
+  } else if (format == DownscaleSource::kYuv422) {
+    runPackedYuv422(static_cast<const uint8_t*>(src), src_stride_px, dst, dst_stride_px, swap_bytes);
+  } else {
+    runPackedRgb565(static_cast<const uint16_t*>(src), src_stride_px, dst, dst_stride_px, swap_bytes);
+  }
+  return true;
+}
+
+void BoxDownscaler::runPackedRgb565(const uint16_t* src,
+                                    int src_stride_px,
+                                    uint16_t* dst,
+                                    int dst_stride_px,
+                                    bool swap_bytes) {
+  uint32_t* acc = acc_a_.data();
+  const uint16_t* x0 = x0_.data();
+  const uint16_t* x1 = x1_.data();
+  for (int dy = 0; dy < dst_h_; ++dy) {
+    const int sy0 = y0_[static_cast<size_t>(dy)];
+    const int sy1 = y1_[static_cast<size_t>(dy)];
+    for (int dx = 0; dx < dst_w_; ++dx) {
+      acc[dx] = 0U;
+    }
+    for (int sy = sy0; sy < sy1; ++sy) {
+      const uint16_t* row = src + static_cast<size_t>(sy) * static_cast<size_t>(src_stride_px);
+      for (int dx = 0; dx < dst_w_; ++dx) {
+        uint32_t sum = 0U;
+        for (int x = x0[dx]; x < x1[dx]; ++x) {
+          sum += spread565(row[x]);
+        }
+        acc[dx] += sum;
+      }
+    }
+    const uint32_t rows = static_cast<uint32_t>(sy1 - sy0);
+    uint16_t* out = dst + static_cast<size_t>(dy) * static_cast<size_t>(dst_stride_px);
+    for (int dx = 0; dx < dst_w_; ++dx) {
+      const uint32_t area = static_cast<uint32_t>(x1[dx] - x0[dx]) * rows;
+      const uint32_t sum = acc[dx];
+      const uint32_t b = averagePacked(sum & 0x7FFU, area);
+      const uint32_t r = averagePacked((sum >> 11U) & 0x3FFU, area);
+      const uint32_t g = averagePacked(sum >> 21U, area);
+      const uint16_t px = static_cast<uint16_t>((r << 11U) | (g << 5U) | b);
+      out[dx] = swap_bytes ? swap16(px) : px;
+    }
+  }
+}
+
+void BoxDownscaler::runPackedYuv422(const uint8_t* src,
+                                    int src_stride_px,
+                                    uint16_t* dst,
+                                    int dst_stride_px,
+                                    bool swap_bytes) {
+  uint32_t* acc_y = acc_a_.data();
+  uint32_t* acc_uv = acc_b_.data();
+  const uint16_t* x0 = x0_.data();
+  const uint16_t* x1 = x1_.data();
+  for (int dy = 0; dy < dst_h_; ++dy) {
+    const int sy0 = y0_[static_cast<size_t>(dy)];
+    const int sy1 = y1_[static_cast<size_t>(dy)];
+    for (int dx = 0; dx < dst_w_; ++dx) {
+      acc_y[dx] = 0U;
+      acc_uv[dx] = 0U;
+    }
+    for (int sy = sy0; sy < sy1; ++sy) {
+      // One little-endian word per pixel pair: Y0 | U << 8 | Y1 << 16 | V << 24.
+      const uint32_t* pairs = reinterpret_cast<const uint32_t*>(
+          src + static_cast<size_t>(sy) * static_cast<size_t>(src_stride_px) * 2U);
+      for (int dx = 0; dx < dst_w_; ++dx) {
+        // 16-bit lanes: Y of even | odd pixels, and U | V.
+        uint32_t sum_y = 0U;
+        uint32_t sum_uv = 0U;
+        int x = x0[dx];
+        const int end = x1[dx];
+        if ((x & 1) != 0) {
+          const uint32_t w = pairs[x >> 1];
+          sum_y += w & 0x00FF0000UL;
+          sum_uv += (w >> 8U) & 0x00FF00FFUL;
+          ++x;
+        }
+        for (; x + 1 < end; x += 2) {
+          const uint32_t w = pairs[x >> 1];
+          const uint32_t uv = (w >> 8U) & 0x00FF00FFUL;
+          sum_y += w & 0x00FF00FFUL;
+          sum_uv += uv + uv;
+        }
+        if (x < end) {
+          const uint32_t w = pairs[x >> 1];
+          sum_y += w & 0x000000FFUL;
+          sum_uv += (w >> 8U) & 0x00FF00FFUL;
+        }
+        acc_y[dx] += sum_y;
+        acc_uv[dx] += sum_uv;
+      }
+    }
+    const uint32_t rows = static_cast<uint32_t>(sy1 - sy0);
+    uint16_t* out = dst + static_cast<size_t>(dy) * static_cast<size_t>(dst_stride_px);
+    for (int dx = 0; dx < dst_w_; ++dx) {
+      const uint32_t area = static_cast<uint32_t>(x1[dx] - x0[dx]) * rows;
+      const uint32_t yy = (acc_y[dx] & 0xFFFFU) + (acc_y[dx] >> 16U);
+      const uint16_t px = yuvToRgb565(averagePacked(yy, area),
+                                      averagePacked(acc_uv[dx] & 0xFFFFU, area),
+                                      averagePacked(acc_uv[dx] >> 16U, area));
+      out[dx] = swap_bytes ? swap16(px) : px;
+    }
+  }
+}
+
+void BoxDownscaler::runWide(const void* src,
+                            DownscaleSource format,
+                            int src_stride_px,
+                            uint16_t* dst,
+                            int dst_stride_px,
+                            bool swap_bytes) {
+  const bool yuv = (format == DownscaleSource::kYuv422);
+  for (int dy = 0; dy < dst_h_; ++dy) {
+    const int sy0 = y0_[static_cast<size_t>(dy)];
+    const int sy1 = y1_[static_cast<size_t>(dy)];
+    for (int dx = 0; dx < dst_w_; ++dx) {
+      acc_a_[static_cast<size_t>(dx)] = 0U;
+      acc_b_[static_cast<size_t>(dx)] = 0U;
+      acc_c_[static_cast<size_t>(dx)] = 0U;
+    }
+    for (int sy = sy0; sy < sy1; ++sy) {
+      for (int dx = 0; dx < dst_w_; ++dx) {
+        uint32_t a = 0U;
+        uint32_t b = 0U;
+        uint32_t c = 0U;
+        for (int x = x0_[static_cast<size_t>(dx)]; x < x1_[static_cast<size_t>(dx)]; ++x) {
+          if (yuv) {
+            const uint8_t* row = static_cast<const uint8_t*>(src) + static_cast<size_t>(sy) * static_cast<size_t>(src_stride_px) * 2U;
+            const uint8_t* pair = row + static_cast<size_t>(x & ~1) * 2U;
+            a += row[static_cast<size_t>(x) * 2U];
+            b += pair[1];
+            c += pair[3];
+          } else {
+            const uint16_t px =
+                static_cast<const uint16_t*>(src)[static_cast<size_t>(sy) * static_cast<size_t>(src_stride_px) + static_cast<size_t>(x)];
+            a += (px >> 11U) & 0x1FU;
+            b += (px >> 5U) & 0x3FU;
+            c += px & 0x1FU;
+          }
+        }
+        acc_a_[static_cast<size_t>(dx)] += a;
+        acc_b_[static_cast<size_t>(dx)] += b;
+        acc_c_[static_cast<size_t>(dx)] += c;
+      }
+    }
+    const uint32_t rows = static_cast<uint32_t>(sy1 - sy0);
+    uint16_t* out = dst + static_cast<size_t>(dy) * static_cast<size_t>(dst_stride_px);
+    for (int dx = 0; dx < dst_w_; ++dx) {
+      const uint32_t area = static_cast<uint32_t>(x1_[static_cast<size_t>(dx)] - x0_[static_cast<size_t>(dx)]) * rows;
+      const uint32_t a = averageWide(acc_a_[static_cast<size_t>(dx)], area);
+      const uint32_t b = averageWide(acc_b_[static_cast<size_t>(dx)], area);
+      const uint32_t c = averageWide(acc_c_[static_cast<size_t>(dx)], area);
+      const uint16_t px = yuv ? yuvToRgb565(a, b, c) : static_cast<uint16_t>((a << 11U) | (b << 5U) | c);
+      out[dx] = swap_bytes ? swap16(px) : px;
+    }
+  }
+}
+
+bool simd_box_downscale_to_rgb565(const void* src,
+                                  DownscaleSource format,
+                                  int src_w,
+                                  int src_h,
+                                  int src_stride_px,
+                                  uint16_t* dst,
+                                  int dst_w,
+                                  int dst_h,
+                                  int dst_stride_px) {
+  BoxDownscaler scaler;
+  if (!scaler.configure(src_w, src_h, dst_w, dst_h)) {
+    return false;
+  }
+  return scaler.run(src, format, src_stride_px, dst, dst_stride_px);
+}
+
+}  // namespace runtime::simd
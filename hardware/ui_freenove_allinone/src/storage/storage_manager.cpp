@@ -4,6 +4,7 @@
 #include <ArduinoJson.h>
 #include <FS.h>
 #include <LittleFS.h>
+#include <mbedtls/sha256.h>
 
 #if defined(ARDUINO_ARCH_ESP32) && __has_include(<SD_MMC.h>)
 #include <SD_MMC.h>
@@ -16,8 +17,10 @@
 #include <cstring>
 #include <cctype>
 #include <cerrno>
+#include <new>
 
 #include "resources/screen_scene_registry.h"
+#include "runtime/memory/caps_allocator.h"
 #include "scenarios/default_scenario_v2.h"
 #include "system/runtime_metrics.h"
 
@@ -51,6 +54,22 @@ constexpr EmbeddedStoryAsset kEmbeddedStoryAssets[] = {
 };
 
 constexpr uint8_t kSdFailureDisableThreshold = 3U;
+constexpr const char* kVerifyCachePath = "/story/.verify_cache";
+constexpr const char* kIntegrityManifestPath = "/story/integrity.sha256";
+// Per updateVerification(): one chunk of real hashing, or this many cache hits.
+constexpr size_t kVerifyChunkBytes = 4096U;
+constexpr uint8_t kVerifyFilesPerUpdate = 8U;
+constexpr const char* kSyncJournalPath = "/story/.sync_journal";
+constexpr const char* kSyncTempSuffix = ".part";
+constexpr const char* kStorySyncDirs[] = {"scenarios", "screens", "audio", "apps", "actions"};
+// Per updateStorySync(): at most this much copied and one file committed, or
+// this many files compared while planning.
+constexpr size_t kSyncChunkBytes = 4096U;
+constexpr uint8_t kSyncPlanFilesPerUpdate = 4U;
+// Scene payloads, audio pack paths and story JSON share one PSRAM arena; the
+// internal-RAM fallback is kept small.
+constexpr size_t kContentCacheBytes = 48U * 1024U;
+constexpr size_t kContentCacheFallbackBytes = 12U * 1024U;
 
 
 uint32_t fnv1aUpdate(uint32_t hash, uint8_t value) {
@@ -59,6 +78,57 @@ uint32_t fnv1aUpdate(uint32_t hash, uint8_t value) {
   return hash;
 }
 
+uint32_t fnv1aFile(File& file) {
+  uint32_t hash = 2166136261UL;
+  uint8_t buffer[512];
+  for (;;) {
+    const size_t read_bytes = file.read(buffer, sizeof(buffer));
+    if (read_bytes == 0U) {
+      break;
+    }
+    for (size_t index = 0U; index < read_bytes; ++index) {
+      hash = fnv1aUpdate(hash, buffer[index]);
+    }
+  }
+  return hash;
+}
+
+void putFnv1aDigest(uint32_t hash, uint8_t* digest) {
+  digest[0] = static_cast<uint8_t>(hash);
+  digest[1] = static_cast<uint8_t>(hash >> 8U);
+  digest[2] = static_cast<uint8_t>(hash >> 16U);
+  digest[3] = static_cast<uint8_t>(hash >> 24U);
+}
+
+bool sha256File(File& file, uint8_t* digest) {
+  mbedtls_sha256_context sha;
+  mbedtls_sha256_init(&sha);
+  bool ok = mbedtls_sha256_starts_ret(&sha, 0) == 0;
+  uint8_t buffer[512];
+  while (ok) {
+    const size_t read_bytes = file.read(buffer, sizeof(buffer));
+    if (read_bytes == 0U) {
+      break;
+    }
+    ok = mbedtls_sha256_update_ret(&sha, buffer, read_bytes) == 0;
+  }
+  ok = ok && mbedtls_sha256_finish_ret(&sha, digest) == 0;
+  mbedtls_sha256_free(&sha);
+  return ok;
+}
+
+void feedManifest(File& file, StoryManifest* manifest) {
+  char buffer[128];
+  for (;;) {
+    const size_t read_bytes = file.readBytes(buffer, sizeof(buffer));
+    if (read_bytes == 0U) {
+      break;
+    }
+    manifest->feed(buffer, read_bytes);
+  }
+  manifest->finish();
+}
+
 bool ensureParentDirectories(fs::FS& file_system, const char* file_path) {
   if (file_path == nullptr || file_path[0] != '/') {
     return false;
@@ -173,8 +243,71 @@ String scenePayloadSourceKindFromOrigin(const String& origin_path) {
   return String("other");
 }
 
+size_t readFileChunk(void* ctx, uint8_t* out, size_t capacity) {
+  return static_cast<File*>(ctx)->read(out, capacity);
+}
+
+// Streams the whole file into the cache, or into a detached view when the
+// cache is missing or has no room for it.
+StoryContentView readFileContent(StoryContentCache* cache,
+                                 StoryContentKind kind,
+                                 const char* key,
+                                 const char* origin,
+                                 File& file) {
+  const size_t size = static_cast<size_t>(file.size());
+  if (size == 0U) {
+    return StoryContentView();
+  }
+  if (cache != nullptr) {
+    StoryContentView view = cache->insertFrom(kind, key, origin, size, readFileChunk, &file);
+    if (!view.empty() || !file.seek(0)) {
+      return view;
+    }
+  }
+  return StoryContentView::detached(size, readFileChunk, &file);
+}
+
 }  // namespace
 
+struct StorageManager::VerifyJob {
+  File file;
+  String path;
+  StoryFileStamp stamp;
+  mbedtls_sha256_context sha;
+  bool active = false;
+};
+
+struct StorageManager::SyncJob {
+  bool planning = true;
+  uint32_t started_ms = 0U;
+  StorySyncJournal* journal = nullptr;
+  StoryManifest* sd_manifest = nullptr;  // planning only
+  uint8_t dir_index = 0U;
+  File dir;
+  bool entry_open = false;
+  File src;
+  File dst;
+  uint32_t entry_bytes = 0U;
+  uint32_t fnv = 0U;
+  mbedtls_sha256_context sha;
+};
+
+StorageManager::~StorageManager() {
+  releaseSyncJob();
+  if (verify_job_ != nullptr) {
+    if (verify_job_->active) {
+      verify_job_->file.close();
+      mbedtls_sha256_free(&verify_job_->sha);
+    }
+    delete verify_job_;
+  }
+  // Both are trivially destructible.
+  runtime::memory::CapsAllocator::release(verify_cache_);
+  runtime::memory::CapsAllocator::release(manifest_);
+  runtime::memory::CapsAllocator::release(content_cache_);
+  runtime::memory::CapsAllocator::release(content_arena_);
+}
+
 bool StorageManager::begin() {
   if (!LittleFS.begin()) {
     Serial.println("[FS] LittleFS mount failed");
@@ -320,14 +453,86 @@ bool StorageManager::readTextFromLittleFs(const char* path, String* out_payload)
   return !out_payload->isEmpty();
 }
 
-bool StorageManager::readTextFromSdCard(const char* path, String* out_payload) const {
-  if (out_payload == nullptr || !sd_ready_) {
-    return false;
+String StorageManager::loadTextFile(const char* path) const {
+  const StoryContentView view = loadTextView(path);
+  return view.empty() ? String() : String(view.c_str());
+}
+
+StoryContentView StorageManager::loadTextView(const char* path) const {
+  const String normalized = normalizeAbsolutePath(path);
+  if (normalized.isEmpty()) {
+    return StoryContentView();
+  }
+  StoryContentCache* cache = contentCache();
+  if (cache != nullptr) {
+    StoryContentView view = cache->find(StoryContentKind::kStoryJson, normalized.c_str());
+    if (!view.empty()) {
+      return view;
+    }
+  }
+  return readContentView(StoryContentKind::kStoryJson, normalized.c_str(), normalized.c_str(), nullptr);
+}
+
+StoryContentCache* StorageManager::contentCache() const {
+  if (content_cache_ != nullptr) {
+    return content_cache_;
+  }
+  void* cache_mem = runtime::memory::CapsAllocator::allocPsram(sizeof(StoryContentCache), "content_cache");
+  if (cache_mem == nullptr) {
+    return nullptr;
+  }
+  bool used_fallback = false;
+  size_t arena_bytes = kContentCacheBytes;
+  void* arena = runtime::memory::CapsAllocator::allocPsram(arena_bytes, "content_arena", &used_fallback);
+  if (arena != nullptr && used_fallback) {
+    // No PSRAM: do not hold 48 KB of internal RAM for a cache.
+    runtime::memory::CapsAllocator::release(arena);
+    arena_bytes = kContentCacheFallbackBytes;
+    arena = runtime::memory::CapsAllocator::allocDefault(arena_bytes, "content_arena");
+  }
+  if (arena == nullptr) {
+    runtime::memory::CapsAllocator::release(cache_mem);
+    return nullptr;
+  }
+  content_cache_ = new (cache_mem) StoryContentCache();
+  content_arena_ = static_cast<uint8_t*>(arena);
+  content_arena_psram_ = !used_fallback;
+  content_cache_->begin(content_arena_, arena_bytes);
+  Serial.printf("[FS] content cache %u bytes (%s)\n",
+                static_cast<unsigned int>(content_cache_->capacity()),
+                content_arena_psram_ ? "psram" : "internal");
+  return content_cache_;
+}
+
+StoryContentView StorageManager::readContentView(StoryContentKind kind,
+                                                 const char* key,
+                                                 const char* path,
+                                                 String* out_origin) const {
+  const String normalized = normalizeAbsolutePath(path);
+  if (normalized.isEmpty()) {
+    return StoryContentView();
+  }
+  StoryContentCache* cache = contentCache();
+  if (!startsWithIgnoreCase(normalized.c_str(), "/sd/") && pathExistsOnLittleFs(normalized.c_str())) {
+    File file = LittleFS.open(normalized.c_str(), "r");
+    if (file) {
+      StoryContentView view = readFileContent(cache, kind, key, normalized.c_str(), file);
+      file.close();
+      if (!view.empty()) {
+        if (out_origin != nullptr) {
+          *out_origin = normalized;
+        }
+        return view;
+      }
+    }
+  }
+  if (!sd_ready_) {
+    return StoryContentView();
   }
 #if ZACUS_HAS_SD_MMC
-  const String sd_path = stripSdPrefix(path);
+  const String sd_path = stripSdPrefix(normalized.c_str());
   if (sd_path.isEmpty()) {
-    return false;
+    return StoryContentView();
   }
   errno = 0;
   File file = SD_MMC.open(sd_path.c_str(), "r");
@@ -339,77 +544,28 @@ bool StorageManager::readTextFromSdCard(const char* path, String* out_payload) c
     if (open_error != 0 && open_error != ENOENT) {
       noteSdAccessFailure("open", sd_path.c_str(), open_error);
     }
-    return false;
+    return StoryContentView();
   }
-  out_payload->remove(0);
-  out_payload->reserve(static_cast<size_t>(file.size()) + 1U);
-  while (file.available()) {
-    const int value = file.read();
-    if (value < 0) {
-      file.close();
+  const String origin = "/sd" + sd_path;
+  const bool has_bytes = file.size() > 0U;
+  StoryContentView view = readFileContent(cache, kind, key, origin.c_str(), file);
+  file.close();
+  if (view.empty()) {
+    if (has_bytes) {
       noteSdAccessFailure("read", sd_path.c_str(), EIO);
-      return false;
     }
-    *out_payload += static_cast<char>(value);
+    return view;
   }
-  file.close();
   noteSdAccessSuccess();
-  return !out_payload->isEmpty();
+  if (out_origin != nullptr) {
+    *out_origin = origin;
+  }
+  return view;
 #else
-  (void)path;
-  return false;
+  return StoryContentView();
 #endif
 }
 
-bool StorageManager::readTextFileWithOrigin(const char* path, String* out_payload, String* out_origin) const {
-  if (out_payload == nullptr) {
-    return false;
-  }
-  const String normalized = normalizeAbsolutePath(path);
-  if (normalized.isEmpty()) {
-    return false;
-  }
-  const bool force_sd = startsWithIgnoreCase(normalized.c_str(), "/sd/");
-
-  String payload;
-  if (force_sd) {
-    if (!readTextFromSdCard(normalized.c_str(), &payload)) {
-      return false;
-    }
-    *out_payload = payload;
-    if (out_origin != nullptr) {
-      *out_origin = stripSdPrefix(normalized.c_str());
-      *out_origin = "/sd" + *out_origin;
-    }
-    return true;
-  }
-
-  if (readTextFromLittleFs(normalized.c_str(), &payload)) {
-    *out_payload = payload;
-    if (out_origin != nullptr) {
-      *out_origin = normalized;
-    }
-    return true;
-  }
-  if (readTextFromSdCard(normalized.c_str(), &payload)) {
-    *out_payload = payload;
-    if (out_origin != nullptr) {
-      *out_origin = "/sd" + stripSdPrefix(normalized.c_str());
-    }
-    return true;
-  }
-  return false;
-}
-
-String StorageManager::loadTextFile(const char* path) const {
-  String payload;
-  String origin;
-  if (!readTextFileWithOrigin(path, &payload, &origin)) {
-    return String();
-  }
-  return payload;
-}
-
 String StorageManager::resolveReadableAssetPath(const String& absolute_path) const {
   if (absolute_path.isEmpty()) {
     return String();
@@ -427,10 +583,15 @@ String StorageManager::resolveReadableAssetPath(const String& absolute_path) con
 }
 
 String StorageManager::loadScenePayloadById(const char* scene_id) const {
+  const StoryContentView view = loadScenePayloadView(scene_id);
+  return view.empty() ? String() : String(view.c_str());
+}
+
+StoryContentView StorageManager::loadScenePayloadView(const char* scene_id) const {
   if (scene_id == nullptr || scene_id[0] == '\0') {
     last_scene_payload_origin_.remove(0);
     last_scene_payload_source_kind_.remove(0);
-    return String();
+    return StoryContentView();
   }
 
   const char* normalized_scene_id = storyNormalizeScreenSceneId(scene_id);
@@ -445,32 +606,15 @@ String StorageManager::loadScenePayloadById(const char* scene_id) const {
 
   const String id = normalized_scene_id;
   const String raw_id = scene_id;
-  for (uint8_t slot = 0U; slot < kSceneCacheSlots; ++slot) {
-    if (scene_cache_ids_[slot] == id && !scene_cache_payloads_[slot].isEmpty()) {
-      last_scene_payload_origin_ = scene_cache_origins_[slot];
-      last_scene_payload_source_kind_ = scene_cache_source_kinds_[slot];
-      return scene_cache_payloads_[slot];
-    }
-  }
-  auto cache_scene_payload = [this, &id](const String& payload, const String& origin, const String& source_kind) {
-    uint8_t slot = kSceneCacheSlots;
-    for (uint8_t index = 0U; index < kSceneCacheSlots; ++index) {
-      if (scene_cache_ids_[index] == id) {
-        slot = index;
-        break;
-      }
-    }
-    if (slot >= kSceneCacheSlots) {
-      slot = scene_cache_next_slot_;
-      scene_cache_next_slot_ = static_cast<uint8_t>((scene_cache_next_slot_ + 1U) % kSceneCacheSlots);
+  StoryContentCache* cache = contentCache();
+  if (cache != nullptr) {
+    StoryContentView cached = cache->find(StoryContentKind::kScene, id.c_str());
+    if (!cached.empty()) {
+      last_scene_payload_origin_ = cached.aux();
+      last_scene_payload_source_kind_ = scenePayloadSourceKindFromOrigin(last_scene_payload_origin_);
+      return cached;
     }
-    scene_cache_ids_[slot] = id;
-    scene_cache_payloads_[slot] = payload;
-    scene_cache_origins_[slot] = origin;
-    scene_cache_source_kinds_[slot] = source_kind;
-    last_scene_payload_origin_ = origin;
-    last_scene_payload_source_kind_ = source_kind;
-  };
+  }
   String candidates[14];
   size_t candidate_count = 0U;
   auto add_candidate = [&candidate_count, &candidates](const String& value) {
@@ -503,33 +647,27 @@ String StorageManager::loadScenePayloadById(const char* scene_id) const {
   }
   for (size_t index = 0U; index < candidate_count; ++index) {
     const String& candidate = candidates[index];
-    String payload;
     String origin;
-    if (!readTextFileWithOrigin(candidate.c_str(), &payload, &origin)) {
+    StoryContentView payload = readContentView(StoryContentKind::kScene, id.c_str(), candidate.c_str(), &origin);
+    if (payload.empty()) {
       continue;
     }
     if (raw_id != id && candidate.indexOf(raw_id) >= 0) {
       Serial.printf("[FS] scene payload loaded from legacy alias path: %s\n", candidate.c_str());
     }
     Serial.printf("[FS] scene %s -> %s (id=%s)\n", scene_id, origin.c_str(), normalized_scene_id);
-    const String source_kind = scenePayloadSourceKindFromOrigin(origin);
-    cache_scene_payload(payload, origin, source_kind);
+    last_scene_payload_origin_ = origin;
+    last_scene_payload_source_kind_ = scenePayloadSourceKindFromOrigin(origin);
     return payload;
   }
 
   Serial.printf("[FS] scene payload missing for id=%s (normalized=%s)\n", scene_id, normalized_scene_id);
   last_scene_payload_origin_.remove(0);
   last_scene_payload_source_kind_.remove(0);
-  for (uint8_t slot = 0U; slot < kSceneCacheSlots; ++slot) {
-    if (scene_cache_ids_[slot] == id) {
-      scene_cache_ids_[slot].remove(0);
-      scene_cache_payloads_[slot].remove(0);
-      scene_cache_origins_[slot].remove(0);
-      scene_cache_source_kinds_[slot].remove(0);
-      break;
-    }
+  if (cache != nullptr) {
+    cache->invalidate(StoryContentKind::kScene, id.c_str());
   }
-  return String();
+  return StoryContentView();
 }
 
 String StorageManager::resolveAudioPathByPackId(const char* pack_id) const {
@@ -538,25 +676,17 @@ String StorageManager::resolveAudioPathByPackId(const char* pack_id) const {
   }
 
   const String id = pack_id;
-  for (uint8_t slot = 0U; slot < kAudioCacheSlots; ++slot) {
-    if (audio_cache_pack_ids_[slot] == id && !audio_cache_paths_[slot].isEmpty()) {
-      return audio_cache_paths_[slot];
+  StoryContentCache* cache = contentCache();
+  if (cache != nullptr) {
+    const StoryContentView cached = cache->find(StoryContentKind::kAudioMap, id.c_str());
+    if (!cached.empty()) {
+      return String(cached.c_str());
     }
   }
-  auto cache_audio_path = [this, &id](const String& path) {
-    uint8_t slot = kAudioCacheSlots;
-    for (uint8_t index = 0U; index < kAudioCacheSlots; ++index) {
-      if (audio_cache_pack_ids_[index] == id) {
-        slot = index;
-        break;
-      }
-    }
-    if (slot >= kAudioCacheSlots) {
-      slot = audio_cache_next_slot_;
-      audio_cache_next_slot_ = static_cast<uint8_t>((audio_cache_next_slot_ + 1U) % kAudioCacheSlots);
+  auto cache_audio_path = [cache, &id](const String& path) {
+    if (cache != nullptr) {
+      cache->insert(StoryContentKind::kAudioMap, id.c_str(), "", path.c_str(), path.length());
     }
-    audio_cache_pack_ids_[slot] = id;
-    audio_cache_paths_[slot] = path;
   };
   const String slug = packIdToSlug(pack_id);
   const String json_candidates[] = {
@@ -569,14 +699,15 @@ String StorageManager::resolveAudioPathByPackId(const char* pack_id) const {
   };
 
   for (const String& json_path : json_candidates) {
-    String payload;
     String origin;
-    if (!readTextFileWithOrigin(json_path.c_str(), &payload, &origin) || payload.isEmpty()) {
+    const StoryContentView payload =
+        readContentView(StoryContentKind::kStoryJson, json_path.c_str(), json_path.c_str(), &origin);
+    if (payload.empty()) {
       continue;
     }
 
     StaticJsonDocument<384> document;
-    const DeserializationError error = deserializeJson(document, payload);
+    const DeserializationError error = deserializeJson(document, payload.c_str(), payload.length());
     if (error) {
       Serial.printf("[FS] invalid audio pack json %s (%s)\n", origin.c_str(), error.c_str());
       continue;
@@ -657,12 +788,8 @@ String StorageManager::resolveAudioPathByPackId(const char* pack_id) const {
     return resolved;
   }
 
-  for (uint8_t slot = 0U; slot < kAudioCacheSlots; ++slot) {
-    if (audio_cache_pack_ids_[slot] == id) {
-      audio_cache_pack_ids_[slot].remove(0);
-      audio_cache_paths_[slot].remove(0);
-      break;
-    }
+  if (cache != nullptr) {
+    cache->invalidate(StoryContentKind::kAudioMap, id.c_str());
   }
   return String();
 }
@@ -678,6 +805,9 @@ bool StorageManager::writeTextToLittleFs(const char* path, const char* payload)
   if (!ensureParentDirectoriesOnLittleFs(path)) {
     return false;
   }
+  if (content_cache_ != nullptr) {
+    content_cache_->invalidate(StoryContentKind::kStoryJson, path);
+  }
   File file = LittleFS.open(path, "w");
   if (!file) {
     return false;
@@ -709,7 +839,10 @@ bool StorageManager::copyFileFromSdToLittleFs(const char* src_path, const char*
     src.close();
     return false;
   }
-  File dst = LittleFS.open(dst_path, "w");
+  // Copied aside then renamed over the target (lfs_rename replaces it
+  // atomically): a reset or failure at any point keeps the previous file.
+  const String tmp_path = String(dst_path) + kSyncTempSuffix;
+  File dst = LittleFS.open(tmp_path.c_str(), "w");
   if (!dst) {
     src.close();
     return false;
@@ -720,18 +853,24 @@ bool StorageManager::copyFileFromSdToLittleFs(const char* src_path, const char*
     if (read_bytes == 0U) {
       src.close();
       dst.close();
+      LittleFS.remove(tmp_path.c_str());
       noteSdAccessFailure("read", sd_path.c_str(), EIO);
       return false;
     }
     if (dst.write(buffer, read_bytes) != read_bytes) {
       dst.close();
       src.close();
+      LittleFS.remove(tmp_path.c_str());
       return false;
     }
   }
   dst.close();
   src.close();
   noteSdAccessSuccess();
+  if (!LittleFS.rename(tmp_path.c_str(), dst_path)) {
+    LittleFS.remove(tmp_path.c_str());
+    return false;
+  }
   return true;
 #else
   (void)src_path;
@@ -751,54 +890,21 @@ bool StorageManager::syncStoryFileFromSd(const char* story_path) {
   if (normalized.isEmpty() || !pathExistsOnSdCard(normalized.c_str())) {
     return false;
   }
+  StorySyncProbe source;
+  StorySyncProbe target;
+  if (probeSdFile(normalized, &source) && probeLittleFsFile(normalized, source.kind, &target) &&
+      !storySyncNeedsCopy(source, target)) {
+    return true;
+  }
   const bool copied = copyFileFromSdToLittleFs(normalized.c_str(), normalized.c_str());
   if (copied) {
+    enqueueVerification(normalized.c_str());
     invalidateStoryCaches();
     Serial.printf("[FS] synced story file from SD: %s\n", normalized.c_str());
   }
   return copied;
 }
 
-bool StorageManager::copyStoryDirectoryFromSd(const char* relative_dir) {
-  if (relative_dir == nullptr || relative_dir[0] == '\0') {
-    return false;
-  }
-  if (!sd_ready_ && !mountSdCard()) {
-    return false;
-  }
-#if ZACUS_HAS_SD_MMC
-  String source_dir = "/story/";
-  source_dir += relative_dir;
-  if (!pathExistsOnSdCard(source_dir.c_str())) {
-    return false;
-  }
-
-  File dir = SD_MMC.open(source_dir.c_str());
-  if (!dir || !dir.isDirectory()) {
-    return false;
-  }
-
-  bool copied_any = false;
-  File entry = dir.openNextFile();
-  while (entry) {
-    if (!entry.isDirectory()) {
-      String src_path = entry.name();
-      if (!src_path.isEmpty()) {
-        if (copyFileFromSdToLittleFs(src_path.c_str(), src_path.c_str())) {
-          copied_any = true;
-        }
-      }
-    }
-    entry.close();
-    entry = dir.openNextFile();
-  }
-  return copied_any;
-#else
-  (void)relative_dir;
-  return false;
-#endif
-}
-
 bool StorageManager::provisionEmbeddedAsset(const char* path,
                                             const char* payload,
                                             bool* out_written) const {
@@ -814,6 +920,9 @@ bool StorageManager::provisionEmbeddedAsset(const char* path,
   if (!writeTextToLittleFs(path, payload)) {
     return false;
   }
+  if (ensureVerifyState()) {
+    verify_cache_->invalidate(path);
+  }
   if (out_written != nullptr) {
     *out_written = true;
   }
@@ -821,18 +930,9 @@ bool StorageManager::provisionEmbeddedAsset(const char* path,
 }
 
 void StorageManager::invalidateStoryCaches() const {
-  for (uint8_t index = 0U; index < kSceneCacheSlots; ++index) {
-    scene_cache_ids_[index].remove(0);
-    scene_cache_payloads_[index].remove(0);
-    scene_cache_origins_[index].remove(0);
-    scene_cache_source_kinds_[index].remove(0);
-  }
-  for (uint8_t index = 0U; index < kAudioCacheSlots; ++index) {
-    audio_cache_pack_ids_[index].remove(0);
-    audio_cache_paths_[index].remove(0);
-  }
-  scene_cache_next_slot_ = 0U;
-  audio_cache_next_slot_ = 0U;
+  if (content_cache_ != nullptr) {
+    content_cache_->clear();
+  }
   last_scene_payload_origin_.remove(0);
   last_scene_payload_source_kind_.remove(0);
 }
@@ -857,19 +957,13 @@ bool StorageManager::isStoryScreenPayloadPresent() const {
 }
 
 bool StorageManager::syncStoryTreeFromSd() {
-  if (!sd_ready_ && !mountSdCard()) {
+  if (!beginStorySync(millis())) {
     return false;
   }
-  const char* story_dirs[] = {"scenarios", "screens", "audio", "apps", "actions"};
-  bool copied_any = false;
-  for (const char* relative_dir : story_dirs) {
-    copied_any = copyStoryDirectoryFromSd(relative_dir) || copied_any;
+  while (sync_job_ != nullptr) {
+    updateStorySync(millis());
   }
-  if (copied_any) {
-    invalidateStoryCaches();
-    Serial.println("[FS] story tree refreshed from SD");
-  }
-  return copied_any;
+  return sync_stats_.planned > 0U && sync_stats_.failed == 0U;
 }
 
 bool StorageManager::ensureDefaultStoryBundle() {
@@ -919,6 +1013,9 @@ bool StorageManager::ensureDefaultScenarioFile(const char* path) {
     Serial.printf("[FS] cannot create default scenario file: %s\n", normalized.c_str());
     return false;
   }
+  if (ensureVerifyState()) {
+    verify_cache_->invalidate(normalized.c_str());
+  }
   Serial.printf("[FS] default scenario provisioned: %s\n", normalized.c_str());
   return true;
 }
@@ -973,8 +1070,10 @@ uint32_t StorageManager::checksum(const char* path) const {
   }
 
   File file;
+  bool on_little_fs = false;
   if (pathExistsOnLittleFs(normalized.c_str())) {
     file = LittleFS.open(normalized.c_str(), "r");
+    on_little_fs = true;
   } else if (pathExistsOnSdCard(normalized.c_str())) {
 #if ZACUS_HAS_SD_MMC
     file = SD_MMC.open(stripSdPrefix(normalized.c_str()).c_str(), "r");
@@ -984,14 +1083,811 @@ uint32_t StorageManager::checksum(const char* path) const {
     return 0U;
   }
 
-  uint32_t hash = 2166136261UL;
-  while (file.available()) {
-    const int value = file.read();
-    if (value < 0) {
-      break;
+  const uint32_t hash = checksumFile(file, on_little_fs ? normalized.c_str() : nullptr);
+  file.close();
+  return hash;
+}
+
+uint32_t StorageManager::loadedChecksum(const char* path, String* out_origin) const {
+  if (out_origin != nullptr) {
+    out_origin->remove(0);
+  }
+  const String normalized = normalizeAbsolutePath(path);
+  if (normalized.isEmpty()) {
+    return 0U;
+  }
+  // Same resolution as readContentView(): an empty LittleFS copy falls
+  // through to SD.
+  if (!startsWithIgnoreCase(normalized.c_str(), "/sd/") && pathExistsOnLittleFs(normalized.c_str())) {
+    File file = LittleFS.open(normalized.c_str(), "r");
+    if (file && !file.isDirectory() && file.size() > 0U) {
+      const uint32_t hash = checksumFile(file, normalized.c_str());
+      file.close();
+      if (out_origin != nullptr) {
+        *out_origin = normalized;
+      }
+      return hash;
+    }
+    if (file) {
+      file.close();
     }
-    hash = fnv1aUpdate(hash, static_cast<uint8_t>(value));
   }
+  if (!sd_ready_) {
+    return 0U;
+  }
+#if ZACUS_HAS_SD_MMC
+  const String sd_path = stripSdPrefix(normalized.c_str());
+  if (sd_path.isEmpty()) {
+    return 0U;
+  }
+  File file = SD_MMC.open(sd_path.c_str(), "r");
+  if (!file || file.isDirectory()) {
+    if (file) {
+      file.close();
+    }
+    return 0U;
+  }
+  const uint32_t hash = checksumFile(file, nullptr);
   file.close();
+  if (out_origin != nullptr) {
+    *out_origin = "/sd" + sd_path;
+  }
   return hash;
+#else
+  return 0U;
+#endif
+}
+
+// cache_path is set for LittleFS files only: their digests are invalidated
+// on every write through this class; SD files are hashed each time.
+uint32_t StorageManager::checksumFile(File& file, const char* cache_path) const {
+  uint8_t digest[StoryVerifyCache::kDigestBytes] = {};
+  StoryFileStamp stamp;
+  stamp.size = static_cast<uint32_t>(file.size());
+  stamp.mtime = static_cast<uint32_t>(file.getLastWrite());
+  const bool cacheable = cache_path != nullptr && ensureVerifyState();
+  if (cacheable && verify_cache_->lookup(cache_path, StoryDigestKind::kFnv1a32, stamp, digest)) {
+    return static_cast<uint32_t>(digest[0]) | (static_cast<uint32_t>(digest[1]) << 8U) |
+           (static_cast<uint32_t>(digest[2]) << 16U) | (static_cast<uint32_t>(digest[3]) << 24U);
+  }
+  const uint32_t hash = fnv1aFile(file);
+  if (cacheable) {
+    putFnv1aDigest(hash, digest);
+    verify_cache_->store(cache_path, StoryDigestKind::kFnv1a32, stamp, digest);
+  }
+  return hash;
+}
+
+bool StorageManager::ensureVerifyState() const {
+  if (verify_cache_ != nullptr && manifest_ != nullptr) {
+    return true;
+  }
+  void* cache_mem = runtime::memory::CapsAllocator::allocPsram(sizeof(StoryVerifyCache), "verify_cache");
+  void* manifest_mem = runtime::memory::CapsAllocator::allocPsram(sizeof(StoryManifest), "verify_manifest");
+  if (cache_mem == nullptr || manifest_mem == nullptr) {
+    runtime::memory::CapsAllocator::release(cache_mem);
+    runtime::memory::CapsAllocator::release(manifest_mem);
+    return false;
+  }
+  verify_cache_ = new (cache_mem) StoryVerifyCache();
+  manifest_ = new (manifest_mem) StoryManifest();
+
+  File cache_file = LittleFS.open(kVerifyCachePath, "r");
+  if (cache_file) {
+    const size_t size = static_cast<size_t>(cache_file.size());
+    uint8_t* image = static_cast<uint8_t*>(malloc(size > 0U ? size : 1U));
+    if (image != nullptr) {
+      const size_t read_bytes = cache_file.read(image, size);
+      if (!verify_cache_->deserialize(image, read_bytes)) {
+        Serial.printf("[FS] verify cache discarded: %s\n", kVerifyCachePath);
+      }
+      free(image);
+    }
+    cache_file.close();
+  }
+  reloadIntegrityManifest();
+  Serial.printf("[FS] verify cache entries=%u manifest entries=%u rejected=%lu\n",
+                static_cast<unsigned int>(verify_cache_->count()),
+                static_cast<unsigned int>(manifest_->count()),
+                static_cast<unsigned long>(manifest_->rejectedLines()));
+  return true;
+}
+
+void StorageManager::enqueueVerification(const char* path) {
+  if (path == nullptr || path[0] == '\0' || !ensureVerifyState()) {
+    return;
+  }
+  verify_cache_->invalidate(path);
+  for (uint8_t index = 0U; index < verify_queue_count_; ++index) {
+    if (verify_queue_[(verify_queue_head_ + index) % kVerifyQueueSlots] == path) {
+      return;
+    }
+  }
+  if (verify_queue_count_ >= kVerifyQueueSlots) {
+    // Dropped: a bundle sweep reaches it anyway when the manifest lists it.
+    if (!sweep_active_) {
+      scheduleBundleVerification(millis());
+    }
+    return;
+  }
+  verify_queue_[(verify_queue_head_ + verify_queue_count_) % kVerifyQueueSlots] = path;
+  ++verify_queue_count_;
+}
+
+bool StorageManager::scheduleBundleVerification(uint32_t now_ms) {
+  if (!ensureVerifyState() || manifest_->count() == 0U) {
+    return false;
+  }
+  sweep_active_ = true;
+  sweep_offset_ = 0U;
+  sweep_started_ms_ = now_ms;
+  return true;
+}
+
+StorageManager::ContentCacheStats StorageManager::contentCacheStats() const {
+  ContentCacheStats stats;
+  if (content_cache_ == nullptr) {
+    return stats;
+  }
+  for (size_t index = 0U; index < static_cast<size_t>(StoryContentKind::kCount); ++index) {
+    const StoryContentKind kind = static_cast<StoryContentKind>(index);
+    stats.kinds[index] = content_cache_->stats(kind);
+    stats.hit_rate_permille[index] = content_cache_->hitRatePermille(kind);
+  }
+  stats.bytes_held = static_cast<uint32_t>(content_cache_->bytesHeld());
+  stats.capacity = static_cast<uint32_t>(content_cache_->capacity());
+  stats.psram = content_arena_psram_;
+  return stats;
+}
+
+StorageManager::VerifyStats StorageManager::verifyStats() const {
+  VerifyStats stats = verify_stats_;
+  stats.sweep_active = sweep_active_;
+  stats.pending = verify_queue_count_;
+  return stats;
+}
+
+bool StorageManager::nextSweepPath(String* out_path) {
+  File manifest = LittleFS.open(kIntegrityManifestPath, "r");
+  if (!manifest || !manifest.seek(sweep_offset_)) {
+    return false;
+  }
+  char line[StoryManifest::kMaxLine] = {};
+  bool found = false;
+  while (!found) {
+    const size_t read_bytes = manifest.readBytes(line, sizeof(line) - 1U);
+    if (read_bytes == 0U) {
+      break;
+    }
+    line[read_bytes] = '\0';
+    char* newline = std::strchr(line, '\n');
+    size_t consumed = read_bytes;
+    if (newline != nullptr) {
+      *newline = '\0';
+      consumed = static_cast<size_t>(newline - line) + 1U;
+    }
+    sweep_offset_ += static_cast<uint32_t>(consumed);
+    if (!manifest.seek(sweep_offset_)) {
+      break;
+    }
+    uint8_t digest[StoryVerifyCache::kDigestBytes] = {};
+    const char* path = nullptr;
+    if (StoryManifest::parseLine(line, digest, &path)) {
+      *out_path = normalizeAbsolutePath(path);
+      found = true;
+    }
+  }
+  manifest.close();
+  return found;
+}
+
+bool StorageManager::expectedDigestFor(const char* path, uint8_t* out_digest) const {
+  const uint8_t* listed = (manifest_ != nullptr) ? manifest_->expected(path) : nullptr;
+  if (listed != nullptr) {
+    std::memcpy(out_digest, listed, StoryVerifyCache::kDigestBytes);
+    return true;
+  }
+  String sidecar = String(path) + ".sha256";
+  if (!pathExistsOnLittleFs(sidecar.c_str())) {
+    const String stem = path;
+    const int dot = stem.lastIndexOf('.');
+    if (dot <= stem.lastIndexOf('/')) {
+      return false;
+    }
+    sidecar = stem.substring(0, static_cast<unsigned int>(dot)) + ".sha256";
+    if (!pathExistsOnLittleFs(sidecar.c_str())) {
+      return false;
+    }
+  }
+  String text;
+  if (!readTextFromLittleFs(sidecar.c_str(), &text)) {
+    return false;
+  }
+  text.trim();
+  return text.length() >= StoryVerifyCache::kDigestBytes * 2U && storyParseSha256Hex(text.c_str(), out_digest);
+}
+
+bool StorageManager::startVerifyJob(const String& path) {
+  if (verify_job_ == nullptr) {
+    verify_job_ = new (std::nothrow) VerifyJob();
+    if (verify_job_ == nullptr) {
+      return false;
+    }
+  }
+  File file = LittleFS.open(path.c_str(), "r");
+  if (!file) {
+    ++verify_stats_.failed;
+    Serial.printf("[FS] verify missing file: %s\n", path.c_str());
+    return false;
+  }
+  VerifyJob& job = *verify_job_;
+  job.path = path;
+  job.stamp.size = static_cast<uint32_t>(file.size());
+  job.stamp.mtime = static_cast<uint32_t>(file.getLastWrite());
+  ++verify_stats_.files;
+  uint8_t digest[StoryVerifyCache::kDigestBytes] = {};
+  if (verify_cache_->lookup(path.c_str(), StoryDigestKind::kSha256, job.stamp, digest)) {
+    file.close();
+    ++verify_stats_.cached;
+    finishVerifyJob(digest);
+    return false;
+  }
+  job.file = file;
+  mbedtls_sha256_init(&job.sha);
+  if (mbedtls_sha256_starts_ret(&job.sha, 0) != 0) {
+    mbedtls_sha256_free(&job.sha);
+    job.file.close();
+    ++verify_stats_.failed;
+    return false;
+  }
+  job.active = true;
+  return true;
+}
+
+bool StorageManager::stepVerifyJob() {
+  VerifyJob& job = *verify_job_;
+  uint8_t buffer[512];
+  size_t budget = kVerifyChunkBytes;
+  while (budget > 0U) {
+    const size_t read_bytes = job.file.read(buffer, sizeof(buffer));
+    if (read_bytes == 0U) {
+      uint8_t digest[StoryVerifyCache::kDigestBytes] = {};
+      const bool ok = mbedtls_sha256_finish_ret(&job.sha, digest) == 0;
+      mbedtls_sha256_free(&job.sha);
+      job.file.close();
+      job.active = false;
+      ++verify_stats_.hashed;
+      if (!ok) {
+        ++verify_stats_.failed;
+        return false;
+      }
+      verify_cache_->store(job.path.c_str(), StoryDigestKind::kSha256, job.stamp, digest);
+      finishVerifyJob(digest);
+      return false;
+    }
+    if (mbedtls_sha256_update_ret(&job.sha, buffer, read_bytes) != 0) {
+      mbedtls_sha256_free(&job.sha);
+      job.file.close();
+      job.active = false;
+      ++verify_stats_.failed;
+      return false;
+    }
+    verify_stats_.hashed_bytes += static_cast<uint32_t>(read_bytes);
+    budget = (read_bytes < budget) ? budget - read_bytes : 0U;
+  }
+  return true;
+}
+
+void StorageManager::finishVerifyJob(const uint8_t* digest) {
+  uint8_t expected[StoryVerifyCache::kDigestBytes] = {};
+  const char* path = verify_job_->path.c_str();
+  if (!expectedDigestFor(path, expected)) {
+    ++verify_stats_.unlisted;
+    return;
+  }
+  if (std::memcmp(expected, digest, sizeof(expected)) != 0) {
+    ++verify_stats_.failed;
+    Serial.printf("[FS] verify checksum mismatch: %s\n", path);
+  }
+}
+
+void StorageManager::updateVerification(uint32_t now_ms) {
+  if (verify_cache_ == nullptr) {
+    return;
+  }
+  for (uint8_t files = 0U; files < kVerifyFilesPerUpdate; ++files) {
+    if (verify_job_ != nullptr && verify_job_->active) {
+      // Real hashing: one chunk, then give the loop back.
+      stepVerifyJob();
+      return;
+    }
+    String path;
+    if (verify_queue_count_ > 0U) {
+      path = verify_queue_[verify_queue_head_];
+      verify_queue_[verify_queue_head_].remove(0);
+      verify_queue_head_ = static_cast<uint8_t>((verify_queue_head_ + 1U) % kVerifyQueueSlots);
+      --verify_queue_count_;
+    } else if (sweep_active_) {
+      if (!nextSweepPath(&path)) {
+        sweep_active_ = false;
+        verify_stats_.last_sweep_ms = now_ms - sweep_started_ms_;
+        Serial.printf("[FS] story bundle verified files=%lu hashed=%lu cached=%lu failed=%lu unlisted=%lu ms=%lu\n",
+                      static_cast<unsigned long>(verify_stats_.files),
+                      static_cast<unsigned long>(verify_stats_.hashed),
+                      static_cast<unsigned long>(verify_stats_.cached),
+                      static_cast<unsigned long>(verify_stats_.failed),
+                      static_cast<unsigned long>(verify_stats_.unlisted),
+                      static_cast<unsigned long>(verify_stats_.last_sweep_ms));
+        flushVerifyCache();
+        return;
+      }
+    } else {
+      flushVerifyCache();
+      return;
+    }
+    if (startVerifyJob(path)) {
+      return;
+    }
+  }
+}
+
+void StorageManager::flushVerifyCache() const {
+  if (verify_cache_ == nullptr || !verify_cache_->dirty()) {
+    return;
+  }
+  const size_t size = verify_cache_->serializedSize();
+  uint8_t* image = static_cast<uint8_t*>(malloc(size));
+  if (image == nullptr) {
+    return;
+  }
+  verify_cache_->serialize(image, size);
+  const String tmp_path = String(kVerifyCachePath) + ".tmp";
+  // Written aside then renamed: a reset mid-write leaves the previous cache.
+  File out = LittleFS.open(tmp_path.c_str(), "w");
+  bool ok = static_cast<bool>(out);
+  if (ok) {
+    ok = out.write(image, size) == size;
+    out.close();
+  }
+  free(image);
+  if (ok) {
+    ok = LittleFS.rename(tmp_path.c_str(), kVerifyCachePath);
+  }
+  if (ok) {
+    verify_cache_->markClean();
+  } else {
+    Serial.printf("[FS] verify cache write failed: %s\n", kVerifyCachePath);
+  }
+}
+
+bool StorageManager::reloadIntegrityManifest() const {
+  if (manifest_ == nullptr) {
+    return false;
+  }
+  manifest_->clear();
+  File manifest = LittleFS.open(kIntegrityManifestPath, "r");
+  if (manifest) {
+    feedManifest(manifest, manifest_);
+    manifest.close();
+  }
+  return true;
+}
+
+bool StorageManager::probeSdFile(const String& path, StorySyncProbe* out) const {
+  *out = StorySyncProbe();
+#if ZACUS_HAS_SD_MMC
+  File file = SD_MMC.open(stripSdPrefix(path.c_str()).c_str(), "r");
+  if (!file || file.isDirectory()) {
+    return false;
+  }
+  out->present = true;
+  out->size = static_cast<uint32_t>(file.size());
+  // The SD bundle manifest, when planning loaded it, saves reading the file.
+  const uint8_t* listed = (sync_job_ != nullptr && sync_job_->sd_manifest != nullptr)
+                              ? sync_job_->sd_manifest->expected(path.c_str())
+                              : nullptr;
+  if (listed != nullptr) {
+    out->kind = StoryDigestKind::kSha256;
+    std::memcpy(out->digest, listed, StoryVerifyCache::kDigestBytes);
+  } else {
+    out->kind = StoryDigestKind::kFnv1a32;
+    putFnv1aDigest(fnv1aFile(file), out->digest);
+  }
+  file.close();
+  return true;
+#else
+  (void)path;
+  return false;
+#endif
+}
+
+bool StorageManager::probeLittleFsFile(const String& path, StoryDigestKind kind, StorySyncProbe* out) const {
+  *out = StorySyncProbe();
+  if (!pathExistsOnLittleFs(path.c_str())) {
+    return true;
+  }
+  File file = LittleFS.open(path.c_str(), "r");
+  if (!file) {
+    return false;
+  }
+  StoryFileStamp stamp;
+  stamp.size = static_cast<uint32_t>(file.size());
+  stamp.mtime = static_cast<uint32_t>(file.getLastWrite());
+  out->present = true;
+  out->size = stamp.size;
+  out->kind = kind;
+  const bool cacheable = ensureVerifyState();
+  if (cacheable && verify_cache_->lookup(path.c_str(), kind, stamp, out->digest)) {
+    file.close();
+    return true;
+  }
+  bool ok = true;
+  if (kind == StoryDigestKind::kSha256) {
+    ok = sha256File(file, out->digest);
+  } else {
+    putFnv1aDigest(fnv1aFile(file), out->digest);
+  }
+  file.close();
+  if (!ok) {
+    out->kind = StoryDigestKind::kNone;
+  } else if (cacheable) {
+    verify_cache_->store(path.c_str(), kind, stamp, out->digest);
+  }
+  return ok;
+}
+
+bool StorageManager::ensureSyncJob() {
+  if (sync_job_ != nullptr) {
+    return true;
+  }
+  sync_job_ = new (std::nothrow) SyncJob();
+  void* journal_mem = runtime::memory::CapsAllocator::allocPsram(sizeof(StorySyncJournal), "sync_journal");
+  void* manifest_mem = runtime::memory::CapsAllocator::allocPsram(sizeof(StoryManifest), "sync_manifest");
+  if (sync_job_ == nullptr || journal_mem == nullptr || manifest_mem == nullptr) {
+    runtime::memory::CapsAllocator::release(journal_mem);
+    runtime::memory::CapsAllocator::release(manifest_mem);
+    delete sync_job_;
+    sync_job_ = nullptr;
+    return false;
+  }
+  sync_job_->journal = new (journal_mem) StorySyncJournal();
+  sync_job_->sd_manifest = new (manifest_mem) StoryManifest();
+  return true;
+}
+
+void StorageManager::releaseSyncJob() {
+  if (sync_job_ == nullptr) {
+    return;
+  }
+  SyncJob& job = *sync_job_;
+  if (job.entry_open) {
+    job.src.close();
+    job.dst.close();
+    mbedtls_sha256_free(&job.sha);
+  }
+  if (job.dir) {
+    job.dir.close();
+  }
+  // Both are trivially destructible.
+  runtime::memory::CapsAllocator::release(job.journal);
+  runtime::memory::CapsAllocator::release(job.sd_manifest);
+  delete sync_job_;
+  sync_job_ = nullptr;
+}
+
+bool StorageManager::beginStorySync(uint32_t now_ms) {
+  if (sync_job_ != nullptr) {
+    return true;
+  }
+  if (!sd_ready_) {
+    sd_ready_ = mountSdCard();
+  }
+  if (!sd_ready_ || !ensureSyncJob()) {
+    return false;
+  }
+  sync_stats_ = SyncStats();
+  sync_stats_.active = true;
+  sync_job_->started_ms = now_ms;
+#if ZACUS_HAS_SD_MMC
+  File manifest = SD_MMC.open(kIntegrityManifestPath, "r");
+  if (manifest) {
+    feedManifest(manifest, sync_job_->sd_manifest);
+    manifest.close();
+  }
+#endif
+  Serial.printf("[FS] story sync planning (sd manifest entries=%u)\n",
+                static_cast<unsigned int>(sync_job_->sd_manifest->count()));
+  return true;
+}
+
+bool StorageManager::resumeStorySync(uint32_t now_ms) {
+  if (sync_job_ != nullptr) {
+    return true;
+  }
+  if (!pathExistsOnLittleFs(kSyncJournalPath)) {
+    return false;
+  }
+  if (!sd_ready_) {
+    sd_ready_ = mountSdCard();
+  }
+  if (!sd_ready_ || !ensureSyncJob()) {
+    Serial.println("[FS] story sync journal kept: SD unavailable");
+    return false;
+  }
+  File file = LittleFS.open(kSyncJournalPath, "r");
+  const size_t size = file ? static_cast<size_t>(file.size()) : 0U;
+  uint8_t* image = static_cast<uint8_t*>(malloc(size > 0U ? size : 1U));
+  const bool loaded = image != nullptr && file.read(image, size) == size &&
+                      sync_job_->journal->deserialize(image, size);
+  free(image);
+  if (file) {
+    file.close();
+  }
+  if (!loaded) {
+    Serial.printf("[FS] story sync journal discarded: %s\n", kSyncJournalPath);
+    LittleFS.remove(kSyncJournalPath);
+    releaseSyncJob();
+    return false;
+  }
+  const StorySyncJournal& journal = *sync_job_->journal;
+  sync_stats_ = SyncStats();
+  sync_stats_.active = true;
+  sync_stats_.resumed = true;
+  sync_stats_.planned = static_cast<uint16_t>(journal.count());
+  sync_job_->planning = false;
+  sync_job_->started_ms = now_ms;
+  Serial.printf("[FS] story sync resumed at %u/%u\n",
+                static_cast<unsigned int>(journal.completed()),
+                static_cast<unsigned int>(journal.count()));
+  return true;
+}
+
+bool StorageManager::updateStorySync(uint32_t now_ms) {
+  if (sync_job_ == nullptr) {
+    return false;
+  }
+  const uint32_t started_us = micros();
+  bool done = false;
+  if (sync_job_->planning) {
+    if (!planSyncStep()) {
+      sync_job_->planning = false;
+      if (!persistSyncJournal()) {
+        Serial.println("[FS] story sync journal not written; run is not resumable");
+      }
+    }
+  } else {
+    done = !copySyncStep();
+  }
+  const uint32_t blocked_us = micros() - started_us;
+  if (blocked_us > sync_stats_.blocked_max_us) {
+    sync_stats_.blocked_max_us = blocked_us;
+  }
+  sync_stats_.blocked_total_ms += (blocked_us + 500U) / 1000U;
+  if (!done) {
+    return false;
+  }
+  finishStorySync(now_ms);
+  return sync_stats_.copied > 0U;
+}
+
+StorageManager::SyncStats StorageManager::syncStats() const {
+  return sync_stats_;
+}
+
+bool StorageManager::planSyncStep() {
+#if ZACUS_HAS_SD_MMC
+  SyncJob& job = *sync_job_;
+  constexpr uint8_t kDirCount = static_cast<uint8_t>(sizeof(kStorySyncDirs) / sizeof(kStorySyncDirs[0]));
+  uint8_t files = 0U;
+  while (files < kSyncPlanFilesPerUpdate) {
+    String path;
+    if (!job.dir) {
+      if (job.dir_index > kDirCount) {
+        return false;
+      }
+      if (job.dir_index == kDirCount) {
+        // The bundle manifest goes last: LittleFS never lists digests for
+        // files that are not copied yet.
+        ++job.dir_index;
+        if (job.sd_manifest->count() == 0U) {
+          continue;
+        }
+        path = kIntegrityManifestPath;
+      } else {
+        const String dir_path = String("/story/") + kStorySyncDirs[job.dir_index++];
+        File dir = SD_MMC.open(dir_path.c_str());
+        if (dir && dir.isDirectory()) {
+          job.dir = dir;
+        }
+        continue;
+      }
+    } else {
+      File entry = job.dir.openNextFile();
+      if (!entry) {
+        job.dir.close();
+        job.dir = File();
+        continue;
+      }
+      const bool is_dir = entry.isDirectory();
+      path = entry.path();
+      entry.close();
+      if (is_dir || path.endsWith(kSyncTempSuffix)) {
+        continue;
+      }
+    }
+
+    ++files;
+    ++sync_stats_.planned;
+    StorySyncProbe source;
+    StorySyncProbe target;
+    if (!probeSdFile(path, &source) || !probeLittleFsFile(path, source.kind, &target)) {
+      ++sync_stats_.failed;
+      Serial.printf("[FS] story sync cannot compare: %s\n", path.c_str());
+      continue;
+    }
+    if (!storySyncNeedsCopy(source, target)) {
+      ++sync_stats_.skipped;
+      continue;
+    }
+    if (!job.journal->add(path.c_str(), source.size, source.kind, source.digest)) {
+      ++sync_stats_.failed;
+      Serial.printf("[FS] story sync plan full or path too long: %s\n", path.c_str());
+    }
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool StorageManager::persistSyncJournal() {
+  StorySyncJournal& journal = *sync_job_->journal;
+  if (journal.count() == 0U) {
+    return true;
+  }
+  const size_t size = journal.serializedSize();
+  uint8_t* image = static_cast<uint8_t*>(malloc(size));
+  if (image == nullptr) {
+    return false;
+  }
+  journal.serialize(image, size);
+  const String tmp_path = String(kSyncJournalPath) + ".tmp";
+  File out = LittleFS.open(tmp_path.c_str(), "w");
+  bool ok = static_cast<bool>(out);
+  if (ok) {
+    ok = out.write(image, size) == size;
+    out.close();
+  }
+  free(image);
+  if (ok) {
+    ok = LittleFS.rename(tmp_path.c_str(), kSyncJournalPath);
+  }
+  return ok;
+}
+
+bool StorageManager::copySyncStep() {
+#if ZACUS_HAS_SD_MMC
+  SyncJob& job = *sync_job_;
+  StorySyncJournal& journal = *job.journal;
+  size_t budget = kSyncChunkBytes;
+  while (!journal.finished()) {
+    const StorySyncJournal::Entry& entry = journal.entry(journal.completed());
+    if (!job.entry_open) {
+      const String tmp_path = String(entry.path) + kSyncTempSuffix;
+      job.src = SD_MMC.open(stripSdPrefix(entry.path).c_str(), "r");
+      if (!job.src || !ensureParentDirectoriesOnLittleFs(entry.path)) {
+        finishSyncEntry(false);
+        return !journal.finished();
+      }
+      job.dst = LittleFS.open(tmp_path.c_str(), "w");
+      if (!job.dst) {
+        job.src.close();
+        finishSyncEntry(false);
+        return !journal.finished();
+      }
+      job.entry_open = true;
+      job.entry_bytes = 0U;
+      job.fnv = 2166136261UL;
+      mbedtls_sha256_init(&job.sha);
+      mbedtls_sha256_starts_ret(&job.sha, 0);
+    }
+    if (budget == 0U) {
+      return true;
+    }
+    uint8_t buffer[512];
+    const size_t read_bytes = job.src.read(buffer, (budget < sizeof(buffer)) ? budget : sizeof(buffer));
+    if (read_bytes == 0U) {
+      finishSyncEntry(true);
+      return !journal.finished();
+    }
+    if (job.dst.write(buffer, read_bytes) != read_bytes) {
+      finishSyncEntry(false);
+      return !journal.finished();
+    }
+    if (entry.kind == static_cast<uint8_t>(StoryDigestKind::kSha256)) {
+      mbedtls_sha256_update_ret(&job.sha, buffer, read_bytes);
+    } else {
+      for (size_t index = 0U; index < read_bytes; ++index) {
+        job.fnv = fnv1aUpdate(job.fnv, buffer[index]);
+      }
+    }
+    job.entry_bytes += static_cast<uint32_t>(read_bytes);
+    sync_stats_.bytes_copied += static_cast<uint32_t>(read_bytes);
+    budget -= read_bytes;
+  }
+  return false;
+#else
+  return false;
+#endif
+}
+
+bool StorageManager::finishSyncEntry(bool ok) {
+  SyncJob& job = *sync_job_;
+  StorySyncJournal& journal = *job.journal;
+  const StorySyncJournal::Entry& entry = journal.entry(journal.completed());
+  const String tmp_path = String(entry.path) + kSyncTempSuffix;
+  uint8_t digest[StoryVerifyCache::kDigestBytes] = {};
+  if (job.entry_open) {
+    job.src.close();
+    job.dst.close();
+    if (mbedtls_sha256_finish_ret(&job.sha, digest) != 0) {
+      ok = false;
+    }
+    mbedtls_sha256_free(&job.sha);
+    job.entry_open = false;
+  }
+  if (entry.kind == static_cast<uint8_t>(StoryDigestKind::kFnv1a32)) {
+    std::memset(digest, 0, sizeof(digest));
+    putFnv1aDigest(job.fnv, digest);
+  }
+  // The copy must be what planning compared, not whatever the card holds now.
+  ok = ok && job.entry_bytes == entry.size && std::memcmp(digest, entry.digest, sizeof(digest)) == 0;
+  if (ok) {
+    ok = LittleFS.rename(tmp_path.c_str(), entry.path);
+  }
+  if (ok) {
+    ++sync_stats_.copied;
+    enqueueVerification(entry.path);
+  } else {
+    LittleFS.remove(tmp_path.c_str());
+    ++sync_stats_.failed;
+    Serial.printf("[FS] story sync copy failed: %s\n", entry.path);
+  }
+  job.entry_bytes = 0U;
+  journal.markCompleted();
+  File marker = LittleFS.open(kSyncJournalPath, "a");
+  if (marker) {
+    const uint8_t value = StorySyncJournal::completedMarker();
+    marker.write(&value, 1U);
+    marker.close();
+  }
+  return ok;
+}
+
+void StorageManager::finishStorySync(uint32_t now_ms) {
+  const uint32_t elapsed_ms = now_ms - sync_job_->started_ms;
+  sync_stats_.elapsed_ms = elapsed_ms;
+  sync_stats_.kbps = (elapsed_ms > 0U)
+                         ? static_cast<uint32_t>((static_cast<uint64_t>(sync_stats_.bytes_copied) * 1000ULL) /
+                                                 (static_cast<uint64_t>(elapsed_ms) * 1024ULL))
+                         : 0U;
+  sync_stats_.active = false;
+  releaseSyncJob();
+  LittleFS.remove(kSyncJournalPath);
+  if (sync_stats_.copied > 0U) {
+    invalidateStoryCaches();
+    reloadIntegrityManifest();
+  }
+  Serial.printf("[FS] story sync done planned=%u copied=%u skipped=%u failed=%u bytes=%lu kbps=%lu ms=%lu "
+                "blocked_max_us=%lu blocked_ms=%lu resumed=%u\n",
+                static_cast<unsigned int>(sync_stats_.planned),
+                static_cast<unsigned int>(sync_stats_.copied),
+                static_cast<unsigned int>(sync_stats_.skipped),
+                static_cast<unsigned int>(sync_stats_.failed),
+                static_cast<unsigned long>(sync_stats_.bytes_copied),
+                static_cast<unsigned long>(sync_stats_.kbps),
+                static_cast<unsigned long>(sync_stats_.elapsed_ms),
+                static_cast<unsigned long>(sync_stats_.blocked_max_us),
+                static_cast<unsigned long>(sync_stats_.blocked_total_ms),
+                sync_stats_.resumed ? 1U : 0U);
 }
@@ -8,6 +8,7 @@
 namespace {
 
 const char* kUnknownResetReason = "unknown";
+BootTimings g_boot_timings;
 
 }  // namespace
 
@@ -106,3 +107,57 @@ void bootPrintReport(const char* firmware_name, const char* firmware_version) {
                 static_cast<unsigned long>(heap.heap_internal_free),
                 static_cast<unsigned long>(heap.heap_internal_largest));
 }
+
+void bootMarkFirstFrame(uint32_t now_ms) {
+  if (g_boot_timings.first_frame_ms == 0U) {
+    g_boot_timings.first_frame_ms = (now_ms != 0U) ? now_ms : 1U;
+  }
+}
+
+void bootMarkInteractive(uint32_t now_ms) {
+  if (g_boot_timings.interactive_ms == 0U) {
+    g_boot_timings.interactive_ms = (now_ms != 0U) ? now_ms : 1U;
+  }
+}
+
+void bootMarkDeferredDone(uint32_t now_ms) {
+  if (g_boot_timings.deferred_done_ms == 0U) {
+    g_boot_timings.deferred_done_ms = (now_ms != 0U) ? now_ms : 1U;
+  }
+}
+
+void bootNoteSnapshotUsed(bool used) {
+  g_boot_timings.snapshot_used = used;
+}
+
+void bootNoteJob(const char* name, uint32_t started_ms, uint32_t duration_us, bool ok) {
+  if (g_boot_timings.job_count >= BootTimings::kMaxJobs) {
+    return;
+  }
+  BootTimings::Job& job = g_boot_timings.jobs[g_boot_timings.job_count++];
+  job.name = name;
+  job.started_ms = started_ms;
+  job.duration_us = duration_us;
+  job.ok = ok;
+}
+
+const BootTimings& bootTimings() {
+  return g_boot_timings;
+}
+
+void bootPrintTimings() {
+  Serial.printf("BOOT_TIMING ttff_ms=%lu tti_ms=%lu deferred_done_ms=%lu snapshot=%u jobs=%u\n",
+                static_cast<unsigned long>(g_boot_timings.first_frame_ms),
+                static_cast<unsigned long>(g_boot_timings.interactive_ms),
+                static_cast<unsigned long>(g_boot_timings.deferred_done_ms),
+                g_boot_timings.snapshot_used ? 1U : 0U,
+                static_cast<unsigned int>(g_boot_timings.job_count));
+  for (uint8_t index = 0U; index < g_boot_timings.job_count; ++index) {
+    const BootTimings::Job& job = g_boot_timings.jobs[index];
+    Serial.printf("BOOT_JOB name=%s at_ms=%lu us=%lu ok=%u\n",
+                  (job.name != nullptr) ? job.name : "n/a",
+                  static_cast<unsigned long>(job.started_ms),
+                  static_cast<unsigned long>(job.duration_us),
+                  job.ok ? 1U : 0U);
+  }
+}
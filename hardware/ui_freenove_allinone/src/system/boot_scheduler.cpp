@@ -0,0 +1,71 @@
+#include "system/boot_scheduler.h"
+
+#include "system/boot_report.h"
+
+bool BootScheduler::add(const char* name, BootPhase phase, uint8_t priority, JobFn fn) {
+  if (fn == nullptr || count_ >= kMaxJobs) {
+    return false;
+  }
+  Job& job = jobs_[count_++];
+  job.name = name;
+  job.fn = fn;
+  job.phase = phase;
+  job.priority = priority;
+  job.done = false;
+  ++pending_;
+  return true;
+}
+
+void BootScheduler::markFirstFrame(uint32_t now_ms) {
+  first_frame_ = true;
+  bootMarkFirstFrame(now_ms);
+}
+
+void BootScheduler::markInteractive(uint32_t now_ms) {
+  first_frame_ = true;
+  interactive_ = true;
+  bootMarkInteractive(now_ms);
+}
+
+bool BootScheduler::update(uint32_t now_ms) {
+  if (pending_ == 0U || !first_frame_) {
+    return false;
+  }
+  Job* next = nullptr;
+  for (uint8_t index = 0U; index < count_; ++index) {
+    Job& job = jobs_[index];
+    if (job.done || (job.phase == BootPhase::kAfterInteractive && !interactive_)) {
+      continue;
+    }
+    if (next == nullptr || job.phase < next->phase ||
+        (job.phase == next->phase && job.priority < next->priority)) {
+      next = &job;
+    }
+  }
+  if (next == nullptr) {
+    return false;
+  }
+  const uint32_t started_us = micros();
+  const bool ok = next->fn(now_ms);
+  const uint32_t duration_us = micros() - started_us;
+  next->done = true;
+  --pending_;
+  bootNoteJob(next->name, now_ms, duration_us, ok);
+  Serial.printf("[BOOT] job %s ok=%u us=%lu pending=%u\n",
+                (next->name != nullptr) ? next->name : "n/a",
+                ok ? 1U : 0U,
+                static_cast<unsigned long>(duration_us),
+                static_cast<unsigned int>(pending_));
+  if (pending_ == 0U) {
+    bootMarkDeferredDone(millis());
+  }
+  return true;
+}
+
+bool BootScheduler::done() const {
+  return pending_ == 0U;
+}
+
+uint8_t BootScheduler::pending() const {
+  return pending_;
+}
@@ -0,0 +1,146 @@
+#include "system/boot_snapshot.h"
+
+#include <cstring>
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <esp_idf_version.h>
+#include <esp_system.h>
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include <esp_app_desc.h>
+#else
+#include <esp_ota_ops.h>
+#endif
+#endif
+
+namespace {
+
+constexpr uint32_t kSnapshotMagic = 0x3153425AUL;  // "ZBS1"
+constexpr size_t kHeaderBytes = 16U;               // magic, build, size, fnv
+constexpr const char* kTempSuffix = ".part";
+
+uint32_t fnv1a(uint32_t hash, const void* data, size_t len) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  for (size_t index = 0U; index < len; ++index) {
+    hash ^= bytes[index];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+// Keyed on the running app image: any reflash, even one that leaves this
+// file untouched, reads as a different build.
+uint32_t buildTag() {
+#if defined(ARDUINO_ARCH_ESP32)
+#if ESP_IDF_VERSION_MAJOR >= 5
+  const esp_app_desc_t* app = esp_app_get_description();
+#else
+  const esp_app_desc_t* app = esp_ota_get_app_description();
+#endif
+  return fnv1a(2166136261UL, app->app_elf_sha256, sizeof(app->app_elf_sha256));
+#else
+  static const char kBuild[] = __DATE__ " " __TIME__;
+  return fnv1a(2166136261UL, kBuild, sizeof(kBuild) - 1U);
+#endif
+}
+
+void putU32(uint8_t* out, uint32_t value) {
+  out[0] = static_cast<uint8_t>(value);
+  out[1] = static_cast<uint8_t>(value >> 8U);
+  out[2] = static_cast<uint8_t>(value >> 16U);
+  out[3] = static_cast<uint8_t>(value >> 24U);
+}
+
+uint32_t getU32(const uint8_t* in) {
+  return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8U) |
+         (static_cast<uint32_t>(in[2]) << 16U) | (static_cast<uint32_t>(in[3]) << 24U);
+}
+
+}  // namespace
+
+uint32_t bootConfigFingerprint(const StorageManager& storage, const char* const* paths, size_t count) {
+  uint32_t hash = 2166136261UL;
+  String origin;
+  for (size_t index = 0U; index < count; ++index) {
+    const char* path = paths[index];
+    if (path == nullptr) {
+      continue;
+    }
+    hash = fnv1a(hash, path, std::strlen(path) + 1U);
+    const uint32_t content = storage.loadedChecksum(path, &origin);
+    hash = fnv1a(hash, origin.c_str(), origin.length() + 1U);
+    hash = fnv1a(hash, &content, sizeof(content));
+  }
+  return hash;
+}
+
+bool bootSnapshotLoad(fs::FS& fs, const char* path, BootSnapshot* out) {
+  if (path == nullptr || out == nullptr || !fs.exists(path)) {
+    return false;
+  }
+  File file = fs.open(path, "r");
+  if (!file) {
+    return false;
+  }
+  uint8_t header[kHeaderBytes] = {0};
+  BootSnapshot snapshot;
+  const bool read_ok = file.read(header, sizeof(header)) == sizeof(header) &&
+                       file.read(reinterpret_cast<uint8_t*>(&snapshot), sizeof(snapshot)) == sizeof(snapshot);
+  file.close();
+  if (!read_ok || getU32(header) != kSnapshotMagic || getU32(header + 4U) != buildTag() ||
+      getU32(header + 8U) != sizeof(BootSnapshot) ||
+      getU32(header + 12U) != fnv1a(2166136261UL, &snapshot, sizeof(snapshot))) {
+    return false;
+  }
+  if (snapshot.peer_count > BootSnapshot::kMaxPeers) {
+    return false;
+  }
+  *out = snapshot;
+  return true;
+}
+
+bool bootSnapshotSave(fs::FS& fs, const char* path, const BootSnapshot& snapshot) {
+  if (path == nullptr || path[0] != '/') {
+    return false;
+  }
+  uint8_t header[kHeaderBytes] = {0};
+  putU32(header, kSnapshotMagic);
+  putU32(header + 4U, buildTag());
+  putU32(header + 8U, sizeof(BootSnapshot));
+  putU32(header + 12U, fnv1a(2166136261UL, &snapshot, sizeof(snapshot)));
+  const String temp_path = String(path) + kTempSuffix;
+  File file = fs.open(temp_path.c_str(), "w");
+  if (!file) {
+    return false;
+  }
+  const bool write_ok = file.write(header, sizeof(header)) == sizeof(header) &&
+                        file.write(reinterpret_cast<const uint8_t*>(&snapshot), sizeof(snapshot)) == sizeof(snapshot);
+  file.close();
+  if (!write_ok) {
+    fs.remove(temp_path.c_str());
+    return false;
+  }
+  // rename replaces the previous snapshot atomically; on failure it stays.
+  if (!fs.rename(temp_path.c_str(), path)) {
+    fs.remove(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool bootResetAllowsSnapshot(uint32_t reset_reason_code) {
+#if defined(ARDUINO_ARCH_ESP32)
+  switch (static_cast<esp_reset_reason_t>(reset_reason_code)) {
+    case ESP_RST_PANIC:
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+    case ESP_RST_BROWNOUT:
+      return false;
+    default:
+      return true;
+  }
+#else
+  (void)reset_reason_code;
+  return true;
+#endif
+}
@@ -0,0 +1,123 @@
+// ima_adpcm.cpp - IMA/DVI ADPCM block codec (WAV format 0x11, mono).
+#include "system/media/ima_adpcm.h"
+
+namespace media {
+
+namespace {
+
+constexpr uint8_t kMaxStepIndex = 88U;
+
+constexpr int8_t kIndexTable[16] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+
+constexpr int16_t kStepTable[kMaxStepIndex + 1U] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+    31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+    544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+    9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+int16_t clampSample(int32_t value) {
+  if (value > 32767) {
+    return 32767;
+  }
+  if (value < -32768) {
+    return -32768;
+  }
+  return static_cast<int16_t>(value);
+}
+
+uint8_t nextIndex(uint8_t index, uint8_t code) {
+  const int32_t next = static_cast<int32_t>(index) + kIndexTable[code & 0x0FU];
+  if (next < 0) {
+    return 0U;
+  }
+  return (next > kMaxStepIndex) ? kMaxStepIndex : static_cast<uint8_t>(next);
+}
+
+}  // namespace
+
+uint8_t ImaAdpcm::encodeSample(int16_t sample, ImaAdpcmState* state) {
+  int32_t step = kStepTable[state->step_index];
+  int32_t diff = static_cast<int32_t>(sample) - state->predictor;
+  uint8_t code = 0U;
+  if (diff < 0) {
+    code = 8U;
+    diff = -diff;
+  }
+  // Same successive approximation as the decoder, so both sides track the
+  // identical predictor.
+  int32_t delta = step >> 3;
+  if (diff >= step) {
+    code |= 4U;
+    diff -= step;
+    delta += step;
+  }
+  step >>= 1;
+  if (diff >= step) {
+    code |= 2U;
+    diff -= step;
+    delta += step;
+  }
+  step >>= 1;
+  if (diff >= step) {
+    code |= 1U;
+    delta += step;
+  }
+  state->predictor = clampSample((code & 8U) ? state->predictor - delta : state->predictor + delta);
+  state->step_index = nextIndex(state->step_index, code);
+  return code;
+}
+
+int16_t ImaAdpcm::decodeSample(uint8_t code, ImaAdpcmState* state) {
+  const int32_t step = kStepTable[state->step_index];
+  int32_t delta = step >> 3;
+  if (code & 4U) {
+    delta += step;
+  }
+  if (code & 2U) {
+    delta += step >> 1;
+  }
+  if (code & 1U) {
+    delta += step >> 2;
+  }
+  state->predictor = clampSample((code & 8U) ? state->predictor - delta : state->predictor + delta);
+  state->step_index = nextIndex(state->step_index, code);
+  return state->predictor;
+}
+
+void ImaAdpcm::encodeBlock(const int16_t* pcm, uint16_t block_bytes, ImaAdpcmState* state, uint8_t* out) {
+  if (state->step_index > kMaxStepIndex) {
+    state->step_index = kMaxStepIndex;
+  }
+  state->predictor = pcm[0];
+  out[0] = static_cast<uint8_t>(static_cast<uint16_t>(pcm[0]) & 0xFFU);
+  out[1] = static_cast<uint8_t>(static_cast<uint16_t>(pcm[0]) >> 8);
+  out[2] = state->step_index;
+  out[3] = 0U;
+  const uint16_t samples = samplesPerBlock(block_bytes);
+  uint8_t* codes = out + kHeaderBytes;
+  for (uint16_t index = 1U; index < samples; index += 2U) {
+    const uint8_t low = encodeSample(pcm[index], state);
+    const uint8_t high = encodeSample(pcm[index + 1U], state);
+    *codes++ = static_cast<uint8_t>(low | (high << 4));
+  }
+}
+
+bool ImaAdpcm::decodeBlock(const uint8_t* block, uint16_t block_bytes, int16_t* out) {
+  if (block_bytes <= kHeaderBytes || block[2] > kMaxStepIndex) {
+    return false;
+  }
+  ImaAdpcmState state;
+  state.predictor = static_cast<int16_t>(static_cast<uint16_t>(block[0]) | (static_cast<uint16_t>(block[1]) << 8));
+  state.step_index = block[2];
+  out[0] = state.predictor;
+  int16_t* samples = out + 1;
+  for (uint16_t index = kHeaderBytes; index < block_bytes; ++index) {
+    *samples++ = decodeSample(block[index] & 0x0FU, &state);
+    *samples++ = decodeSample(block[index] >> 4, &state);
+  }
+  return true;
+}
+
+}  // namespace media
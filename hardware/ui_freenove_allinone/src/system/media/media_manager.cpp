@@ -1,4 +1,4 @@
-// media_manager.cpp - media catalog + playback + simulated recorder hooks.
+// media_manager.cpp - media catalog + playback + mic recorder.
 #include "media_manager.h"
 
 #include <ArduinoJson.h>
@@ -7,12 +7,79 @@
 #include <algorithm>
 #include <cctype>
 #include <cstring>
+#include <new>
 #include <vector>
 
+#if defined(ARDUINO_ARCH_ESP32)
+#include <driver/i2s.h>
+#endif
+
 #include "audio_manager.h"
+#include "runtime/memory/caps_allocator.h"
+#include "system/media/pcm_ring_buffer.h"
+#include "system/media/wav_stream_writer.h"
 
 namespace {
 
+constexpr uint32_t kRecordRingSamples = 32768U;  // ~2 s at 16 kHz of slack for slow flash writes
+constexpr uint16_t kCaptureFrames = 256U;
+constexpr uint16_t kWriterChunkSamples = 1024U;
+constexpr uint16_t kAdpcmBlockBytes = 256U;
+constexpr uint32_t kHeaderPatchSeconds = 2U;
+constexpr uint32_t kReserveMarginBytes = 8192U;
+
+uint32_t recorderClockUs() {
+  return micros();
+}
+
+// LittleFS file behind media::WavStreamWriter. LittleFS cannot preallocate,
+// so reserve() checks that the whole take fits before the first byte.
+class FileWavSink : public media::WavSink {
+ public:
+  bool open(const char* path) {
+    file_ = LittleFS.open(path, "w");
+    end_ = 0U;
+    return static_cast<bool>(file_);
+  }
+
+  void close() {
+    if (file_) {
+      file_.close();
+    }
+  }
+
+  bool reserve(uint32_t bytes) override {
+    const size_t total = LittleFS.totalBytes();
+    const size_t used = LittleFS.usedBytes();
+    return total > used && (total - used) >= static_cast<size_t>(bytes) + kReserveMarginBytes;
+  }
+
+  bool append(const uint8_t* data, size_t bytes) override {
+    if (file_.write(data, bytes) != bytes) {
+      return false;
+    }
+    end_ += static_cast<uint32_t>(bytes);
+    return true;
+  }
+
+  bool writeAt(uint32_t offset, const uint8_t* data, size_t bytes) override {
+    if (!file_.seek(offset)) {
+      return false;
+    }
+    const bool written = file_.write(data, bytes) == bytes;
+    return file_.seek(end_) && written;
+  }
+
+  bool flush() override {
+    file_.flush();
+    return true;
+  }
+
+ private:
+  File file_;
+  uint32_t end_ = 0U;
+};
+
 void copyText(char* out, size_t out_size, const char* text) {
   if (out == nullptr || out_size == 0U) {
     return;
@@ -96,6 +163,20 @@ int compareNaturalPath(const String& lhs, const String& rhs) {
 
 }  // namespace
 
+struct MediaManager::Recorder {
+  media::PcmRingBuffer ring;
+  media::WavStreamWriter writer;
+  FileWavSink sink;
+  int16_t* ring_storage = nullptr;
+  int port = -1;
+  uint16_t gain_q8 = 256U;
+  // Capture task buffers.
+  int32_t raw[kCaptureFrames] = {};
+  int16_t pcm[kCaptureFrames] = {};
+  // Writer task buffer.
+  int16_t drain[kWriterChunkSamples] = {};
+};
+
 bool MediaManager::begin(const Config& config) {
   config_ = config;
   copyText(config_.music_dir, sizeof(config_.music_dir), normalizeDir(config.music_dir).c_str());
@@ -108,6 +189,10 @@ bool MediaManager::begin(const Config& config) {
     config_.record_max_seconds = 1800U;
   }
 
+  if (config_.record_gain_q8 == 0U) {
+    config_.record_gain_q8 = 256U;
+  }
+
   snapshot_ = Snapshot();
   snapshot_.ready = true;
   snapshot_.record_limit_seconds = config_.record_max_seconds;
@@ -120,6 +205,15 @@ bool MediaManager::begin(const Config& config) {
   return true;
 }
 
+void MediaManager::attachMic(int i2s_port, uint32_t sample_rate, MicClaimFn on_claim) {
+  if (mic_claimed_) {
+    return;
+  }
+  mic_port_ = i2s_port;
+  mic_sample_rate_ = (sample_rate > 0U) ? sample_rate : 16000U;
+  on_mic_claim_ = on_claim;
+}
+
 void MediaManager::update(uint32_t now_ms, AudioManager* audio) {
   if (audio != nullptr && snapshot_.playing && !audio->isPlaying()) {
     snapshot_.playing = false;
@@ -129,10 +223,18 @@ void MediaManager::update(uint32_t now_ms, AudioManager* audio) {
     const uint32_t elapsed_ms = now_ms - snapshot_.record_started_ms;
     const uint16_t elapsed_seconds = static_cast<uint16_t>(elapsed_ms / 1000U);
     snapshot_.record_elapsed_seconds = elapsed_seconds;
-    if (snapshot_.record_limit_seconds > 0U && elapsed_seconds >= snapshot_.record_limit_seconds) {
+    if (mic_claimed_) {
+      refreshRecordStats();
+    }
+    if (writer_failed_.load()) {
+      stopRecording();
+    } else if (snapshot_.record_limit_seconds > 0U && elapsed_seconds >= snapshot_.record_limit_seconds) {
       stopRecording();
     }
   }
+  if (snapshot_.record_finalizing) {
+    pollMicFinalize();
+  }
 }
 
 void MediaManager::noteStepChange() {
@@ -240,6 +342,10 @@ bool MediaManager::startRecording(uint16_t seconds, const char* filename_hint) {
     setLastError("recorder_already_running");
     return false;
   }
+  if (snapshot_.record_finalizing) {
+    setLastError("recorder_busy");
+    return false;
+  }
   if (!ensureDir(config_.record_dir)) {
     setLastError("recorder_dir_missing");
     return false;
@@ -247,11 +353,24 @@ bool MediaManager::startRecording(uint16_t seconds, const char* filename_hint) {
 
   const String filename = sanitizeFilename(filename_hint, "record", ".wav");
   const String path = String(config_.record_dir) + "/" + filename;
-  if (!writeEmptyWav(path.c_str())) {
+  const bool from_mic = (mic_port_ >= 0);
+  if (from_mic) {
+    if (!startMicRecording(path.c_str(), seconds)) {
+      return false;
+    }
+  } else if (!writeEmptyWav(path.c_str())) {
     setLastError("recorder_create_failed");
     return false;
   }
 
+  snapshot_.record_simulated = !from_mic;
+  snapshot_.record_adpcm = from_mic && config_.record_adpcm;
+  snapshot_.record_samples = 0U;
+  snapshot_.record_bytes = 0U;
+  snapshot_.record_dropped_samples = 0U;
+  snapshot_.record_write_avg_us = 0U;
+  snapshot_.record_write_max_us = 0U;
+  snapshot_.record_ring_peak_pct = 0U;
   snapshot_.recording = true;
   snapshot_.record_limit_seconds = seconds;
   snapshot_.record_started_ms = millis();
@@ -268,6 +387,14 @@ bool MediaManager::stopRecording() {
   const uint32_t elapsed_ms = millis() - snapshot_.record_started_ms;
   snapshot_.record_elapsed_seconds = static_cast<uint16_t>(elapsed_ms / 1000U);
   snapshot_.recording = false;
+  if (mic_claimed_) {
+    capture_on_.store(false);
+    snapshot_.record_finalizing = true;
+    finalize_started_ms_ = millis();
+    finalize_slow_logged_ = false;
+    clearLastError();
+    return true;
+  }
   clearLastError();
   return true;
 }
@@ -360,30 +487,288 @@ bool MediaManager::writeEmptyWav(const char* path) const {
   if (!file) {
     return false;
   }
-
-  const uint32_t sample_rate = 16000UL;
-  const uint16_t channels = 1U;
-  const uint16_t bits_per_sample = 16U;
-  const uint32_t data_size = 0UL;
-  const uint32_t byte_rate = sample_rate * channels * (bits_per_sample / 8U);
-  const uint16_t block_align = channels * (bits_per_sample / 8U);
-  const uint32_t chunk_size = 36UL + data_size;
-
-  file.write(reinterpret_cast<const uint8_t*>("RIFF"), 4U);
-  file.write(reinterpret_cast<const uint8_t*>(&chunk_size), sizeof(chunk_size));
-  file.write(reinterpret_cast<const uint8_t*>("WAVE"), 4U);
-  file.write(reinterpret_cast<const uint8_t*>("fmt "), 4U);
-  const uint32_t fmt_size = 16UL;
-  const uint16_t audio_format = 1U;
-  file.write(reinterpret_cast<const uint8_t*>(&fmt_size), sizeof(fmt_size));
-  file.write(reinterpret_cast<const uint8_t*>(&audio_format), sizeof(audio_format));
-  file.write(reinterpret_cast<const uint8_t*>(&channels), sizeof(channels));
-  file.write(reinterpret_cast<const uint8_t*>(&sample_rate), sizeof(sample_rate));
-  file.write(reinterpret_cast<const uint8_t*>(&byte_rate), sizeof(byte_rate));
-  file.write(reinterpret_cast<const uint8_t*>(&block_align), sizeof(block_align));
-  file.write(reinterpret_cast<const uint8_t*>(&bits_per_sample), sizeof(bits_per_sample));
-  file.write(reinterpret_cast<const uint8_t*>("data"), 4U);
-  file.write(reinterpret_cast<const uint8_t*>(&data_size), sizeof(data_size));
+  media::WavStreamConfig wav;
+  wav.sample_rate = mic_sample_rate_;
+  wav.encoding = media::WavEncoding::kPcm16;
+  uint8_t header[media::WavStreamWriter::kMaxHeaderBytes];
+  const size_t header_bytes = media::WavStreamWriter::buildHeader(wav, 0U, 0U, header);
+  const bool ok = file.write(header, header_bytes) == header_bytes;
   file.close();
+  return ok;
+}
+
+bool MediaManager::startMicRecording(const char* path, uint16_t seconds) {
+#if !defined(ARDUINO_ARCH_ESP32)
+  (void)path;
+  (void)seconds;
+  setLastError("recorder_mic_unavailable");
+  return false;
+#else
+  if (!ensureRecorder()) {
+    setLastError("recorder_alloc_failed");
+    return false;
+  }
+  if (writer_state_.load() != static_cast<uint8_t>(WriterState::kIdle)) {
+    setLastError("recorder_busy");
+    return false;
+  }
+  Recorder& rec = *recorder_;
+  if (!rec.sink.open(path)) {
+    setLastError("recorder_create_failed");
+    return false;
+  }
+  media::WavStreamConfig wav;
+  wav.sample_rate = mic_sample_rate_;
+  wav.encoding = config_.record_adpcm ? media::WavEncoding::kImaAdpcm : media::WavEncoding::kPcm16;
+  wav.adpcm_block_bytes = kAdpcmBlockBytes;
+  wav.max_samples = static_cast<uint32_t>(seconds) * mic_sample_rate_;
+  wav.patch_every_bytes = media::WavStreamWriter::dataBytesFor(wav, mic_sample_rate_ * kHeaderPatchSeconds);
+  wav.clock_us = &recorderClockUs;
+  if (!rec.writer.begin(&rec.sink, wav)) {
+    const bool no_space = rec.writer.stats().sink_writes == 0U;
+    rec.sink.close();
+    LittleFS.remove(path);
+    setLastError(no_space ? "recorder_no_space" : "recorder_write_failed");
+    return false;
+  }
+  rec.ring.reset();
+  rec.port = mic_port_;
+  rec.gain_q8 = config_.record_gain_q8;
+  writer_failed_.store(false);
+  live_samples_.store(0U);
+  live_bytes_.store(0U);
+  live_write_avg_us_.store(0U);
+  live_write_max_us_.store(0U);
+
+  // The mic owner stops its own i2s_read() before the capture task starts.
+  mic_claimed_ = true;
+  if (on_mic_claim_ != nullptr) {
+    on_mic_claim_(true);
+  }
+  writer_state_.store(static_cast<uint8_t>(WriterState::kRunning));
+  capture_on_.store(true);
+  Serial.printf("[MEDIA] record start file=%s codec=%s rate=%lu limit=%us\n",
+                path,
+                config_.record_adpcm ? "ima_adpcm" : "pcm16",
+                static_cast<unsigned long>(mic_sample_rate_),
+                static_cast<unsigned int>(seconds));
+  return true;
+#endif
+}
+
+void MediaManager::pollMicFinalize() {
+#if !defined(ARDUINO_ARCH_ESP32)
+  mic_claimed_ = false;
+  snapshot_.record_finalizing = false;
+  clearLastError();
+#else
+  // millis() rather than update()'s now_ms: stopRecording() stamps the
+  // start with millis() and may run later in the same loop pass.
+  const uint32_t finalize_ms = millis() - finalize_started_ms_;
+  uint8_t state = writer_state_.load();
+  if (state == static_cast<uint8_t>(WriterState::kRunning)) {
+    // capture_busy_ is raised before capture_on_ is read, so once it drops
+    // the capture task has pushed its last block. The writer then drains the
+    // ring, pads the last block and patches the final header.
+    if (capture_busy_.load()) {
+      return;
+    }
+    uint8_t expected = static_cast<uint8_t>(WriterState::kRunning);
+    writer_state_.compare_exchange_strong(expected, static_cast<uint8_t>(WriterState::kDraining));
+    state = writer_state_.load();
+  }
+  if (state != static_cast<uint8_t>(WriterState::kFinished)) {
+    if (!finalize_slow_logged_ && finalize_ms >= kFinalizeSlowMs) {
+      // Keep the mic: releasing it now would let the owner read the I2S
+      // port while the writer still holds the file.
+      finalize_slow_logged_ = true;
+      Serial.printf("[MEDIA] record finalize slow file=%s\n", snapshot_.record_file);
+      setLastError("recorder_finalize_slow");
+    }
+    return;
+  }
+  refreshRecordStats();
+  const media::WavStreamStats& stats = recorder_->writer.stats();
+  writer_state_.store(static_cast<uint8_t>(WriterState::kIdle));
+  snapshot_.record_finalizing = false;
+  mic_claimed_ = false;
+  if (on_mic_claim_ != nullptr) {
+    on_mic_claim_(false);
+  }
+  const bool ok = !writer_failed_.load();
+  Serial.printf(
+      "[MEDIA] record done file=%s ok=%u samples=%lu bytes=%lu dropped=%lu truncated=%lu ring_peak=%u%% "
+      "writes=%lu patches=%lu write_avg_us=%lu write_max_us=%lu finalize_ms=%lu\n",
+      snapshot_.record_file,
+      ok ? 1U : 0U,
+      static_cast<unsigned long>(stats.samples),
+      static_cast<unsigned long>(stats.data_bytes),
+      static_cast<unsigned long>(snapshot_.record_dropped_samples),
+      static_cast<unsigned long>(stats.truncated_samples),
+      static_cast<unsigned int>(snapshot_.record_ring_peak_pct),
+      static_cast<unsigned long>(stats.sink_writes),
+      static_cast<unsigned long>(stats.header_patches),
+      static_cast<unsigned long>(snapshot_.record_write_avg_us),
+      static_cast<unsigned long>(snapshot_.record_write_max_us),
+      static_cast<unsigned long>(finalize_ms));
+  if (!ok) {
+    setLastError("recorder_write_failed");
+    return;
+  }
+  clearLastError();
+#endif
+}
+
+void MediaManager::refreshRecordStats() {
+  if (recorder_ == nullptr) {
+    return;
+  }
+  snapshot_.record_samples = live_samples_.load();
+  snapshot_.record_bytes = live_bytes_.load();
+  snapshot_.record_write_avg_us = live_write_avg_us_.load();
+  snapshot_.record_write_max_us = live_write_max_us_.load();
+  snapshot_.record_dropped_samples = recorder_->ring.dropped();
+  snapshot_.record_ring_peak_pct =
+      static_cast<uint16_t>((static_cast<uint64_t>(recorder_->ring.peakFill()) * 100U) / recorder_->ring.capacity());
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+bool MediaManager::ensureRecorder() {
+  if (recorder_ != nullptr) {
+    return true;
+  }
+  void* memory = runtime::memory::CapsAllocator::allocPsram(sizeof(Recorder), "media.recorder");
+  if (memory == nullptr) {
+    return false;
+  }
+  Recorder* rec = new (memory) Recorder();
+  rec->ring_storage = static_cast<int16_t*>(
+      runtime::memory::CapsAllocator::allocPsram(kRecordRingSamples * sizeof(int16_t), "media.record_ring"));
+  if (rec->ring_storage == nullptr || !rec->ring.begin(rec->ring_storage, kRecordRingSamples)) {
+    runtime::memory::CapsAllocator::release(rec->ring_storage);
+    rec->~Recorder();
+    runtime::memory::CapsAllocator::release(memory);
+    return false;
+  }
+  recorder_ = rec;
+  if (xTaskCreatePinnedToCore(captureTaskEntry,
+                              "rec_mic",
+                              kCaptureStackWords,
+                              this,
+                              kCapturePriority,
+                              &capture_task_,
+                              kRecorderCore) != pdPASS ||
+      xTaskCreatePinnedToCore(writerTaskEntry,
+                              "rec_write",
+                              kWriterStackWords,
+                              this,
+                              kWriterPriority,
+                              &writer_task_,
+                              kRecorderCore) != pdPASS) {
+    if (capture_task_ != nullptr) {
+      vTaskDelete(capture_task_);
+      capture_task_ = nullptr;
+    }
+    writer_task_ = nullptr;
+    recorder_ = nullptr;
+    runtime::memory::CapsAllocator::release(rec->ring_storage);
+    rec->~Recorder();
+    runtime::memory::CapsAllocator::release(memory);
+    Serial.println("[MEDIA] recorder task create failed");
+    return false;
+  }
   return true;
 }
+
+void MediaManager::captureTaskEntry(void* arg) {
+  auto* self = static_cast<MediaManager*>(arg);
+  if (self == nullptr) {
+    vTaskDelete(nullptr);
+    return;
+  }
+  self->captureTaskMain();
+}
+
+void MediaManager::captureTaskMain() {
+  Recorder& rec = *recorder_;
+  while (true) {
+    capture_busy_.store(true);
+    if (!capture_on_.load()) {
+      capture_busy_.store(false);
+      vTaskDelay(pdMS_TO_TICKS(kIdleDelayMs));
+      continue;
+    }
+    size_t bytes_read = 0U;
+    const esp_err_t err =
+        i2s_read(static_cast<i2s_port_t>(rec.port), rec.raw, sizeof(rec.raw), &bytes_read, pdMS_TO_TICKS(50));
+    if (err != ESP_OK || bytes_read == 0U) {
+      capture_busy_.store(false);
+      vTaskDelay(pdMS_TO_TICKS(1));
+      continue;
+    }
+    const size_t frames = bytes_read / sizeof(int32_t);
+    for (size_t index = 0U; index < frames; ++index) {
+      // INMP441: PCM24 left-aligned in 32-bit slots, same as HardwareManager.
+      int32_t value = ((rec.raw[index] >> 16) * static_cast<int32_t>(rec.gain_q8)) / 256;
+      if (value > 32767) {
+        value = 32767;
+      } else if (value < -32768) {
+        value = -32768;
+      }
+      rec.pcm[index] = static_cast<int16_t>(value);
+    }
+    // Never blocks: a full ring means storage is behind and shows up as dropped samples.
+    (void)rec.ring.push(rec.pcm, static_cast<uint32_t>(frames));
+    capture_busy_.store(false);
+  }
+}
+
+void MediaManager::writerTaskEntry(void* arg) {
+  auto* self = static_cast<MediaManager*>(arg);
+  if (self == nullptr) {
+    vTaskDelete(nullptr);
+    return;
+  }
+  self->writerTaskMain();
+}
+
+void MediaManager::writerTaskMain() {
+  Recorder& rec = *recorder_;
+  while (true) {
+    const uint8_t state = writer_state_.load();
+    if (state != static_cast<uint8_t>(WriterState::kRunning) &&
+        state != static_cast<uint8_t>(WriterState::kDraining)) {
+      vTaskDelay(pdMS_TO_TICKS(kIdleDelayMs));
+      continue;
+    }
+    const uint32_t popped = rec.ring.pop(rec.drain, kWriterChunkSamples);
+    if (popped > 0U && !writer_failed_.load()) {
+      (void)rec.writer.write(rec.drain, popped);
+      if (rec.writer.stats().sink_error) {
+        writer_failed_.store(true);
+      }
+    }
+    if (popped == 0U && state == static_cast<uint8_t>(WriterState::kDraining)) {
+      // Capture is stopped, so an empty ring means everything is encoded.
+      if (!rec.writer.finish()) {
+        writer_failed_.store(true);
+      }
+      rec.sink.close();
+    }
+    const media::WavStreamStats& stats = rec.writer.stats();
+    const uint32_t ops = stats.sink_writes + stats.header_patches;
+    live_samples_.store(stats.samples);
+    live_bytes_.store(stats.data_bytes);
+    live_write_avg_us_.store((ops > 0U) ? (stats.write_us_total / ops) : 0U);
+    live_write_max_us_.store(stats.write_us_max);
+    if (!rec.writer.active()) {
+      writer_state_.store(static_cast<uint8_t>(WriterState::kFinished));
+      continue;
+    }
+    if (popped == kWriterChunkSamples) {
+      continue;
+    }
+    vTaskDelay(pdMS_TO_TICKS(kWriterPollMs));
+  }
+}
+#endif
@@ -0,0 +1,69 @@
+// pcm_ring_buffer.cpp - lock-free single-producer/single-consumer PCM16 ring.
+#include "system/media/pcm_ring_buffer.h"
+
+#include <cstring>
+
+namespace media {
+
+bool PcmRingBuffer::begin(int16_t* storage, uint32_t capacity) {
+  if (storage == nullptr || capacity == 0U || (capacity & (capacity - 1U)) != 0U) {
+    return false;
+  }
+  storage_ = storage;
+  capacity_ = capacity;
+  mask_ = capacity - 1U;
+  reset();
+  return true;
+}
+
+void PcmRingBuffer::reset() {
+  head_.store(0U);
+  tail_.store(0U);
+  dropped_.store(0U);
+  peak_fill_.store(0U);
+}
+
+uint32_t PcmRingBuffer::push(const int16_t* samples, uint32_t count) {
+  if (storage_ == nullptr || samples == nullptr) {
+    return 0U;
+  }
+  const uint32_t head = head_.load(std::memory_order_relaxed);
+  const uint32_t tail = tail_.load(std::memory_order_acquire);
+  const uint32_t free_slots = capacity_ - (head - tail);
+  const uint32_t accepted = (count < free_slots) ? count : free_slots;
+  if (accepted < count) {
+    dropped_.fetch_add(count - accepted, std::memory_order_relaxed);
+  }
+  const uint32_t start = head & mask_;
+  const uint32_t first = (accepted < capacity_ - start) ? accepted : (capacity_ - start);
+  std::memcpy(&storage_[start], samples, first * sizeof(int16_t));
+  std::memcpy(storage_, samples + first, (accepted - first) * sizeof(int16_t));
+  head_.store(head + accepted, std::memory_order_release);
+  const uint32_t fill = (head + accepted) - tail;
+  if (fill > peak_fill_.load(std::memory_order_relaxed)) {
+    peak_fill_.store(fill, std::memory_order_relaxed);
+  }
+  return accepted;
+}
+
+uint32_t PcmRingBuffer::pop(int16_t* out, uint32_t max_count) {
+  if (storage_ == nullptr || out == nullptr) {
+    return 0U;
+  }
+  const uint32_t tail = tail_.load(std::memory_order_relaxed);
+  const uint32_t head = head_.load(std::memory_order_acquire);
+  const uint32_t ready = head - tail;
+  const uint32_t taken = (max_count < ready) ? max_count : ready;
+  const uint32_t start = tail & mask_;
+  const uint32_t first = (taken < capacity_ - start) ? taken : (capacity_ - start);
+  std::memcpy(out, &storage_[start], first * sizeof(int16_t));
+  std::memcpy(out + first, storage_, (taken - first) * sizeof(int16_t));
+  tail_.store(tail + taken, std::memory_order_release);
+  return taken;
+}
+
+uint32_t PcmRingBuffer::available() const {
+  return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+}
+
+}  // namespace media
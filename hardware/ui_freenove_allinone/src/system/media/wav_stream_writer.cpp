@@ -0,0 +1,260 @@
+// wav_stream_writer.cpp - streaming mono WAV writer (PCM16 or IMA ADPCM).
+#include "system/media/wav_stream_writer.h"
+
+#include <cstring>
+
+namespace media {
+
+namespace {
+
+constexpr uint16_t kFormatPcm = 0x0001U;
+constexpr uint16_t kFormatImaAdpcm = 0x0011U;
+constexpr size_t kPcmHeaderBytes = 44U;
+constexpr size_t kAdpcmHeaderBytes = 60U;
+
+uint8_t* put16(uint8_t* out, uint16_t value) {
+  out[0] = static_cast<uint8_t>(value & 0xFFU);
+  out[1] = static_cast<uint8_t>(value >> 8);
+  return out + 2;
+}
+
+uint8_t* put32(uint8_t* out, uint32_t value) {
+  out[0] = static_cast<uint8_t>(value & 0xFFU);
+  out[1] = static_cast<uint8_t>((value >> 8) & 0xFFU);
+  out[2] = static_cast<uint8_t>((value >> 16) & 0xFFU);
+  out[3] = static_cast<uint8_t>(value >> 24);
+  return out + 4;
+}
+
+uint8_t* putTag(uint8_t* out, const char* tag) {
+  std::memcpy(out, tag, 4U);
+  return out + 4;
+}
+
+bool validConfig(const WavStreamConfig& config) {
+  if (config.sample_rate == 0U) {
+    return false;
+  }
+  if (config.encoding == WavEncoding::kPcm16) {
+    return true;
+  }
+  return config.encoding == WavEncoding::kImaAdpcm && config.adpcm_block_bytes > ImaAdpcm::kHeaderBytes &&
+         config.adpcm_block_bytes <= WavStreamWriter::kMaxAdpcmBlockBytes;
+}
+
+}  // namespace
+
+size_t WavStreamWriter::buildHeader(const WavStreamConfig& config,
+                                    uint32_t data_bytes,
+                                    uint32_t samples,
+                                    uint8_t* out) {
+  if (out == nullptr || !validConfig(config)) {
+    return 0U;
+  }
+  const bool adpcm = (config.encoding == WavEncoding::kImaAdpcm);
+  const size_t header_bytes = adpcm ? kAdpcmHeaderBytes : kPcmHeaderBytes;
+  uint8_t* cursor = out;
+  cursor = putTag(cursor, "RIFF");
+  cursor = put32(cursor, static_cast<uint32_t>(header_bytes - 8U) + data_bytes);
+  cursor = putTag(cursor, "WAVE");
+  cursor = putTag(cursor, "fmt ");
+  if (adpcm) {
+    const uint16_t block_bytes = config.adpcm_block_bytes;
+    const uint16_t samples_per_block = ImaAdpcm::samplesPerBlock(block_bytes);
+    cursor = put32(cursor, 20U);
+    cursor = put16(cursor, kFormatImaAdpcm);
+    cursor = put16(cursor, 1U);
+    cursor = put32(cursor, config.sample_rate);
+    cursor = put32(cursor, static_cast<uint32_t>((static_cast<uint64_t>(config.sample_rate) * block_bytes) /
+                                                 samples_per_block));
+    cursor = put16(cursor, block_bytes);
+    cursor = put16(cursor, 4U);
+    cursor = put16(cursor, 2U);  // cbSize
+    cursor = put16(cursor, samples_per_block);
+    cursor = putTag(cursor, "fact");
+    cursor = put32(cursor, 4U);
+    cursor = put32(cursor, samples);
+  } else {
+    cursor = put32(cursor, 16U);
+    cursor = put16(cursor, kFormatPcm);
+    cursor = put16(cursor, 1U);
+    cursor = put32(cursor, config.sample_rate);
+    cursor = put32(cursor, config.sample_rate * 2U);
+    cursor = put16(cursor, 2U);
+    cursor = put16(cursor, 16U);
+  }
+  cursor = putTag(cursor, "data");
+  cursor = put32(cursor, data_bytes);
+  return static_cast<size_t>(cursor - out);
+}
+
+uint32_t WavStreamWriter::dataBytesFor(const WavStreamConfig& config, uint32_t samples) {
+  if (config.encoding == WavEncoding::kPcm16) {
+    return samples * 2U;
+  }
+  const uint32_t samples_per_block = ImaAdpcm::samplesPerBlock(config.adpcm_block_bytes);
+  return ((samples + samples_per_block - 1U) / samples_per_block) * config.adpcm_block_bytes;
+}
+
+bool WavStreamWriter::begin(WavSink* sink, const WavStreamConfig& config) {
+  sink_ = nullptr;
+  if (sink == nullptr || !validConfig(config)) {
+    return false;
+  }
+  config_ = config;
+  stats_ = {};
+  adpcm_ = {};
+  block_samples_ =
+      (config_.encoding == WavEncoding::kImaAdpcm) ? ImaAdpcm::samplesPerBlock(config_.adpcm_block_bytes) : 0U;
+  block_fill_ = 0U;
+  chunk_fill_ = 0U;
+  flushed_samples_ = 0U;
+  bytes_since_patch_ = 0U;
+
+  uint8_t header[kMaxHeaderBytes];
+  header_bytes_ = static_cast<uint32_t>(buildHeader(config_, 0U, 0U, header));
+  if (config_.max_samples > 0U && !sink->reserve(header_bytes_ + dataBytesFor(config_, config_.max_samples))) {
+    return false;
+  }
+  sink_ = sink;
+  if (!timedAppend(header, header_bytes_)) {
+    sink_ = nullptr;
+    return false;
+  }
+  return true;
+}
+
+size_t WavStreamWriter::write(const int16_t* pcm, size_t count) {
+  if (sink_ == nullptr || stats_.sink_error || pcm == nullptr) {
+    return 0U;
+  }
+  size_t accepted = count;
+  if (config_.max_samples > 0U) {
+    const uint32_t room = (stats_.samples < config_.max_samples) ? (config_.max_samples - stats_.samples) : 0U;
+    if (accepted > room) {
+      accepted = room;
+      stats_.truncated_samples += static_cast<uint32_t>(count - accepted);
+    }
+  }
+
+  size_t index = 0U;
+  if (config_.encoding == WavEncoding::kPcm16) {
+    while (index < accepted) {
+      if (chunk_fill_ == kChunkBytes && !flushChunk()) {
+        break;
+      }
+      const uint16_t sample = static_cast<uint16_t>(pcm[index++]);
+      chunk_[chunk_fill_++] = static_cast<uint8_t>(sample & 0xFFU);
+      chunk_[chunk_fill_++] = static_cast<uint8_t>(sample >> 8);
+      ++stats_.samples;
+    }
+  } else {
+    while (index < accepted) {
+      size_t take = block_samples_ - block_fill_;
+      if (take > accepted - index) {
+        take = accepted - index;
+      }
+      std::memcpy(&block_pcm_[block_fill_], &pcm[index], take * sizeof(int16_t));
+      block_fill_ = static_cast<uint16_t>(block_fill_ + take);
+      index += take;
+      stats_.samples += static_cast<uint32_t>(take);
+      if (block_fill_ == block_samples_ && !encodePendingBlock()) {
+        break;
+      }
+    }
+  }
+  return index;
+}
+
+bool WavStreamWriter::finish() {
+  if (sink_ == nullptr) {
+    return false;
+  }
+  if (block_fill_ > 0U && !stats_.sink_error) {
+    // The fact chunk carries the real length; the tail is silence.
+    std::memset(&block_pcm_[block_fill_], 0, (block_samples_ - block_fill_) * sizeof(int16_t));
+    block_fill_ = block_samples_;
+    (void)encodePendingBlock();
+  }
+  if (!stats_.sink_error) {
+    (void)flushChunk();
+  }
+  flushed_samples_ = stats_.samples;
+  const bool ok = !stats_.sink_error && patchHeader();
+  sink_ = nullptr;
+  return ok;
+}
+
+bool WavStreamWriter::full() const {
+  return config_.max_samples > 0U && stats_.samples >= config_.max_samples;
+}
+
+bool WavStreamWriter::encodePendingBlock() {
+  if (chunk_fill_ + config_.adpcm_block_bytes > kChunkBytes && !flushChunk()) {
+    return false;
+  }
+  ImaAdpcm::encodeBlock(block_pcm_, config_.adpcm_block_bytes, &adpcm_, &chunk_[chunk_fill_]);
+  chunk_fill_ += config_.adpcm_block_bytes;
+  block_fill_ = 0U;
+  return true;
+}
+
+bool WavStreamWriter::flushChunk() {
+  if (chunk_fill_ == 0U) {
+    return true;
+  }
+  if (!timedAppend(chunk_, chunk_fill_)) {
+    return false;
+  }
+  stats_.data_bytes += static_cast<uint32_t>(chunk_fill_);
+  bytes_since_patch_ += static_cast<uint32_t>(chunk_fill_);
+  if (config_.encoding == WavEncoding::kPcm16) {
+    flushed_samples_ += static_cast<uint32_t>(chunk_fill_ / 2U);
+  } else {
+    flushed_samples_ += static_cast<uint32_t>(chunk_fill_ / config_.adpcm_block_bytes) * block_samples_;
+  }
+  chunk_fill_ = 0U;
+  if (config_.patch_every_bytes > 0U && bytes_since_patch_ >= config_.patch_every_bytes) {
+    return patchHeader();
+  }
+  return true;
+}
+
+bool WavStreamWriter::patchHeader() {
+  uint8_t header[kMaxHeaderBytes];
+  const uint32_t samples = (flushed_samples_ < stats_.samples) ? flushed_samples_ : stats_.samples;
+  const size_t header_bytes = buildHeader(config_, stats_.data_bytes, samples, header);
+  const uint32_t started_us = (config_.clock_us != nullptr) ? config_.clock_us() : 0U;
+  const bool ok = sink_->writeAt(0U, header, header_bytes) && sink_->flush();
+  noteLatency(started_us);
+  ++stats_.header_patches;
+  bytes_since_patch_ = 0U;
+  if (!ok) {
+    stats_.sink_error = true;
+  }
+  return ok;
+}
+
+bool WavStreamWriter::timedAppend(const uint8_t* data, size_t bytes) {
+  const uint32_t started_us = (config_.clock_us != nullptr) ? config_.clock_us() : 0U;
+  const bool ok = sink_->append(data, bytes);
+  noteLatency(started_us);
+  ++stats_.sink_writes;
+  if (!ok) {
+    stats_.sink_error = true;
+  }
+  return ok;
+}
+
+void WavStreamWriter::noteLatency(uint32_t started_us) {
+  if (config_.clock_us == nullptr) {
+    return;
+  }
+  const uint32_t elapsed_us = config_.clock_us() - started_us;
+  stats_.write_us_total += elapsed_us;
+  if (elapsed_us > stats_.write_us_max) {
+    stats_.write_us_max = elapsed_us;
+  }
+}
+
+}  // namespace media
@@ -115,6 +115,18 @@ bool looksLikeEspNowEnvelope(JsonVariantConst root) {
          object.containsKey("payload") && object["ack"].is<bool>();
 }
 
+// Record text is length-delimited; payload buffers are NUL-terminated.
+void copyRecordText(char* out, size_t out_size, const uint8_t* data, size_t len) {
+  if (out == nullptr || out_size == 0U) {
+    return;
+  }
+  const size_t copy_len = (len < out_size - 1U) ? len : (out_size - 1U);
+  if (data != nullptr && copy_len > 0U) {
+    std::memcpy(out, data, copy_len);
+  }
+  out[copy_len] = '\0';
+}
+
 bool looksLikeEspNowEnvelopeText(const char* payload) {
   if (payload == nullptr || payload[0] != '{') {
     return false;
@@ -143,6 +155,7 @@ bool NetworkManager::begin(const char* hostname) {
   }
 
   g_network_instance = this;
+  espNowLinkInit(&broadcast_link_, static_cast<uint8_t>(esp_random()));
   started_ = true;
   refreshSnapshot();
   Serial.printf("[NET] wifi ready hostname=%s\n", (hostname != nullptr) ? hostname : "none");
@@ -155,6 +168,7 @@ void NetworkManager::update(uint32_t now_ms) {
   }
 
   refreshEspNowConnection(now_ms);
+  pumpEspNowLinks(now_ms);
 
   const bool connected_to_local = isConnectedToLocalTarget();
   const bool was_retry_paused = local_retry_paused_;
@@ -426,12 +440,15 @@ void NetworkManager::disableEspNow() {
     return;
   }
   esp_now_deinit();
-  enterCritical(&rx_queue_mux_, false);
+  // The receive callback is unregistered: nothing produces into the ring now.
+  rx_frame_ = nullptr;
+  rx_frame_pos_ = 0U;
+  rx_batch_left_ = 0U;
+  rx_ring_.reset();
+  espnow_rx_invalid_.store(0U, std::memory_order_relaxed);
+  enterCritical(&state_mux_, false);
   espnow_enabled_ = false;
   peer_cache_count_ = 0U;
-  rx_queue_head_ = 0U;
-  rx_queue_tail_ = 0U;
-  rx_queue_count_ = 0U;
   snapshot_.last_peer[0] = '\0';
   snapshot_.last_rx_peer[0] = '\0';
   snapshot_.last_msg_id[0] = '\0';
@@ -439,7 +456,7 @@ void NetworkManager::disableEspNow() {
   snapshot_.last_payload[0] = '\0';
   snapshot_.espnow_last_seq = 0U;
   snapshot_.espnow_last_ack = false;
-  exitCritical(&rx_queue_mux_, false);
+  exitCritical(&state_mux_, false);
   refreshSnapshot();
   Serial.println("[NET] ESP-NOW off");
 }
@@ -518,9 +535,9 @@ bool NetworkManager::removeEspNowPeer(const char* mac_text) {
 }
 
 uint8_t NetworkManager::espNowPeerCount() const {
-  enterCritical(&rx_queue_mux_, false);
+  enterCritical(&state_mux_, false);
   const uint8_t count = peer_cache_count_;
-  exitCritical(&rx_queue_mux_, false);
+  exitCritical(&state_mux_, false);
   return count;
 }
 
@@ -529,19 +546,16 @@ bool NetworkManager::espNowPeerAt(uint8_t index, char* out_mac, size_t out_capac
     return false;
   }
   bool ok = false;
-  enterCritical(&rx_queue_mux_, false);
+  enterCritical(&state_mux_, false);
   if (index < peer_cache_count_) {
     copyText(out_mac, out_capacity, peer_cache_[index]);
     ok = true;
   }
-  exitCritical(&rx_queue_mux_, false);
+  exitCritical(&state_mux_, false);
   return ok;
 }
 
 bool NetworkManager::sendEspNowText(const uint8_t mac[6], const char* text) {
-  if (!ensureEspNowReady()) {
-    return false;
-  }
   if (mac == nullptr || text == nullptr || text[0] == '\0') {
     return false;
   }
@@ -550,6 +564,16 @@ bool NetworkManager::sendEspNowText(const uint8_t mac[6], const char* text) {
     Serial.printf("[NET] ESP-NOW payload too large: %u bytes\n", static_cast<unsigned int>(payload_len));
     return false;
   }
+  return sendEspNowBytes(mac, reinterpret_cast<const uint8_t*>(text), payload_len);
+}
+
+bool NetworkManager::sendEspNowBytes(const uint8_t mac[6], const uint8_t* data, size_t len) {
+  if (!ensureEspNowReady()) {
+    return false;
+  }
+  if (mac == nullptr || data == nullptr || len == 0U || len > ESP_NOW_MAX_DATA_LEN) {
+    return false;
+  }
 
   if (!isBroadcastMac(mac)) {
     if (!addEspNowPeerInternal(mac)) {
@@ -569,13 +593,11 @@ bool NetworkManager::sendEspNowText(const uint8_t mac[6], const char* text) {
     }
   }
 
-  esp_err_t err = esp_now_send(mac,
-                               reinterpret_cast<const uint8_t*>(text),
-                               payload_len);
+  esp_err_t err = esp_now_send(mac, data, len);
   if (err == ESP_ERR_ESPNOW_NO_MEM || err == ESP_ERR_ESPNOW_FULL) {
     // Transient TX queue pressure: short backoff before any heavier recovery path.
     delay(8);
-    err = esp_now_send(mac, reinterpret_cast<const uint8_t*>(text), payload_len);
+    err = esp_now_send(mac, data, len);
   }
   bool should_recover_once = (err == ESP_ERR_ESPNOW_NOT_INIT ||
                               err == ESP_ERR_ESPNOW_INTERNAL ||
@@ -593,14 +615,14 @@ bool NetworkManager::sendEspNowText(const uint8_t mac[6], const char* text) {
       if (enableEspNow()) {
         applyEspNowChannelHint("espnow_retry");
         addEspNowPeerInternal(mac);
-        err = esp_now_send(mac, reinterpret_cast<const uint8_t*>(text), payload_len);
+        err = esp_now_send(mac, data, len);
       }
     }
   }
   if (err != ESP_OK) {
-    enterCritical(&rx_queue_mux_, false);
+    enterCritical(&state_mux_, false);
     ++espnow_tx_fail_;
-    exitCritical(&rx_queue_mux_, false);
+    exitCritical(&state_mux_, false);
     Serial.printf("[NET] ESP-NOW send failed err=%d\n", static_cast<int>(err));
     return false;
   }
@@ -709,93 +731,276 @@ bool NetworkManager::sendEspNowTarget(const char* target, const char* text) {
   return sendEspNowText(kBroadcastMac, frame);
 }
 
+bool NetworkManager::sendEspNowRecord(const char* target, uint8_t type, const char* text) {
+  if (text == nullptr || text[0] == '\0' || !ensureEspNowReady()) {
+    return false;
+  }
+  uint8_t mac[6] = {0};
+  std::memcpy(mac, kBroadcastMac, sizeof(mac));
+  if (target != nullptr && target[0] != '\0' && !equalsIgnoreCase(target, kBroadcastTarget) &&
+      !parseMac(target, mac)) {
+    return false;
+  }
+  const uint32_t now_ms = millis();
+  EspNowLink* link = espNowLinkFor(mac, now_ms);
+  return espNowLinkQueue(link,
+                         type,
+                         reinterpret_cast<const uint8_t*>(text),
+                         std::strlen(text),
+                         !isBroadcastMac(mac),
+                         now_ms);
+}
+
+bool NetworkManager::sendEspNowResult(const char* peer,
+                                      uint16_t request_id,
+                                      bool ok,
+                                      const char* code,
+                                      const char* data_json) {
+  uint8_t mac[6] = {0};
+  if (peer == nullptr || !parseMac(peer, mac) || isBroadcastMac(mac)) {
+    return false;
+  }
+  const uint32_t now_ms = millis();
+  EspNowLink* link = espNowLinkFor(mac, now_ms);
+  const char* data = (data_json != nullptr) ? data_json : "";
+  if (espNowLinkQueueResult(link, request_id, ok, code, data, std::strlen(data), now_ms, true)) {
+    return true;
+  }
+  // Data larger than one record: the code alone beats no answer.
+  return espNowLinkQueueResult(link, request_id, ok, code, nullptr, 0U, now_ms, true);
+}
+
+EspNowLink* NetworkManager::espNowLinkFor(const uint8_t mac[6], uint32_t now_ms) {
+  if (isBroadcastMac(mac)) {
+    return &broadcast_link_;
+  }
+  PeerLink* victim = nullptr;
+  for (PeerLink& entry : links_) {
+    if (entry.used && std::memcmp(entry.mac, mac, sizeof(entry.mac)) == 0) {
+      entry.last_used_ms = now_ms;
+      return &entry.link;
+    }
+    if (!entry.used) {
+      if (victim == nullptr || victim->used) {
+        victim = &entry;
+      }
+    } else if (victim == nullptr ||
+               (victim->used && static_cast<int32_t>(entry.last_used_ms - victim->last_used_ms) < 0)) {
+      victim = &entry;
+    }
+  }
+  // Least recently used peer loses its link; a fresh epoch tells the peer to
+  // restart its window.
+  victim->used = true;
+  std::memcpy(victim->mac, mac, sizeof(victim->mac));
+  victim->last_used_ms = now_ms;
+  espNowLinkInit(&victim->link, static_cast<uint8_t>(esp_random()));
+  return &victim->link;
+}
+
+void NetworkManager::pumpEspNowLinks(uint32_t now_ms) {
+  if (!espnow_enabled_) {
+    return;
+  }
+  uint8_t frame[ESPNOW_FRAME_MAX] = {0};
+  for (uint8_t index = 0U; index <= kMaxEspNowLinks; ++index) {
+    const bool broadcast = index == kMaxEspNowLinks;
+    if (!broadcast && !links_[index].used) {
+      continue;
+    }
+    EspNowLink* link = broadcast ? &broadcast_link_ : &links_[index].link;
+    const uint8_t* mac = broadcast ? kBroadcastMac : links_[index].mac;
+    // At most a window plus an ack per pass keeps update() short.
+    for (uint8_t sent = 0U; sent <= ESPNOW_FRAME_MAX_WINDOW; ++sent) {
+      const size_t len = espNowLinkPoll(link, now_ms, frame, sizeof(frame));
+      if (len == 0U || !sendEspNowBytes(mac, frame, len)) {
+        // A failed reliable frame stays in flight; its RTO resends it.
+        break;
+      }
+    }
+  }
+}
+
 NetworkManager::Snapshot NetworkManager::snapshot() const {
-  enterCritical(&rx_queue_mux_, false);
+  enterCritical(&state_mux_, false);
   const Snapshot snapshot_copy = snapshot_;
-  exitCritical(&rx_queue_mux_, false);
+  exitCritical(&state_mux_, false);
   return snapshot_copy;
 }
 
-bool NetworkManager::consumeEspNowMessage(char* out_payload,
-                                          size_t payload_capacity,
-                                          char* out_peer,
-                                          size_t peer_capacity,
-                                          char* out_msg_id,
-                                          size_t msg_id_capacity,
-                                          uint32_t* out_seq,
-                                          char* out_type,
-                                          size_t type_capacity,
-                                          bool* out_ack_requested) {
-  for (;;) {
-    EspNowMessage entry = {};
-    enterCritical(&rx_queue_mux_, false);
-    if (rx_queue_count_ == 0U) {
-      exitCritical(&rx_queue_mux_, false);
-      return false;
+bool NetworkManager::decodeEspNowText(const char* text, EspNowInbound* out) const {
+  copyText(out->payload, sizeof(out->payload), text);
+  if (text[0] == '{') {
+    StaticJsonDocument<512> document;
+    if (!deserializeJson(document, text) && looksLikeEspNowEnvelope(document.as<JsonVariantConst>())) {
+      JsonVariantConst root = document.as<JsonVariantConst>();
+      copyText(out->msg_id, sizeof(out->msg_id), root["msg_id"] | "");
+      out->seq = root["seq"] | 0U;
+      copyText(out->type, sizeof(out->type), root["type"] | "");
+      const bool envelope_ack = root["ack"] | false;
+      if (envelope_ack && std::strcmp(out->type, "ack") == 0) {
+        return false;
+      }
+      out->ack_requested = envelope_ack;
+      if (root["payload"].is<const char*>()) {
+        copyText(out->payload, sizeof(out->payload), root["payload"].as<const char*>());
+      } else if (!root["payload"].isNull()) {
+        char payload_text[kPayloadCapacity] = {0};
+        const size_t payload_size = serializeJson(root["payload"], payload_text, sizeof(payload_text));
+        if (payload_size > 0U) {
+          copyText(out->payload, sizeof(out->payload), payload_text);
+        }
+      }
     }
-    entry = rx_queue_[rx_queue_head_];
-    rx_queue_head_ = static_cast<uint8_t>((rx_queue_head_ + 1U) % kRxQueueSize);
-    --rx_queue_count_;
-    exitCritical(&rx_queue_mux_, false);
+  }
+  if (out->type[0] == '\0') {
+    copyText(out->type, sizeof(out->type), inferEnvelopeType(out->payload));
+  }
+  return true;
+}
 
-    char normalized_payload[kPayloadCapacity] = {0};
-    copyText(normalized_payload, sizeof(normalized_payload), entry.payload);
-    char msg_id[32] = {0};
-    uint32_t seq = 0U;
-    char envelope_type[24] = {0};
-    bool ack_requested = false;
-
-    if (entry.payload[0] == '{') {
-      StaticJsonDocument<512> document;
-      if (!deserializeJson(document, entry.payload) && looksLikeEspNowEnvelope(document.as<JsonVariantConst>())) {
-        JsonVariantConst root = document.as<JsonVariantConst>();
-        copyText(msg_id, sizeof(msg_id), root["msg_id"] | "");
-        seq = root["seq"] | 0U;
-        copyText(envelope_type, sizeof(envelope_type), root["type"] | "");
-        const bool envelope_ack = root["ack"] | false;
-        const bool ack_response = envelope_ack && std::strcmp(envelope_type, "ack") == 0;
-        if (ack_response) {
+bool NetworkManager::nextEspNowRecord(EspNowInbound* out) {
+  uint8_t type = 0U;
+  const uint8_t* data = nullptr;
+  uint8_t len = 0U;
+  while (rx_frame_ != nullptr && rx_frame_pos_ != 0U) {
+    if (!espNowFrameNextRecord(rx_frame_->data, rx_frame_->len, &rx_frame_pos_, &type, &data, &len)) {
+      rx_frame_pos_ = 0U;
+      return false;
+    }
+    *out = EspNowInbound();
+    char text[kPayloadCapacity] = {0};
+    switch (type) {
+      case ESPNOW_REC_COMMAND: {
+        const char* line = nullptr;
+        uint8_t line_len = 0U;
+        if (!espNowRecordParseCommand(data, len, &out->request_id, &line, &line_len)) {
           continue;
         }
-        ack_requested = envelope_ack;
-        if (root["payload"].is<const char*>()) {
-          copyText(normalized_payload, sizeof(normalized_payload), root["payload"].as<const char*>());
-        } else if (!root["payload"].isNull()) {
-          char payload_text[kPayloadCapacity] = {0};
-          const size_t payload_size = serializeJson(root["payload"], payload_text, sizeof(payload_text));
-          if (payload_size > 0U) {
-            copyText(normalized_payload, sizeof(normalized_payload), payload_text);
-          }
-        }
-        if (envelope_type[0] == '\0') {
-          copyText(envelope_type, sizeof(envelope_type), inferEnvelopeType(normalized_payload));
-        }
+        copyRecordText(out->payload, sizeof(out->payload), reinterpret_cast<const uint8_t*>(line), line_len);
+        copyText(out->type, sizeof(out->type), "command");
+        out->ack_requested = true;
+        out->binary = true;
+        break;
       }
+      case ESPNOW_REC_EVENT:
+      case ESPNOW_REC_TEXT:
+        copyRecordText(out->payload, sizeof(out->payload), data, len);
+        copyText(out->type, sizeof(out->type), inferEnvelopeType(out->payload));
+        break;
+      case ESPNOW_REC_JSON:
+        // Legacy envelope carried in a record: acked the legacy way.
+        copyRecordText(text, sizeof(text), data, len);
+        if (!decodeEspNowText(text, out)) {
+          continue;
+        }
+        break;
+      default:
+        // RESULT records answer commands we send; nothing waits on them yet.
+        continue;
     }
-    if (envelope_type[0] == '\0') {
-      copyText(envelope_type, sizeof(envelope_type), inferEnvelopeType(normalized_payload));
+    if (out->seq == 0U) {
+      out->seq = rx_frame_seq_;
     }
+    formatMac(rx_frame_->mac, out->peer, sizeof(out->peer));
+    return true;
+  }
+  return false;
+}
 
-    if (out_payload != nullptr && payload_capacity > 0U) {
-      copyText(out_payload, payload_capacity, normalized_payload);
+bool NetworkManager::consumeEspNowMessage(EspNowInbound* out) {
+  if (out == nullptr) {
+    return false;
+  }
+  for (;;) {
+    if (nextEspNowRecord(out)) {
+      return true;
     }
-    if (out_peer != nullptr && peer_capacity > 0U) {
-      copyText(out_peer, peer_capacity, entry.peer);
+    releaseEspNowRxFrame();
+    const uint32_t now_ms = millis();
+    if (rx_batch_left_ == 0U && !beginEspNowRxBatch(now_ms)) {
+      return false;
     }
-    if (out_msg_id != nullptr && msg_id_capacity > 0U) {
-      copyText(out_msg_id, msg_id_capacity, msg_id);
+    --rx_batch_left_;
+    rx_frame_ = &rx_ring_.peek();
+
+    if (rx_frame_->kind == kEspNowRxBinary) {
+      EspNowLink* link = espNowLinkFor(rx_frame_->mac, now_ms);
+      if (espNowLinkAccept(link, rx_frame_->data, rx_frame_->len, now_ms) == ESPNOW_ACCEPT_DELIVER) {
+        rx_frame_pos_ = ESPNOW_FRAME_HEADER;
+        rx_frame_seq_ = espNowFrameGetU16(rx_frame_->data + 4);
+      }
+      continue;
     }
-    if (out_seq != nullptr) {
-      *out_seq = seq;
+
+    char text[kPayloadCapacity] = {0};
+    copyRecordText(text, sizeof(text), rx_frame_->data, rx_frame_->len);
+    *out = EspNowInbound();
+    const bool decoded = decodeEspNowText(text, out);
+    if (decoded) {
+      formatMac(rx_frame_->mac, out->peer, sizeof(out->peer));
     }
-    if (out_type != nullptr && type_capacity > 0U) {
-      copyText(out_type, type_capacity, envelope_type);
+    releaseEspNowRxFrame();
+    if (decoded) {
+      return true;
     }
-    if (out_ack_requested != nullptr) {
-      *out_ack_requested = ack_requested;
+  }
+}
+
+// Takes the frames ready now (at most kRxBatchMax) and does the per-frame
+// bookkeeping the receive callback no longer does: peer cache, snapshot and
+// queueing latency, under one lock for the whole batch.
+bool NetworkManager::beginEspNowRxBatch(uint32_t now_ms) {
+  const uint32_t depth = static_cast<uint32_t>(rx_ring_.depth());
+  const size_t count = rx_ring_.ready(kRxBatchMax);
+  if (count == 0U) {
+    return false;
+  }
+  uint32_t latency_max_ms = espnow_rx_latency_max_ms_;
+  for (size_t index = 0U; index < count; ++index) {
+    const EspNowMessage& entry = rx_ring_.peek(index);
+    cachePeer(entry.mac);
+    const uint32_t latency_ms = now_ms - entry.rx_ms;
+    if (latency_ms > latency_max_ms) {
+      latency_max_ms = latency_ms;
     }
-    return true;
   }
+
+  const EspNowMessage& last = rx_ring_.peek(count - 1U);
+  char peer_text[18] = {0};
+  char payload[kPayloadCapacity] = {0};
+  formatMac(last.mac, peer_text, sizeof(peer_text));
+  if (last.kind != kEspNowRxBinary) {
+    copyRecordText(payload, sizeof(payload), last.data, last.len);
+  }
+  enterCritical(&state_mux_, false);
+  copyText(snapshot_.last_peer, sizeof(snapshot_.last_peer), peer_text);
+  copyText(snapshot_.last_rx_peer, sizeof(snapshot_.last_rx_peer), peer_text);
+  snapshot_.espnow_last_seq = 0U;
+  snapshot_.espnow_last_ack = false;
+  snapshot_.last_msg_id[0] = '\0';
+  copyText(snapshot_.last_type,
+           sizeof(snapshot_.last_type),
+           (last.kind == kEspNowRxBinary) ? "binary" : inferEnvelopeType(payload));
+  copyText(snapshot_.last_payload, sizeof(snapshot_.last_payload), payload);
+  exitCritical(&state_mux_, false);
+
+  if (depth > espnow_rx_high_water_) {
+    espnow_rx_high_water_ = depth;
+  }
+  espnow_rx_latency_max_ms_ = latency_max_ms;
+  ++espnow_rx_batches_;
+  rx_batch_left_ = count;
+  return true;
+}
+
+void NetworkManager::releaseEspNowRxFrame() {
+  if (rx_frame_ == nullptr) {
+    return;
+  }
+  rx_frame_ = nullptr;
+  rx_frame_pos_ = 0U;
+  rx_ring_.pop();
 }
 
 void NetworkManager::onEspNowRecv(const uint8_t* mac_addr, const uint8_t* data, int data_len) {
@@ -957,24 +1162,24 @@ void NetworkManager::cachePeer(const uint8_t mac[6], bool from_isr) {
   if (peer_text[0] == '\0') {
     return;
   }
-  enterCritical(&rx_queue_mux_, from_isr);
+  enterCritical(&state_mux_, from_isr);
   for (uint8_t index = 0U; index < peer_cache_count_; ++index) {
     if (std::strcmp(peer_cache_[index], peer_text) == 0) {
-      exitCritical(&rx_queue_mux_, from_isr);
+      exitCritical(&state_mux_, from_isr);
       return;
     }
   }
   if (peer_cache_count_ < kMaxPeerCache) {
     copyText(peer_cache_[peer_cache_count_], sizeof(peer_cache_[peer_cache_count_]), peer_text);
     ++peer_cache_count_;
-    exitCritical(&rx_queue_mux_, from_isr);
+    exitCritical(&state_mux_, from_isr);
     return;
   }
   for (uint8_t index = 1U; index < kMaxPeerCache; ++index) {
     copyText(peer_cache_[index - 1U], sizeof(peer_cache_[index - 1U]), peer_cache_[index]);
   }
   copyText(peer_cache_[kMaxPeerCache - 1U], sizeof(peer_cache_[kMaxPeerCache - 1U]), peer_text);
-  exitCritical(&rx_queue_mux_, from_isr);
+  exitCritical(&state_mux_, from_isr);
 }
 
 void NetworkManager::forgetPeer(const uint8_t mac[6]) {
@@ -986,9 +1191,9 @@ void NetworkManager::forgetPeer(const uint8_t mac[6]) {
   if (peer_text[0] == '\0') {
     return;
   }
-  enterCritical(&rx_queue_mux_, false);
+  enterCritical(&state_mux_, false);
   if (peer_cache_count_ == 0U) {
-    exitCritical(&rx_queue_mux_, false);
+    exitCritical(&state_mux_, false);
     return;
   }
   for (uint8_t index = 0U; index < peer_cache_count_; ++index) {
@@ -1000,39 +1205,10 @@ void NetworkManager::forgetPeer(const uint8_t mac[6]) {
     }
     peer_cache_[peer_cache_count_ - 1U][0] = '\0';
     --peer_cache_count_;
-    exitCritical(&rx_queue_mux_, false);
+    exitCritical(&state_mux_, false);
     return;
   }
-  exitCritical(&rx_queue_mux_, false);
-}
-
-bool NetworkManager::queueEspNowMessage(const char* payload,
-                                        const char* peer,
-                                        const char* msg_id,
-                                        uint32_t seq,
-                                        const char* type,
-                                        bool ack_requested,
-                                        bool from_isr) {
-  if (payload == nullptr || payload[0] == '\0') {
-    return false;
-  }
-  enterCritical(&rx_queue_mux_, from_isr);
-  if (rx_queue_count_ >= kRxQueueSize) {
-    rx_queue_head_ = static_cast<uint8_t>((rx_queue_head_ + 1U) % kRxQueueSize);
-    --rx_queue_count_;
-    ++espnow_drop_packets_;
-  }
-  EspNowMessage& slot = rx_queue_[rx_queue_tail_];
-  copyText(slot.payload, sizeof(slot.payload), payload);
-  copyText(slot.peer, sizeof(slot.peer), peer);
-  copyText(slot.msg_id, sizeof(slot.msg_id), msg_id);
-  copyText(slot.type, sizeof(slot.type), type);
-  slot.seq = seq;
-  slot.ack_requested = ack_requested;
-  rx_queue_tail_ = static_cast<uint8_t>((rx_queue_tail_ + 1U) % kRxQueueSize);
-  ++rx_queue_count_;
-  exitCritical(&rx_queue_mux_, from_isr);
-  return true;
+  exitCritical(&state_mux_, false);
 }
 
 void NetworkManager::refreshSnapshot() {
@@ -1070,7 +1246,21 @@ void NetworkManager::refreshSnapshot() {
     ap_clients = WiFi.softAPgetStationNum();
   }
 
-  enterCritical(&rx_queue_mux_, false);
+  EspNowLinkStats link_stats = broadcast_link_.stats;
+  for (const PeerLink& entry : links_) {
+    if (!entry.used) {
+      continue;
+    }
+    link_stats.tx_frames += entry.link.stats.tx_frames;
+    link_stats.tx_retransmits += entry.link.stats.tx_retransmits;
+    link_stats.tx_expired_frames += entry.link.stats.tx_expired_frames;
+    link_stats.rx_duplicates += entry.link.stats.rx_duplicates;
+    link_stats.rtt_samples += entry.link.stats.rtt_samples;
+    link_stats.rtt_total_ms += entry.link.stats.rtt_total_ms;
+  }
+  const uint32_t rx_invalid = espnow_rx_invalid_.load(std::memory_order_relaxed);
+
+  enterCritical(&state_mux_, false);
   snapshot_.ready = started_;
   snapshot_.sta_connected = sta_connected;
   snapshot_.sta_connecting = sta_connecting_;
@@ -1089,49 +1279,60 @@ void NetworkManager::refreshSnapshot() {
   copyText(snapshot_.ip, sizeof(snapshot_.ip), ip);
   snapshot_.ap_clients = ap_clients;
   snapshot_.espnow_peer_count = peer_cache_count_;
-  snapshot_.espnow_rx_packets = espnow_rx_packets_;
+  snapshot_.espnow_rx_packets = rx_ring_.pushed() + rx_ring_.overflow() + rx_invalid;
   snapshot_.espnow_tx_ok = espnow_tx_ok_;
   snapshot_.espnow_tx_fail = espnow_tx_fail_;
-  snapshot_.espnow_drop_packets = espnow_drop_packets_;
-  exitCritical(&rx_queue_mux_, false);
+  snapshot_.espnow_drop_packets = rx_ring_.overflow() + rx_invalid;
+  snapshot_.espnow_link_frames = link_stats.tx_frames;
+  snapshot_.espnow_link_retransmits = link_stats.tx_retransmits;
+  snapshot_.espnow_link_expired = link_stats.tx_expired_frames;
+  snapshot_.espnow_link_duplicates = link_stats.rx_duplicates;
+  snapshot_.espnow_link_rtt_avg_ms =
+      (link_stats.rtt_samples != 0U) ? (link_stats.rtt_total_ms / link_stats.rtt_samples) : 0U;
+  snapshot_.espnow_rx_overflow = rx_ring_.overflow();
+  snapshot_.espnow_rx_invalid = rx_invalid;
+  snapshot_.espnow_rx_high_water = espnow_rx_high_water_;
+  snapshot_.espnow_rx_batches = espnow_rx_batches_;
+  snapshot_.espnow_rx_latency_max_ms = espnow_rx_latency_max_ms_;
+  exitCritical(&state_mux_, false);
 }
 
+// WiFi task (or ISR): classify and copy into the ring, nothing else. No
+// locks, no formatting; the loop does the rest in beginEspNowRxBatch.
 void NetworkManager::handleEspNowRecv(const uint8_t* mac_addr, const uint8_t* data, int data_len) {
-  const bool from_isr = inIsrContext();
-  char peer_text[18] = {0};
-  formatMac(mac_addr, peer_text, sizeof(peer_text));
-
-  char payload[kPayloadCapacity] = {0};
-  const int safe_len = (data_len > 0) ? data_len : 0;
-  const size_t copy_len = (static_cast<size_t>(safe_len) < (sizeof(payload) - 1U)) ? static_cast<size_t>(safe_len)
-                                                                                    : (sizeof(payload) - 1U);
-  if (data != nullptr && copy_len > 0U) {
-    std::memcpy(payload, data, copy_len);
+  if (mac_addr == nullptr || data == nullptr || data_len <= 0 || data_len > ESPNOW_FRAME_MAX) {
+    espnow_rx_invalid_.fetch_add(1U, std::memory_order_relaxed);
+    return;
   }
-  payload[copy_len] = '\0';
-  cachePeer(mac_addr, from_isr);
-  enterCritical(&rx_queue_mux_, from_isr);
-  ++espnow_rx_packets_;
-  copyText(snapshot_.last_peer, sizeof(snapshot_.last_peer), peer_text);
-  copyText(snapshot_.last_rx_peer, sizeof(snapshot_.last_rx_peer), peer_text);
-  snapshot_.espnow_last_seq = 0U;
-  snapshot_.espnow_last_ack = false;
-  snapshot_.last_msg_id[0] = '\0';
-  copyText(snapshot_.last_type, sizeof(snapshot_.last_type), inferEnvelopeType(payload));
-  copyText(snapshot_.last_payload, sizeof(snapshot_.last_payload), payload);
-  exitCritical(&rx_queue_mux_, from_isr);
-  queueEspNowMessage(payload, peer_text, "", 0U, "", false, from_isr);
+  const size_t len = static_cast<size_t>(data_len);
+  uint8_t kind = kEspNowRxText;
+  if (espNowFrameIsBinary(data, len)) {
+    EspNowFrameHeader header;
+    if (!espNowFrameParseHeader(data, len, &header)) {
+      espnow_rx_invalid_.fetch_add(1U, std::memory_order_relaxed);
+      return;
+    }
+    kind = kEspNowRxBinary;
+  }
+  const uint32_t now_ms = millis();
+  rx_ring_.push([&](EspNowMessage& slot) {
+    slot.rx_ms = now_ms;
+    std::memcpy(slot.mac, mac_addr, sizeof(slot.mac));
+    slot.kind = kind;
+    slot.len = static_cast<uint8_t>(len);
+    std::memcpy(slot.data, data, len);
+  });
 }
 
 void NetworkManager::handleEspNowSend(const uint8_t* mac_addr, esp_now_send_status_t status) {
   const bool from_isr = inIsrContext();
   cachePeer(mac_addr, from_isr);
-  enterCritical(&rx_queue_mux_, from_isr);
+  enterCritical(&state_mux_, from_isr);
   if (status == ESP_NOW_SEND_SUCCESS) {
     ++espnow_tx_ok_;
   } else {
     ++espnow_tx_fail_;
   }
   formatMac(mac_addr, snapshot_.last_peer, sizeof(snapshot_.last_peer));
-  exitCritical(&rx_queue_mux_, from_isr);
+  exitCritical(&state_mux_, from_isr);
 }
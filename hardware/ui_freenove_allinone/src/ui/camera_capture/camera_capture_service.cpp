@@ -1,6 +1,6 @@
 #include "ui/camera_capture/camera_capture_service.h"
 
-#include <algorithm>
+#include "runtime/simd/simd_downscale.h"
 
 namespace ui::camera {
 
@@ -108,37 +108,25 @@ bool CameraCaptureService::get_sensor_size(int& w, int& h) const {
   return (w > 0 && h > 0);
 }
 
-void CameraCaptureService::downscale_rgb565_nearest(const uint16_t* src,
-                                                    int src_w,
-                                                    int src_h,
-                                                    int src_stride_px,
-                                                    uint16_t* dst,
-                                                    int dst_w,
-                                                    int dst_h,
-                                                    bool aligned16_hint) {
-  (void)aligned16_hint;
-  if (src == nullptr || dst == nullptr || src_w <= 0 || src_h <= 0 || dst_w <= 0 || dst_h <= 0) {
-    return;
-  }
+bool CameraCaptureService::downscale_rgb565_box(const uint16_t* src,
+                                                int src_w,
+                                                int src_h,
+                                                int src_stride_px,
+                                                uint16_t* dst,
+                                                int dst_w,
+                                                int dst_h) {
   if (src_stride_px < src_w) {
     src_stride_px = src_w;
   }
-
-  const uint32_t src_w_span = static_cast<uint32_t>(src_w - 1);
-  const uint32_t src_h_span = static_cast<uint32_t>(src_h - 1);
-  const uint32_t dst_w_span = static_cast<uint32_t>(std::max(dst_w - 1, 1));
-  const uint32_t dst_h_span = static_cast<uint32_t>(std::max(dst_h - 1, 1));
-
-  for (int y = 0; y < dst_h; ++y) {
-    const uint32_t sy = (dst_h == 1) ? static_cast<uint32_t>(src_h / 2) : (static_cast<uint32_t>(y) * src_h_span) / dst_h_span;
-    const uint16_t* src_row = src + static_cast<size_t>(sy) * static_cast<size_t>(src_stride_px);
-    uint16_t* dst_row = dst + static_cast<size_t>(y) * static_cast<size_t>(dst_w);
-    for (int x = 0; x < dst_w; ++x) {
-      const uint32_t sx =
-          (dst_w == 1) ? static_cast<uint32_t>(src_w / 2) : (static_cast<uint32_t>(x) * src_w_span) / dst_w_span;
-      dst_row[x] = src_row[sx];
-    }
-  }
+  return runtime::simd::simd_box_downscale_to_rgb565(src,
+                                                     runtime::simd::DownscaleSource::kRgb565,
+                                                     src_w,
+                                                     src_h,
+                                                     src_stride_px,
+                                                     dst,
+                                                     dst_w,
+                                                     dst_h,
+                                                     dst_w);
 }
 
 }  // namespace ui::camera
@@ -26,10 +26,6 @@ static void apply_btn_style(lv_obj_t* btn, lv_style_t* st_btn, lv_style_t* st_bt
   lv_obj_clear_flag(btn, LV_OBJ_FLAG_SCROLLABLE);
 }
 
-static inline bool aligned16_(const void* p) {
-  return (((uintptr_t)p) & 15u) == 0u;
-}
-
 bool Win311CameraUI::begin(const UiConfig& ui_cfg, const CameraCaptureService::Config& svc_cfg)
 {
   ui_cfg_ = ui_cfg;
@@ -414,12 +410,9 @@ void Win311CameraUI::update_thumb_from_preview_()
 {
   if (!thumb_buf_ || !preview_buf_) return;
 
-  const bool hint = aligned16_(thumb_buf_) && aligned16_(preview_buf_);
-
-  CameraCaptureService::downscale_rgb565_nearest(
+  CameraCaptureService::downscale_rgb565_box(
       preview_buf_, ui_cfg_.preview_w, ui_cfg_.preview_h, ui_cfg_.preview_w,
-      thumb_buf_, ui_cfg_.thumb_w, ui_cfg_.thumb_h,
-      hint);
+      thumb_buf_, ui_cfg_.thumb_w, ui_cfg_.thumb_h);
 
   if (label_no_thumb_) lv_obj_add_flag(label_no_thumb_, LV_OBJ_FLAG_HIDDEN);
   if (img_thumb_) lv_obj_invalidate(img_thumb_);
@@ -590,7 +583,7 @@ void Win311CameraUI::on_button_(lv_obj_t* btn)
     }
 
     String path;
-    const bool ok = service_.save_frozen(path, CameraCaptureService::CaptureFormat::Bmp24);
+    const bool ok = service_.save_frozen(path, CameraCaptureService::CaptureFormat::Jpeg);
     if (ok) {
       last_saved_path_ = path;
       set_status_("SAVED %s", path.c_str());
@@ -0,0 +1,1464 @@
+// qr_decoder.cpp - grayscale QR decoder (finder search, perspective grid, RS).
+#include "ui/qr/qr_decoder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ui {
+namespace {
+
+struct EccBlocks {
+  uint8_t bs;  // short block size (codewords)
+  uint8_t dw;  // data codewords per short block
+  uint8_t ns;  // number of short blocks; long blocks carry one more data word
+};
+
+struct VersionInfo {
+  uint16_t total;    // codewords in the symbol
+  uint8_t align[7];  // alignment pattern centres, 0-terminated
+  EccBlocks ecc[4];  // L, M, Q, H
+};
+
+// ISO/IEC 18004 tables 1, 9 and annex E.
+constexpr VersionInfo kVersions[40] = {
+    {26, {}, {{26, 19, 1}, {26, 16, 1}, {26, 13, 1}, {26, 9, 1}}},  // 1
+    {44, {6, 18}, {{44, 34, 1}, {44, 28, 1}, {44, 22, 1}, {44, 16, 1}}},  // 2
+    {70, {6, 22}, {{70, 55, 1}, {70, 44, 1}, {35, 17, 2}, {35, 13, 2}}},  // 3
+    {100, {6, 26}, {{100, 80, 1}, {50, 32, 2}, {50, 24, 2}, {25, 9, 4}}},  // 4
+    {134, {6, 30}, {{134, 108, 1}, {67, 43, 2}, {33, 15, 2}, {33, 11, 2}}},  // 5
+    {172, {6, 34}, {{86, 68, 2}, {43, 27, 4}, {43, 19, 4}, {43, 15, 4}}},  // 6
+    {196, {6, 22, 38}, {{98, 78, 2}, {49, 31, 4}, {32, 14, 2}, {39, 13, 4}}},  // 7
+    {242, {6, 24, 42}, {{121, 97, 2}, {60, 38, 2}, {40, 18, 4}, {40, 14, 4}}},  // 8
+    {292, {6, 26, 46}, {{146, 116, 2}, {58, 36, 3}, {36, 16, 4}, {36, 12, 4}}},  // 9
+    {346, {6, 28, 50}, {{86, 68, 2}, {69, 43, 4}, {43, 19, 6}, {43, 15, 6}}},  // 10
+    {404, {6, 30, 54}, {{101, 81, 4}, {80, 50, 1}, {50, 22, 4}, {36, 12, 3}}},  // 11
+    {466, {6, 32, 58}, {{116, 92, 2}, {58, 36, 6}, {46, 20, 4}, {42, 14, 7}}},  // 12
+    {532, {6, 34, 62}, {{133, 107, 4}, {59, 37, 8}, {44, 20, 8}, {33, 11, 12}}},  // 13
+    {581, {6, 26, 46, 66}, {{145, 115, 3}, {64, 40, 4}, {36, 16, 11}, {36, 12, 11}}},  // 14
+    {655, {6, 26, 48, 70}, {{109, 87, 5}, {65, 41, 5}, {54, 24, 5}, {36, 12, 11}}},  // 15
+    {733, {6, 26, 50, 74}, {{122, 98, 5}, {73, 45, 7}, {43, 19, 15}, {45, 15, 3}}},  // 16
+    {815, {6, 30, 54, 78}, {{135, 107, 1}, {74, 46, 10}, {50, 22, 1}, {42, 14, 2}}},  // 17
+    {901, {6, 30, 56, 82}, {{150, 120, 5}, {69, 43, 9}, {50, 22, 17}, {42, 14, 2}}},  // 18
+    {991, {6, 30, 58, 86}, {{141, 113, 3}, {70, 44, 3}, {47, 21, 17}, {39, 13, 9}}},  // 19
+    {1085, {6, 34, 62, 90}, {{135, 107, 3}, {67, 41, 3}, {54, 24, 15}, {43, 15, 15}}},  // 20
+    {1156, {6, 28, 50, 72, 94}, {{144, 116, 4}, {68, 42, 17}, {50, 22, 17}, {46, 16, 19}}},  // 21
+    {1258, {6, 26, 50, 74, 98}, {{139, 111, 2}, {74, 46, 17}, {54, 24, 7}, {37, 13, 34}}},  // 22
+    {1364, {6, 30, 54, 78, 102}, {{151, 121, 4}, {75, 47, 4}, {54, 24, 11}, {45, 15, 16}}},  // 23
+    {1474, {6, 28, 54, 80, 106}, {{147, 117, 6}, {73, 45, 6}, {54, 24, 11}, {46, 16, 30}}},  // 24
+    {1588, {6, 32, 58, 84, 110}, {{132, 106, 8}, {75, 47, 8}, {54, 24, 7}, {45, 15, 22}}},  // 25
+    {1706, {6, 30, 58, 86, 114}, {{142, 114, 10}, {74, 46, 19}, {50, 22, 28}, {46, 16, 33}}},  // 26
+    {1828, {6, 34, 62, 90, 118}, {{152, 122, 8}, {73, 45, 22}, {53, 23, 8}, {45, 15, 12}}},  // 27
+    {1921, {6, 26, 50, 74, 98, 122}, {{147, 117, 3}, {73, 45, 3}, {54, 24, 4}, {45, 15, 11}}},  // 28
+    {2051, {6, 30, 54, 78, 102, 126}, {{146, 116, 7}, {73, 45, 21}, {53, 23, 1}, {45, 15, 19}}},  // 29
+    {2185, {6, 26, 52, 78, 104, 130}, {{145, 115, 5}, {75, 47, 19}, {54, 24, 15}, {45, 15, 23}}},  // 30
+    {2323, {6, 30, 56, 82, 108, 134}, {{145, 115, 13}, {74, 46, 2}, {54, 24, 42}, {45, 15, 23}}},  // 31
+    {2465, {6, 34, 60, 86, 112, 138}, {{145, 115, 17}, {74, 46, 10}, {54, 24, 10}, {45, 15, 19}}},  // 32
+    {2611, {6, 30, 58, 86, 114, 142}, {{145, 115, 17}, {74, 46, 14}, {54, 24, 29}, {45, 15, 11}}},  // 33
+    {2761, {6, 34, 62, 90, 118, 146}, {{145, 115, 13}, {74, 46, 14}, {54, 24, 44}, {46, 16, 59}}},  // 34
+    {2876, {6, 30, 54, 78, 102, 126, 150}, {{151, 121, 12}, {75, 47, 12}, {54, 24, 39}, {45, 15, 22}}},  // 35
+    {3034, {6, 24, 50, 76, 102, 128, 154}, {{151, 121, 6}, {75, 47, 6}, {54, 24, 46}, {45, 15, 2}}},  // 36
+    {3196, {6, 28, 54, 80, 106, 132, 158}, {{152, 122, 17}, {74, 46, 29}, {54, 24, 49}, {45, 15, 24}}},  // 37
+    {3362, {6, 32, 58, 84, 110, 136, 162}, {{152, 122, 4}, {74, 46, 13}, {54, 24, 48}, {45, 15, 42}}},  // 38
+    {3532, {6, 26, 54, 82, 110, 138, 166}, {{147, 117, 20}, {75, 47, 40}, {54, 24, 43}, {45, 15, 10}}},  // 39
+    {3706, {6, 30, 58, 86, 114, 142, 170}, {{148, 118, 19}, {75, 47, 18}, {54, 24, 34}, {45, 15, 20}}},  // 40
+};
+
+constexpr int kMaxVersion = 40;
+constexpr int kMaxEccPerBlock = 30;
+constexpr size_t kMaxFinders = 12U;
+constexpr size_t kMaxTriples = 3U;
+// quirc's threshold: a pixel is dark when below 95% of the local mean.
+constexpr int kThresholdPercent = 5;
+// Format bits 14..13 encode the level as M=00, L=01, H=10, Q=11.
+constexpr uint8_t kEccIndexFromBits[4] = {1U, 0U, 3U, 2U};
+constexpr char kEccNames[4] = {'L', 'M', 'Q', 'H'};
+
+// GF(256) over x^8 + x^4 + x^3 + x^2 + 1, generator 2.
+struct Gf256 {
+  uint8_t exp[512];
+  uint8_t log[256];
+
+  Gf256() : exp{}, log{} {
+    uint16_t value = 1U;
+    for (int index = 0; index < 255; ++index) {
+      exp[index] = static_cast<uint8_t>(value);
+      log[value] = static_cast<uint8_t>(index);
+      value = static_cast<uint16_t>(value << 1U);
+      if ((value & 0x100U) != 0U) {
+        value ^= 0x11DU;
+      }
+    }
+    for (int index = 255; index < 512; ++index) {
+      exp[index] = exp[index - 255];
+    }
+  }
+
+  uint8_t mul(uint8_t a, uint8_t b) const {
+    return (a == 0U || b == 0U) ? 0U : exp[log[a] + log[b]];
+  }
+  uint8_t div(uint8_t a, uint8_t b) const {
+    return (a == 0U) ? 0U : exp[log[a] + 255 - log[b]];
+  }
+  uint8_t powAlpha(int power) const {
+    power %= 255;
+    return exp[(power < 0) ? power + 255 : power];
+  }
+};
+
+const Gf256& gf() {
+  static const Gf256 field;
+  return field;
+}
+
+uint8_t polyEval(const uint8_t* poly, int terms, uint8_t x) {
+  // Little-endian coefficients, Horner from the top.
+  const Gf256& field = gf();
+  uint8_t acc = 0U;
+  for (int index = terms - 1; index >= 0; --index) {
+    acc = static_cast<uint8_t>(field.mul(acc, x) ^ poly[index]);
+  }
+  return acc;
+}
+
+// Corrects one RS block in place: `n` codewords, `nsym` of them parity,
+// generator roots alpha^0..alpha^(nsym-1) (QR convention). Syndromes,
+// Berlekamp-Massey, Chien search and Forney.
+bool rsCorrect(uint8_t* block, int n, int nsym, int* out_corrected) {
+  const Gf256& field = gf();
+  uint8_t synd[kMaxEccPerBlock] = {};
+  bool clean = true;
+  for (int i = 0; i < nsym; ++i) {
+    const uint8_t x = field.powAlpha(i);
+    uint8_t acc = 0U;
+    for (int j = 0; j < n; ++j) {
+      acc = static_cast<uint8_t>(field.mul(acc, x) ^ block[j]);
+    }
+    synd[i] = acc;
+    clean = clean && (acc == 0U);
+  }
+  *out_corrected = 0;
+  if (clean) {
+    return true;
+  }
+
+  constexpr int kPoly = kMaxEccPerBlock + 2;
+  uint8_t locator[kPoly] = {1U};
+  uint8_t prev[kPoly] = {1U};
+  uint8_t scratch[kPoly] = {};
+  int degree = 0;
+  int shift = 1;
+  uint8_t prev_delta = 1U;
+  for (int k = 0; k < nsym; ++k) {
+    uint8_t delta = synd[k];
+    for (int i = 1; i <= degree; ++i) {
+      delta ^= field.mul(locator[i], synd[k - i]);
+    }
+    if (delta == 0U) {
+      ++shift;
+      continue;
+    }
+    const uint8_t coef = field.div(delta, prev_delta);
+    if (2 * degree <= k) {
+      std::memcpy(scratch, locator, sizeof(locator));
+      for (int i = 0; i + shift < kPoly; ++i) {
+        locator[i + shift] ^= field.mul(coef, prev[i]);
+      }
+      degree = k + 1 - degree;
+      std::memcpy(prev, scratch, sizeof(prev));
+      prev_delta = delta;
+      shift = 1;
+    } else {
+      for (int i = 0; i + shift < kPoly; ++i) {
+        locator[i + shift] ^= field.mul(coef, prev[i]);
+      }
+      ++shift;
+    }
+  }
+  if (degree == 0 || 2 * degree > nsym) {
+    return false;
+  }
+
+  // Evaluator: S(x) * Lambda(x) mod x^nsym.
+  uint8_t evaluator[kMaxEccPerBlock] = {};
+  for (int i = 0; i < nsym; ++i) {
+    uint8_t acc = 0U;
+    for (int j = 0; j <= i && j <= degree; ++j) {
+      acc ^= field.mul(locator[j], synd[i - j]);
+    }
+    evaluator[i] = acc;
+  }
+  // Formal derivative keeps the odd terms.
+  uint8_t derivative[kPoly] = {};
+  for (int i = 1; i <= degree; i += 2) {
+    derivative[i - 1] = locator[i];
+  }
+
+  int found = 0;
+  for (int power = 0; power < n; ++power) {
+    const uint8_t x_inv = field.powAlpha(-power);
+    if (polyEval(locator, degree + 1, x_inv) != 0U) {
+      continue;
+    }
+    const uint8_t den = polyEval(derivative, degree, x_inv);
+    if (den == 0U) {
+      return false;
+    }
+    const uint8_t num = polyEval(evaluator, nsym, x_inv);
+    block[n - 1 - power] ^= field.mul(field.powAlpha(power), field.div(num, den));
+    ++found;
+  }
+  if (found != degree) {
+    return false;
+  }
+  *out_corrected = found;
+  return true;
+}
+
+uint32_t bch15(uint32_t data) {
+  uint32_t value = data << 10U;
+  for (int bit = 14; bit >= 10; --bit) {
+    if ((value & (1UL << bit)) != 0U) {
+      value ^= 0x537UL << (bit - 10);
+    }
+  }
+  return ((data << 10U) | value) ^ 0x5412UL;
+}
+
+uint32_t bch18(uint32_t version) {
+  uint32_t value = version << 12U;
+  for (int bit = 17; bit >= 12; --bit) {
+    if ((value & (1UL << bit)) != 0U) {
+      value ^= 0x1F25UL << (bit - 12);
+    }
+  }
+  return (version << 12U) | value;
+}
+
+int popcount32(uint32_t value) {
+  int count = 0;
+  while (value != 0U) {
+    value &= value - 1U;
+    ++count;
+  }
+  return count;
+}
+
+bool maskBit(uint8_t mask, int row, int col) {
+  switch (mask) {
+    case 0:
+      return ((row + col) % 2) == 0;
+    case 1:
+      return (row % 2) == 0;
+    case 2:
+      return (col % 3) == 0;
+    case 3:
+      return ((row + col) % 3) == 0;
+    case 4:
+      return (((row / 2) + (col / 3)) % 2) == 0;
+    case 5:
+      return ((row * col) % 2 + (row * col) % 3) == 0;
+    case 6:
+      return (((row * col) % 2 + (row * col) % 3) % 2) == 0;
+    default:
+      return (((row * col) % 3 + (row + col) % 2) % 2) == 0;
+  }
+}
+
+bool finderRatio(const int counts[5]) {
+  int total = 0;
+  for (int index = 0; index < 5; ++index) {
+    if (counts[index] == 0) {
+      return false;
+    }
+    total += counts[index];
+  }
+  if (total < 7) {
+    return false;
+  }
+  // Tolerance is a little wider than 1/2 module: blur plus the dark-biased
+  // threshold fattens dark runs at the expense of light ones.
+  const float module = static_cast<float>(total) / 7.0f;
+  const float slack = module * 0.7f;
+  return std::fabs(module - counts[0]) < slack && std::fabs(module - counts[1]) < slack &&
+         std::fabs(3.0f * module - counts[2]) < 3.0f * slack && std::fabs(module - counts[3]) < slack &&
+         std::fabs(module - counts[4]) < slack;
+}
+
+float distance(float ax, float ay, float bx, float by) {
+  const float dx = ax - bx;
+  const float dy = ay - by;
+  return std::sqrt(dx * dx + dy * dy);
+}
+
+class BitReader {
+ public:
+  BitReader(const uint8_t* data, size_t bytes) : data_(data), bits_(bytes * 8U) {}
+
+  size_t remaining() const { return bits_ - pos_; }
+  bool read(int count, uint32_t* out) {
+    if (count < 0 || static_cast<size_t>(count) > remaining()) {
+      return false;
+    }
+    uint32_t value = 0U;
+    for (int index = 0; index < count; ++index) {
+      const uint8_t byte = data_[pos_ >> 3U];
+      value = (value << 1U) | ((byte >> (7U - (pos_ & 7U))) & 1U);
+      ++pos_;
+    }
+    *out = value;
+    return true;
+  }
+
+ private:
+  const uint8_t* data_;
+  size_t bits_;
+  size_t pos_ = 0U;
+};
+
+class PayloadWriter {
+ public:
+  explicit PayloadWriter(QrDecodeResult* out) : out_(out) {}
+
+  bool put(uint8_t byte) {
+    if (len_ >= QrDecodeResult::kMaxPayload) {
+      return false;
+    }
+    out_->payload[len_++] = static_cast<char>(byte);
+    return true;
+  }
+  size_t length() const { return len_; }
+
+ private:
+  QrDecodeResult* out_;
+  size_t len_ = 0U;
+};
+
+int countBits(int version, int small, int medium, int large) {
+  return (version < 10) ? small : ((version < 27) ? medium : large);
+}
+
+QrDecodeStatus decodeSegments(const uint8_t* data, size_t bytes, int version, QrDecodeResult* out) {
+  static const char kAlnum[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+  BitReader reader(data, bytes);
+  PayloadWriter writer(out);
+  while (reader.remaining() >= 4U) {
+    uint32_t mode = 0U;
+    reader.read(4, &mode);
+    if (mode == 0U) {
+      break;
+    }
+    uint32_t count = 0U;
+    uint32_t value = 0U;
+    switch (mode) {
+      case 1U: {  // numeric
+        if (!reader.read(countBits(version, 10, 12, 14), &count)) {
+          return QrDecodeStatus::kData;
+        }
+        while (count > 0U) {
+          const int digits = (count >= 3U) ? 3 : static_cast<int>(count);
+          const int bits = (digits == 3) ? 10 : ((digits == 2) ? 7 : 4);
+          if (!reader.read(bits, &value)) {
+            return QrDecodeStatus::kData;
+          }
+          char text[3] = {};
+          for (int index = digits - 1; index >= 0; --index) {
+            text[index] = static_cast<char>('0' + value % 10U);
+            value /= 10U;
+          }
+          if (value != 0U) {
+            return QrDecodeStatus::kData;
+          }
+          for (int index = 0; index < digits; ++index) {
+            if (!writer.put(static_cast<uint8_t>(text[index]))) {
+              return QrDecodeStatus::kOverflow;
+            }
+          }
+          count -= static_cast<uint32_t>(digits);
+        }
+        break;
+      }
+      case 2U: {  // alphanumeric
+        if (!reader.read(countBits(version, 9, 11, 13), &count)) {
+          return QrDecodeStatus::kData;
+        }
+        while (count > 0U) {
+          const bool pair = count >= 2U;
+          if (!reader.read(pair ? 11 : 6, &value)) {
+            return QrDecodeStatus::kData;
+          }
+          if (pair) {
+            if (value >= 45U * 45U || !writer.put(static_cast<uint8_t>(kAlnum[value / 45U]))) {
+              return (value >= 45U * 45U) ? QrDecodeStatus::kData : QrDecodeStatus::kOverflow;
+            }
+            value %= 45U;
+          } else if (value >= 45U) {
+            return QrDecodeStatus::kData;
+          }
+          if (!writer.put(static_cast<uint8_t>(kAlnum[value]))) {
+            return QrDecodeStatus::kOverflow;
+          }
+          count -= pair ? 2U : 1U;
+        }
+        break;
+      }
+      case 4U: {  // 8-bit bytes
+        if (!reader.read(countBits(version, 8, 16, 16), &count)) {
+          return QrDecodeStatus::kData;
+        }
+        for (; count > 0U; --count) {
+          if (!reader.read(8, &value)) {
+            return QrDecodeStatus::kData;
+          }
+          if (!writer.put(static_cast<uint8_t>(value))) {
+            return QrDecodeStatus::kOverflow;
+          }
+        }
+        break;
+      }
+      case 8U: {  // kanji, emitted as Shift JIS
+        if (!reader.read(countBits(version, 8, 10, 12), &count)) {
+          return QrDecodeStatus::kData;
+        }
+        for (; count > 0U; --count) {
+          if (!reader.read(13, &value)) {
+            return QrDecodeStatus::kData;
+          }
+          uint32_t sjis = ((value / 0xC0U) << 8U) | (value % 0xC0U);
+          sjis += (sjis < 0x1F00U) ? 0x8140U : 0xC140U;
+          if (!writer.put(static_cast<uint8_t>(sjis >> 8U)) || !writer.put(static_cast<uint8_t>(sjis & 0xFFU))) {
+            return QrDecodeStatus::kOverflow;
+          }
+        }
+        break;
+      }
+      case 7U: {  // ECI designator, ignored (payload bytes passed through)
+        if (!reader.read(8, &value)) {
+          return QrDecodeStatus::kData;
+        }
+        const int extra = ((value & 0x80U) == 0U) ? 0 : (((value & 0xC0U) == 0x80U) ? 8 : 16);
+        if (extra > 0 && !reader.read(extra, &value)) {
+          return QrDecodeStatus::kData;
+        }
+        break;
+      }
+      case 3U:  // structured append header
+        if (!reader.read(16, &value)) {
+          return QrDecodeStatus::kData;
+        }
+        break;
+      case 5U:  // FNC1, first position
+        break;
+      case 9U:  // FNC1, second position (application indicator)
+        if (!reader.read(8, &value)) {
+          return QrDecodeStatus::kData;
+        }
+        break;
+      default:
+        return QrDecodeStatus::kData;
+    }
+  }
+  out->payload_len = static_cast<uint16_t>(writer.length());
+  out->payload[writer.length()] = '\0';
+  return QrDecodeStatus::kOk;
+}
+
+}  // namespace
+
+const char* QrDecoder::statusName(QrDecodeStatus status) {
+  switch (status) {
+    case QrDecodeStatus::kOk:
+      return "ok";
+    case QrDecodeStatus::kInvalidArgument:
+      return "invalid_argument";
+    case QrDecodeStatus::kNoFinder:
+      return "no_finder";
+    case QrDecodeStatus::kNoGrid:
+      return "no_grid";
+    case QrDecodeStatus::kFormat:
+      return "format";
+    case QrDecodeStatus::kEcc:
+      return "ecc";
+    case QrDecodeStatus::kData:
+      return "data";
+    case QrDecodeStatus::kOverflow:
+      return "overflow";
+  }
+  return "unknown";
+}
+
+QrDecodeStatus QrDecoder::decode(const uint8_t* luma,
+                                 int width,
+                                 int height,
+                                 int stride,
+                                 const QrRoi& roi,
+                                 QrDecodeResult* out) {
+  if (luma == nullptr || out == nullptr || width < kMinSide || height < kMinSide || stride < width) {
+    return QrDecodeStatus::kInvalidArgument;
+  }
+  int x0 = 0;
+  int y0 = 0;
+  int x1 = width;
+  int y1 = height;
+  if (roi.w > 0 && roi.h > 0) {
+    x0 = std::max(0, roi.x);
+    y0 = std::max(0, roi.y);
+    x1 = std::min(width, roi.x + roi.w);
+    y1 = std::min(height, roi.y + roi.h);
+  }
+  if (x1 - x0 < kMinSide || y1 - y0 < kMinSide) {
+    return QrDecodeStatus::kInvalidArgument;
+  }
+  *out = QrDecodeResult();
+  roi_x_ = x0;
+  roi_y_ = y0;
+  roi_w_ = x1 - x0;
+  roi_h_ = y1 - y0;
+  threshold_window_ = std::max(8, width / 8);
+  binarize(luma + static_cast<size_t>(y0) * stride + x0, stride);
+  findFinders();
+  if (finders_.size() < 3U) {
+    return QrDecodeStatus::kNoFinder;
+  }
+
+  // Rank finder triples by how close they are to an isosceles right angle
+  // with consistent module sizes; perspective only bends this a little.
+  struct Triple {
+    float score;
+    uint8_t tl;
+    uint8_t tr;
+    uint8_t bl;
+  };
+  Triple best[kMaxTriples] = {};
+  size_t best_count = 0U;
+  const size_t count = std::min(finders_.size(), kMaxFinders);
+  for (size_t i = 0U; i < count; ++i) {
+    for (size_t j = i + 1U; j < count; ++j) {
+      for (size_t k = j + 1U; k < count; ++k) {
+        const Finder* f[3] = {&finders_[i], &finders_[j], &finders_[k]};
+        const float min_module = std::min({f[0]->module, f[1]->module, f[2]->module});
+        const float max_module = std::max({f[0]->module, f[1]->module, f[2]->module});
+        if (max_module > 1.6f * min_module) {
+          continue;
+        }
+        // Vertex opposite the longest side is the top-left finder.
+        const float d01 = distance(f[0]->x, f[0]->y, f[1]->x, f[1]->y);
+        const float d02 = distance(f[0]->x, f[0]->y, f[2]->x, f[2]->y);
+        const float d12 = distance(f[1]->x, f[1]->y, f[2]->x, f[2]->y);
+        int corner = 0;
+        float hyp = d12;
+        float a = d01;
+        float b = d02;
+        if (d02 > hyp) {
+          corner = 1;
+          hyp = d02;
+          a = d01;
+          b = d12;
+        }
+        if (d01 > hyp) {
+          corner = 2;
+          hyp = d01;
+          a = d02;
+          b = d12;
+        }
+        const float module = (f[0]->module + f[1]->module + f[2]->module) / 3.0f;
+        if (std::min(a, b) < 9.0f * module) {
+          continue;
+        }
+        const float score = std::fabs(hyp * hyp - a * a - b * b) / (hyp * hyp) + std::fabs(a - b) / std::max(a, b);
+        if (score > 0.6f) {
+          continue;
+        }
+        const uint8_t ids[3] = {static_cast<uint8_t>(i), static_cast<uint8_t>(j), static_cast<uint8_t>(k)};
+        Triple candidate = {score, ids[corner], ids[(corner + 1) % 3], ids[(corner + 2) % 3]};
+        const Finder& tl = finders_[candidate.tl];
+        const Finder& tr = finders_[candidate.tr];
+        const Finder& bl = finders_[candidate.bl];
+        // Clockwise in image coordinates (y down): TL -> TR -> BL.
+        const float cross = (tr.x - tl.x) * (bl.y - tl.y) - (tr.y - tl.y) * (bl.x - tl.x);
+        if (cross < 0.0f) {
+          std::swap(candidate.tr, candidate.bl);
+        }
+        size_t slot = best_count;
+        if (best_count < kMaxTriples) {
+          ++best_count;
+        } else if (score >= best[kMaxTriples - 1U].score) {
+          continue;
+        } else {
+          slot = kMaxTriples - 1U;
+        }
+        while (slot > 0U && best[slot - 1U].score > score) {
+          best[slot] = best[slot - 1U];
+          --slot;
+        }
+        best[slot] = candidate;
+      }
+    }
+  }
+  if (best_count == 0U) {
+    return QrDecodeStatus::kNoFinder;
+  }
+
+  QrDecodeStatus status = QrDecodeStatus::kNoGrid;
+  for (size_t index = 0U; index < best_count; ++index) {
+    const QrDecodeStatus attempt =
+        decodeTriple(finders_[best[index].tl], finders_[best[index].tr], finders_[best[index].bl], out);
+    if (attempt == QrDecodeStatus::kOk) {
+      return attempt;
+    }
+    // Report the deepest stage reached.
+    if (static_cast<uint8_t>(attempt) > static_cast<uint8_t>(status)) {
+      status = attempt;
+    }
+  }
+  return status;
+}
+
+void QrDecoder::binarize(const uint8_t* luma, int stride) {
+  // quirc's adaptive threshold: two exponential moving averages per row, run
+  // in opposite directions (and alternating per row) so the local mean has
+  // no directional lag.
+  const int w = roi_w_;
+  const int h = roi_h_;
+  const int s = threshold_window_;
+  bin_.resize(static_cast<size_t>(w) * h);
+  row_avg_.resize(static_cast<size_t>(w));
+  int avg_w = 0;
+  int avg_u = 0;
+  for (int y = 0; y < h; ++y) {
+    const uint8_t* row = luma + static_cast<size_t>(y) * stride;
+    int32_t* avg = row_avg_.data();
+    std::fill(avg, avg + w, 0);
+    for (int x = 0; x < w; ++x) {
+      int wi = w - 1 - x;
+      int ui = x;
+      if ((y & 1) != 0) {
+        wi = x;
+        ui = w - 1 - x;
+      }
+      avg_w = (avg_w * (s - 1)) / s + row[wi];
+      avg_u = (avg_u * (s - 1)) / s + row[ui];
+      avg[wi] += avg_w;
+      avg[ui] += avg_u;
+    }
+    uint8_t* out = &bin_[static_cast<size_t>(y) * w];
+    for (int x = 0; x < w; ++x) {
+      out[x] = (static_cast<int32_t>(row[x]) * 200 * s < avg[x] * (100 - kThresholdPercent)) ? 1U : 0U;
+    }
+  }
+}
+
+bool QrDecoder::isDark(int x, int y) const {
+  if (x < 0 || y < 0 || x >= roi_w_ || y >= roi_h_) {
+    return false;
+  }
+  return bin_[static_cast<size_t>(y) * roi_w_ + x] != 0U;  // 2 = dark, visited
+}
+
+bool QrDecoder::crossCheck(float cx,
+                           float cy,
+                           bool vertical,
+                           float module_hint,
+                           float* out_center,
+                           float* out_module) const {
+  const int px = static_cast<int>(cx);
+  const int py = static_cast<int>(cy);
+  const int limit = static_cast<int>(module_hint * 5.0f) + 2;
+  auto dark = [&](int offset) {
+    return vertical ? isDark(px, py + offset) : isDark(px + offset, py);
+  };
+  if (!dark(0)) {
+    return false;
+  }
+  int counts[5] = {};
+  // Walk backwards through the centre, light ring and outer ring.
+  int pos = 0;
+  while (dark(pos) && counts[2] <= limit) {
+    ++counts[2];
+    --pos;
+  }
+  while (!dark(pos) && counts[1] <= limit && (vertical ? py + pos >= 0 : px + pos >= 0)) {
+    ++counts[1];
+    --pos;
+  }
+  while (dark(pos) && counts[0] <= limit) {
+    ++counts[0];
+    --pos;
+  }
+  pos = 1;
+  while (dark(pos) && counts[2] <= 3 * limit) {
+    ++counts[2];
+    ++pos;
+  }
+  const int extent = vertical ? roi_h_ : roi_w_;
+  const int origin = vertical ? py : px;
+  while (!dark(pos) && counts[3] <= limit && origin + pos < extent) {
+    ++counts[3];
+    ++pos;
+  }
+  while (dark(pos) && counts[4] <= limit) {
+    ++counts[4];
+    ++pos;
+  }
+  if (!finderRatio(counts)) {
+    return false;
+  }
+  const int total = counts[0] + counts[1] + counts[2] + counts[3] + counts[4];
+  if (std::fabs(static_cast<float>(total) - 7.0f * module_hint) > 3.0f * module_hint) {
+    return false;
+  }
+  const float end = static_cast<float>(origin + pos);
+  *out_center = end - counts[4] - counts[3] - counts[2] / 2.0f;
+  *out_module = static_cast<float>(total) / 7.0f;
+  return true;
+}
+
+void QrDecoder::addFinder(float x, float y, float module) {
+  for (Finder& finder : finders_) {
+    if (std::fabs(finder.x - x) <= finder.module * 1.5f && std::fabs(finder.y - y) <= finder.module * 1.5f &&
+        std::fabs(finder.module - module) <= finder.module * 0.5f) {
+      const float weight = static_cast<float>(finder.hits);
+      finder.x = (finder.x * weight + x) / (weight + 1.0f);
+      finder.y = (finder.y * weight + y) / (weight + 1.0f);
+      finder.module = (finder.module * weight + module) / (weight + 1.0f);
+      if (finder.hits < 0xFFFFU) {
+        ++finder.hits;
+      }
+      return;
+    }
+  }
+  finders_.push_back(Finder{x, y, module, 1U});
+}
+
+void QrDecoder::findFinders() {
+  finders_.clear();
+  const int w = roi_w_;
+  for (int y = 0; y < roi_h_; ++y) {
+    const uint8_t* row = &bin_[static_cast<size_t>(y) * w];
+    int counts[5] = {};
+    int state = 0;
+    for (int x = 0; x <= w; ++x) {
+      const bool dark = (x < w) && row[x] != 0U;
+      if (dark) {
+        if ((state & 1) != 0) {
+          ++state;
+        }
+        ++counts[state];
+        continue;
+      }
+      if ((state & 1) != 0) {
+        ++counts[state];
+        continue;
+      }
+      if (state < 4) {
+        ++state;
+        ++counts[state];
+        continue;
+      }
+      if (finderRatio(counts)) {
+        const int total = counts[0] + counts[1] + counts[2] + counts[3] + counts[4];
+        const float module = static_cast<float>(total) / 7.0f;
+        const float cx = static_cast<float>(x) - counts[4] - counts[3] - counts[2] / 2.0f;
+        float cy = 0.0f;
+        float v_module = 0.0f;
+        float hx = 0.0f;
+        float h_module = 0.0f;
+        if (crossCheck(cx, static_cast<float>(y), true, module, &cy, &v_module) &&
+            crossCheck(cx, cy, false, v_module, &hx, &h_module)) {
+          addFinder(hx, cy, (v_module + h_module) / 2.0f);
+        }
+      }
+      counts[0] = counts[2];
+      counts[1] = counts[3];
+      counts[2] = counts[4];
+      counts[3] = 1;
+      counts[4] = 0;
+      state = 3;
+    }
+  }
+  for (Finder& finder : finders_) {
+    refineFinder(&finder);
+  }
+  std::stable_sort(finders_.begin(), finders_.end(), [](const Finder& a, const Finder& b) {
+    return a.hits > b.hits;
+  });
+}
+
+bool QrDecoder::floodComponent(int sx, int sy, size_t max_area, QrPoint* centroid, size_t* area) {
+  // Dark pixels are 1 in bin_; visited ones become 2 until restoreFill().
+  if (sx < 0 || sy < 0 || sx >= roi_w_ || sy >= roi_h_) {
+    return false;
+  }
+  const uint32_t seed = static_cast<uint32_t>(sy) * static_cast<uint32_t>(roi_w_) + static_cast<uint32_t>(sx);
+  if (bin_[seed] != 1U) {
+    return false;
+  }
+  stack_.clear();
+  stack_.push_back(seed);
+  bin_[seed] = 2U;
+  const size_t first = fill_.size();
+  double sum_x = 0.0;
+  double sum_y = 0.0;
+  while (!stack_.empty()) {
+    const uint32_t index = stack_.back();
+    stack_.pop_back();
+    fill_.push_back(index);
+    const int x = static_cast<int>(index % static_cast<uint32_t>(roi_w_));
+    const int y = static_cast<int>(index / static_cast<uint32_t>(roi_w_));
+    sum_x += x;
+    sum_y += y;
+    if (fill_.size() - first > max_area) {
+      fill_.insert(fill_.end(), stack_.begin(), stack_.end());
+      stack_.clear();
+      return false;
+    }
+    const int nx[4] = {x - 1, x + 1, x, x};
+    const int ny[4] = {y, y, y - 1, y + 1};
+    for (int n = 0; n < 4; ++n) {
+      if (nx[n] < 0 || ny[n] < 0 || nx[n] >= roi_w_ || ny[n] >= roi_h_) {
+        continue;
+      }
+      const uint32_t next = static_cast<uint32_t>(ny[n]) * static_cast<uint32_t>(roi_w_) + static_cast<uint32_t>(nx[n]);
+      if (bin_[next] == 1U) {
+        bin_[next] = 2U;
+        stack_.push_back(next);
+      }
+    }
+  }
+  const size_t count = fill_.size() - first;
+  centroid->x = static_cast<float>(sum_x / count) + 0.5f;
+  centroid->y = static_cast<float>(sum_y / count) + 0.5f;
+  *area = count;
+  return true;
+}
+
+void QrDecoder::restoreFill() {
+  for (uint32_t index : fill_) {
+    bin_[index] = 1U;
+  }
+  fill_.clear();
+}
+
+void QrDecoder::refineFinder(Finder* finder) {
+  // Run lengths are stretched by 1/cos(angle) on rotated symbols; the
+  // centroid and area of the 3x3-module centre stone (isolated by the light
+  // ring) give the centre and module size at any rotation.
+  const float expected = finder->module * finder->module * 9.0f;
+  QrPoint centroid;
+  size_t area = 0U;
+  const bool ok = floodComponent(static_cast<int>(finder->x), static_cast<int>(finder->y),
+                                 static_cast<size_t>(expected * 3.0f) + 16U, &centroid, &area);
+  restoreFill();
+  if (!ok || static_cast<float>(area) < expected * 0.3f) {
+    return;
+  }
+  finder->x = centroid.x;
+  finder->y = centroid.y;
+  finder->module = std::sqrt(static_cast<float>(area) / 9.0f);
+}
+
+bool QrDecoder::findAlignment(float ex, float ey, const QrPoint& axis_u, const QrPoint& axis_v, QrPoint* out) {
+  // Alignment pattern: 1-module dark centre, light ring, dark ring (5x5).
+  // Candidates are dark blobs of about one module near the estimate; the
+  // rings are sampled along the symbol axes so rotation does not matter.
+  // The nearest candidate that passes wins.
+  const float module = std::sqrt(std::fabs(axis_u.x * axis_v.y - axis_u.y * axis_v.x));
+  const int radius = static_cast<int>(module * 4.0f) + 2;
+  const int cx = static_cast<int>(ex);
+  const int cy = static_cast<int>(ey);
+  const size_t max_area = static_cast<size_t>(module * module * 2.5f) + 4U;
+  float best_dist = 1e30f;
+  bool found = false;
+  for (int y = cy - radius; y <= cy + radius; ++y) {
+    for (int x = cx - radius; x <= cx + radius; ++x) {
+      QrPoint centre;
+      size_t area = 0U;
+      if (!isDark(x, y) || !floodComponent(x, y, max_area, &centre, &area)) {
+        continue;
+      }
+      if (static_cast<float>(area) < module * module * 0.3f) {
+        continue;
+      }
+      bool ok = true;
+      for (int dv = -1; dv <= 1 && ok; ++dv) {
+        for (int du = -1; du <= 1 && ok; ++du) {
+          if (du == 0 && dv == 0) {
+            continue;
+          }
+          const float lx = centre.x + du * axis_u.x + dv * axis_v.x;
+          const float ly = centre.y + du * axis_u.y + dv * axis_v.y;
+          const float rx = centre.x + 2.0f * (du * axis_u.x + dv * axis_v.x);
+          const float ry = centre.y + 2.0f * (du * axis_u.y + dv * axis_v.y);
+          ok = !isDark(static_cast<int>(std::floor(lx)), static_cast<int>(std::floor(ly))) &&
+               isDark(static_cast<int>(std::floor(rx)), static_cast<int>(std::floor(ry)));
+        }
+      }
+      if (!ok) {
+        continue;
+      }
+      const float dist = distance(centre.x, centre.y, ex, ey);
+      if (dist < best_dist) {
+        best_dist = dist;
+        *out = centre;
+        found = true;
+      }
+    }
+  }
+  restoreFill();
+  return found;
+}
+
+bool QrDecoder::setupTransform(const QrPoint src[4], const QrPoint dst[4]) {
+  // Solve the 8 homography coefficients (h[8] fixed at 1) with partial
+  // pivoting; src is module space, dst ROI pixels.
+  double m[8][9] = {};
+  for (int i = 0; i < 4; ++i) {
+    const double u = src[i].x;
+    const double v = src[i].y;
+    const double x = dst[i].x;
+    const double y = dst[i].y;
+    double* rx = m[2 * i];
+    double* ry = m[2 * i + 1];
+    rx[0] = u;
+    rx[1] = v;
+    rx[2] = 1.0;
+    rx[6] = -u * x;
+    rx[7] = -v * x;
+    rx[8] = x;
+    ry[3] = u;
+    ry[4] = v;
+    ry[5] = 1.0;
+    ry[6] = -u * y;
+    ry[7] = -v * y;
+    ry[8] = y;
+  }
+  for (int col = 0; col < 8; ++col) {
+    int pivot = col;
+    for (int row = col + 1; row < 8; ++row) {
+      if (std::fabs(m[row][col]) > std::fabs(m[pivot][col])) {
+        pivot = row;
+      }
+    }
+    if (std::fabs(m[pivot][col]) < 1e-9) {
+      return false;
+    }
+    if (pivot != col) {
+      for (int k = 0; k < 9; ++k) {
+        std::swap(m[pivot][k], m[col][k]);
+      }
+    }
+    for (int row = 0; row < 8; ++row) {
+      if (row == col) {
+        continue;
+      }
+      const double factor = m[row][col] / m[col][col];
+      if (factor == 0.0) {
+        continue;
+      }
+      for (int k = col; k < 9; ++k) {
+        m[row][k] -= factor * m[col][k];
+      }
+    }
+  }
+  for (int i = 0; i < 8; ++i) {
+    h_[i] = m[i][8] / m[i][i];
+  }
+  return true;
+}
+
+QrPoint QrDecoder::project(float u, float v) const {
+  const double den = h_[6] * u + h_[7] * v + 1.0;
+  QrPoint p;
+  p.x = static_cast<float>((h_[0] * u + h_[1] * v + h_[2]) / den);
+  p.y = static_cast<float>((h_[3] * u + h_[4] * v + h_[5]) / den);
+  return p;
+}
+
+bool QrDecoder::readGrid(int dim) {
+  grid_dim_ = dim;
+  grid_.resize(static_cast<size_t>(dim) * dim);
+  for (int row = 0; row < dim; ++row) {
+    for (int col = 0; col < dim; ++col) {
+      const QrPoint p = project(col + 0.5f, row + 0.5f);
+      grid_[static_cast<size_t>(row) * dim + col] =
+          isDark(static_cast<int>(std::floor(p.x)), static_cast<int>(std::floor(p.y))) ? 1U : 0U;
+    }
+  }
+  return true;
+}
+
+float QrDecoder::timingScore(int dim) const {
+  int hits = 0;
+  int total = 0;
+  for (int index = 8; index < dim - 8; ++index) {
+    const bool expected = (index % 2) == 0;
+    hits += (gridBit(6, index) == expected) ? 1 : 0;
+    hits += (gridBit(index, 6) == expected) ? 1 : 0;
+    total += 2;
+  }
+  return (total > 0) ? static_cast<float>(hits) / total : 0.0f;
+}
+
+int QrDecoder::readVersionInfo(int dim) const {
+  uint32_t top_right = 0U;
+  uint32_t bottom_left = 0U;
+  for (int i = 17; i >= 0; --i) {
+    top_right = (top_right << 1U) | (gridBit(i / 3, dim - 11 + i % 3) ? 1U : 0U);
+    bottom_left = (bottom_left << 1U) | (gridBit(dim - 11 + i % 3, i / 3) ? 1U : 0U);
+  }
+  int best_version = -1;
+  int best_distance = 4;
+  for (int version = 7; version <= kMaxVersion; ++version) {
+    const uint32_t code = bch18(static_cast<uint32_t>(version));
+    const int distance = std::min(popcount32(code ^ top_right), popcount32(code ^ bottom_left));
+    if (distance < best_distance) {
+      best_distance = distance;
+      best_version = version;
+    }
+  }
+  return best_version;
+}
+
+bool QrDecoder::ringEdge(const Finder& finder, const QrPoint& normal, QrPoint* point, QrPoint* direction) {
+  // Outer edge of a finder's 7x7 ring on the side `normal` points to: flood
+  // the ring from three modules out of the centre, take the outermost pixel
+  // per 1-px slice along the edge and least-squares fit a line through them
+  // (corners excluded).
+  const float module = finder.module;
+  const float expected = module * module * 24.0f;
+  QrPoint seed = {finder.x + normal.x * module * 3.0f, finder.y + normal.y * module * 3.0f};
+  for (int step = 0; step < 3 && !isDark(static_cast<int>(seed.x), static_cast<int>(seed.y)); ++step) {
+    seed = {finder.x + normal.x * module * (2.6f + 0.3f * step), finder.y + normal.y * module * (2.6f + 0.3f * step)};
+  }
+  QrPoint centroid;
+  size_t area = 0U;
+  const size_t first = fill_.size();
+  const bool ok = floodComponent(static_cast<int>(seed.x), static_cast<int>(seed.y),
+                                 static_cast<size_t>(expected * 2.0f) + 16U, &centroid, &area);
+  if (!ok || static_cast<float>(area) < expected * 0.4f ||
+      distance(centroid.x, centroid.y, finder.x, finder.y) > module * 1.5f) {
+    restoreFill();
+    return false;
+  }
+  const QrPoint tangent = {-normal.y, normal.x};
+  constexpr int kSlices = 64;
+  const float reach = std::min(module * 2.5f, kSlices / 2.0f - 1.0f);
+  float outer[kSlices];
+  std::fill(outer, outer + kSlices, -1e30f);
+  for (size_t index = first; index < fill_.size(); ++index) {
+    const float dx = static_cast<float>(fill_[index] % static_cast<uint32_t>(roi_w_)) + 0.5f - finder.x;
+    const float dy = static_cast<float>(fill_[index] / static_cast<uint32_t>(roi_w_)) + 0.5f - finder.y;
+    const float t = dx * tangent.x + dy * tangent.y;
+    if (std::fabs(t) > reach) {
+      continue;
+    }
+    const int slice = static_cast<int>(std::floor(t)) + kSlices / 2;
+    outer[slice] = std::max(outer[slice], dx * normal.x + dy * normal.y);
+  }
+  restoreFill();
+  double st = 0.0;
+  double sn = 0.0;
+  double stt = 0.0;
+  double stn = 0.0;
+  int count = 0;
+  for (int slice = 0; slice < kSlices; ++slice) {
+    if (outer[slice] < module * 2.0f) {
+      continue;  // slice missed the outer edge
+    }
+    const double t = slice - kSlices / 2 + 0.5;
+    st += t;
+    sn += outer[slice];
+    stt += t * t;
+    stn += t * outer[slice];
+    ++count;
+  }
+  const double den = count * stt - st * st;
+  if (count < 3 || std::fabs(den) < 1e-6) {
+    return false;
+  }
+  const double slope = (count * stn - st * sn) / den;
+  const double offset = (sn - slope * st) / count + 0.5;  // pixel centre -> edge
+  point->x = finder.x + static_cast<float>(offset) * normal.x;
+  point->y = finder.y + static_cast<float>(offset) * normal.y;
+  direction->x = tangent.x + static_cast<float>(slope) * normal.x;
+  direction->y = tangent.y + static_cast<float>(slope) * normal.y;
+  return true;
+}
+
+bool QrDecoder::outerCorner(const Finder& tl, const Finder& tr, const Finder& bl, QrPoint* out) {
+  const float len_u = distance(tl.x, tl.y, tr.x, tr.y);
+  const float len_v = distance(tl.x, tl.y, bl.x, bl.y);
+  if (len_u <= 0.0f || len_v <= 0.0f) {
+    return false;
+  }
+  const QrPoint unit_u = {(tr.x - tl.x) / len_u, (tr.y - tl.y) / len_u};
+  const QrPoint unit_v = {(bl.x - tl.x) / len_v, (bl.y - tl.y) / len_v};
+  QrPoint p;
+  QrPoint r;
+  QrPoint q;
+  QrPoint t;
+  if (!ringEdge(tr, unit_u, &p, &r) || !ringEdge(bl, unit_v, &q, &t)) {
+    return false;
+  }
+  const float den = r.x * t.y - r.y * t.x;
+  if (std::fabs(den) < 1e-3f) {
+    return false;
+  }
+  const float k = ((q.x - p.x) * t.y - (q.y - p.y) * t.x) / den;
+  out->x = p.x + k * r.x;
+  out->y = p.y + k * r.y;
+  // Reject wild intersections (nearly parallel edges, broken rings).
+  const QrPoint guess = {tr.x + bl.x - tl.x, tr.y + bl.y - tl.y};
+  return distance(out->x, out->y, guess.x, guess.y) < 0.5f * std::min(len_u, len_v) + 8.0f * tl.module;
+}
+
+int QrDecoder::fitness(int version) const {
+  // Agreement between the current transform and the modules every symbol of
+  // this version must have: timing lines, finder cores and alignment
+  // patterns.
+  const int dim = 17 + 4 * version;
+  auto sample = [&](int row, int col) {
+    const QrPoint p = project(col + 0.5f, row + 0.5f);
+    return isDark(static_cast<int>(std::floor(p.x)), static_cast<int>(std::floor(p.y)));
+  };
+  int score = 0;
+  for (int index = 8; index < dim - 8; ++index) {
+    const bool expected = (index % 2) == 0;
+    score += (sample(6, index) == expected) ? 1 : 0;
+    score += (sample(index, 6) == expected) ? 1 : 0;
+  }
+  const int finder_origin[3][2] = {{0, 0}, {0, dim - 7}, {dim - 7, 0}};
+  for (const auto& origin : finder_origin) {
+    for (int r = 0; r < 7; ++r) {
+      for (int c = 0; c < 7; ++c) {
+        const int ring = std::max(std::abs(r - 3), std::abs(c - 3));
+        score += (sample(origin[0] + r, origin[1] + c) == (ring != 2)) ? 1 : 0;
+      }
+    }
+  }
+  const VersionInfo& info = kVersions[version - 1];
+  int count = 0;
+  while (count < 7 && info.align[count] != 0U) {
+    ++count;
+  }
+  for (int i = 0; i < count; ++i) {
+    for (int j = 0; j < count; ++j) {
+      if ((i == 0 && j == 0) || (i == 0 && j == count - 1) || (i == count - 1 && j == 0)) {
+        continue;
+      }
+      for (int r = -2; r <= 2; ++r) {
+        for (int c = -2; c <= 2; ++c) {
+          const int ring = std::max(std::abs(r), std::abs(c));
+          score += (sample(info.align[i] + r, info.align[j] + c) == (ring != 1)) ? 1 : 0;
+        }
+      }
+    }
+  }
+  return score;
+}
+
+void QrDecoder::jiggle(const QrPoint src[4], QrPoint dst[4], int version, float module) {
+  // quirc-style refinement: nudge each image-side control point while the
+  // function-pattern fitness improves, halving the step every pass. Fixes
+  // perspective the parallelogram corner misses and finder centre bias.
+  int best = fitness(version);
+  float step = module * 0.5f;
+  for (int pass = 0; pass < 5; ++pass) {
+    for (int trial = 0; trial < 16; ++trial) {
+      QrPoint& point = dst[trial >> 2];
+      float& coord = ((trial & 2) != 0) ? point.y : point.x;
+      const float old = coord;
+      coord = old + (((trial & 1) != 0) ? step : -step);
+      if (setupTransform(src, dst)) {
+        const int score = fitness(version);
+        if (score > best) {
+          best = score;
+          continue;
+        }
+      }
+      coord = old;
+    }
+    step *= 0.5f;
+  }
+  setupTransform(src, dst);
+}
+
+QrDecodeStatus QrDecoder::decodeTriple(const Finder& tl, const Finder& tr, const Finder& bl, QrDecodeResult* out) {
+  const float module = (tl.module + tr.module + bl.module) / 3.0f;
+  const float across = (distance(tl.x, tl.y, tr.x, tr.y) + distance(tl.x, tl.y, bl.x, bl.y)) / (2.0f * module);
+  const int estimate = static_cast<int>(std::lround((across + 7.0f - 17.0f) / 4.0f));
+  int candidates[3] = {estimate, estimate + 1, estimate - 1};
+  QrDecodeStatus status = QrDecodeStatus::kNoGrid;
+  bool version_checked = false;
+  for (int attempt = 0; attempt < 3; ++attempt) {
+    const int version = candidates[attempt];
+    if (version < 1 || version > kMaxVersion) {
+      continue;
+    }
+    const int dim = 17 + 4 * version;
+    const float span = static_cast<float>(dim - 7);
+    QrPoint src[4] = {{3.5f, 3.5f}, {dim - 3.5f, 3.5f}, {3.5f, dim - 3.5f}, {}};
+    QrPoint dst[4] = {{tl.x, tl.y}, {tr.x, tr.y}, {bl.x, bl.y}, {}};
+    // Fourth point: the bottom-right alignment pattern when there is one.
+    // Without it (version 1, or a damaged pattern) try the parallelogram
+    // corner, exact for frontal views, then the corner where the outer edges
+    // of the top-right and bottom-left finder rings meet, which follows
+    // perspective but is only as good as the traced edges.
+    QrPoint fourth_src[10] = {};
+    QrPoint fourth_dst[10] = {};
+    int hypotheses = 0;
+    const QrPoint axis_u = {(tr.x - tl.x) / span, (tr.y - tl.y) / span};
+    const QrPoint axis_v = {(bl.x - tl.x) / span, (bl.y - tl.y) / span};
+    if (version >= 2) {
+      const float k = (span - 3.0f) / span;
+      const float ex = tl.x + k * (tr.x - tl.x + bl.x - tl.x);
+      const float ey = tl.y + k * (tr.y - tl.y + bl.y - tl.y);
+      if (findAlignment(ex, ey, axis_u, axis_v, &fourth_dst[0])) {
+        fourth_src[0] = {dim - 6.5f, dim - 6.5f};
+        hypotheses = 1;
+      }
+    }
+    if (hypotheses == 0) {
+      fourth_src[0] = {dim - 3.5f, dim - 3.5f};
+      fourth_dst[0] = {tr.x + bl.x - tl.x, tr.y + bl.y - tl.y};
+      hypotheses = 1;
+      QrPoint corner;
+      if (outerCorner(tl, tr, bl, &corner)) {
+        // Edge tracing on a staircase boundary is biased by a fraction of a
+        // module; Reed-Solomon arbitrates a small ring around the estimate.
+        static constexpr int8_t kRing[9][2] = {{0, 0}, {-1, 0}, {1, 0}, {0, -1}, {0, 1},
+                                               {-1, -1}, {1, 1}, {-1, 1}, {1, -1}};
+        for (const auto& offset : kRing) {
+          fourth_src[hypotheses] = {static_cast<float>(dim), static_cast<float>(dim)};
+          fourth_dst[hypotheses] = {corner.x + 0.6f * (offset[0] * axis_u.x + offset[1] * axis_v.x),
+                                    corner.y + 0.6f * (offset[0] * axis_u.y + offset[1] * axis_v.y)};
+          ++hypotheses;
+        }
+      }
+    }
+    int redirect = 0;
+    for (int hypothesis = 0; hypothesis < hypotheses; ++hypothesis) {
+      src[3] = fourth_src[hypothesis];
+      dst[3] = fourth_dst[hypothesis];
+      if (!setupTransform(src, dst)) {
+        continue;
+      }
+      jiggle(src, dst, version, module);
+      readGrid(dim);
+      if (version >= 7 && !version_checked) {
+        version_checked = true;
+        const int read = readVersionInfo(dim);
+        if (read > 0 && read != version) {
+          // Trust the BCH-protected version field over the geometry estimate.
+          redirect = read;
+          break;
+        }
+      }
+      if (timingScore(dim) < 0.7f) {
+        continue;
+      }
+      const QrDecodeStatus result = decodeGrid(version, out);
+      if (result == QrDecodeStatus::kOk) {
+        const QrPoint corners[4] = {project(0.0f, 0.0f),
+                                    project(static_cast<float>(dim), 0.0f),
+                                    project(static_cast<float>(dim), static_cast<float>(dim)),
+                                    project(0.0f, static_cast<float>(dim))};
+        for (int index = 0; index < 4; ++index) {
+          out->corners[index].x = corners[index].x + roi_x_;
+          out->corners[index].y = corners[index].y + roi_y_;
+        }
+        return result;
+      }
+      if (static_cast<uint8_t>(result) > static_cast<uint8_t>(status)) {
+        status = result;
+      }
+    }
+    if (redirect > 0) {
+      candidates[attempt] = redirect;
+      --attempt;
+    }
+  }
+  return status;
+}
+
+QrDecodeStatus QrDecoder::decodeGrid(int version, QrDecodeResult* out) {
+  const int dim = 17 + 4 * version;
+  const VersionInfo& info = kVersions[version - 1];
+
+  // Format information: two copies, nearest valid BCH code within 3 bits.
+  uint32_t copy_a = 0U;
+  uint32_t copy_b = 0U;
+  for (int i = 14; i >= 0; --i) {
+    const int row_a = (i < 6) ? i : ((i < 8) ? i + 1 : dim - 15 + i);
+    const int col_b = (i < 8) ? dim - 1 - i : ((i == 8) ? 7 : 14 - i);
+    copy_a = (copy_a << 1U) | (gridBit(row_a, 8) ? 1U : 0U);
+    copy_b = (copy_b << 1U) | (gridBit(8, col_b) ? 1U : 0U);
+  }
+  int format = -1;
+  int best_distance = 4;
+  for (uint32_t data = 0U; data < 32U; ++data) {
+    const uint32_t code = bch15(data);
+    const int distance = std::min(popcount32(code ^ copy_a), popcount32(code ^ copy_b));
+    if (distance < best_distance) {
+      best_distance = distance;
+      format = static_cast<int>(data);
+    }
+  }
+  if (format < 0) {
+    return QrDecodeStatus::kFormat;
+  }
+  const uint8_t ecc_index = kEccIndexFromBits[(format >> 3) & 3];
+  const uint8_t mask = static_cast<uint8_t>(format & 7);
+
+  // Function patterns.
+  reserved_.assign(static_cast<size_t>(dim) * dim, 0U);
+  auto reserve = [&](int row0, int col0, int rows, int cols) {
+    for (int row = row0; row < row0 + rows; ++row) {
+      for (int col = col0; col < col0 + cols; ++col) {
+        reserved_[static_cast<size_t>(row) * dim + col] = 1U;
+      }
+    }
+  };
+  reserve(0, 0, 9, 9);
+  reserve(0, dim - 8, 9, 8);
+  reserve(dim - 8, 0, 8, 9);
+  reserve(6, 0, 1, dim);
+  reserve(0, 6, dim, 1);
+  int align_count = 0;
+  while (align_count < 7 && info.align[align_count] != 0U) {
+    ++align_count;
+  }
+  for (int i = 0; i < align_count; ++i) {
+    for (int j = 0; j < align_count; ++j) {
+      if ((i == 0 && j == 0) || (i == 0 && j == align_count - 1) || (i == align_count - 1 && j == 0)) {
+        continue;
+      }
+      reserve(info.align[i] - 2, info.align[j] - 2, 5, 5);
+    }
+  }
+  if (version >= 7) {
+    reserve(0, dim - 11, 6, 3);
+    reserve(dim - 11, 0, 3, 6);
+  }
+
+  // Zig-zag codeword read, two columns at a time from the bottom right.
+  raw_.assign(info.total, 0U);
+  size_t bit = 0U;
+  const size_t total_bits = static_cast<size_t>(info.total) * 8U;
+  bool upward = true;
+  for (int right = dim - 1; right > 0 && bit < total_bits; right -= 2) {
+    if (right == 6) {
+      right = 5;
+    }
+    for (int step = 0; step < dim && bit < total_bits; ++step) {
+      const int row = upward ? dim - 1 - step : step;
+      for (int c = 0; c < 2 && bit < total_bits; ++c) {
+        const int col = right - c;
+        if (reserved_[static_cast<size_t>(row) * dim + col] != 0U) {
+          continue;
+        }
+        if (gridBit(row, col) != maskBit(mask, row, col)) {
+          raw_[bit >> 3U] |= static_cast<uint8_t>(0x80U >> (bit & 7U));
+        }
+        ++bit;
+      }
+    }
+    upward = !upward;
+  }
+
+  // De-interleave and correct each block.
+  const EccBlocks& ecc = info.ecc[ecc_index];
+  const int short_blocks = ecc.ns;
+  const int long_blocks = (info.total - short_blocks * ecc.bs) / (ecc.bs + 1);
+  const int blocks = short_blocks + long_blocks;
+  const int parity = ecc.bs - ecc.dw;
+  const int data_total = short_blocks * ecc.dw + long_blocks * (ecc.dw + 1);
+  data_.resize(static_cast<size_t>(data_total));
+  uint8_t block[160];
+  size_t data_pos = 0U;
+  int corrected = 0;
+  for (int b = 0; b < blocks; ++b) {
+    const bool is_long = b >= short_blocks;
+    const int dw = ecc.dw + (is_long ? 1 : 0);
+    for (int i = 0; i < ecc.dw; ++i) {
+      block[i] = raw_[static_cast<size_t>(i) * blocks + b];
+    }
+    if (is_long) {
+      block[ecc.dw] = raw_[static_cast<size_t>(ecc.dw) * blocks + (b - short_blocks)];
+    }
+    for (int i = 0; i < parity; ++i) {
+      block[dw + i] = raw_[static_cast<size_t>(data_total) + static_cast<size_t>(i) * blocks + b];
+    }
+    int fixed = 0;
+    if (!rsCorrect(block, dw + parity, parity, &fixed)) {
+      return QrDecodeStatus::kEcc;
+    }
+    corrected += fixed;
+    std::memcpy(&data_[data_pos], block, static_cast<size_t>(dw));
+    data_pos += static_cast<size_t>(dw);
+  }
+
+  out->version = static_cast<uint8_t>(version);
+  out->ecc_level = kEccNames[ecc_index];
+  out->mask = mask;
+  out->corrected_codewords = static_cast<uint16_t>(corrected);
+  return decodeSegments(data_.data(), data_.size(), version, out);
+}
+
+void QrRoiTracker::reset(int frame_w, int frame_h) {
+  frame_w_ = std::max(0, frame_w);
+  frame_h_ = std::max(0, frame_h);
+  misses_ = 0U;
+  roi_ = {0, 0, frame_w_, frame_h_};
+}
+
+bool QrRoiTracker::fullFrame() const {
+  return roi_.x == 0 && roi_.y == 0 && roi_.w == frame_w_ && roi_.h == frame_h_;
+}
+
+void QrRoiTracker::setCentered(float cx, float cy, float w, float h) {
+  const int width = std::min(frame_w_, std::max(kMinWindow, static_cast<int>(std::ceil(w))));
+  const int height = std::min(frame_h_, std::max(kMinWindow, static_cast<int>(std::ceil(h))));
+  int x = static_cast<int>(cx - width / 2.0f);
+  int y = static_cast<int>(cy - height / 2.0f);
+  x = std::max(0, std::min(x, frame_w_ - width));
+  y = std::max(0, std::min(y, frame_h_ - height));
+  roi_ = {x, y, width, height};
+}
+
+void QrRoiTracker::onDecoded(const QrPoint corners[4]) {
+  if (corners == nullptr || frame_w_ <= 0 || frame_h_ <= 0) {
+    return;
+  }
+  float min_x = corners[0].x;
+  float max_x = corners[0].x;
+  float min_y = corners[0].y;
+  float max_y = corners[0].y;
+  for (int index = 1; index < 4; ++index) {
+    min_x = std::min(min_x, corners[index].x);
+    max_x = std::max(max_x, corners[index].x);
+    min_y = std::min(min_y, corners[index].y);
+    max_y = std::max(max_y, corners[index].y);
+  }
+  // Half a symbol of margin on each side covers hand shake between frames.
+  const float side = std::max(max_x - min_x, max_y - min_y);
+  const float margin = std::max(16.0f, side * 0.5f);
+  setCentered((min_x + max_x) / 2.0f, (min_y + max_y) / 2.0f, max_x - min_x + 2.0f * margin,
+              max_y - min_y + 2.0f * margin);
+  misses_ = 0U;
+}
+
+void QrRoiTracker::onMiss() {
+  if (fullFrame()) {
+    return;
+  }
+  ++misses_;
+  if (misses_ >= kMissesBeforeFullFrame) {
+    misses_ = 0U;
+    roi_ = {0, 0, frame_w_, frame_h_};
+    return;
+  }
+  setCentered(roi_.x + roi_.w / 2.0f, roi_.y + roi_.h / 2.0f, roi_.w * 1.5f, roi_.h * 1.5f);
+}
+
+}  // namespace ui
@@ -3,34 +3,22 @@
 
 #include <cstring>
 
-#if defined(USE_CAM) && (USE_CAM != 0) && __has_include(<ESP32QRCodeReader.h>) && __has_include(<ESP32CameraPins.h>)
-#define ZACUS_QR_READER_AVAILABLE 1
-#include <ESP32CameraPins.h>
-#include <ESP32QRCodeReader.h>
-#else
-#define ZACUS_QR_READER_AVAILABLE 0
-#endif
+#include "camera/camera_manager.h"
 
 namespace ui {
-namespace {
-
-template <typename T>
-auto qrPayloadLength(const T& qr, int) -> decltype(qr.payloadLen) {
-  return qr.payloadLen;
-}
-
-template <typename T>
-auto qrPayloadLength(const T& qr, long) -> decltype(qr.payload_len) {
-  return qr.payload_len;
-}
 
-}  // namespace
+static_assert(sizeof(QrScanResult::payload) >= QrDecodeResult::kMaxPayload + 1U,
+              "QrScanResult payload must hold a full decoder payload");
 
 QrScanController::~QrScanController() {
-#if ZACUS_QR_READER_AVAILABLE
-  if (reader_ != nullptr) {
-    delete reinterpret_cast<ESP32QRCodeReader*>(reader_);
-    reader_ = nullptr;
+#if defined(ARDUINO_ARCH_ESP32)
+  if (worker_task_ != nullptr) {
+    vTaskDelete(worker_task_);
+    worker_task_ = nullptr;
+  }
+  if (result_queue_ != nullptr) {
+    vQueueDelete(result_queue_);
+    result_queue_ = nullptr;
   }
 #endif
 }
@@ -39,75 +27,176 @@ bool QrScanController::begin() {
   if (ready_) {
     return true;
   }
-#if !ZACUS_QR_READER_AVAILABLE
-  Serial.println("[QR] scanner unavailable (missing dependency or USE_CAM=0)");
+#if !defined(ARDUINO_ARCH_ESP32)
+  Serial.println("[QR] scanner unavailable (no RTOS)");
   return false;
 #else
-  CameraPins pins = {};
-  pins.PWDN_GPIO_NUM = FREENOVE_CAM_PWDN;
-  pins.RESET_GPIO_NUM = FREENOVE_CAM_RESET;
-  pins.XCLK_GPIO_NUM = FREENOVE_CAM_XCLK;
-  pins.SIOD_GPIO_NUM = FREENOVE_CAM_SIOD;
-  pins.SIOC_GPIO_NUM = FREENOVE_CAM_SIOC;
-  pins.Y9_GPIO_NUM = FREENOVE_CAM_Y9;
-  pins.Y8_GPIO_NUM = FREENOVE_CAM_Y8;
-  pins.Y7_GPIO_NUM = FREENOVE_CAM_Y7;
-  pins.Y6_GPIO_NUM = FREENOVE_CAM_Y6;
-  pins.Y5_GPIO_NUM = FREENOVE_CAM_Y5;
-  pins.Y4_GPIO_NUM = FREENOVE_CAM_Y4;
-  pins.Y3_GPIO_NUM = FREENOVE_CAM_Y3;
-  pins.Y2_GPIO_NUM = FREENOVE_CAM_Y2;
-  pins.VSYNC_GPIO_NUM = FREENOVE_CAM_VSYNC;
-  pins.HREF_GPIO_NUM = FREENOVE_CAM_HREF;
-  pins.PCLK_GPIO_NUM = FREENOVE_CAM_PCLK;
-  auto* reader = new ESP32QRCodeReader(pins);
-  if (reader == nullptr) {
-    Serial.println("[QR] scanner alloc failed");
+  if (camera_ == nullptr) {
+    Serial.println("[QR] scanner unavailable (no camera attached)");
+    return false;
+  }
+  result_queue_ = xQueueCreate(1U, sizeof(QrScanResult));
+  if (result_queue_ == nullptr) {
+    Serial.println("[QR] scanner queue alloc failed");
+    return false;
+  }
+  const BaseType_t created =
+      xTaskCreatePinnedToCore(workerEntry, "qr_scan", kWorkerStackWords, this, kWorkerPriority, &worker_task_, kWorkerCore);
+  if (created != pdPASS) {
+    worker_task_ = nullptr;
+    vQueueDelete(result_queue_);
+    result_queue_ = nullptr;
+    Serial.println("[QR] scanner task create failed");
     return false;
   }
-  reader->setup();
-  reader->beginOnCore(0);
-  reader_ = reinterpret_cast<void*>(reader);
   ready_ = true;
-  enabled_ = false;
+  enabled_.store(false);
   Serial.println("[QR] scanner ready");
   return true;
 #endif
 }
 
+bool QrScanController::setEnabled(bool enabled) {
+  if (!ready_ || camera_ == nullptr) {
+    want_enabled_ = false;
+    enabled_.store(false);
+    return !enabled;
+  }
+  want_enabled_ = enabled;
+#if defined(ARDUINO_ARCH_ESP32)
+  if (enabled) {
+    last_stream_attempt_ms_ = millis();
+    return startStream() || camera_->snapshot().supported;
+  }
+  if (!enabled_.load()) {
+    return true;
+  }
+  // The worker marks itself busy before re-checking enabled_, so once it is
+  // seen idle here it holds no frame reference and will not take another.
+  // A decode still running at the timeout keeps its frame: the camera then
+  // defers the driver deinit until the worker releases it.
+  enabled_.store(false);
+  const uint32_t started_ms = millis();
+  while (worker_busy_.load() && (millis() - started_ms) < kDisableTimeoutMs) {
+    vTaskDelay(pdMS_TO_TICKS(2));
+  }
+  camera_->stopLumaStream();
+#endif
+  return true;
+}
+
 bool QrScanController::poll(QrScanResult* out, uint32_t timeout_ms) {
-  if (!ready_ || !enabled_ || out == nullptr) {
+  if (!ready_ || !want_enabled_ || out == nullptr) {
     return false;
   }
-#if !ZACUS_QR_READER_AVAILABLE
+#if !defined(ARDUINO_ARCH_ESP32)
   (void)timeout_ms;
   return false;
 #else
-  auto* reader = reinterpret_cast<ESP32QRCodeReader*>(reader_);
-  if (reader == nullptr) {
+  if (!enabled_.load()) {
+    const uint32_t now_ms = millis();
+    if ((now_ms - last_stream_attempt_ms_) >= kStreamRetryMs) {
+      last_stream_attempt_ms_ = now_ms;
+      (void)startStream();
+    }
     return false;
   }
-  QRCodeData qr;
-  if (!reader->receiveQrCode(&qr, timeout_ms)) {
+  return xQueueReceive(result_queue_, out, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+#endif
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+void QrScanController::workerEntry(void* arg) {
+  auto* self = static_cast<QrScanController*>(arg);
+  if (self == nullptr) {
+    vTaskDelete(nullptr);
+    return;
+  }
+  self->workerMain();
+}
+
+void QrScanController::workerMain() {
+  while (true) {
+    worker_busy_.store(true);
+    if (!enabled_.load()) {
+      worker_busy_.store(false);
+      vTaskDelay(pdMS_TO_TICKS(kIdleDelayMs));
+      continue;
+    }
+    const bool scanned = scanLatestFrame();
+    worker_busy_.store(false);
+    if (!scanned) {
+      vTaskDelay(pdMS_TO_TICKS(kNoFrameDelayMs));
+    }
+  }
+}
+
+bool QrScanController::startStream() {
+  if (!camera_->startLumaStream()) {
+    Serial.printf("[QR] luma stream unavailable err=%s\n", camera_->snapshot().last_error);
     return false;
   }
+  QrScanResult stale;
+  while (xQueueReceive(result_queue_, &stale, 0U) == pdTRUE) {
+  }
+  tracker_reset_.store(true);
+  enabled_.store(true);
+  return true;
+}
 
-  out->at_ms = millis();
-  out->decoder_valid = qr.valid;
-  out->payload_len = 0U;
-  out->payload[0] = '\0';
-  const int payload_len = static_cast<int>(qrPayloadLength(qr, 0));
-  if (!qr.valid || payload_len <= 0) {
-    return true;
+bool QrScanController::scanLatestFrame() {
+  camera::FrameRef frame;
+  if (!camera_->pipeline().acquireLatest(&frame, last_sequence_) || frame->format != camera::FrameFormat::kGray8) {
+    return false;
+  }
+  last_sequence_ = frame->sequence;
+  if (tracker_reset_.exchange(false)) {
+    tracker_.reset(frame->width, frame->height);
   }
+  const bool roi_frame = !tracker_.fullFrame();
+  const QrRoi roi = tracker_.next();
+  QrDecodeResult decoded;
+  const uint32_t started_us = micros();
+  const QrDecodeStatus status = decoder_.decode(frame->data, frame->width, frame->height, frame->stride, roi, &decoded);
+  const uint32_t elapsed_us = micros() - started_us;
+  // Hand the driver buffer back before publishing the result.
+  frame.reset();
 
-  const size_t max_len = sizeof(out->payload) - 1U;
-  const size_t copy_len = (static_cast<size_t>(payload_len) < max_len) ? static_cast<size_t>(payload_len) : max_len;
-  std::memcpy(out->payload, qr.payload, copy_len);
-  out->payload[copy_len] = '\0';
-  out->payload_len = static_cast<uint16_t>(copy_len);
+  ++stat_frames_;
+  stat_roi_frames_ += roi_frame ? 1U : 0U;
+  stat_decode_us_ += elapsed_us;
+  if (elapsed_us > stat_decode_max_us_) {
+    stat_decode_max_us_ = elapsed_us;
+  }
+  if (status == QrDecodeStatus::kOk) {
+    ++stat_decoded_;
+    tracker_.onDecoded(decoded.corners);
+    QrScanResult result;
+    result.at_ms = millis();
+    result.decoder_valid = true;
+    result.payload_len = decoded.payload_len;
+    std::memcpy(result.payload, decoded.payload, decoded.payload_len);
+    result.payload[decoded.payload_len] = '\0';
+    xQueueOverwrite(result_queue_, &result);
+  } else {
+    tracker_.onMiss();
+  }
+  if (stat_frames_ >= kStatsEveryFrames) {
+    Serial.printf("[QR] stats frames=%lu decoded=%lu roi=%lu avg_us=%lu max_us=%lu last=%s\n",
+                  static_cast<unsigned long>(stat_frames_),
+                  static_cast<unsigned long>(stat_decoded_),
+                  static_cast<unsigned long>(stat_roi_frames_),
+                  static_cast<unsigned long>(stat_decode_us_ / stat_frames_),
+                  static_cast<unsigned long>(stat_decode_max_us_),
+                  QrDecoder::statusName(status));
+    stat_frames_ = 0U;
+    stat_decoded_ = 0U;
+    stat_roi_frames_ = 0U;
+    stat_decode_us_ = 0U;
+    stat_decode_max_us_ = 0U;
+  }
   return true;
-#endif
 }
+#endif
 
 }  // namespace ui
@@ -32,8 +32,7 @@ void QrSceneController::onSceneEnter(QrScanController* scanner, lv_obj_t* subtit
   scene_active_ = true;
   bool qr_ready = false;
   if (scanner != nullptr) {
-    qr_ready = scanner->begin();
-    scanner->setEnabled(qr_ready);
+    qr_ready = scanner->begin() && scanner->setEnabled(true);
   }
   last_decode_ms_ = 0U;
   feedback_until_ms_ = 0U;
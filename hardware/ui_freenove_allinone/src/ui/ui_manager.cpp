@@ -969,6 +969,14 @@ bool UiManager::consumeRuntimeEvent(char* out_event, size_t capacity) {
   return qr_scene_controller_.consumeRuntimeEvent(out_event, capacity);
 }
 
+void UiManager::attachQrCamera(CameraManager* camera) {
+  qr_scan_.attachCamera(camera);
+}
+
+void UiManager::stopQrScan() {
+  (void)qr_scan_.setEnabled(false);
+}
+
 bool UiManager::simulateQrPayload(const char* payload) {
   return qr_scene_controller_.queueSimulatedPayload(payload);
 }
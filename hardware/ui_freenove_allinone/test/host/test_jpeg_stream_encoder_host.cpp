@@ -0,0 +1,421 @@
+// Host test: strip-based JPEG encoder used for recorder snapshots.
+// Encodes synthetic RGB565 frames, checks the marker layout, decodes the
+// entropy stream back with a small reference baseline decoder (PSNR against
+// the source), checks chunked output and write-error propagation, then
+// benchmarks QVGA/VGA encodes against the BMP24 size.
+// Build/run: make -C ../firmware camera-jpeg-encoder-host
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "camera/jpeg_stream_encoder.h"
+
+#include "host_check.h"
+
+namespace {
+
+struct Sink {
+  std::vector<uint8_t> bytes;
+  size_t calls = 0U;
+  size_t largest = 0U;
+  size_t fail_after = 0U;  // 0: never fail
+};
+
+bool writeSink(void* ctx, const uint8_t* data, size_t len) {
+  Sink* sink = static_cast<Sink*>(ctx);
+  ++sink->calls;
+  if (sink->fail_after != 0U && sink->calls > sink->fail_after) {
+    return false;
+  }
+  if (len > sink->largest) {
+    sink->largest = len;
+  }
+  sink->bytes.insert(sink->bytes.end(), data, data + len);
+  return true;
+}
+
+uint16_t pack565(int r, int g, int b) {
+  return static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+// Smooth gradients plus a few hard edges, roughly camera-like.
+std::vector<uint16_t> makeFrame(int w, int h, int stride) {
+  std::vector<uint16_t> px(static_cast<size_t>(stride) * static_cast<size_t>(h), 0xFFFFU);
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      int r = (x * 255) / (w > 1 ? w - 1 : 1);
+      int g = (y * 255) / (h > 1 ? h - 1 : 1);
+      int b = 128 + static_cast<int>(100.0 * std::sin((x + y) * 0.05));
+      if ((x / 40 + y / 40) % 5 == 0) {
+        r = 255 - r;
+        g = 40;
+      }
+      px[static_cast<size_t>(y) * static_cast<size_t>(stride) + static_cast<size_t>(x)] = pack565(r, g, b);
+    }
+  }
+  return px;
+}
+
+// --- reference decoder (baseline, standard tables, 4:4:4 or 4:2:0) ---------
+
+struct HuffTable {
+  uint8_t bits[17] = {};
+  uint8_t values[256] = {};
+  int mincode[17] = {};
+  int maxcode[18] = {};
+  int valptr[17] = {};
+};
+
+void buildDecoder(HuffTable* t) {
+  int code = 0;
+  int k = 0;
+  for (int len = 1; len <= 16; ++len) {
+    t->valptr[len] = k;
+    t->mincode[len] = code;
+    code += t->bits[len];
+    k += t->bits[len];
+    t->maxcode[len] = (t->bits[len] != 0) ? code - 1 : -1;
+    code <<= 1;
+  }
+  t->maxcode[17] = 0x7FFFFFFF;
+}
+
+struct BitReader {
+  const uint8_t* data;
+  size_t size;
+  size_t pos;
+  uint32_t buffer;
+  int count;
+  bool hit_marker;
+
+  int bit() {
+    if (count == 0) {
+      if (pos >= size) {
+        hit_marker = true;
+        return 0;
+      }
+      uint8_t byte = data[pos++];
+      if (byte == 0xFF) {
+        if (pos < size && data[pos] == 0x00) {
+          ++pos;
+        } else {
+          hit_marker = true;
+        }
+      }
+      buffer = byte;
+      count = 8;
+    }
+    --count;
+    return static_cast<int>((buffer >> count) & 1U);
+  }
+
+  int bits(int n) {
+    int v = 0;
+    for (int i = 0; i < n; ++i) {
+      v = (v << 1) | bit();
+    }
+    return v;
+  }
+};
+
+int decodeSymbol(BitReader* br, const HuffTable& t) {
+  int code = 0;
+  for (int len = 1; len <= 16; ++len) {
+    code = (code << 1) | br->bit();
+    if (t.maxcode[len] >= 0 && code <= t.maxcode[len] && code >= t.mincode[len]) {
+      return t.values[t.valptr[len] + code - t.mincode[len]];
+    }
+  }
+  return -1;
+}
+
+int extend(int v, int n) {
+  return (n == 0) ? 0 : (v < (1 << (n - 1)) ? v - (1 << n) + 1 : v);
+}
+
+const uint8_t kZigzag[64] = {
+    0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,  12, 19, 26, 33, 40, 48,
+    41, 34, 27, 20, 13, 6,  7,  14, 21, 28, 35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23,
+    30, 37, 44, 51, 58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+struct Decoded {
+  bool ok = false;
+  int width = 0;
+  int height = 0;
+  bool subsampled = false;
+  std::vector<uint8_t> rgb;  // 3 bytes per pixel
+};
+
+bool decodeBlock(BitReader* br, const HuffTable& dc, const HuffTable& ac, const uint8_t* q, int* pred, float* out) {
+  int coeff[64] = {};
+  const int s = decodeSymbol(br, dc);
+  if (s < 0 || s > 11) {
+    return false;
+  }
+  *pred += extend(br->bits(s), s);
+  coeff[0] = *pred * q[0];
+  for (int k = 1; k < 64;) {
+    const int rs = decodeSymbol(br, ac);
+    if (rs < 0) {
+      return false;
+    }
+    const int run = rs >> 4;
+    const int size = rs & 15;
+    if (size == 0) {
+      if (run == 15) {
+        k += 16;
+        continue;
+      }
+      break;
+    }
+    k += run;
+    if (k > 63) {
+      return false;
+    }
+    coeff[kZigzag[k]] = extend(br->bits(size), size) * q[k];
+    ++k;
+  }
+  for (int y = 0; y < 8; ++y) {
+    for (int x = 0; x < 8; ++x) {
+      double sum = 0.0;
+      for (int v = 0; v < 8; ++v) {
+        for (int u = 0; u < 8; ++u) {
+          const double cu = (u == 0) ? std::sqrt(0.5) : 1.0;
+          const double cv = (v == 0) ? std::sqrt(0.5) : 1.0;
+          sum += cu * cv * coeff[v * 8 + u] * std::cos((2 * x + 1) * u * M_PI / 16.0) *
+                 std::cos((2 * y + 1) * v * M_PI / 16.0);
+        }
+      }
+      out[y * 8 + x] = static_cast<float>(sum / 4.0 + 128.0);
+    }
+  }
+  return !br->hit_marker;
+}
+
+uint8_t clamp8(float v) {
+  return static_cast<uint8_t>(v < 0.0f ? 0 : (v > 255.0f ? 255 : static_cast<int>(v + 0.5f)));
+}
+
+Decoded decode(const std::vector<uint8_t>& jpg) {
+  Decoded out;
+  uint8_t quant[4][64] = {};  // zigzag order
+  HuffTable dc[2];
+  HuffTable ac[2];
+  uint8_t comp_q[3] = {};
+  size_t pos = 2U;
+  if (jpg.size() < 4U || jpg[0] != 0xFF || jpg[1] != 0xD8) {
+    return out;
+  }
+  while (pos + 4U <= jpg.size()) {
+    if (jpg[pos] != 0xFF) {
+      return out;
+    }
+    const uint8_t marker = jpg[pos + 1U];
+    const size_t len = (static_cast<size_t>(jpg[pos + 2U]) << 8) | jpg[pos + 3U];
+    const uint8_t* seg = &jpg[pos + 4U];
+    if (marker == 0xDB) {
+      for (size_t i = 0U; i + 65U <= len - 2U; i += 65U) {
+        std::memcpy(quant[seg[i] & 3], seg + i + 1U, 64U);
+      }
+    } else if (marker == 0xC0) {
+      out.height = (seg[1] << 8) | seg[2];
+      out.width = (seg[3] << 8) | seg[4];
+      out.subsampled = (seg[7] == 0x22);
+      for (int c = 0; c < 3; ++c) {
+        comp_q[c] = seg[8 + c * 3];
+      }
+    } else if (marker == 0xC4) {
+      size_t i = 0U;
+      while (i < len - 2U) {
+        const uint8_t tc = seg[i];
+        HuffTable& t = (tc >> 4) ? ac[tc & 1] : dc[tc & 1];
+        int total = 0;
+        for (int b = 1; b <= 16; ++b) {
+          t.bits[b] = seg[i + b];
+          total += t.bits[b];
+        }
+        std::memcpy(t.values, seg + i + 17U, static_cast<size_t>(total));
+        buildDecoder(&t);
+        i += 17U + static_cast<size_t>(total);
+      }
+    } else if (marker == 0xDA) {
+      pos += 2U + len;
+      break;
+    }
+    pos += 2U + len;
+  }
+  if (out.width == 0 || jpg.size() < 2U || jpg[jpg.size() - 2U] != 0xFF || jpg[jpg.size() - 1U] != 0xD9) {
+    return out;
+  }
+  BitReader br = {jpg.data(), jpg.size() - 2U, pos, 0U, 0, false};
+  const int mcu = out.subsampled ? 16 : 8;
+  const int mcus_x = (out.width + mcu - 1) / mcu;
+  const int mcus_y = (out.height + mcu - 1) / mcu;
+  out.rgb.assign(static_cast<size_t>(out.width) * static_cast<size_t>(out.height) * 3U, 0U);
+  int pred[3] = {};
+  for (int my = 0; my < mcus_y; ++my) {
+    for (int mx = 0; mx < mcus_x; ++mx) {
+      float y_blocks[4][64];
+      float cb[64];
+      float cr[64];
+      const int y_count = out.subsampled ? 4 : 1;
+      for (int b = 0; b < y_count; ++b) {
+        if (!decodeBlock(&br, dc[0], ac[0], quant[comp_q[0]], &pred[0], y_blocks[b])) {
+          return out;
+        }
+      }
+      if (!decodeBlock(&br, dc[1], ac[1], quant[comp_q[1]], &pred[1], cb) ||
+          !decodeBlock(&br, dc[1], ac[1], quant[comp_q[2]], &pred[2], cr)) {
+        return out;
+      }
+      for (int j = 0; j < mcu; ++j) {
+        for (int i = 0; i < mcu; ++i) {
+          const int px = mx * mcu + i;
+          const int py = my * mcu + j;
+          if (px >= out.width || py >= out.height) {
+            continue;
+          }
+          const int yb = (y_count > 1) ? (j >> 3) * 2 + (i >> 3) : 0;
+          const float yv = y_blocks[yb][(j & 7) * 8 + (i & 7)];
+          const int ci = out.subsampled ? (j >> 1) * 8 + (i >> 1) : j * 8 + i;
+          const float cbv = cb[ci] - 128.0f;
+          const float crv = cr[ci] - 128.0f;
+          uint8_t* dst = &out.rgb[(static_cast<size_t>(py) * static_cast<size_t>(out.width) + static_cast<size_t>(px)) * 3U];
+          dst[0] = clamp8(yv + 1.402f * crv);
+          dst[1] = clamp8(yv - 0.344136f * cbv - 0.714136f * crv);
+          dst[2] = clamp8(yv + 1.772f * cbv);
+        }
+      }
+    }
+  }
+  out.ok = true;
+  return out;
+}
+
+double psnr(const std::vector<uint16_t>& src, int w, int h, int stride, const Decoded& img) {
+  double sq = 0.0;
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      const uint16_t c = src[static_cast<size_t>(y) * static_cast<size_t>(stride) + static_cast<size_t>(x)];
+      const int ref[3] = {((c >> 11) & 0x1F) * 255 / 31, ((c >> 5) & 0x3F) * 255 / 63, (c & 0x1F) * 255 / 31};
+      const uint8_t* got = &img.rgb[(static_cast<size_t>(y) * static_cast<size_t>(w) + static_cast<size_t>(x)) * 3U];
+      for (int k = 0; k < 3; ++k) {
+        const double d = ref[k] - got[k];
+        sq += d * d;
+      }
+    }
+  }
+  const double mse = sq / (3.0 * w * h);
+  return (mse <= 0.0) ? 99.0 : 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+// ---------------------------------------------------------------------------
+
+void runRoundTrip(int w, int h, int stride, camera::JpegStreamEncoder::Subsampling sub, const char* label) {
+  const std::vector<uint16_t> frame = makeFrame(w, h, stride);
+  camera::JpegStreamEncoder::Options options;
+  options.quality = 85U;
+  options.subsampling = sub;
+  camera::JpegStreamEncoder encoder;
+  Sink sink;
+  const bool ok = encoder.encodeRgb565(frame.data(), w, h, stride, options, writeSink, &sink);
+  check(ok, "encode succeeds");
+  check(encoder.bytesWritten() == sink.bytes.size(), "bytesWritten matches sink");
+  check(sink.largest <= camera::JpegStreamEncoder::kOutBufferBytes, "writes bounded by the out buffer");
+  const Decoded img = decode(sink.bytes);
+  check(img.ok, "reference decoder walks the whole entropy stream");
+  check(img.width == w && img.height == h, "SOF dimensions");
+  if (img.ok) {
+    const double db = psnr(frame, w, h, stride, img);
+    std::printf("roundtrip %-14s %dx%d bytes=%zu psnr=%.1f dB\n", label, w, h, sink.bytes.size(), db);
+    check(db > 30.0, "decoded image close to the source");
+  }
+}
+
+void runApiChecks() {
+  const int w = 40;
+  const int h = 20;
+  const std::vector<uint16_t> frame = makeFrame(w, h, w);
+  camera::JpegStreamEncoder encoder;
+  camera::JpegStreamEncoder::Options options;
+  Sink sink;
+  check(!encoder.begin(0, 10, options, writeSink, &sink), "zero width refused");
+  check(!encoder.begin(10, 10, options, nullptr, nullptr), "missing writer refused");
+
+  check(encoder.begin(w, h, options, writeSink, &sink), "begin");
+  check(encoder.stripRows() == 16, "4:2:0 strips are 16 rows");
+  check(!encoder.encodeStrip(frame.data(), w, 8), "short strip before the end refused");
+  check(!encoder.finish(), "encoder stays failed");
+
+  sink = Sink();
+  check(encoder.begin(w, h, options, writeSink, &sink), "begin again");
+  check(encoder.encodeStrip(frame.data(), w, 16), "first strip");
+  check(!encoder.finish(), "finish before the last row fails");
+
+  sink = Sink();
+  check(encoder.begin(w, h, options, writeSink, &sink), "begin line by strip");
+  check(encoder.encodeStrip(frame.data(), w, 16), "strip 1");
+  check(encoder.encodeStrip(frame.data() + 16 * w, w, 4), "partial last strip");
+  check(encoder.finish(), "finish");
+  check(decode(sink.bytes).ok, "strip-fed output decodes");
+
+  Sink failing;
+  failing.fail_after = 1U;
+  const std::vector<uint16_t> big = makeFrame(320, 240, 320);
+  check(!encoder.encodeRgb565(big.data(), 320, 240, 320, options, writeSink, &failing), "write error surfaces");
+
+  check(camera::JpegStreamEncoder::qualityFromCameraScale(4U) > camera::JpegStreamEncoder::qualityFromCameraScale(12U),
+        "lower camera scale is better quality");
+  check(camera::JpegStreamEncoder::qualityFromCameraScale(0U) <= 100U &&
+            camera::JpegStreamEncoder::qualityFromCameraScale(200U) >= 1U,
+        "camera scale clamped");
+}
+
+void runBenchmark(int w, int h) {
+  const std::vector<uint16_t> frame = makeFrame(w, h, w);
+  camera::JpegStreamEncoder encoder;
+  camera::JpegStreamEncoder::Options options;
+  options.quality = camera::JpegStreamEncoder::qualityFromCameraScale(12U);
+  const int iterations = 10;
+  size_t bytes = 0U;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    Sink sink;
+    sink.bytes.reserve(64U * 1024U);
+    encoder.encodeRgb565(frame.data(), w, h, w, options, writeSink, &sink);
+    bytes = sink.bytes.size();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const double ms = std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+  const size_t bmp = 54U + static_cast<size_t>((w * 3 + 3) & ~3) * static_cast<size_t>(h);
+  std::printf("bench %dx%d q=%u: %.2f ms/frame, jpeg=%zu bytes, bmp24=%zu bytes (%.1fx smaller)\n",
+              w,
+              h,
+              static_cast<unsigned>(options.quality),
+              ms,
+              bytes,
+              bmp,
+              static_cast<double>(bmp) / static_cast<double>(bytes));
+  check(bytes * 4U < bmp, "jpeg at least 4x smaller than bmp24");
+}
+
+}  // namespace
+
+int main() {
+  runApiChecks();
+  runRoundTrip(320, 240, 320, camera::JpegStreamEncoder::Subsampling::k420, "qvga 4:2:0");
+  runRoundTrip(37, 21, 41, camera::JpegStreamEncoder::Subsampling::k420, "odd 4:2:0");
+  runRoundTrip(37, 21, 37, camera::JpegStreamEncoder::Subsampling::k444, "odd 4:4:4");
+  runBenchmark(320, 240);
+  runBenchmark(640, 480);
+  if (g_failures != 0u) {
+    std::printf("camera jpeg encoder: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("camera jpeg encoder: ok\n");
+  return 0;
+}
@@ -0,0 +1,713 @@
+// Host test: grayscale QR decoder + adaptive ROI tracker (QR scan worker).
+// Fixtures are module matrices produced by an independent encoder (versions
+// 1-10, all four ECC levels, byte and mixed alphanumeric/numeric/byte
+// segments). Each one is rendered like a camera frame (perspective,
+// anti-aliasing, blur, uneven light, sensor noise) and must decode to its
+// payload; damaged symbols exercise Reed-Solomon correction. Benchmarks
+// report QVGA decode time (full frame vs tracked ROI) and the success rate
+// over randomized poses.
+// Build/run: make -C ../firmware qr-decoder-host
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "ui/qr/qr_decoder.h"
+
+#include "host_check.h"
+
+namespace {
+
+using ui::QrDecodeResult;
+using ui::QrDecodeStatus;
+using ui::QrDecoder;
+using ui::QrPoint;
+using ui::QrRoi;
+using ui::QrRoiTracker;
+
+uint32_t g_seed = 20261018U;
+
+uint32_t nextRandom() {
+  g_seed = g_seed * 1664525U + 1013904223U;
+  return g_seed >> 8U;
+}
+
+float uniform(float lo, float hi) {
+  return lo + (hi - lo) * static_cast<float>(nextRandom() & 0xFFFFU) / 65535.0f;
+}
+
+// '#' = dark module. Generated offline, quiet zone not included.
+// v1_m: version 1-M, 11 bytes
+const char* const kV1M[] = {
+    "#######.###.#.#######",
+    "#.....#.......#.....#",
+    "#.###.#...#...#.###.#",
+    "#.###.#.#.#.#.#.###.#",
+    "#.###.#.#...#.#.###.#",
+    "#.....#.####..#.....#",
+    "#######.#.#.#.#######",
+    "........#.###........",
+    "#...#.###.##.#####..#",
+    "####.#.##..#####..###",
+    ".###.####.##..#.#..#.",
+    "#..##..#.##..#..#...#",
+    ".###..###.#.#.#...##.",
+    "........##..#..#..#.#",
+    "#######.#...###.#.##.",
+    "#.....#..#####.....##",
+    "#.###.#.#.##.#######.",
+    "#.###.#.....#..#.####",
+    "#.###.#...##.##.#....",
+    "#.....#..#..##.......",
+    "#######.#....##..##.#",
+};
+// v2_q: version 2-Q, 17 bytes
+const char* const kV2Q[] = {
+    "#######...##..###.#######",
+    "#.....#..#.#.##...#.....#",
+    "#.###.#..##...###.#.###.#",
+    "#.###.#.#..##.#.#.#.###.#",
+    "#.###.#...#####.#.#.###.#",
+    "#.....#.#.#.....#.#.....#",
+    "#######.#.#.#.#.#.#######",
+    "........####..##.........",
+    ".##...#...#..###..##.#...",
+    "##.##...##.#.###.#.#.....",
+    "..#..#####.....#.##.#...#",
+    "..#..#.....###.......#.#.",
+    "##.#.#########....###.###",
+    "...#.#......##.#...#.#...",
+    "###.#.##....#..#..###.#.#",
+    "....#..#.#..#.#.##.#.#..#",
+    "##..#.#.##..#########.##.",
+    "........###.#.#.#...#..#.",
+    "#######..###.#.##.#.#...#",
+    "#.....#..###.####...#..#.",
+    "#.###.#..####..######..##",
+    "#.###.#..#..##..#..#..##.",
+    "#.###.#.##..#.##....##.##",
+    "#.....#.##.##...#..#.#...",
+    "#######..##..#.###..###.#",
+};
+// v4_h: version 4-H, 29 bytes
+const char* const kV4H[] = {
+    "#######....#.#...###..#.#.#######",
+    "#.....#..##...##..#.#.#.#.#.....#",
+    "#.###.#.#.##.###.#.#.####.#.###.#",
+    "#.###.#.##..#.#.##.#.#.##.#.###.#",
+    "#.###.#...#####..#.#.#.#..#.###.#",
+    "#.....#....#.#...##.....#.#.....#",
+    "#######.#.#.#.#.#.#.#.#.#.#######",
+    "..........#..#.#......##.........",
+    "...##.##.###.#..#...#..#.....##..",
+    ".#..##..#.##.##..#.#..##.#.##.#..",
+    "##..#.#..####.#...##.#.#.###..###",
+    "#.#.#....###.#.####......#.##.#.#",
+    "#...#.##.#.#..##....###.#.####.#.",
+    "..##...##........#.#.###.....#.#.",
+    "##..#.##.......#..#.....##...#...",
+    ".#.....##..#.###.#.....#.##..####",
+    "#..#########.#..#.##.....##.##.#.",
+    ".#.###.##..##.#...#.###.######..#",
+    "...#..#..###.#.#.##.#..#.....##.#",
+    "..##.#.....#####.#.#..####.######",
+    "##.#.###.#..##.#...##.....#..#..#",
+    "#...#..##.###...####.##.#.###.#..",
+    "#.#####.###..#.##.....##..#.#.###",
+    "#..#...###.#.#######..###...#.###",
+    "##.##.#..#.#..#.#.##...#######.##",
+    "........#..#.###.#...#..#...##...",
+    "#######.##.#.#.####.#..##.#.#.#..",
+    "#.....#..#....#.#.#..##.#...#.##.",
+    "#.###.#.##..####..#..#########.#.",
+    "#.###.#.###..#..#...####.#.#.###.",
+    "#.###.#..#.#..#.###...###...#..##",
+    "#.....#.....###....###...##..####",
+    "#######..##.##.#..####..#.#.#....",
+};
+// v7_l: version 7-L, 149 bytes
+const char* const kV7L[] = {
+    "#######.##.#.....###.#.###.####.....#.#######",
+    "#.....#..##.#.#....#.##...#.#...##.#..#.....#",
+    "#.###.#.#..#.##.##.#.###..#..####..#..#.###.#",
+    "#.###.#.#.#.#.....##...#.#.#.##....##.#.###.#",
+    "#.###.#.#.#....#.###########...#..###.#.###.#",
+    "#.....#..####..###.##...##.##..#.#....#.....#",
+    "#######.#.#.#.#.#.#.#.#.#.#.#.#.#.#.#.#######",
+    "...........#.###....#...#.##.#.##.##.........",
+    "####..#.##...#.###.######..##.#..###.#..###.#",
+    ".#..##.#.##.#.#..###.#####...###...###.....#.",
+    "..###.###....#.#..#.##....####.#.#...##.#..##",
+    ".#...#.##...#...##...###....###...###..###..#",
+    ".#.####.#.##.#...###...##.....##..####...##..",
+    "#.##.#.###.#####....#..#.##.#..###....#....##",
+    "#...#.##...#..###..#.#.#....#.....##.#####...",
+    "#......##..###...#.#...##..###..##.###.#.###.",
+    "..##..#..##...#..#.##...##....#.####...#...#.",
+    ".#...#.##..##.###.#.#.#......#...###....#..#.",
+    ".#..#####.....##..#...####.#..##...##..###.#.",
+    "##.##..##......#.#.###.#####...###..##.....##",
+    "..#.######......##.######..###...##.######.#.",
+    "....#...#.###....####...#.....###...#...#.#..",
+    "#.#.#.#.#..##.###.#.#.#.#..#.##.##..#.#.#.###",
+    "#.#.#...#######.##..#...#..###...##.#...#....",
+    "....######..#....##.######.....#.#..#####..##",
+    "..###....##.#.##.#.###...###....##..####....#",
+    "#####.###...##.##..####.#..##.....#....##....",
+    "#..##....#.#.#......#...####.#.....###..###.#",
+    ".##.#.#.####.###.....#...###...###.####..#...",
+    "#.####....##.#.##..#####....##...##.#..######",
+    "..#.#.#.#######.###.#...##....#.....#...##...",
+    "##.....#.#..#....##.......##....##.##......##",
+    "..#...#..#.#..#.##...####.####...##.##.......",
+    ".#.....#....#.....#.##.#.....###...#...#.###.",
+    "....#.#.##....##..#.##.#...#...#.#...###...##",
+    ".####...#.#...##.##..###.#.#####..#.#..###...",
+    "#..##.##.#...#...##.#####....###.##.########.",
+    "........##.#.###.#..#...#####......##...##..#",
+    "#######..#.###.##.#.#.#.#...##.##...#.#.##...",
+    "#.....#.....##...##.#...####..#.##.##...###..",
+    "#.###.#..#.#..#.#...########..#.#.#.#####..#.",
+    "#.###.#.#..##...#..####....#.#...##...#.#....",
+    "#.###.#.###..#.####....#...#.###.#.####.....#",
+    "#.....#.#...##########.#..##.##########.#...#",
+    "#######.##.#....##...###.#####...##..#..#....",
+};
+// v10_m: version 10-M, 190 bytes
+const char* const kV10M[] = {
+    "#######..##...#..#########...##.#....####.##.###..#######",
+    "#.....#....#.....#.....##.##..#####.#...##.#.#.#..#.....#",
+    "#.###.#.####.#....##....##...###...#..#.#.######..#.###.#",
+    "#.###.#.#..###....#..#.#.#.......##.####..##.#.#..#.###.#",
+    "#.###.#.###...#..#.#..#.#.######.#..#..#..###..#..#.###.#",
+    "#.....#.#.#..####...##....#...#...#.####.#.##.#...#.....#",
+    "#######.#.#.#.#.#.#.#.#.#.#.#.#.#.#.#.#.#.#.#.#.#.#######",
+    "........##.##.######...####...#.#.#.....#.####..#........",
+    "#.#####......#..###..#..########.####.##......##..#####..",
+    ".#.#.#..##..#.....#....##..##.#.#.#..#...###....#.....##.",
+    "#..#..#.#.###......#..###..#.#...#.#..#....#..######...#.",
+    "##...#.#...##...##...####.....###..###.####.##.##...#.###",
+    ".#.##.#..#....###.###.#.####.##.....#.#....#.#...###.#.##",
+    "..#.#...#..##..##..###.#.##...#..#.##.....##.#.###.######",
+    "...####..#######..........##.#....#.####.#....###.#...##.",
+    "#.###..#....###.#####.##.##.#.####.#...#######..#..####.#",
+    "..#.#.#..##...##.####.##...#.#......##...##..###.##....##",
+    "..###...##...##.##....#.########.#.##...###.#...#...#..##",
+    "####..#.###..#...####.#.###....#..######...#.######.#.#..",
+    "..###..##..##....##....###..##...#.....#.####..#..#.#.###",
+    "..#...##.#.#....#..........#...#..####.#.....###.##..#.#.",
+    "###..#.####....#..####.##..#.#.#...##.....#..#.###......#",
+    "###.#.#.#..#.###.##.##.##.#...##.##.##.#.#.#..##..#....#.",
+    "..#.##.#..#.####.#....#..#.####....#.##.#.#.##.#.#.######",
+    ".######.##.#..#.#....#....#..####.#.####.##....#.##......",
+    "#.#..#..##..#..##.#...####...##.##...#.##.##.#..#..##.###",
+    "..########....##......###########.#####..#..#.#.#####....",
+    "...##...####.#.###.#...##.#...#.##......#.###..##...#.##.",
+    "#####.#.##.#..#...##..#.#.#.#.##...#####.#...#.##.#.#....",
+    ".#.##...#..#.#..######.##.#...##.#.###.#.##.....#...#.#..",
+    ".##########..###......#.#######....##.#....#.#########.#.",
+    ".....#.#..###############.#######.#.##.####.##.#####..#..",
+    "..######.##...###.##.####....##....#.##..#.#....#...##.#.",
+    "###.##.###.###....#.....#.#..#..#.........##.#....##.####",
+    ".#.#..##.#.#....##.#.#####....##...#.#####..#.#.#..#.##.#",
+    "#..#.#.#.......##...##..#.##.#.###.#...###..##.#.###.##..",
+    "#.#..###..##.########..#...#..#..##.#.#....#..#..#..#....",
+    "#..#.#.....###.###.#..#.#.#.#....#..#...####....#..#...##",
+    ".###..#.#.######..#..#.#...##.##..#####.#..#.###.#...##..",
+    "#..###....#..#.#.##.#.#.#.#.##.......########..##.#..##.#",
+    "#..####.##..#.##..#.#..#..######.#.##.#..#....#.#.###..#.",
+    "#.####.####.#...##.####.#.....###..####...####.#..#...#.#",
+    "##....##.######.......#.#.#..##..##....###....###..#.###.",
+    "#.#.#..##..##....#.###.........#.##....##.####.##.#..##.#",
+    "#.....##.......#####.##..#..#.#..#.####....#.##..#..#....",
+    ".#..##.#######.#.#..#####.##.###.#.###....#.##.#.#...####",
+    "#.#..##..##.##....#.#...###.#.#...###.#..#....####..#....",
+    "#####..##.#..###.#.##..##..#.##.#.#..#..#####.##..##.##..",
+    "......#...###.#.##....##########.####..#..#...#.######...",
+    "........##.....#.###.#.####...##..##.#..#####..##...####.",
+    "#######..#.###.####..######.#.#.##..#.##......#.#.#.#.##.",
+    "#.....#.##.#..###.#....##.#...#.##.##.#.#..###.##...#.###",
+    "#.###.#.#.#.##.##.####..#.######..#.#..#..#..##.######...",
+    "#.###.#.##.#..#.###..#.#.##.##.#...##..#..#..#.#..#####..",
+    "#.###.#.#...###.#...#......#.#.#.#..######..#.#.#........",
+    "#.....#...#####.....#.##..##.#####.#...###..#..#......#..",
+    "#######.#..#..#.#.#....#...####...#.###...##.#..####.#.#.",
+};
+// v2_m mixed: alphanumeric "ZACUS-ETAPE-", numeric "20261018", byte "ok"
+const char* const kV2MMixed[] = {
+    "#######.##.##.#...#######",
+    "#.....#..#.##...#.#.....#",
+    "#.###.#..#.###..#.#.###.#",
+    "#.###.#.#.#.#.#.#.#.###.#",
+    "#.###.#.##.######.#.###.#",
+    "#.....#.##.####.#.#.....#",
+    "#######.#.#.#.#.#.#######",
+    "........#.....#..........",
+    "#...#.##########.#####..#",
+    "#........##....##.####.#.",
+    "##.#..#.##...####...#.#..",
+    "#..#........##..##....##.",
+    ".#.##.#.#...##....##...##",
+    "#.####.#.##..##..##..#.##",
+    "..#.#.#.###....######.##.",
+    ".........#..#.##......#.#",
+    "###.#.######.##.######..#",
+    "........##..#...#...##...",
+    "#######.#.#####.#.#.###..",
+    "#.....#..#.#.#.##...##.##",
+    "#.###.#.##..##..######.##",
+    "#.###.#......###.##.#.#.#",
+    "#.###.#..##....##..#..##.",
+    "#.....#.....#.#.##.##..##",
+    "#######.####.##..#.#.#..#",
+};
+
+struct Fixture {
+  const char* name;
+  const char* const* rows;
+  int dim;
+  int version;
+  char ecc;
+  const char* payload;
+};
+
+const Fixture kFixtures[] = {
+    {"v1-M", kV1M, 21, 1, 'M', "ZACUS_QR_OK"},
+    {"v2-Q", kV2Q, 25, 2, 'Q', "ZACUS:ETAPE2*E930"},
+    {"v4-H", kV4H, 33, 4, 'H', "https://zacus.local/qr/unlock"},
+    {"v7-L",
+     kV7L,
+     45,
+     7,
+     'L',
+     "ZACUS/ARCHIVE/LE-MYSTERE-DU-PROFESSEUR-ZACUS-LE-MYSTERE-DU-PROFESSEUR-ZACUS-LE-MYSTERE-DU-PROFESSEUR-ZACUS-"
+     "LE-MYSTERE-DU-PROFESSEUR-ZACUS-FIN-ETAPE-2"},
+    {"v10-M",
+     kV10M,
+     57,
+     10,
+     'M',
+     "zacus://story/unlock?scene=SCENE_QR_DETECTOR&token=0123456789abcdef0123456789abcdef0123456789abcdef"
+     "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef0123456789a"},
+    {"v2-M mixed", kV2MMixed, 25, 2, 'M', "ZACUS-ETAPE-20261018ok"},
+};
+
+struct Pose {
+  float cx = 160.0f;
+  float cy = 120.0f;
+  float module_px = 4.0f;
+  float angle_deg = 0.0f;
+  float tilt = 0.0f;      // top edge shrinks / bottom edge grows by this ratio
+  bool blur = false;
+  int noise = 0;          // +/- luma
+  float gradient = 0.0f;  // light falloff across the frame
+};
+
+struct Homography {
+  double h[8];
+
+  bool solve(const QrPoint src[4], const QrPoint dst[4]) {
+    double m[8][9] = {};
+    for (int i = 0; i < 4; ++i) {
+      const double u = src[i].x;
+      const double v = src[i].y;
+      m[2 * i][0] = u;
+      m[2 * i][1] = v;
+      m[2 * i][2] = 1.0;
+      m[2 * i][6] = -u * dst[i].x;
+      m[2 * i][7] = -v * dst[i].x;
+      m[2 * i][8] = dst[i].x;
+      m[2 * i + 1][3] = u;
+      m[2 * i + 1][4] = v;
+      m[2 * i + 1][5] = 1.0;
+      m[2 * i + 1][6] = -u * dst[i].y;
+      m[2 * i + 1][7] = -v * dst[i].y;
+      m[2 * i + 1][8] = dst[i].y;
+    }
+    for (int col = 0; col < 8; ++col) {
+      int pivot = col;
+      for (int row = col + 1; row < 8; ++row) {
+        if (std::fabs(m[row][col]) > std::fabs(m[pivot][col])) {
+          pivot = row;
+        }
+      }
+      if (std::fabs(m[pivot][col]) < 1e-12) {
+        return false;
+      }
+      for (int k = 0; k < 9; ++k) {
+        std::swap(m[pivot][k], m[col][k]);
+      }
+      for (int row = 0; row < 8; ++row) {
+        if (row != col) {
+          const double f = m[row][col] / m[col][col];
+          for (int k = col; k < 9; ++k) {
+            m[row][k] -= f * m[col][k];
+          }
+        }
+      }
+    }
+    for (int i = 0; i < 8; ++i) {
+      h[i] = m[i][8] / m[i][i];
+    }
+    return true;
+  }
+
+  QrPoint map(double u, double v) const {
+    const double den = h[6] * u + h[7] * v + 1.0;
+    QrPoint p;
+    p.x = static_cast<float>((h[0] * u + h[1] * v + h[2]) / den);
+    p.y = static_cast<float>((h[3] * u + h[4] * v + h[5]) / den);
+    return p;
+  }
+};
+
+// Symbol corners (TL, TR, BR, BL) in frame pixels for a pose.
+void poseCorners(const Fixture& fx, const Pose& pose, QrPoint out[4]) {
+  const float half = fx.dim * pose.module_px / 2.0f;
+  const float top = half * (1.0f - pose.tilt);
+  const float bottom = half * (1.0f + pose.tilt);
+  const QrPoint local[4] = {{-top, -half}, {top, -half}, {bottom, half}, {-bottom, half}};
+  const float a = pose.angle_deg * 3.14159265f / 180.0f;
+  for (int i = 0; i < 4; ++i) {
+    out[i].x = pose.cx + local[i].x * std::cos(a) - local[i].y * std::sin(a);
+    out[i].y = pose.cy + local[i].x * std::sin(a) + local[i].y * std::cos(a);
+  }
+}
+
+// Renders the symbol (4-module quiet zone) onto a textured background with
+// 4x supersampling, then optional blur, light falloff and noise.
+std::vector<uint8_t> render(const Fixture& fx, int w, int h, const Pose& pose) {
+  QrPoint corners[4];
+  poseCorners(fx, pose, corners);
+  const float d = static_cast<float>(fx.dim);
+  const QrPoint modules[4] = {{0.0f, 0.0f}, {d, 0.0f}, {d, d}, {0.0f, d}};
+  Homography to_module;
+  to_module.solve(corners, modules);
+  std::vector<float> img(static_cast<size_t>(w) * h);
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      float acc = 0.0f;
+      for (int s = 0; s < 4; ++s) {
+        const QrPoint m = to_module.map(x + 0.25 + 0.5 * (s & 1), y + 0.25 + 0.5 * (s >> 1));
+        float value = 0.0f;
+        if (m.x >= -4.0f && m.y >= -4.0f && m.x < d + 4.0f && m.y < d + 4.0f) {
+          const int col = static_cast<int>(std::floor(m.x));
+          const int row = static_cast<int>(std::floor(m.y));
+          const bool dark = col >= 0 && row >= 0 && col < fx.dim && row < fx.dim && fx.rows[row][col] == '#';
+          value = dark ? 35.0f : 215.0f;
+        } else {
+          // Desk-like background: mid grey with soft blotches.
+          value = 140.0f + 30.0f * std::sin(x * 0.05f) * std::cos(y * 0.07f);
+        }
+        acc += value;
+      }
+      img[static_cast<size_t>(y) * w + x] = acc / 4.0f;
+    }
+  }
+  if (pose.blur) {
+    std::vector<float> tmp(img);
+    for (int y = 1; y < h - 1; ++y) {
+      for (int x = 1; x < w - 1; ++x) {
+        float acc = 0.0f;
+        for (int dy = -1; dy <= 1; ++dy) {
+          for (int dx = -1; dx <= 1; ++dx) {
+            acc += tmp[static_cast<size_t>(y + dy) * w + x + dx] * ((dx == 0 && dy == 0) ? 4.0f : 0.75f);
+          }
+        }
+        img[static_cast<size_t>(y) * w + x] = acc / 10.0f;
+      }
+    }
+  }
+  std::vector<uint8_t> out(img.size());
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      float value = img[static_cast<size_t>(y) * w + x] * (1.0f - pose.gradient * x / w);
+      if (pose.noise > 0) {
+        value += static_cast<float>(static_cast<int>(nextRandom() % (2U * pose.noise + 1U)) - pose.noise);
+      }
+      out[static_cast<size_t>(y) * w + x] = static_cast<uint8_t>(std::max(0.0f, std::min(255.0f, value)));
+    }
+  }
+  return out;
+}
+
+bool decodesTo(const Fixture& fx, const std::vector<uint8_t>& img, int w, int h, const QrRoi& roi, QrDecodeResult* out) {
+  QrDecoder decoder;
+  const QrDecodeStatus status = decoder.decode(img.data(), w, h, w, roi, out);
+  return status == QrDecodeStatus::kOk && std::strcmp(out->payload, fx.payload) == 0 &&
+         out->payload_len == std::strlen(fx.payload);
+}
+
+void testFixturesClean() {
+  for (const Fixture& fx : kFixtures) {
+    Pose pose;
+    pose.module_px = std::min(4.0f, 200.0f / fx.dim);
+    const std::vector<uint8_t> img = render(fx, 320, 240, pose);
+    QrDecodeResult result;
+    QrDecoder decoder;
+    const QrDecodeStatus status = decoder.decode(img.data(), 320, 240, 320, QrRoi(), &result);
+    if (status != QrDecodeStatus::kOk) {
+      std::printf("  %s: %s\n", fx.name, QrDecoder::statusName(status));
+    }
+    check(status == QrDecodeStatus::kOk, "clean fixture decodes");
+    check(std::strcmp(result.payload, fx.payload) == 0, "clean fixture payload");
+    check(result.payload_len == std::strlen(fx.payload), "clean fixture payload length");
+    check(result.version == fx.version, "clean fixture version");
+    check(result.ecc_level == fx.ecc, "clean fixture ecc level");
+    check(result.corrected_codewords == 0U, "clean fixture needs no correction");
+    QrPoint expected[4];
+    poseCorners(fx, pose, expected);
+    for (int i = 0; i < 4; ++i) {
+      const float err = std::hypot(result.corners[i].x - expected[i].x, result.corners[i].y - expected[i].y);
+      check(err < 1.5f * pose.module_px, "clean fixture corners");
+    }
+  }
+}
+
+void testFixturesCameraLike() {
+  for (const Fixture& fx : kFixtures) {
+    Pose pose;
+    pose.module_px = std::min(4.0f, 170.0f / fx.dim);
+    pose.cx = 150.0f;
+    pose.cy = 125.0f;
+    pose.angle_deg = 17.0f;
+    pose.tilt = 0.1f;
+    pose.blur = true;
+    pose.noise = 10;
+    pose.gradient = 0.35f;
+    const std::vector<uint8_t> img = render(fx, 320, 240, pose);
+    QrDecodeResult result;
+    const bool ok = decodesTo(fx, img, 320, 240, QrRoi(), &result);
+    if (!ok) {
+      std::printf("  %s: camera-like pose failed\n", fx.name);
+    }
+    check(ok, "camera-like fixture decodes");
+
+    // Upside down and mirrored-angle poses: orientation comes from the
+    // finder geometry, not from the frame axes. Skipped below 3.5 px per
+    // module, where blur plus tilt is already at the edge of QVGA.
+    if (pose.module_px < 3.5f) {
+      continue;
+    }
+    pose.angle_deg = 180.0f + 9.0f;
+    pose.tilt = -0.08f;
+    const std::vector<uint8_t> flipped = render(fx, 320, 240, pose);
+    const bool flipped_ok = decodesTo(fx, flipped, 320, 240, QrRoi(), &result);
+    if (!flipped_ok) {
+      std::printf("  %s: rotated pose failed\n", fx.name);
+    }
+    check(flipped_ok, "rotated fixture decodes");
+  }
+}
+
+void testDamage() {
+  const Fixture& fx = kFixtures[2];  // v4-H: 4 blocks, 16 parity words each
+  std::vector<std::string> damaged(fx.rows, fx.rows + fx.dim);
+  // Smudge across the data area (a few codewords in several blocks).
+  for (int row = 12; row < 18; ++row) {
+    for (int col = 14; col < 22; ++col) {
+      damaged[static_cast<size_t>(row)][static_cast<size_t>(col)] = ((row + col) % 3 == 0) ? '#' : '.';
+    }
+  }
+  std::vector<const char*> rows;
+  for (const std::string& row : damaged) {
+    rows.push_back(row.c_str());
+  }
+  Fixture smudged = fx;
+  smudged.rows = rows.data();
+  Pose pose;
+  const std::vector<uint8_t> img = render(smudged, 320, 240, pose);
+  QrDecodeResult result;
+  check(decodesTo(fx, img, 320, 240, QrRoi(), &result), "smudged symbol decodes");
+  check(result.corrected_codewords > 0U, "smudged symbol reports corrections");
+
+  // Beyond the ECC budget: must fail cleanly, never return a wrong payload.
+  for (int row = 9; row < fx.dim; ++row) {
+    for (int col = 9; col < fx.dim; ++col) {
+      if ((nextRandom() % 3U) == 0U) {
+        char& module = damaged[static_cast<size_t>(row)][static_cast<size_t>(col)];
+        module = (module == '#') ? '.' : '#';
+      }
+    }
+  }
+  rows.clear();
+  for (const std::string& row : damaged) {
+    rows.push_back(row.c_str());
+  }
+  smudged.rows = rows.data();
+  const std::vector<uint8_t> wrecked = render(smudged, 320, 240, pose);
+  QrDecoder decoder;
+  const QrDecodeStatus status = decoder.decode(wrecked.data(), 320, 240, 320, QrRoi(), &result);
+  check(status != QrDecodeStatus::kOk, "wrecked symbol is rejected");
+}
+
+void testNegativesAndArguments() {
+  QrDecoder decoder;
+  QrDecodeResult result;
+  std::vector<uint8_t> flat(320U * 240U, 128U);
+  check(decoder.decode(flat.data(), 320, 240, 320, QrRoi(), &result) == QrDecodeStatus::kNoFinder, "flat frame");
+  std::vector<uint8_t> noise(320U * 240U);
+  for (uint8_t& px : noise) {
+    px = static_cast<uint8_t>(nextRandom() & 0xFFU);
+  }
+  check(decoder.decode(noise.data(), 320, 240, 320, QrRoi(), &result) != QrDecodeStatus::kOk, "noise frame");
+  check(decoder.decode(nullptr, 320, 240, 320, QrRoi(), &result) == QrDecodeStatus::kInvalidArgument, "null frame");
+  check(decoder.decode(flat.data(), 320, 240, 100, QrRoi(), &result) == QrDecodeStatus::kInvalidArgument,
+        "short stride");
+  check(decoder.decode(flat.data(), 320, 240, 320, QrRoi{300, 220, 40, 40}, &result) ==
+            QrDecodeStatus::kInvalidArgument,
+        "roi clamped below minimum");
+  check(std::strcmp(QrDecoder::statusName(QrDecodeStatus::kEcc), "ecc") == 0, "status name");
+}
+
+void testRoi() {
+  const Fixture& fx = kFixtures[1];
+  Pose pose;
+  pose.cx = 230.0f;
+  pose.cy = 80.0f;
+  pose.module_px = 3.0f;
+  // Padded frame: stride wider than the visible width.
+  const int w = 320;
+  const int h = 240;
+  const int stride = 336;
+  const std::vector<uint8_t> img = render(fx, w, h, pose);
+  std::vector<uint8_t> padded(static_cast<size_t>(stride) * h, 0U);
+  for (int y = 0; y < h; ++y) {
+    std::memcpy(&padded[static_cast<size_t>(y) * stride], &img[static_cast<size_t>(y) * w], static_cast<size_t>(w));
+  }
+  QrDecoder decoder;
+  QrDecodeResult full;
+  check(decoder.decode(padded.data(), w, h, stride, QrRoi(), &full) == QrDecodeStatus::kOk, "strided frame decodes");
+
+  QrRoiTracker tracker;
+  tracker.reset(w, h);
+  check(tracker.fullFrame(), "tracker starts on the full frame");
+  tracker.onDecoded(full.corners);
+  const QrRoi roi = tracker.next();
+  check(!tracker.fullFrame(), "tracker narrows after a hit");
+  check(roi.w * roi.h < w * h / 2, "tracked window is much smaller than the frame");
+  for (const QrPoint& corner : full.corners) {
+    check(corner.x >= roi.x && corner.x <= roi.x + roi.w && corner.y >= roi.y && corner.y <= roi.y + roi.h,
+          "tracked window covers the symbol");
+  }
+  QrDecodeResult tracked;
+  check(decoder.decode(padded.data(), w, h, stride, roi, &tracked) == QrDecodeStatus::kOk, "roi decode");
+  check(std::strcmp(tracked.payload, fx.payload) == 0, "roi payload");
+  for (int i = 0; i < 4; ++i) {
+    check(std::fabs(tracked.corners[i].x - full.corners[i].x) < 1.0f &&
+              std::fabs(tracked.corners[i].y - full.corners[i].y) < 1.0f,
+          "roi corners are frame coordinates");
+  }
+  check(decoder.decode(padded.data(), w, h, stride, QrRoi{0, 120, 140, 120}, &tracked) == QrDecodeStatus::kNoFinder,
+        "roi away from the symbol");
+
+  // Misses grow the window, then fall back to the full frame.
+  int area = roi.w * roi.h;
+  for (uint8_t miss = 1U; miss < QrRoiTracker::kMissesBeforeFullFrame; ++miss) {
+    tracker.onMiss();
+    const QrRoi grown = tracker.next();
+    check(grown.w * grown.h >= area, "miss grows the window");
+    check(grown.x >= 0 && grown.y >= 0 && grown.x + grown.w <= w && grown.y + grown.h <= h, "window stays inside");
+    area = grown.w * grown.h;
+  }
+  tracker.onMiss();
+  check(tracker.fullFrame(), "tracker falls back to the full frame");
+
+  QrPoint tiny[4] = {{5.0f, 5.0f}, {9.0f, 5.0f}, {9.0f, 9.0f}, {5.0f, 9.0f}};
+  tracker.onDecoded(tiny);
+  check(tracker.next().w >= QrRoiTracker::kMinWindow && tracker.next().h >= QrRoiTracker::kMinWindow,
+        "window never below the minimum");
+}
+
+double bestMs(const std::vector<uint8_t>& img, int w, int h, const QrRoi& roi, int iterations) {
+  QrDecoder decoder;
+  QrDecodeResult result;
+  double best = 1e9;
+  for (int batch = 0; batch < 5; ++batch) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+      decoder.decode(img.data(), w, h, w, roi, &result);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count() / iterations);
+  }
+  return best;
+}
+
+void benchmarkDecode() {
+  const Fixture& fx = kFixtures[1];
+  Pose pose;
+  pose.cx = 120.0f;
+  pose.cy = 110.0f;
+  pose.angle_deg = 8.0f;
+  pose.blur = true;
+  pose.noise = 6;
+  const std::vector<uint8_t> img = render(fx, 320, 240, pose);
+  QrDecoder decoder;
+  QrDecodeResult result;
+  check(decoder.decode(img.data(), 320, 240, 320, QrRoi(), &result) == QrDecodeStatus::kOk, "bench frame decodes");
+  QrRoiTracker tracker;
+  tracker.reset(320, 240);
+  tracker.onDecoded(result.corners);
+  const QrRoi roi = tracker.next();
+  const double full_ms = bestMs(img, 320, 240, QrRoi(), 20);
+  const double roi_ms = bestMs(img, 320, 240, roi, 20);
+  std::printf("bench qvga %s: full=%.3f ms roi(%dx%d)=%.3f ms\n", fx.name, full_ms, roi.w, roi.h, roi_ms);
+  check(roi_ms < full_ms, "tracked roi decodes faster than the full frame");
+
+  // Success rate over randomized hand-held poses, per fixture.
+  for (const Fixture& sample : kFixtures) {
+    const int trials = 60;
+    int decoded = 0;
+    double total_ms = 0.0;
+    const float max_module = std::min(5.0f, 170.0f / sample.dim);
+    for (int trial = 0; trial < trials; ++trial) {
+      Pose p;
+      p.module_px = uniform(std::min(2.6f, max_module), max_module);
+      p.angle_deg = uniform(-35.0f, 35.0f);
+      p.tilt = uniform(-0.12f, 0.12f);
+      p.blur = (nextRandom() & 1U) != 0U;
+      p.noise = static_cast<int>(nextRandom() % 13U);
+      p.gradient = uniform(0.0f, 0.4f);
+      const float reach = sample.dim * p.module_px * 0.75f;
+      p.cx = uniform(reach, 320.0f - reach);
+      p.cy = uniform(std::min(120.0f, reach), std::max(120.0f, 240.0f - reach));
+      const std::vector<uint8_t> frame = render(sample, 320, 240, p);
+      const auto start = std::chrono::steady_clock::now();
+      const bool ok = decodesTo(sample, frame, 320, 240, QrRoi(), &result);
+      total_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+      decoded += ok ? 1 : 0;
+    }
+    const double rate = static_cast<double>(decoded) / trials;
+    std::printf("bench success %-10s %3d/%d (%.0f%%) avg=%.3f ms\n",
+                sample.name,
+                decoded,
+                trials,
+                rate * 100.0,
+                total_ms / trials);
+    // Versions that only fit QVGA at under 3.5 px per module are held to a
+    // lower bar; the game's own codes are version 1..4.
+    check(rate >= (max_module < 3.5f ? 0.8 : 0.9), "randomized pose success rate");
+  }
+}
+
+}  // namespace
+
+int main() {
+  testFixturesClean();
+  testFixturesCameraLike();
+  testDamage();
+  testNegativesAndArguments();
+  testRoi();
+  benchmarkDecode();
+  if (g_failures != 0u) {
+    std::printf("qr decoder host: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("qr decoder host: ok\n");
+  return 0;
+}
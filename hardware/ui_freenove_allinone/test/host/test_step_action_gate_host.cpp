@@ -0,0 +1,132 @@
+// Host test: StepActionGate, which decides when a step's actions run and when
+// a running take is auto-stopped. Replays the loop's pass sequence (entry,
+// forced re-render, action-less steps, goto/reset invalidation) against a
+// take model and checks that only real step changes stop it, so a step that
+// starts a recording keeps it across re-renders.
+// Build/run: make -C ../firmware step-action-gate-host
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "app/step_action_gate.h"
+
+#include "host_check.h"
+
+namespace {
+
+// Enough of MediaManager for the auto-stop: a stop leaves the take finalizing
+// and a REC_START during that window is refused (recorder_busy).
+struct TakeModel {
+  bool recording = false;
+  bool finalizing = false;
+  uint32_t stops = 0u;
+  uint32_t busy_refusals = 0u;
+
+  void noteStepChange() {
+    if (recording) {
+      recording = false;
+      finalizing = true;
+      ++stops;
+    }
+  }
+  void start() {
+    if (recording) {
+      return;
+    }
+    if (finalizing) {
+      ++busy_refusals;
+      return;
+    }
+    recording = true;
+  }
+  void writerDone() { finalizing = false; }
+};
+
+// Mirrors executeStoryActionsForStep(): a REC_START step starts the take.
+void pass(StepActionGate& gate, TakeModel& take, const char* step_key, bool rec_start_step, bool has_actions) {
+  const StepActionGate::Decision decision = gate.enter(step_key, has_actions);
+  if (decision.step_changed) {
+    take.noteStepChange();
+  }
+  if (decision.run_actions && rec_start_step) {
+    take.start();
+  }
+}
+
+void testDecisions() {
+  StepActionGate gate;
+  StepActionGate::Decision d = gate.enter("DEFAULT:STEP_A", true);
+  check(d.step_changed && d.run_actions, "first entry is a change and runs actions");
+  d = gate.enter("DEFAULT:STEP_A", true);
+  check(!d.step_changed && d.run_actions, "re-render runs actions without a change");
+  d = gate.enter("DEFAULT:STEP_B", false);
+  check(d.step_changed && !d.run_actions, "action-less step is still a change");
+  d = gate.enter("DEFAULT:STEP_B", false);
+  check(!d.step_changed && !d.run_actions, "action-less re-render does nothing");
+  gate.invalidate();
+  d = gate.enter("DEFAULT:STEP_B", false);
+  check(d.step_changed, "invalidate() makes the next pass a change");
+  d = gate.enter("OTHER:STEP_B", false);
+  check(d.step_changed, "same step id in another scenario is a change");
+  d = gate.enter(nullptr, false);
+  check(d.step_changed && std::strcmp(gate.lastKey(), "") == 0, "null key maps to empty");
+
+  const std::string long_key = "SCENARIO_" + std::string(100, 'X') + ":STEP";
+  d = gate.enter(long_key.c_str(), true);
+  check(d.step_changed, "long key entry is a change");
+  d = gate.enter(long_key.c_str(), true);
+  check(!d.step_changed, "long key compares on the kept prefix");
+  check(std::strlen(gate.lastKey()) == StepActionGate::kKeyCapacity - 1u, "long key truncated to capacity");
+}
+
+void testTakeLifetime() {
+  StepActionGate gate;
+  TakeModel take;
+
+  // Entering the recording step starts the take; forced re-renders of that
+  // step re-run REC_START but must not stop the take.
+  pass(gate, take, "DEFAULT:STEP_REC", true, true);
+  check(take.recording, "REC_START step starts the take");
+  for (int i = 0; i < 5; ++i) {
+    pass(gate, take, "DEFAULT:STEP_REC", true, true);
+  }
+  check(take.recording && take.stops == 0u, "re-render keeps the take");
+  check(take.busy_refusals == 0u, "re-render never hits recorder_busy");
+
+  // Leaving for a step without actions stops it.
+  pass(gate, take, "DEFAULT:STEP_QUIET", false, false);
+  check(!take.recording && take.stops == 1u, "action-less step stops the take");
+  pass(gate, take, "DEFAULT:STEP_QUIET", false, false);
+  check(take.stops == 1u, "staying in the step does not stop again");
+  take.writerDone();
+
+  // A goto back into the recording step starts a new take; the next real
+  // change (to a step with other actions) stops it.
+  pass(gate, take, "DEFAULT:STEP_REC", true, true);
+  check(take.recording, "re-entry starts a new take");
+  pass(gate, take, "DEFAULT:STEP_LIGHTS", false, true);
+  check(!take.recording && take.stops == 2u, "step with other actions stops the take");
+
+  // Re-entering while the previous take is still finalizing is refused, as
+  // on the device; once the writer is done a fresh entry records again.
+  pass(gate, take, "DEFAULT:STEP_REC", true, true);
+  check(!take.recording && take.busy_refusals == 1u, "start during finalize is refused");
+  take.writerDone();
+  gate.invalidate();
+  pass(gate, take, "DEFAULT:STEP_REC", true, true);
+  check(take.recording, "invalidated re-entry records after finalize");
+}
+
+}  // namespace
+
+int main() {
+  testDecisions();
+  testTakeLifetime();
+  if (g_failures != 0u) {
+    std::printf("step action gate host: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("step action gate host: ok\n");
+  return 0;
+}
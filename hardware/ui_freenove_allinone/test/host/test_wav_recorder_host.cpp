@@ -0,0 +1,371 @@
+// Host test: recorder codec and WAV writer (media::ImaAdpcm,
+// media::WavStreamWriter, media::PcmRingBuffer).
+// kReferenceAdpcmWav was produced from the same synthetic signal by an
+// independent IMA encoder (CPython audioop.lin2adpcm, nibbles repacked low
+// first, 64-byte blocks): the writer must match it byte for byte, and our
+// decoder must reproduce audioop.adpcm2lin on it. Also checks the PCM16
+// header, round-trip SNR on a voice-like signal, preallocation, periodic
+// header patches, sink failures and the SPSC ring across two threads.
+// Build/run: make -C ../firmware wav-recorder-host
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "system/media/ima_adpcm.h"
+#include "system/media/pcm_ring_buffer.h"
+#include "system/media/wav_stream_writer.h"
+
+#include "host_check.h"
+
+namespace {
+
+using media::ImaAdpcm;
+using media::PcmRingBuffer;
+using media::WavEncoding;
+using media::WavSink;
+using media::WavStreamConfig;
+using media::WavStreamWriter;
+
+constexpr uint8_t kReferenceAdpcmWav[] = {
+    0x52, 0x49, 0x46, 0x46, 0xF4, 0x00, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45, 0x66, 0x6D, 0x74, 0x20,
+    0x14, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x0E, 0x21, 0x00, 0x00,
+    0x40, 0x00, 0x04, 0x00, 0x02, 0x00, 0x79, 0x00, 0x66, 0x61, 0x63, 0x74, 0x04, 0x00, 0x00, 0x00,
+    0x2C, 0x01, 0x00, 0x00, 0x64, 0x61, 0x74, 0x61, 0xC0, 0x00, 0x00, 0x00, 0xEA, 0xD2, 0x00, 0x00,
+    0x77, 0x77, 0x77, 0x77, 0x57, 0x0F, 0x18, 0x08, 0x01, 0x00, 0xF1, 0x08, 0x00, 0x10, 0x00, 0x11,
+    0xAF, 0x01, 0x01, 0x10, 0x10, 0xF0, 0x1A, 0x00, 0x01, 0x01, 0x02, 0xBF, 0x10, 0x10, 0x11, 0x22,
+    0xDF, 0x00, 0x01, 0x10, 0x01, 0xF1, 0x0A, 0x01, 0x01, 0x02, 0x11, 0xBF, 0x00, 0x11, 0x11, 0x11,
+    0xF1, 0x1D, 0x18, 0x01, 0x01, 0x02, 0xBF, 0x01, 0x01, 0x01, 0x21, 0xCF, 0xFE, 0xE6, 0x4E, 0x00,
+    0x00, 0x01, 0x01, 0x11, 0xAF, 0x00, 0x10, 0x11, 0x01, 0xF1, 0x0B, 0x01, 0x11, 0x11, 0x31, 0xEF,
+    0x10, 0x00, 0x10, 0x10, 0xF1, 0x0A, 0x10, 0x01, 0x10, 0xF2, 0x1B, 0x10, 0x10, 0x11, 0x10, 0xBF,
+    0x10, 0x10, 0x20, 0x21, 0xF1, 0x0D, 0x01, 0x00, 0x11, 0x01, 0xAF, 0x10, 0x10, 0x01, 0x11, 0xF1,
+    0x0C, 0x20, 0x00, 0x82, 0x22, 0xCF, 0x00, 0x11, 0x10, 0x10, 0xAF, 0x10, 0x56, 0xF6, 0x4B, 0x00,
+    0x01, 0x01, 0x21, 0xBF, 0x00, 0x11, 0x01, 0x02, 0xF1, 0x0C, 0x01, 0x10, 0x11, 0x01, 0xBF, 0x10,
+    0x20, 0x01, 0x11, 0xF3, 0x0E, 0x10, 0x10, 0x00, 0xF1, 0x09, 0x10, 0x10, 0x98, 0x00, 0x88, 0x00,
+    0x88, 0x80, 0x00, 0x88, 0x00, 0x08, 0x88, 0x00, 0x88, 0x80, 0x00, 0x08, 0x88, 0x80, 0x00, 0x08,
+    0x88, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08, 0x08, 0x08, 0x88,
+};
+constexpr size_t kReferenceSamples = 300U;
+constexpr uint16_t kReferenceBlockBytes = 64U;
+constexpr uint32_t kReferenceDecodedChecksum = 0xAEBD893Au;  // h = h * 31 + (uint16)sample
+
+constexpr uint8_t kReferencePcmHeader[44] = {
+    0x52, 0x49, 0x46, 0x46, 0x2C, 0x00, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45, 0x66, 0x6D, 0x74, 0x20,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
+    0x02, 0x00, 0x10, 0x00, 0x64, 0x61, 0x74, 0x61, 0x08, 0x00, 0x00, 0x00,
+};
+
+// Sawtooth plus LCG noise; mirrored by the script that produced the reference.
+std::vector<int16_t> referenceSignal(size_t count) {
+  std::vector<int16_t> out(count);
+  uint32_t seed = 12345u;
+  for (size_t n = 0; n < count; ++n) {
+    seed = (seed * 1103515245u + 12345u) & 0x7FFFFFFFu;
+    const int32_t noise = static_cast<int32_t>((seed >> 16) % 2001u) - 1000;
+    const int32_t tone = (static_cast<int32_t>((n * 37u) % 400u) - 200) * 60;
+    int32_t value = tone + noise;
+    value = value > 32767 ? 32767 : (value < -32768 ? -32768 : value);
+    out[n] = static_cast<int16_t>(value);
+  }
+  return out;
+}
+
+// Vowel-like harmonics with a slow envelope and a little noise, 16 kHz.
+std::vector<int16_t> voiceSignal(size_t count) {
+  std::vector<int16_t> out(count);
+  uint32_t seed = 99u;
+  for (size_t n = 0; n < count; ++n) {
+    const double t = static_cast<double>(n) / 16000.0;
+    const double envelope = 0.55 + 0.45 * std::sin(2.0 * M_PI * 3.0 * t);
+    const double f0 = 140.0 + 30.0 * std::sin(2.0 * M_PI * 0.7 * t);
+    double value = 0.0;
+    for (int harmonic = 1; harmonic <= 8; ++harmonic) {
+      value += std::sin(2.0 * M_PI * f0 * harmonic * t) / harmonic;
+    }
+    seed = seed * 1664525u + 1013904223u;
+    const double noise = (static_cast<double>(seed >> 8) / 16777216.0 - 0.5) * 0.02;
+    out[n] = static_cast<int16_t>(std::lround((value * 0.3 + noise) * envelope * 32767.0 * 0.8));
+  }
+  return out;
+}
+
+uint32_t read32(const std::vector<uint8_t>& bytes, size_t offset) {
+  return static_cast<uint32_t>(bytes[offset]) | (static_cast<uint32_t>(bytes[offset + 1]) << 8) |
+         (static_cast<uint32_t>(bytes[offset + 2]) << 16) | (static_cast<uint32_t>(bytes[offset + 3]) << 24);
+}
+
+struct MemorySink : WavSink {
+  std::vector<uint8_t> bytes;
+  uint32_t reserved = 0u;
+  uint32_t flushes = 0u;
+  int fail_after_appends = -1;
+
+  bool reserve(uint32_t count) override {
+    reserved = count;
+    bytes.reserve(count);
+    return true;
+  }
+  bool append(const uint8_t* data, size_t count) override {
+    if (fail_after_appends == 0) {
+      return false;
+    }
+    if (fail_after_appends > 0) {
+      --fail_after_appends;
+    }
+    bytes.insert(bytes.end(), data, data + count);
+    return true;
+  }
+  bool writeAt(uint32_t offset, const uint8_t* data, size_t count) override {
+    if (offset + count > bytes.size()) {
+      return false;
+    }
+    std::memcpy(&bytes[offset], data, count);
+    return true;
+  }
+  bool flush() override {
+    ++flushes;
+    return true;
+  }
+};
+
+std::vector<int16_t> decodeAdpcmData(const uint8_t* data, size_t bytes, uint16_t block_bytes) {
+  std::vector<int16_t> out;
+  std::vector<int16_t> block(ImaAdpcm::samplesPerBlock(block_bytes));
+  for (size_t offset = 0; offset + block_bytes <= bytes; offset += block_bytes) {
+    if (!ImaAdpcm::decodeBlock(data + offset, block_bytes, block.data())) {
+      break;
+    }
+    out.insert(out.end(), block.begin(), block.end());
+  }
+  return out;
+}
+
+void testAdpcmReference() {
+  const std::vector<int16_t> signal = referenceSignal(kReferenceSamples);
+  MemorySink sink;
+  WavStreamConfig config;
+  config.encoding = WavEncoding::kImaAdpcm;
+  config.adpcm_block_bytes = kReferenceBlockBytes;
+  config.patch_every_bytes = 0u;
+  WavStreamWriter writer;
+  check(writer.begin(&sink, config), "adpcm writer begins");
+  // Uneven pieces, as the capture task delivers them.
+  size_t offset = 0;
+  for (size_t piece = 7; offset < signal.size(); piece = (piece * 3) % 97 + 1) {
+    const size_t count = (signal.size() - offset < piece) ? signal.size() - offset : piece;
+    check(writer.write(&signal[offset], count) == count, "adpcm piece accepted");
+    offset += count;
+  }
+  check(writer.finish(), "adpcm writer finishes");
+  check(sink.bytes.size() == sizeof(kReferenceAdpcmWav), "adpcm file size matches reference");
+  check(sink.bytes.size() == sizeof(kReferenceAdpcmWav) &&
+            std::memcmp(sink.bytes.data(), kReferenceAdpcmWav, sizeof(kReferenceAdpcmWav)) == 0,
+        "adpcm file matches reference bytes");
+
+  const std::vector<int16_t> decoded =
+      decodeAdpcmData(kReferenceAdpcmWav + 60, sizeof(kReferenceAdpcmWav) - 60, kReferenceBlockBytes);
+  uint32_t checksum = 0u;
+  for (size_t index = 0; index < kReferenceSamples && index < decoded.size(); ++index) {
+    checksum = checksum * 31u + static_cast<uint16_t>(decoded[index]);
+  }
+  check(decoded.size() >= kReferenceSamples && checksum == kReferenceDecodedChecksum,
+        "decoder matches reference decode");
+  uint8_t bad_block[kReferenceBlockBytes] = {};
+  bad_block[2] = 89u;
+  std::vector<int16_t> scratch(ImaAdpcm::samplesPerBlock(kReferenceBlockBytes));
+  check(!ImaAdpcm::decodeBlock(bad_block, kReferenceBlockBytes, scratch.data()), "step index out of range refused");
+}
+
+void testPcmHeader() {
+  MemorySink sink;
+  WavStreamConfig config;
+  config.encoding = WavEncoding::kPcm16;
+  WavStreamWriter writer;
+  check(writer.begin(&sink, config), "pcm writer begins");
+  const int16_t samples[4] = {1, -2, 0x1234, -32768};
+  check(writer.write(samples, 4) == 4u, "pcm samples accepted");
+  check(writer.finish(), "pcm writer finishes");
+  check(sink.bytes.size() == 52u && std::memcmp(sink.bytes.data(), kReferencePcmHeader, 44) == 0,
+        "pcm header matches reference");
+  const uint8_t payload[8] = {0x01, 0x00, 0xFE, 0xFF, 0x34, 0x12, 0x00, 0x80};
+  check(sink.bytes.size() == 52u && std::memcmp(&sink.bytes[44], payload, 8) == 0, "pcm payload little endian");
+  check(!writer.active() && writer.write(samples, 1) == 0u, "finished writer refuses samples");
+}
+
+void testRoundTripQuality() {
+  const std::vector<int16_t> signal = voiceSignal(16000u * 2u);
+  MemorySink sink;
+  WavStreamConfig config;
+  WavStreamWriter writer;
+  check(writer.begin(&sink, config), "voice writer begins");
+  check(writer.write(signal.data(), signal.size()) == signal.size(), "voice accepted");
+  check(writer.finish(), "voice finishes");
+  check(read32(sink.bytes, 48) == signal.size(), "fact chunk holds the real sample count");
+  const std::vector<int16_t> decoded = decodeAdpcmData(&sink.bytes[60], sink.bytes.size() - 60, 256u);
+  double signal_energy = 0.0;
+  double error_energy = 0.0;
+  for (size_t index = 0; index < signal.size() && index < decoded.size(); ++index) {
+    const double error = static_cast<double>(signal[index]) - decoded[index];
+    signal_energy += static_cast<double>(signal[index]) * signal[index];
+    error_energy += error * error;
+  }
+  const double snr_db = 10.0 * std::log10(signal_energy / (error_energy + 1.0));
+  const double ratio = static_cast<double>(signal.size() * 2u) / writer.stats().data_bytes;
+  check(decoded.size() >= signal.size(), "voice fully decoded");
+  check(snr_db >= 24.0, "adpcm round trip keeps voice quality");
+  check(ratio >= 3.9, "adpcm cuts storage bandwidth about 4x");
+  std::printf("adpcm voice: snr=%.1f dB ratio=%.2fx\n", snr_db, ratio);
+}
+
+void testPreallocationAndPatching() {
+  MemorySink sink;
+  WavStreamConfig config;
+  config.max_samples = 16000u;
+  config.patch_every_bytes = 4096u;
+  WavStreamWriter writer;
+  check(writer.begin(&sink, config), "bounded writer begins");
+  check(sink.reserved == 60u + WavStreamWriter::dataBytesFor(config, 16000u), "whole take reserved up front");
+  check(WavStreamWriter::dataBytesFor(config, 16000u) == 32u * 256u, "reservation rounds to whole blocks");
+
+  const std::vector<int16_t> signal = voiceSignal(20000u);
+  check(writer.write(signal.data(), 9000u) == 9000u, "first second accepted");
+  // Mid-take the file on the sink must already be a consistent WAV.
+  check(writer.stats().header_patches >= 1u, "header patched while recording");
+  check(read32(sink.bytes, 56) + 60u == sink.bytes.size(), "data size matches bytes on the sink");
+  check(read32(sink.bytes, 4) + 8u == sink.bytes.size(), "riff size matches bytes on the sink");
+  check(read32(sink.bytes, 48) % ImaAdpcm::samplesPerBlock(256u) == 0u && read32(sink.bytes, 48) > 0u,
+        "fact counts the flushed blocks");
+
+  check(writer.write(&signal[9000], 11000u) == 7000u, "writer stops at max_samples");
+  check(writer.full() && writer.stats().truncated_samples == 4000u, "truncation counted");
+  check(writer.finish(), "bounded writer finishes");
+  check(sink.bytes.size() == sink.reserved, "final size equals the reservation");
+  check(read32(sink.bytes, 48) == 16000u, "final fact count");
+
+  MemorySink failing;
+  failing.fail_after_appends = 2;
+  WavStreamWriter broken;
+  WavStreamConfig pcm;
+  pcm.encoding = WavEncoding::kPcm16;
+  check(broken.begin(&failing, pcm), "failing sink begins");
+  const size_t accepted = broken.write(signal.data(), signal.size());
+  check(broken.stats().sink_error && accepted < signal.size(), "sink error stops the writer");
+  check(broken.write(signal.data(), 16u) == 0u, "no writes after sink error");
+  check(!broken.finish(), "finish reports sink error");
+}
+
+void testRingBuffer() {
+  std::vector<int16_t> storage(1024u);
+  PcmRingBuffer ring;
+  check(!ring.begin(storage.data(), 1000u), "non power of two capacity refused");
+  check(ring.begin(storage.data(), 1024u), "ring begins");
+  std::vector<int16_t> input(1500u);
+  for (size_t index = 0; index < input.size(); ++index) {
+    input[index] = static_cast<int16_t>(index);
+  }
+  check(ring.push(input.data(), 1500u) == 1024u && ring.dropped() == 476u, "full ring drops and counts");
+  std::vector<int16_t> output(1500u);
+  check(ring.pop(output.data(), 600u) == 600u && output[599] == 599, "pop in order");
+  check(ring.push(&input[1024], 400u) == 400u, "push wraps around");
+  check(ring.pop(output.data(), 1500u) == 824u && output[423] == 1023 && output[424] == 1024 && output[823] == 1423,
+        "pop across the wrap");
+  check(ring.available() == 0u && ring.peakFill() == 1024u, "ring drained, peak kept");
+
+  ring.reset();
+  constexpr uint32_t kTotal = 8000u * 256u;
+  std::atomic<bool> producer_done{false};
+  uint32_t received = 0u;
+  uint32_t order_errors = 0u;
+  std::thread consumer([&]() {
+    std::vector<int16_t> chunk(505u);
+    uint16_t expected = 0u;
+    bool first = true;
+    while (true) {
+      const bool done = producer_done.load();
+      const uint32_t got = ring.pop(chunk.data(), 505u);
+      for (uint32_t index = 0; index < got; ++index) {
+        const uint16_t value = static_cast<uint16_t>(chunk[index]);
+        // Drops skip values but never reorder them.
+        if (!first && static_cast<int16_t>(value - expected) < 0) {
+          ++order_errors;
+        }
+        expected = static_cast<uint16_t>(value + 1u);
+        first = false;
+      }
+      received += got;
+      if (got == 0u) {
+        if (done) {
+          break;
+        }
+        std::this_thread::yield();
+      }
+    }
+  });
+  std::vector<int16_t> block(256u);
+  for (uint32_t sent = 0u; sent < kTotal; sent += 256u) {
+    for (uint32_t index = 0u; index < 256u; ++index) {
+      block[index] = static_cast<int16_t>(static_cast<uint16_t>(sent + index));
+    }
+    (void)ring.push(block.data(), 256u);
+    std::this_thread::yield();
+  }
+  producer_done.store(true);
+  consumer.join();
+  check(order_errors == 0u, "threaded ring keeps order");
+  check(received + ring.dropped() == kTotal, "every sample received or counted as dropped");
+  std::printf("stress ring: %u samples received=%u dropped=%u peak=%u\n",
+              static_cast<unsigned>(kTotal),
+              static_cast<unsigned>(received),
+              static_cast<unsigned>(ring.dropped()),
+              static_cast<unsigned>(ring.peakFill()));
+}
+
+uint32_t hostClockUs() {
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+}
+
+void benchEncode() {
+  const std::vector<int16_t> signal = voiceSignal(16000u * 10u);
+  MemorySink sink;
+  WavStreamConfig config;
+  config.clock_us = &hostClockUs;
+  WavStreamWriter writer;
+  const auto start = std::chrono::steady_clock::now();
+  check(writer.begin(&sink, config), "bench writer begins");
+  for (size_t offset = 0; offset < signal.size(); offset += 512u) {
+    const size_t count = (signal.size() - offset < 512u) ? signal.size() - offset : 512u;
+    (void)writer.write(&signal[offset], count);
+  }
+  check(writer.finish(), "bench writer finishes");
+  const double elapsed_ms =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  const media::WavStreamStats& stats = writer.stats();
+  check(stats.sink_writes > 1u && stats.write_us_max <= stats.write_us_total, "write latency recorded");
+  std::printf("bench adpcm: 10 s of 16 kHz audio in %.2f ms, %u sink writes, %u header patches\n",
+              elapsed_ms,
+              static_cast<unsigned>(stats.sink_writes),
+              static_cast<unsigned>(stats.header_patches));
+}
+
+}  // namespace
+
+int main() {
+  testAdpcmReference();
+  testPcmHeader();
+  testRoundTripQuality();
+  testPreallocationAndPatching();
+  testRingBuffer();
+  benchEncode();
+  if (g_failures != 0u) {
+    std::printf("wav recorder host: %u failure(s)\n", g_failures);
+    return 1;
+  }
+  std::printf("wav recorder host: ok\n");
+  return 0;
+}
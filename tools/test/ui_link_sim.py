@@ -6,6 +6,7 @@ from __future__ import annotations
 import argparse
 import importlib.util
 import platform
+import random
 import string
 import sys
 import time
@@ -121,6 +122,79 @@ def parse_script(raw_script: str) -> list[tuple[str, str]]:
     return events
 
 
+def emit_trace(path: Path, count: int, seed: int) -> int:
+    """Write synthetic v2 lines (valid and damaged) for host parser tests."""
+    rng = random.Random(seed)
+    modes = ("SIGNAL", "MP3", "U_LOCK", "STORY")
+    lines: list[str] = []
+    for index in range(count):
+        ms = str(index * 33)
+        roll = rng.random()
+        if roll < 0.55:
+            fields = {
+                "seq": str(index),
+                "ms": ms,
+                "mode": rng.choice(modes),
+                "la": str(rng.randint(0, 1)),
+                "mp3": str(rng.randint(0, 1)),
+                "sd": str(rng.randint(0, 1)),
+                "key": str(rng.randint(0, 6)),
+                "track": str(rng.randint(1, 40)),
+                "track_total": "40",
+                "vol": str(rng.randint(0, 100)),
+                "u_lock": str(rng.randint(0, 1)),
+                "u_son": str(rng.randint(0, 1)),
+                "tune_off": str(rng.randint(-8, 8)),
+                "tune_conf": str(rng.randint(0, 100)),
+                "u_lock_listen": str(rng.randint(0, 1)),
+                "mic": str(rng.randint(0, 100)),
+                "hold": str(rng.randint(0, 100)),
+                "startup": str(rng.randint(0, 3)),
+                "app": str(rng.randint(0, 4)),
+                "ui_page": str(rng.randint(0, 3)),
+                "ui_cursor": str(rng.randint(0, 9)),
+                "ui_offset": str(rng.randint(0, 9)),
+                "ui_count": str(rng.randint(0, 40)),
+                "queue": str(rng.randint(0, 8)),
+                "repeat": str(rng.randint(0, 2)),
+                "fx": str(rng.randint(0, 1)),
+                "backend": rng.choice(("AUTO", "AUDIO_TOOLS", "LEGACY")),
+                "scan": rng.choice(("IDLE", "SCANNING", "DONE")),
+                "err": rng.choice(("OK", "SD_MISSING", "NONE")),
+            }
+            line = build_frame("KEYFRAME" if index % 30 == 0 else "STAT", fields)
+        elif roll < 0.65:
+            line = build_frame("PING", {"ms": ms})
+        elif roll < 0.73:
+            line = build_frame(
+                "BTN",
+                {"id": rng.choice(sorted(VALID_BTNS)), "action": rng.choice(sorted(VALID_ACTIONS)), "ts": ms},
+            )
+        elif roll < 0.80:
+            line = build_frame(
+                "TOUCH",
+                {"x": str(rng.randint(0, 479)), "y": str(rng.randint(0, 319)), "action": "down", "ts": ms},
+            )
+        elif roll < 0.84:
+            line = build_frame("HELLO", {"proto": "2", "proto_max": "3", "ui_type": "TFT", "ui_id": "sim", "fw": "dev"})
+        elif roll < 0.87:
+            line = build_frame("ACK", {"proto": rng.choice(("2", "3")), "session": str(index)})
+        elif roll < 0.92:
+            good = build_frame("STAT", {"seq": str(index), "ms": ms, "mic": str(rng.randint(0, 100))})
+            pos = rng.randrange(0, len(good) - 5)
+            line = good[:pos] + chr(rng.randint(0x21, 0x7E)) + good[pos + 1 :]
+        elif roll < 0.96:
+            line = rng.choice(("STAT,=1*00\n", "STAT,,a=1\n", "BOGUS,a=1\n", "STAT,a\n", "*7F\n", "PING,ms=1*G1\n"))
+        else:
+            line = "STAT," + ",".join(f"k{i}=" + "9" * rng.randint(1, 12) for i in range(rng.randint(30, 50))) + "\n"
+        lines.append(line)
+
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text("".join(lines), encoding="ascii")
+    print(f"[info] wrote {len(lines)} lines to {path}")
+    return 0
+
+
 def send_frame(ser, msg_type: str, fields: dict[str, str]) -> None:
     frame = build_frame(msg_type, fields)
     print(f"[tx] {frame.strip()}")
@@ -244,8 +318,14 @@ def main() -> int:
     parser.add_argument("--caps", default="btn:1;touch:0;display:cli", help="HELLO caps field")
     parser.add_argument("--script", default="", help="Comma-separated BTN script, e.g. NEXT:click,OK:long")
     parser.add_argument("--script-delay-ms", type=int, default=300, help="Delay between scripted BTN events")
+    parser.add_argument("--emit-trace", type=Path, help="Write a synthetic line trace to PATH and exit (no serial needed)")
+    parser.add_argument("--trace-count", type=int, default=5000, help="Lines written by --emit-trace")
+    parser.add_argument("--trace-seed", type=int, default=1, help="Random seed for --emit-trace")
     args = parser.parse_args()
 
+    if args.emit_trace is not None:
+        return emit_trace(args.emit_trace, max(args.trace_count, 1), args.trace_seed)
+
     serial_module, list_ports_module = ensure_pyserial()
 
     repo_root = Path(__file__).resolve().parents[2]